@@ -15,6 +15,9 @@
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
  * 
+ * @note Compressed versions (fonts_rle.c) are generated with tools/bitmap_rle.py. They take 
+ * less flash and are drawn the same way.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -22,6 +25,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 17/10/2026 | Run length encoded fonts (font_22_rle to font_89_rle)					|
  * 
  **/
 
@@ -44,6 +48,7 @@ typedef struct{
 	uint8_t 		font_height;   	/*!< Font height in pixels */
 	char_info_t 	*info;			/*!< Character info array */
 	const uint8_t 	*data; 			/*!< Font array */
+	uint8_t 		compressed;		/*!< 1: data is run length encoded (tools/bitmap_rle.py) */
 } Font_t;
 
 /*==================[external data declaration]==============================*/
@@ -77,6 +82,26 @@ extern Font_t font_59;
  */
 extern Font_t font_89;
 
+/**
+ * @brief  22 pixels font height structure (compressed)
+ */
+extern Font_t font_22_rle;
+
+/**
+ * @brief  30 pixels font height structure (compressed)
+ */
+extern Font_t font_30_rle;
+
+/**
+ * @brief  59 pixels font height structure (compressed)
+ */
+extern Font_t font_59_rle;
+
+/**
+ * @brief  89 pixels font height structure (compressed)
+ */
+extern Font_t font_89_rle;
+
 /*==================[external functions declaration]=========================*/
 
 /** @} doxygen end group definition */
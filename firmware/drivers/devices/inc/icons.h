@@ -13,6 +13,9 @@
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
  * 
+ * @note Compressed versions (icons_rle.c) are generated with tools/bitmap_rle.py. They take 
+ * less flash and are drawn the same way.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -20,6 +23,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 17/10/2026 | Run length encoded icons (icon_30_rle to icon_89_rle)					|
  * 
  **/
 
@@ -106,6 +110,7 @@ typedef struct{
 	uint8_t 		width;			/*!< Icon width in pixels */
 	uint16_t 		offset;			/*!< Offset between icons in data array */
 	const uint8_t 	*data; 			/*!< Icon data array */
+	const uint32_t 	*rle_offset;	/*!< Position of each icon in run length encoded data array, NULL: data not compressed */
 } icon_font_t;
 
 /*==================[external data declaration]==============================*/
@@ -129,6 +134,21 @@ extern icon_font_t icon_59;
  */
 extern icon_font_t icon_89;
 
+/**
+ * @brief  30x30 pixels icon structure (compressed)
+ */
+extern icon_font_t icon_30_rle;
+
+/**
+ * @brief  59x59 pixels icon structure (compressed)
+ */
+extern icon_font_t icon_59_rle;
+
+/**
+ * @brief  89x89 pixels icon structure (compressed)
+ */
+extern icon_font_t icon_89_rle;
+
 /*==================[external functions declaration]=========================*/
 
 /** @} doxygen end group definition */
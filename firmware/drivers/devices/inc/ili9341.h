@@ -33,6 +33,17 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 17/10/2026 | ILI9341DrawInt() without per digit division    |
+ * | 17/10/2026 | SPI device registered once, queued transfers   |
+ * | 17/10/2026 | DMA fill and picture transfers                 |
+ * | 17/10/2026 | Framebuffer with dirty rectangles flush        |
+ * | 17/10/2026 | Double buffered display list renderer          |
+ * | 17/10/2026 | Glyph cache, strings drawn by lines            |
+ * | 17/10/2026 | Run length encoded fonts, icons and pictures   |
+ * | 17/10/2026 | Icons in a single window, sprite batches       |
+ * | 17/10/2026 | Lines and circles drawn by spans, AA lines     |
+ * | 17/10/2026 | Strip chart with hardware scrolling            |
+ * | 17/10/2026 | Window cache, command lists                    |
  *
  */
 
@@ -46,6 +57,7 @@
 #define ILI9341_WIDTH       240			/*!< LCD width in pixels */
 #define ILI9341_HEIGHT      320			/*!< LCD height in pixels */
 #define ILI9341_PIXEL_MAX	76800
+#define ILI9341_CHART_TRACES	4		/*!< Maximum number of strip chart traces */
 /* 16bits colors (RGB565) */			/*	 R,   G,   B */
 #define ILI9341_BLACK          	0x0000  /*   0,   0,   0 */
 #define ILI9341_NAVY           	0x000F 	/*   0,   0, 128 */
@@ -80,6 +92,70 @@ typedef enum ili9341_orientation {
 	ILI9341_Landscape_1, 	/*!< Landscape orientation mode 1 */
 	ILI9341_Landscape_2  	/*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
+
+/**
+ * @brief  Icon to draw with ILI9341DrawSprites()
+ */
+typedef struct {
+	uint16_t x;					/*!< X position of top left corner */
+	uint16_t y;					/*!< Y position of top left corner */
+	icon_t icon;				/*!< Icon */
+	icon_font_t *icon_font;		/*!< Icon font */
+	uint16_t foreground;		/*!< Foreground color (RGB565) */
+	uint16_t background;		/*!< Background color (RGB565) */
+	bool transparent;			/*!< Background pixels are not drawn (only in framebuffer mode or ILI9341Render()) */
+} ili9341_sprite_t;
+
+/**
+ * @brief  Strip chart configuration
+ */
+typedef struct {
+	uint16_t fixed_left;		/*!< Columns on the left that don't scroll (i.e. for labels) */
+	uint16_t fixed_right;		/*!< Columns on the right that don't scroll */
+	uint8_t num_traces;			/*!< Number of traces (up to ILI9341_CHART_TRACES) */
+	uint16_t colors[ILI9341_CHART_TRACES];	/*!< Color of each trace (RGB565) */
+	uint16_t background;		/*!< Background color (RGB565) */
+	uint16_t grid_color;		/*!< Grid color (RGB565) */
+	uint16_t grid_x;			/*!< Samples between vertical grid lines, 0: none */
+	uint16_t grid_y;			/*!< Rows between horizontal grid lines, 0: none */
+	int32_t min;				/*!< Value at the bottom of the chart */
+	int32_t max;				/*!< Value at the top of the chart */
+	bool autoscale;				/*!< Widen min/max when samples are out of range */
+} ili9341_chart_config_t;
+
+/**
+ * @brief  Display list primitives
+ */
+typedef enum ili9341_dl_type {
+	ILI9341_DL_FILL,				/*!< Entire LCD with color */
+	ILI9341_DL_PIXEL,				/*!< Pixel at (x0, y0) */
+	ILI9341_DL_LINE,				/*!< Line from (x0, y0) to (x1, y1) */
+	ILI9341_DL_RECTANGLE,			/*!< Rectangle from (x0, y0) to (x1, y1) */
+	ILI9341_DL_FILLED_RECTANGLE,	/*!< Filled rectangle from (x0, y0) to (x1, y1) */
+	ILI9341_DL_CIRCLE,				/*!< Circle centered on (x0, y0), radius x1 */
+	ILI9341_DL_FILLED_CIRCLE,		/*!< Filled circle centered on (x0, y0), radius x1 */
+	ILI9341_DL_TRIANGLE,			/*!< Triangle (x0, y0), (x1, y1), (x2, y2) */
+	ILI9341_DL_FILLED_TRIANGLE,		/*!< Filled triangle (x0, y0), (x1, y1), (x2, y2) */
+	ILI9341_DL_STRING,				/*!< String data at (x0, y0) with font, color and background */
+	ILI9341_DL_PICTURE				/*!< Picture data at (x0, y0), x1 width and y1 height */
+} ili9341_dl_type_t;
+
+/**
+ * @brief  Display list item
+ */
+typedef struct {
+	ili9341_dl_type_t type;	/*!< Primitive */
+	int16_t x0;				/*!< First point X */
+	int16_t y0;				/*!< First point Y */
+	int16_t x1;				/*!< Second point X (or radius, or width) */
+	int16_t y1;				/*!< Second point Y (or height) */
+	int16_t x2;				/*!< Third point X */
+	int16_t y2;				/*!< Third point Y */
+	uint16_t color;			/*!< Color (RGB565) */
+	uint16_t background;	/*!< Background color for strings (RGB565) */
+	Font_t *font;			/*!< Font for strings */
+	const void *data;		/*!< String or picture */
+} ili9341_dl_item_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -139,6 +215,17 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
  */
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background);
 
+/**
+ * @brief  		Draws several icons in one call
+ * @note		Sprites are sorted in place by position (top to bottom, left to right), and icons 
+ * 				of the same font placed side by side are drawn as a single window. Overlapping 
+ * 				sprites are drawn in that order.
+ * @param[inout]	sprites: Icons to draw
+ * @param[in]  	n: Number of icons
+ * @retval 		None
+ */
+void ILI9341DrawSprites(ili9341_sprite_t *sprites, uint16_t n);
+
 /**
  * @brief  		Draw an integer on the LCD
  * @param[in]  	x: X position of top left corner
@@ -185,6 +272,19 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
  */
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Draws an anti-aliased line
+ * @note		Only in framebuffer mode (or ILI9341Render()), otherwise ILI9341DrawLine() is used. 
+ * 				Pixels are blended with the framebuffer contents.
+ * @param[in]  	x0: Line X start point
+ * @param[in]  	y0: Line Y start point
+ * @param[in]  	x1: Line X end point
+ * @param[in]  	y1: Line Y end point
+ * @param[in]  	color: Line color (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
 /**
  * @brief  		Draws rectangle on the LCD
  * @param[in]  	x0: X coordinate of top left point
@@ -267,6 +367,144 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
 
+/**
+ * @brief  		Starts drawing on a RAM framebuffer instead of the LCD
+ * @note		All drawing functions write to RAM until ILI9341FramebufferDeInit(). Only the modified 
+ * 				areas are sent to the LCD by ILI9341Flush(). With band_height lower than LCD height, 
+ * 				the framebuffer holds a horizontal band selected by ILI9341FramebufferBand() and drawing 
+ * 				out of the band is discarded (draw the scene and flush once per band). 
+ * 				Call it again after ILI9341Rotate().
+ * @param[in]  	band_height: Rows of the framebuffer (0: full LCD, 2 bytes/pixel)
+ * @retval 		true when success, false when there is not enough memory
+ */
+bool ILI9341FramebufferInit(uint16_t band_height);
+
+/**
+ * @brief  		Selects the LCD rows held by the framebuffer (band mode)
+ * @param[in]  	y: First LCD row of the band
+ * @retval 		None
+ */
+void ILI9341FramebufferBand(uint16_t y);
+
+/**
+ * @brief  		Reads a pixel from the framebuffer (i.e. to dump it for testing)
+ * @param[in]  	x: X position of the pixel
+ * @param[in]  	y: Y position of the pixel
+ * @retval 		Color of pixel (RGB565), 0 if it is out of the framebuffer
+ */
+uint16_t ILI9341FramebufferGetPixel(uint16_t x, uint16_t y);
+
+/**
+ * @brief  		Sends the areas of the framebuffer modified since the last flush to the LCD
+ * @retval 		None
+ */
+void ILI9341Flush(void);
+
+/**
+ * @brief  		Frees the framebuffer, drawing functions write directly to the LCD again
+ * @retval 		None
+ */
+void ILI9341FramebufferDeInit(void);
+
+/**
+ * @brief  		Allocates the two band buffers of the display list renderer
+ * @note		Each buffer takes 320 x band_height x 2 bytes
+ * @param[in]  	band_height: Rows of each band (0: full LCD)
+ * @retval 		true when success, false when there is not enough memory
+ */
+bool ILI9341RenderInit(uint16_t band_height);
+
+/**
+ * @brief  		Draws a display list band by band, without flicker
+ * @note		Each band is drawn in RAM while the previous one is sent to the LCD by DMA. 
+ * 				Every pixel of the LCD is written once per frame, so the list should start with 
+ * 				the background (i.e. ILI9341_DL_FILL). Not available in framebuffer mode.
+ * @param[in]  	list: Primitives, in drawing order
+ * @param[in]  	len: Number of primitives
+ * @retval 		true when success, false when renderer is not initialized
+ */
+bool ILI9341Render(const ili9341_dl_item_t *list, uint16_t len);
+
+/**
+ * @brief  		Duration of the last ILI9341Render()
+ * @param[out] 	draw_us: Time spent drawing the bands (CPU)
+ * @param[out] 	frame_us: Total time of the frame (drawing and waiting the transfers)
+ * @retval 		None
+ */
+void ILI9341RenderGetTime(uint32_t *draw_us, uint32_t *frame_us);
+
+/**
+ * @brief  		Frees the band buffers of the display list renderer
+ * @retval 		None
+ */
+void ILI9341RenderDeInit(void);
+
+/**
+ * @brief  		Enables a cache of glyphs expanded to RGB565, for ILI9341DrawChar() and ILI9341DrawString()
+ * @note		Glyphs are cached by font, character and colors (least recently used ones are freed). 
+ * 				With cache enabled, ILI9341DrawString() draws the characters of each line as a single 
+ * 				window, filling the space between them with background color.
+ * @param[in]  	budget: Maximum bytes used by cached glyphs (a glyph takes width x height x 2 bytes), 0: disabled
+ * @retval 		None
+ */
+void ILI9341GlyphCacheInit(uint32_t budget);
+
+/**
+ * @brief  		Glyph cache statistics since ILI9341GlyphCacheInit()
+ * @param[out] 	hits: Glyphs found in cache
+ * @param[out] 	misses: Glyphs expanded (or not cached)
+ * @param[out] 	bytes: Bytes used by cached glyphs
+ * @retval 		None
+ */
+void ILI9341GlyphCacheGetStats(uint32_t *hits, uint32_t *misses, uint32_t *bytes);
+
+/**
+ * @brief  		Draw a run length encoded picture on the LCD
+ * @note		Pictures (2 bytes/pixel arrays) can be compressed with tools/bitmap_rle.py. They are 
+ * 				decoded while they are sent, without a buffer for the whole picture.
+ * @param[in] 	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in] 	width: Picture width in pixels
+ * @param[in]  	height: Picture height in pixels
+ * @param[in]  	pic: Pointer to first byte of compressed picture
+ * @retval 		None
+ */
+void ILI9341DrawPictureRle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
+
+/**
+ * @brief  		Starts a strip chart using the LCD hardware vertical scrolling
+ * @note		The LCD is rotated to ILI9341_Landscape_1: frame memory lines are LCD columns, so the 
+ * 				chart scrolls to the left. Each sample draws a single new column (full LCD height), 
+ * 				so it costs the same with any number of traces. Draw labels on the fixed columns 
+ * 				before adding samples. Not available in framebuffer mode.
+ * @param[in]  	config: Chart configuration
+ * @retval 		true when success, false on invalid configuration or not enough memory
+ */
+bool ILI9341ChartInit(const ili9341_chart_config_t *config);
+
+/**
+ * @brief  		Adds a sample of each trace to the strip chart
+ * @note		The column is sent by DMA while the function returns, so it sustains several 
+ * 				thousands of samples per second
+ * @param[in]  	samples: One value per trace
+ * @retval 		None
+ */
+void ILI9341ChartAdd(const int32_t *samples);
+
+/**
+ * @brief  		Current range of the strip chart (it changes with autoscale)
+ * @param[out] 	min: Value at the bottom of the chart
+ * @param[out] 	max: Value at the top of the chart
+ * @retval 		None
+ */
+void ILI9341ChartGetRange(int32_t *min, int32_t *max);
+
+/**
+ * @brief  		Stops the strip chart, restoring the scrolling area
+ * @retval 		None
+ */
+void ILI9341ChartDeInit(void);
+
 /**
  * @brief  	De-initializes ILI9341 LCD
  * @param	None
@@ -21,6 +21,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 17/10/2026 | Brightness and gamma table, frames encoded in one pass					|
+ * | 17/10/2026 | Animation engine, shift by ring offset									|
  * 
  **/
 
@@ -28,7 +30,9 @@
 #include <stdint.h>
 #include "sdkconfig.h"
 #include "esp_err.h"
+#include <stdbool.h>
 #include "gpio_mcu.h"
+#include "timer_mcu.h"
 /*==================[macros]=================================================*/
 #define BUILT_IN_RGB_LED_PIN          GPIO_8        /*> ESP32-C6-DevKitC-1 NeoPixel it's connected at GPIO_8 */
 #define BUILT_IN_RGB_LED_LENGTH       1             /*> ESP32-C6-DevKitC-1 NeoPixel has one pixel */
@@ -60,6 +64,8 @@
 #define NEOPIXEL_HUE_MAGENTA          0xD555      /*> Hue magenta */
 #define NEOPIXEL_HUE_ROSE             0xEAAA      /*> Hue rose */
 
+#define NEOPIXEL_ANIM_MAX             4           /*> Effects running at the same time */
+
 /*==================[typedef]================================================*/
 /**
  * @brief 24 bits color
@@ -69,6 +75,46 @@
  * 0x000000FF -> Blue
  */
 typedef uint32_t neopixel_color_t;
+
+/**
+ * @brief Animation effects
+ * 
+ */
+typedef enum {
+	NEOPIXEL_ANIM_KEYFRAMES,	/*!< Range color interpolated between keyframes */
+	NEOPIXEL_ANIM_FADE,			/*!< Range color fading from color to color2 in period_ms */
+	NEOPIXEL_ANIM_CHASE,		/*!< Block of size LEDs of color moving over color2, one LED every period_ms */
+	NEOPIXEL_ANIM_RAINBOW,		/*!< Rainbow repeated size times on the range, a hue turn every period_ms */
+	NEOPIXEL_ANIM_PIXEL,		/*!< Each LED color computed by pixel_func */
+} neopixel_anim_type_t;
+
+/**
+ * @brief Keyframe of a NEOPIXEL_ANIM_KEYFRAMES effect
+ * 
+ */
+typedef struct {
+	uint32_t time_ms;			/*!< Time from the start of the effect (increasing) */
+	neopixel_color_t color;		/*!< Color at that time */
+} neopixel_keyframe_t;
+
+/**
+ * @brief Animation effect on a range of LEDs
+ * 
+ */
+typedef struct {
+	neopixel_anim_type_t type;	/*!< Effect */
+	uint16_t first;				/*!< First LED of the range */
+	uint16_t count;				/*!< LEDs of the range */
+	uint32_t period_ms;			/*!< Duration or speed (see neopixel_anim_type_t) */
+	bool loop;					/*!< Fade and keyframes: start again when finished */
+	neopixel_color_t color;		/*!< Fade: start color, chase: block color */
+	neopixel_color_t color2;	/*!< Fade: end color, chase: background color */
+	uint16_t size;				/*!< Chase: block LEDs, rainbow: repetitions */
+	const neopixel_keyframe_t *keyframes;	/*!< Keyframes (kept by the caller) */
+	uint8_t num_keyframes;		/*!< Number of keyframes */
+	neopixel_color_t (*pixel_func)(uint16_t pixel, uint32_t time_ms, void *param);	/*!< Per-pixel effect: LED of the range, time from the start */
+	void *param;				/*!< Parameter of pixel_func */
+} neopixel_anim_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -114,10 +160,19 @@ void NeoPixelSetArray(neopixel_color_t *color_array);
  * @brief Shift the all NeoPixel colors in the array 1 position (up or down)
  * 
  * @note The last color'll be moved to the first position.
+ * @note The colors are not moved in color_array: NeoPixel i shows 
+ * color_array[(i + NeoPixelOffset()) % len].
  * @param upwards Shift direction: true: upwars, false: downwards.
  */
 void NeoPixelShift(bool upwards);
 
+/**
+ * @brief Position in color_array of the color shown by the first NeoPixel.
+ * 
+ * @return uint16_t Offset changed by NeoPixelShift()
+ */
+uint16_t NeoPixelOffset(void);
+
 /**
  * @brief Change NeoPixel brightness.
  * 
@@ -157,6 +212,52 @@ neopixel_color_t NeoPixelHSV2Color(uint16_t hue, uint8_t sat, uint8_t val);
  */
 void NeoPixelRainbow(uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps);
 
+/**
+ * @brief Add an effect to the animation.
+ * 
+ * @note Effects added later are drawn over the previous ones. The effect 
+ * starts at the current animation time.
+ * @param anim Effect (copied)
+ * @return int8_t Effect id, -1 if there is no room or the effect is invalid
+ */
+int8_t NeoPixelAnimAdd(const neopixel_anim_t *anim);
+
+/**
+ * @brief Remove an effect from the animation.
+ * 
+ * @note The NeoPixels keep their last colors.
+ * @param id Effect id returned by NeoPixelAnimAdd()
+ */
+void NeoPixelAnimRemove(int8_t id);
+
+/**
+ * @brief Compute the effects at an animation time.
+ * 
+ * @note Called by the animation task each frame. It can be called directly 
+ * (with the task stopped) to drive the animation with any clock: the colors 
+ * only depend on the time. Effects only rewrite the NeoPixels when their step changes.
+ * @param time_ms Animation time
+ * @return true if any color changed (or was set with the NeoPixel functions) since the last call
+ */
+bool NeoPixelAnimUpdate(uint32_t time_ms);
+
+/**
+ * @brief Start sending the animation at a fixed frame rate.
+ * 
+ * @note A timer wakes up a task every frame, that updates the effects and 
+ * sends the frame only if something changed. While the animation runs, the 
+ * other NeoPixel functions only change the colors, that are sent on the next frame.
+ * @param timer Timer used for the frame rate (it can't be used for anything else)
+ * @param fps Frames per second
+ */
+void NeoPixelAnimStart(timer_mcu_t timer, uint16_t fps);
+
+/**
+ * @brief Stop the animation task (effects are kept, and resume with NeoPixelAnimStart()).
+ * 
+ */
+void NeoPixelAnimStop(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
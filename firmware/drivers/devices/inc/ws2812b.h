@@ -19,6 +19,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 17/10/2026 | Frames sent by the RMT peripheral, without blocking the CPU				|
+ * | 17/10/2026 | Wire-ready frames (ws2812bFrame, gamma applied by the caller)			|
  * 
  **/
 
@@ -53,16 +55,46 @@ void ws2812bInit(gpio_t pin);
 /**
  * @brief Send color information to NeoPixel.
  * 
+ * @note Colors are stored until ws2812bSendRet() sends the whole frame.
+ * 
  * @param data NeoPixel color
  */
 void ws2812bSend(rgb_led_t led_color);
 
+/**
+ * @brief Get room for the colors of leds NeoPixels in the frame being filled.
+ * 
+ * @note The caller writes green, red and blue bytes of each NeoPixel, that are 
+ * sent as they are (without gamma correction) by ws2812bSendRet().
+ * 
+ * @param leds Number of NeoPixels
+ * @return Pointer to leds * 3 bytes, NULL if there is not enough memory
+ */
+uint8_t *ws2812bFrame(uint16_t leds);
+
+/**
+ * @brief Apply the gamma correction of the NeoPixels to a color component.
+ * 
+ * @param component Color level (0 to 255)
+ * @return Corrected level
+ */
+uint8_t ws2812bGammaCorrection(uint8_t component);
+
 /**
  * @brief Send a ret command to NeoPixel.
  * 
+ * @note Starts sending the colors stored with ws2812bSend() (followed by the 
+ * ret command) and returns: the RMT peripheral generates the signal while the 
+ * CPU keeps running and interrupts don't affect the timing.
  */
 void ws2812bSendRet(void);
 
+/**
+ * @brief Wait until the frames started with ws2812bSendRet() are sent.
+ * 
+ */
+void ws2812bWait(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
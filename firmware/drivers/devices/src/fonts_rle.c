@@ -0,0 +1,2415 @@
+/**
+ * @file fonts_rle.c
+ * @brief Compressed data generated by tools/bitmap_rle.py from fonts.c (do not edit)
+ * @version 0.1
+ * @date 2026-10-17
+ */
+
+/*==================[inclusions]=============================================*/
+#include "fonts.h"
+/*==================[external data definition]===============================*/
+/**
+ * @brief 22 pixels height compressed data array.
+ */
+const uint8_t font22_rle_data[] = {
+	0x2C, 0x06, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+	0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x05, 0x0D, 0x0C, 0x02,
+	0x02, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x54, 0x24, 0x02, 0x03,
+	0x02, 0x04, 0x02, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02, 0x02, 0x0A, 0x01, 0x0A, 0x03, 0x02, 0x03,
+	0x02, 0x04, 0x01, 0x04, 0x01, 0x05, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x02, 0x02, 0x16, 0x02,
+	0x02, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02, 0x04, 0x01, 0x04, 0x01, 0x2F,
+	0x05, 0x02, 0x08, 0x01, 0x09, 0x01, 0x07, 0x05, 0x03, 0x08, 0x02, 0x02, 0x05, 0x01, 0x01, 0x02,
+	0x08, 0x03, 0x08, 0x02, 0x08, 0x05, 0x07, 0x05, 0x08, 0x03, 0x08, 0x03, 0x08, 0x02, 0x08, 0x04,
+	0x05, 0x02, 0x01, 0x09, 0x02, 0x06, 0x06, 0x02, 0x08, 0x02, 0x08, 0x01, 0x10, 0x22, 0x04, 0x05,
+	0x02, 0x04, 0x01, 0x03, 0x01, 0x05, 0x01, 0x04, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x03,
+	0x02, 0x02, 0x02, 0x05, 0x02, 0x03, 0x02, 0x02, 0x01, 0x06, 0x02, 0x03, 0x02, 0x01, 0x02, 0x07,
+	0x01, 0x03, 0x01, 0x01, 0x02, 0x08, 0x04, 0x01, 0x02, 0x0E, 0x02, 0x03, 0x04, 0x06, 0x02, 0x03,
+	0x01, 0x03, 0x01, 0x05, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x01, 0x04, 0x02, 0x03, 0x02, 0x03,
+	0x02, 0x04, 0x02, 0x03, 0x02, 0x02, 0x02, 0x05, 0x02, 0x03, 0x02, 0x02, 0x01, 0x07, 0x01, 0x03,
+	0x01, 0x02, 0x02, 0x07, 0x04, 0x42, 0x20, 0x05, 0x07, 0x08, 0x06, 0x02, 0x04, 0x02, 0x06, 0x02,
+	0x04, 0x02, 0x06, 0x02, 0x04, 0x02, 0x06, 0x02, 0x03, 0x02, 0x08, 0x05, 0x09, 0x03, 0x05, 0x02,
+	0x03, 0x05, 0x04, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x03, 0x03, 0x02, 0x02,
+	0x01, 0x02, 0x05, 0x05, 0x02, 0x03, 0x05, 0x04, 0x03, 0x02, 0x05, 0x05, 0x02, 0x09, 0x01, 0x03,
+	0x03, 0x05, 0x04, 0x02, 0x38, 0x04, 0x09, 0x01, 0x01, 0x1D, 0x06, 0x02, 0x02, 0x02, 0x02, 0x01,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01,
+	0x03, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x03, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0B,
+	0x02, 0x06, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x01, 0x02, 0x04, 0x02, 0x04,
+	0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x02, 0x06, 0x02, 0x63, 0x36, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x04, 0x14, 0x04, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x36, 0x2E, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01,
+	0x01, 0x05, 0x42, 0x0C, 0x36, 0x2D, 0x02, 0x01, 0x05, 0x0D, 0x10, 0x02, 0x07, 0x02, 0x06, 0x02,
+	0x07, 0x02, 0x07, 0x02, 0x06, 0x02, 0x07, 0x02, 0x07, 0x01, 0x07, 0x02, 0x07, 0x02, 0x06, 0x02,
+	0x07, 0x02, 0x07, 0x02, 0x06, 0x02, 0x07, 0x02, 0x07, 0x01, 0x07, 0x02, 0x07, 0x02, 0x06, 0x02,
+	0x07, 0x02, 0x10, 0x21, 0x04, 0x05, 0x07, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x04, 0x05, 0x06,
+	0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x05, 0x04, 0x02, 0x02,
+	0x02, 0x04, 0x02, 0x02, 0x07, 0x05, 0x04, 0x2B, 0x1F, 0x02, 0x05, 0x04, 0x03, 0x03, 0x01, 0x02,
+	0x03, 0x02, 0x02, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02,
+	0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x03, 0x12, 0x24, 0x20, 0x05, 0x03, 0x08, 0x02, 0x02, 0x04,
+	0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07,
+	0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x14, 0x28, 0x20, 0x05, 0x03, 0x08, 0x02, 0x02, 0x04, 0x03,
+	0x08, 0x02, 0x08, 0x02, 0x07, 0x02, 0x04, 0x05, 0x05, 0x06, 0x09, 0x02, 0x09, 0x02, 0x08, 0x02,
+	0x08, 0x04, 0x05, 0x0C, 0x03, 0x05, 0x2B, 0x27, 0x03, 0x07, 0x04, 0x07, 0x04, 0x06, 0x02, 0x01,
+	0x02, 0x05, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02, 0x04, 0x02, 0x03, 0x02, 0x04, 0x01, 0x04,
+	0x02, 0x03, 0x02, 0x04, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x16, 0x07, 0x02, 0x09, 0x02, 0x09,
+	0x02, 0x2E, 0x1F, 0x08, 0x02, 0x08, 0x02, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x07, 0x03, 0x08,
+	0x08, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x04, 0x05, 0x02, 0x01, 0x08, 0x03, 0x06,
+	0x2B, 0x22, 0x04, 0x04, 0x07, 0x02, 0x03, 0x07, 0x02, 0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x01,
+	0x05, 0x02, 0x09, 0x01, 0x03, 0x04, 0x05, 0x06, 0x04, 0x06, 0x04, 0x06, 0x02, 0x01, 0x02, 0x04,
+	0x02, 0x02, 0x08, 0x03, 0x05, 0x2B, 0x1E, 0x14, 0x08, 0x02, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02,
+	0x08, 0x02, 0x07, 0x02, 0x08, 0x02, 0x07, 0x03, 0x07, 0x02, 0x07, 0x03, 0x07, 0x02, 0x07, 0x03,
+	0x07, 0x02, 0x2E, 0x21, 0x04, 0x05, 0x07, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02,
+	0x02, 0x04, 0x02, 0x02, 0x03, 0x02, 0x02, 0x04, 0x05, 0x06, 0x04, 0x05, 0x02, 0x02, 0x03, 0x02,
+	0x02, 0x04, 0x05, 0x06, 0x04, 0x06, 0x05, 0x04, 0x03, 0x01, 0x08, 0x03, 0x06, 0x2A, 0x21, 0x04,
+	0x04, 0x08, 0x01, 0x03, 0x04, 0x02, 0x01, 0x02, 0x06, 0x04, 0x06, 0x04, 0x06, 0x05, 0x04, 0x03,
+	0x01, 0x09, 0x02, 0x05, 0x01, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x02, 0x01, 0x01, 0x05, 0x03,
+	0x01, 0x08, 0x03, 0x05, 0x2C, 0x15, 0x09, 0x0F, 0x09, 0x0C, 0x25, 0x03, 0x02, 0x03, 0x02, 0x03,
+	0x1B, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0x03, 0x02, 0x08, 0x44, 0x02, 0x06,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x02, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08,
+	0x04, 0x08, 0x02, 0x32, 0x50, 0x14, 0x1E, 0x14, 0x46, 0x3C, 0x02, 0x08, 0x04, 0x08, 0x04, 0x08,
+	0x04, 0x08, 0x04, 0x08, 0x02, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x02, 0x3A,
+	0x13, 0x06, 0x02, 0x08, 0x01, 0x01, 0x05, 0x03, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02,
+	0x06, 0x02, 0x04, 0x04, 0x05, 0x02, 0x07, 0x02, 0x07, 0x02, 0x10, 0x02, 0x07, 0x02, 0x07, 0x02,
+	0x28, 0x39, 0x07, 0x08, 0x0B, 0x05, 0x03, 0x07, 0x03, 0x03, 0x03, 0x09, 0x03, 0x01, 0x03, 0x02,
+	0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x02, 0x07, 0x03, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+	0x03, 0x03, 0x04, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x02, 0x02, 0x03, 0x02, 0x04, 0x04, 0x02,
+	0x02, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x02, 0x02, 0x0B, 0x02,
+	0x02, 0x03, 0x03, 0x02, 0x04, 0x03, 0x02, 0x10, 0x02, 0x0F, 0x04, 0x06, 0x01, 0x07, 0x0A, 0x09,
+	0x07, 0x17, 0x2D, 0x02, 0x0A, 0x04, 0x09, 0x04, 0x08, 0x02, 0x01, 0x02, 0x08, 0x02, 0x02, 0x02,
+	0x07, 0x02, 0x02, 0x02, 0x06, 0x02, 0x04, 0x02, 0x05, 0x02, 0x04, 0x02, 0x05, 0x01, 0x05, 0x02,
+	0x04, 0x0A, 0x03, 0x0A, 0x03, 0x02, 0x06, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01, 0x02, 0x08, 0x05,
+	0x08, 0x02, 0x34, 0x1E, 0x07, 0x03, 0x08, 0x02, 0x02, 0x04, 0x03, 0x01, 0x02, 0x05, 0x02, 0x01,
+	0x02, 0x05, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x07, 0x03, 0x09, 0x01, 0x02, 0x05, 0x05, 0x06,
+	0x04, 0x06, 0x04, 0x06, 0x04, 0x05, 0x0C, 0x01, 0x07, 0x2B, 0x25, 0x06, 0x03, 0x09, 0x01, 0x03,
+	0x05, 0x02, 0x01, 0x02, 0x08, 0x03, 0x08, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02,
+	0x09, 0x03, 0x09, 0x02, 0x09, 0x03, 0x05, 0x02, 0x02, 0x09, 0x04, 0x06, 0x2D, 0x24, 0x08, 0x04,
+	0x0A, 0x02, 0x02, 0x05, 0x04, 0x01, 0x02, 0x07, 0x02, 0x01, 0x02, 0x07, 0x05, 0x08, 0x04, 0x08,
+	0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x07, 0x05, 0x07, 0x02, 0x01, 0x02, 0x05, 0x04, 0x01,
+	0x09, 0x03, 0x08, 0x34, 0x18, 0x12, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x07, 0x01, 0x07,
+	0x01, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x10, 0x20, 0x18, 0x12, 0x06,
+	0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x12, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06,
+	0x02, 0x06, 0x02, 0x26, 0x28, 0x07, 0x04, 0x09, 0x02, 0x03, 0x05, 0x02, 0x01, 0x02, 0x0A, 0x02,
+	0x09, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x04, 0x08, 0x04, 0x08, 0x08, 0x05, 0x07, 0x02, 0x01, 0x02,
+	0x07, 0x02, 0x02, 0x03, 0x05, 0x02, 0x02, 0x0A, 0x04, 0x06, 0x32, 0x21, 0x02, 0x07, 0x04, 0x07,
+	0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x1A, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07,
+	0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x02, 0x2C, 0x06, 0x1E, 0x08, 0x16, 0x02, 0x04, 0x02, 0x04,
+	0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04,
+	0x02, 0x04, 0x03, 0x03, 0x08, 0x01, 0x04, 0x19, 0x1E, 0x02, 0x05, 0x05, 0x04, 0x03, 0x01, 0x02,
+	0x04, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x04, 0x02, 0x01, 0x02, 0x05, 0x05,
+	0x05, 0x05, 0x05, 0x02, 0x01, 0x02, 0x05, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x03, 0x03, 0x02,
+	0x03, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x02, 0x05, 0x03, 0x28, 0x18,
+	0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06,
+	0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x10, 0x20, 0x30, 0x03, 0x0A, 0x07,
+	0x08, 0x08, 0x08, 0x06, 0x01, 0x02, 0x06, 0x02, 0x01, 0x04, 0x01, 0x02, 0x06, 0x02, 0x01, 0x04,
+	0x01, 0x02, 0x06, 0x01, 0x02, 0x04, 0x02, 0x02, 0x04, 0x02, 0x02, 0x04, 0x02, 0x02, 0x04, 0x02,
+	0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02,
+	0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02, 0x05, 0x04,
+	0x05, 0x02, 0x05, 0x02, 0x40, 0x21, 0x03, 0x06, 0x06, 0x05, 0x06, 0x05, 0x04, 0x01, 0x02, 0x04,
+	0x04, 0x01, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03, 0x04, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02,
+	0x04, 0x03, 0x02, 0x02, 0x04, 0x04, 0x02, 0x01, 0x04, 0x04, 0x02, 0x01, 0x04, 0x05, 0x06, 0x05,
+	0x06, 0x06, 0x05, 0x06, 0x03, 0x2C, 0x2E, 0x06, 0x06, 0x0A, 0x03, 0x04, 0x05, 0x03, 0x02, 0x02,
+	0x08, 0x02, 0x01, 0x03, 0x08, 0x05, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x05,
+	0x08, 0x03, 0x01, 0x02, 0x08, 0x02, 0x02, 0x03, 0x05, 0x04, 0x03, 0x0A, 0x06, 0x06, 0x3C, 0x1B,
+	0x07, 0x02, 0x08, 0x01, 0x02, 0x04, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x04, 0x0B, 0x01,
+	0x06, 0x03, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x2B, 0x34, 0x06,
+	0x08, 0x0A, 0x05, 0x04, 0x05, 0x03, 0x04, 0x02, 0x08, 0x02, 0x03, 0x03, 0x08, 0x03, 0x02, 0x02,
+	0x0A, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x02,
+	0x0A, 0x02, 0x02, 0x03, 0x08, 0x03, 0x03, 0x02, 0x08, 0x02, 0x04, 0x03, 0x05, 0x04, 0x05, 0x0B,
+	0x07, 0x06, 0x01, 0x03, 0x0E, 0x04, 0x0E, 0x02, 0x20, 0x1E, 0x07, 0x03, 0x08, 0x02, 0x02, 0x04,
+	0x03, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x04,
+	0x02, 0x02, 0x08, 0x02, 0x07, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x04,
+	0x03, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x05, 0x05, 0x06, 0x02, 0x28, 0x1D, 0x05, 0x03, 0x07,
+	0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x07, 0x02, 0x07, 0x03, 0x07, 0x04, 0x07, 0x04, 0x07, 0x03,
+	0x07, 0x03, 0x07, 0x02, 0x07, 0x04, 0x04, 0x0B, 0x02, 0x06, 0x26, 0x24, 0x18, 0x05, 0x02, 0x0A,
+	0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A,
+	0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x35, 0x21, 0x02, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04,
+	0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x05,
+	0x05, 0x03, 0x01, 0x03, 0x03, 0x03, 0x02, 0x09, 0x04, 0x05, 0x2F, 0x24, 0x02, 0x08, 0x04, 0x08,
+	0x04, 0x08, 0x02, 0x01, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x05, 0x02, 0x04,
+	0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x03, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06,
+	0x02, 0x02, 0x02, 0x06, 0x05, 0x08, 0x04, 0x08, 0x04, 0x09, 0x02, 0x35, 0x3C, 0x02, 0x06, 0x03,
+	0x07, 0x04, 0x06, 0x03, 0x06, 0x02, 0x01, 0x02, 0x06, 0x03, 0x06, 0x02, 0x02, 0x02, 0x05, 0x01,
+	0x01, 0x02, 0x05, 0x02, 0x02, 0x02, 0x04, 0x02, 0x01, 0x02, 0x05, 0x01, 0x03, 0x02, 0x04, 0x02,
+	0x01, 0x02, 0x04, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x02, 0x04, 0x02, 0x04, 0x02, 0x03, 0x01,
+	0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02,
+	0x03, 0x02, 0x02, 0x02, 0x06, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x01,
+	0x05, 0x02, 0x01, 0x01, 0x07, 0x04, 0x05, 0x04, 0x08, 0x03, 0x05, 0x04, 0x08, 0x03, 0x06, 0x03,
+	0x54, 0x21, 0x02, 0x06, 0x06, 0x05, 0x02, 0x02, 0x02, 0x04, 0x02, 0x04, 0x02, 0x03, 0x02, 0x04,
+	0x02, 0x02, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x04, 0x08, 0x03, 0x07, 0x04, 0x07, 0x02, 0x01,
+	0x02, 0x05, 0x02, 0x02, 0x02, 0x04, 0x03, 0x03, 0x02, 0x03, 0x02, 0x04, 0x03, 0x01, 0x02, 0x06,
+	0x02, 0x01, 0x02, 0x06, 0x03, 0x2C, 0x1E, 0x02, 0x06, 0x04, 0x06, 0x02, 0x01, 0x02, 0x04, 0x02,
+	0x02, 0x02, 0x04, 0x02, 0x03, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x05, 0x04, 0x06, 0x04,
+	0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x2C, 0x1E,
+	0x09, 0x01, 0x09, 0x08, 0x02, 0x07, 0x02, 0x07, 0x03, 0x07, 0x02, 0x07, 0x02, 0x07, 0x03, 0x07,
+	0x02, 0x07, 0x02, 0x07, 0x03, 0x07, 0x02, 0x07, 0x02, 0x08, 0x14, 0x28, 0x08, 0x0A, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x09, 0x02,
+	0x08, 0x02, 0x07, 0x02, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02,
+	0x08, 0x01, 0x08, 0x02, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02,
+	0x07, 0x02, 0x08, 0x02, 0x07, 0x02, 0x09, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x22, 0x02, 0x07, 0x04, 0x06, 0x04, 0x05,
+	0x02, 0x02, 0x01, 0x05, 0x02, 0x02, 0x02, 0x04, 0x01, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x02,
+	0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x02, 0x64, 0xF0, 0x18, 0x04, 0x02, 0x03, 0x02, 0x02, 0x02,
+	0x03, 0x02, 0x44, 0x41, 0x05, 0x03, 0x07, 0x02, 0x01, 0x05, 0x02, 0x07, 0x02, 0x02, 0x07, 0x01,
+	0x0B, 0x04, 0x04, 0x05, 0x04, 0x04, 0x03, 0x01, 0x08, 0x02, 0x04, 0x01, 0x02, 0x24, 0x14, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x02, 0x04, 0x02, 0x09, 0x01, 0x03,
+	0x04, 0x02, 0x01, 0x02, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x05, 0x04, 0x02,
+	0x01, 0x09, 0x01, 0x02, 0x01, 0x05, 0x2A, 0x3A, 0x05, 0x02, 0x07, 0x01, 0x02, 0x04, 0x03, 0x06,
+	0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x07, 0x02, 0x04, 0x01, 0x01, 0x07, 0x02, 0x05, 0x21,
+	0x1C, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x02, 0x05, 0x01, 0x02, 0x01, 0x09,
+	0x01, 0x02, 0x04, 0x05, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x02, 0x01, 0x02,
+	0x04, 0x03, 0x01, 0x09, 0x02, 0x04, 0x02, 0x02, 0x28, 0x49, 0x05, 0x03, 0x08, 0x02, 0x02, 0x04,
+	0x05, 0x06, 0x18, 0x08, 0x02, 0x09, 0x02, 0x05, 0x02, 0x01, 0x09, 0x03, 0x06, 0x29, 0x11, 0x04,
+	0x02, 0x05, 0x02, 0x02, 0x05, 0x02, 0x05, 0x02, 0x03, 0x0E, 0x02, 0x02, 0x05, 0x02, 0x05, 0x02,
+	0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x1F, 0x49, 0x07, 0x02,
+	0x08, 0x01, 0x03, 0x02, 0x03, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x03, 0x02,
+	0x03, 0x03, 0x06, 0x02, 0x07, 0x03, 0x02, 0x09, 0x07, 0x03, 0x0B, 0x06, 0x04, 0x06, 0x0B, 0x03,
+	0x06, 0x02, 0x12, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x01, 0x04,
+	0x02, 0x08, 0x01, 0x03, 0x03, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04,
+	0x05, 0x04, 0x05, 0x04, 0x05, 0x02, 0x24, 0x06, 0x04, 0x04, 0x16, 0x08, 0x12, 0x02, 0x03, 0x02,
+	0x0D, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x0B, 0x01, 0x12, 0x02, 0x07, 0x02, 0x07,
+	0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x04, 0x05, 0x03, 0x03, 0x01, 0x02, 0x02, 0x03, 0x02,
+	0x02, 0x01, 0x02, 0x04, 0x04, 0x05, 0x05, 0x04, 0x02, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03,
+	0x02, 0x03, 0x02, 0x02, 0x02, 0x04, 0x02, 0x01, 0x02, 0x05, 0x02, 0x24, 0x04, 0x20, 0x08, 0x70,
+	0x02, 0x01, 0x04, 0x03, 0x04, 0x02, 0x08, 0x01, 0x06, 0x01, 0x03, 0x03, 0x04, 0x03, 0x05, 0x05,
+	0x02, 0x05, 0x04, 0x05, 0x02, 0x05, 0x04, 0x05, 0x02, 0x05, 0x04, 0x05, 0x02, 0x05, 0x04, 0x05,
+	0x02, 0x05, 0x04, 0x05, 0x02, 0x05, 0x04, 0x05, 0x02, 0x05, 0x04, 0x05, 0x02, 0x05, 0x02, 0x40,
+	0x3F, 0x02, 0x01, 0x04, 0x02, 0x08, 0x01, 0x03, 0x03, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04,
+	0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x02, 0x24, 0x50, 0x05, 0x04, 0x09, 0x02,
+	0x02, 0x05, 0x02, 0x01, 0x02, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x02, 0x01,
+	0x02, 0x05, 0x02, 0x02, 0x09, 0x04, 0x05, 0x2F, 0x46, 0x02, 0x02, 0x04, 0x02, 0x09, 0x01, 0x03,
+	0x04, 0x05, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x05, 0x04, 0x02, 0x01, 0x09,
+	0x01, 0x02, 0x01, 0x05, 0x02, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x48, 0x05, 0x01,
+	0x02, 0x01, 0x09, 0x01, 0x02, 0x04, 0x05, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06,
+	0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x09, 0x02, 0x04, 0x02, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08,
+	0x02, 0x08, 0x02, 0x2A, 0x02, 0x01, 0x0C, 0x03, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04,
+	0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x1C, 0x33, 0x04, 0x01, 0x09, 0x04, 0x03, 0x05, 0x04,
+	0x05, 0x04, 0x05, 0x03, 0x05, 0x03, 0x04, 0x09, 0x01, 0x04, 0x1E, 0x1E, 0x02, 0x05, 0x02, 0x05,
+	0x02, 0x03, 0x0E, 0x02, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05,
+	0x02, 0x05, 0x05, 0x03, 0x04, 0x1C, 0x3F, 0x02, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04,
+	0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x05, 0x03, 0x03, 0x01, 0x08, 0x02, 0x04, 0x01, 0x02,
+	0x24, 0x46, 0x02, 0x06, 0x04, 0x06, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02,
+	0x02, 0x04, 0x01, 0x04, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06,
+	0x04, 0x06, 0x04, 0x07, 0x02, 0x2C, 0x70, 0x02, 0x05, 0x02, 0x05, 0x04, 0x05, 0x02, 0x05, 0x02,
+	0x01, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x03, 0x04,
+	0x03, 0x02, 0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02,
+	0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x05, 0x03, 0x04, 0x01, 0x01, 0x01,
+	0x06, 0x03, 0x04, 0x03, 0x06, 0x03, 0x04, 0x03, 0x43, 0x47, 0x02, 0x04, 0x03, 0x01, 0x03, 0x03,
+	0x02, 0x03, 0x02, 0x02, 0x02, 0x05, 0x02, 0x01, 0x02, 0x05, 0x04, 0x07, 0x03, 0x06, 0x04, 0x05,
+	0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02, 0x01, 0x03, 0x04, 0x03, 0x28,
+	0x46, 0x03, 0x05, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02, 0x05, 0x02, 0x02, 0x02, 0x03, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x02,
+	0x05, 0x02, 0x01, 0x02, 0x06, 0x03, 0x07, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x02,
+	0x05, 0x31, 0x0E, 0x04, 0x02, 0x05, 0x02, 0x04, 0x02, 0x04, 0x02, 0x05, 0x02, 0x04, 0x02, 0x04,
+	0x02, 0x05, 0x0E, 0x1C, 0x09, 0x03, 0x02, 0x04, 0x02, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02,
+	0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x04, 0x02, 0x04, 0x02,
+	0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x04, 0x03, 0x03, 0x01, 0x15,
+	0x06, 0x03, 0x03, 0x04, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02,
+	0x05, 0x02, 0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02,
+	0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x02, 0x04, 0x02, 0x03, 0x03, 0x2D, 0x04, 0x04, 0x02, 0x01,
+	0x05, 0x03, 0x04, 0x03, 0x01, 0x03, 0x04, 0x03, 0x05, 0x01, 0x02, 0x04, 0x03, 0x91,
+};
+
+/**
+ * @brief 22 pixels height compressed char info array.
+ */
+char_info_t font22_rle_info[] = {
+	{2, 0}, 		/*   */
+	{3, 1}, 		/* ! */
+	{6, 30}, 		/* " */
+	{11, 45}, 		/* # */
+	{10, 96}, 		/* $ */
+	{16, 141}, 		/* % */
+	{14, 230}, 		/* & */
+	{2, 293}, 		/* ' */
+	{4, 298}, 		/* ( */
+	{4, 340}, 		/* ) */
+	{8, 383}, 		/* * */
+	{10, 414}, 		/* + */
+	{3, 437}, 		/* , */
+	{6, 450}, 		/* - */
+	{3, 453}, 		/* . */
+	{9, 458}, 		/* / */
+	{10, 499}, 		/* 0 */
+	{9, 536}, 		/* 1 */
+	{10, 569}, 		/* 2 */
+	{10, 600}, 		/* 3 */
+	{11, 631}, 		/* 4 */
+	{10, 674}, 		/* 5 */
+	{10, 705}, 		/* 6 */
+	{10, 742}, 		/* 7 */
+	{10, 771}, 		/* 8 */
+	{10, 814}, 		/* 9 */
+	{3, 853}, 		/* : */
+	{5, 858}, 		/* ; */
+	{10, 877}, 		/* < */
+	{10, 900}, 		/* = */
+	{10, 905}, 		/* > */
+	{9, 928}, 		/* ? */
+	{17, 961}, 		/* @ */
+	{13, 1042}, 		/* A */
+	{10, 1091}, 		/* B */
+	{11, 1130}, 		/* C */
+	{12, 1165}, 		/* D */
+	{8, 1204}, 		/* E */
+	{8, 1229}, 		/* F */
+	{12, 1252}, 		/* G */
+	{11, 1291}, 		/* H */
+	{2, 1320}, 		/* I */
+	{6, 1323}, 		/* J */
+	{10, 1352}, 		/* K */
+	{8, 1407}, 		/* L */
+	{16, 1436}, 		/* M */
+	{11, 1509}, 		/* N */
+	{14, 1558}, 		/* O */
+	{9, 1599}, 		/* P */
+	{16, 1630}, 		/* Q */
+	{10, 1689}, 		/* R */
+	{9, 1740}, 		/* S */
+	{12, 1771}, 		/* T */
+	{11, 1800}, 		/* U */
+	{12, 1835}, 		/* V */
+	{20, 1884}, 		/* W */
+	{11, 1985}, 		/* X */
+	{10, 2038}, 		/* Y */
+	{10, 2079}, 		/* Z */
+	{4, 2108}, 		/* [ */
+	{9, 2142}, 		/* \ */
+	{4, 2183}, 		/* ] */
+	{10, 2217}, 		/* ^ */
+	{12, 2248}, 		/* _ */
+	{4, 2250}, 		/* ` */
+	{9, 2259}, 		/* a */
+	{10, 2286}, 		/* b */
+	{8, 2327}, 		/* c */
+	{10, 2352}, 		/* d */
+	{10, 2393}, 		/* e */
+	{7, 2414}, 		/* f */
+	{10, 2445}, 		/* g */
+	{9, 2482}, 		/* h */
+	{2, 2519}, 		/* i */
+	{5, 2524}, 		/* j */
+	{9, 2555}, 		/* k */
+	{2, 2604}, 		/* l */
+	{16, 2607}, 		/* m */
+	{9, 2656}, 		/* n */
+	{11, 2683}, 		/* o */
+	{10, 2712}, 		/* p */
+	{10, 2749}, 		/* q */
+	{6, 2787}, 		/* r */
+	{7, 2808}, 		/* s */
+	{7, 2827}, 		/* t */
+	{9, 2854}, 		/* u */
+	{10, 2881}, 		/* v */
+	{16, 2918}, 		/* w */
+	{10, 2985}, 		/* x */
+	{10, 3024}, 		/* y */
+	{7, 3073}, 		/* z */
+	{6, 3092}, 		/* { */
+	{1, 3134}, 		/* | */
+	{6, 3136}, 		/* } */
+	{11, 3179}, 		/* ~ */
+};
+
+Font_t font_22_rle = {
+	22,
+	font22_rle_info,
+	font22_rle_data,
+	1
+};
+
+/**
+ * @brief 30 pixels height compressed data array.
+ */
+const uint8_t font30_rle_data[] = {
+	0x3C, 0x06, 0x18, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+	0x02, 0x01, 0x02, 0x06, 0x0C, 0x12, 0x10, 0x03, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05,
+	0x03, 0x05, 0x03, 0x05, 0x03, 0x02, 0x01, 0x02, 0x03, 0x02, 0xA0, 0x3C, 0x02, 0x04, 0x03, 0x05,
+	0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x05, 0x03, 0x04, 0x02, 0x05, 0x02, 0x05, 0x02, 0x02,
+	0x1C, 0x03, 0x02, 0x04, 0x03, 0x05, 0x02, 0x04, 0x03, 0x05, 0x02, 0x04, 0x02, 0x05, 0x03, 0x04,
+	0x02, 0x05, 0x03, 0x04, 0x02, 0x03, 0x0D, 0x01, 0x0D, 0x03, 0x02, 0x05, 0x02, 0x05, 0x02, 0x04,
+	0x03, 0x05, 0x02, 0x04, 0x03, 0x05, 0x02, 0x04, 0x02, 0x05, 0x03, 0x04, 0x02, 0x05, 0x03, 0x04,
+	0x02, 0x58, 0x07, 0x02, 0x0B, 0x02, 0x0B, 0x02, 0x0B, 0x02, 0x08, 0x07, 0x04, 0x0A, 0x03, 0x03,
+	0x05, 0x02, 0x02, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x05, 0x09, 0x07,
+	0x08, 0x07, 0x09, 0x05, 0x0A, 0x03, 0x0A, 0x03, 0x0B, 0x02, 0x0B, 0x02, 0x0A, 0x05, 0x07, 0x03,
+	0x01, 0x0B, 0x04, 0x07, 0x08, 0x03, 0x0A, 0x02, 0x0B, 0x02, 0x0B, 0x02, 0x21, 0x50, 0x02, 0x04,
+	0x05, 0x09, 0x02, 0x04, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x03, 0x04, 0x02, 0x05,
+	0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x04, 0x03, 0x05, 0x02, 0x05, 0x02, 0x03, 0x03, 0x06,
+	0x02, 0x05, 0x02, 0x03, 0x02, 0x07, 0x03, 0x03, 0x03, 0x02, 0x02, 0x09, 0x07, 0x02, 0x03, 0x0A,
+	0x05, 0x03, 0x02, 0x12, 0x02, 0x03, 0x05, 0x0A, 0x03, 0x02, 0x07, 0x09, 0x02, 0x02, 0x03, 0x03,
+	0x03, 0x07, 0x02, 0x03, 0x02, 0x05, 0x02, 0x06, 0x03, 0x03, 0x02, 0x05, 0x02, 0x05, 0x03, 0x04,
+	0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x04, 0x02, 0x06, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x07, 0x07, 0x04, 0x02, 0x09, 0x05, 0x04, 0x02, 0x7A, 0x29, 0x06, 0x0A, 0x09, 0x08, 0x03,
+	0x04, 0x04, 0x07, 0x03, 0x05, 0x03, 0x07, 0x02, 0x06, 0x03, 0x07, 0x02, 0x06, 0x03, 0x07, 0x03,
+	0x04, 0x03, 0x08, 0x03, 0x03, 0x04, 0x09, 0x03, 0x01, 0x04, 0x0A, 0x06, 0x0C, 0x05, 0x06, 0x03,
+	0x03, 0x06, 0x06, 0x03, 0x02, 0x03, 0x02, 0x03, 0x05, 0x03, 0x01, 0x03, 0x04, 0x03, 0x04, 0x02,
+	0x02, 0x03, 0x05, 0x03, 0x03, 0x02, 0x02, 0x03, 0x06, 0x03, 0x01, 0x03, 0x02, 0x03, 0x07, 0x05,
+	0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x08, 0x05, 0x03, 0x03, 0x05, 0x08, 0x03, 0x0A, 0x02, 0x04,
+	0x03, 0x07, 0x06, 0x02, 0x6C, 0x06, 0x15, 0x01, 0x02, 0x3C, 0x0F, 0x03, 0x03, 0x02, 0x03, 0x03,
+	0x03, 0x02, 0x04, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x04, 0x02, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x03, 0x03, 0x04, 0x02, 0x04, 0x03, 0x03, 0x03, 0x04, 0x02,
+	0x04, 0x03, 0x0C, 0x03, 0x04, 0x02, 0x04, 0x03, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x03, 0x03,
+	0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x04, 0x02, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x18, 0x02, 0x08, 0x02, 0x04,
+	0x01, 0x03, 0x02, 0x03, 0x04, 0x01, 0x02, 0x01, 0x0D, 0x02, 0x05, 0x05, 0x05, 0x03, 0x0D, 0x01,
+	0x02, 0x01, 0x04, 0x03, 0x02, 0x03, 0x01, 0x04, 0x02, 0x08, 0x02, 0xA4, 0x76, 0x02, 0x0C, 0x02,
+	0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x02, 0x06, 0x1C, 0x06, 0x02, 0x0C, 0x02, 0x0C, 0x02,
+	0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x02, 0x76, 0x66, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02,
+	0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x0D, 0x78, 0x10, 0x68, 0x3C, 0x0C, 0x12, 0x16, 0x02,
+	0x09, 0x03, 0x09, 0x02, 0x09, 0x03, 0x09, 0x03, 0x09, 0x02, 0x09, 0x03, 0x09, 0x03, 0x09, 0x02,
+	0x09, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x09, 0x03, 0x09, 0x02, 0x09, 0x03, 0x09, 0x03, 0x09, 0x02,
+	0x09, 0x03, 0x09, 0x03, 0x09, 0x02, 0x09, 0x03, 0x09, 0x02, 0x09, 0x03, 0x09, 0x03, 0x09, 0x02,
+	0x09, 0x03, 0x09, 0x03, 0x21, 0x3C, 0x06, 0x07, 0x09, 0x04, 0x03, 0x04, 0x03, 0x03, 0x03, 0x06,
+	0x03, 0x02, 0x03, 0x06, 0x03, 0x01, 0x03, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08,
+	0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x03, 0x01, 0x03, 0x06, 0x03, 0x02,
+	0x03, 0x06, 0x03, 0x03, 0x03, 0x04, 0x03, 0x04, 0x09, 0x07, 0x06, 0x58, 0x35, 0x03, 0x07, 0x05,
+	0x05, 0x07, 0x04, 0x04, 0x01, 0x03, 0x04, 0x02, 0x03, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03,
+	0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03,
+	0x09, 0x03, 0x09, 0x03, 0x04, 0x18, 0x48, 0x37, 0x06, 0x05, 0x09, 0x03, 0x03, 0x04, 0x04, 0x02,
+	0x01, 0x07, 0x04, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x09,
+	0x03, 0x09, 0x03, 0x09, 0x04, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09,
+	0x1A, 0x4E, 0x37, 0x06, 0x06, 0x09, 0x03, 0x03, 0x04, 0x03, 0x03, 0x01, 0x07, 0x03, 0x0A, 0x03,
+	0x0A, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x09, 0x04, 0x04, 0x07, 0x06, 0x09, 0x0A, 0x04, 0x0A, 0x04,
+	0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x04, 0x08, 0x07, 0x05, 0x04, 0x01, 0x0B, 0x04, 0x07, 0x52, 0x44,
+	0x04, 0x0A, 0x05, 0x09, 0x06, 0x09, 0x02, 0x01, 0x03, 0x08, 0x03, 0x01, 0x03, 0x08, 0x02, 0x02,
+	0x03, 0x07, 0x02, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x02, 0x04, 0x03, 0x05, 0x03, 0x04,
+	0x03, 0x04, 0x03, 0x05, 0x03, 0x04, 0x02, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x1E, 0x09,
+	0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x5D, 0x35, 0x0B, 0x02, 0x0B, 0x02, 0x03,
+	0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x09, 0x04, 0x0A, 0x0A, 0x04,
+	0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x01, 0x02, 0x06, 0x04,
+	0x01, 0x0B, 0x04, 0x07, 0x52, 0x39, 0x06, 0x05, 0x09, 0x03, 0x04, 0x05, 0x01, 0x03, 0x03, 0x09,
+	0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x02, 0x05, 0x03, 0x0C, 0x01, 0x04, 0x05,
+	0x03, 0x01, 0x03, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x03, 0x01, 0x03, 0x05,
+	0x03, 0x02, 0x04, 0x03, 0x04, 0x03, 0x09, 0x06, 0x05, 0x52, 0x34, 0x1A, 0x0A, 0x03, 0x09, 0x03,
+	0x0A, 0x03, 0x0A, 0x02, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03,
+	0x0A, 0x02, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x0A, 0x02,
+	0x56, 0x3C, 0x06, 0x06, 0x0A, 0x04, 0x03, 0x04, 0x04, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06,
+	0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x04, 0x05, 0x03, 0x03, 0x04, 0x03, 0x03, 0x05, 0x08, 0x07,
+	0x05, 0x08, 0x08, 0x05, 0x04, 0x02, 0x04, 0x03, 0x03, 0x06, 0x03, 0x01, 0x03, 0x08, 0x06, 0x08,
+	0x06, 0x08, 0x06, 0x08, 0x03, 0x01, 0x03, 0x06, 0x03, 0x02, 0x0B, 0x05, 0x07, 0x58, 0x38, 0x05,
+	0x06, 0x09, 0x03, 0x04, 0x03, 0x04, 0x02, 0x03, 0x05, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03,
+	0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x03, 0x01, 0x03, 0x05, 0x04, 0x01, 0x0C, 0x03, 0x06,
+	0x01, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x03, 0x01, 0x05, 0x04,
+	0x03, 0x09, 0x05, 0x06, 0x53, 0x1B, 0x0C, 0x15, 0x0C, 0x12, 0x34, 0x03, 0x02, 0x03, 0x02, 0x03,
+	0x02, 0x03, 0x20, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03,
+	0x02, 0x02, 0x0D, 0x67, 0x01, 0x0A, 0x03, 0x08, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x08, 0x03, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x06, 0x09, 0x05, 0x0A, 0x03, 0x0C,
+	0x01, 0x68, 0x8F, 0x1A, 0x34, 0x1A, 0x8F, 0x5B, 0x01, 0x0C, 0x03, 0x0A, 0x05, 0x09, 0x06, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x03, 0x08, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06,
+	0x05, 0x08, 0x03, 0x0A, 0x01, 0x74, 0x18, 0x06, 0x03, 0x09, 0x02, 0x02, 0x04, 0x04, 0x08, 0x04,
+	0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x07, 0x04, 0x06, 0x04, 0x04, 0x06, 0x05, 0x05,
+	0x06, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x1E, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03,
+	0x47, 0x4E, 0x08, 0x0D, 0x0D, 0x08, 0x04, 0x07, 0x05, 0x06, 0x03, 0x0B, 0x04, 0x04, 0x03, 0x0D,
+	0x03, 0x03, 0x03, 0x0F, 0x03, 0x02, 0x02, 0x05, 0x04, 0x02, 0x02, 0x03, 0x03, 0x01, 0x03, 0x04,
+	0x08, 0x04, 0x03, 0x01, 0x02, 0x04, 0x03, 0x03, 0x03, 0x05, 0x02, 0x01, 0x02, 0x04, 0x02, 0x04,
+	0x03, 0x05, 0x05, 0x03, 0x03, 0x05, 0x02, 0x04, 0x06, 0x03, 0x03, 0x04, 0x03, 0x04, 0x06, 0x03,
+	0x03, 0x04, 0x02, 0x05, 0x05, 0x04, 0x02, 0x05, 0x02, 0x05, 0x02, 0x01, 0x02, 0x04, 0x02, 0x04,
+	0x03, 0x04, 0x03, 0x01, 0x02, 0x04, 0x03, 0x02, 0x05, 0x02, 0x03, 0x02, 0x02, 0x05, 0x06, 0x01,
+	0x06, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x15, 0x02, 0x15, 0x03, 0x15, 0x03, 0x15,
+	0x04, 0x08, 0x02, 0x0A, 0x0D, 0x0C, 0x09, 0x36, 0x4B, 0x03, 0x0D, 0x04, 0x0D, 0x05, 0x0B, 0x06,
+	0x0B, 0x03, 0x01, 0x02, 0x0B, 0x02, 0x02, 0x03, 0x09, 0x03, 0x02, 0x03, 0x09, 0x03, 0x03, 0x03,
+	0x08, 0x02, 0x04, 0x03, 0x07, 0x03, 0x04, 0x03, 0x07, 0x02, 0x06, 0x03, 0x05, 0x03, 0x06, 0x03,
+	0x05, 0x03, 0x06, 0x03, 0x05, 0x0D, 0x03, 0x0E, 0x03, 0x03, 0x09, 0x03, 0x02, 0x02, 0x0A, 0x03,
+	0x01, 0x03, 0x0A, 0x03, 0x01, 0x03, 0x0B, 0x05, 0x0C, 0x03, 0x66, 0x34, 0x09, 0x04, 0x0B, 0x02,
+	0x03, 0x05, 0x03, 0x02, 0x03, 0x06, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01,
+	0x03, 0x06, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03, 0x05, 0x03, 0x02, 0x0A, 0x03, 0x0B, 0x02,
+	0x03, 0x05, 0x04, 0x01, 0x03, 0x06, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x06,
+	0x03, 0x01, 0x0B, 0x02, 0x09, 0x52, 0x3E, 0x05, 0x07, 0x09, 0x04, 0x03, 0x05, 0x03, 0x02, 0x03,
+	0x08, 0x01, 0x01, 0x03, 0x0B, 0x03, 0x0A, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03,
+	0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0C, 0x03, 0x0B, 0x03, 0x0B, 0x04, 0x08, 0x01, 0x02, 0x04,
+	0x05, 0x03, 0x03, 0x0A, 0x06, 0x06, 0x57, 0x40, 0x0A, 0x06, 0x0C, 0x04, 0x03, 0x06, 0x04, 0x03,
+	0x03, 0x08, 0x03, 0x02, 0x03, 0x09, 0x03, 0x01, 0x03, 0x09, 0x03, 0x01, 0x03, 0x0A, 0x06, 0x0A,
+	0x06, 0x0A, 0x06, 0x0A, 0x06, 0x0A, 0x06, 0x0A, 0x06, 0x0A, 0x06, 0x0A, 0x06, 0x09, 0x03, 0x01,
+	0x03, 0x09, 0x03, 0x01, 0x03, 0x08, 0x03, 0x02, 0x03, 0x06, 0x04, 0x03, 0x0C, 0x04, 0x0A, 0x66,
+	0x2C, 0x19, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x0A,
+	0x01, 0x0A, 0x01, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03,
+	0x08, 0x16, 0x42, 0x2C, 0x19, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08,
+	0x03, 0x08, 0x19, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08,
+	0x03, 0x08, 0x03, 0x4A, 0x46, 0x07, 0x07, 0x0B, 0x04, 0x04, 0x06, 0x03, 0x02, 0x04, 0x09, 0x01,
+	0x01, 0x04, 0x0C, 0x03, 0x0D, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0D, 0x03, 0x05, 0x0B, 0x05, 0x0B,
+	0x0A, 0x06, 0x0A, 0x07, 0x09, 0x03, 0x01, 0x03, 0x09, 0x03, 0x01, 0x04, 0x08, 0x03, 0x02, 0x03,
+	0x08, 0x03, 0x03, 0x04, 0x05, 0x04, 0x04, 0x0C, 0x06, 0x07, 0x63, 0x3C, 0x03, 0x09, 0x06, 0x09,
+	0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x24, 0x09,
+	0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+	0x03, 0x5A, 0x0C, 0x3C, 0x12, 0x25, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05,
+	0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05,
+	0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x04, 0x03, 0x0B, 0x02, 0x05, 0x32, 0x34, 0x03, 0x07, 0x06,
+	0x06, 0x07, 0x06, 0x03, 0x01, 0x03, 0x05, 0x03, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x04, 0x03, 0x02, 0x03, 0x05, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03, 0x06, 0x06, 0x07, 0x03,
+	0x01, 0x03, 0x06, 0x03, 0x01, 0x04, 0x05, 0x03, 0x02, 0x03, 0x05, 0x03, 0x03, 0x03, 0x04, 0x03,
+	0x04, 0x03, 0x03, 0x03, 0x04, 0x04, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x06, 0x03, 0x01, 0x03,
+	0x07, 0x06, 0x07, 0x03, 0x4E, 0x28, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07,
+	0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07,
+	0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x14, 0x3C, 0x58, 0x05, 0x0C, 0x0A,
+	0x0C, 0x0B, 0x0A, 0x09, 0x01, 0x02, 0x0A, 0x02, 0x01, 0x06, 0x01, 0x03, 0x09, 0x02, 0x01, 0x06,
+	0x01, 0x03, 0x08, 0x03, 0x01, 0x06, 0x02, 0x02, 0x08, 0x02, 0x02, 0x06, 0x02, 0x03, 0x06, 0x03,
+	0x02, 0x06, 0x02, 0x03, 0x06, 0x03, 0x02, 0x06, 0x03, 0x02, 0x06, 0x02, 0x03, 0x06, 0x03, 0x03,
+	0x04, 0x03, 0x03, 0x06, 0x04, 0x02, 0x04, 0x02, 0x04, 0x06, 0x04, 0x03, 0x02, 0x03, 0x04, 0x06,
+	0x04, 0x03, 0x02, 0x03, 0x04, 0x06, 0x05, 0x02, 0x02, 0x02, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x05, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x07, 0x02, 0x07, 0x03,
+	0x84, 0x3C, 0x04, 0x08, 0x08, 0x07, 0x09, 0x06, 0x09, 0x06, 0x06, 0x01, 0x02, 0x06, 0x06, 0x01,
+	0x03, 0x05, 0x06, 0x02, 0x02, 0x05, 0x06, 0x02, 0x03, 0x04, 0x06, 0x03, 0x02, 0x04, 0x06, 0x03,
+	0x03, 0x03, 0x06, 0x04, 0x02, 0x03, 0x06, 0x04, 0x03, 0x02, 0x06, 0x05, 0x02, 0x02, 0x06, 0x05,
+	0x03, 0x01, 0x06, 0x05, 0x03, 0x01, 0x06, 0x06, 0x09, 0x06, 0x09, 0x07, 0x08, 0x07, 0x08, 0x08,
+	0x04, 0x5A, 0x4E, 0x07, 0x09, 0x0B, 0x06, 0x03, 0x06, 0x04, 0x04, 0x03, 0x08, 0x04, 0x02, 0x03,
+	0x0A, 0x03, 0x02, 0x03, 0x0A, 0x03, 0x01, 0x03, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06,
+	0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x03, 0x01, 0x03, 0x0A, 0x03, 0x02, 0x03, 0x0A, 0x03,
+	0x02, 0x04, 0x08, 0x03, 0x04, 0x04, 0x06, 0x03, 0x06, 0x0B, 0x09, 0x07, 0x72, 0x30, 0x09, 0x03,
+	0x0A, 0x02, 0x03, 0x04, 0x04, 0x01, 0x03, 0x05, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x05, 0x03, 0x01, 0x03, 0x04, 0x04, 0x01, 0x0A, 0x02, 0x08, 0x04, 0x03, 0x09, 0x03, 0x09,
+	0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x51, 0x56, 0x07, 0x0B, 0x0B,
+	0x08, 0x03, 0x06, 0x04, 0x06, 0x03, 0x08, 0x03, 0x05, 0x03, 0x0A, 0x03, 0x04, 0x03, 0x0A, 0x03,
+	0x03, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x0C, 0x03,
+	0x02, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x0C, 0x03, 0x02, 0x03, 0x0C, 0x03,
+	0x03, 0x03, 0x0A, 0x03, 0x04, 0x03, 0x0A, 0x03, 0x04, 0x04, 0x08, 0x03, 0x06, 0x04, 0x06, 0x03,
+	0x08, 0x0E, 0x08, 0x07, 0x02, 0x04, 0x11, 0x05, 0x10, 0x04, 0x12, 0x02, 0x3C, 0x34, 0x09, 0x04,
+	0x0A, 0x03, 0x03, 0x05, 0x03, 0x02, 0x03, 0x06, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03, 0x06,
+	0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03, 0x05, 0x04, 0x01, 0x03, 0x04, 0x04, 0x02, 0x0A, 0x03,
+	0x09, 0x04, 0x03, 0x04, 0x03, 0x03, 0x03, 0x05, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x06,
+	0x02, 0x02, 0x03, 0x06, 0x03, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03, 0x07, 0x06, 0x07, 0x06, 0x08,
+	0x02, 0x4E, 0x33, 0x07, 0x04, 0x09, 0x02, 0x03, 0x05, 0x02, 0x01, 0x03, 0x09, 0x03, 0x09, 0x03,
+	0x09, 0x04, 0x09, 0x04, 0x08, 0x06, 0x08, 0x06, 0x07, 0x06, 0x09, 0x04, 0x09, 0x04, 0x09, 0x03,
+	0x09, 0x03, 0x09, 0x04, 0x07, 0x07, 0x04, 0x04, 0x02, 0x09, 0x05, 0x05, 0x4C, 0x3C, 0x1E, 0x06,
+	0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,
+	0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,
+	0x03, 0x0C, 0x03, 0x60, 0x3C, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06,
+	0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06,
+	0x09, 0x06, 0x09, 0x07, 0x08, 0x03, 0x01, 0x03, 0x07, 0x03, 0x02, 0x04, 0x05, 0x03, 0x04, 0x0A,
+	0x07, 0x07, 0x5E, 0x44, 0x03, 0x0C, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x03, 0x0A, 0x03, 0x01,
+	0x03, 0x0A, 0x02, 0x03, 0x03, 0x08, 0x03, 0x03, 0x03, 0x08, 0x03, 0x03, 0x03, 0x08, 0x02, 0x05,
+	0x03, 0x06, 0x03, 0x05, 0x03, 0x06, 0x03, 0x06, 0x02, 0x06, 0x02, 0x07, 0x03, 0x04, 0x03, 0x07,
+	0x03, 0x04, 0x02, 0x09, 0x02, 0x04, 0x02, 0x09, 0x03, 0x02, 0x03, 0x09, 0x03, 0x02, 0x02, 0x0B,
+	0x02, 0x02, 0x02, 0x0B, 0x06, 0x0B, 0x05, 0x0D, 0x04, 0x0D, 0x04, 0x6C, 0x68, 0x03, 0x09, 0x03,
+	0x09, 0x05, 0x08, 0x04, 0x09, 0x05, 0x08, 0x04, 0x08, 0x03, 0x01, 0x03, 0x07, 0x04, 0x08, 0x03,
+	0x01, 0x03, 0x07, 0x05, 0x07, 0x02, 0x02, 0x03, 0x06, 0x06, 0x06, 0x03, 0x03, 0x02, 0x06, 0x02,
+	0x02, 0x02, 0x06, 0x03, 0x03, 0x03, 0x05, 0x02, 0x02, 0x03, 0x05, 0x03, 0x03, 0x03, 0x05, 0x02,
+	0x02, 0x03, 0x05, 0x02, 0x05, 0x02, 0x04, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x03, 0x03, 0x02,
+	0x04, 0x02, 0x04, 0x03, 0x05, 0x03, 0x03, 0x02, 0x04, 0x03, 0x03, 0x02, 0x06, 0x03, 0x03, 0x02,
+	0x04, 0x03, 0x03, 0x02, 0x07, 0x02, 0x02, 0x03, 0x05, 0x02, 0x02, 0x03, 0x07, 0x03, 0x01, 0x02,
+	0x06, 0x03, 0x01, 0x02, 0x08, 0x03, 0x01, 0x02, 0x06, 0x03, 0x01, 0x02, 0x09, 0x02, 0x01, 0x02,
+	0x07, 0x02, 0x01, 0x02, 0x09, 0x05, 0x07, 0x05, 0x09, 0x04, 0x08, 0x04, 0x0A, 0x04, 0x08, 0x04,
+	0xA1, 0x3C, 0x03, 0x09, 0x03, 0x01, 0x03, 0x07, 0x03, 0x02, 0x03, 0x07, 0x02, 0x04, 0x03, 0x05,
+	0x03, 0x04, 0x03, 0x04, 0x03, 0x06, 0x03, 0x03, 0x03, 0x07, 0x03, 0x01, 0x03, 0x08, 0x03, 0x01,
+	0x02, 0x0A, 0x05, 0x0A, 0x04, 0x0B, 0x05, 0x0A, 0x05, 0x09, 0x03, 0x01, 0x03, 0x07, 0x03, 0x02,
+	0x03, 0x07, 0x03, 0x03, 0x03, 0x05, 0x03, 0x04, 0x04, 0x04, 0x02, 0x06, 0x03, 0x03, 0x03, 0x07,
+	0x03, 0x01, 0x03, 0x08, 0x03, 0x01, 0x03, 0x09, 0x03, 0x5A, 0x3C, 0x03, 0x09, 0x03, 0x01, 0x03,
+	0x08, 0x02, 0x02, 0x03, 0x07, 0x03, 0x03, 0x02, 0x07, 0x02, 0x04, 0x03, 0x05, 0x03, 0x05, 0x02,
+	0x05, 0x02, 0x06, 0x03, 0x03, 0x03, 0x07, 0x02, 0x03, 0x02, 0x08, 0x03, 0x01, 0x03, 0x09, 0x02,
+	0x01, 0x02, 0x0A, 0x05, 0x0B, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03,
+	0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x60, 0x34, 0x1A, 0x0A, 0x03, 0x09, 0x03, 0x09, 0x03, 0x0A,
+	0x03, 0x09, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x09, 0x03, 0x0A,
+	0x03, 0x09, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x1A, 0x4E, 0x0A, 0x0C, 0x03, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x0A, 0x05, 0x0C, 0x03, 0x0A,
+	0x02, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x02, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x02, 0x0A, 0x03, 0x09,
+	0x03, 0x0A, 0x02, 0x0A, 0x03, 0x0A, 0x02, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x02, 0x0A, 0x03, 0x09,
+	0x03, 0x0A, 0x02, 0x0A, 0x03, 0x0A, 0x02, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x02, 0x0A, 0x03, 0x09,
+	0x03, 0x0A, 0x02, 0x18, 0x0C, 0x0C, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x0F, 0x06, 0x34, 0x03, 0x09, 0x04, 0x07, 0x05, 0x07, 0x02, 0x01, 0x03, 0x06,
+	0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x03, 0x04, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x02,
+	0x02, 0x05, 0x03, 0x01, 0x03, 0x06, 0x02, 0x01, 0x03, 0x06, 0x05, 0x07, 0x03, 0xA8, 0xFF, 0xC1,
+	0x20, 0x0A, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x04, 0x02, 0x73, 0x6F, 0x06, 0x04, 0x0A,
+	0x02, 0x02, 0x05, 0x04, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x03, 0x09, 0x01, 0x0B, 0x01, 0x03,
+	0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x08, 0x03, 0x05, 0x01, 0x0B, 0x02, 0x05, 0x02, 0x03,
+	0x48, 0x1A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A,
+	0x03, 0x02, 0x05, 0x03, 0x03, 0x01, 0x07, 0x02, 0x05, 0x03, 0x04, 0x01, 0x04, 0x05, 0x03, 0x01,
+	0x03, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x07, 0x05,
+	0x03, 0x01, 0x05, 0x03, 0x04, 0x01, 0x03, 0x01, 0x07, 0x02, 0x03, 0x02, 0x05, 0x51, 0x67, 0x05,
+	0x04, 0x08, 0x02, 0x04, 0x04, 0x02, 0x01, 0x03, 0x06, 0x04, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03,
+	0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x09, 0x03, 0x06, 0x01, 0x01, 0x04, 0x04, 0x02, 0x02, 0x09,
+	0x04, 0x05, 0x44, 0x24, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A,
+	0x03, 0x03, 0x05, 0x02, 0x03, 0x02, 0x07, 0x01, 0x03, 0x01, 0x04, 0x03, 0x05, 0x01, 0x03, 0x05,
+	0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x03, 0x01,
+	0x03, 0x05, 0x04, 0x01, 0x04, 0x03, 0x05, 0x02, 0x07, 0x01, 0x03, 0x03, 0x05, 0x02, 0x03, 0x4E,
+	0x79, 0x06, 0x05, 0x09, 0x03, 0x04, 0x04, 0x03, 0x02, 0x03, 0x05, 0x07, 0x07, 0x06, 0x07, 0x20,
+	0x0A, 0x03, 0x0A, 0x03, 0x0B, 0x03, 0x0A, 0x04, 0x05, 0x02, 0x03, 0x0A, 0x05, 0x06, 0x51, 0x16,
+	0x05, 0x03, 0x06, 0x02, 0x04, 0x05, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x04, 0x12, 0x02,
+	0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06,
+	0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x3A, 0x79, 0x09, 0x02, 0x0B, 0x02, 0x02,
+	0x04, 0x02, 0x04, 0x02, 0x06, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x02,
+	0x06, 0x02, 0x04, 0x02, 0x04, 0x02, 0x05, 0x08, 0x04, 0x02, 0x01, 0x04, 0x06, 0x02, 0x0B, 0x02,
+	0x0B, 0x09, 0x05, 0x0A, 0x02, 0x03, 0x05, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x07, 0x05, 0x03,
+	0x02, 0x0A, 0x05, 0x07, 0x03, 0x1A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A,
+	0x03, 0x0A, 0x03, 0x0A, 0x03, 0x02, 0x05, 0x03, 0x03, 0x01, 0x08, 0x01, 0x05, 0x04, 0x03, 0x01,
+	0x04, 0x06, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+	0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x03, 0x4E, 0x09, 0x09, 0x09, 0x2D, 0x12, 0x15,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x15, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x09, 0x01, 0x04, 0x02, 0x18, 0x03,
+	0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x05, 0x03,
+	0x01, 0x03, 0x04, 0x03, 0x02, 0x03, 0x03, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x03, 0x02, 0x03,
+	0x04, 0x03, 0x01, 0x03, 0x05, 0x06, 0x06, 0x03, 0x01, 0x03, 0x05, 0x03, 0x01, 0x04, 0x04, 0x03,
+	0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x02, 0x03, 0x04, 0x04, 0x01, 0x03,
+	0x05, 0x03, 0x01, 0x03, 0x06, 0x03, 0x48, 0x06, 0x42, 0x12, 0xBD, 0x03, 0x02, 0x05, 0x04, 0x05,
+	0x02, 0x03, 0x01, 0x07, 0x02, 0x07, 0x01, 0x05, 0x03, 0x06, 0x03, 0x03, 0x01, 0x04, 0x05, 0x04,
+	0x05, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x03,
+	0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x03,
+	0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x03, 0x06, 0x03, 0x7E, 0x75,
+	0x03, 0x02, 0x05, 0x03, 0x03, 0x01, 0x08, 0x01, 0x05, 0x04, 0x03, 0x01, 0x04, 0x06, 0x06, 0x07,
+	0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+	0x06, 0x07, 0x06, 0x07, 0x03, 0x4E, 0x82, 0x06, 0x06, 0x0A, 0x03, 0x04, 0x04, 0x04, 0x02, 0x03,
+	0x06, 0x03, 0x01, 0x03, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x06,
+	0x08, 0x03, 0x01, 0x03, 0x06, 0x03, 0x02, 0x04, 0x04, 0x03, 0x04, 0x0A, 0x06, 0x06, 0x58, 0x75,
+	0x03, 0x02, 0x05, 0x03, 0x03, 0x01, 0x07, 0x02, 0x05, 0x03, 0x04, 0x01, 0x04, 0x05, 0x03, 0x01,
+	0x03, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x07, 0x05,
+	0x03, 0x01, 0x05, 0x03, 0x04, 0x01, 0x03, 0x01, 0x07, 0x02, 0x03, 0x02, 0x05, 0x03, 0x03, 0x0A,
+	0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x78, 0x05, 0x02, 0x03, 0x02, 0x07,
+	0x01, 0x03, 0x01, 0x04, 0x03, 0x05, 0x01, 0x03, 0x05, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06,
+	0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x03, 0x01, 0x03, 0x05, 0x04, 0x01, 0x04, 0x03, 0x05,
+	0x02, 0x07, 0x01, 0x03, 0x03, 0x05, 0x02, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03,
+	0x0A, 0x03, 0x0A, 0x03, 0x48, 0x03, 0x02, 0x10, 0x03, 0x04, 0x04, 0x03, 0x05, 0x03, 0x05, 0x03,
+	0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+	0x35, 0x5C, 0x06, 0x03, 0x08, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03, 0x07, 0x03, 0x07, 0x04, 0x07,
+	0x05, 0x06, 0x06, 0x07, 0x04, 0x07, 0x04, 0x07, 0x03, 0x07, 0x05, 0x04, 0x0D, 0x02, 0x06, 0x3F,
+	0x2F, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x04, 0x12, 0x02, 0x03, 0x06, 0x03, 0x06, 0x03,
+	0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x04,
+	0x06, 0x06, 0x04, 0x05, 0x36, 0x6C, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x01,
+	0x03, 0x03, 0x05, 0x01, 0x07, 0x01, 0x03, 0x02, 0x05, 0x02, 0x03, 0x48, 0x7E, 0x03, 0x08, 0x06,
+	0x08, 0x02, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03, 0x03, 0x02, 0x06, 0x02, 0x04, 0x03,
+	0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x05, 0x02, 0x04, 0x02, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03,
+	0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x08, 0x06, 0x08, 0x05, 0x0A, 0x04, 0x0A, 0x04, 0x59, 0xBD,
+	0x02, 0x07, 0x02, 0x07, 0x06, 0x05, 0x04, 0x06, 0x02, 0x01, 0x03, 0x05, 0x04, 0x06, 0x02, 0x01,
+	0x03, 0x05, 0x04, 0x05, 0x03, 0x02, 0x02, 0x05, 0x05, 0x04, 0x03, 0x02, 0x03, 0x03, 0x06, 0x04,
+	0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03,
+	0x03, 0x04, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x05, 0x03, 0x01, 0x03, 0x03, 0x02, 0x01,
+	0x03, 0x06, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x03, 0x06, 0x02, 0x01, 0x02, 0x04, 0x05, 0x07,
+	0x05, 0x04, 0x05, 0x07, 0x04, 0x06, 0x04, 0x08, 0x03, 0x06, 0x03, 0x83, 0x6C, 0x03, 0x06, 0x03,
+	0x01, 0x03, 0x05, 0x03, 0x01, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x05, 0x03, 0x01, 0x03,
+	0x05, 0x06, 0x07, 0x04, 0x08, 0x04, 0x08, 0x05, 0x06, 0x06, 0x05, 0x03, 0x02, 0x03, 0x04, 0x02,
+	0x04, 0x03, 0x02, 0x03, 0x04, 0x03, 0x01, 0x03, 0x06, 0x06, 0x06, 0x03, 0x48, 0x75, 0x02, 0x08,
+	0x06, 0x07, 0x06, 0x07, 0x02, 0x02, 0x02, 0x06, 0x03, 0x02, 0x03, 0x05, 0x03, 0x02, 0x03, 0x05,
+	0x02, 0x04, 0x02, 0x04, 0x03, 0x04, 0x03, 0x03, 0x02, 0x05, 0x03, 0x03, 0x02, 0x06, 0x02, 0x02,
+	0x03, 0x06, 0x03, 0x01, 0x02, 0x08, 0x02, 0x01, 0x02, 0x08, 0x05, 0x08, 0x04, 0x0A, 0x03, 0x0A,
+	0x03, 0x0A, 0x02, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x07, 0x5A, 0x14, 0x06, 0x03,
+	0x07, 0x03, 0x06, 0x03, 0x07, 0x02, 0x07, 0x03, 0x06, 0x03, 0x07, 0x03, 0x06, 0x03, 0x07, 0x02,
+	0x07, 0x03, 0x06, 0x03, 0x07, 0x14, 0x3C, 0x15, 0x03, 0x04, 0x04, 0x03, 0x03, 0x05, 0x03, 0x05,
+	0x03, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x05, 0x03, 0x03,
+	0x04, 0x04, 0x04, 0x06, 0x03, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06,
+	0x02, 0x06, 0x02, 0x06, 0x03, 0x05, 0x03, 0x05, 0x03, 0x06, 0x04, 0x05, 0x03, 0x08, 0x06, 0x54,
+	0x10, 0x03, 0x05, 0x04, 0x06, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+	0x05, 0x03, 0x05, 0x03, 0x06, 0x02, 0x06, 0x03, 0x06, 0x04, 0x04, 0x04, 0x03, 0x03, 0x05, 0x02,
+	0x06, 0x02, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+	0x05, 0x03, 0x03, 0x04, 0x04, 0x03, 0x0D, 0x56, 0x04, 0x06, 0x02, 0x01, 0x06, 0x05, 0x05, 0x02,
+	0x03, 0x04, 0x04, 0x04, 0x03, 0x02, 0x05, 0x05, 0x06, 0x09, 0x04, 0xFE,
+};
+
+/**
+ * @brief 30 pixels height compressed char info array.
+ */
+char_info_t font30_rle_info[] = {
+	{2, 0}, 		/*   */
+	{3, 1}, 		/* ! */
+	{8, 22}, 		/* " */
+	{14, 43}, 		/* # */
+	{13, 114}, 		/* $ */
+	{21, 173}, 		/* % */
+	{18, 282}, 		/* & */
+	{3, 373}, 		/* ' */
+	{6, 378}, 		/* ( */
+	{6, 434}, 		/* ) */
+	{10, 491}, 		/* * */
+	{14, 524}, 		/* + */
+	{5, 551}, 		/* , */
+	{8, 568}, 		/* - */
+	{3, 571}, 		/* . */
+	{12, 574}, 		/* / */
+	{14, 629}, 		/* 0 */
+	{12, 684}, 		/* 1 */
+	{13, 727}, 		/* 2 */
+	{13, 770}, 		/* 3 */
+	{15, 815}, 		/* 4 */
+	{13, 874}, 		/* 5 */
+	{13, 917}, 		/* 6 */
+	{13, 970}, 		/* 7 */
+	{14, 1009}, 		/* 8 */
+	{13, 1070}, 		/* 9 */
+	{3, 1125}, 		/* : */
+	{5, 1130}, 		/* ; */
+	{13, 1155}, 		/* < */
+	{13, 1186}, 		/* = */
+	{13, 1191}, 		/* > */
+	{11, 1222}, 		/* ? */
+	{23, 1265}, 		/* @ */
+	{17, 1384}, 		/* A */
+	{13, 1451}, 		/* B */
+	{14, 1510}, 		/* C */
+	{16, 1559}, 		/* D */
+	{11, 1616}, 		/* E */
+	{11, 1651}, 		/* F */
+	{16, 1684}, 		/* G */
+	{15, 1739}, 		/* H */
+	{3, 1778}, 		/* I */
+	{8, 1781}, 		/* J */
+	{13, 1820}, 		/* K */
+	{10, 1893}, 		/* L */
+	{22, 1932}, 		/* M */
+	{15, 2033}, 		/* N */
+	{18, 2098}, 		/* O */
+	{12, 2157}, 		/* P */
+	{20, 2204}, 		/* Q */
+	{13, 2285}, 		/* R */
+	{12, 2354}, 		/* S */
+	{15, 2397}, 		/* T */
+	{15, 2436}, 		/* U */
+	{17, 2483}, 		/* V */
+	{26, 2556}, 		/* W */
+	{15, 2689}, 		/* X */
+	{15, 2762}, 		/* Y */
+	{13, 2823}, 		/* Z */
+	{5, 2860}, 		/* [ */
+	{12, 2909}, 		/* \ */
+	{6, 2964}, 		/* ] */
+	{12, 3013}, 		/* ^ */
+	{16, 3054}, 		/* _ */
+	{5, 3057}, 		/* ` */
+	{12, 3068}, 		/* a */
+	{13, 3105}, 		/* b */
+	{11, 3166}, 		/* c */
+	{13, 3203}, 		/* d */
+	{13, 3264}, 		/* e */
+	{9, 3295}, 		/* f */
+	{13, 3338}, 		/* g */
+	{13, 3397}, 		/* h */
+	{3, 3450}, 		/* i */
+	{6, 3455}, 		/* j */
+	{12, 3502}, 		/* k */
+	{3, 3575}, 		/* l */
+	{21, 3578}, 		/* m */
+	{13, 3647}, 		/* n */
+	{14, 3686}, 		/* o */
+	{13, 3727}, 		/* p */
+	{13, 3786}, 		/* q */
+	{8, 3844}, 		/* r */
+	{10, 3873}, 		/* s */
+	{9, 3904}, 		/* t */
+	{12, 3941}, 		/* u */
+	{14, 3980}, 		/* v */
+	{21, 4031}, 		/* w */
+	{12, 4124}, 		/* x */
+	{13, 4173}, 		/* y */
+	{10, 4236}, 		/* z */
+	{8, 4263}, 		/* { */
+	{3, 4318}, 		/* | */
+	{8, 4320}, 		/* } */
+	{14, 4375}, 		/* ~ */
+};
+
+Font_t font_30_rle = {
+	30,
+	font30_rle_info,
+	font30_rle_data,
+	1
+};
+
+/**
+ * @brief 59 pixels height compressed data array.
+ */
+const uint8_t font59_rle_data[] = {
+	0x76, 0x1D, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02,
+	0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02,
+	0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02,
+	0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02,
+	0x05, 0x02, 0x05, 0x1E, 0x05, 0x02, 0x1B, 0x01, 0x06, 0x01, 0x05, 0x4E, 0x34, 0x05, 0x06, 0x0B,
+	0x05, 0x0C, 0x06, 0x0B, 0x06, 0x05, 0x01, 0x05, 0x06, 0x05, 0x01, 0x04, 0x07, 0x05, 0x01, 0x04,
+	0x07, 0x05, 0x01, 0x04, 0x07, 0x04, 0x02, 0x04, 0x07, 0x04, 0x02, 0x04, 0x07, 0x04, 0x02, 0x04,
+	0x07, 0x04, 0x02, 0x04, 0x07, 0x04, 0x02, 0x04, 0x07, 0x04, 0x02, 0x04, 0x07, 0x04, 0x02, 0x04,
+	0x07, 0x04, 0x02, 0x04, 0x07, 0x04, 0xFF, 0xFF, 0xAB, 0xDB, 0x04, 0x09, 0x04, 0x0C, 0x05, 0x09,
+	0x04, 0x0C, 0x05, 0x08, 0x05, 0x0C, 0x05, 0x08, 0x05, 0x0C, 0x05, 0x08, 0x05, 0x0C, 0x04, 0x09,
+	0x05, 0x0C, 0x04, 0x09, 0x05, 0x0C, 0x04, 0x09, 0x04, 0x0C, 0x05, 0x09, 0x04, 0x0C, 0x05, 0x09,
+	0x04, 0x0C, 0x05, 0x08, 0x05, 0x07, 0x1B, 0x03, 0x1C, 0x02, 0x1C, 0x02, 0x1B, 0x08, 0x04, 0x09,
+	0x05, 0x0B, 0x05, 0x09, 0x04, 0x0C, 0x05, 0x09, 0x04, 0x0C, 0x05, 0x09, 0x04, 0x0C, 0x05, 0x08,
+	0x05, 0x0C, 0x05, 0x08, 0x05, 0x0C, 0x04, 0x09, 0x05, 0x0C, 0x04, 0x09, 0x05, 0x0C, 0x04, 0x09,
+	0x05, 0x0B, 0x05, 0x09, 0x04, 0x07, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x07, 0x04, 0x09,
+	0x05, 0x0C, 0x04, 0x09, 0x05, 0x0B, 0x05, 0x09, 0x04, 0x0C, 0x05, 0x09, 0x04, 0x0C, 0x05, 0x09,
+	0x04, 0x0C, 0x05, 0x08, 0x05, 0x0C, 0x05, 0x08, 0x05, 0x0C, 0x05, 0x08, 0x05, 0x0C, 0x04, 0x09,
+	0x05, 0x0C, 0x04, 0x09, 0x05, 0x0C, 0x04, 0x09, 0x04, 0xFF, 0x72, 0x0D, 0x04, 0x16, 0x04, 0x16,
+	0x04, 0x16, 0x04, 0x15, 0x05, 0x15, 0x05, 0x15, 0x04, 0x13, 0x0A, 0x0D, 0x10, 0x08, 0x13, 0x06,
+	0x14, 0x05, 0x08, 0x07, 0x07, 0x04, 0x06, 0x0C, 0x04, 0x03, 0x06, 0x0F, 0x01, 0x04, 0x05, 0x15,
+	0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x06, 0x14, 0x06, 0x14, 0x07, 0x14, 0x08, 0x13,
+	0x09, 0x12, 0x0B, 0x10, 0x0D, 0x0E, 0x0E, 0x0F, 0x0D, 0x0F, 0x0C, 0x11, 0x0A, 0x12, 0x09, 0x13,
+	0x07, 0x14, 0x06, 0x15, 0x06, 0x14, 0x06, 0x14, 0x06, 0x14, 0x06, 0x14, 0x06, 0x14, 0x05, 0x14,
+	0x06, 0x01, 0x02, 0x11, 0x06, 0x01, 0x04, 0x0D, 0x07, 0x02, 0x07, 0x08, 0x08, 0x03, 0x16, 0x04,
+	0x15, 0x07, 0x11, 0x0D, 0x0A, 0x12, 0x04, 0x16, 0x04, 0x16, 0x04, 0x16, 0x04, 0x16, 0x04, 0x16,
+	0x04, 0x15, 0x05, 0x15, 0x04, 0x77, 0xE8, 0x04, 0x23, 0x05, 0x09, 0x07, 0x12, 0x05, 0x08, 0x0B,
+	0x10, 0x04, 0x08, 0x0D, 0x0E, 0x05, 0x08, 0x0E, 0x0C, 0x05, 0x08, 0x05, 0x05, 0x05, 0x0B, 0x05,
+	0x09, 0x04, 0x07, 0x04, 0x0B, 0x05, 0x08, 0x05, 0x07, 0x05, 0x09, 0x05, 0x09, 0x05, 0x07, 0x05,
+	0x08, 0x05, 0x0A, 0x04, 0x09, 0x04, 0x08, 0x05, 0x0A, 0x04, 0x09, 0x04, 0x07, 0x05, 0x0B, 0x04,
+	0x09, 0x04, 0x06, 0x05, 0x0C, 0x04, 0x09, 0x04, 0x06, 0x04, 0x0D, 0x05, 0x07, 0x05, 0x05, 0x05,
+	0x0D, 0x05, 0x07, 0x05, 0x04, 0x05, 0x0F, 0x04, 0x07, 0x04, 0x05, 0x04, 0x10, 0x05, 0x05, 0x05,
+	0x04, 0x05, 0x10, 0x0E, 0x04, 0x05, 0x12, 0x0D, 0x03, 0x05, 0x14, 0x0B, 0x04, 0x05, 0x16, 0x07,
+	0x05, 0x05, 0x22, 0x05, 0x07, 0x07, 0x15, 0x04, 0x06, 0x0B, 0x12, 0x05, 0x05, 0x0D, 0x10, 0x05,
+	0x06, 0x0E, 0x0F, 0x04, 0x06, 0x05, 0x05, 0x05, 0x0E, 0x05, 0x06, 0x04, 0x07, 0x04, 0x0D, 0x05,
+	0x06, 0x05, 0x07, 0x05, 0x0C, 0x04, 0x07, 0x05, 0x07, 0x05, 0x0B, 0x05, 0x07, 0x04, 0x09, 0x04,
+	0x0A, 0x05, 0x08, 0x04, 0x09, 0x04, 0x09, 0x05, 0x09, 0x04, 0x09, 0x04, 0x09, 0x05, 0x09, 0x04,
+	0x09, 0x04, 0x08, 0x05, 0x0A, 0x05, 0x07, 0x05, 0x07, 0x05, 0x0B, 0x05, 0x07, 0x05, 0x07, 0x04,
+	0x0D, 0x04, 0x07, 0x04, 0x07, 0x05, 0x0D, 0x05, 0x05, 0x05, 0x06, 0x05, 0x0E, 0x0E, 0x07, 0x04,
+	0x10, 0x0D, 0x06, 0x05, 0x11, 0x0B, 0x06, 0x05, 0x14, 0x07, 0x08, 0x04, 0xFF, 0xDA, 0xA4, 0x09,
+	0x1A, 0x0E, 0x17, 0x10, 0x14, 0x13, 0x13, 0x07, 0x06, 0x07, 0x11, 0x06, 0x09, 0x06, 0x11, 0x05,
+	0x0B, 0x06, 0x0F, 0x06, 0x0B, 0x06, 0x0F, 0x06, 0x0B, 0x06, 0x0F, 0x06, 0x0B, 0x06, 0x0F, 0x06,
+	0x0B, 0x06, 0x0F, 0x06, 0x0B, 0x06, 0x0F, 0x06, 0x0A, 0x06, 0x11, 0x06, 0x08, 0x07, 0x11, 0x06,
+	0x07, 0x07, 0x13, 0x06, 0x05, 0x07, 0x14, 0x07, 0x03, 0x07, 0x16, 0x06, 0x01, 0x08, 0x18, 0x0C,
+	0x1A, 0x0B, 0x1C, 0x08, 0x0D, 0x04, 0x0B, 0x09, 0x0D, 0x05, 0x0A, 0x0B, 0x0C, 0x05, 0x09, 0x0D,
+	0x0B, 0x05, 0x08, 0x06, 0x02, 0x07, 0x0A, 0x05, 0x07, 0x06, 0x04, 0x07, 0x09, 0x05, 0x06, 0x06,
+	0x06, 0x07, 0x08, 0x05, 0x05, 0x06, 0x08, 0x07, 0x07, 0x05, 0x05, 0x06, 0x09, 0x07, 0x05, 0x05,
+	0x06, 0x05, 0x0B, 0x07, 0x04, 0x05, 0x06, 0x05, 0x0C, 0x07, 0x03, 0x05, 0x05, 0x06, 0x0D, 0x07,
+	0x01, 0x05, 0x06, 0x06, 0x0E, 0x0C, 0x06, 0x06, 0x0F, 0x0A, 0x08, 0x05, 0x10, 0x09, 0x08, 0x06,
+	0x10, 0x07, 0x09, 0x06, 0x10, 0x09, 0x07, 0x07, 0x0E, 0x0B, 0x07, 0x07, 0x0B, 0x0E, 0x07, 0x08,
+	0x07, 0x08, 0x02, 0x07, 0x07, 0x15, 0x04, 0x09, 0x05, 0x12, 0x07, 0x08, 0x07, 0x0E, 0x0B, 0x06,
+	0x09, 0x09, 0x0F, 0x05, 0xFF, 0xA3, 0x13, 0x17, 0x01, 0x05, 0x01, 0x05, 0x01, 0x04, 0x02, 0x04,
+	0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04,
+	0xF1, 0x28, 0x04, 0x06, 0x05, 0x06, 0x05, 0x06, 0x04, 0x06, 0x05, 0x06, 0x04, 0x06, 0x05, 0x06,
+	0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05,
+	0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+	0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x05,
+	0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06,
+	0x05, 0x06, 0x05, 0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x07, 0x05, 0x06, 0x05, 0x07, 0x04, 0x0B,
+	0x21, 0x04, 0x07, 0x05, 0x06, 0x05, 0x07, 0x05, 0x06, 0x05, 0x07, 0x04, 0x07, 0x05, 0x06, 0x05,
+	0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06,
+	0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06,
+	0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05,
+	0x06, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06, 0x04, 0x12, 0x4B,
+	0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x0B, 0x01, 0x06, 0x04, 0x06, 0x01, 0x03, 0x03, 0x05,
+	0x04, 0x04, 0x04, 0x01, 0x06, 0x03, 0x04, 0x03, 0x05, 0x01, 0x07, 0x02, 0x03, 0x02, 0x08, 0x01,
+	0x0B, 0x01, 0x08, 0x04, 0x0F, 0x0A, 0x0A, 0x0E, 0x06, 0x0E, 0x0A, 0x09, 0x0F, 0x05, 0x0B, 0x01,
+	0x08, 0x01, 0x07, 0x02, 0x03, 0x02, 0x0E, 0x03, 0x04, 0x03, 0x05, 0x02, 0x03, 0x05, 0x04, 0x04,
+	0x04, 0x03, 0x01, 0x06, 0x04, 0x06, 0x01, 0x0B, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0xFF,
+	0xFF, 0xE1, 0xFF, 0xB1, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18,
+	0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x0D, 0x1A, 0x01, 0x38, 0x01,
+	0x1A, 0x0D, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18,
+	0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xFF, 0xCD, 0xFF, 0xBE, 0x05, 0x06, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05,
+	0x06, 0x05, 0x05, 0x05, 0x06, 0x04, 0x06, 0x05, 0x06, 0x04, 0x06, 0x04, 0x28, 0xFF, 0xB4, 0x3C,
+	0xFF, 0x87, 0xFF, 0x1A, 0x05, 0x01, 0x06, 0x01, 0x1B, 0x02, 0x05, 0x55, 0x2C, 0x04, 0x13, 0x05,
+	0x13, 0x05, 0x12, 0x05, 0x13, 0x05, 0x13, 0x05, 0x12, 0x05, 0x13, 0x05, 0x12, 0x06, 0x12, 0x05,
+	0x13, 0x05, 0x12, 0x06, 0x12, 0x05, 0x13, 0x05, 0x12, 0x05, 0x13, 0x05, 0x13, 0x05, 0x12, 0x05,
+	0x13, 0x05, 0x13, 0x05, 0x12, 0x05, 0x13, 0x05, 0x12, 0x06, 0x12, 0x05, 0x13, 0x05, 0x12, 0x05,
+	0x13, 0x05, 0x13, 0x05, 0x12, 0x05, 0x13, 0x05, 0x13, 0x05, 0x12, 0x05, 0x13, 0x05, 0x12, 0x06,
+	0x12, 0x05, 0x13, 0x05, 0x12, 0x06, 0x12, 0x05, 0x13, 0x05, 0x12, 0x05, 0x13, 0x05, 0x13, 0x05,
+	0x12, 0x05, 0x13, 0x05, 0x12, 0x06, 0x12, 0x05, 0x13, 0x05, 0x12, 0x06, 0x12, 0x05, 0x13, 0x05,
+	0x12, 0x05, 0x13, 0x05, 0x13, 0x05, 0x12, 0x05, 0x13, 0x05, 0x5B, 0xB2, 0x09, 0x11, 0x0D, 0x0D,
+	0x11, 0x0A, 0x13, 0x08, 0x07, 0x06, 0x07, 0x07, 0x06, 0x0A, 0x06, 0x06, 0x05, 0x0C, 0x06, 0x04,
+	0x05, 0x0E, 0x05, 0x04, 0x05, 0x0E, 0x05, 0x04, 0x04, 0x10, 0x05, 0x02, 0x05, 0x10, 0x05, 0x02,
+	0x05, 0x10, 0x05, 0x02, 0x05, 0x10, 0x05, 0x02, 0x04, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12,
+	0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12,
+	0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x04, 0x02, 0x05, 0x10, 0x05, 0x02, 0x05, 0x10,
+	0x05, 0x02, 0x05, 0x10, 0x05, 0x02, 0x05, 0x10, 0x04, 0x04, 0x05, 0x0E, 0x05, 0x04, 0x05, 0x0E,
+	0x05, 0x04, 0x06, 0x0C, 0x05, 0x06, 0x06, 0x0A, 0x06, 0x07, 0x07, 0x06, 0x07, 0x08, 0x13, 0x0A,
+	0x11, 0x0D, 0x0D, 0x11, 0x09, 0xFF, 0x3F, 0xAB, 0x05, 0x11, 0x06, 0x0F, 0x08, 0x0E, 0x09, 0x0C,
+	0x0B, 0x0B, 0x0C, 0x09, 0x08, 0x01, 0x05, 0x08, 0x08, 0x02, 0x05, 0x08, 0x06, 0x04, 0x05, 0x08,
+	0x04, 0x06, 0x05, 0x08, 0x03, 0x07, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12,
+	0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12,
+	0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12,
+	0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x08, 0x5C, 0xFF, 0x15, 0x9E, 0x08, 0x0E,
+	0x0D, 0x0A, 0x11, 0x07, 0x13, 0x05, 0x14, 0x05, 0x07, 0x06, 0x08, 0x04, 0x04, 0x0B, 0x06, 0x04,
+	0x02, 0x0E, 0x06, 0x13, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14,
+	0x05, 0x13, 0x05, 0x14, 0x05, 0x13, 0x06, 0x13, 0x05, 0x13, 0x06, 0x13, 0x05, 0x13, 0x05, 0x13,
+	0x06, 0x12, 0x06, 0x12, 0x06, 0x12, 0x06, 0x12, 0x07, 0x12, 0x06, 0x12, 0x06, 0x12, 0x06, 0x12,
+	0x06, 0x12, 0x06, 0x12, 0x06, 0x12, 0x06, 0x12, 0x06, 0x12, 0x06, 0x12, 0x7D, 0xFF, 0x2D, 0x9E,
+	0x08, 0x0E, 0x0D, 0x0A, 0x11, 0x07, 0x13, 0x05, 0x07, 0x06, 0x08, 0x04, 0x05, 0x0A, 0x06, 0x04,
+	0x03, 0x0D, 0x05, 0x04, 0x02, 0x0E, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14,
+	0x05, 0x14, 0x05, 0x13, 0x05, 0x14, 0x05, 0x13, 0x05, 0x13, 0x06, 0x10, 0x08, 0x09, 0x0E, 0x0B,
+	0x0C, 0x0D, 0x0F, 0x0A, 0x11, 0x12, 0x08, 0x13, 0x07, 0x14, 0x06, 0x14, 0x05, 0x14, 0x06, 0x14,
+	0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x13, 0x06, 0x13, 0x05, 0x01, 0x02, 0x10,
+	0x06, 0x01, 0x04, 0x0D, 0x06, 0x02, 0x07, 0x08, 0x08, 0x02, 0x16, 0x04, 0x13, 0x08, 0x10, 0x0C,
+	0x0A, 0xFF, 0x1D, 0xDB, 0x07, 0x15, 0x08, 0x14, 0x09, 0x14, 0x09, 0x13, 0x0A, 0x13, 0x04, 0x01,
+	0x05, 0x12, 0x05, 0x01, 0x05, 0x11, 0x05, 0x02, 0x05, 0x11, 0x05, 0x02, 0x05, 0x10, 0x05, 0x03,
+	0x05, 0x10, 0x05, 0x03, 0x05, 0x0F, 0x05, 0x04, 0x05, 0x0E, 0x05, 0x05, 0x05, 0x0E, 0x05, 0x05,
+	0x05, 0x0D, 0x05, 0x06, 0x05, 0x0D, 0x05, 0x06, 0x05, 0x0C, 0x05, 0x07, 0x05, 0x0C, 0x04, 0x08,
+	0x05, 0x0B, 0x05, 0x08, 0x05, 0x0A, 0x05, 0x09, 0x05, 0x0A, 0x05, 0x09, 0x05, 0x09, 0x05, 0x0A,
+	0x05, 0x09, 0x05, 0x0A, 0x05, 0x08, 0x05, 0x0B, 0x05, 0x07, 0x05, 0x0C, 0x05, 0x07, 0x05, 0x0C,
+	0x05, 0x06, 0x05, 0x0D, 0x05, 0x06, 0x1C, 0x01, 0x56, 0x13, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18,
+	0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0xFF, 0x63, 0xB8, 0x15, 0x05,
+	0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15,
+	0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x0F, 0x0B,
+	0x12, 0x08, 0x14, 0x06, 0x15, 0x12, 0x09, 0x14, 0x06, 0x15, 0x06, 0x15, 0x05, 0x15, 0x06, 0x15,
+	0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14,
+	0x06, 0x01, 0x02, 0x11, 0x05, 0x02, 0x04, 0x0D, 0x07, 0x02, 0x07, 0x08, 0x08, 0x03, 0x16, 0x04,
+	0x14, 0x08, 0x10, 0x0E, 0x09, 0xFF, 0x2A, 0xAE, 0x0A, 0x0F, 0x0F, 0x0A, 0x11, 0x08, 0x13, 0x07,
+	0x08, 0x08, 0x04, 0x07, 0x06, 0x14, 0x05, 0x15, 0x05, 0x16, 0x05, 0x15, 0x05, 0x16, 0x05, 0x15,
+	0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x04, 0x17, 0x04, 0x16, 0x05, 0x05, 0x09, 0x08, 0x05, 0x02,
+	0x0F, 0x05, 0x17, 0x04, 0x18, 0x03, 0x0A, 0x08, 0x07, 0x02, 0x07, 0x0C, 0x07, 0x01, 0x06, 0x0E,
+	0x06, 0x01, 0x05, 0x10, 0x05, 0x01, 0x05, 0x10, 0x0B, 0x11, 0x0A, 0x11, 0x0A, 0x11, 0x0A, 0x11,
+	0x0A, 0x11, 0x05, 0x01, 0x05, 0x10, 0x05, 0x01, 0x05, 0x10, 0x05, 0x01, 0x05, 0x0F, 0x05, 0x02,
+	0x06, 0x0E, 0x05, 0x03, 0x05, 0x0D, 0x06, 0x03, 0x06, 0x0C, 0x05, 0x05, 0x06, 0x09, 0x07, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x13, 0x09, 0x11, 0x0B, 0x0E, 0x10, 0x08, 0xFF, 0x34, 0xB6, 0x82, 0x14,
+	0x06, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14,
+	0x06, 0x14, 0x06, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x06, 0x14,
+	0x06, 0x13, 0x06, 0x14, 0x06, 0x13, 0x06, 0x14, 0x06, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14,
+	0x06, 0x14, 0x06, 0x13, 0x06, 0x14, 0x06, 0x13, 0x06, 0x14, 0x06, 0x14, 0x05, 0x14, 0x06, 0x14,
+	0x06, 0x13, 0x06, 0x14, 0x05, 0xFF, 0x49, 0xAB, 0x09, 0x0F, 0x0F, 0x0B, 0x12, 0x08, 0x14, 0x06,
+	0x07, 0x07, 0x08, 0x04, 0x06, 0x0B, 0x06, 0x04, 0x05, 0x0D, 0x06, 0x02, 0x05, 0x0F, 0x05, 0x02,
+	0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05, 0x02,
+	0x06, 0x0D, 0x05, 0x04, 0x05, 0x0D, 0x05, 0x04, 0x06, 0x0B, 0x06, 0x05, 0x06, 0x09, 0x06, 0x06,
+	0x08, 0x06, 0x06, 0x08, 0x09, 0x02, 0x07, 0x0B, 0x0F, 0x0D, 0x0C, 0x11, 0x0A, 0x0F, 0x0E, 0x0C,
+	0x10, 0x09, 0x07, 0x04, 0x08, 0x07, 0x07, 0x07, 0x07, 0x05, 0x06, 0x0A, 0x07, 0x04, 0x05, 0x0D,
+	0x06, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x0B, 0x11, 0x0A, 0x11, 0x0A, 0x11, 0x0A, 0x11,
+	0x0A, 0x11, 0x0B, 0x0F, 0x06, 0x01, 0x05, 0x0F, 0x05, 0x02, 0x06, 0x0D, 0x06, 0x03, 0x08, 0x07,
+	0x08, 0x05, 0x15, 0x07, 0x13, 0x09, 0x10, 0x0E, 0x0A, 0xFF, 0x33, 0xAB, 0x09, 0x10, 0x0D, 0x0C,
+	0x11, 0x09, 0x13, 0x07, 0x07, 0x06, 0x08, 0x05, 0x06, 0x0A, 0x06, 0x05, 0x05, 0x0C, 0x06, 0x03,
+	0x06, 0x0D, 0x05, 0x03, 0x05, 0x0E, 0x06, 0x02, 0x05, 0x0F, 0x05, 0x01, 0x05, 0x10, 0x05, 0x01,
+	0x05, 0x10, 0x05, 0x01, 0x05, 0x10, 0x0B, 0x11, 0x0A, 0x11, 0x0A, 0x11, 0x0A, 0x11, 0x0B, 0x10,
+	0x05, 0x01, 0x05, 0x10, 0x05, 0x01, 0x06, 0x0F, 0x05, 0x01, 0x07, 0x0C, 0x07, 0x02, 0x08, 0x07,
+	0x0A, 0x03, 0x18, 0x04, 0x17, 0x05, 0x0F, 0x02, 0x05, 0x08, 0x09, 0x05, 0x05, 0x16, 0x04, 0x17,
+	0x04, 0x16, 0x05, 0x16, 0x05, 0x16, 0x04, 0x16, 0x05, 0x16, 0x05, 0x15, 0x05, 0x15, 0x06, 0x14,
+	0x06, 0x14, 0x06, 0x06, 0x05, 0x08, 0x07, 0x07, 0x13, 0x08, 0x12, 0x0A, 0x0F, 0x0F, 0x09, 0xFF,
+	0x37, 0x78, 0x05, 0x01, 0x23, 0x01, 0x05, 0x72, 0x05, 0x01, 0x23, 0x01, 0x05, 0x55, 0xB8, 0x05,
+	0x04, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x04, 0x05, 0x9C, 0x04, 0x05, 0x06,
+	0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x05, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05,
+	0x04, 0x05, 0x05, 0x04, 0x05, 0x05, 0x05, 0x04, 0x05, 0x04, 0x06, 0x04, 0x24, 0xFF, 0x93, 0x03,
+	0x17, 0x04, 0x15, 0x06, 0x13, 0x08, 0x11, 0x09, 0x10, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A,
+	0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x10, 0x09, 0x12, 0x07, 0x14, 0x06, 0x15, 0x08,
+	0x14, 0x09, 0x14, 0x09, 0x14, 0x09, 0x14, 0x09, 0x14, 0x09, 0x14, 0x09, 0x14, 0x09, 0x14, 0x09,
+	0x14, 0x09, 0x14, 0x08, 0x15, 0x06, 0x17, 0x04, 0x18, 0x03, 0xFF, 0x96, 0xFF, 0xFF, 0x24, 0x68,
+	0xD0, 0x68, 0xFF, 0xFF, 0x3E, 0xFF, 0x7B, 0x02, 0x19, 0x04, 0x17, 0x06, 0x15, 0x08, 0x14, 0x09,
+	0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x14, 0x09, 0x14, 0x09, 0x14, 0x09,
+	0x14, 0x08, 0x15, 0x06, 0x14, 0x07, 0x12, 0x09, 0x10, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A,
+	0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x10, 0x09, 0x11, 0x08, 0x13, 0x06, 0x15, 0x04,
+	0x17, 0x02, 0xFF, 0xAF, 0x5D, 0x09, 0x0A, 0x0E, 0x07, 0x11, 0x04, 0x13, 0x03, 0x06, 0x06, 0x08,
+	0x02, 0x04, 0x0A, 0x06, 0x02, 0x02, 0x0D, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05,
+	0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x10, 0x06, 0x10, 0x05, 0x10, 0x06, 0x10, 0x06,
+	0x0E, 0x07, 0x0A, 0x0B, 0x0A, 0x0B, 0x0B, 0x0A, 0x0C, 0x08, 0x0E, 0x05, 0x11, 0x05, 0x11, 0x05,
+	0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x69, 0x04, 0x11, 0x06,
+	0x10, 0x06, 0x10, 0x06, 0x10, 0x06, 0x10, 0x06, 0x11, 0x04, 0xFD, 0xFF, 0x29, 0x0C, 0x1F, 0x13,
+	0x18, 0x18, 0x14, 0x1C, 0x11, 0x0A, 0x0A, 0x0A, 0x0E, 0x08, 0x11, 0x08, 0x0C, 0x07, 0x15, 0x07,
+	0x0A, 0x07, 0x17, 0x07, 0x09, 0x05, 0x1A, 0x06, 0x08, 0x05, 0x1C, 0x06, 0x06, 0x05, 0x1E, 0x05,
+	0x05, 0x06, 0x09, 0x06, 0x06, 0x03, 0x06, 0x05, 0x05, 0x05, 0x08, 0x0A, 0x03, 0x04, 0x06, 0x06,
+	0x03, 0x05, 0x08, 0x0C, 0x02, 0x04, 0x07, 0x05, 0x03, 0x05, 0x07, 0x0E, 0x01, 0x04, 0x07, 0x05,
+	0x03, 0x04, 0x07, 0x07, 0x04, 0x09, 0x07, 0x05, 0x02, 0x05, 0x07, 0x05, 0x07, 0x07, 0x08, 0x05,
+	0x02, 0x05, 0x06, 0x06, 0x08, 0x06, 0x08, 0x05, 0x02, 0x04, 0x07, 0x05, 0x0A, 0x05, 0x08, 0x05,
+	0x01, 0x05, 0x06, 0x05, 0x0B, 0x05, 0x08, 0x05, 0x01, 0x05, 0x06, 0x05, 0x0B, 0x05, 0x08, 0x05,
+	0x01, 0x05, 0x06, 0x05, 0x0B, 0x04, 0x09, 0x05, 0x01, 0x04, 0x07, 0x04, 0x0C, 0x04, 0x09, 0x0A,
+	0x06, 0x05, 0x0B, 0x05, 0x09, 0x04, 0x01, 0x05, 0x06, 0x05, 0x0B, 0x05, 0x08, 0x05, 0x01, 0x05,
+	0x06, 0x05, 0x0B, 0x05, 0x08, 0x05, 0x01, 0x05, 0x06, 0x05, 0x0B, 0x04, 0x09, 0x05, 0x01, 0x05,
+	0x06, 0x05, 0x0B, 0x04, 0x09, 0x04, 0x02, 0x05, 0x06, 0x05, 0x0A, 0x05, 0x08, 0x05, 0x02, 0x05,
+	0x06, 0x05, 0x08, 0x07, 0x07, 0x06, 0x02, 0x05, 0x06, 0x06, 0x06, 0x09, 0x06, 0x05, 0x03, 0x05,
+	0x07, 0x05, 0x05, 0x0A, 0x04, 0x06, 0x04, 0x05, 0x07, 0x0E, 0x02, 0x0E, 0x04, 0x05, 0x07, 0x0D,
+	0x03, 0x0D, 0x05, 0x05, 0x08, 0x0A, 0x06, 0x0A, 0x08, 0x05, 0x09, 0x06, 0x0A, 0x06, 0x0A, 0x05,
+	0x29, 0x05, 0x29, 0x06, 0x29, 0x05, 0x29, 0x06, 0x29, 0x06, 0x29, 0x07, 0x28, 0x08, 0x12, 0x02,
+	0x13, 0x0A, 0x0B, 0x06, 0x14, 0x1A, 0x16, 0x18, 0x18, 0x14, 0x1E, 0x0C, 0xCB, 0xFF, 0x04, 0x07,
+	0x1C, 0x07, 0x1B, 0x09, 0x1A, 0x09, 0x1A, 0x09, 0x19, 0x0B, 0x18, 0x05, 0x01, 0x05, 0x18, 0x04,
+	0x02, 0x05, 0x17, 0x05, 0x02, 0x06, 0x16, 0x05, 0x03, 0x05, 0x15, 0x05, 0x04, 0x06, 0x14, 0x05,
+	0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x13, 0x05, 0x06, 0x06, 0x12, 0x05, 0x07, 0x05, 0x12, 0x05,
+	0x07, 0x05, 0x11, 0x05, 0x08, 0x06, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x06, 0x0E, 0x05,
+	0x0A, 0x06, 0x0E, 0x05, 0x0B, 0x05, 0x0D, 0x05, 0x0C, 0x06, 0x0C, 0x05, 0x0C, 0x06, 0x0C, 0x05,
+	0x0D, 0x05, 0x0B, 0x05, 0x0E, 0x06, 0x0A, 0x19, 0x0A, 0x19, 0x09, 0x1B, 0x08, 0x1B, 0x07, 0x06,
+	0x11, 0x06, 0x06, 0x05, 0x12, 0x06, 0x06, 0x05, 0x13, 0x05, 0x05, 0x06, 0x13, 0x06, 0x04, 0x05,
+	0x14, 0x06, 0x04, 0x05, 0x15, 0x05, 0x03, 0x06, 0x15, 0x06, 0x02, 0x05, 0x16, 0x06, 0x02, 0x05,
+	0x17, 0x0C, 0x17, 0x0B, 0x18, 0x06, 0xFF, 0xA5, 0xBE, 0x0F, 0x0B, 0x13, 0x08, 0x15, 0x06, 0x16,
+	0x05, 0x05, 0x0A, 0x07, 0x05, 0x05, 0x0C, 0x06, 0x04, 0x05, 0x0D, 0x05, 0x04, 0x05, 0x0D, 0x06,
+	0x03, 0x05, 0x0E, 0x05, 0x03, 0x05, 0x0E, 0x05, 0x03, 0x05, 0x0E, 0x05, 0x03, 0x05, 0x0E, 0x05,
+	0x03, 0x05, 0x0E, 0x05, 0x03, 0x05, 0x0E, 0x05, 0x03, 0x05, 0x0D, 0x05, 0x04, 0x05, 0x0D, 0x05,
+	0x04, 0x05, 0x0C, 0x05, 0x05, 0x05, 0x0A, 0x06, 0x06, 0x14, 0x07, 0x14, 0x07, 0x16, 0x05, 0x18,
+	0x03, 0x05, 0x0C, 0x08, 0x02, 0x05, 0x0E, 0x06, 0x02, 0x05, 0x0F, 0x06, 0x01, 0x05, 0x10, 0x05,
+	0x01, 0x05, 0x11, 0x0A, 0x11, 0x0A, 0x11, 0x0A, 0x11, 0x0A, 0x11, 0x0A, 0x11, 0x0A, 0x10, 0x05,
+	0x01, 0x05, 0x0F, 0x06, 0x01, 0x05, 0x0E, 0x06, 0x02, 0x05, 0x0C, 0x08, 0x02, 0x18, 0x03, 0x17,
+	0x04, 0x15, 0x07, 0x11, 0xFF, 0x4E, 0xBB, 0x09, 0x11, 0x0F, 0x0D, 0x12, 0x09, 0x15, 0x07, 0x17,
+	0x05, 0x09, 0x07, 0x08, 0x04, 0x07, 0x0D, 0x05, 0x04, 0x06, 0x10, 0x03, 0x03, 0x06, 0x12, 0x02,
+	0x02, 0x06, 0x17, 0x06, 0x17, 0x05, 0x17, 0x06, 0x17, 0x05, 0x18, 0x05, 0x18, 0x05, 0x17, 0x05,
+	0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05,
+	0x18, 0x05, 0x18, 0x05, 0x18, 0x06, 0x18, 0x05, 0x18, 0x05, 0x18, 0x06, 0x18, 0x05, 0x18, 0x06,
+	0x17, 0x07, 0x12, 0x02, 0x03, 0x07, 0x10, 0x03, 0x04, 0x07, 0x0D, 0x05, 0x04, 0x0A, 0x07, 0x08,
+	0x05, 0x18, 0x06, 0x16, 0x09, 0x13, 0x0C, 0x0F, 0x10, 0x09, 0xFF, 0x48, 0xDA, 0x10, 0x0E, 0x14,
+	0x0B, 0x16, 0x09, 0x18, 0x07, 0x05, 0x0B, 0x09, 0x06, 0x05, 0x0E, 0x07, 0x05, 0x05, 0x0F, 0x07,
+	0x04, 0x05, 0x11, 0x06, 0x03, 0x05, 0x12, 0x05, 0x03, 0x05, 0x12, 0x06, 0x02, 0x05, 0x13, 0x05,
+	0x02, 0x05, 0x14, 0x05, 0x01, 0x05, 0x14, 0x05, 0x01, 0x05, 0x14, 0x05, 0x01, 0x05, 0x15, 0x0A,
+	0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A,
+	0x15, 0x0A, 0x15, 0x0A, 0x14, 0x05, 0x01, 0x05, 0x14, 0x05, 0x01, 0x05, 0x14, 0x05, 0x01, 0x05,
+	0x13, 0x06, 0x01, 0x05, 0x13, 0x05, 0x02, 0x05, 0x12, 0x06, 0x02, 0x05, 0x11, 0x06, 0x03, 0x05,
+	0x10, 0x07, 0x03, 0x05, 0x0E, 0x08, 0x04, 0x05, 0x0B, 0x0A, 0x05, 0x19, 0x06, 0x18, 0x07, 0x16,
+	0x09, 0x14, 0x0C, 0x0F, 0xFF, 0x84, 0xA2, 0x60, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x12, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x45, 0x01, 0x16, 0xFF, 0x15, 0x94, 0x6D, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0xFF, 0x0D, 0xD5, 0x0A, 0x14, 0x10, 0x0F, 0x14, 0x0B, 0x17, 0x09, 0x19, 0x07, 0x0A,
+	0x08, 0x09, 0x05, 0x08, 0x0E, 0x06, 0x04, 0x07, 0x12, 0x04, 0x03, 0x07, 0x15, 0x02, 0x03, 0x06,
+	0x1A, 0x06, 0x1B, 0x05, 0x1B, 0x06, 0x1B, 0x05, 0x1C, 0x05, 0x1C, 0x05, 0x1B, 0x05, 0x1C, 0x05,
+	0x1C, 0x05, 0x1C, 0x05, 0x0C, 0x0F, 0x01, 0x05, 0x0C, 0x15, 0x0C, 0x15, 0x0C, 0x15, 0x17, 0x0A,
+	0x17, 0x0A, 0x17, 0x0B, 0x16, 0x05, 0x01, 0x05, 0x16, 0x05, 0x01, 0x05, 0x16, 0x05, 0x01, 0x06,
+	0x15, 0x05, 0x02, 0x05, 0x15, 0x05, 0x02, 0x06, 0x14, 0x05, 0x03, 0x06, 0x13, 0x05, 0x03, 0x07,
+	0x12, 0x05, 0x04, 0x07, 0x11, 0x05, 0x05, 0x08, 0x0E, 0x06, 0x05, 0x0B, 0x08, 0x09, 0x06, 0x1B,
+	0x08, 0x19, 0x09, 0x16, 0x0D, 0x12, 0x13, 0x0A, 0xFF, 0x74, 0xCB, 0x05, 0x13, 0x0A, 0x13, 0x0A,
+	0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A,
+	0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x9B, 0x13, 0x0A, 0x13, 0x0A,
+	0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A,
+	0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A, 0x13, 0x0A,
+	0x13, 0x05, 0xFF, 0x5D, 0x23, 0xC8, 0x3C, 0x73, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x07, 0x07, 0x0A, 0x04, 0x06, 0x01,
+	0x0E, 0x01, 0x0D, 0x02, 0x0D, 0x03, 0x0B, 0x06, 0x07, 0xAA, 0xB6, 0x05, 0x0F, 0x05, 0x01, 0x05,
+	0x0E, 0x06, 0x01, 0x05, 0x0D, 0x07, 0x01, 0x05, 0x0C, 0x07, 0x02, 0x05, 0x0B, 0x07, 0x03, 0x05,
+	0x0B, 0x06, 0x04, 0x05, 0x0A, 0x06, 0x05, 0x05, 0x09, 0x06, 0x06, 0x05, 0x08, 0x06, 0x07, 0x05,
+	0x07, 0x07, 0x07, 0x05, 0x07, 0x06, 0x08, 0x05, 0x06, 0x06, 0x09, 0x05, 0x05, 0x06, 0x0A, 0x05,
+	0x04, 0x06, 0x0B, 0x05, 0x03, 0x06, 0x0C, 0x05, 0x03, 0x05, 0x0D, 0x05, 0x02, 0x06, 0x0D, 0x05,
+	0x01, 0x06, 0x0E, 0x0B, 0x0F, 0x0C, 0x0E, 0x05, 0x01, 0x06, 0x0E, 0x05, 0x02, 0x06, 0x0D, 0x05,
+	0x02, 0x07, 0x0C, 0x05, 0x03, 0x07, 0x0B, 0x05, 0x04, 0x06, 0x0B, 0x05, 0x05, 0x06, 0x0A, 0x05,
+	0x05, 0x07, 0x09, 0x05, 0x06, 0x07, 0x08, 0x05, 0x07, 0x06, 0x08, 0x05, 0x08, 0x06, 0x07, 0x05,
+	0x08, 0x07, 0x06, 0x05, 0x09, 0x07, 0x05, 0x05, 0x0A, 0x06, 0x05, 0x05, 0x0B, 0x06, 0x04, 0x05,
+	0x0B, 0x07, 0x03, 0x05, 0x0C, 0x07, 0x02, 0x05, 0x0D, 0x07, 0x01, 0x05, 0x0E, 0x06, 0x01, 0x05,
+	0x0E, 0x0C, 0x0F, 0x06, 0xFF, 0x39, 0x93, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x54, 0x01, 0x14,
+	0xFC, 0xFF, 0x36, 0x07, 0x1C, 0x07, 0x01, 0x09, 0x1A, 0x13, 0x19, 0x13, 0x18, 0x14, 0x18, 0x0F,
+	0x01, 0x05, 0x17, 0x04, 0x01, 0x0A, 0x01, 0x05, 0x16, 0x05, 0x01, 0x0A, 0x01, 0x06, 0x15, 0x05,
+	0x01, 0x0A, 0x02, 0x05, 0x14, 0x05, 0x02, 0x0A, 0x02, 0x06, 0x13, 0x05, 0x02, 0x0A, 0x03, 0x05,
+	0x12, 0x05, 0x03, 0x0A, 0x03, 0x05, 0x12, 0x05, 0x03, 0x0A, 0x03, 0x06, 0x11, 0x05, 0x03, 0x0A,
+	0x04, 0x05, 0x10, 0x05, 0x04, 0x0A, 0x04, 0x06, 0x0F, 0x05, 0x04, 0x0A, 0x05, 0x05, 0x0E, 0x05,
+	0x05, 0x0A, 0x05, 0x05, 0x0E, 0x05, 0x05, 0x0A, 0x05, 0x06, 0x0C, 0x05, 0x06, 0x0A, 0x06, 0x05,
+	0x0C, 0x05, 0x06, 0x0A, 0x06, 0x06, 0x0B, 0x05, 0x06, 0x0A, 0x07, 0x05, 0x0A, 0x05, 0x07, 0x0A,
+	0x07, 0x06, 0x09, 0x05, 0x07, 0x0A, 0x07, 0x06, 0x08, 0x05, 0x08, 0x0A, 0x08, 0x05, 0x08, 0x05,
+	0x08, 0x0A, 0x08, 0x06, 0x06, 0x06, 0x08, 0x0A, 0x09, 0x05, 0x06, 0x05, 0x09, 0x0A, 0x09, 0x06,
+	0x05, 0x05, 0x09, 0x0A, 0x09, 0x06, 0x04, 0x05, 0x0A, 0x0A, 0x0A, 0x06, 0x03, 0x05, 0x0A, 0x0A,
+	0x0A, 0x06, 0x02, 0x05, 0x0B, 0x0A, 0x0B, 0x05, 0x02, 0x05, 0x0B, 0x0A, 0x0B, 0x0C, 0x0B, 0x0A,
+	0x0B, 0x0B, 0x0C, 0x0A, 0x0C, 0x0A, 0x0C, 0x0A, 0x0C, 0x09, 0x0D, 0x0A, 0x0D, 0x08, 0x0D, 0x0A,
+	0x0D, 0x08, 0x0D, 0x0A, 0x0E, 0x06, 0x0E, 0x0A, 0x0E, 0x06, 0x0E, 0x0A, 0x0E, 0x05, 0x0F, 0x05,
+	0xFF, 0xFF, 0x12, 0xDA, 0x06, 0x13, 0x0D, 0x12, 0x0E, 0x11, 0x0E, 0x11, 0x0F, 0x10, 0x10, 0x0F,
+	0x10, 0x0F, 0x0A, 0x01, 0x06, 0x0E, 0x0A, 0x01, 0x06, 0x0E, 0x0A, 0x02, 0x06, 0x0D, 0x0A, 0x02,
+	0x06, 0x0D, 0x0A, 0x03, 0x06, 0x0C, 0x0A, 0x04, 0x06, 0x0B, 0x0A, 0x04, 0x06, 0x0B, 0x0A, 0x05,
+	0x06, 0x0A, 0x0A, 0x05, 0x06, 0x0A, 0x0A, 0x06, 0x06, 0x09, 0x0A, 0x06, 0x07, 0x08, 0x0A, 0x07,
+	0x06, 0x08, 0x0A, 0x08, 0x06, 0x07, 0x0A, 0x08, 0x06, 0x07, 0x0A, 0x09, 0x06, 0x06, 0x0A, 0x09,
+	0x06, 0x06, 0x0A, 0x0A, 0x06, 0x05, 0x0A, 0x0B, 0x06, 0x04, 0x0A, 0x0B, 0x06, 0x04, 0x0A, 0x0C,
+	0x06, 0x03, 0x0A, 0x0C, 0x06, 0x03, 0x0A, 0x0D, 0x06, 0x02, 0x0A, 0x0D, 0x06, 0x02, 0x0A, 0x0E,
+	0x06, 0x01, 0x0A, 0x0F, 0x05, 0x01, 0x0A, 0x0F, 0x10, 0x10, 0x0F, 0x10, 0x0F, 0x11, 0x0E, 0x12,
+	0x0D, 0x12, 0x0D, 0x13, 0x0C, 0x14, 0x05, 0xFF, 0x76, 0xE5, 0x0A, 0x17, 0x11, 0x11, 0x14, 0x0F,
+	0x17, 0x0C, 0x19, 0x0A, 0x09, 0x08, 0x0A, 0x08, 0x08, 0x0D, 0x08, 0x06, 0x07, 0x10, 0x07, 0x06,
+	0x06, 0x12, 0x07, 0x04, 0x06, 0x14, 0x06, 0x04, 0x05, 0x16, 0x06, 0x02, 0x06, 0x16, 0x06, 0x02,
+	0x05, 0x18, 0x05, 0x02, 0x05, 0x18, 0x05, 0x02, 0x05, 0x18, 0x0C, 0x19, 0x0A, 0x1A, 0x0A, 0x1A,
+	0x0A, 0x1A, 0x0A, 0x1A, 0x0A, 0x1A, 0x0A, 0x1A, 0x0A, 0x1A, 0x0A, 0x1A, 0x0A, 0x1A, 0x0A, 0x1A,
+	0x0A, 0x19, 0x0C, 0x18, 0x05, 0x02, 0x05, 0x18, 0x05, 0x02, 0x05, 0x18, 0x05, 0x02, 0x06, 0x16,
+	0x06, 0x02, 0x06, 0x16, 0x05, 0x04, 0x06, 0x14, 0x06, 0x04, 0x07, 0x12, 0x06, 0x06, 0x07, 0x10,
+	0x07, 0x06, 0x08, 0x0D, 0x08, 0x08, 0x0A, 0x08, 0x09, 0x0A, 0x19, 0x0C, 0x17, 0x0F, 0x14, 0x11,
+	0x11, 0x17, 0x0A, 0xFF, 0x9A, 0xB0, 0x0F, 0x09, 0x13, 0x06, 0x15, 0x04, 0x16, 0x03, 0x05, 0x0A,
+	0x08, 0x02, 0x05, 0x0C, 0x06, 0x02, 0x05, 0x0D, 0x06, 0x01, 0x05, 0x0E, 0x05, 0x01, 0x05, 0x0E,
+	0x0B, 0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x0F, 0x0A, 0x0E, 0x0B, 0x0E,
+	0x05, 0x01, 0x05, 0x0D, 0x06, 0x01, 0x05, 0x0D, 0x05, 0x02, 0x05, 0x0B, 0x07, 0x02, 0x05, 0x09,
+	0x08, 0x03, 0x15, 0x04, 0x14, 0x05, 0x12, 0x07, 0x0F, 0x0A, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14,
+	0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14,
+	0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0xFF, 0x41, 0xFF, 0x04, 0x0A, 0x1C, 0x10, 0x17, 0x14,
+	0x14, 0x17, 0x11, 0x19, 0x0F, 0x09, 0x08, 0x0A, 0x0D, 0x08, 0x0D, 0x07, 0x0C, 0x07, 0x10, 0x07,
+	0x0B, 0x06, 0x12, 0x07, 0x09, 0x06, 0x14, 0x06, 0x09, 0x05, 0x16, 0x05, 0x08, 0x06, 0x16, 0x06,
+	0x07, 0x05, 0x18, 0x05, 0x07, 0x05, 0x18, 0x05, 0x07, 0x05, 0x18, 0x06, 0x05, 0x06, 0x19, 0x05,
+	0x05, 0x05, 0x1A, 0x05, 0x05, 0x05, 0x1A, 0x05, 0x05, 0x05, 0x1A, 0x05, 0x05, 0x05, 0x1A, 0x05,
+	0x05, 0x05, 0x1A, 0x05, 0x05, 0x05, 0x1A, 0x05, 0x05, 0x05, 0x1A, 0x05, 0x05, 0x05, 0x1A, 0x05,
+	0x05, 0x05, 0x1A, 0x05, 0x05, 0x05, 0x1A, 0x05, 0x05, 0x05, 0x19, 0x06, 0x05, 0x06, 0x18, 0x05,
+	0x07, 0x05, 0x18, 0x05, 0x07, 0x05, 0x18, 0x05, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x16, 0x05,
+	0x09, 0x06, 0x14, 0x06, 0x09, 0x07, 0x12, 0x06, 0x0B, 0x07, 0x10, 0x07, 0x0B, 0x08, 0x0D, 0x08,
+	0x0D, 0x0A, 0x08, 0x09, 0x0F, 0x1B, 0x0F, 0x1B, 0x10, 0x1B, 0x0F, 0x10, 0x03, 0x09, 0x11, 0x09,
+	0x07, 0x0A, 0x20, 0x0B, 0x20, 0x09, 0x22, 0x07, 0x24, 0x05, 0x26, 0x03, 0xF6, 0xBE, 0x10, 0x0A,
+	0x13, 0x08, 0x15, 0x06, 0x16, 0x05, 0x05, 0x0A, 0x08, 0x04, 0x05, 0x0C, 0x07, 0x03, 0x05, 0x0E,
+	0x05, 0x03, 0x05, 0x0E, 0x06, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F,
+	0x05, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0E,
+	0x05, 0x03, 0x05, 0x0D, 0x06, 0x03, 0x05, 0x0C, 0x06, 0x04, 0x05, 0x0A, 0x07, 0x05, 0x15, 0x06,
+	0x13, 0x08, 0x11, 0x0A, 0x13, 0x08, 0x05, 0x07, 0x08, 0x07, 0x05, 0x09, 0x06, 0x07, 0x05, 0x0A,
+	0x06, 0x06, 0x05, 0x0B, 0x06, 0x05, 0x05, 0x0B, 0x06, 0x05, 0x05, 0x0C, 0x06, 0x04, 0x05, 0x0C,
+	0x06, 0x04, 0x05, 0x0D, 0x05, 0x04, 0x05, 0x0D, 0x06, 0x03, 0x05, 0x0D, 0x06, 0x03, 0x05, 0x0E,
+	0x06, 0x02, 0x05, 0x0E, 0x06, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x06, 0x01, 0x05, 0x0F,
+	0x06, 0x01, 0x05, 0x10, 0x0B, 0x10, 0x0B, 0x11, 0x05, 0xFF, 0x45, 0x9F, 0x09, 0x0E, 0x0F, 0x08,
+	0x12, 0x06, 0x13, 0x05, 0x07, 0x07, 0x06, 0x04, 0x06, 0x0B, 0x04, 0x04, 0x05, 0x0E, 0x02, 0x03,
+	0x06, 0x13, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x06, 0x13,
+	0x07, 0x13, 0x08, 0x11, 0x0A, 0x10, 0x0B, 0x10, 0x0B, 0x0F, 0x0C, 0x0F, 0x0C, 0x0F, 0x0B, 0x11,
+	0x09, 0x12, 0x08, 0x12, 0x07, 0x13, 0x06, 0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14,
+	0x05, 0x14, 0x05, 0x13, 0x08, 0x11, 0x05, 0x01, 0x04, 0x0D, 0x07, 0x01, 0x08, 0x07, 0x08, 0x02,
+	0x16, 0x03, 0x15, 0x05, 0x13, 0x08, 0x0F, 0x0D, 0x0A, 0xFF, 0x1D, 0xCB, 0x91, 0x0C, 0x05, 0x18,
+	0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18,
+	0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18,
+	0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18,
+	0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18,
+	0x05, 0x18, 0x05, 0xFF, 0x69, 0xD2, 0x05, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14,
+	0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14,
+	0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14,
+	0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14, 0x0A, 0x14,
+	0x0B, 0x12, 0x0C, 0x12, 0x05, 0x02, 0x05, 0x12, 0x05, 0x02, 0x06, 0x10, 0x06, 0x02, 0x07, 0x0E,
+	0x06, 0x04, 0x07, 0x0C, 0x07, 0x05, 0x08, 0x08, 0x08, 0x06, 0x17, 0x08, 0x15, 0x0B, 0x12, 0x0D,
+	0x0F, 0x12, 0x09, 0xFF, 0x56, 0xEE, 0x05, 0x18, 0x0B, 0x16, 0x0C, 0x16, 0x05, 0x01, 0x06, 0x15,
+	0x06, 0x02, 0x06, 0x14, 0x06, 0x02, 0x06, 0x14, 0x05, 0x04, 0x05, 0x13, 0x06, 0x04, 0x06, 0x12,
+	0x06, 0x04, 0x06, 0x12, 0x05, 0x06, 0x05, 0x11, 0x06, 0x06, 0x06, 0x10, 0x05, 0x07, 0x06, 0x10,
+	0x05, 0x08, 0x05, 0x0F, 0x06, 0x08, 0x06, 0x0E, 0x05, 0x09, 0x06, 0x0E, 0x05, 0x0A, 0x05, 0x0D,
+	0x06, 0x0A, 0x06, 0x0C, 0x05, 0x0B, 0x06, 0x0C, 0x05, 0x0C, 0x05, 0x0B, 0x06, 0x0C, 0x06, 0x0A,
+	0x05, 0x0E, 0x05, 0x0A, 0x05, 0x0E, 0x06, 0x08, 0x06, 0x0E, 0x06, 0x08, 0x05, 0x10, 0x05, 0x08,
+	0x05, 0x10, 0x06, 0x06, 0x05, 0x11, 0x06, 0x06, 0x05, 0x12, 0x05, 0x06, 0x05, 0x12, 0x06, 0x04,
+	0x05, 0x13, 0x06, 0x04, 0x05, 0x14, 0x05, 0x04, 0x05, 0x14, 0x06, 0x02, 0x05, 0x16, 0x05, 0x02,
+	0x05, 0x16, 0x05, 0x02, 0x05, 0x16, 0x0B, 0x18, 0x0A, 0x18, 0x09, 0x19, 0x09, 0x1A, 0x08, 0x1A,
+	0x07, 0x1C, 0x06, 0xFF, 0xA7, 0xFF, 0x74, 0x05, 0x13, 0x05, 0x13, 0x0B, 0x11, 0x06, 0x12, 0x0C,
+	0x11, 0x07, 0x11, 0x06, 0x01, 0x05, 0x11, 0x07, 0x11, 0x05, 0x02, 0x06, 0x0F, 0x08, 0x11, 0x05,
+	0x02, 0x06, 0x0F, 0x09, 0x0F, 0x06, 0x02, 0x06, 0x0F, 0x09, 0x0F, 0x06, 0x03, 0x05, 0x0F, 0x09,
+	0x0F, 0x05, 0x04, 0x06, 0x0D, 0x0A, 0x0F, 0x05, 0x04, 0x06, 0x0D, 0x0B, 0x0D, 0x06, 0x05, 0x05,
+	0x0D, 0x05, 0x01, 0x05, 0x0D, 0x05, 0x06, 0x05, 0x0D, 0x04, 0x02, 0x05, 0x0D, 0x05, 0x06, 0x06,
+	0x0B, 0x05, 0x02, 0x06, 0x0C, 0x05, 0x06, 0x06, 0x0B, 0x05, 0x03, 0x05, 0x0B, 0x05, 0x08, 0x05,
+	0x0B, 0x05, 0x03, 0x05, 0x0B, 0x05, 0x08, 0x06, 0x0A, 0x04, 0x04, 0x05, 0x0B, 0x05, 0x08, 0x06,
+	0x09, 0x05, 0x04, 0x06, 0x09, 0x06, 0x09, 0x05, 0x09, 0x05, 0x05, 0x05, 0x09, 0x05, 0x0A, 0x05,
+	0x09, 0x05, 0x05, 0x05, 0x09, 0x05, 0x0A, 0x06, 0x08, 0x04, 0x06, 0x05, 0x09, 0x05, 0x0B, 0x05,
+	0x07, 0x05, 0x06, 0x06, 0x07, 0x05, 0x0C, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x0C, 0x05,
+	0x07, 0x04, 0x08, 0x05, 0x07, 0x05, 0x0C, 0x06, 0x06, 0x04, 0x08, 0x06, 0x06, 0x05, 0x0D, 0x05,
+	0x05, 0x05, 0x09, 0x05, 0x05, 0x05, 0x0E, 0x05, 0x05, 0x05, 0x09, 0x05, 0x05, 0x05, 0x0E, 0x06,
+	0x04, 0x04, 0x0A, 0x05, 0x05, 0x05, 0x0F, 0x05, 0x03, 0x05, 0x0A, 0x06, 0x04, 0x04, 0x10, 0x05,
+	0x03, 0x05, 0x0B, 0x05, 0x03, 0x05, 0x10, 0x05, 0x03, 0x05, 0x0B, 0x05, 0x03, 0x05, 0x10, 0x06,
+	0x02, 0x04, 0x0C, 0x06, 0x02, 0x04, 0x12, 0x05, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x05, 0x12, 0x05,
+	0x01, 0x05, 0x0D, 0x05, 0x01, 0x05, 0x12, 0x05, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x05, 0x13, 0x09,
+	0x0E, 0x0A, 0x14, 0x09, 0x0F, 0x09, 0x14, 0x09, 0x0F, 0x09, 0x14, 0x09, 0x0F, 0x08, 0x16, 0x07,
+	0x11, 0x07, 0x16, 0x07, 0x11, 0x07, 0xFF, 0xFF, 0x89, 0xD2, 0x06, 0x12, 0x05, 0x01, 0x06, 0x11,
+	0x06, 0x02, 0x06, 0x10, 0x05, 0x03, 0x07, 0x0E, 0x06, 0x04, 0x06, 0x0D, 0x06, 0x06, 0x06, 0x0C,
+	0x06, 0x06, 0x06, 0x0B, 0x06, 0x08, 0x06, 0x0A, 0x05, 0x09, 0x07, 0x08, 0x06, 0x0A, 0x06, 0x07,
+	0x06, 0x0C, 0x06, 0x06, 0x06, 0x0C, 0x06, 0x05, 0x06, 0x0E, 0x06, 0x04, 0x05, 0x0F, 0x06, 0x03,
+	0x06, 0x10, 0x06, 0x02, 0x05, 0x12, 0x0C, 0x12, 0x0B, 0x14, 0x09, 0x15, 0x09, 0x16, 0x07, 0x17,
+	0x08, 0x15, 0x09, 0x14, 0x0B, 0x13, 0x05, 0x01, 0x06, 0x11, 0x06, 0x01, 0x06, 0x11, 0x05, 0x03,
+	0x06, 0x0F, 0x06, 0x03, 0x06, 0x0E, 0x06, 0x05, 0x06, 0x0D, 0x06, 0x06, 0x06, 0x0B, 0x06, 0x07,
+	0x06, 0x0B, 0x05, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x08, 0x06, 0x0B, 0x06, 0x07, 0x06, 0x0B,
+	0x06, 0x06, 0x06, 0x0D, 0x06, 0x05, 0x05, 0x0F, 0x06, 0x03, 0x06, 0x0F, 0x06, 0x02, 0x06, 0x11,
+	0x06, 0x01, 0x06, 0x11, 0x06, 0x01, 0x05, 0x13, 0x06, 0xFF, 0x69, 0xCB, 0x06, 0x11, 0x0C, 0x11,
+	0x06, 0x01, 0x06, 0x0F, 0x06, 0x02, 0x06, 0x0F, 0x06, 0x03, 0x06, 0x0D, 0x06, 0x04, 0x06, 0x0D,
+	0x06, 0x05, 0x06, 0x0B, 0x06, 0x06, 0x06, 0x0B, 0x06, 0x07, 0x06, 0x09, 0x06, 0x08, 0x06, 0x09,
+	0x06, 0x09, 0x06, 0x07, 0x06, 0x0A, 0x06, 0x07, 0x06, 0x0B, 0x06, 0x06, 0x05, 0x0C, 0x06, 0x05,
+	0x06, 0x0D, 0x06, 0x04, 0x05, 0x0E, 0x06, 0x03, 0x06, 0x0F, 0x05, 0x03, 0x05, 0x10, 0x06, 0x01,
+	0x06, 0x11, 0x05, 0x01, 0x05, 0x12, 0x0B, 0x13, 0x09, 0x15, 0x07, 0x16, 0x07, 0x17, 0x05, 0x18,
+	0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18,
+	0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x05, 0xFF,
+	0x69, 0xBE, 0x18, 0x02, 0x1A, 0x01, 0x1A, 0x01, 0x1A, 0x02, 0x19, 0x15, 0x05, 0x15, 0x06, 0x14,
+	0x06, 0x15, 0x05, 0x15, 0x06, 0x14, 0x06, 0x15, 0x05, 0x15, 0x06, 0x14, 0x06, 0x15, 0x05, 0x15,
+	0x06, 0x14, 0x06, 0x15, 0x05, 0x15, 0x06, 0x14, 0x06, 0x15, 0x05, 0x15, 0x06, 0x14, 0x06, 0x15,
+	0x05, 0x15, 0x06, 0x14, 0x06, 0x14, 0x06, 0x15, 0x06, 0x14, 0x06, 0x14, 0x06, 0x15, 0x06, 0x14,
+	0x06, 0x14, 0x06, 0x15, 0x06, 0x14, 0x06, 0x15, 0x1A, 0x01, 0x6B, 0xFF, 0x46, 0x22, 0x30, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x21, 0x01, 0x0A, 0x16, 0x19, 0x05,
+	0x15, 0x05, 0x14, 0x05, 0x14, 0x05, 0x15, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x05,
+	0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x15, 0x05, 0x14, 0x05,
+	0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05,
+	0x14, 0x05, 0x15, 0x05, 0x14, 0x05, 0x14, 0x05, 0x15, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05,
+	0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x15, 0x05,
+	0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x14, 0x05, 0x14, 0x06,
+	0x14, 0x05, 0x14, 0x05, 0x15, 0x05, 0x14, 0x05, 0x14, 0x06, 0x14, 0x05, 0x4B, 0x21, 0x0A, 0x01,
+	0x21, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x30, 0x17, 0xB9, 0x06,
+	0x12, 0x07, 0x12, 0x08, 0x10, 0x09, 0x10, 0x0A, 0x0F, 0x04, 0x01, 0x05, 0x0E, 0x05, 0x01, 0x05,
+	0x0E, 0x05, 0x02, 0x05, 0x0C, 0x05, 0x03, 0x05, 0x0C, 0x05, 0x04, 0x05, 0x0A, 0x05, 0x05, 0x05,
+	0x0A, 0x05, 0x05, 0x06, 0x08, 0x06, 0x06, 0x05, 0x08, 0x05, 0x07, 0x06, 0x07, 0x05, 0x08, 0x05,
+	0x06, 0x05, 0x09, 0x06, 0x05, 0x05, 0x0A, 0x05, 0x04, 0x06, 0x0A, 0x05, 0x04, 0x05, 0x0B, 0x06,
+	0x02, 0x06, 0x0C, 0x05, 0x02, 0x05, 0x0D, 0x0C, 0x0E, 0x0A, 0x0F, 0x05, 0xFF, 0xFF, 0xD7, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x80, 0x1E, 0x05, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05,
+	0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x04, 0x06, 0x05, 0x06, 0x04, 0xFF, 0xCD, 0xFF, 0x78, 0x09,
+	0x0A, 0x10, 0x06, 0x12, 0x04, 0x14, 0x03, 0x07, 0x07, 0x07, 0x02, 0x04, 0x0B, 0x06, 0x02, 0x02,
+	0x0E, 0x06, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x09, 0x0E,
+	0x06, 0x11, 0x04, 0x13, 0x02, 0x15, 0x02, 0x07, 0x09, 0x05, 0x01, 0x06, 0x0B, 0x05, 0x01, 0x05,
+	0x0C, 0x0A, 0x0D, 0x0A, 0x0D, 0x0A, 0x0D, 0x0A, 0x0D, 0x0A, 0x0C, 0x0C, 0x0A, 0x07, 0x01, 0x05,
+	0x09, 0x08, 0x01, 0x07, 0x05, 0x05, 0x01, 0x04, 0x02, 0x0F, 0x02, 0x04, 0x03, 0x0D, 0x03, 0x04,
+	0x04, 0x0B, 0x04, 0x04, 0x06, 0x07, 0xFF, 0x08, 0x68, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05,
+	0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05,
+	0x15, 0x05, 0x06, 0x07, 0x08, 0x05, 0x04, 0x0B, 0x06, 0x05, 0x03, 0x0E, 0x04, 0x05, 0x01, 0x11,
+	0x03, 0x0B, 0x05, 0x07, 0x03, 0x09, 0x09, 0x06, 0x02, 0x08, 0x0B, 0x05, 0x02, 0x07, 0x0C, 0x06,
+	0x01, 0x06, 0x0E, 0x05, 0x01, 0x06, 0x0E, 0x05, 0x01, 0x05, 0x0F, 0x0B, 0x10, 0x0A, 0x10, 0x0A,
+	0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A,
+	0x0F, 0x05, 0x01, 0x05, 0x0F, 0x05, 0x01, 0x06, 0x0E, 0x05, 0x01, 0x07, 0x0C, 0x06, 0x01, 0x08,
+	0x0A, 0x06, 0x02, 0x09, 0x09, 0x06, 0x02, 0x04, 0x01, 0x06, 0x05, 0x07, 0x03, 0x04, 0x02, 0x10,
+	0x04, 0x04, 0x03, 0x0E, 0x05, 0x04, 0x04, 0x0C, 0x10, 0x07, 0xFF, 0x28, 0xFF, 0x6A, 0x08, 0x0C,
+	0x0D, 0x07, 0x10, 0x05, 0x12, 0x03, 0x07, 0x06, 0x06, 0x03, 0x05, 0x0A, 0x04, 0x02, 0x05, 0x0D,
+	0x02, 0x02, 0x05, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x10, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11,
+	0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11,
+	0x05, 0x11, 0x05, 0x11, 0x06, 0x0D, 0x02, 0x02, 0x05, 0x0C, 0x03, 0x02, 0x06, 0x0A, 0x04, 0x03,
+	0x07, 0x06, 0x06, 0x04, 0x11, 0x06, 0x0F, 0x08, 0x0D, 0x0C, 0x07, 0xF8, 0x7D, 0x05, 0x15, 0x05,
+	0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05,
+	0x15, 0x05, 0x15, 0x05, 0x09, 0x06, 0x06, 0x05, 0x06, 0x0C, 0x03, 0x05, 0x05, 0x0E, 0x02, 0x05,
+	0x04, 0x10, 0x01, 0x05, 0x03, 0x07, 0x05, 0x0B, 0x02, 0x06, 0x09, 0x09, 0x02, 0x06, 0x0A, 0x08,
+	0x01, 0x06, 0x0C, 0x07, 0x01, 0x05, 0x0E, 0x06, 0x01, 0x05, 0x0F, 0x05, 0x01, 0x05, 0x0F, 0x0A,
+	0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A,
+	0x10, 0x0A, 0x10, 0x0B, 0x0F, 0x05, 0x01, 0x05, 0x0E, 0x06, 0x01, 0x05, 0x0E, 0x06, 0x01, 0x06,
+	0x0C, 0x07, 0x02, 0x05, 0x0B, 0x08, 0x02, 0x06, 0x09, 0x09, 0x03, 0x07, 0x05, 0x06, 0x01, 0x04,
+	0x03, 0x11, 0x02, 0x04, 0x04, 0x0F, 0x03, 0x04, 0x06, 0x0B, 0x05, 0x04, 0x08, 0x07, 0xFF, 0x2A,
+	0xFF, 0xAB, 0x08, 0x0F, 0x0D, 0x0C, 0x10, 0x08, 0x13, 0x07, 0x06, 0x06, 0x07, 0x06, 0x05, 0x0A,
+	0x06, 0x04, 0x05, 0x0C, 0x06, 0x03, 0x05, 0x0D, 0x05, 0x02, 0x05, 0x0E, 0x05, 0x02, 0x05, 0x0F,
+	0x05, 0x01, 0x04, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x6C, 0x01, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15,
+	0x05, 0x16, 0x04, 0x16, 0x05, 0x15, 0x05, 0x15, 0x06, 0x15, 0x06, 0x14, 0x07, 0x0D, 0x03, 0x04,
+	0x08, 0x08, 0x06, 0x05, 0x15, 0x06, 0x14, 0x08, 0x10, 0x0D, 0x09, 0xFF, 0x26, 0x43, 0x07, 0x0A,
+	0x0B, 0x07, 0x0C, 0x07, 0x0C, 0x06, 0x06, 0x05, 0x02, 0x06, 0x05, 0x0D, 0x06, 0x0D, 0x05, 0x0E,
+	0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x09, 0x11, 0x02, 0x11, 0x02,
+	0x11, 0x02, 0x11, 0x07, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E,
+	0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E,
+	0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E,
+	0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0xED, 0xFF, 0xBA, 0x07, 0x12, 0x14, 0x05, 0x16, 0x04,
+	0x17, 0x04, 0x06, 0x06, 0x0B, 0x03, 0x06, 0x08, 0x05, 0x08, 0x05, 0x0A, 0x05, 0x06, 0x06, 0x0B,
+	0x05, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x05, 0x0C,
+	0x05, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x05, 0x0B, 0x06, 0x06, 0x05, 0x0A, 0x05, 0x07, 0x06, 0x08,
+	0x06, 0x08, 0x06, 0x06, 0x06, 0x09, 0x12, 0x08, 0x12, 0x08, 0x11, 0x0A, 0x04, 0x04, 0x07, 0x0B,
+	0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x07, 0x15, 0x11, 0x0A, 0x15, 0x07, 0x15, 0x06, 0x16, 0x04,
+	0x06, 0x0A, 0x08, 0x02, 0x06, 0x0E, 0x06, 0x01, 0x05, 0x10, 0x0A, 0x11, 0x0A, 0x11, 0x0A, 0x11,
+	0x0A, 0x11, 0x0B, 0x0F, 0x05, 0x01, 0x07, 0x0D, 0x06, 0x02, 0x08, 0x08, 0x08, 0x03, 0x17, 0x06,
+	0x14, 0x08, 0x11, 0x0D, 0x0B, 0x09, 0x60, 0x05, 0x13, 0x05, 0x13, 0x05, 0x13, 0x05, 0x13, 0x05,
+	0x13, 0x05, 0x13, 0x05, 0x13, 0x05, 0x13, 0x05, 0x13, 0x05, 0x13, 0x05, 0x13, 0x05, 0x13, 0x05,
+	0x06, 0x07, 0x06, 0x05, 0x04, 0x0B, 0x04, 0x05, 0x02, 0x0E, 0x03, 0x05, 0x01, 0x10, 0x02, 0x0B,
+	0x04, 0x07, 0x02, 0x09, 0x08, 0x06, 0x01, 0x08, 0x0A, 0x05, 0x01, 0x07, 0x0B, 0x0C, 0x0D, 0x0A,
+	0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A,
+	0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A,
+	0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x05, 0xFF, 0x21, 0x25, 0x04,
+	0x01, 0x18, 0x01, 0x04, 0x20, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+	0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+	0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+	0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+	0x48, 0x4F, 0x04, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x04, 0x44, 0x05, 0x07,
+	0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+	0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+	0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+	0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x07,
+	0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x01, 0x0A, 0x02, 0x0A, 0x02, 0x09, 0x04,
+	0x06, 0x05, 0x5C, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x0B, 0x06,
+	0x01, 0x05, 0x0A, 0x07, 0x01, 0x05, 0x09, 0x07, 0x02, 0x05, 0x09, 0x06, 0x03, 0x05, 0x08, 0x06,
+	0x04, 0x05, 0x07, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x07, 0x05, 0x04, 0x06,
+	0x08, 0x05, 0x03, 0x06, 0x09, 0x05, 0x02, 0x05, 0x0B, 0x05, 0x01, 0x05, 0x0C, 0x0A, 0x0D, 0x0B,
+	0x0C, 0x05, 0x01, 0x05, 0x0C, 0x05, 0x02, 0x05, 0x0B, 0x05, 0x02, 0x06, 0x0A, 0x05, 0x03, 0x06,
+	0x09, 0x05, 0x04, 0x06, 0x08, 0x05, 0x05, 0x06, 0x07, 0x05, 0x05, 0x06, 0x07, 0x05, 0x06, 0x06,
+	0x06, 0x05, 0x07, 0x06, 0x05, 0x05, 0x08, 0x06, 0x04, 0x05, 0x08, 0x07, 0x03, 0x05, 0x09, 0x07,
+	0x02, 0x05, 0x0A, 0x06, 0x02, 0x05, 0x0B, 0x06, 0x01, 0x05, 0x0C, 0x0B, 0x0C, 0x06, 0xFF, 0x15,
+	0x14, 0xD7, 0x3C, 0xFF, 0xFF, 0xAD, 0x06, 0x0D, 0x06, 0x06, 0x04, 0x05, 0x0B, 0x08, 0x0A, 0x04,
+	0x05, 0x03, 0x0D, 0x06, 0x0C, 0x03, 0x05, 0x02, 0x0F, 0x03, 0x0F, 0x02, 0x05, 0x01, 0x05, 0x05,
+	0x06, 0x02, 0x05, 0x05, 0x07, 0x01, 0x09, 0x08, 0x06, 0x01, 0x04, 0x07, 0x06, 0x01, 0x08, 0x0A,
+	0x09, 0x09, 0x05, 0x01, 0x07, 0x0B, 0x08, 0x0A, 0x0C, 0x0D, 0x06, 0x0C, 0x0A, 0x0E, 0x05, 0x0D,
+	0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D,
+	0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D,
+	0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D,
+	0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D,
+	0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D, 0x0A, 0x0E, 0x05, 0x0D,
+	0x0A, 0x0E, 0x05, 0x0D, 0x05, 0xFF, 0xF9, 0xFF, 0x8C, 0x07, 0x06, 0x04, 0x05, 0x0B, 0x04, 0x05,
+	0x03, 0x0D, 0x03, 0x05, 0x01, 0x10, 0x02, 0x05, 0x01, 0x05, 0x04, 0x07, 0x02, 0x09, 0x08, 0x06,
+	0x01, 0x08, 0x0A, 0x05, 0x01, 0x07, 0x0B, 0x0C, 0x0D, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A,
+	0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A,
+	0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A,
+	0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x05, 0xFF, 0x21, 0xFF, 0xCB, 0x09, 0x10, 0x0E, 0x0D, 0x11, 0x0A,
+	0x13, 0x08, 0x07, 0x06, 0x08, 0x06, 0x06, 0x0A, 0x07, 0x04, 0x06, 0x0C, 0x06, 0x04, 0x05, 0x0E,
+	0x06, 0x02, 0x06, 0x0F, 0x05, 0x02, 0x05, 0x10, 0x05, 0x02, 0x05, 0x10, 0x05, 0x01, 0x05, 0x12,
+	0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x12,
+	0x0A, 0x12, 0x05, 0x01, 0x05, 0x10, 0x05, 0x02, 0x05, 0x10, 0x05, 0x02, 0x05, 0x10, 0x05, 0x02,
+	0x06, 0x0E, 0x05, 0x04, 0x06, 0x0C, 0x06, 0x04, 0x07, 0x0A, 0x06, 0x06, 0x08, 0x06, 0x07, 0x08,
+	0x13, 0x0A, 0x11, 0x0D, 0x0E, 0x10, 0x09, 0xFF, 0x3F, 0xFF, 0xAC, 0x07, 0x08, 0x04, 0x05, 0x0B,
+	0x06, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x02, 0x11, 0x03, 0x04, 0x01, 0x06, 0x05, 0x07, 0x03, 0x09,
+	0x09, 0x06, 0x02, 0x08, 0x0B, 0x05, 0x02, 0x07, 0x0C, 0x06, 0x01, 0x06, 0x0E, 0x05, 0x01, 0x06,
+	0x0E, 0x05, 0x01, 0x05, 0x0F, 0x0B, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A,
+	0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x0F, 0x05, 0x01, 0x05, 0x0F, 0x05,
+	0x01, 0x06, 0x0E, 0x05, 0x01, 0x07, 0x0C, 0x06, 0x01, 0x08, 0x0A, 0x06, 0x02, 0x09, 0x08, 0x07,
+	0x02, 0x0B, 0x05, 0x07, 0x03, 0x05, 0x01, 0x10, 0x04, 0x05, 0x02, 0x0E, 0x05, 0x05, 0x03, 0x0C,
+	0x06, 0x05, 0x05, 0x07, 0x09, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05,
+	0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0xFF, 0xAA, 0x06, 0x11, 0x0C,
+	0x04, 0x04, 0x05, 0x0E, 0x03, 0x04, 0x04, 0x10, 0x02, 0x04, 0x03, 0x07, 0x05, 0x06, 0x01, 0x04,
+	0x02, 0x06, 0x09, 0x09, 0x02, 0x06, 0x0A, 0x08, 0x01, 0x06, 0x0C, 0x07, 0x01, 0x05, 0x0E, 0x06,
+	0x01, 0x05, 0x0F, 0x05, 0x01, 0x05, 0x0F, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A,
+	0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x10, 0x0B, 0x0F, 0x05, 0x01, 0x05,
+	0x0E, 0x06, 0x01, 0x05, 0x0E, 0x06, 0x01, 0x06, 0x0C, 0x07, 0x02, 0x05, 0x0B, 0x08, 0x02, 0x06,
+	0x09, 0x09, 0x03, 0x07, 0x05, 0x0B, 0x03, 0x11, 0x01, 0x05, 0x04, 0x0E, 0x03, 0x05, 0x06, 0x0B,
+	0x04, 0x05, 0x08, 0x07, 0x06, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05,
+	0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0xFF, 0x0B, 0x05, 0x01,
+	0x04, 0x04, 0x0D, 0x02, 0x0E, 0x01, 0x0F, 0x01, 0x14, 0x04, 0x0B, 0x07, 0x08, 0x08, 0x07, 0x09,
+	0x06, 0x0A, 0x06, 0x0A, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B,
+	0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B,
+	0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0xCB, 0xFF, 0x48, 0x08, 0x0A,
+	0x0D, 0x06, 0x0F, 0x04, 0x10, 0x03, 0x06, 0x07, 0x04, 0x03, 0x05, 0x0A, 0x02, 0x02, 0x05, 0x0F,
+	0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0F, 0x06, 0x0E, 0x07, 0x0E, 0x07, 0x0D, 0x09, 0x0C, 0x0B, 0x0B,
+	0x0B, 0x0A, 0x0B, 0x0B, 0x0A, 0x0D, 0x08, 0x0E, 0x06, 0x0F, 0x06, 0x0F, 0x05, 0x0F, 0x05, 0x0F,
+	0x05, 0x0F, 0x07, 0x0C, 0x0A, 0x0A, 0x05, 0x01, 0x06, 0x06, 0x07, 0x01, 0x12, 0x03, 0x10, 0x05,
+	0x0E, 0x09, 0x08, 0xE3, 0xA7, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05,
+	0x0D, 0x05, 0x0D, 0x05, 0x08, 0x48, 0x05, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05,
+	0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05,
+	0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0D, 0x05,
+	0x0D, 0x06, 0x0D, 0x06, 0x04, 0x02, 0x06, 0x0C, 0x07, 0x0B, 0x08, 0x0A, 0x0A, 0x06, 0xC8, 0xFF,
+	0x99, 0x05, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A,
+	0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A,
+	0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0D, 0x0B, 0x0D, 0x0C,
+	0x0B, 0x07, 0x01, 0x05, 0x0A, 0x08, 0x01, 0x06, 0x08, 0x09, 0x02, 0x07, 0x04, 0x05, 0x01, 0x05,
+	0x02, 0x10, 0x01, 0x05, 0x03, 0x0D, 0x03, 0x05, 0x04, 0x0B, 0x05, 0x04, 0x06, 0x07, 0xFF, 0x14,
+	0xFF, 0xCD, 0x05, 0x10, 0x0B, 0x10, 0x05, 0x01, 0x05, 0x0F, 0x06, 0x01, 0x06, 0x0E, 0x05, 0x03,
+	0x05, 0x0E, 0x05, 0x03, 0x05, 0x0D, 0x06, 0x03, 0x06, 0x0C, 0x05, 0x05, 0x05, 0x0C, 0x05, 0x05,
+	0x06, 0x0A, 0x06, 0x05, 0x06, 0x0A, 0x05, 0x07, 0x05, 0x0A, 0x05, 0x07, 0x06, 0x08, 0x06, 0x07,
+	0x06, 0x08, 0x05, 0x09, 0x05, 0x08, 0x05, 0x09, 0x06, 0x06, 0x06, 0x09, 0x06, 0x06, 0x05, 0x0B,
+	0x05, 0x06, 0x05, 0x0B, 0x06, 0x04, 0x05, 0x0D, 0x05, 0x04, 0x05, 0x0D, 0x05, 0x04, 0x05, 0x0D,
+	0x06, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x0B, 0x11, 0x0A, 0x11,
+	0x0A, 0x11, 0x09, 0x13, 0x08, 0x13, 0x07, 0x15, 0x06, 0xFF, 0x4F, 0xFF, 0xFF, 0xCC, 0x05, 0x0E,
+	0x05, 0x0D, 0x0B, 0x0C, 0x06, 0x0D, 0x0B, 0x0C, 0x06, 0x0D, 0x05, 0x01, 0x05, 0x0C, 0x06, 0x0C,
+	0x06, 0x01, 0x05, 0x0C, 0x07, 0x0B, 0x05, 0x02, 0x06, 0x0A, 0x08, 0x0B, 0x05, 0x03, 0x05, 0x0A,
+	0x08, 0x0B, 0x05, 0x03, 0x05, 0x0A, 0x09, 0x09, 0x05, 0x04, 0x06, 0x08, 0x0A, 0x09, 0x05, 0x05,
+	0x05, 0x08, 0x0A, 0x09, 0x05, 0x05, 0x05, 0x08, 0x04, 0x02, 0x05, 0x07, 0x06, 0x05, 0x06, 0x07,
+	0x04, 0x02, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x05, 0x02, 0x05, 0x07, 0x05, 0x07, 0x05, 0x06,
+	0x05, 0x02, 0x05, 0x07, 0x05, 0x07, 0x05, 0x06, 0x04, 0x04, 0x05, 0x05, 0x05, 0x08, 0x06, 0x05,
+	0x04, 0x04, 0x05, 0x05, 0x05, 0x09, 0x05, 0x04, 0x05, 0x04, 0x05, 0x05, 0x05, 0x09, 0x05, 0x04,
+	0x04, 0x06, 0x05, 0x03, 0x05, 0x0A, 0x06, 0x03, 0x04, 0x06, 0x05, 0x03, 0x05, 0x0B, 0x05, 0x02,
+	0x05, 0x06, 0x05, 0x03, 0x05, 0x0B, 0x05, 0x02, 0x05, 0x07, 0x04, 0x02, 0x05, 0x0C, 0x06, 0x01,
+	0x04, 0x08, 0x05, 0x01, 0x05, 0x0D, 0x05, 0x01, 0x04, 0x08, 0x05, 0x01, 0x05, 0x0D, 0x0A, 0x08,
+	0x05, 0x01, 0x05, 0x0D, 0x0A, 0x09, 0x09, 0x0E, 0x09, 0x0A, 0x09, 0x0F, 0x08, 0x0A, 0x09, 0x0F,
+	0x08, 0x0B, 0x07, 0x10, 0x08, 0x0B, 0x07, 0x11, 0x06, 0x0C, 0x06, 0xFF, 0xFF, 0x03, 0xFF, 0xAA,
+	0x06, 0x0D, 0x05, 0x01, 0x06, 0x0C, 0x06, 0x02, 0x06, 0x0B, 0x05, 0x04, 0x06, 0x09, 0x06, 0x04,
+	0x06, 0x09, 0x05, 0x06, 0x06, 0x07, 0x05, 0x08, 0x05, 0x06, 0x06, 0x08, 0x06, 0x05, 0x05, 0x0A,
+	0x06, 0x03, 0x06, 0x0A, 0x06, 0x02, 0x06, 0x0C, 0x06, 0x01, 0x05, 0x0E, 0x0B, 0x0E, 0x0A, 0x10,
+	0x08, 0x12, 0x07, 0x11, 0x08, 0x11, 0x09, 0x0F, 0x0B, 0x0D, 0x0C, 0x0D, 0x05, 0x02, 0x06, 0x0B,
+	0x05, 0x04, 0x05, 0x0A, 0x06, 0x04, 0x06, 0x09, 0x05, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x08, 0x06, 0x05, 0x05, 0x0A, 0x06, 0x03, 0x06, 0x0A, 0x06, 0x03, 0x05, 0x0C, 0x06, 0x01,
+	0x06, 0x0C, 0x06, 0x01, 0x05, 0x0E, 0x06, 0xFF, 0x2D, 0xFF, 0xCC, 0x05, 0x11, 0x0B, 0x0F, 0x0C,
+	0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x06, 0x0D, 0x06, 0x03, 0x05, 0x0D, 0x05, 0x04, 0x06,
+	0x0C, 0x05, 0x04, 0x06, 0x0B, 0x06, 0x05, 0x05, 0x0B, 0x05, 0x06, 0x06, 0x0A, 0x05, 0x06, 0x06,
+	0x09, 0x06, 0x07, 0x05, 0x09, 0x05, 0x08, 0x06, 0x08, 0x05, 0x09, 0x05, 0x07, 0x06, 0x09, 0x05,
+	0x07, 0x05, 0x0A, 0x06, 0x06, 0x05, 0x0B, 0x05, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x05, 0x0C, 0x06,
+	0x04, 0x05, 0x0D, 0x05, 0x03, 0x05, 0x0E, 0x06, 0x02, 0x05, 0x0F, 0x05, 0x02, 0x05, 0x0F, 0x05,
+	0x01, 0x05, 0x10, 0x0B, 0x11, 0x0A, 0x11, 0x09, 0x12, 0x09, 0x13, 0x07, 0x14, 0x07, 0x15, 0x06,
+	0x15, 0x05, 0x16, 0x05, 0x15, 0x06, 0x15, 0x05, 0x16, 0x05, 0x15, 0x06, 0x15, 0x05, 0x15, 0x06,
+	0x15, 0x06, 0x15, 0x05, 0x15, 0x06, 0x15, 0x05, 0x0F, 0xFF, 0x56, 0x12, 0x01, 0x13, 0x01, 0x13,
+	0x02, 0x12, 0x0E, 0x06, 0x0E, 0x05, 0x0E, 0x06, 0x0D, 0x06, 0x0E, 0x05, 0x0E, 0x06, 0x0E, 0x05,
+	0x0E, 0x05, 0x0E, 0x06, 0x0E, 0x05, 0x0E, 0x06, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x06, 0x0E, 0x05,
+	0x0E, 0x06, 0x0D, 0x06, 0x0E, 0x05, 0x0E, 0x06, 0x0E, 0x05, 0x0E, 0x06, 0x0D, 0x06, 0x0E, 0x50,
+	0xF0, 0x36, 0x06, 0x08, 0x07, 0x07, 0x08, 0x06, 0x09, 0x06, 0x05, 0x0A, 0x05, 0x09, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x09, 0x05, 0x0A, 0x05, 0x08,
+	0x06, 0x07, 0x07, 0x08, 0x06, 0x09, 0x06, 0x09, 0x07, 0x0A, 0x06, 0x0B, 0x05, 0x0A, 0x05, 0x0B,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0B, 0x05, 0x0A, 0x05, 0x0A, 0x09, 0x07, 0x08, 0x08, 0x07, 0x09, 0x06, 0x1E, 0x0A, 0xFF,
+	0x1E, 0x2D, 0x06, 0x09, 0x07, 0x08, 0x08, 0x07, 0x09, 0x0A, 0x05, 0x0A, 0x05, 0x0B, 0x04, 0x0B,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0B, 0x05, 0x0A,
+	0x06, 0x0A, 0x08, 0x09, 0x06, 0x09, 0x06, 0x08, 0x07, 0x07, 0x06, 0x08, 0x05, 0x0A, 0x05, 0x0A,
+	0x04, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x04, 0x0B,
+	0x04, 0x0A, 0x05, 0x0A, 0x05, 0x06, 0x09, 0x06, 0x08, 0x07, 0x07, 0x08, 0x06, 0x27, 0xFF, 0x56,
+	0x06, 0x14, 0x0A, 0x0B, 0x04, 0x02, 0x0C, 0x0A, 0x04, 0x01, 0x0E, 0x09, 0x04, 0x01, 0x05, 0x04,
+	0x06, 0x08, 0x09, 0x06, 0x06, 0x06, 0x09, 0x08, 0x06, 0x04, 0x05, 0x01, 0x04, 0x09, 0x0E, 0x01,
+	0x04, 0x0A, 0x0C, 0x02, 0x04, 0x0B, 0x0A, 0x14, 0x06, 0xFF, 0xFF, 0xFF, 0xF8,
+};
+
+/**
+ * @brief 59 pixels height compressed char info array.
+ */
+char_info_t font59_rle_info[] = {
+	{2, 0}, 		/*   */
+	{7, 1}, 		/* ! */
+	{17, 76}, 		/* " */
+	{30, 137}, 		/* # */
+	{26, 283}, 		/* $ */
+	{40, 406}, 		/* % */
+	{38, 622}, 		/* & */
+	{6, 806}, 		/* ' */
+	{11, 833}, 		/* ( */
+	{11, 944}, 		/* ) */
+	{22, 1055}, 		/* * */
+	{28, 1138}, 		/* + */
+	{11, 1195}, 		/* , */
+	{15, 1229}, 		/* - */
+	{7, 1234}, 		/* . */
+	{24, 1244}, 		/* / */
+	{28, 1355}, 		/* 0 */
+	{23, 1479}, 		/* 1 */
+	{25, 1565}, 		/* 2 */
+	{25, 1647}, 		/* 3 */
+	{29, 1747}, 		/* 4 */
+	{26, 1869}, 		/* 5 */
+	{27, 1959}, 		/* 6 */
+	{26, 2077}, 		/* 7 */
+	{27, 2151}, 		/* 8 */
+	{27, 2283}, 		/* 9 */
+	{7, 2401}, 		/* : */
+	{10, 2414}, 		/* ; */
+	{27, 2461}, 		/* < */
+	{26, 2524}, 		/* = */
+	{27, 2533}, 		/* > */
+	{22, 2596}, 		/* ? */
+	{46, 2683}, 		/* @ */
+	{35, 2941}, 		/* A */
+	{27, 3080}, 		/* B */
+	{29, 3206}, 		/* C */
+	{31, 3308}, 		/* D */
+	{23, 3430}, 		/* E */
+	{21, 3500}, 		/* F */
+	{33, 3572}, 		/* G */
+	{29, 3690}, 		/* H */
+	{5, 3764}, 		/* I */
+	{15, 3767}, 		/* J */
+	{26, 3850}, 		/* K */
+	{21, 4006}, 		/* L */
+	{44, 4081}, 		/* M */
+	{31, 4291}, 		/* N */
+	{36, 4425}, 		/* O */
+	{25, 4549}, 		/* P */
+	{41, 4649}, 		/* Q */
+	{27, 4813}, 		/* R */
+	{25, 4955}, 		/* S */
+	{29, 5051}, 		/* T */
+	{30, 5125}, 		/* U */
+	{34, 5221}, 		/* V */
+	{53, 5365}, 		/* W */
+	{30, 5641}, 		/* X */
+	{29, 5787}, 		/* Y */
+	{27, 5905}, 		/* Z */
+	{11, 5981}, 		/* [ */
+	{25, 6078}, 		/* \ */
+	{11, 6189}, 		/* ] */
+	{25, 6286}, 		/* ^ */
+	{32, 6367}, 		/* _ */
+	{10, 6375}, 		/* ` */
+	{23, 6397}, 		/* a */
+	{26, 6488}, 		/* b */
+	{22, 6620}, 		/* c */
+	{26, 6700}, 		/* d */
+	{26, 6832}, 		/* e */
+	{19, 6909}, 		/* f */
+	{27, 7000}, 		/* g */
+	{24, 7126}, 		/* h */
+	{6, 7230}, 		/* i */
+	{12, 7297}, 		/* j */
+	{23, 7394}, 		/* k */
+	{5, 7536}, 		/* l */
+	{42, 7539}, 		/* m */
+	{24, 7687}, 		/* n */
+	{28, 7768}, 		/* o */
+	{26, 7865}, 		/* p */
+	{26, 7995}, 		/* q */
+	{16, 8124}, 		/* r */
+	{20, 8188}, 		/* s */
+	{18, 8260}, 		/* t */
+	{24, 8335}, 		/* u */
+	{27, 8416}, 		/* v */
+	{42, 8523}, 		/* w */
+	{25, 8718}, 		/* x */
+	{27, 8825}, 		/* y */
+	{20, 8953}, 		/* z */
+	{15, 9009}, 		/* { */
+	{5, 9118}, 		/* | */
+	{15, 9121}, 		/* } */
+	{28, 9230}, 		/* ~ */
+};
+
+Font_t font_59_rle = {
+	59,
+	font59_rle_info,
+	font59_rle_data,
+	1
+};
+
+/**
+ * @brief 89 pixels height compressed data array.
+ */
+const uint8_t font89_rle_data[] = {
+	0xB2, 0x48, 0x07, 0x02, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01,
+	0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03,
+	0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03,
+	0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03,
+	0x07, 0x03, 0x06, 0x40, 0x06, 0x03, 0x09, 0x01, 0x09, 0x01, 0x27, 0x01, 0x09, 0x01, 0x09, 0x01,
+	0x09, 0x02, 0x06, 0xA2, 0x90, 0x07, 0x0A, 0x0F, 0x08, 0x10, 0x08, 0x0F, 0x09, 0x0F, 0x09, 0x0F,
+	0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E,
+	0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x0A, 0x06, 0x01, 0x07, 0x0A, 0x06, 0x01, 0x07, 0x0A, 0x06,
+	0x01, 0x07, 0x0A, 0x06, 0x01, 0x07, 0x0A, 0x06, 0x01, 0x07, 0x0A, 0x06, 0x02, 0x06, 0x0A, 0x06,
+	0x02, 0x05, 0x0B, 0x06, 0x02, 0x05, 0x0C, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0xFF, 0xF2,
+	0x06, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0C, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x06, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x0A,
+	0x28, 0x03, 0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x03, 0x29, 0x09, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x06, 0x0E, 0x06, 0x11, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x09, 0x29, 0x03, 0x29, 0x03,
+	0x29, 0x03, 0x29, 0x03, 0x29, 0x03, 0x29, 0x0A, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x06, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x06, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11,
+	0x07, 0x0D, 0x07, 0x11, 0x07, 0x0D, 0x07, 0x11, 0x06, 0x0E, 0x06, 0xFF, 0xFF, 0xFB, 0x14, 0x06,
+	0x21, 0x06, 0x21, 0x06, 0x21, 0x06, 0x20, 0x07, 0x20, 0x07, 0x20, 0x07, 0x20, 0x06, 0x21, 0x06,
+	0x21, 0x06, 0x21, 0x06, 0x1D, 0x0C, 0x17, 0x14, 0x11, 0x18, 0x0E, 0x1B, 0x0A, 0x1D, 0x09, 0x1F,
+	0x07, 0x20, 0x07, 0x0C, 0x0A, 0x0A, 0x06, 0x0A, 0x10, 0x07, 0x06, 0x09, 0x13, 0x05, 0x05, 0x09,
+	0x16, 0x02, 0x06, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1E, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x08,
+	0x1F, 0x08, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x0A, 0x1E, 0x0B, 0x1C, 0x0C, 0x1C, 0x0D, 0x1B, 0x0F,
+	0x19, 0x11, 0x17, 0x12, 0x16, 0x14, 0x15, 0x14, 0x15, 0x14, 0x15, 0x13, 0x17, 0x12, 0x17, 0x11,
+	0x19, 0x0E, 0x1B, 0x0D, 0x1C, 0x0C, 0x1D, 0x0A, 0x1E, 0x0A, 0x1D, 0x0A, 0x1E, 0x09, 0x1E, 0x09,
+	0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1E, 0x09, 0x1E, 0x09, 0x1D, 0x09,
+	0x02, 0x02, 0x19, 0x0A, 0x01, 0x05, 0x16, 0x0A, 0x02, 0x08, 0x12, 0x0B, 0x02, 0x0C, 0x0B, 0x0D,
+	0x03, 0x23, 0x04, 0x22, 0x06, 0x20, 0x08, 0x1E, 0x0A, 0x1B, 0x0F, 0x15, 0x17, 0x0C, 0x1D, 0x06,
+	0x20, 0x07, 0x20, 0x07, 0x20, 0x07, 0x20, 0x06, 0x21, 0x06, 0x21, 0x06, 0x21, 0x06, 0x21, 0x06,
+	0x21, 0x06, 0x21, 0x05, 0xFF, 0x01, 0xFF, 0xFF, 0x9F, 0x06, 0x10, 0x08, 0x1F, 0x07, 0x0E, 0x0D,
+	0x1B, 0x07, 0x0D, 0x10, 0x1A, 0x07, 0x0C, 0x12, 0x18, 0x07, 0x0C, 0x14, 0x16, 0x07, 0x0D, 0x07,
+	0x06, 0x08, 0x15, 0x07, 0x0C, 0x07, 0x08, 0x07, 0x14, 0x07, 0x0C, 0x07, 0x0A, 0x07, 0x12, 0x07,
+	0x0D, 0x07, 0x0A, 0x07, 0x11, 0x08, 0x0D, 0x06, 0x0C, 0x06, 0x11, 0x07, 0x0E, 0x06, 0x0C, 0x07,
+	0x0F, 0x07, 0x0E, 0x07, 0x0C, 0x07, 0x0E, 0x08, 0x0E, 0x07, 0x0C, 0x07, 0x0E, 0x07, 0x0F, 0x07,
+	0x0C, 0x07, 0x0D, 0x07, 0x10, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x11, 0x07, 0x0C, 0x07, 0x0C, 0x07,
+	0x11, 0x07, 0x0C, 0x07, 0x0B, 0x07, 0x12, 0x07, 0x0C, 0x07, 0x0A, 0x07, 0x13, 0x07, 0x0C, 0x07,
+	0x0A, 0x07, 0x13, 0x07, 0x0C, 0x07, 0x09, 0x07, 0x14, 0x07, 0x0C, 0x07, 0x08, 0x07, 0x15, 0x07,
+	0x0C, 0x06, 0x09, 0x07, 0x16, 0x06, 0x0C, 0x06, 0x08, 0x07, 0x17, 0x07, 0x0A, 0x07, 0x07, 0x07,
+	0x18, 0x07, 0x0A, 0x07, 0x06, 0x08, 0x19, 0x07, 0x08, 0x07, 0x07, 0x07, 0x1A, 0x08, 0x06, 0x07,
+	0x07, 0x07, 0x1C, 0x14, 0x06, 0x07, 0x1E, 0x12, 0x07, 0x07, 0x1F, 0x10, 0x07, 0x07, 0x21, 0x0D,
+	0x08, 0x07, 0x0B, 0x08, 0x12, 0x08, 0x0A, 0x07, 0x09, 0x0D, 0x20, 0x07, 0x08, 0x10, 0x1E, 0x07,
+	0x08, 0x12, 0x1D, 0x07, 0x07, 0x14, 0x1B, 0x07, 0x08, 0x07, 0x06, 0x08, 0x19, 0x07, 0x08, 0x07,
+	0x08, 0x07, 0x18, 0x08, 0x07, 0x07, 0x0A, 0x07, 0x17, 0x07, 0x08, 0x07, 0x0A, 0x07, 0x16, 0x07,
+	0x09, 0x06, 0x0C, 0x06, 0x15, 0x07, 0x0A, 0x06, 0x0C, 0x07, 0x14, 0x07, 0x09, 0x07, 0x0C, 0x07,
+	0x13, 0x07, 0x0A, 0x07, 0x0C, 0x07, 0x12, 0x07, 0x0B, 0x07, 0x0C, 0x07, 0x12, 0x07, 0x0B, 0x07,
+	0x0C, 0x07, 0x11, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x10, 0x07, 0x0D, 0x07, 0x0C, 0x07, 0x10, 0x07,
+	0x0D, 0x07, 0x0C, 0x07, 0x0F, 0x07, 0x0E, 0x07, 0x0C, 0x07, 0x0E, 0x07, 0x0F, 0x07, 0x0C, 0x07,
+	0x0D, 0x08, 0x0F, 0x07, 0x0C, 0x07, 0x0D, 0x07, 0x10, 0x07, 0x0C, 0x06, 0x0D, 0x07, 0x12, 0x06,
+	0x0C, 0x06, 0x0C, 0x07, 0x13, 0x07, 0x0A, 0x07, 0x0C, 0x07, 0x13, 0x07, 0x0A, 0x07, 0x0B, 0x07,
+	0x15, 0x07, 0x08, 0x07, 0x0B, 0x07, 0x16, 0x08, 0x06, 0x07, 0x0C, 0x07, 0x17, 0x14, 0x0B, 0x07,
+	0x19, 0x12, 0x0B, 0x07, 0x1B, 0x10, 0x0C, 0x07, 0x1C, 0x0D, 0x0D, 0x07, 0x20, 0x08, 0x0F, 0x06,
+	0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0x9B, 0x0B, 0x2A, 0x12, 0x24, 0x15, 0x21, 0x19, 0x1E, 0x1B, 0x1C,
+	0x1D, 0x1A, 0x0B, 0x08, 0x0B, 0x1A, 0x09, 0x0C, 0x0A, 0x18, 0x09, 0x0E, 0x09, 0x18, 0x08, 0x10,
+	0x09, 0x16, 0x09, 0x10, 0x09, 0x16, 0x08, 0x12, 0x08, 0x16, 0x08, 0x12, 0x08, 0x16, 0x08, 0x12,
+	0x08, 0x16, 0x08, 0x12, 0x08, 0x16, 0x08, 0x11, 0x09, 0x16, 0x08, 0x11, 0x09, 0x16, 0x08, 0x11,
+	0x08, 0x17, 0x09, 0x0F, 0x09, 0x17, 0x09, 0x0E, 0x09, 0x19, 0x09, 0x0C, 0x0A, 0x19, 0x09, 0x0B,
+	0x0A, 0x1B, 0x09, 0x09, 0x0A, 0x1C, 0x09, 0x08, 0x0A, 0x1E, 0x09, 0x05, 0x0B, 0x1F, 0x0A, 0x03,
+	0x0B, 0x21, 0x09, 0x01, 0x0C, 0x23, 0x13, 0x25, 0x12, 0x27, 0x0F, 0x2A, 0x0D, 0x29, 0x0D, 0x14,
+	0x07, 0x0F, 0x0E, 0x14, 0x07, 0x0D, 0x11, 0x13, 0x07, 0x0C, 0x13, 0x12, 0x07, 0x0B, 0x15, 0x11,
+	0x07, 0x0A, 0x0A, 0x02, 0x0B, 0x0F, 0x08, 0x09, 0x0A, 0x04, 0x0B, 0x0E, 0x08, 0x08, 0x0A, 0x06,
+	0x0B, 0x0D, 0x08, 0x08, 0x09, 0x08, 0x0B, 0x0C, 0x08, 0x07, 0x09, 0x0A, 0x0A, 0x0C, 0x07, 0x08,
+	0x08, 0x0C, 0x0A, 0x0B, 0x07, 0x07, 0x09, 0x0D, 0x0A, 0x09, 0x08, 0x07, 0x08, 0x0F, 0x0A, 0x08,
+	0x08, 0x07, 0x08, 0x10, 0x0A, 0x07, 0x07, 0x07, 0x09, 0x11, 0x0A, 0x05, 0x08, 0x07, 0x09, 0x12,
+	0x0A, 0x04, 0x08, 0x07, 0x08, 0x14, 0x0B, 0x01, 0x08, 0x08, 0x08, 0x15, 0x13, 0x08, 0x09, 0x15,
+	0x11, 0x09, 0x09, 0x16, 0x10, 0x09, 0x09, 0x17, 0x0E, 0x0A, 0x09, 0x18, 0x0C, 0x0C, 0x09, 0x18,
+	0x0C, 0x0B, 0x09, 0x18, 0x0D, 0x0A, 0x0A, 0x15, 0x10, 0x0A, 0x0A, 0x13, 0x13, 0x08, 0x0C, 0x0F,
+	0x16, 0x08, 0x0E, 0x08, 0x1C, 0x07, 0x23, 0x02, 0x0F, 0x05, 0x20, 0x05, 0x0E, 0x06, 0x1E, 0x08,
+	0x0C, 0x07, 0x1B, 0x0B, 0x0B, 0x09, 0x17, 0x0F, 0x09, 0x0B, 0x13, 0x12, 0x08, 0x0F, 0x0B, 0x18,
+	0x06, 0xFF, 0xFF, 0xFF, 0x83, 0x30, 0x07, 0x01, 0x1F, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01,
+	0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01,
+	0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x02, 0x06, 0x02, 0x06, 0x02,
+	0x05, 0xFF, 0xD3, 0x60, 0x06, 0x0A, 0x07, 0x0A, 0x07, 0x09, 0x07, 0x0A, 0x07, 0x09, 0x07, 0x0A,
+	0x07, 0x09, 0x08, 0x09, 0x07, 0x0A, 0x07, 0x09, 0x07, 0x0A, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0A,
+	0x07, 0x09, 0x08, 0x09, 0x08, 0x09, 0x07, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x07, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x0A,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x07, 0x0A, 0x08, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x08, 0x09,
+	0x08, 0x0A, 0x07, 0x0A, 0x08, 0x09, 0x08, 0x0A, 0x07, 0x0A, 0x08, 0x0A, 0x07, 0x0A, 0x07, 0x0B,
+	0x07, 0x0A, 0x07, 0x0B, 0x07, 0x0A, 0x07, 0x0B, 0x06, 0x11, 0x55, 0x06, 0x0B, 0x07, 0x0A, 0x07,
+	0x0B, 0x07, 0x0A, 0x07, 0x0B, 0x07, 0x0A, 0x07, 0x0A, 0x08, 0x0A, 0x07, 0x0A, 0x08, 0x0A, 0x07,
+	0x0A, 0x07, 0x0A, 0x08, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x08, 0x09, 0x08, 0x0A, 0x07, 0x0A, 0x08,
+	0x09, 0x08, 0x09, 0x08, 0x0A, 0x07, 0x0A, 0x08, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x07, 0x0A, 0x08,
+	0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08,
+	0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08,
+	0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x08, 0x09,
+	0x08, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x09, 0x08,
+	0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x07, 0x09, 0x08,
+	0x09, 0x08, 0x09, 0x08, 0x09, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0A, 0x07, 0x09, 0x08, 0x09, 0x07,
+	0x09, 0x08, 0x09, 0x07, 0x0A, 0x07, 0x09, 0x07, 0x0A, 0x07, 0x09, 0x08, 0x09, 0x07, 0x0A, 0x06,
+	0x1C, 0xD4, 0x06, 0x1A, 0x07, 0x1A, 0x07, 0x1A, 0x07, 0x1B, 0x06, 0x1B, 0x06, 0x10, 0x02, 0x09,
+	0x06, 0x09, 0x01, 0x05, 0x04, 0x08, 0x06, 0x08, 0x03, 0x04, 0x05, 0x07, 0x05, 0x07, 0x06, 0x02,
+	0x08, 0x05, 0x05, 0x06, 0x07, 0x02, 0x09, 0x04, 0x05, 0x04, 0x15, 0x03, 0x05, 0x03, 0x0B, 0x01,
+	0x0C, 0x01, 0x05, 0x02, 0x0B, 0x04, 0x1B, 0x09, 0x16, 0x0D, 0x12, 0x11, 0x0D, 0x16, 0x09, 0x16,
+	0x0D, 0x12, 0x12, 0x0D, 0x16, 0x08, 0x1B, 0x04, 0x0C, 0x01, 0x05, 0x02, 0x0B, 0x01, 0x0B, 0x03,
+	0x05, 0x03, 0x0B, 0x01, 0x09, 0x04, 0x05, 0x04, 0x0A, 0x01, 0x08, 0x05, 0x05, 0x06, 0x07, 0x03,
+	0x05, 0x07, 0x05, 0x07, 0x06, 0x03, 0x04, 0x08, 0x06, 0x07, 0x04, 0x05, 0x02, 0x09, 0x06, 0x09,
+	0x01, 0x11, 0x06, 0x1B, 0x06, 0x1A, 0x07, 0x1A, 0x07, 0x1A, 0x07, 0x1B, 0x06, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xB1, 0x06, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23,
+	0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23,
+	0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x13, 0x28, 0x02,
+	0x28, 0x01, 0x29, 0x01, 0x53, 0x02, 0x28, 0x02, 0x28, 0x12, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23,
+	0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23,
+	0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x23, 0x07, 0x24, 0x06, 0xFF,
+	0xFF, 0xFF, 0xB1, 0xFF, 0xFF, 0xFF, 0x9E, 0x06, 0x08, 0x08, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+	0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x08, 0x07, 0x08, 0x06, 0x08,
+	0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x08, 0x06, 0x08, 0x07,
+	0x08, 0x06, 0x08, 0x06, 0x09, 0x05, 0x46, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0x15, 0x01, 0x5C, 0x01,
+	0x15, 0xFF, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0x66, 0x06, 0x03, 0x08, 0x01, 0x46, 0x01, 0x08, 0x03,
+	0x06, 0xAC, 0x8A, 0x06, 0x1D, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08,
+	0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1B, 0x08, 0x1C, 0x08,
+	0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08,
+	0x1C, 0x08, 0x1B, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08,
+	0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1B, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08,
+	0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1B, 0x08, 0x1C, 0x08, 0x1C, 0x08, 0x1B, 0x08,
+	0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1B, 0x08,
+	0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07,
+	0x1C, 0x08, 0x1C, 0x08, 0x1B, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07,
+	0x1C, 0x08, 0x1C, 0x08, 0x1C, 0x07, 0x1C, 0x08, 0x1C, 0x08, 0x1B, 0x08, 0x1C, 0x08, 0x1C, 0x07,
+	0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x06, 0xAD, 0xFF, 0xC0, 0x0A, 0x1D, 0x12, 0x17, 0x16, 0x14, 0x18,
+	0x12, 0x1B, 0x0E, 0x1E, 0x0D, 0x1E, 0x0C, 0x0C, 0x07, 0x0D, 0x0A, 0x0B, 0x0C, 0x0B, 0x08, 0x0B,
+	0x0E, 0x0A, 0x08, 0x0A, 0x10, 0x0A, 0x06, 0x0A, 0x11, 0x0A, 0x06, 0x09, 0x13, 0x0A, 0x05, 0x09,
+	0x13, 0x0A, 0x04, 0x09, 0x15, 0x09, 0x04, 0x09, 0x15, 0x09, 0x04, 0x09, 0x16, 0x09, 0x02, 0x09,
+	0x17, 0x09, 0x02, 0x09, 0x17, 0x09, 0x02, 0x09, 0x17, 0x09, 0x02, 0x09, 0x17, 0x09, 0x02, 0x09,
+	0x17, 0x09, 0x02, 0x08, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12,
+	0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12,
+	0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x12, 0x19, 0x08, 0x02, 0x09, 0x17, 0x09, 0x02, 0x09,
+	0x17, 0x09, 0x02, 0x09, 0x17, 0x09, 0x02, 0x09, 0x17, 0x09, 0x02, 0x09, 0x17, 0x09, 0x02, 0x09,
+	0x16, 0x09, 0x04, 0x09, 0x15, 0x09, 0x04, 0x09, 0x15, 0x09, 0x04, 0x0A, 0x13, 0x09, 0x05, 0x0A,
+	0x13, 0x09, 0x06, 0x0A, 0x11, 0x0A, 0x06, 0x0A, 0x10, 0x0A, 0x08, 0x0A, 0x0E, 0x0B, 0x08, 0x0B,
+	0x0C, 0x0B, 0x0A, 0x0D, 0x07, 0x0C, 0x0C, 0x1E, 0x0D, 0x1E, 0x0E, 0x1B, 0x12, 0x18, 0x14, 0x16,
+	0x17, 0x12, 0x1D, 0x0A, 0xFF, 0xFF, 0xC3, 0xFF, 0xA8, 0x08, 0x1B, 0x0A, 0x1A, 0x0B, 0x18, 0x0D,
+	0x16, 0x0F, 0x15, 0x10, 0x13, 0x12, 0x11, 0x14, 0x10, 0x0B, 0x01, 0x09, 0x0E, 0x0B, 0x03, 0x09,
+	0x0D, 0x0B, 0x04, 0x09, 0x0D, 0x09, 0x06, 0x09, 0x0D, 0x07, 0x08, 0x09, 0x0D, 0x06, 0x09, 0x09,
+	0x0D, 0x04, 0x0B, 0x09, 0x0E, 0x01, 0x0D, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09,
+	0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09,
+	0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09,
+	0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09,
+	0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09,
+	0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x0F, 0x22, 0x02, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24,
+	0x02, 0x22, 0xFF, 0xFF, 0x78, 0xFF, 0x89, 0x0B, 0x18, 0x11, 0x12, 0x16, 0x0E, 0x19, 0x0C, 0x1B,
+	0x0A, 0x1D, 0x08, 0x1F, 0x07, 0x0B, 0x08, 0x0D, 0x06, 0x08, 0x0D, 0x0B, 0x06, 0x06, 0x10, 0x0B,
+	0x05, 0x04, 0x13, 0x0A, 0x05, 0x03, 0x15, 0x09, 0x1D, 0x0A, 0x1C, 0x0A, 0x1D, 0x09, 0x1D, 0x09,
+	0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1C, 0x09, 0x1D, 0x09,
+	0x1D, 0x09, 0x1C, 0x09, 0x1D, 0x09, 0x1C, 0x0A, 0x1C, 0x09, 0x1C, 0x0A, 0x1C, 0x09, 0x1C, 0x09,
+	0x1C, 0x0A, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A, 0x1C, 0x09,
+	0x1C, 0x09, 0x1C, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A,
+	0x1B, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A, 0x1B, 0x0A, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x25,
+	0x01, 0xBE, 0x01, 0x24, 0xFF, 0xFF, 0x89, 0xFF, 0x8A, 0x0A, 0x18, 0x12, 0x12, 0x16, 0x0E, 0x19,
+	0x0C, 0x1B, 0x0A, 0x1D, 0x08, 0x1F, 0x07, 0x0B, 0x07, 0x0D, 0x07, 0x08, 0x0C, 0x0C, 0x06, 0x06,
+	0x0F, 0x0B, 0x06, 0x04, 0x12, 0x0A, 0x06, 0x02, 0x15, 0x0A, 0x1C, 0x0A, 0x1D, 0x09, 0x1D, 0x09,
+	0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1C, 0x09, 0x1D, 0x09, 0x1C, 0x0A,
+	0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x0A, 0x1A, 0x0B, 0x18, 0x0D, 0x0F, 0x15, 0x10, 0x14, 0x12, 0x13,
+	0x13, 0x17, 0x0F, 0x19, 0x0E, 0x19, 0x19, 0x0E, 0x1B, 0x0C, 0x1C, 0x0B, 0x1D, 0x0A, 0x1D, 0x0A,
+	0x1C, 0x0A, 0x1D, 0x09, 0x1D, 0x0A, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09,
+	0x1D, 0x09, 0x1D, 0x09, 0x1C, 0x09, 0x1D, 0x09, 0x01, 0x02, 0x19, 0x0A, 0x01, 0x04, 0x16, 0x0A,
+	0x02, 0x06, 0x13, 0x0B, 0x02, 0x09, 0x0F, 0x0B, 0x03, 0x0C, 0x09, 0x0E, 0x03, 0x22, 0x04, 0x21,
+	0x06, 0x1F, 0x08, 0x1C, 0x0C, 0x19, 0x10, 0x13, 0x17, 0x0C, 0xFF, 0xFF, 0x71, 0xFF, 0xFC, 0x0B,
+	0x20, 0x0D, 0x1E, 0x0E, 0x1E, 0x0E, 0x1D, 0x0F, 0x1D, 0x0F, 0x1C, 0x10, 0x1B, 0x11, 0x1B, 0x07,
+	0x01, 0x09, 0x1A, 0x08, 0x01, 0x09, 0x1A, 0x07, 0x02, 0x09, 0x19, 0x07, 0x03, 0x09, 0x19, 0x07,
+	0x03, 0x09, 0x18, 0x07, 0x04, 0x09, 0x17, 0x08, 0x04, 0x09, 0x17, 0x07, 0x05, 0x09, 0x16, 0x08,
+	0x05, 0x09, 0x16, 0x07, 0x06, 0x09, 0x15, 0x07, 0x07, 0x09, 0x15, 0x07, 0x07, 0x09, 0x14, 0x07,
+	0x08, 0x09, 0x13, 0x08, 0x08, 0x09, 0x13, 0x07, 0x09, 0x09, 0x12, 0x08, 0x09, 0x09, 0x12, 0x07,
+	0x0A, 0x09, 0x11, 0x08, 0x0A, 0x09, 0x11, 0x07, 0x0B, 0x09, 0x10, 0x07, 0x0C, 0x09, 0x0F, 0x08,
+	0x0C, 0x09, 0x0F, 0x07, 0x0D, 0x09, 0x0E, 0x08, 0x0D, 0x09, 0x0E, 0x07, 0x0E, 0x09, 0x0D, 0x08,
+	0x0E, 0x09, 0x0D, 0x07, 0x0F, 0x09, 0x0C, 0x07, 0x10, 0x09, 0x0B, 0x08, 0x10, 0x09, 0x0B, 0x07,
+	0x11, 0x09, 0x0A, 0x08, 0x11, 0x09, 0x0A, 0x07, 0x12, 0x09, 0x09, 0x08, 0x12, 0x09, 0x09, 0x2B,
+	0x01, 0x2B, 0x01, 0xAF, 0x02, 0x2A, 0x1B, 0x09, 0x23, 0x09, 0x23, 0x09, 0x23, 0x09, 0x23, 0x09,
+	0x23, 0x09, 0x23, 0x09, 0x23, 0x09, 0x23, 0x09, 0x23, 0x09, 0x23, 0x09, 0x23, 0x09, 0x23, 0x09,
+	0x24, 0x07, 0xFF, 0xFF, 0xF8, 0xFF, 0xA7, 0x1D, 0x08, 0x1F, 0x07, 0x1F, 0x07, 0x1F, 0x07, 0x1F,
+	0x07, 0x1F, 0x07, 0x1E, 0x08, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09,
+	0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09,
+	0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x15, 0x11, 0x19, 0x0D, 0x1B, 0x0B, 0x1D, 0x09, 0x1E,
+	0x08, 0x1F, 0x09, 0x02, 0x0D, 0x0F, 0x1A, 0x0C, 0x1C, 0x0B, 0x1C, 0x0A, 0x1D, 0x0A, 0x1D, 0x09,
+	0x1D, 0x09, 0x1D, 0x0A, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09, 0x1D, 0x09,
+	0x1D, 0x09, 0x1D, 0x09, 0x1C, 0x0A, 0x1C, 0x09, 0x1D, 0x09, 0x1C, 0x0A, 0x1B, 0x0A, 0x02, 0x03,
+	0x16, 0x0B, 0x02, 0x04, 0x14, 0x0B, 0x03, 0x07, 0x10, 0x0C, 0x03, 0x0A, 0x0A, 0x0E, 0x04, 0x21,
+	0x05, 0x20, 0x06, 0x1F, 0x08, 0x1C, 0x0C, 0x18, 0x11, 0x13, 0x17, 0x0B, 0xFF, 0xFF, 0x73, 0xFF,
+	0xA5, 0x0B, 0x19, 0x13, 0x13, 0x16, 0x10, 0x19, 0x0D, 0x1B, 0x0C, 0x1C, 0x0B, 0x0D, 0x09, 0x07,
+	0x0A, 0x0C, 0x0F, 0x03, 0x0A, 0x0A, 0x1D, 0x0A, 0x1D, 0x0A, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09,
+	0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x09, 0x1F, 0x09,
+	0x1F, 0x09, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x09, 0x09, 0x0A, 0x0C, 0x09, 0x05, 0x11, 0x09, 0x09,
+	0x03, 0x15, 0x07, 0x09, 0x01, 0x19, 0x05, 0x24, 0x04, 0x25, 0x03, 0x11, 0x08, 0x0C, 0x03, 0x0D,
+	0x0E, 0x0B, 0x02, 0x0B, 0x11, 0x0A, 0x02, 0x0A, 0x13, 0x0A, 0x01, 0x09, 0x15, 0x09, 0x01, 0x09,
+	0x15, 0x09, 0x01, 0x09, 0x15, 0x13, 0x16, 0x12, 0x16, 0x12, 0x16, 0x12, 0x16, 0x12, 0x16, 0x09,
+	0x01, 0x08, 0x16, 0x09, 0x01, 0x09, 0x15, 0x09, 0x01, 0x09, 0x15, 0x09, 0x01, 0x09, 0x15, 0x09,
+	0x01, 0x09, 0x14, 0x0A, 0x01, 0x0A, 0x13, 0x09, 0x03, 0x09, 0x13, 0x09, 0x03, 0x09, 0x12, 0x0A,
+	0x03, 0x0A, 0x11, 0x09, 0x05, 0x09, 0x10, 0x0A, 0x05, 0x0A, 0x0E, 0x0A, 0x07, 0x0A, 0x0C, 0x0B,
+	0x07, 0x0D, 0x06, 0x0D, 0x09, 0x1E, 0x0B, 0x1C, 0x0D, 0x1A, 0x0F, 0x18, 0x11, 0x15, 0x15, 0x11,
+	0x1A, 0x0B, 0xFF, 0xFF, 0x91, 0xFF, 0xBA, 0x26, 0x01, 0xC8, 0x01, 0x27, 0x1F, 0x08, 0x20, 0x08,
+	0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08,
+	0x20, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09,
+	0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08,
+	0x1F, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09,
+	0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1F, 0x08,
+	0x1F, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09,
+	0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1F, 0x08, 0xFF, 0xFF, 0xC2, 0xFF, 0xAA, 0x0C, 0x1A, 0x12,
+	0x15, 0x16, 0x11, 0x1A, 0x0E, 0x1C, 0x0C, 0x1E, 0x0A, 0x0C, 0x08, 0x0C, 0x08, 0x0B, 0x0C, 0x0A,
+	0x08, 0x09, 0x10, 0x09, 0x06, 0x0A, 0x10, 0x09, 0x06, 0x09, 0x12, 0x09, 0x04, 0x0A, 0x12, 0x09,
+	0x04, 0x09, 0x14, 0x08, 0x04, 0x09, 0x14, 0x08, 0x04, 0x09, 0x14, 0x08, 0x04, 0x09, 0x14, 0x08,
+	0x04, 0x09, 0x14, 0x08, 0x04, 0x09, 0x14, 0x08, 0x04, 0x0A, 0x12, 0x08, 0x06, 0x09, 0x12, 0x08,
+	0x06, 0x0A, 0x10, 0x09, 0x06, 0x0B, 0x0F, 0x08, 0x08, 0x0B, 0x0D, 0x08, 0x0A, 0x0B, 0x0B, 0x09,
+	0x0A, 0x0C, 0x08, 0x0A, 0x0C, 0x0D, 0x05, 0x0A, 0x0E, 0x0E, 0x01, 0x0B, 0x10, 0x17, 0x14, 0x14,
+	0x16, 0x11, 0x1A, 0x0F, 0x1A, 0x11, 0x16, 0x15, 0x12, 0x18, 0x10, 0x0B, 0x02, 0x0E, 0x0C, 0x0B,
+	0x06, 0x0D, 0x0A, 0x0B, 0x08, 0x0D, 0x08, 0x0A, 0x0C, 0x0C, 0x06, 0x0A, 0x0E, 0x0B, 0x06, 0x09,
+	0x10, 0x0B, 0x04, 0x09, 0x12, 0x0B, 0x02, 0x0A, 0x13, 0x0A, 0x02, 0x09, 0x15, 0x09, 0x02, 0x09,
+	0x15, 0x13, 0x17, 0x12, 0x17, 0x12, 0x17, 0x12, 0x17, 0x12, 0x17, 0x12, 0x17, 0x12, 0x17, 0x13,
+	0x15, 0x09, 0x02, 0x09, 0x15, 0x09, 0x02, 0x0A, 0x13, 0x0A, 0x02, 0x0B, 0x11, 0x0A, 0x04, 0x0B,
+	0x0F, 0x0A, 0x06, 0x0D, 0x09, 0x0D, 0x07, 0x21, 0x09, 0x1F, 0x0B, 0x1C, 0x0F, 0x19, 0x12, 0x14,
+	0x19, 0x0C, 0xFF, 0xFF, 0xA1, 0xFF, 0xA0, 0x0A, 0x1A, 0x12, 0x14, 0x15, 0x12, 0x18, 0x0E, 0x1B,
+	0x0C, 0x1D, 0x0A, 0x0C, 0x07, 0x0C, 0x09, 0x0A, 0x0B, 0x0A, 0x08, 0x0A, 0x0D, 0x0A, 0x06, 0x0A,
+	0x0F, 0x0A, 0x05, 0x09, 0x11, 0x09, 0x04, 0x0A, 0x11, 0x09, 0x04, 0x09, 0x13, 0x09, 0x03, 0x09,
+	0x13, 0x09, 0x03, 0x09, 0x14, 0x08, 0x02, 0x09, 0x15, 0x09, 0x01, 0x09, 0x15, 0x09, 0x01, 0x09,
+	0x15, 0x09, 0x01, 0x09, 0x15, 0x09, 0x01, 0x09, 0x16, 0x08, 0x01, 0x09, 0x16, 0x12, 0x16, 0x12,
+	0x16, 0x12, 0x16, 0x13, 0x15, 0x13, 0x15, 0x09, 0x01, 0x09, 0x15, 0x09, 0x01, 0x0A, 0x14, 0x09,
+	0x01, 0x0A, 0x13, 0x0A, 0x02, 0x0A, 0x11, 0x0B, 0x02, 0x0B, 0x0E, 0x0D, 0x03, 0x0D, 0x08, 0x10,
+	0x04, 0x24, 0x04, 0x24, 0x06, 0x22, 0x07, 0x16, 0x02, 0x09, 0x09, 0x11, 0x05, 0x09, 0x0C, 0x0B,
+	0x08, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x1F, 0x09, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09,
+	0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x0A, 0x1D, 0x0A, 0x1D, 0x0B,
+	0x1C, 0x0B, 0x08, 0x04, 0x0F, 0x0C, 0x09, 0x07, 0x0A, 0x0D, 0x0A, 0x1E, 0x0A, 0x1C, 0x0C, 0x1B,
+	0x0D, 0x1A, 0x0F, 0x17, 0x13, 0x13, 0x19, 0x0B, 0xFF, 0xFF, 0x96, 0xFF, 0x11, 0x06, 0x03, 0x08,
+	0x01, 0x46, 0x01, 0x08, 0x03, 0x06, 0xEA, 0x06, 0x03, 0x08, 0x01, 0x46, 0x01, 0x08, 0x03, 0x06,
+	0xAC, 0xFF, 0xBB, 0x06, 0x08, 0x08, 0x06, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A,
+	0x05, 0x0A, 0x05, 0x0A, 0x06, 0x08, 0x08, 0x06, 0xFF, 0x45, 0x07, 0x07, 0x09, 0x06, 0x09, 0x06,
+	0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x08, 0x07, 0x08, 0x07, 0x08, 0x06,
+	0x08, 0x07, 0x08, 0x06, 0x08, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07,
+	0x07, 0x08, 0x06, 0x08, 0x07, 0x08, 0x06, 0x09, 0x05, 0x46, 0xFF, 0xFF, 0xFF, 0x98, 0x03, 0x23,
+	0x05, 0x21, 0x07, 0x1F, 0x09, 0x1D, 0x0B, 0x1B, 0x0D, 0x19, 0x0F, 0x17, 0x10, 0x17, 0x0F, 0x17,
+	0x0F, 0x17, 0x0F, 0x17, 0x0F, 0x17, 0x0F, 0x17, 0x0F, 0x17, 0x0F, 0x17, 0x0F, 0x17, 0x0F, 0x17,
+	0x0F, 0x17, 0x0F, 0x18, 0x0E, 0x19, 0x0D, 0x1B, 0x0B, 0x1D, 0x08, 0x20, 0x0A, 0x1E, 0x0C, 0x1D,
+	0x0D, 0x1C, 0x0E, 0x1C, 0x0E, 0x1C, 0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1B,
+	0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1A, 0x0F, 0x1B, 0x0D, 0x1D, 0x0B, 0x1F,
+	0x09, 0x21, 0x07, 0x23, 0x05, 0x25, 0x03, 0xFF, 0xFF, 0xFF, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5,
+	0x25, 0x01, 0xC3, 0x01, 0x25, 0xFF, 0xD7, 0x25, 0x01, 0xC3, 0x01, 0x25, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xBE, 0xFF, 0xFF, 0xFF, 0x9B, 0x03, 0x25, 0x05, 0x23, 0x07, 0x21, 0x09, 0x1F, 0x0B, 0x1D, 0x0D,
+	0x1B, 0x0F, 0x1A, 0x10, 0x1A, 0x10, 0x1A, 0x10, 0x1A, 0x10, 0x1A, 0x10, 0x1A, 0x10, 0x1A, 0x10,
+	0x1B, 0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1B, 0x0F, 0x1C, 0x0C, 0x1E, 0x0B, 0x1F, 0x09,
+	0x1E, 0x0A, 0x1C, 0x0C, 0x1A, 0x0D, 0x19, 0x0F, 0x17, 0x0F, 0x16, 0x10, 0x16, 0x10, 0x16, 0x10,
+	0x16, 0x10, 0x16, 0x10, 0x16, 0x10, 0x16, 0x10, 0x16, 0x10, 0x15, 0x11, 0x16, 0x10, 0x17, 0x0F,
+	0x19, 0x0D, 0x1B, 0x0B, 0x1D, 0x09, 0x1F, 0x07, 0x21, 0x05, 0x23, 0x03, 0xFF, 0xFF, 0xFF, 0x98,
+	0xF8, 0x0A, 0x14, 0x12, 0x0D, 0x17, 0x09, 0x1A, 0x07, 0x1D, 0x05, 0x1E, 0x04, 0x09, 0x09, 0x0C,
+	0x04, 0x06, 0x0E, 0x0B, 0x03, 0x04, 0x12, 0x0A, 0x02, 0x03, 0x14, 0x09, 0x1A, 0x09, 0x19, 0x09,
+	0x1A, 0x08, 0x1A, 0x09, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08,
+	0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x19, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x19, 0x08, 0x19, 0x09,
+	0x18, 0x09, 0x18, 0x0A, 0x15, 0x0C, 0x0F, 0x12, 0x0F, 0x12, 0x10, 0x10, 0x12, 0x0E, 0x14, 0x0B,
+	0x17, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08,
+	0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1A, 0x08, 0x1B, 0x06, 0xE8, 0x06, 0x1B, 0x08, 0x19, 0x0A,
+	0x18, 0x0A, 0x18, 0x0A, 0x18, 0x0A, 0x18, 0x0A, 0x18, 0x0A, 0x18, 0x0A, 0x19, 0x08, 0x1B, 0x06,
+	0xFF, 0xFF, 0x33, 0xFF, 0xFF, 0x99, 0x0F, 0x32, 0x18, 0x2B, 0x1E, 0x25, 0x23, 0x21, 0x27, 0x1D,
+	0x2B, 0x1A, 0x10, 0x0D, 0x10, 0x17, 0x0E, 0x15, 0x0D, 0x15, 0x0C, 0x1B, 0x0B, 0x13, 0x0B, 0x1E,
+	0x0B, 0x11, 0x0A, 0x22, 0x0A, 0x0F, 0x09, 0x25, 0x09, 0x0E, 0x09, 0x27, 0x09, 0x0C, 0x09, 0x29,
+	0x08, 0x0C, 0x08, 0x2B, 0x08, 0x0A, 0x08, 0x2C, 0x08, 0x09, 0x08, 0x2E, 0x08, 0x08, 0x08, 0x0F,
+	0x07, 0x18, 0x08, 0x07, 0x08, 0x0E, 0x0B, 0x06, 0x07, 0x0A, 0x07, 0x07, 0x07, 0x0D, 0x0F, 0x04,
+	0x07, 0x0A, 0x07, 0x06, 0x08, 0x0C, 0x11, 0x02, 0x07, 0x0B, 0x08, 0x05, 0x07, 0x0C, 0x13, 0x01,
+	0x07, 0x0B, 0x08, 0x04, 0x08, 0x0B, 0x1C, 0x0B, 0x08, 0x04, 0x07, 0x0B, 0x0A, 0x05, 0x0E, 0x0C,
+	0x07, 0x03, 0x08, 0x0A, 0x09, 0x08, 0x0D, 0x0C, 0x07, 0x03, 0x07, 0x0B, 0x08, 0x0A, 0x0B, 0x0D,
+	0x07, 0x03, 0x07, 0x0A, 0x08, 0x0C, 0x0A, 0x0D, 0x07, 0x02, 0x08, 0x0A, 0x08, 0x0D, 0x09, 0x0D,
+	0x07, 0x02, 0x07, 0x0A, 0x08, 0x0E, 0x09, 0x0D, 0x07, 0x02, 0x07, 0x0A, 0x08, 0x0F, 0x08, 0x0D,
+	0x07, 0x02, 0x07, 0x0A, 0x07, 0x10, 0x08, 0x0D, 0x07, 0x01, 0x08, 0x09, 0x08, 0x10, 0x07, 0x0E,
+	0x07, 0x01, 0x07, 0x0A, 0x08, 0x0F, 0x08, 0x0D, 0x08, 0x01, 0x07, 0x0A, 0x07, 0x10, 0x08, 0x0D,
+	0x08, 0x01, 0x07, 0x0A, 0x07, 0x10, 0x08, 0x0D, 0x07, 0x02, 0x07, 0x0A, 0x07, 0x10, 0x08, 0x0D,
+	0x07, 0x02, 0x07, 0x09, 0x08, 0x10, 0x07, 0x0E, 0x07, 0x01, 0x08, 0x09, 0x08, 0x10, 0x07, 0x0E,
+	0x07, 0x01, 0x07, 0x0A, 0x07, 0x10, 0x08, 0x0D, 0x08, 0x01, 0x07, 0x0A, 0x07, 0x10, 0x08, 0x0D,
+	0x07, 0x02, 0x07, 0x0A, 0x07, 0x10, 0x08, 0x0D, 0x07, 0x02, 0x07, 0x0A, 0x07, 0x10, 0x07, 0x0D,
+	0x08, 0x02, 0x07, 0x0A, 0x07, 0x0F, 0x08, 0x0D, 0x07, 0x03, 0x07, 0x0A, 0x07, 0x0E, 0x09, 0x0D,
+	0x07, 0x03, 0x07, 0x0A, 0x08, 0x0C, 0x0A, 0x0C, 0x07, 0x04, 0x07, 0x0A, 0x08, 0x0B, 0x0B, 0x0B,
+	0x08, 0x04, 0x07, 0x0A, 0x08, 0x0A, 0x0D, 0x0A, 0x07, 0x05, 0x07, 0x0B, 0x08, 0x08, 0x0E, 0x08,
+	0x09, 0x05, 0x07, 0x0B, 0x09, 0x05, 0x12, 0x05, 0x09, 0x06, 0x08, 0x0A, 0x16, 0x02, 0x15, 0x07,
+	0x08, 0x0B, 0x13, 0x04, 0x14, 0x09, 0x07, 0x0B, 0x12, 0x06, 0x12, 0x0A, 0x07, 0x0C, 0x10, 0x08,
+	0x10, 0x0B, 0x07, 0x0E, 0x0C, 0x0B, 0x0D, 0x0D, 0x08, 0x0F, 0x07, 0x10, 0x08, 0x10, 0x08, 0x3F,
+	0x07, 0x3F, 0x08, 0x3E, 0x08, 0x3F, 0x08, 0x3E, 0x09, 0x3E, 0x09, 0x3D, 0x0A, 0x3D, 0x0A, 0x3D,
+	0x0B, 0x3C, 0x0C, 0x3B, 0x0D, 0x19, 0x04, 0x1D, 0x11, 0x0F, 0x09, 0x1E, 0x28, 0x20, 0x26, 0x22,
+	0x24, 0x24, 0x21, 0x28, 0x1C, 0x2F, 0x11, 0xFF, 0xC2, 0xFF, 0xFF, 0x53, 0x09, 0x2A, 0x0B, 0x29,
+	0x0B, 0x29, 0x0C, 0x27, 0x0D, 0x27, 0x0E, 0x26, 0x0E, 0x25, 0x0F, 0x25, 0x07, 0x01, 0x08, 0x24,
+	0x07, 0x01, 0x08, 0x23, 0x07, 0x02, 0x08, 0x23, 0x07, 0x03, 0x08, 0x21, 0x08, 0x03, 0x08, 0x21,
+	0x07, 0x04, 0x08, 0x21, 0x07, 0x05, 0x08, 0x1F, 0x08, 0x05, 0x08, 0x1F, 0x07, 0x06, 0x09, 0x1E,
+	0x07, 0x07, 0x08, 0x1D, 0x08, 0x07, 0x08, 0x1D, 0x07, 0x08, 0x09, 0x1C, 0x07, 0x09, 0x08, 0x1B,
+	0x08, 0x09, 0x08, 0x1B, 0x07, 0x0A, 0x09, 0x19, 0x08, 0x0B, 0x08, 0x19, 0x08, 0x0B, 0x08, 0x19,
+	0x07, 0x0C, 0x09, 0x17, 0x08, 0x0D, 0x08, 0x17, 0x08, 0x0D, 0x08, 0x17, 0x07, 0x0E, 0x09, 0x15,
+	0x08, 0x0F, 0x08, 0x15, 0x08, 0x0F, 0x09, 0x14, 0x07, 0x10, 0x09, 0x13, 0x08, 0x11, 0x08, 0x13,
+	0x08, 0x11, 0x09, 0x12, 0x07, 0x12, 0x09, 0x11, 0x08, 0x13, 0x08, 0x11, 0x08, 0x13, 0x09, 0x0F,
+	0x08, 0x14, 0x09, 0x0F, 0x08, 0x15, 0x08, 0x0F, 0x26, 0x0D, 0x27, 0x0D, 0x28, 0x0C, 0x28, 0x0B,
+	0x29, 0x0B, 0x2A, 0x0A, 0x08, 0x19, 0x09, 0x09, 0x08, 0x1B, 0x08, 0x09, 0x08, 0x1B, 0x09, 0x07,
+	0x09, 0x1B, 0x09, 0x07, 0x08, 0x1D, 0x08, 0x07, 0x08, 0x1D, 0x09, 0x05, 0x09, 0x1D, 0x09, 0x05,
+	0x08, 0x1F, 0x09, 0x04, 0x08, 0x1F, 0x09, 0x03, 0x09, 0x1F, 0x09, 0x03, 0x08, 0x21, 0x09, 0x02,
+	0x08, 0x21, 0x09, 0x01, 0x09, 0x22, 0x08, 0x01, 0x08, 0x23, 0x11, 0x23, 0x10, 0x25, 0x08, 0xFF,
+	0xFF, 0xFF, 0x77, 0xFF, 0xBA, 0x16, 0x11, 0x1B, 0x0D, 0x1D, 0x0B, 0x1F, 0x09, 0x20, 0x08, 0x21,
+	0x07, 0x21, 0x07, 0x09, 0x0C, 0x0D, 0x06, 0x09, 0x0E, 0x0C, 0x05, 0x09, 0x10, 0x0A, 0x05, 0x09,
+	0x10, 0x0A, 0x05, 0x09, 0x11, 0x0A, 0x04, 0x09, 0x11, 0x0A, 0x04, 0x09, 0x12, 0x09, 0x04, 0x09,
+	0x12, 0x09, 0x04, 0x09, 0x12, 0x09, 0x04, 0x09, 0x12, 0x09, 0x04, 0x09, 0x12, 0x09, 0x04, 0x09,
+	0x12, 0x09, 0x04, 0x09, 0x12, 0x09, 0x04, 0x09, 0x12, 0x08, 0x05, 0x09, 0x11, 0x09, 0x05, 0x09,
+	0x11, 0x09, 0x05, 0x09, 0x10, 0x09, 0x06, 0x09, 0x0F, 0x09, 0x07, 0x09, 0x0E, 0x0A, 0x07, 0x09,
+	0x0C, 0x0B, 0x08, 0x1E, 0x0A, 0x1D, 0x0B, 0x1E, 0x0A, 0x21, 0x07, 0x22, 0x06, 0x23, 0x05, 0x09,
+	0x0E, 0x0D, 0x04, 0x09, 0x11, 0x0B, 0x03, 0x09, 0x12, 0x0B, 0x02, 0x09, 0x14, 0x09, 0x02, 0x09,
+	0x14, 0x0A, 0x01, 0x09, 0x15, 0x09, 0x01, 0x09, 0x15, 0x09, 0x01, 0x09, 0x16, 0x12, 0x16, 0x12,
+	0x16, 0x12, 0x16, 0x12, 0x16, 0x12, 0x16, 0x12, 0x16, 0x12, 0x15, 0x13, 0x15, 0x09, 0x01, 0x09,
+	0x15, 0x09, 0x01, 0x09, 0x14, 0x0A, 0x01, 0x09, 0x13, 0x0A, 0x02, 0x09, 0x11, 0x0C, 0x02, 0x09,
+	0x0F, 0x0D, 0x03, 0x24, 0x04, 0x23, 0x05, 0x22, 0x06, 0x21, 0x07, 0x1F, 0x09, 0x1D, 0x0C, 0x18,
+	0xFF, 0xFF, 0xB9, 0xFF, 0xC4, 0x0A, 0x1D, 0x12, 0x17, 0x16, 0x13, 0x1A, 0x10, 0x1D, 0x0C, 0x20,
+	0x0A, 0x22, 0x08, 0x0E, 0x09, 0x0C, 0x07, 0x0D, 0x0E, 0x09, 0x07, 0x0B, 0x12, 0x07, 0x06, 0x0A,
+	0x16, 0x05, 0x05, 0x0A, 0x18, 0x04, 0x05, 0x0A, 0x19, 0x02, 0x05, 0x0A, 0x21, 0x09, 0x21, 0x0A,
+	0x21, 0x09, 0x21, 0x0A, 0x21, 0x09, 0x22, 0x09, 0x21, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09,
+	0x22, 0x09, 0x21, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09,
+	0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x0A,
+	0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x0A, 0x21, 0x0A, 0x22, 0x09, 0x22, 0x0A, 0x21, 0x0A,
+	0x22, 0x0A, 0x21, 0x0A, 0x22, 0x0A, 0x1B, 0x02, 0x04, 0x0B, 0x18, 0x04, 0x05, 0x0B, 0x16, 0x05,
+	0x06, 0x0B, 0x13, 0x07, 0x06, 0x0D, 0x0F, 0x09, 0x07, 0x0F, 0x09, 0x0C, 0x08, 0x23, 0x09, 0x21,
+	0x0B, 0x1F, 0x0E, 0x1B, 0x12, 0x17, 0x16, 0x12, 0x1D, 0x0B, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x08,
+	0x17, 0x17, 0x1D, 0x12, 0x1F, 0x10, 0x22, 0x0D, 0x23, 0x0C, 0x25, 0x0A, 0x26, 0x09, 0x09, 0x0E,
+	0x10, 0x08, 0x09, 0x11, 0x0E, 0x07, 0x09, 0x13, 0x0D, 0x06, 0x09, 0x15, 0x0C, 0x05, 0x09, 0x16,
+	0x0B, 0x05, 0x09, 0x17, 0x0B, 0x04, 0x09, 0x18, 0x0A, 0x04, 0x09, 0x19, 0x0A, 0x03, 0x09, 0x1A,
+	0x09, 0x03, 0x09, 0x1A, 0x0A, 0x02, 0x09, 0x1B, 0x09, 0x02, 0x09, 0x1B, 0x09, 0x02, 0x09, 0x1B,
+	0x0A, 0x01, 0x09, 0x1C, 0x09, 0x01, 0x09, 0x1C, 0x09, 0x01, 0x09, 0x1C, 0x09, 0x01, 0x09, 0x1C,
+	0x13, 0x1D, 0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1D,
+	0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1D, 0x12, 0x1C, 0x09, 0x01, 0x09, 0x1C,
+	0x09, 0x01, 0x09, 0x1C, 0x09, 0x01, 0x09, 0x1C, 0x09, 0x01, 0x09, 0x1B, 0x0A, 0x01, 0x09, 0x1B,
+	0x09, 0x02, 0x09, 0x1B, 0x09, 0x02, 0x09, 0x1A, 0x0A, 0x02, 0x09, 0x1A, 0x09, 0x03, 0x09, 0x19,
+	0x0A, 0x03, 0x09, 0x18, 0x0A, 0x04, 0x09, 0x18, 0x0A, 0x04, 0x09, 0x17, 0x0A, 0x05, 0x09, 0x15,
+	0x0B, 0x06, 0x09, 0x14, 0x0C, 0x06, 0x09, 0x12, 0x0D, 0x07, 0x09, 0x0E, 0x10, 0x08, 0x26, 0x09,
+	0x24, 0x0B, 0x23, 0x0C, 0x21, 0x0E, 0x1F, 0x10, 0x1C, 0x14, 0x16, 0xFF, 0xFF, 0xFF, 0x3A, 0xFF,
+	0x78, 0x20, 0x01, 0xCB, 0x01, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09,
+	0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09,
+	0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x1D, 0x05, 0x1E, 0x04, 0x1E, 0x04, 0x1E,
+	0x04, 0x1E, 0x04, 0x1E, 0x04, 0x1D, 0x05, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09,
+	0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09,
+	0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09,
+	0x19, 0x09, 0x19, 0x21, 0x01, 0xAA, 0x01, 0x20, 0xFF, 0xFF, 0x45, 0xFF, 0x62, 0x1E, 0x01, 0xBF,
+	0x01, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09,
+	0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09,
+	0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x1E, 0x02, 0x1F, 0x01, 0x1F, 0x01, 0x1F,
+	0x01, 0x1F, 0x01, 0x1F, 0x01, 0x1E, 0x02, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09,
+	0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09,
+	0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09,
+	0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x17, 0x09, 0x18, 0x07, 0xFF, 0xFF, 0x3A, 0xFF,
+	0xFF, 0x04, 0x0C, 0x21, 0x14, 0x1A, 0x1A, 0x15, 0x1E, 0x11, 0x22, 0x0E, 0x24, 0x0C, 0x26, 0x0A,
+	0x0F, 0x0A, 0x0E, 0x09, 0x0D, 0x11, 0x0A, 0x08, 0x0C, 0x15, 0x08, 0x07, 0x0B, 0x19, 0x06, 0x06,
+	0x0B, 0x1C, 0x04, 0x05, 0x0B, 0x1E, 0x02, 0x06, 0x0A, 0x26, 0x0A, 0x27, 0x09, 0x27, 0x0A, 0x27,
+	0x09, 0x27, 0x0A, 0x27, 0x09, 0x28, 0x09, 0x27, 0x0A, 0x27, 0x09, 0x28, 0x09, 0x28, 0x09, 0x27,
+	0x0A, 0x27, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x12, 0x15, 0x01, 0x09, 0x11, 0x20, 0x11,
+	0x20, 0x11, 0x20, 0x11, 0x20, 0x11, 0x20, 0x12, 0x1F, 0x1F, 0x12, 0x1F, 0x13, 0x1E, 0x09, 0x01,
+	0x09, 0x1E, 0x09, 0x01, 0x09, 0x1E, 0x09, 0x01, 0x09, 0x1E, 0x09, 0x01, 0x0A, 0x1D, 0x09, 0x02,
+	0x09, 0x1D, 0x09, 0x02, 0x0A, 0x1C, 0x09, 0x02, 0x0A, 0x1C, 0x09, 0x03, 0x0A, 0x1B, 0x09, 0x03,
+	0x0A, 0x1B, 0x09, 0x04, 0x0A, 0x1A, 0x09, 0x04, 0x0B, 0x19, 0x09, 0x05, 0x0B, 0x18, 0x09, 0x05,
+	0x0C, 0x17, 0x09, 0x06, 0x0C, 0x16, 0x09, 0x07, 0x0C, 0x15, 0x09, 0x08, 0x0E, 0x10, 0x0B, 0x09,
+	0x10, 0x09, 0x0F, 0x0A, 0x27, 0x0B, 0x26, 0x0D, 0x23, 0x0F, 0x20, 0x13, 0x1B, 0x19, 0x15, 0x20,
+	0x0D, 0xFF, 0xFF, 0xFF, 0x20, 0xFF, 0xE6, 0x07, 0x1C, 0x07, 0x01, 0x09, 0x1A, 0x12, 0x1A, 0x12,
+	0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12,
+	0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12,
+	0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0xFF, 0x47, 0x1A,
+	0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A,
+	0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A,
+	0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A, 0x12, 0x1A,
+	0x12, 0x1A, 0x12, 0x1A, 0x09, 0x01, 0x07, 0x1C, 0x07, 0xFF, 0xFF, 0xEF, 0x64, 0x07, 0x01, 0xFF,
+	0xFF, 0x15, 0x01, 0x07, 0x9A, 0xFF, 0x19, 0x07, 0x10, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09,
+	0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09,
+	0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09,
+	0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09,
+	0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09,
+	0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09,
+	0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x0E, 0x09, 0x0F, 0x09,
+	0x01, 0x03, 0x0A, 0x0A, 0x01, 0x05, 0x07, 0x0B, 0x01, 0x16, 0x02, 0x16, 0x02, 0x15, 0x03, 0x14,
+	0x05, 0x12, 0x07, 0x0F, 0x0C, 0x09, 0xFF, 0x8B, 0xFF, 0xBA, 0x07, 0x18, 0x07, 0x01, 0x09, 0x15,
+	0x09, 0x01, 0x09, 0x15, 0x09, 0x01, 0x09, 0x14, 0x09, 0x02, 0x09, 0x13, 0x0A, 0x02, 0x09, 0x12,
+	0x0A, 0x03, 0x09, 0x11, 0x0A, 0x04, 0x09, 0x11, 0x09, 0x05, 0x09, 0x10, 0x09, 0x06, 0x09, 0x0F,
+	0x0A, 0x06, 0x09, 0x0E, 0x0A, 0x07, 0x09, 0x0D, 0x0A, 0x08, 0x09, 0x0D, 0x09, 0x09, 0x09, 0x0C,
+	0x09, 0x0A, 0x09, 0x0B, 0x09, 0x0B, 0x09, 0x0A, 0x0A, 0x0B, 0x09, 0x09, 0x0A, 0x0C, 0x09, 0x09,
+	0x09, 0x0D, 0x09, 0x08, 0x09, 0x0E, 0x09, 0x07, 0x09, 0x0F, 0x09, 0x06, 0x09, 0x10, 0x09, 0x05,
+	0x09, 0x11, 0x09, 0x05, 0x09, 0x11, 0x09, 0x04, 0x09, 0x12, 0x09, 0x03, 0x09, 0x13, 0x09, 0x02,
+	0x09, 0x14, 0x09, 0x01, 0x09, 0x15, 0x09, 0x01, 0x08, 0x16, 0x12, 0x16, 0x13, 0x15, 0x09, 0x01,
+	0x09, 0x15, 0x09, 0x02, 0x09, 0x14, 0x09, 0x02, 0x0A, 0x13, 0x09, 0x03, 0x0A, 0x12, 0x09, 0x04,
+	0x09, 0x12, 0x09, 0x05, 0x09, 0x11, 0x09, 0x05, 0x0A, 0x10, 0x09, 0x06, 0x0A, 0x0F, 0x09, 0x07,
+	0x09, 0x0F, 0x09, 0x08, 0x09, 0x0E, 0x09, 0x08, 0x0A, 0x0D, 0x09, 0x09, 0x0A, 0x0C, 0x09, 0x0A,
+	0x09, 0x0C, 0x09, 0x0A, 0x0A, 0x0B, 0x09, 0x0B, 0x0A, 0x0A, 0x09, 0x0C, 0x0A, 0x09, 0x09, 0x0D,
+	0x09, 0x09, 0x09, 0x0D, 0x0A, 0x08, 0x09, 0x0E, 0x0A, 0x07, 0x09, 0x0F, 0x0A, 0x06, 0x09, 0x10,
+	0x09, 0x06, 0x09, 0x10, 0x0A, 0x05, 0x09, 0x11, 0x0A, 0x04, 0x09, 0x12, 0x0A, 0x03, 0x09, 0x13,
+	0x09, 0x03, 0x09, 0x13, 0x0A, 0x02, 0x09, 0x14, 0x0A, 0x01, 0x09, 0x15, 0x13, 0x16, 0x12, 0x16,
+	0x09, 0x01, 0x07, 0x18, 0x08, 0xFF, 0xFF, 0xAA, 0xFF, 0x57, 0x07, 0x17, 0x09, 0x16, 0x09, 0x16,
+	0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16,
+	0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16,
+	0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16,
+	0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16,
+	0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16,
+	0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x09, 0x16,
+	0x09, 0x16, 0x09, 0x16, 0x09, 0x16, 0x1E, 0x01, 0x9B, 0x01, 0x1D, 0xFF, 0xFF, 0x12, 0xFF, 0xFF,
+	0xDA, 0x0A, 0x2A, 0x0A, 0x03, 0x0D, 0x26, 0x0D, 0x01, 0x0F, 0x24, 0x1F, 0x23, 0x1F, 0x22, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x20, 0x1A, 0x01, 0x08, 0x1F, 0x07, 0x01, 0x12, 0x01, 0x08, 0x1E, 0x08,
+	0x01, 0x12, 0x01, 0x08, 0x1E, 0x07, 0x02, 0x12, 0x02, 0x08, 0x1D, 0x07, 0x02, 0x12, 0x02, 0x08,
+	0x1C, 0x08, 0x02, 0x12, 0x03, 0x08, 0x1B, 0x07, 0x03, 0x12, 0x03, 0x08, 0x1B, 0x07, 0x03, 0x12,
+	0x03, 0x08, 0x1A, 0x08, 0x03, 0x12, 0x04, 0x08, 0x19, 0x07, 0x04, 0x12, 0x04, 0x08, 0x18, 0x08,
+	0x04, 0x12, 0x04, 0x08, 0x18, 0x07, 0x05, 0x12, 0x05, 0x08, 0x17, 0x07, 0x05, 0x12, 0x05, 0x08,
+	0x16, 0x08, 0x05, 0x12, 0x06, 0x08, 0x15, 0x07, 0x06, 0x12, 0x06, 0x08, 0x14, 0x08, 0x06, 0x12,
+	0x06, 0x08, 0x14, 0x07, 0x07, 0x12, 0x07, 0x08, 0x13, 0x07, 0x07, 0x12, 0x07, 0x08, 0x12, 0x08,
+	0x07, 0x12, 0x07, 0x09, 0x11, 0x07, 0x08, 0x12, 0x08, 0x08, 0x10, 0x08, 0x08, 0x12, 0x08, 0x08,
+	0x10, 0x08, 0x08, 0x12, 0x09, 0x08, 0x0F, 0x07, 0x09, 0x12, 0x09, 0x08, 0x0E, 0x08, 0x09, 0x12,
+	0x09, 0x08, 0x0E, 0x07, 0x0A, 0x12, 0x0A, 0x08, 0x0D, 0x07, 0x0A, 0x12, 0x0A, 0x08, 0x0C, 0x08,
+	0x0A, 0x12, 0x0A, 0x09, 0x0B, 0x07, 0x0B, 0x12, 0x0B, 0x08, 0x0A, 0x08, 0x0B, 0x12, 0x0B, 0x08,
+	0x0A, 0x08, 0x0B, 0x12, 0x0C, 0x08, 0x09, 0x07, 0x0C, 0x12, 0x0C, 0x08, 0x08, 0x08, 0x0C, 0x12,
+	0x0C, 0x08, 0x08, 0x07, 0x0D, 0x12, 0x0D, 0x08, 0x06, 0x08, 0x0D, 0x12, 0x0D, 0x08, 0x06, 0x08,
+	0x0D, 0x12, 0x0D, 0x09, 0x05, 0x07, 0x0E, 0x12, 0x0E, 0x08, 0x04, 0x08, 0x0E, 0x12, 0x0E, 0x08,
+	0x04, 0x07, 0x0F, 0x12, 0x0E, 0x09, 0x03, 0x07, 0x0F, 0x12, 0x0F, 0x08, 0x02, 0x08, 0x0F, 0x12,
+	0x0F, 0x08, 0x02, 0x07, 0x10, 0x12, 0x10, 0x10, 0x10, 0x12, 0x10, 0x10, 0x10, 0x12, 0x10, 0x0F,
+	0x11, 0x12, 0x11, 0x0E, 0x11, 0x12, 0x11, 0x0D, 0x12, 0x12, 0x11, 0x0D, 0x12, 0x12, 0x12, 0x0C,
+	0x12, 0x12, 0x12, 0x0B, 0x13, 0x12, 0x13, 0x0A, 0x13, 0x12, 0x13, 0x0A, 0x13, 0x12, 0x13, 0x09,
+	0x14, 0x12, 0x14, 0x08, 0x14, 0x09, 0x01, 0x07, 0x16, 0x06, 0x16, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x67, 0xFF, 0xFD, 0x09, 0x1B, 0x07, 0x01, 0x0D, 0x18, 0x17, 0x17, 0x18, 0x16, 0x18, 0x16, 0x19,
+	0x15, 0x19, 0x15, 0x1A, 0x14, 0x1A, 0x14, 0x1B, 0x13, 0x12, 0x01, 0x08, 0x13, 0x12, 0x01, 0x09,
+	0x12, 0x12, 0x02, 0x08, 0x12, 0x12, 0x02, 0x09, 0x11, 0x12, 0x02, 0x09, 0x11, 0x12, 0x03, 0x09,
+	0x10, 0x12, 0x03, 0x09, 0x10, 0x12, 0x04, 0x09, 0x0F, 0x12, 0x04, 0x09, 0x0F, 0x12, 0x05, 0x08,
+	0x0F, 0x12, 0x05, 0x09, 0x0E, 0x12, 0x06, 0x08, 0x0E, 0x12, 0x06, 0x09, 0x0D, 0x12, 0x07, 0x08,
+	0x0D, 0x12, 0x07, 0x09, 0x0C, 0x12, 0x08, 0x08, 0x0C, 0x12, 0x08, 0x09, 0x0B, 0x12, 0x09, 0x08,
+	0x0B, 0x12, 0x09, 0x09, 0x0A, 0x12, 0x0A, 0x08, 0x0A, 0x12, 0x0A, 0x09, 0x09, 0x12, 0x0B, 0x08,
+	0x09, 0x12, 0x0B, 0x09, 0x08, 0x12, 0x0C, 0x08, 0x08, 0x12, 0x0C, 0x09, 0x07, 0x12, 0x0D, 0x08,
+	0x07, 0x12, 0x0D, 0x09, 0x06, 0x12, 0x0E, 0x08, 0x06, 0x12, 0x0E, 0x09, 0x05, 0x12, 0x0F, 0x08,
+	0x05, 0x12, 0x0F, 0x09, 0x04, 0x12, 0x10, 0x08, 0x04, 0x12, 0x10, 0x09, 0x03, 0x12, 0x11, 0x08,
+	0x03, 0x12, 0x11, 0x09, 0x02, 0x12, 0x12, 0x08, 0x02, 0x12, 0x12, 0x09, 0x01, 0x12, 0x13, 0x08,
+	0x01, 0x12, 0x13, 0x1B, 0x14, 0x1A, 0x14, 0x1A, 0x15, 0x19, 0x15, 0x19, 0x16, 0x18, 0x16, 0x18,
+	0x17, 0x17, 0x17, 0x17, 0x18, 0x16, 0x19, 0x15, 0x1A, 0x0A, 0x02, 0x07, 0x1C, 0x08, 0xFF, 0xFF,
+	0xFF, 0x13, 0xFF, 0xFF, 0x33, 0x0D, 0x26, 0x14, 0x1F, 0x19, 0x1B, 0x1D, 0x17, 0x21, 0x14, 0x23,
+	0x12, 0x25, 0x10, 0x0E, 0x0A, 0x0F, 0x0E, 0x0D, 0x0F, 0x0D, 0x0C, 0x0C, 0x13, 0x0C, 0x0A, 0x0B,
+	0x16, 0x0B, 0x0A, 0x0A, 0x18, 0x0B, 0x08, 0x0A, 0x1A, 0x0A, 0x08, 0x0A, 0x1B, 0x0A, 0x06, 0x0A,
+	0x1C, 0x0A, 0x06, 0x09, 0x1E, 0x0A, 0x04, 0x0A, 0x1F, 0x09, 0x04, 0x09, 0x20, 0x09, 0x04, 0x09,
+	0x20, 0x0A, 0x03, 0x09, 0x21, 0x09, 0x02, 0x09, 0x22, 0x09, 0x02, 0x09, 0x22, 0x09, 0x02, 0x09,
+	0x22, 0x09, 0x02, 0x09, 0x22, 0x13, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12,
+	0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12, 0x24, 0x12,
+	0x24, 0x12, 0x23, 0x09, 0x01, 0x0A, 0x22, 0x09, 0x02, 0x09, 0x22, 0x09, 0x02, 0x09, 0x22, 0x09,
+	0x02, 0x09, 0x22, 0x09, 0x02, 0x09, 0x21, 0x09, 0x03, 0x0A, 0x20, 0x09, 0x04, 0x09, 0x20, 0x09,
+	0x04, 0x09, 0x1F, 0x0A, 0x04, 0x0A, 0x1E, 0x09, 0x06, 0x09, 0x1D, 0x0A, 0x06, 0x0A, 0x1B, 0x0A,
+	0x08, 0x0A, 0x1A, 0x0A, 0x08, 0x0B, 0x18, 0x0A, 0x0A, 0x0B, 0x16, 0x0A, 0x0B, 0x0C, 0x13, 0x0C,
+	0x0C, 0x0D, 0x0F, 0x0D, 0x0E, 0x0F, 0x0A, 0x0E, 0x10, 0x25, 0x12, 0x23, 0x14, 0x21, 0x17, 0x1D,
+	0x1B, 0x19, 0x1F, 0x15, 0x25, 0x0D, 0xFF, 0xFF, 0xFF, 0x78, 0xFF, 0x99, 0x15, 0x0F, 0x1A, 0x0B,
+	0x1C, 0x09, 0x1E, 0x07, 0x1F, 0x06, 0x20, 0x05, 0x21, 0x04, 0x09, 0x0C, 0x0D, 0x03, 0x09, 0x0E,
+	0x0C, 0x02, 0x09, 0x0F, 0x0B, 0x02, 0x09, 0x10, 0x0B, 0x01, 0x09, 0x11, 0x0A, 0x01, 0x09, 0x12,
+	0x09, 0x01, 0x09, 0x12, 0x13, 0x13, 0x12, 0x13, 0x12, 0x13, 0x12, 0x13, 0x12, 0x13, 0x12, 0x13,
+	0x12, 0x13, 0x12, 0x13, 0x12, 0x13, 0x12, 0x12, 0x09, 0x01, 0x09, 0x12, 0x09, 0x01, 0x09, 0x11,
+	0x0A, 0x01, 0x09, 0x11, 0x09, 0x02, 0x09, 0x10, 0x0A, 0x02, 0x09, 0x0F, 0x0B, 0x02, 0x09, 0x0D,
+	0x0C, 0x03, 0x09, 0x0B, 0x0D, 0x04, 0x20, 0x05, 0x20, 0x05, 0x1E, 0x07, 0x1D, 0x08, 0x1B, 0x0A,
+	0x19, 0x0C, 0x15, 0x10, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C,
+	0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C,
+	0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1D,
+	0x07, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0x79, 0x0D, 0x2D, 0x14, 0x26, 0x19, 0x22, 0x1D, 0x1E, 0x21,
+	0x1B, 0x23, 0x19, 0x25, 0x17, 0x0E, 0x0A, 0x0F, 0x15, 0x0D, 0x0F, 0x0D, 0x13, 0x0C, 0x13, 0x0C,
+	0x11, 0x0B, 0x16, 0x0B, 0x11, 0x0A, 0x18, 0x0B, 0x0F, 0x0A, 0x1A, 0x0A, 0x0F, 0x0A, 0x1B, 0x0A,
+	0x0D, 0x0A, 0x1C, 0x0A, 0x0D, 0x09, 0x1E, 0x0A, 0x0B, 0x0A, 0x1F, 0x09, 0x0B, 0x09, 0x20, 0x09,
+	0x0B, 0x09, 0x20, 0x0A, 0x09, 0x0A, 0x21, 0x09, 0x09, 0x09, 0x22, 0x09, 0x09, 0x09, 0x22, 0x09,
+	0x09, 0x09, 0x22, 0x09, 0x09, 0x09, 0x22, 0x0A, 0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09,
+	0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09,
+	0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09,
+	0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09, 0x07, 0x09, 0x24, 0x09,
+	0x07, 0x09, 0x23, 0x0A, 0x07, 0x0A, 0x22, 0x09, 0x09, 0x09, 0x22, 0x09, 0x09, 0x09, 0x22, 0x09,
+	0x09, 0x09, 0x22, 0x09, 0x09, 0x09, 0x21, 0x0A, 0x09, 0x0A, 0x20, 0x09, 0x0B, 0x09, 0x20, 0x09,
+	0x0B, 0x09, 0x1F, 0x0A, 0x0B, 0x0A, 0x1E, 0x09, 0x0D, 0x09, 0x1D, 0x0A, 0x0D, 0x0A, 0x1B, 0x0A,
+	0x0F, 0x0A, 0x1A, 0x0A, 0x0F, 0x0B, 0x18, 0x0A, 0x11, 0x0B, 0x16, 0x0B, 0x11, 0x0C, 0x13, 0x0C,
+	0x13, 0x0D, 0x0F, 0x0D, 0x15, 0x0F, 0x0A, 0x0F, 0x16, 0x28, 0x16, 0x28, 0x16, 0x29, 0x16, 0x28,
+	0x17, 0x18, 0x03, 0x0D, 0x17, 0x14, 0x06, 0x0E, 0x19, 0x0C, 0x0C, 0x0E, 0x30, 0x0F, 0x2F, 0x0F,
+	0x30, 0x0D, 0x31, 0x0C, 0x33, 0x0A, 0x35, 0x08, 0x37, 0x06, 0x39, 0x03, 0xFF, 0xEA, 0xFF, 0xC5,
+	0x16, 0x12, 0x1B, 0x0E, 0x1D, 0x0C, 0x1F, 0x0A, 0x20, 0x09, 0x21, 0x08, 0x22, 0x07, 0x09, 0x0C,
+	0x0E, 0x06, 0x09, 0x0F, 0x0B, 0x06, 0x09, 0x10, 0x0B, 0x05, 0x09, 0x11, 0x0A, 0x05, 0x09, 0x12,
+	0x09, 0x05, 0x09, 0x12, 0x0A, 0x04, 0x09, 0x13, 0x09, 0x04, 0x09, 0x13, 0x09, 0x04, 0x09, 0x13,
+	0x09, 0x04, 0x09, 0x13, 0x09, 0x04, 0x09, 0x13, 0x09, 0x04, 0x09, 0x13, 0x09, 0x04, 0x09, 0x13,
+	0x09, 0x04, 0x09, 0x12, 0x0A, 0x04, 0x09, 0x12, 0x09, 0x05, 0x09, 0x12, 0x09, 0x05, 0x09, 0x11,
+	0x09, 0x06, 0x09, 0x10, 0x0A, 0x06, 0x09, 0x0E, 0x0B, 0x07, 0x09, 0x0C, 0x0C, 0x08, 0x20, 0x09,
+	0x1F, 0x0A, 0x1E, 0x0B, 0x1C, 0x0D, 0x1A, 0x0F, 0x1C, 0x0D, 0x1D, 0x0C, 0x09, 0x09, 0x0C, 0x0B,
+	0x09, 0x0B, 0x0B, 0x0A, 0x09, 0x0D, 0x09, 0x0A, 0x09, 0x0E, 0x09, 0x09, 0x09, 0x0E, 0x09, 0x09,
+	0x09, 0x0F, 0x09, 0x08, 0x09, 0x10, 0x08, 0x08, 0x09, 0x10, 0x09, 0x07, 0x09, 0x11, 0x08, 0x07,
+	0x09, 0x11, 0x09, 0x06, 0x09, 0x11, 0x09, 0x06, 0x09, 0x12, 0x09, 0x05, 0x09, 0x12, 0x09, 0x05,
+	0x09, 0x13, 0x08, 0x05, 0x09, 0x13, 0x09, 0x04, 0x09, 0x13, 0x09, 0x04, 0x09, 0x14, 0x09, 0x03,
+	0x09, 0x14, 0x09, 0x03, 0x09, 0x15, 0x08, 0x03, 0x09, 0x15, 0x09, 0x02, 0x09, 0x15, 0x09, 0x02,
+	0x09, 0x16, 0x09, 0x01, 0x09, 0x16, 0x09, 0x01, 0x09, 0x17, 0x08, 0x01, 0x09, 0x17, 0x12, 0x17,
+	0x09, 0x01, 0x07, 0x19, 0x07, 0xFF, 0xFF, 0xBC, 0xFF, 0x82, 0x0A, 0x17, 0x12, 0x11, 0x16, 0x0D,
+	0x1A, 0x0A, 0x1C, 0x08, 0x1D, 0x07, 0x1E, 0x06, 0x0D, 0x08, 0x0A, 0x06, 0x0B, 0x0D, 0x07, 0x05,
+	0x0A, 0x11, 0x05, 0x05, 0x09, 0x14, 0x03, 0x05, 0x09, 0x1B, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C,
+	0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x0A, 0x1B, 0x0A, 0x1C, 0x0A, 0x1B, 0x0B, 0x1A, 0x0C, 0x1A,
+	0x0C, 0x19, 0x0E, 0x18, 0x0E, 0x18, 0x10, 0x16, 0x11, 0x15, 0x12, 0x14, 0x13, 0x13, 0x13, 0x14,
+	0x13, 0x14, 0x12, 0x15, 0x11, 0x16, 0x10, 0x17, 0x0F, 0x18, 0x0E, 0x19, 0x0C, 0x1A, 0x0C, 0x1A,
+	0x0B, 0x1B, 0x0A, 0x1C, 0x0A, 0x1B, 0x0A, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C, 0x09, 0x1C,
+	0x09, 0x1C, 0x09, 0x1B, 0x0A, 0x1B, 0x09, 0x02, 0x02, 0x17, 0x0A, 0x01, 0x04, 0x16, 0x09, 0x02,
+	0x06, 0x13, 0x0A, 0x02, 0x09, 0x0E, 0x0B, 0x03, 0x0C, 0x09, 0x0D, 0x03, 0x21, 0x04, 0x20, 0x06,
+	0x1E, 0x08, 0x1C, 0x0B, 0x18, 0x10, 0x13, 0x16, 0x0B, 0xFF, 0xFF, 0x61, 0xFF, 0xFF, 0x08, 0x2D,
+	0x01, 0xEB, 0x01, 0x2D, 0x14, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09,
+	0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09,
+	0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09,
+	0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09,
+	0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09,
+	0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09,
+	0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x27, 0x07,
+	0xFF, 0xFF, 0xFF, 0x36, 0xFF, 0xFC, 0x07, 0x1E, 0x07, 0x01, 0x09, 0x1C, 0x12, 0x1C, 0x12, 0x1C,
+	0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C,
+	0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C,
+	0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C,
+	0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C,
+	0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C,
+	0x13, 0x1A, 0x09, 0x02, 0x09, 0x1A, 0x09, 0x02, 0x09, 0x1A, 0x09, 0x02, 0x0A, 0x18, 0x0A, 0x02,
+	0x0A, 0x18, 0x09, 0x04, 0x0A, 0x16, 0x0A, 0x04, 0x0B, 0x15, 0x0A, 0x05, 0x0A, 0x14, 0x0A, 0x06,
+	0x0C, 0x11, 0x0A, 0x08, 0x0C, 0x0E, 0x0C, 0x09, 0x0E, 0x08, 0x0E, 0x0A, 0x23, 0x0C, 0x21, 0x0F,
+	0x1E, 0x11, 0x1B, 0x15, 0x18, 0x18, 0x13, 0x1F, 0x0B, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x33, 0x08,
+	0x24, 0x10, 0x22, 0x11, 0x22, 0x08, 0x01, 0x08, 0x21, 0x09, 0x01, 0x09, 0x20, 0x08, 0x02, 0x09,
+	0x20, 0x08, 0x03, 0x08, 0x1F, 0x09, 0x03, 0x09, 0x1E, 0x08, 0x04, 0x09, 0x1E, 0x08, 0x05, 0x08,
+	0x1D, 0x08, 0x06, 0x09, 0x1C, 0x08, 0x06, 0x09, 0x1C, 0x08, 0x07, 0x08, 0x1B, 0x08, 0x08, 0x09,
+	0x1A, 0x08, 0x08, 0x09, 0x1A, 0x08, 0x09, 0x08, 0x19, 0x08, 0x0A, 0x09, 0x18, 0x08, 0x0A, 0x09,
+	0x18, 0x08, 0x0B, 0x08, 0x17, 0x08, 0x0C, 0x09, 0x16, 0x08, 0x0D, 0x08, 0x16, 0x08, 0x0D, 0x08,
+	0x15, 0x08, 0x0E, 0x09, 0x14, 0x08, 0x0F, 0x08, 0x14, 0x08, 0x0F, 0x08, 0x13, 0x08, 0x10, 0x09,
+	0x12, 0x08, 0x11, 0x08, 0x12, 0x07, 0x12, 0x08, 0x11, 0x08, 0x12, 0x09, 0x10, 0x08, 0x13, 0x08,
+	0x10, 0x07, 0x14, 0x08, 0x0F, 0x08, 0x14, 0x09, 0x0E, 0x08, 0x15, 0x08, 0x0E, 0x07, 0x16, 0x09,
+	0x0C, 0x08, 0x16, 0x09, 0x0C, 0x08, 0x17, 0x08, 0x0C, 0x07, 0x18, 0x09, 0x0A, 0x08, 0x19, 0x08,
+	0x0A, 0x08, 0x19, 0x08, 0x0A, 0x07, 0x1A, 0x09, 0x08, 0x08, 0x1B, 0x08, 0x08, 0x08, 0x1B, 0x08,
+	0x08, 0x07, 0x1C, 0x09, 0x06, 0x08, 0x1D, 0x08, 0x06, 0x07, 0x1E, 0x08, 0x06, 0x07, 0x1E, 0x09,
+	0x04, 0x08, 0x1F, 0x08, 0x04, 0x07, 0x20, 0x08, 0x04, 0x07, 0x20, 0x09, 0x02, 0x08, 0x21, 0x08,
+	0x02, 0x07, 0x22, 0x08, 0x02, 0x07, 0x22, 0x11, 0x23, 0x0F, 0x24, 0x0F, 0x25, 0x0E, 0x25, 0x0D,
+	0x26, 0x0D, 0x27, 0x0C, 0x27, 0x0B, 0x28, 0x0B, 0x29, 0x09, 0xFF, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF,
+	0xFF, 0x68, 0x08, 0x1C, 0x07, 0x1D, 0x0F, 0x1B, 0x09, 0x1B, 0x11, 0x1A, 0x09, 0x1B, 0x11, 0x1A,
+	0x09, 0x1B, 0x08, 0x01, 0x08, 0x19, 0x0B, 0x1A, 0x08, 0x01, 0x08, 0x19, 0x0B, 0x19, 0x09, 0x01,
+	0x09, 0x18, 0x0B, 0x19, 0x08, 0x02, 0x09, 0x18, 0x0C, 0x18, 0x08, 0x03, 0x08, 0x17, 0x0D, 0x18,
+	0x08, 0x03, 0x08, 0x17, 0x0D, 0x17, 0x08, 0x04, 0x09, 0x16, 0x0D, 0x17, 0x08, 0x05, 0x08, 0x16,
+	0x0E, 0x16, 0x08, 0x05, 0x08, 0x15, 0x0F, 0x16, 0x08, 0x05, 0x09, 0x14, 0x0F, 0x15, 0x08, 0x06,
+	0x09, 0x14, 0x07, 0x01, 0x08, 0x14, 0x08, 0x07, 0x08, 0x14, 0x07, 0x01, 0x08, 0x14, 0x08, 0x07,
+	0x08, 0x13, 0x07, 0x02, 0x08, 0x13, 0x08, 0x08, 0x09, 0x12, 0x07, 0x02, 0x08, 0x13, 0x08, 0x09,
+	0x08, 0x12, 0x07, 0x03, 0x08, 0x12, 0x08, 0x09, 0x08, 0x11, 0x08, 0x03, 0x08, 0x12, 0x08, 0x09,
+	0x08, 0x11, 0x07, 0x04, 0x08, 0x11, 0x08, 0x0A, 0x09, 0x10, 0x07, 0x05, 0x07, 0x11, 0x08, 0x0B,
+	0x08, 0x10, 0x07, 0x05, 0x08, 0x10, 0x08, 0x0B, 0x08, 0x0F, 0x08, 0x05, 0x08, 0x10, 0x07, 0x0C,
+	0x09, 0x0E, 0x07, 0x06, 0x08, 0x0F, 0x08, 0x0D, 0x08, 0x0E, 0x07, 0x07, 0x08, 0x0E, 0x08, 0x0D,
+	0x08, 0x0E, 0x07, 0x07, 0x08, 0x0E, 0x07, 0x0E, 0x08, 0x0D, 0x07, 0x08, 0x08, 0x0E, 0x07, 0x0E,
+	0x09, 0x0C, 0x07, 0x08, 0x08, 0x0D, 0x08, 0x0F, 0x08, 0x0C, 0x07, 0x09, 0x08, 0x0C, 0x08, 0x0F,
+	0x08, 0x0C, 0x07, 0x09, 0x08, 0x0C, 0x07, 0x10, 0x08, 0x0B, 0x07, 0x0A, 0x08, 0x0C, 0x07, 0x11,
+	0x08, 0x0A, 0x07, 0x0B, 0x07, 0x0B, 0x08, 0x11, 0x08, 0x0A, 0x07, 0x0B, 0x08, 0x0A, 0x07, 0x12,
+	0x08, 0x0A, 0x07, 0x0B, 0x08, 0x0A, 0x07, 0x12, 0x09, 0x08, 0x07, 0x0C, 0x08, 0x09, 0x08, 0x13,
+	0x08, 0x08, 0x07, 0x0D, 0x08, 0x08, 0x08, 0x13, 0x08, 0x08, 0x07, 0x0D, 0x08, 0x08, 0x07, 0x14,
+	0x08, 0x08, 0x07, 0x0D, 0x08, 0x08, 0x07, 0x15, 0x08, 0x06, 0x07, 0x0F, 0x07, 0x07, 0x08, 0x15,
+	0x08, 0x06, 0x07, 0x0F, 0x08, 0x06, 0x07, 0x16, 0x08, 0x06, 0x07, 0x0F, 0x08, 0x06, 0x07, 0x16,
+	0x08, 0x06, 0x07, 0x0F, 0x08, 0x06, 0x07, 0x17, 0x08, 0x04, 0x07, 0x11, 0x08, 0x04, 0x08, 0x17,
+	0x08, 0x04, 0x07, 0x11, 0x08, 0x04, 0x07, 0x18, 0x08, 0x04, 0x07, 0x11, 0x08, 0x04, 0x07, 0x19,
+	0x07, 0x04, 0x07, 0x11, 0x08, 0x04, 0x07, 0x19, 0x08, 0x02, 0x07, 0x13, 0x08, 0x02, 0x07, 0x1A,
+	0x08, 0x02, 0x07, 0x13, 0x08, 0x02, 0x07, 0x1B, 0x07, 0x02, 0x07, 0x13, 0x08, 0x02, 0x07, 0x1B,
+	0x08, 0x01, 0x07, 0x14, 0x07, 0x02, 0x07, 0x1B, 0x0F, 0x15, 0x0F, 0x1C, 0x0F, 0x15, 0x0F, 0x1D,
+	0x0E, 0x15, 0x0F, 0x1D, 0x0E, 0x16, 0x0D, 0x1E, 0x0D, 0x17, 0x0D, 0x1F, 0x0C, 0x17, 0x0D, 0x1F,
+	0x0C, 0x18, 0x0C, 0x1F, 0x0C, 0x18, 0x0B, 0x20, 0x0B, 0x19, 0x0B, 0x21, 0x09, 0x1B, 0x09, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xF1, 0x08, 0x1C, 0x07, 0x02, 0x09, 0x1A, 0x09, 0x01, 0x0A,
+	0x19, 0x08, 0x03, 0x09, 0x18, 0x09, 0x04, 0x09, 0x16, 0x09, 0x05, 0x0A, 0x15, 0x09, 0x06, 0x09,
+	0x14, 0x09, 0x07, 0x0A, 0x13, 0x08, 0x09, 0x09, 0x12, 0x09, 0x0A, 0x09, 0x11, 0x08, 0x0B, 0x09,
+	0x10, 0x09, 0x0C, 0x09, 0x0E, 0x09, 0x0D, 0x0A, 0x0D, 0x09, 0x0E, 0x09, 0x0C, 0x09, 0x10, 0x09,
+	0x0B, 0x08, 0x11, 0x09, 0x0A, 0x09, 0x12, 0x09, 0x09, 0x08, 0x13, 0x09, 0x08, 0x09, 0x14, 0x09,
+	0x06, 0x09, 0x15, 0x0A, 0x05, 0x08, 0x17, 0x09, 0x04, 0x09, 0x18, 0x09, 0x03, 0x08, 0x19, 0x09,
+	0x02, 0x09, 0x1A, 0x09, 0x01, 0x08, 0x1B, 0x11, 0x1D, 0x10, 0x1E, 0x0E, 0x1F, 0x0E, 0x20, 0x0C,
+	0x21, 0x0B, 0x22, 0x0C, 0x21, 0x0C, 0x20, 0x0E, 0x1F, 0x0E, 0x1E, 0x10, 0x1C, 0x12, 0x1B, 0x08,
+	0x01, 0x09, 0x1A, 0x09, 0x02, 0x09, 0x19, 0x08, 0x03, 0x09, 0x18, 0x09, 0x04, 0x09, 0x16, 0x09,
+	0x06, 0x09, 0x15, 0x08, 0x07, 0x09, 0x14, 0x09, 0x08, 0x09, 0x13, 0x08, 0x09, 0x09, 0x12, 0x09,
+	0x0A, 0x09, 0x10, 0x09, 0x0B, 0x09, 0x10, 0x09, 0x0C, 0x09, 0x0E, 0x09, 0x0E, 0x09, 0x0D, 0x08,
+	0x0F, 0x09, 0x0C, 0x09, 0x10, 0x09, 0x0A, 0x09, 0x11, 0x09, 0x0A, 0x09, 0x12, 0x09, 0x08, 0x09,
+	0x13, 0x0A, 0x07, 0x09, 0x14, 0x09, 0x06, 0x09, 0x15, 0x0A, 0x04, 0x09, 0x17, 0x09, 0x04, 0x09,
+	0x18, 0x09, 0x02, 0x09, 0x19, 0x09, 0x02, 0x09, 0x1A, 0x12, 0x1B, 0x09, 0x01, 0x07, 0x1D, 0x08,
+	0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xF0, 0x08, 0x1D, 0x07, 0x01, 0x09, 0x1B, 0x09, 0x01, 0x09, 0x1A,
+	0x08, 0x02, 0x09, 0x19, 0x09, 0x03, 0x08, 0x19, 0x08, 0x04, 0x09, 0x17, 0x09, 0x05, 0x08, 0x17,
+	0x08, 0x06, 0x09, 0x15, 0x09, 0x07, 0x08, 0x15, 0x08, 0x08, 0x09, 0x13, 0x09, 0x09, 0x08, 0x13,
+	0x08, 0x0A, 0x09, 0x11, 0x09, 0x0B, 0x08, 0x11, 0x08, 0x0C, 0x09, 0x0F, 0x09, 0x0D, 0x08, 0x0F,
+	0x08, 0x0E, 0x09, 0x0D, 0x09, 0x0F, 0x08, 0x0D, 0x08, 0x10, 0x09, 0x0C, 0x08, 0x11, 0x08, 0x0B,
+	0x08, 0x12, 0x09, 0x0A, 0x08, 0x13, 0x08, 0x09, 0x08, 0x14, 0x09, 0x08, 0x08, 0x15, 0x08, 0x07,
+	0x08, 0x16, 0x09, 0x06, 0x08, 0x17, 0x08, 0x05, 0x08, 0x18, 0x09, 0x04, 0x08, 0x19, 0x08, 0x03,
+	0x08, 0x1A, 0x09, 0x02, 0x08, 0x1B, 0x08, 0x01, 0x08, 0x1C, 0x11, 0x1D, 0x0F, 0x1E, 0x0F, 0x1F,
+	0x0D, 0x20, 0x0D, 0x21, 0x0B, 0x22, 0x0B, 0x23, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24,
+	0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24,
+	0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x24,
+	0x09, 0x24, 0x09, 0x24, 0x09, 0x24, 0x09, 0x25, 0x07, 0xFF, 0xFF, 0xFF, 0x13, 0xFF, 0xBA, 0x25,
+	0x03, 0x25, 0x02, 0x27, 0x01, 0x27, 0x01, 0x27, 0x02, 0x26, 0x02, 0x26, 0x1E, 0x09, 0x1F, 0x09,
+	0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09,
+	0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09,
+	0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09,
+	0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09,
+	0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1E, 0x09,
+	0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x09, 0x1E, 0x09, 0x1F, 0x27, 0x01, 0xC8, 0x01, 0x26,
+	0xFF, 0xFF, 0xAB, 0x61, 0x66, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x50, 0x01,
+	0x0F, 0x20, 0x6C, 0x07, 0x1D, 0x07, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x07, 0x1D, 0x08, 0x1C, 0x08,
+	0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x07, 0x1D, 0x08, 0x1C, 0x08,
+	0x1D, 0x07, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08,
+	0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x07, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08,
+	0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x07, 0x1D, 0x08,
+	0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08,
+	0x1C, 0x08, 0x1D, 0x07, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08,
+	0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x07, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x08,
+	0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x07,
+	0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x07, 0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08,
+	0x1D, 0x08, 0x1C, 0x08, 0x1D, 0x07, 0x90, 0x67, 0x0E, 0x02, 0x10, 0x01, 0x10, 0x01, 0x22, 0x01,
+	0x10, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09,
+	0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x09, 0x08, 0x01, 0x42, 0x01, 0x10, 0x02,
+	0x0E, 0x24, 0xFF, 0xB2, 0x07, 0x1E, 0x09, 0x1C, 0x0B, 0x1B, 0x0B, 0x1A, 0x0D, 0x19, 0x0D, 0x19,
+	0x0E, 0x17, 0x0F, 0x17, 0x07, 0x01, 0x08, 0x15, 0x08, 0x01, 0x08, 0x15, 0x07, 0x03, 0x07, 0x14,
+	0x08, 0x03, 0x08, 0x13, 0x07, 0x05, 0x07, 0x13, 0x07, 0x05, 0x08, 0x11, 0x08, 0x05, 0x08, 0x11,
+	0x07, 0x07, 0x08, 0x0F, 0x08, 0x07, 0x08, 0x0F, 0x07, 0x09, 0x08, 0x0D, 0x08, 0x09, 0x08, 0x0D,
+	0x08, 0x09, 0x08, 0x0D, 0x07, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x07, 0x0D, 0x08, 0x09,
+	0x08, 0x0D, 0x08, 0x09, 0x08, 0x0E, 0x08, 0x07, 0x08, 0x0F, 0x08, 0x07, 0x08, 0x0F, 0x09, 0x05,
+	0x08, 0x11, 0x08, 0x05, 0x08, 0x11, 0x08, 0x05, 0x08, 0x12, 0x08, 0x03, 0x08, 0x13, 0x08, 0x03,
+	0x08, 0x13, 0x09, 0x01, 0x08, 0x15, 0x08, 0x01, 0x08, 0x15, 0x10, 0x17, 0x07, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xA0, 0x2E, 0x01, 0xC0, 0x01, 0x2E, 0x01, 0x4B, 0x07, 0x08, 0x08, 0x07, 0x09,
+	0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x09, 0x07, 0x08, 0x08,
+	0x08, 0x07, 0x09, 0x07, 0x09, 0x06, 0x0A, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
+	0x9E, 0x0B, 0x14, 0x12, 0x0F, 0x16, 0x0B, 0x1A, 0x07, 0x1D, 0x05, 0x1E, 0x05, 0x0B, 0x08, 0x0C,
+	0x04, 0x08, 0x0E, 0x0A, 0x03, 0x06, 0x11, 0x09, 0x03, 0x04, 0x14, 0x08, 0x04, 0x02, 0x15, 0x08,
+	0x1B, 0x09, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08,
+	0x0E, 0x15, 0x0A, 0x19, 0x08, 0x1B, 0x06, 0x1D, 0x04, 0x1F, 0x03, 0x20, 0x03, 0x0C, 0x0C, 0x08,
+	0x02, 0x0A, 0x0F, 0x08, 0x01, 0x0A, 0x10, 0x08, 0x01, 0x09, 0x11, 0x08, 0x01, 0x08, 0x12, 0x10,
+	0x13, 0x10, 0x13, 0x10, 0x13, 0x10, 0x13, 0x10, 0x13, 0x10, 0x12, 0x12, 0x10, 0x13, 0x0F, 0x0B,
+	0x01, 0x09, 0x0D, 0x0C, 0x01, 0x0A, 0x0A, 0x0E, 0x02, 0x0B, 0x06, 0x10, 0x02, 0x19, 0x01, 0x07,
+	0x03, 0x17, 0x02, 0x07, 0x04, 0x15, 0x03, 0x07, 0x05, 0x12, 0x05, 0x07, 0x07, 0x0E, 0x08, 0x06,
+	0x0A, 0x09, 0xFF, 0xFF, 0x42, 0xFF, 0x13, 0x06, 0x20, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08,
+	0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08,
+	0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x0A, 0x08,
+	0x0D, 0x08, 0x07, 0x0E, 0x0A, 0x08, 0x05, 0x12, 0x08, 0x08, 0x04, 0x14, 0x07, 0x08, 0x03, 0x16,
+	0x06, 0x08, 0x02, 0x18, 0x05, 0x08, 0x01, 0x1A, 0x04, 0x11, 0x06, 0x0D, 0x03, 0x0F, 0x0A, 0x0B,
+	0x03, 0x0D, 0x0D, 0x0B, 0x02, 0x0C, 0x0F, 0x0A, 0x02, 0x0B, 0x11, 0x09, 0x02, 0x0A, 0x12, 0x0A,
+	0x01, 0x09, 0x13, 0x0A, 0x01, 0x08, 0x15, 0x09, 0x01, 0x08, 0x15, 0x09, 0x01, 0x08, 0x15, 0x12,
+	0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11,
+	0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x15, 0x12, 0x15, 0x09, 0x01, 0x08, 0x15, 0x09,
+	0x01, 0x08, 0x15, 0x09, 0x01, 0x09, 0x13, 0x0A, 0x01, 0x0A, 0x12, 0x09, 0x02, 0x0B, 0x10, 0x0A,
+	0x02, 0x0C, 0x0F, 0x0A, 0x02, 0x0D, 0x0D, 0x0A, 0x03, 0x0F, 0x0A, 0x0B, 0x03, 0x11, 0x06, 0x0C,
+	0x04, 0x07, 0x01, 0x1A, 0x05, 0x07, 0x02, 0x19, 0x05, 0x07, 0x03, 0x17, 0x06, 0x07, 0x04, 0x14,
+	0x08, 0x07, 0x06, 0x11, 0x09, 0x07, 0x07, 0x0E, 0x1C, 0x08, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+	0x6C, 0x09, 0x15, 0x0F, 0x10, 0x13, 0x0C, 0x16, 0x0A, 0x18, 0x08, 0x1A, 0x06, 0x1C, 0x04, 0x0D,
+	0x07, 0x09, 0x04, 0x0B, 0x0B, 0x07, 0x03, 0x0A, 0x0F, 0x05, 0x03, 0x09, 0x11, 0x04, 0x02, 0x0A,
+	0x12, 0x02, 0x03, 0x09, 0x17, 0x0A, 0x17, 0x09, 0x18, 0x09, 0x18, 0x09, 0x17, 0x0A, 0x17, 0x09,
+	0x18, 0x09, 0x18, 0x09, 0x18, 0x09, 0x18, 0x09, 0x18, 0x09, 0x18, 0x09, 0x18, 0x09, 0x18, 0x09,
+	0x18, 0x09, 0x18, 0x09, 0x18, 0x09, 0x18, 0x0A, 0x18, 0x09, 0x18, 0x09, 0x18, 0x0A, 0x17, 0x0A,
+	0x18, 0x0A, 0x13, 0x02, 0x02, 0x0A, 0x11, 0x04, 0x03, 0x0A, 0x0F, 0x05, 0x03, 0x0C, 0x0B, 0x07,
+	0x04, 0x0D, 0x07, 0x09, 0x04, 0x1D, 0x05, 0x1B, 0x07, 0x1A, 0x08, 0x17, 0x0C, 0x14, 0x0F, 0x0F,
+	0x15, 0x09, 0xFF, 0xFF, 0x1C, 0xFF, 0x32, 0x06, 0x20, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08,
+	0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08,
+	0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x0E, 0x08, 0x09, 0x08,
+	0x0B, 0x0E, 0x06, 0x08, 0x09, 0x11, 0x05, 0x08, 0x07, 0x15, 0x03, 0x08, 0x06, 0x17, 0x02, 0x08,
+	0x05, 0x19, 0x01, 0x08, 0x05, 0x22, 0x04, 0x0C, 0x06, 0x11, 0x03, 0x0B, 0x0A, 0x0F, 0x03, 0x0A,
+	0x0D, 0x0D, 0x02, 0x0A, 0x0F, 0x0C, 0x02, 0x0A, 0x10, 0x0B, 0x02, 0x09, 0x12, 0x0A, 0x01, 0x0A,
+	0x13, 0x09, 0x01, 0x09, 0x15, 0x08, 0x01, 0x09, 0x15, 0x08, 0x01, 0x09, 0x15, 0x12, 0x15, 0x11,
+	0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11,
+	0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x12, 0x15, 0x08, 0x01, 0x09, 0x15, 0x08, 0x01, 0x09,
+	0x15, 0x08, 0x01, 0x0A, 0x13, 0x09, 0x01, 0x0A, 0x12, 0x0A, 0x02, 0x09, 0x11, 0x0B, 0x02, 0x0A,
+	0x0F, 0x0C, 0x02, 0x0B, 0x0D, 0x0D, 0x03, 0x0B, 0x0A, 0x0F, 0x03, 0x0D, 0x06, 0x11, 0x04, 0x1B,
+	0x01, 0x07, 0x05, 0x19, 0x02, 0x07, 0x06, 0x17, 0x03, 0x07, 0x07, 0x14, 0x05, 0x07, 0x08, 0x12,
+	0x06, 0x07, 0x0A, 0x0E, 0x08, 0x07, 0x0D, 0x08, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0x09,
+	0x0A, 0x1A, 0x11, 0x14, 0x15, 0x11, 0x17, 0x0E, 0x1A, 0x0C, 0x1C, 0x0A, 0x0C, 0x07, 0x0B, 0x09,
+	0x0A, 0x0B, 0x0A, 0x07, 0x09, 0x0F, 0x08, 0x06, 0x09, 0x10, 0x09, 0x05, 0x09, 0x11, 0x08, 0x04,
+	0x09, 0x13, 0x08, 0x03, 0x08, 0x14, 0x08, 0x03, 0x08, 0x14, 0x08, 0x02, 0x09, 0x15, 0x07, 0x02,
+	0x08, 0x16, 0x08, 0x01, 0x08, 0x16, 0x08, 0x01, 0x08, 0x16, 0x11, 0x16, 0xF1, 0x01, 0x09, 0x1E,
+	0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1E, 0x09, 0x1E, 0x09, 0x1F,
+	0x09, 0x1E, 0x09, 0x1E, 0x0A, 0x1E, 0x0A, 0x1D, 0x0B, 0x14, 0x03, 0x06, 0x0B, 0x10, 0x06, 0x07,
+	0x0D, 0x0A, 0x09, 0x08, 0x1F, 0x09, 0x1E, 0x0A, 0x1C, 0x0D, 0x19, 0x10, 0x14, 0x16, 0x0C, 0xFF,
+	0xFF, 0x7E, 0xB8, 0x09, 0x10, 0x0E, 0x0D, 0x10, 0x0B, 0x11, 0x0A, 0x12, 0x09, 0x13, 0x09, 0x09,
+	0x06, 0x04, 0x08, 0x09, 0x13, 0x08, 0x14, 0x08, 0x14, 0x08, 0x13, 0x08, 0x14, 0x08, 0x14, 0x08,
+	0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x0D, 0x19,
+	0x03, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x02, 0x19, 0x0A, 0x08, 0x14, 0x08, 0x14, 0x08,
+	0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08,
+	0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08,
+	0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08,
+	0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x14, 0x08,
+	0x14, 0x08, 0x14, 0x08, 0x14, 0x08, 0x15, 0x06, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0x09,
+	0x1C, 0x1B, 0x0B, 0x1E, 0x08, 0x20, 0x07, 0x21, 0x06, 0x22, 0x06, 0x0A, 0x06, 0x11, 0x06, 0x09,
+	0x0A, 0x09, 0x0B, 0x09, 0x0D, 0x07, 0x0B, 0x08, 0x0E, 0x08, 0x0A, 0x07, 0x10, 0x07, 0x09, 0x08,
+	0x10, 0x08, 0x08, 0x07, 0x12, 0x07, 0x08, 0x07, 0x12, 0x07, 0x08, 0x07, 0x12, 0x07, 0x08, 0x07,
+	0x12, 0x07, 0x08, 0x07, 0x12, 0x07, 0x08, 0x07, 0x12, 0x07, 0x08, 0x07, 0x12, 0x07, 0x08, 0x08,
+	0x10, 0x08, 0x09, 0x07, 0x10, 0x07, 0x0A, 0x08, 0x0E, 0x08, 0x0A, 0x08, 0x0E, 0x08, 0x0B, 0x09,
+	0x0A, 0x09, 0x0D, 0x0A, 0x06, 0x0B, 0x0D, 0x1A, 0x0D, 0x1A, 0x0D, 0x1A, 0x0E, 0x18, 0x0F, 0x07,
+	0x02, 0x0F, 0x10, 0x06, 0x06, 0x09, 0x12, 0x07, 0x21, 0x07, 0x21, 0x07, 0x21, 0x07, 0x21, 0x08,
+	0x20, 0x0A, 0x1F, 0x17, 0x11, 0x1D, 0x0C, 0x1E, 0x0C, 0x1E, 0x09, 0x20, 0x07, 0x22, 0x05, 0x09,
+	0x0E, 0x0D, 0x03, 0x09, 0x12, 0x0A, 0x03, 0x08, 0x15, 0x09, 0x01, 0x08, 0x16, 0x09, 0x01, 0x08,
+	0x17, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x17, 0x08, 0x01, 0x09, 0x15, 0x09,
+	0x01, 0x0A, 0x13, 0x0A, 0x02, 0x0A, 0x11, 0x0A, 0x03, 0x0D, 0x0B, 0x0C, 0x05, 0x22, 0x07, 0x20,
+	0x09, 0x1E, 0x0C, 0x1A, 0x10, 0x16, 0x16, 0x0E, 0x0E, 0xFF, 0x05, 0x06, 0x1E, 0x08, 0x1D, 0x08,
+	0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08,
+	0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08, 0x1D, 0x08,
+	0x1D, 0x08, 0x0A, 0x08, 0x0B, 0x08, 0x07, 0x0E, 0x08, 0x08, 0x05, 0x12, 0x06, 0x08, 0x04, 0x14,
+	0x05, 0x08, 0x03, 0x16, 0x04, 0x08, 0x01, 0x19, 0x03, 0x22, 0x03, 0x11, 0x06, 0x0C, 0x02, 0x0F,
+	0x0A, 0x0A, 0x02, 0x0E, 0x0C, 0x0A, 0x01, 0x0C, 0x0F, 0x09, 0x01, 0x0B, 0x11, 0x08, 0x01, 0x0A,
+	0x12, 0x12, 0x13, 0x11, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+	0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+	0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+	0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+	0x15, 0x08, 0x01, 0x06, 0x17, 0x06, 0xFF, 0xFF, 0x78, 0x66, 0x06, 0x03, 0x08, 0x01, 0x32, 0x01,
+	0x08, 0x03, 0x06, 0x54, 0x06, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x03, 0x06, 0xAC, 0xC9, 0x06,
+	0x0C, 0x08, 0x0A, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x0A, 0x08, 0x0C, 0x06,
+	0xA5, 0x06, 0x0C, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08,
+	0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08,
+	0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08,
+	0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08,
+	0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08,
+	0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08,
+	0x0B, 0x08, 0x0B, 0x08, 0x0B, 0x08, 0x0A, 0x09, 0x0A, 0x08, 0x0A, 0x09, 0x09, 0x0A, 0x02, 0x11,
+	0x02, 0x10, 0x03, 0x0F, 0x04, 0x0F, 0x04, 0x0E, 0x05, 0x0C, 0x09, 0x08, 0x09, 0xF6, 0x06, 0x1C,
+	0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B,
+	0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B,
+	0x08, 0x1B, 0x08, 0x1B, 0x08, 0x1B, 0x08, 0x11, 0x08, 0x02, 0x08, 0x10, 0x09, 0x02, 0x08, 0x0F,
+	0x0A, 0x02, 0x08, 0x0E, 0x0A, 0x03, 0x08, 0x0D, 0x0A, 0x04, 0x08, 0x0C, 0x0A, 0x05, 0x08, 0x0B,
+	0x0A, 0x06, 0x08, 0x0B, 0x09, 0x07, 0x08, 0x0A, 0x09, 0x08, 0x08, 0x09, 0x09, 0x09, 0x08, 0x08,
+	0x09, 0x0A, 0x08, 0x07, 0x09, 0x0B, 0x08, 0x06, 0x09, 0x0C, 0x08, 0x05, 0x09, 0x0D, 0x08, 0x04,
+	0x09, 0x0E, 0x08, 0x03, 0x09, 0x0F, 0x08, 0x02, 0x09, 0x10, 0x08, 0x01, 0x0A, 0x10, 0x08, 0x01,
+	0x09, 0x11, 0x11, 0x12, 0x12, 0x11, 0x08, 0x01, 0x0A, 0x10, 0x08, 0x02, 0x0A, 0x0F, 0x08, 0x03,
+	0x09, 0x0F, 0x08, 0x03, 0x0A, 0x0E, 0x08, 0x04, 0x0A, 0x0D, 0x08, 0x05, 0x0A, 0x0C, 0x08, 0x06,
+	0x09, 0x0C, 0x08, 0x06, 0x0A, 0x0B, 0x08, 0x07, 0x0A, 0x0A, 0x08, 0x08, 0x0A, 0x09, 0x08, 0x09,
+	0x09, 0x09, 0x08, 0x09, 0x0A, 0x08, 0x08, 0x0A, 0x0A, 0x07, 0x08, 0x0B, 0x0A, 0x06, 0x08, 0x0C,
+	0x09, 0x06, 0x08, 0x0D, 0x09, 0x05, 0x08, 0x0D, 0x0A, 0x04, 0x08, 0x0E, 0x0A, 0x03, 0x08, 0x0F,
+	0x0A, 0x02, 0x08, 0x10, 0x09, 0x02, 0x08, 0x10, 0x0A, 0x01, 0x08, 0x11, 0x12, 0x12, 0x09, 0x01,
+	0x06, 0x14, 0x07, 0xFF, 0xFF, 0x56, 0x39, 0x06, 0x01, 0xFF, 0xF9, 0x01, 0x06, 0x89, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x08, 0x13, 0x08, 0x0A, 0x07, 0x08, 0x0D, 0x0F, 0x0D, 0x07, 0x07,
+	0x06, 0x11, 0x0B, 0x10, 0x06, 0x07, 0x05, 0x13, 0x09, 0x12, 0x05, 0x07, 0x04, 0x15, 0x07, 0x14,
+	0x04, 0x07, 0x03, 0x17, 0x04, 0x17, 0x03, 0x07, 0x02, 0x18, 0x03, 0x19, 0x02, 0x07, 0x01, 0x09,
+	0x05, 0x0C, 0x02, 0x08, 0x06, 0x0B, 0x02, 0x0F, 0x09, 0x0A, 0x01, 0x08, 0x09, 0x0A, 0x01, 0x0D,
+	0x0C, 0x10, 0x0C, 0x09, 0x01, 0x0C, 0x0E, 0x0E, 0x0D, 0x09, 0x01, 0x0B, 0x10, 0x0C, 0x0F, 0x08,
+	0x01, 0x0A, 0x11, 0x0B, 0x10, 0x12, 0x12, 0x0A, 0x11, 0x11, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08,
+	0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08,
+	0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08,
+	0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08,
+	0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08,
+	0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08,
+	0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08,
+	0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08, 0x13, 0x10, 0x14, 0x08,
+	0x13, 0x10, 0x14, 0x08, 0x13, 0x08, 0x01, 0x06, 0x16, 0x06, 0x15, 0x06, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x34, 0xFF, 0xFF, 0xFF, 0xD7, 0x08, 0x0B, 0x07, 0x08, 0x0E, 0x08, 0x07, 0x06, 0x12, 0x06, 0x07,
+	0x05, 0x14, 0x05, 0x07, 0x04, 0x16, 0x04, 0x07, 0x03, 0x18, 0x03, 0x07, 0x02, 0x19, 0x03, 0x07,
+	0x01, 0x09, 0x06, 0x0C, 0x02, 0x0F, 0x0A, 0x0A, 0x02, 0x0E, 0x0C, 0x0A, 0x01, 0x0C, 0x0F, 0x09,
+	0x01, 0x0B, 0x11, 0x08, 0x01, 0x0A, 0x12, 0x12, 0x13, 0x11, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+	0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+	0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+	0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x10,
+	0x15, 0x10, 0x15, 0x10, 0x15, 0x10, 0x15, 0x08, 0x01, 0x06, 0x17, 0x06, 0xFF, 0xFF, 0x78, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x58, 0x0B, 0x1C, 0x11, 0x17, 0x15, 0x13, 0x19, 0x10, 0x1B, 0x0D, 0x1E, 0x0C,
+	0x0B, 0x08, 0x0C, 0x0A, 0x0A, 0x0C, 0x0B, 0x08, 0x0A, 0x0E, 0x0B, 0x06, 0x0A, 0x10, 0x0A, 0x06,
+	0x09, 0x12, 0x0A, 0x04, 0x09, 0x14, 0x09, 0x04, 0x09, 0x14, 0x09, 0x04, 0x09, 0x15, 0x09, 0x02,
+	0x09, 0x16, 0x09, 0x02, 0x09, 0x16, 0x09, 0x02, 0x09, 0x16, 0x09, 0x02, 0x08, 0x18, 0x12, 0x18,
+	0x12, 0x18, 0x12, 0x18, 0x12, 0x18, 0x12, 0x18, 0x12, 0x18, 0x12, 0x18, 0x12, 0x18, 0x12, 0x18,
+	0x12, 0x18, 0x12, 0x18, 0x13, 0x16, 0x09, 0x02, 0x09, 0x16, 0x09, 0x02, 0x09, 0x16, 0x09, 0x02,
+	0x09, 0x16, 0x09, 0x02, 0x0A, 0x14, 0x09, 0x04, 0x09, 0x14, 0x09, 0x04, 0x0A, 0x12, 0x0A, 0x04,
+	0x0B, 0x10, 0x0A, 0x06, 0x0B, 0x0E, 0x0B, 0x06, 0x0C, 0x0C, 0x0B, 0x08, 0x0D, 0x08, 0x0C, 0x0A,
+	0x1F, 0x0C, 0x1D, 0x0E, 0x1B, 0x10, 0x19, 0x13, 0x15, 0x17, 0x11, 0x1C, 0x0B, 0xFF, 0xFF, 0xB2,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x08, 0x0D, 0x07, 0x08, 0x0E, 0x0A, 0x07, 0x06, 0x12, 0x08, 0x07,
+	0x05, 0x14, 0x07, 0x07, 0x04, 0x16, 0x06, 0x07, 0x02, 0x19, 0x05, 0x07, 0x01, 0x1B, 0x04, 0x11,
+	0x06, 0x0D, 0x03, 0x0F, 0x0A, 0x0B, 0x03, 0x0D, 0x0D, 0x0B, 0x02, 0x0C, 0x0F, 0x0A, 0x02, 0x0B,
+	0x11, 0x09, 0x02, 0x0A, 0x12, 0x0A, 0x01, 0x09, 0x14, 0x09, 0x01, 0x08, 0x15, 0x09, 0x01, 0x08,
+	0x15, 0x09, 0x01, 0x08, 0x15, 0x12, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11,
+	0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x15, 0x12,
+	0x15, 0x09, 0x01, 0x08, 0x15, 0x09, 0x01, 0x08, 0x15, 0x09, 0x01, 0x09, 0x13, 0x0A, 0x01, 0x0A,
+	0x12, 0x09, 0x02, 0x0B, 0x10, 0x0A, 0x02, 0x0C, 0x0F, 0x0A, 0x02, 0x0D, 0x0D, 0x0A, 0x03, 0x0F,
+	0x09, 0x0C, 0x03, 0x11, 0x06, 0x0C, 0x04, 0x22, 0x05, 0x08, 0x01, 0x19, 0x05, 0x08, 0x02, 0x17,
+	0x06, 0x08, 0x03, 0x14, 0x08, 0x08, 0x05, 0x11, 0x09, 0x08, 0x06, 0x0E, 0x0B, 0x08, 0x09, 0x08,
+	0x0E, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08,
+	0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x20, 0x06,
+	0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x08, 0x1C, 0x0E, 0x07, 0x07, 0x09, 0x11, 0x06, 0x07, 0x08,
+	0x14, 0x04, 0x07, 0x06, 0x17, 0x03, 0x07, 0x05, 0x19, 0x02, 0x07, 0x05, 0x1A, 0x01, 0x07, 0x04,
+	0x0C, 0x06, 0x11, 0x03, 0x0B, 0x0A, 0x0F, 0x03, 0x0A, 0x0D, 0x0D, 0x02, 0x0A, 0x0F, 0x0C, 0x02,
+	0x0A, 0x10, 0x0B, 0x02, 0x09, 0x12, 0x0A, 0x01, 0x0A, 0x13, 0x09, 0x01, 0x09, 0x15, 0x08, 0x01,
+	0x09, 0x15, 0x08, 0x01, 0x09, 0x15, 0x12, 0x15, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16,
+	0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16, 0x11, 0x16,
+	0x12, 0x15, 0x08, 0x01, 0x09, 0x15, 0x08, 0x01, 0x09, 0x15, 0x08, 0x01, 0x0A, 0x13, 0x09, 0x01,
+	0x0A, 0x12, 0x0A, 0x02, 0x09, 0x11, 0x0B, 0x02, 0x0A, 0x0F, 0x0C, 0x02, 0x0B, 0x0D, 0x0D, 0x03,
+	0x0B, 0x0A, 0x0F, 0x03, 0x0D, 0x06, 0x11, 0x04, 0x1A, 0x01, 0x08, 0x05, 0x18, 0x02, 0x08, 0x06,
+	0x16, 0x03, 0x08, 0x07, 0x14, 0x04, 0x08, 0x08, 0x12, 0x05, 0x08, 0x0A, 0x0E, 0x07, 0x08, 0x0D,
+	0x08, 0x0A, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x20, 0x06, 0x01, 0xFF, 0xFF, 0x9C, 0x07, 0x02, 0x07, 0x07, 0x12, 0x05, 0x14, 0x04, 0x15,
+	0x03, 0x16, 0x02, 0x17, 0x02, 0x17, 0x01, 0x08, 0x05, 0x12, 0x0B, 0x0D, 0x0C, 0x0C, 0x0D, 0x0C,
+	0x0D, 0x0B, 0x0E, 0x0A, 0x0F, 0x09, 0x10, 0x09, 0x10, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08,
+	0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08,
+	0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08,
+	0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08, 0x11, 0x08,
+	0x11, 0x08, 0x12, 0x06, 0xFF, 0xBC, 0xFF, 0xFF, 0xFF, 0x1B, 0x09, 0x12, 0x10, 0x0C, 0x14, 0x08,
+	0x17, 0x06, 0x18, 0x05, 0x19, 0x05, 0x0A, 0x08, 0x07, 0x04, 0x09, 0x0D, 0x04, 0x04, 0x08, 0x10,
+	0x02, 0x03, 0x09, 0x15, 0x08, 0x16, 0x08, 0x16, 0x08, 0x16, 0x08, 0x16, 0x08, 0x16, 0x09, 0x16,
+	0x09, 0x15, 0x0A, 0x14, 0x0C, 0x13, 0x0D, 0x12, 0x0F, 0x10, 0x10, 0x0F, 0x11, 0x0F, 0x11, 0x0E,
+	0x11, 0x10, 0x0F, 0x11, 0x0E, 0x13, 0x0C, 0x13, 0x0B, 0x15, 0x09, 0x16, 0x09, 0x15, 0x09, 0x16,
+	0x08, 0x16, 0x08, 0x16, 0x08, 0x16, 0x08, 0x16, 0x0B, 0x12, 0x08, 0x01, 0x04, 0x10, 0x09, 0x01,
+	0x06, 0x0D, 0x0A, 0x01, 0x09, 0x08, 0x0B, 0x02, 0x1B, 0x03, 0x1A, 0x05, 0x18, 0x08, 0x15, 0x0B,
+	0x11, 0x10, 0x0A, 0xFF, 0xED, 0xFF, 0x9E, 0x06, 0x14, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08,
+	0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x0D, 0x86,
+	0x01, 0x19, 0x08, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08,
+	0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08,
+	0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08,
+	0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x09, 0x12, 0x09,
+	0x13, 0x09, 0x12, 0x0A, 0x06, 0x03, 0x08, 0x13, 0x09, 0x12, 0x09, 0x12, 0x0A, 0x11, 0x0B, 0x10,
+	0x0C, 0x0E, 0x10, 0x08, 0xFF, 0xB5, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0x16, 0x06, 0x01, 0x08, 0x14,
+	0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14,
+	0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14,
+	0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14,
+	0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x10, 0x14, 0x11, 0x12, 0x12, 0x11,
+	0x0A, 0x01, 0x08, 0x10, 0x0B, 0x01, 0x09, 0x0E, 0x0C, 0x01, 0x0A, 0x0C, 0x0D, 0x02, 0x0A, 0x09,
+	0x0F, 0x02, 0x0C, 0x05, 0x09, 0x01, 0x07, 0x02, 0x19, 0x02, 0x07, 0x03, 0x17, 0x03, 0x07, 0x04,
+	0x15, 0x04, 0x07, 0x05, 0x13, 0x05, 0x07, 0x06, 0x11, 0x06, 0x07, 0x08, 0x0D, 0x08, 0x06, 0x0B,
+	0x08, 0xFF, 0xFF, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x07, 0x1A, 0x06, 0x01, 0x08, 0x18, 0x10,
+	0x18, 0x11, 0x16, 0x08, 0x01, 0x09, 0x16, 0x08, 0x02, 0x08, 0x16, 0x08, 0x02, 0x09, 0x14, 0x08,
+	0x04, 0x08, 0x14, 0x08, 0x04, 0x08, 0x14, 0x08, 0x04, 0x09, 0x12, 0x08, 0x06, 0x08, 0x12, 0x08,
+	0x06, 0x08, 0x12, 0x07, 0x07, 0x09, 0x10, 0x08, 0x08, 0x08, 0x10, 0x08, 0x08, 0x08, 0x0F, 0x08,
+	0x09, 0x09, 0x0E, 0x08, 0x0A, 0x08, 0x0E, 0x08, 0x0A, 0x08, 0x0D, 0x08, 0x0C, 0x08, 0x0C, 0x08,
+	0x0C, 0x08, 0x0C, 0x08, 0x0C, 0x08, 0x0B, 0x08, 0x0E, 0x08, 0x0A, 0x08, 0x0E, 0x08, 0x0A, 0x08,
+	0x0E, 0x08, 0x09, 0x08, 0x10, 0x08, 0x08, 0x08, 0x10, 0x08, 0x08, 0x07, 0x11, 0x08, 0x07, 0x08,
+	0x12, 0x08, 0x06, 0x08, 0x12, 0x08, 0x06, 0x07, 0x13, 0x09, 0x04, 0x08, 0x14, 0x08, 0x04, 0x08,
+	0x14, 0x08, 0x04, 0x07, 0x16, 0x08, 0x02, 0x08, 0x16, 0x08, 0x02, 0x08, 0x16, 0x08, 0x02, 0x07,
+	0x18, 0x10, 0x18, 0x0F, 0x19, 0x0F, 0x1A, 0x0E, 0x1A, 0x0D, 0x1B, 0x0D, 0x1C, 0x0C, 0x1C, 0x0B,
+	0x1E, 0x0A, 0x1F, 0x08, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0x07, 0x15,
+	0x07, 0x15, 0x0F, 0x13, 0x08, 0x14, 0x10, 0x13, 0x08, 0x14, 0x10, 0x13, 0x09, 0x13, 0x10, 0x13,
+	0x09, 0x12, 0x08, 0x02, 0x08, 0x11, 0x0A, 0x12, 0x08, 0x02, 0x08, 0x11, 0x0B, 0x11, 0x08, 0x02,
+	0x08, 0x11, 0x0B, 0x11, 0x07, 0x04, 0x08, 0x0F, 0x0C, 0x10, 0x08, 0x04, 0x08, 0x0F, 0x0C, 0x10,
+	0x08, 0x04, 0x08, 0x0F, 0x0D, 0x0F, 0x07, 0x05, 0x09, 0x0E, 0x0D, 0x0E, 0x08, 0x06, 0x08, 0x0D,
+	0x0E, 0x0E, 0x08, 0x06, 0x08, 0x0D, 0x0F, 0x0D, 0x08, 0x06, 0x08, 0x0D, 0x06, 0x02, 0x07, 0x0D,
+	0x07, 0x08, 0x08, 0x0C, 0x06, 0x02, 0x07, 0x0C, 0x08, 0x08, 0x08, 0x0B, 0x07, 0x02, 0x07, 0x0C,
+	0x08, 0x08, 0x08, 0x0B, 0x07, 0x02, 0x08, 0x0B, 0x07, 0x0A, 0x08, 0x0A, 0x06, 0x04, 0x07, 0x0A,
+	0x08, 0x0A, 0x08, 0x0A, 0x06, 0x04, 0x07, 0x0A, 0x08, 0x0A, 0x08, 0x09, 0x07, 0x04, 0x08, 0x09,
+	0x07, 0x0C, 0x07, 0x09, 0x06, 0x06, 0x07, 0x09, 0x07, 0x0C, 0x08, 0x08, 0x06, 0x06, 0x07, 0x08,
+	0x08, 0x0C, 0x08, 0x07, 0x07, 0x06, 0x07, 0x08, 0x07, 0x0D, 0x08, 0x07, 0x07, 0x06, 0x08, 0x07,
+	0x07, 0x0E, 0x08, 0x06, 0x06, 0x08, 0x07, 0x06, 0x08, 0x0E, 0x08, 0x06, 0x06, 0x08, 0x07, 0x06,
+	0x07, 0x0F, 0x08, 0x05, 0x07, 0x08, 0x08, 0x05, 0x07, 0x10, 0x07, 0x05, 0x07, 0x09, 0x07, 0x05,
+	0x07, 0x10, 0x08, 0x04, 0x06, 0x0A, 0x07, 0x04, 0x08, 0x10, 0x08, 0x04, 0x06, 0x0A, 0x07, 0x04,
+	0x07, 0x12, 0x07, 0x03, 0x07, 0x0A, 0x08, 0x03, 0x07, 0x12, 0x08, 0x02, 0x07, 0x0B, 0x07, 0x02,
+	0x08, 0x12, 0x08, 0x02, 0x06, 0x0C, 0x07, 0x02, 0x07, 0x14, 0x07, 0x02, 0x06, 0x0C, 0x08, 0x01,
+	0x07, 0x14, 0x07, 0x01, 0x07, 0x0D, 0x07, 0x01, 0x07, 0x14, 0x0F, 0x0D, 0x0E, 0x15, 0x0E, 0x0E,
+	0x0E, 0x16, 0x0D, 0x0E, 0x0E, 0x16, 0x0D, 0x0F, 0x0C, 0x17, 0x0C, 0x10, 0x0C, 0x18, 0x0B, 0x10,
+	0x0C, 0x18, 0x0B, 0x11, 0x0B, 0x18, 0x0B, 0x11, 0x0A, 0x1A, 0x09, 0x13, 0x08, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xEB, 0x07, 0x15, 0x07, 0x01, 0x09, 0x13, 0x08, 0x02, 0x09, 0x12,
+	0x08, 0x02, 0x09, 0x11, 0x08, 0x04, 0x09, 0x0F, 0x09, 0x05, 0x09, 0x0E, 0x08, 0x06, 0x09, 0x0D,
+	0x08, 0x08, 0x09, 0x0B, 0x09, 0x08, 0x09, 0x0B, 0x08, 0x0A, 0x09, 0x09, 0x08, 0x0C, 0x09, 0x08,
+	0x08, 0x0C, 0x09, 0x07, 0x08, 0x0E, 0x09, 0x05, 0x09, 0x0F, 0x09, 0x04, 0x08, 0x10, 0x09, 0x03,
+	0x08, 0x12, 0x09, 0x01, 0x09, 0x12, 0x09, 0x01, 0x08, 0x14, 0x10, 0x16, 0x0F, 0x16, 0x0E, 0x18,
+	0x0D, 0x19, 0x0B, 0x1A, 0x0B, 0x19, 0x0D, 0x18, 0x0D, 0x17, 0x0F, 0x15, 0x11, 0x14, 0x11, 0x13,
+	0x08, 0x02, 0x09, 0x11, 0x08, 0x04, 0x08, 0x11, 0x08, 0x04, 0x09, 0x0F, 0x08, 0x06, 0x09, 0x0D,
+	0x09, 0x06, 0x09, 0x0D, 0x08, 0x08, 0x09, 0x0B, 0x08, 0x0A, 0x09, 0x09, 0x09, 0x0A, 0x09, 0x09,
+	0x08, 0x0C, 0x09, 0x07, 0x09, 0x0C, 0x09, 0x07, 0x08, 0x0E, 0x09, 0x05, 0x08, 0x10, 0x09, 0x03,
+	0x09, 0x10, 0x09, 0x03, 0x08, 0x12, 0x09, 0x01, 0x09, 0x12, 0x12, 0x14, 0x10, 0x16, 0x08, 0xFF,
+	0xFF, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x07, 0x1A, 0x06, 0x01, 0x08, 0x18, 0x10, 0x18, 0x11,
+	0x16, 0x08, 0x02, 0x08, 0x16, 0x08, 0x02, 0x08, 0x16, 0x08, 0x02, 0x09, 0x14, 0x08, 0x04, 0x08,
+	0x14, 0x08, 0x04, 0x08, 0x14, 0x08, 0x04, 0x09, 0x12, 0x08, 0x06, 0x08, 0x12, 0x08, 0x06, 0x08,
+	0x11, 0x08, 0x07, 0x09, 0x10, 0x08, 0x08, 0x08, 0x10, 0x08, 0x08, 0x09, 0x0E, 0x08, 0x0A, 0x08,
+	0x0E, 0x08, 0x0A, 0x08, 0x0E, 0x08, 0x0A, 0x09, 0x0C, 0x08, 0x0C, 0x08, 0x0C, 0x08, 0x0C, 0x08,
+	0x0C, 0x08, 0x0C, 0x09, 0x0A, 0x08, 0x0E, 0x08, 0x0A, 0x08, 0x0E, 0x08, 0x0A, 0x07, 0x10, 0x08,
+	0x08, 0x08, 0x10, 0x08, 0x08, 0x08, 0x10, 0x08, 0x08, 0x07, 0x12, 0x08, 0x06, 0x08, 0x12, 0x08,
+	0x06, 0x08, 0x12, 0x08, 0x06, 0x07, 0x14, 0x08, 0x04, 0x08, 0x14, 0x08, 0x04, 0x08, 0x15, 0x08,
+	0x03, 0x07, 0x16, 0x08, 0x02, 0x08, 0x16, 0x08, 0x02, 0x08, 0x17, 0x08, 0x01, 0x07, 0x18, 0x10,
+	0x18, 0x0F, 0x1A, 0x0E, 0x1A, 0x0E, 0x1B, 0x0C, 0x1C, 0x0C, 0x1C, 0x0C, 0x1D, 0x0A, 0x1E, 0x0A,
+	0x1F, 0x09, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x08, 0x20, 0x08, 0x20, 0x08, 0x1F, 0x08, 0x20, 0x08,
+	0x1F, 0x09, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x1F, 0x09, 0x1F, 0x08, 0x20, 0x08,
+	0x1F, 0x09, 0x20, 0x07, 0x16, 0xFF, 0xFF, 0xFF, 0x2E, 0x1B, 0x03, 0x1C, 0x02, 0x1C, 0x02, 0x1C,
+	0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1B, 0x16, 0x08, 0x15, 0x09, 0x15, 0x08, 0x15, 0x08, 0x15, 0x09,
+	0x15, 0x08, 0x15, 0x08, 0x15, 0x09, 0x15, 0x08, 0x15, 0x09, 0x14, 0x09, 0x15, 0x08, 0x15, 0x09,
+	0x14, 0x09, 0x15, 0x08, 0x15, 0x09, 0x15, 0x08, 0x15, 0x08, 0x15, 0x09, 0x15, 0x08, 0x15, 0x08,
+	0x15, 0x09, 0x15, 0x08, 0x15, 0x08, 0x15, 0x09, 0x15, 0x08, 0x15, 0x08, 0x15, 0x09, 0x15, 0x08,
+	0x15, 0x08, 0x16, 0x08, 0x15, 0x1D, 0x01, 0x96, 0x01, 0x1C, 0xFF, 0xFF, 0x01, 0x99, 0x07, 0x0E,
+	0x0A, 0x0C, 0x0B, 0x0B, 0x0C, 0x0A, 0x0D, 0x0A, 0x0D, 0x09, 0x09, 0x0E, 0x08, 0x0F, 0x07, 0x10,
+	0x07, 0x10, 0x07, 0x10, 0x07, 0x0F, 0x08, 0x0F, 0x08, 0x0F, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10,
+	0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10,
+	0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x0F, 0x08, 0x0F, 0x07, 0x0F,
+	0x08, 0x0E, 0x08, 0x0E, 0x09, 0x0A, 0x0C, 0x0B, 0x0B, 0x0C, 0x09, 0x0E, 0x09, 0x0E, 0x0B, 0x0D,
+	0x0B, 0x0F, 0x09, 0x0F, 0x08, 0x10, 0x08, 0x10, 0x07, 0x10, 0x08, 0x10, 0x07, 0x10, 0x07, 0x10,
+	0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10,
+	0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10,
+	0x07, 0x10, 0x07, 0x10, 0x08, 0x0F, 0x08, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10, 0x07, 0x10,
+	0x08, 0x0F, 0x09, 0x0F, 0x0D, 0x0A, 0x0D, 0x0B, 0x0C, 0x0C, 0x0B, 0x0D, 0x0A, 0x0F, 0x07, 0x2F,
+	0x29, 0x06, 0x01, 0xFF, 0xFF, 0x92, 0x01, 0x06, 0x01, 0x91, 0x08, 0x10, 0x0A, 0x0E, 0x0B, 0x0C,
+	0x0D, 0x0C, 0x0D, 0x0B, 0x0D, 0x10, 0x08, 0x11, 0x08, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11,
+	0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11,
+	0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11,
+	0x07, 0x11, 0x08, 0x10, 0x08, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x08, 0x11, 0x08, 0x10,
+	0x0A, 0x0F, 0x0C, 0x0E, 0x0B, 0x0F, 0x09, 0x0F, 0x09, 0x0D, 0x0B, 0x0C, 0x0B, 0x0D, 0x08, 0x0F,
+	0x08, 0x0F, 0x08, 0x10, 0x07, 0x11, 0x07, 0x10, 0x08, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11,
+	0x07, 0x10, 0x08, 0x10, 0x08, 0x10, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11,
+	0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11,
+	0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x10, 0x08, 0x0F, 0x08, 0x0B,
+	0x0D, 0x0B, 0x0D, 0x0A, 0x0D, 0x0C, 0x0B, 0x0D, 0x0A, 0x0E, 0x08, 0x3F, 0xFF, 0xFF, 0xFF, 0x29,
+	0x07, 0x20, 0x0D, 0x11, 0x07, 0x04, 0x0F, 0x10, 0x07, 0x03, 0x11, 0x0F, 0x07, 0x02, 0x13, 0x0E,
+	0x07, 0x02, 0x14, 0x0D, 0x07, 0x01, 0x09, 0x05, 0x08, 0x0C, 0x07, 0x01, 0x08, 0x08, 0x07, 0x0A,
+	0x10, 0x0A, 0x06, 0x0A, 0x07, 0x01, 0x08, 0x0A, 0x07, 0x08, 0x08, 0x01, 0x07, 0x0C, 0x08, 0x05,
+	0x09, 0x01, 0x07, 0x0D, 0x14, 0x02, 0x07, 0x0E, 0x12, 0x03, 0x07, 0x0F, 0x10, 0x04, 0x07, 0x10,
+	0x0E, 0x1D, 0x0C, 0x21, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2,
+};
+
+/**
+ * @brief 89 pixels height compressed char info array.
+ */
+char_info_t font89_rle_info[] = {
+	{2, 0}, 		/*   */
+	{10, 1}, 		/* ! */
+	{24, 116}, 		/* " */
+	{44, 190}, 		/* # */
+	{39, 414}, 		/* $ */
+	{62, 598}, 		/* % */
+	{56, 948}, 		/* & */
+	{8, 1221}, 		/* ' */
+	{17, 1267}, 		/* ( */
+	{17, 1434}, 		/* ) */
+	{33, 1601}, 		/* * */
+	{42, 1732}, 		/* + */
+	{15, 1827}, 		/* , */
+	{23, 1879}, 		/* - */
+	{10, 1893}, 		/* . */
+	{36, 1906}, 		/* / */
+	{43, 2071}, 		/* 0 */
+	{37, 2263}, 		/* 1 */
+	{38, 2405}, 		/* 2 */
+	{38, 2535}, 		/* 3 */
+	{44, 2685}, 		/* 4 */
+	{38, 2869}, 		/* 5 */
+	{40, 3007}, 		/* 6 */
+	{40, 3189}, 		/* 7 */
+	{41, 3307}, 		/* 8 */
+	{40, 3509}, 		/* 9 */
+	{10, 3691}, 		/* : */
+	{15, 3713}, 		/* ; */
+	{40, 3786}, 		/* < */
+	{39, 3883}, 		/* = */
+	{40, 3905}, 		/* > */
+	{34, 4000}, 		/* ? */
+	{70, 4131}, 		/* @ */
+	{52, 4521}, 		/* A */
+	{40, 4739}, 		/* B */
+	{43, 4931}, 		/* C */
+	{47, 5085}, 		/* D */
+	{34, 5279}, 		/* E */
+	{32, 5387}, 		/* F */
+	{49, 5503}, 		/* G */
+	{44, 5685}, 		/* H */
+	{9, 5804}, 		/* I */
+	{24, 5813}, 		/* J */
+	{40, 5944}, 		/* K */
+	{31, 6184}, 		/* L */
+	{66, 6302}, 		/* M */
+	{46, 6625}, 		/* N */
+	{54, 6834}, 		/* O */
+	{37, 7034}, 		/* P */
+	{61, 7188}, 		/* Q */
+	{41, 7438}, 		/* R */
+	{37, 7656}, 		/* S */
+	{47, 7804}, 		/* T */
+	{46, 7924}, 		/* U */
+	{51, 8076}, 		/* V */
+	{79, 8302}, 		/* W */
+	{45, 8725}, 		/* X */
+	{45, 8948}, 		/* Y */
+	{40, 9133}, 		/* Z */
+	{16, 9251}, 		/* [ */
+	{36, 9394}, 		/* \ */
+	{17, 9559}, 		/* ] */
+	{38, 9714}, 		/* ^ */
+	{48, 9844}, 		/* _ */
+	{15, 9866}, 		/* ` */
+	{35, 9901}, 		/* a */
+	{39, 10037}, 		/* b */
+	{33, 10237}, 		/* c */
+	{39, 10357}, 		/* d */
+	{39, 10555}, 		/* e */
+	{28, 10674}, 		/* f */
+	{40, 10810}, 		/* g */
+	{37, 11001}, 		/* h */
+	{10, 11161}, 		/* i */
+	{19, 11262}, 		/* j */
+	{35, 11405}, 		/* k */
+	{8, 11622}, 		/* l */
+	{63, 11630}, 		/* m */
+	{37, 11857}, 		/* n */
+	{42, 11983}, 		/* o */
+	{39, 12128}, 		/* p */
+	{39, 12321}, 		/* q */
+	{25, 12516}, 		/* r */
+	{30, 12614}, 		/* s */
+	{27, 12725}, 		/* t */
+	{36, 12838}, 		/* u */
+	{40, 12964}, 		/* v */
+	{63, 13127}, 		/* w */
+	{37, 13426}, 		/* x */
+	{40, 13586}, 		/* y */
+	{30, 13781}, 		/* z */
+	{23, 13869}, 		/* { */
+	{8, 14032}, 		/* | */
+	{24, 14041}, 		/* } */
+	{42, 14204}, 		/* ~ */
+};
+
+Font_t font_89_rle = {
+	89,
+	font89_rle_info,
+	font89_rle_data,
+	1
+};
+
+/*==================[end of file]============================================*/
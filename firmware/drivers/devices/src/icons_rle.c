@@ -0,0 +1,2607 @@
+/**
+ * @file icons_rle.c
+ * @brief Compressed data generated by tools/bitmap_rle.py from icons.c (do not edit)
+ * @version 0.1
+ * @date 2026-10-17
+ */
+
+/*==================[inclusions]=============================================*/
+#include "icons.h"
+/*==================[external data definition]===============================*/
+/**
+ * @brief 30x30 compressed icon data array.
+ */
+const uint8_t icon30_rle_data[] = {
+	0x9B, 0x11, 0x0B, 0x15, 0x09, 0x16, 0x07, 0x02, 0x13, 0x02, 0x07, 0x02, 0x13, 0x02, 0x07, 0x02,
+	0x13, 0x04, 0x05, 0x02, 0x13, 0x05, 0x04, 0x02, 0x13, 0x05, 0x04, 0x02, 0x13, 0x05, 0x04, 0x02,
+	0x13, 0x05, 0x04, 0x02, 0x13, 0x05, 0x04, 0x02, 0x13, 0x05, 0x04, 0x02, 0x13, 0x05, 0x04, 0x02,
+	0x13, 0x05, 0x04, 0x02, 0x13, 0x03, 0x06, 0x02, 0x13, 0x02, 0x07, 0x02, 0x13, 0x02, 0x08, 0x16,
+	0x08, 0x15, 0x0B, 0x11, 0x9E, 0x9B, 0x11, 0x0B, 0x15, 0x09, 0x16, 0x07, 0x02, 0x13, 0x02, 0x07,
+	0x02, 0x03, 0x02, 0x0E, 0x02, 0x07, 0x02, 0x02, 0x04, 0x0D, 0x04, 0x05, 0x02, 0x02, 0x04, 0x0D,
+	0x05, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x05, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x05, 0x04, 0x02, 0x02,
+	0x04, 0x0D, 0x05, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x05, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x05, 0x04,
+	0x02, 0x02, 0x04, 0x0D, 0x05, 0x04, 0x02, 0x02, 0x04, 0x0D, 0x05, 0x04, 0x02, 0x02, 0x04, 0x0D,
+	0x03, 0x06, 0x02, 0x03, 0x02, 0x0E, 0x02, 0x07, 0x02, 0x13, 0x02, 0x08, 0x16, 0x08, 0x15, 0x0B,
+	0x11, 0x9E, 0x9B, 0x11, 0x0B, 0x15, 0x09, 0x16, 0x07, 0x02, 0x13, 0x02, 0x07, 0x02, 0x03, 0x06,
+	0x0A, 0x02, 0x07, 0x02, 0x02, 0x08, 0x09, 0x04, 0x05, 0x02, 0x02, 0x08, 0x09, 0x05, 0x04, 0x02,
+	0x02, 0x08, 0x09, 0x05, 0x04, 0x02, 0x02, 0x08, 0x09, 0x05, 0x04, 0x02, 0x02, 0x08, 0x09, 0x05,
+	0x04, 0x02, 0x02, 0x08, 0x09, 0x05, 0x04, 0x02, 0x02, 0x08, 0x09, 0x05, 0x04, 0x02, 0x02, 0x08,
+	0x09, 0x05, 0x04, 0x02, 0x02, 0x08, 0x09, 0x05, 0x04, 0x02, 0x02, 0x08, 0x09, 0x03, 0x06, 0x02,
+	0x03, 0x06, 0x0A, 0x02, 0x07, 0x02, 0x13, 0x02, 0x08, 0x16, 0x08, 0x15, 0x0B, 0x11, 0x9E, 0x9B,
+	0x11, 0x0B, 0x15, 0x09, 0x16, 0x07, 0x02, 0x13, 0x02, 0x07, 0x02, 0x03, 0x09, 0x07, 0x02, 0x07,
+	0x02, 0x02, 0x0B, 0x06, 0x04, 0x05, 0x02, 0x02, 0x0B, 0x06, 0x05, 0x04, 0x02, 0x02, 0x0B, 0x06,
+	0x05, 0x04, 0x02, 0x02, 0x0B, 0x06, 0x05, 0x04, 0x02, 0x02, 0x0B, 0x06, 0x05, 0x04, 0x02, 0x02,
+	0x0B, 0x06, 0x05, 0x04, 0x02, 0x02, 0x0B, 0x06, 0x05, 0x04, 0x02, 0x02, 0x0B, 0x06, 0x05, 0x04,
+	0x02, 0x02, 0x0B, 0x06, 0x05, 0x04, 0x02, 0x02, 0x0B, 0x06, 0x03, 0x06, 0x02, 0x03, 0x09, 0x07,
+	0x02, 0x07, 0x02, 0x13, 0x02, 0x08, 0x16, 0x08, 0x15, 0x0B, 0x11, 0x9E, 0x9B, 0x11, 0x0B, 0x15,
+	0x09, 0x16, 0x07, 0x02, 0x13, 0x02, 0x07, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x07, 0x02, 0x02, 0x0F,
+	0x02, 0x04, 0x05, 0x02, 0x02, 0x0F, 0x02, 0x05, 0x04, 0x02, 0x02, 0x0F, 0x02, 0x05, 0x04, 0x02,
+	0x02, 0x0F, 0x02, 0x05, 0x04, 0x02, 0x02, 0x0F, 0x02, 0x05, 0x04, 0x02, 0x02, 0x0F, 0x02, 0x05,
+	0x04, 0x02, 0x02, 0x0F, 0x02, 0x05, 0x04, 0x02, 0x02, 0x0F, 0x02, 0x05, 0x04, 0x02, 0x02, 0x0F,
+	0x02, 0x05, 0x04, 0x02, 0x02, 0x0F, 0x02, 0x03, 0x06, 0x02, 0x03, 0x0D, 0x03, 0x02, 0x07, 0x02,
+	0x13, 0x02, 0x08, 0x16, 0x08, 0x15, 0x0B, 0x11, 0x9E, 0x9B, 0x11, 0x0B, 0x15, 0x09, 0x16, 0x07,
+	0x02, 0x13, 0x02, 0x07, 0x02, 0x13, 0x02, 0x07, 0x02, 0x13, 0x04, 0x05, 0x02, 0x13, 0x05, 0x04,
+	0x02, 0x08, 0x03, 0x08, 0x05, 0x04, 0x02, 0x08, 0x04, 0x07, 0x05, 0x04, 0x02, 0x04, 0x03, 0x01,
+	0x06, 0x05, 0x05, 0x04, 0x02, 0x06, 0x05, 0x01, 0x03, 0x04, 0x05, 0x04, 0x02, 0x07, 0x04, 0x08,
+	0x05, 0x04, 0x02, 0x09, 0x02, 0x08, 0x05, 0x04, 0x02, 0x0A, 0x01, 0x08, 0x05, 0x04, 0x02, 0x13,
+	0x03, 0x06, 0x02, 0x13, 0x02, 0x07, 0x02, 0x13, 0x02, 0x08, 0x16, 0x08, 0x15, 0x0B, 0x11, 0x9E,
+	0x8D, 0x04, 0x19, 0x06, 0x18, 0x02, 0x02, 0x02, 0x18, 0x02, 0x02, 0x02, 0x18, 0x02, 0x02, 0x02,
+	0x18, 0x02, 0x02, 0x02, 0x11, 0x04, 0x03, 0x02, 0x02, 0x02, 0x10, 0x06, 0x02, 0x02, 0x02, 0x02,
+	0x10, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x10, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0A, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x05, 0x03, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06, 0x09, 0x04,
+	0x04, 0x04, 0x04, 0x04, 0x0B, 0x01, 0x07, 0x02, 0x07, 0x01, 0x42, 0x70, 0x02, 0x1B, 0x05, 0x18,
+	0x03, 0x01, 0x02, 0x18, 0x02, 0x02, 0x02, 0x18, 0x02, 0x02, 0x02, 0x18, 0x02, 0x02, 0x02, 0x18,
+	0x02, 0x02, 0x02, 0x11, 0x04, 0x03, 0x02, 0x02, 0x02, 0x10, 0x06, 0x02, 0x02, 0x02, 0x02, 0x10,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x09,
+	0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x08, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08,
+	0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06, 0x09,
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x5F, 0x70, 0x02, 0x1B, 0x05, 0x18, 0x03, 0x01, 0x02, 0x18, 0x02,
+	0x02, 0x02, 0x18, 0x02, 0x02, 0x02, 0x18, 0x02, 0x02, 0x02, 0x18, 0x02, 0x02, 0x02, 0x11, 0x04,
+	0x03, 0x02, 0x02, 0x02, 0x10, 0x06, 0x02, 0x02, 0x02, 0x02, 0x10, 0x06, 0x02, 0x02, 0x02, 0x02,
+	0x10, 0x06, 0x02, 0x02, 0x02, 0x02, 0x10, 0x06, 0x02, 0x02, 0x02, 0x02, 0x10, 0x06, 0x02, 0x02,
+	0x02, 0x02, 0x09, 0x04, 0x03, 0x06, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x02,
+	0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x02,
+	0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x02,
+	0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x02,
+	0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06,
+	0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x5F, 0x70, 0x02, 0x1B, 0x05, 0x18, 0x06, 0x18, 0x06, 0x18,
+	0x06, 0x18, 0x06, 0x18, 0x06, 0x11, 0x04, 0x03, 0x06, 0x10, 0x06, 0x02, 0x06, 0x10, 0x06, 0x02,
+	0x06, 0x10, 0x06, 0x02, 0x06, 0x10, 0x06, 0x02, 0x06, 0x10, 0x06, 0x02, 0x06, 0x09, 0x04, 0x03,
+	0x06, 0x02, 0x06, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06, 0x08,
+	0x06, 0x02, 0x06, 0x02, 0x06, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06, 0x08, 0x06, 0x02, 0x06, 0x02,
+	0x06, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06, 0x08, 0x06, 0x02,
+	0x06, 0x02, 0x06, 0x08, 0x06, 0x02, 0x06, 0x02, 0x06, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x5F,
+	0x68, 0x02, 0x1B, 0x04, 0x1A, 0x04, 0x19, 0x02, 0x02, 0x02, 0x18, 0x02, 0x02, 0x02, 0x17, 0x02,
+	0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x15, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x13, 0x02,
+	0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x11, 0x02, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x0F, 0x02,
+	0x0C, 0x02, 0x0E, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0C, 0x02, 0x0E, 0x02, 0x0B, 0x02,
+	0x07, 0x02, 0x07, 0x02, 0x0A, 0x02, 0x04, 0x08, 0x04, 0x02, 0x09, 0x03, 0x01, 0x06, 0x02, 0x06,
+	0x01, 0x03, 0x09, 0x06, 0x08, 0x06, 0x0B, 0x02, 0x0E, 0x02, 0x9C, 0xFF, 0xFF, 0x85, 0x04, 0x1A,
+	0x04, 0x19, 0x06, 0x19, 0x04, 0x1B, 0x02, 0x86, 0xFF, 0xD0, 0x04, 0x18, 0x08, 0x14, 0x04, 0x04,
+	0x03, 0x13, 0x02, 0x08, 0x02, 0x52, 0x04, 0x1A, 0x04, 0x19, 0x06, 0x19, 0x04, 0x1B, 0x02, 0x86,
+	0xFF, 0x37, 0x0A, 0x12, 0x0E, 0x0E, 0x05, 0x08, 0x04, 0x0C, 0x03, 0x0D, 0x03, 0x0B, 0x02, 0x10,
+	0x02, 0x12, 0x04, 0x18, 0x08, 0x14, 0x04, 0x04, 0x03, 0x13, 0x02, 0x08, 0x02, 0x52, 0x04, 0x1A,
+	0x04, 0x19, 0x06, 0x19, 0x04, 0x1B, 0x02, 0x86, 0x83, 0x08, 0x12, 0x0F, 0x0D, 0x06, 0x08, 0x05,
+	0x0A, 0x04, 0x0E, 0x04, 0x07, 0x03, 0x12, 0x03, 0x04, 0x04, 0x14, 0x03, 0x03, 0x02, 0x07, 0x0A,
+	0x06, 0x03, 0x09, 0x0E, 0x0E, 0x05, 0x08, 0x04, 0x0C, 0x03, 0x0D, 0x03, 0x0B, 0x02, 0x10, 0x02,
+	0x12, 0x04, 0x18, 0x08, 0x14, 0x04, 0x04, 0x03, 0x13, 0x02, 0x08, 0x02, 0x52, 0x04, 0x1A, 0x04,
+	0x19, 0x06, 0x19, 0x04, 0x1B, 0x02, 0x86, 0x56, 0x01, 0x1C, 0x02, 0x0E, 0x08, 0x05, 0x02, 0x0B,
+	0x0D, 0x03, 0x02, 0x0A, 0x06, 0x0B, 0x03, 0x09, 0x04, 0x0D, 0x05, 0x07, 0x03, 0x0E, 0x02, 0x02,
+	0x03, 0x04, 0x04, 0x0E, 0x02, 0x04, 0x03, 0x03, 0x02, 0x07, 0x05, 0x03, 0x03, 0x05, 0x03, 0x09,
+	0x06, 0x03, 0x05, 0x0E, 0x04, 0x06, 0x07, 0x0C, 0x03, 0x07, 0x02, 0x04, 0x03, 0x0B, 0x02, 0x07,
+	0x02, 0x07, 0x02, 0x12, 0x04, 0x19, 0x07, 0x16, 0x02, 0x04, 0x03, 0x14, 0x02, 0x07, 0x02, 0x12,
+	0x02, 0x1B, 0x02, 0x1B, 0x02, 0x04, 0x04, 0x13, 0x02, 0x05, 0x04, 0x12, 0x02, 0x05, 0x06, 0x10,
+	0x02, 0x07, 0x04, 0x10, 0x02, 0x09, 0x02, 0x10, 0x02, 0x74, 0x67, 0x02, 0x1C, 0x03, 0x1B, 0x04,
+	0x1A, 0x05, 0x19, 0x02, 0x01, 0x03, 0x18, 0x02, 0x02, 0x03, 0x13, 0x01, 0x03, 0x02, 0x03, 0x03,
+	0x12, 0x02, 0x02, 0x02, 0x03, 0x03, 0x12, 0x03, 0x01, 0x02, 0x02, 0x03, 0x14, 0x05, 0x01, 0x03,
+	0x16, 0x07, 0x18, 0x05, 0x1A, 0x03, 0x1A, 0x05, 0x18, 0x07, 0x16, 0x05, 0x01, 0x03, 0x14, 0x03,
+	0x01, 0x02, 0x02, 0x03, 0x13, 0x02, 0x02, 0x02, 0x03, 0x03, 0x12, 0x01, 0x03, 0x02, 0x03, 0x03,
+	0x16, 0x02, 0x02, 0x03, 0x17, 0x02, 0x01, 0x03, 0x18, 0x05, 0x19, 0x04, 0x1A, 0x03, 0x1B, 0x02,
+	0x4B, 0xD4, 0x08, 0x02, 0x10, 0x04, 0x08, 0x0F, 0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x11,
+	0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x02, 0x11, 0x02, 0x03, 0x02, 0x04, 0x02, 0x11, 0x02, 0x03,
+	0x02, 0x04, 0x02, 0x11, 0x02, 0x03, 0x08, 0x11, 0x02, 0x03, 0x08, 0x11, 0x02, 0x06, 0x02, 0x14,
+	0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x14,
+	0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x02, 0x14, 0x06, 0x02, 0x02,
+	0x13, 0x07, 0x02, 0x05, 0x02, 0x05, 0x02, 0x0E, 0x02, 0x05, 0x02, 0x05, 0x02, 0x0E, 0x02, 0x05,
+	0x02, 0x05, 0x02, 0x0E, 0x02, 0x02, 0x0E, 0x0C, 0x02, 0x02, 0x0F, 0x24, 0xB6, 0x08, 0x02, 0x10,
+	0x04, 0x08, 0x02, 0x10, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x11, 0x02, 0x03, 0x02, 0x01, 0x02,
+	0x01, 0x02, 0x11, 0x02, 0x03, 0x02, 0x04, 0x02, 0x11, 0x02, 0x03, 0x02, 0x04, 0x02, 0x11, 0x02,
+	0x03, 0x08, 0x11, 0x02, 0x03, 0x08, 0x11, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x14, 0x02,
+	0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x0B, 0x07, 0x02, 0x02, 0x06, 0x02, 0x0A, 0x09, 0x02, 0x01,
+	0x06, 0x02, 0x09, 0x0B, 0x08, 0x02, 0x09, 0x02, 0x02, 0x04, 0x02, 0x02, 0x07, 0x02, 0x08, 0x04,
+	0x02, 0x02, 0x02, 0x04, 0x06, 0x02, 0x02, 0x05, 0x01, 0x05, 0x04, 0x05, 0x06, 0x02, 0x02, 0x05,
+	0x01, 0x06, 0x02, 0x06, 0x06, 0x02, 0x05, 0x02, 0x01, 0x05, 0x04, 0x05, 0x06, 0x02, 0x05, 0x02,
+	0x01, 0x04, 0x02, 0x02, 0x02, 0x04, 0x06, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x04, 0x01, 0x03,
+	0x07, 0x02, 0x02, 0x06, 0x01, 0x0C, 0x07, 0x01, 0x03, 0x06, 0x02, 0x0A, 0x15, 0x07, 0x05, 0x86,
+	0x02, 0x1B, 0x04, 0x1A, 0x04, 0x19, 0x06, 0x18, 0x06, 0x1A, 0x02, 0x04, 0x05, 0x13, 0x02, 0x03,
+	0x06, 0x0C, 0x03, 0x04, 0x02, 0x03, 0x02, 0x02, 0x02, 0x0B, 0x05, 0x03, 0x02, 0x03, 0x02, 0x02,
+	0x02, 0x0B, 0x02, 0x01, 0x02, 0x03, 0x02, 0x03, 0x06, 0x0B, 0x02, 0x01, 0x02, 0x03, 0x02, 0x04,
+	0x05, 0x0B, 0x05, 0x03, 0x02, 0x05, 0x02, 0x0E, 0x03, 0x04, 0x02, 0x05, 0x02, 0x0E, 0x03, 0x04,
+	0x09, 0x0F, 0x02, 0x04, 0x08, 0x10, 0x09, 0x16, 0x07, 0x1B, 0x03, 0x1B, 0x03, 0x1A, 0x06, 0x17,
+	0x03, 0x02, 0x03, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x17, 0x02, 0x02, 0x02, 0x18,
+	0x06, 0x19, 0x04, 0x0D, 0xFF, 0x02, 0x02, 0x1C, 0x03, 0x1B, 0x04, 0x1A, 0x05, 0x19, 0x02, 0x01,
+	0x03, 0x0B, 0x0F, 0x02, 0x03, 0x0A, 0x0E, 0x04, 0x03, 0x09, 0x02, 0x11, 0x03, 0x08, 0x02, 0x12,
+	0x02, 0x08, 0x02, 0x11, 0x03, 0x08, 0x0E, 0x04, 0x03, 0x09, 0x0F, 0x02, 0x03, 0x0B, 0x0E, 0x01,
+	0x03, 0x18, 0x05, 0x19, 0x04, 0x1A, 0x03, 0x1B, 0x02, 0xA1, 0xDE, 0x01, 0x1C, 0x03, 0x1A, 0x04,
+	0x19, 0x05, 0x18, 0x03, 0x01, 0x02, 0x16, 0x04, 0x02, 0x02, 0x15, 0x03, 0x04, 0x0F, 0x07, 0x03,
+	0x05, 0x10, 0x05, 0x03, 0x14, 0x02, 0x05, 0x02, 0x15, 0x02, 0x05, 0x03, 0x14, 0x02, 0x06, 0x03,
+	0x06, 0x0F, 0x07, 0x03, 0x04, 0x10, 0x08, 0x03, 0x03, 0x0F, 0x0A, 0x03, 0x02, 0x02, 0x18, 0x06,
+	0x19, 0x05, 0x1B, 0x03, 0x1C, 0x02, 0x88, 0x84, 0x06, 0x17, 0x08, 0x16, 0x02, 0x04, 0x02, 0x16,
+	0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16,
+	0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16,
+	0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x11, 0x07, 0x04, 0x07, 0x0C,
+	0x07, 0x04, 0x07, 0x0D, 0x02, 0x0C, 0x02, 0x0F, 0x02, 0x0A, 0x02, 0x10, 0x03, 0x08, 0x03, 0x11,
+	0x03, 0x06, 0x03, 0x13, 0x03, 0x04, 0x03, 0x15, 0x03, 0x02, 0x03, 0x17, 0x06, 0x19, 0x04, 0x1B,
+	0x02, 0x2C, 0x86, 0x02, 0x1B, 0x04, 0x19, 0x06, 0x17, 0x03, 0x02, 0x03, 0x16, 0x02, 0x04, 0x02,
+	0x15, 0x02, 0x06, 0x02, 0x13, 0x02, 0x08, 0x02, 0x11, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x0A, 0x03,
+	0x0D, 0x06, 0x06, 0x06, 0x0C, 0x07, 0x04, 0x07, 0x0C, 0x07, 0x04, 0x07, 0x11, 0x02, 0x04, 0x02,
+	0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02,
+	0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02,
+	0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x08, 0x16, 0x08, 0x29, 0x7D, 0x04, 0x1A,
+	0x06, 0x17, 0x02, 0x02, 0x05, 0x15, 0x02, 0x04, 0x04, 0x14, 0x02, 0x06, 0x04, 0x12, 0x02, 0x08,
+	0x04, 0x10, 0x02, 0x0A, 0x04, 0x0E, 0x02, 0x0C, 0x04, 0x0C, 0x02, 0x0D, 0x05, 0x0A, 0x02, 0x0F,
+	0x04, 0x09, 0x02, 0x11, 0x04, 0x07, 0x02, 0x13, 0x02, 0x07, 0x02, 0x13, 0x02, 0x07, 0x02, 0x12,
+	0x03, 0x07, 0x02, 0x11, 0x03, 0x08, 0x02, 0x0F, 0x04, 0x09, 0x02, 0x0D, 0x04, 0x0B, 0x02, 0x0B,
+	0x04, 0x0D, 0x02, 0x09, 0x04, 0x0F, 0x02, 0x08, 0x04, 0x10, 0x02, 0x06, 0x04, 0x12, 0x02, 0x04,
+	0x04, 0x14, 0x03, 0x01, 0x04, 0x17, 0x05, 0x1A, 0x03, 0x33, 0x7E, 0x04, 0x0A, 0x04, 0x0A, 0x08,
+	0x06, 0x08, 0x08, 0x02, 0x04, 0x02, 0x06, 0x02, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x04, 0x03,
+	0x04, 0x02, 0x08, 0x08, 0x06, 0x08, 0x09, 0x07, 0x06, 0x07, 0x41, 0x86, 0x02, 0x1B, 0x04, 0x19,
+	0x06, 0x17, 0x03, 0x02, 0x03, 0x15, 0x03, 0x04, 0x03, 0x14, 0x02, 0x06, 0x02, 0x13, 0x02, 0x08,
+	0x02, 0x11, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x0A, 0x03, 0x0D, 0x03, 0x0C, 0x03, 0x0B, 0x03, 0x0E,
+	0x03, 0x0A, 0x02, 0x10, 0x02, 0x09, 0x02, 0x12, 0x02, 0x08, 0x16, 0x08, 0x16, 0x0A, 0x12, 0x47,
+	0x14, 0x09, 0x16, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x16, 0x09, 0x14, 0x41,
+	0xB7, 0x03, 0x09, 0x03, 0x0F, 0x05, 0x06, 0x06, 0x0C, 0x02, 0x02, 0x03, 0x05, 0x02, 0x02, 0x03,
+	0x0B, 0x02, 0x03, 0x03, 0x04, 0x02, 0x03, 0x03, 0x0A, 0x02, 0x04, 0x03, 0x03, 0x02, 0x04, 0x03,
+	0x09, 0x02, 0x05, 0x03, 0x02, 0x02, 0x05, 0x03, 0x08, 0x02, 0x07, 0x02, 0x01, 0x02, 0x06, 0x04,
+	0x06, 0x02, 0x08, 0x04, 0x08, 0x03, 0x05, 0x02, 0x09, 0x03, 0x09, 0x03, 0x04, 0x02, 0x0A, 0x02,
+	0x0A, 0x03, 0x03, 0x02, 0x0A, 0x02, 0x0B, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x09, 0x03, 0x04, 0x02,
+	0x09, 0x03, 0x08, 0x03, 0x05, 0x02, 0x07, 0x05, 0x07, 0x03, 0x06, 0x02, 0x06, 0x03, 0x01, 0x02,
+	0x06, 0x03, 0x07, 0x02, 0x05, 0x03, 0x02, 0x02, 0x05, 0x03, 0x08, 0x02, 0x04, 0x03, 0x03, 0x02,
+	0x04, 0x03, 0x09, 0x02, 0x03, 0x03, 0x04, 0x02, 0x02, 0x04, 0x0A, 0x02, 0x01, 0x03, 0x06, 0x02,
+	0x01, 0x03, 0x0D, 0x04, 0x08, 0x04, 0x0E, 0x03, 0x09, 0x03, 0x66, 0xC0, 0x03, 0x09, 0x03, 0x0D,
+	0x06, 0x06, 0x05, 0x0C, 0x03, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x0A, 0x03, 0x03, 0x02, 0x04,
+	0x03, 0x03, 0x02, 0x09, 0x03, 0x04, 0x02, 0x03, 0x03, 0x04, 0x02, 0x08, 0x03, 0x05, 0x02, 0x02,
+	0x03, 0x05, 0x02, 0x07, 0x03, 0x06, 0x02, 0x01, 0x02, 0x07, 0x02, 0x05, 0x04, 0x07, 0x04, 0x08,
+	0x02, 0x04, 0x03, 0x09, 0x03, 0x09, 0x02, 0x03, 0x03, 0x0A, 0x02, 0x0A, 0x02, 0x03, 0x02, 0x0B,
+	0x02, 0x0A, 0x02, 0x04, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x05, 0x03, 0x08, 0x04, 0x08, 0x02, 0x06,
+	0x03, 0x07, 0x05, 0x07, 0x02, 0x07, 0x03, 0x06, 0x02, 0x01, 0x03, 0x06, 0x02, 0x08, 0x03, 0x05,
+	0x02, 0x02, 0x03, 0x05, 0x02, 0x09, 0x03, 0x04, 0x02, 0x03, 0x03, 0x04, 0x02, 0x0A, 0x04, 0x02,
+	0x02, 0x04, 0x03, 0x03, 0x02, 0x0C, 0x03, 0x01, 0x02, 0x06, 0x03, 0x01, 0x02, 0x0D, 0x04, 0x08,
+	0x04, 0x0F, 0x03, 0x09, 0x03, 0x5D, 0x9B, 0x02, 0x0E, 0x04, 0x09, 0x05, 0x0B, 0x06, 0x08, 0x02,
+	0x01, 0x03, 0x0A, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x04, 0x08, 0x02, 0x02, 0x02, 0x08, 0x02,
+	0x04, 0x04, 0x06, 0x02, 0x02, 0x02, 0x08, 0x02, 0x06, 0x03, 0x05, 0x02, 0x02, 0x02, 0x08, 0x02,
+	0x07, 0x04, 0x03, 0x02, 0x02, 0x02, 0x08, 0x02, 0x09, 0x04, 0x01, 0x02, 0x02, 0x02, 0x08, 0x02,
+	0x0A, 0x06, 0x02, 0x02, 0x08, 0x02, 0x0C, 0x04, 0x02, 0x02, 0x08, 0x02, 0x0E, 0x02, 0x02, 0x02,
+	0x08, 0x02, 0x0E, 0x02, 0x02, 0x02, 0x08, 0x02, 0x0D, 0x03, 0x02, 0x02, 0x08, 0x02, 0x0B, 0x05,
+	0x02, 0x02, 0x08, 0x02, 0x0A, 0x06, 0x02, 0x02, 0x08, 0x02, 0x08, 0x04, 0x02, 0x02, 0x02, 0x02,
+	0x08, 0x02, 0x07, 0x03, 0x04, 0x02, 0x02, 0x02, 0x08, 0x02, 0x05, 0x04, 0x05, 0x02, 0x02, 0x02,
+	0x08, 0x02, 0x03, 0x04, 0x07, 0x02, 0x02, 0x02, 0x08, 0x02, 0x02, 0x04, 0x08, 0x02, 0x02, 0x02,
+	0x08, 0x06, 0x0A, 0x02, 0x02, 0x02, 0x08, 0x04, 0x0C, 0x06, 0x09, 0x02, 0x0E, 0x04, 0x41, 0x9B,
+	0x04, 0x0E, 0x02, 0x09, 0x06, 0x0B, 0x05, 0x08, 0x02, 0x02, 0x02, 0x0A, 0x03, 0x01, 0x02, 0x08,
+	0x02, 0x02, 0x02, 0x08, 0x04, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x06, 0x04, 0x04, 0x02, 0x08,
+	0x02, 0x02, 0x02, 0x05, 0x04, 0x05, 0x02, 0x08, 0x02, 0x02, 0x02, 0x03, 0x04, 0x07, 0x02, 0x08,
+	0x02, 0x02, 0x02, 0x01, 0x04, 0x09, 0x02, 0x08, 0x02, 0x02, 0x06, 0x0A, 0x02, 0x08, 0x02, 0x02,
+	0x04, 0x0C, 0x02, 0x08, 0x02, 0x02, 0x02, 0x0E, 0x02, 0x08, 0x02, 0x02, 0x02, 0x0E, 0x02, 0x08,
+	0x02, 0x02, 0x03, 0x0D, 0x02, 0x08, 0x02, 0x02, 0x05, 0x0B, 0x02, 0x08, 0x02, 0x02, 0x06, 0x0A,
+	0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x04, 0x08, 0x02, 0x08, 0x02, 0x02, 0x02, 0x04, 0x03, 0x07,
+	0x02, 0x08, 0x02, 0x02, 0x02, 0x05, 0x04, 0x05, 0x02, 0x08, 0x02, 0x02, 0x02, 0x07, 0x04, 0x03,
+	0x02, 0x08, 0x02, 0x02, 0x02, 0x08, 0x04, 0x02, 0x02, 0x08, 0x02, 0x02, 0x02, 0x0A, 0x06, 0x08,
+	0x06, 0x0C, 0x04, 0x09, 0x04, 0x0E, 0x02, 0x41, 0x86, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x18, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x12, 0x04, 0x02, 0x02, 0x02, 0x04, 0x0F, 0x03, 0x04, 0x02, 0x04, 0x03,
+	0x0D, 0x03, 0x05, 0x02, 0x05, 0x03, 0x0C, 0x02, 0x06, 0x02, 0x06, 0x02, 0x0B, 0x02, 0x07, 0x02,
+	0x07, 0x02, 0x09, 0x03, 0x07, 0x02, 0x07, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02,
+	0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x03, 0x10, 0x03, 0x09, 0x02, 0x10, 0x02,
+	0x0A, 0x03, 0x0E, 0x03, 0x0B, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0A, 0x03, 0x0F, 0x04, 0x06, 0x04,
+	0x12, 0x0A, 0x16, 0x06, 0x2A, 0x68, 0x02, 0x19, 0x08, 0x16, 0x03, 0x02, 0x03, 0x16, 0x02, 0x04,
+	0x02, 0x11, 0x02, 0x03, 0x02, 0x04, 0x02, 0x04, 0x01, 0x0B, 0x07, 0x05, 0x08, 0x09, 0x07, 0x07,
+	0x08, 0x08, 0x02, 0x12, 0x02, 0x07, 0x02, 0x08, 0x04, 0x07, 0x03, 0x06, 0x03, 0x06, 0x06, 0x07,
+	0x02, 0x06, 0x04, 0x04, 0x02, 0x04, 0x02, 0x04, 0x04, 0x08, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03,
+	0x02, 0x0A, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x02, 0x0A, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03,
+	0x01, 0x0B, 0x02, 0x03, 0x02, 0x06, 0x02, 0x03, 0x02, 0x08, 0x04, 0x04, 0x02, 0x04, 0x02, 0x04,
+	0x03, 0x07, 0x02, 0x06, 0x08, 0x05, 0x03, 0x06, 0x03, 0x07, 0x04, 0x08, 0x02, 0x07, 0x02, 0x12,
+	0x02, 0x08, 0x08, 0x07, 0x07, 0x09, 0x08, 0x05, 0x07, 0x0B, 0x01, 0x04, 0x02, 0x04, 0x02, 0x03,
+	0x02, 0x11, 0x02, 0x04, 0x02, 0x16, 0x08, 0x17, 0x06, 0x48, 0x84, 0x06, 0x16, 0x0A, 0x13, 0x04,
+	0x04, 0x04, 0x11, 0x03, 0x08, 0x02, 0x11, 0x02, 0x1B, 0x02, 0x0C, 0x02, 0x0E, 0x02, 0x0B, 0x04,
+	0x0D, 0x02, 0x0A, 0x06, 0x0C, 0x02, 0x09, 0x08, 0x0B, 0x02, 0x09, 0x02, 0x01, 0x02, 0x01, 0x03,
+	0x0A, 0x02, 0x09, 0x01, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0E, 0x02, 0x0C, 0x02,
+	0x0B, 0x01, 0x02, 0x02, 0x02, 0x01, 0x09, 0x02, 0x0A, 0x03, 0x01, 0x02, 0x01, 0x02, 0x09, 0x02,
+	0x0B, 0x08, 0x09, 0x02, 0x0C, 0x06, 0x0A, 0x02, 0x0D, 0x04, 0x0B, 0x02, 0x0E, 0x02, 0x0C, 0x02,
+	0x1B, 0x02, 0x12, 0x01, 0x08, 0x03, 0x11, 0x04, 0x04, 0x04, 0x13, 0x0A, 0x16, 0x06, 0x48, 0xA4,
+	0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C,
+	0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x18, 0x03, 0x01, 0x02, 0x01, 0x03, 0x15, 0x08, 0x17,
+	0x06, 0x19, 0x04, 0x08, 0x01, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08,
+	0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x16, 0x09, 0x14, 0x5F, 0x9B, 0x10, 0x0D, 0x12,
+	0x0C, 0x02, 0x02, 0x02, 0x08, 0x05, 0x0B, 0x02, 0x02, 0x02, 0x08, 0x02, 0x01, 0x03, 0x0A, 0x02,
+	0x02, 0x02, 0x08, 0x02, 0x02, 0x04, 0x08, 0x02, 0x02, 0x0C, 0x04, 0x02, 0x08, 0x02, 0x03, 0x0A,
+	0x05, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02,
+	0x12, 0x02, 0x08, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x08, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x08, 0x02,
+	0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x08, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x08, 0x02,
+	0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x08, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x08, 0x02,
+	0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x08, 0x02, 0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x08, 0x02,
+	0x01, 0x03, 0x0A, 0x03, 0x01, 0x02, 0x08, 0x16, 0x09, 0x14, 0x5F, 0x89, 0x05, 0x17, 0x08, 0x14,
+	0x04, 0x02, 0x03, 0x15, 0x02, 0x04, 0x02, 0x15, 0x03, 0x03, 0x02, 0x05, 0x01, 0x10, 0x02, 0x03,
+	0x02, 0x05, 0x03, 0x0F, 0x02, 0x02, 0x02, 0x05, 0x04, 0x0E, 0x03, 0x02, 0x02, 0x04, 0x05, 0x0F,
+	0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x0F, 0x02, 0x03, 0x05, 0x03, 0x02, 0x0E, 0x03, 0x04,
+	0x03, 0x03, 0x02, 0x0E, 0x03, 0x0B, 0x02, 0x0D, 0x03, 0x0B, 0x02, 0x0D, 0x03, 0x05, 0x09, 0x0C,
+	0x03, 0x05, 0x08, 0x0D, 0x03, 0x05, 0x03, 0x02, 0x01, 0x0F, 0x03, 0x05, 0x03, 0x12, 0x03, 0x05,
+	0x03, 0x12, 0x03, 0x05, 0x03, 0x13, 0x02, 0x05, 0x03, 0x14, 0x02, 0x04, 0x03, 0x15, 0x03, 0x02,
+	0x03, 0x17, 0x06, 0x19, 0x04, 0x51, 0x61, 0x09, 0x14, 0x0C, 0x11, 0x03, 0x06, 0x05, 0x10, 0x02,
+	0x08, 0x05, 0x0F, 0x02, 0x08, 0x02, 0x01, 0x03, 0x0E, 0x02, 0x08, 0x02, 0x02, 0x03, 0x0D, 0x02,
+	0x08, 0x02, 0x03, 0x03, 0x0C, 0x02, 0x08, 0x02, 0x04, 0x03, 0x0B, 0x02, 0x08, 0x03, 0x03, 0x03,
+	0x0B, 0x02, 0x09, 0x09, 0x0A, 0x02, 0x0A, 0x08, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02,
+	0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02,
+	0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02,
+	0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x03, 0x0E, 0x03, 0x0B, 0x12, 0x0D, 0x10,
+	0x25, 0xB8, 0x08, 0x15, 0x0A, 0x13, 0x03, 0x06, 0x03, 0x12, 0x02, 0x08, 0x0E, 0x06, 0x02, 0x09,
+	0x0E, 0x05, 0x02, 0x07, 0x04, 0x0A, 0x03, 0x04, 0x0B, 0x0D, 0x02, 0x04, 0x0A, 0x0E, 0x02, 0x04,
+	0x03, 0x15, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04,
+	0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04,
+	0x02, 0x16, 0x02, 0x04, 0x03, 0x14, 0x03, 0x05, 0x18, 0x07, 0x16, 0x7C, 0x85, 0x04, 0x19, 0x06,
+	0x17, 0x03, 0x02, 0x03, 0x15, 0x03, 0x04, 0x04, 0x11, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x0A, 0x03,
+	0x0D, 0x03, 0x0C, 0x03, 0x0B, 0x03, 0x0E, 0x03, 0x09, 0x03, 0x10, 0x03, 0x08, 0x02, 0x12, 0x02,
+	0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02,
+	0x08, 0x02, 0x06, 0x06, 0x06, 0x02, 0x08, 0x02, 0x05, 0x08, 0x05, 0x02, 0x08, 0x02, 0x05, 0x02,
+	0x04, 0x02, 0x05, 0x02, 0x08, 0x02, 0x05, 0x02, 0x04, 0x02, 0x05, 0x02, 0x08, 0x02, 0x05, 0x02,
+	0x04, 0x02, 0x05, 0x02, 0x08, 0x02, 0x05, 0x02, 0x04, 0x02, 0x05, 0x02, 0x08, 0x02, 0x05, 0x02,
+	0x04, 0x02, 0x05, 0x02, 0x08, 0x02, 0x05, 0x02, 0x04, 0x02, 0x05, 0x02, 0x08, 0x09, 0x04, 0x09,
+	0x08, 0x09, 0x04, 0x09, 0x40, 0x67, 0x04, 0x18, 0x08, 0x15, 0x03, 0x04, 0x03, 0x14, 0x02, 0x06,
+	0x02, 0x13, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08,
+	0x02, 0x12, 0x02, 0x08, 0x02, 0x13, 0x02, 0x06, 0x02, 0x14, 0x04, 0x02, 0x04, 0x15, 0x08, 0x18,
+	0x04, 0x4F, 0x12, 0x0B, 0x14, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10, 0x02, 0x0A, 0x02, 0x10,
+	0x02, 0x0A, 0x03, 0x0E, 0x03, 0x0B, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0A, 0x03, 0x0F, 0x0E, 0x12,
+	0x0A, 0x46, 0xCF, 0x01, 0x1C, 0x02, 0x1B, 0x02, 0x1B, 0x02, 0x1B, 0x02, 0x1B, 0x02, 0x1B, 0x02,
+	0x1B, 0x02, 0x1B, 0x02, 0x1B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0D, 0x03, 0x0B, 0x02, 0x0F, 0x03,
+	0x09, 0x02, 0x11, 0x03, 0x07, 0x02, 0x13, 0x03, 0x05, 0x02, 0x15, 0x03, 0x03, 0x02, 0x17, 0x06,
+	0x19, 0x04, 0x1B, 0x02, 0xA9, 0x9A, 0x02, 0x12, 0x02, 0x09, 0x02, 0x10, 0x02, 0x0B, 0x02, 0x0E,
+	0x02, 0x0D, 0x02, 0x0C, 0x02, 0x0F, 0x02, 0x0A, 0x02, 0x11, 0x02, 0x08, 0x02, 0x13, 0x02, 0x06,
+	0x02, 0x15, 0x02, 0x04, 0x02, 0x17, 0x02, 0x02, 0x02, 0x19, 0x04, 0x1A, 0x04, 0x1A, 0x04, 0x19,
+	0x02, 0x02, 0x02, 0x17, 0x02, 0x04, 0x02, 0x15, 0x02, 0x06, 0x02, 0x13, 0x02, 0x08, 0x02, 0x11,
+	0x02, 0x0A, 0x02, 0x0F, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0B, 0x02, 0x10, 0x02, 0x09,
+	0x02, 0x12, 0x02, 0x7C, 0x85, 0x04, 0x19, 0x06, 0x18, 0x02, 0x02, 0x02, 0x17, 0x02, 0x04, 0x02,
+	0x16, 0x02, 0x04, 0x02, 0x15, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x13, 0x02, 0x03, 0x02,
+	0x03, 0x02, 0x11, 0x03, 0x03, 0x02, 0x03, 0x03, 0x10, 0x02, 0x04, 0x02, 0x04, 0x02, 0x0F, 0x03,
+	0x04, 0x02, 0x04, 0x03, 0x0E, 0x02, 0x05, 0x02, 0x05, 0x02, 0x0D, 0x03, 0x05, 0x02, 0x05, 0x03,
+	0x0C, 0x02, 0x06, 0x02, 0x06, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x07, 0x02, 0x0A, 0x02, 0x10, 0x02,
+	0x09, 0x02, 0x12, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x02, 0x09, 0x02, 0x09, 0x02,
+	0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x18, 0x07, 0x16, 0x5E, 0x66, 0x06, 0x15,
+	0x0C, 0x11, 0x04, 0x06, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x0B, 0x03, 0x0E, 0x03, 0x0A, 0x02, 0x10,
+	0x02, 0x09, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x02, 0x09,
+	0x02, 0x09, 0x02, 0x06, 0x02, 0x09, 0x02, 0x09, 0x02, 0x06, 0x02, 0x09, 0x02, 0x09, 0x02, 0x06,
+	0x01, 0x0A, 0x02, 0x0A, 0x01, 0x05, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x04, 0x02, 0x0A, 0x02, 0x0A,
+	0x01, 0x06, 0x02, 0x09, 0x02, 0x09, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06,
+	0x03, 0x08, 0x02, 0x08, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x03, 0x10, 0x03, 0x09,
+	0x03, 0x0E, 0x03, 0x0B, 0x03, 0x0C, 0x03, 0x0D, 0x04, 0x08, 0x04, 0x10, 0x0C, 0x14, 0x08, 0x47,
+	0x66, 0x06, 0x15, 0x0C, 0x11, 0x04, 0x06, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x0B, 0x03, 0x0E, 0x03,
+	0x0A, 0x02, 0x10, 0x02, 0x09, 0x02, 0x07, 0x04, 0x07, 0x02, 0x08, 0x02, 0x06, 0x06, 0x06, 0x02,
+	0x07, 0x02, 0x06, 0x03, 0x02, 0x03, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x04, 0x02, 0x06, 0x02,
+	0x06, 0x02, 0x07, 0x01, 0x04, 0x02, 0x06, 0x02, 0x06, 0x01, 0x0C, 0x02, 0x08, 0x01, 0x05, 0x02,
+	0x0B, 0x03, 0x08, 0x02, 0x04, 0x02, 0x0A, 0x03, 0x09, 0x01, 0x06, 0x02, 0x09, 0x02, 0x09, 0x02,
+	0x06, 0x02, 0x09, 0x02, 0x09, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x03, 0x12, 0x03, 0x07, 0x02,
+	0x08, 0x02, 0x08, 0x02, 0x08, 0x03, 0x07, 0x02, 0x07, 0x03, 0x09, 0x03, 0x0E, 0x03, 0x0B, 0x03,
+	0x0C, 0x03, 0x0D, 0x04, 0x08, 0x04, 0x10, 0x0C, 0x14, 0x08, 0x47, 0x66, 0x06, 0x15, 0x0C, 0x11,
+	0x04, 0x06, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x0B, 0x03, 0x0E, 0x03, 0x0A, 0x02, 0x10, 0x02, 0x09,
+	0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x07, 0x02, 0x14, 0x02, 0x06, 0x02, 0x02, 0x10, 0x02,
+	0x02, 0x06, 0x02, 0x02, 0x10, 0x02, 0x02, 0x06, 0x01, 0x03, 0x02, 0x0C, 0x02, 0x03, 0x01, 0x05,
+	0x02, 0x03, 0x02, 0x0C, 0x02, 0x03, 0x02, 0x04, 0x02, 0x03, 0x02, 0x0C, 0x02, 0x03, 0x01, 0x06,
+	0x02, 0x02, 0x10, 0x02, 0x02, 0x06, 0x02, 0x03, 0x0E, 0x03, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06,
+	0x03, 0x12, 0x03, 0x07, 0x02, 0x12, 0x02, 0x08, 0x03, 0x10, 0x03, 0x09, 0x03, 0x0E, 0x03, 0x0B,
+	0x03, 0x0C, 0x03, 0x0D, 0x04, 0x08, 0x04, 0x10, 0x0C, 0x14, 0x08, 0x47, 0x68, 0x01, 0x1C, 0x03,
+	0x1A, 0x05, 0x18, 0x03, 0x01, 0x02, 0x17, 0x03, 0x02, 0x02, 0x17, 0x02, 0x03, 0x02, 0x16, 0x02,
+	0x03, 0x02, 0x16, 0x03, 0x03, 0x02, 0x15, 0x03, 0x04, 0x08, 0x0F, 0x02, 0x05, 0x0A, 0x0C, 0x02,
+	0x0E, 0x02, 0x0C, 0x02, 0x0E, 0x02, 0x0C, 0x01, 0x0F, 0x02, 0x0C, 0x01, 0x0F, 0x02, 0x0C, 0x01,
+	0x0F, 0x02, 0x0C, 0x01, 0x0F, 0x02, 0x0C, 0x01, 0x0F, 0x02, 0x0C, 0x02, 0x0E, 0x02, 0x0C, 0x02,
+	0x0E, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0C, 0x02, 0x0E, 0x04, 0x09, 0x03, 0x0F, 0x0E,
+	0x12, 0x0B, 0x63, 0x65, 0x08, 0x14, 0x0C, 0x10, 0x04, 0x08, 0x04, 0x0D, 0x03, 0x0C, 0x03, 0x0B,
+	0x03, 0x0E, 0x03, 0x09, 0x03, 0x06, 0x02, 0x08, 0x03, 0x08, 0x02, 0x07, 0x02, 0x09, 0x02, 0x07,
+	0x03, 0x07, 0x02, 0x09, 0x03, 0x06, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x06, 0x02, 0x08, 0x02, 0x0A,
+	0x02, 0x06, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x05, 0x02, 0x09, 0x02, 0x0B, 0x01, 0x05, 0x02, 0x09,
+	0x02, 0x0B, 0x02, 0x05, 0x01, 0x0A, 0x02, 0x0A, 0x01, 0x06, 0x02, 0x0A, 0x02, 0x08, 0x02, 0x06,
+	0x02, 0x0B, 0x02, 0x07, 0x02, 0x06, 0x02, 0x0C, 0x01, 0x07, 0x02, 0x07, 0x02, 0x12, 0x02, 0x08,
+	0x02, 0x12, 0x02, 0x09, 0x02, 0x10, 0x02, 0x0A, 0x03, 0x0E, 0x03, 0x0B, 0x04, 0x0A, 0x04, 0x0E,
+	0x04, 0x06, 0x04, 0x11, 0x0C, 0x15, 0x06, 0x48, 0x22, 0x01, 0x14, 0x01, 0x07, 0x03, 0x12, 0x03,
+	0x07, 0x02, 0x05, 0x08, 0x05, 0x02, 0x0E, 0x0A, 0x13, 0x03, 0x06, 0x03, 0x11, 0x03, 0x08, 0x03,
+	0x0F, 0x03, 0x0A, 0x03, 0x0E, 0x02, 0x0C, 0x02, 0x0D, 0x03, 0x0C, 0x03, 0x06, 0x04, 0x02, 0x02,
+	0x0E, 0x02, 0x02, 0x04, 0x01, 0x02, 0x03, 0x02, 0x0E, 0x02, 0x03, 0x02, 0x07, 0x02, 0x0E, 0x02,
+	0x0C, 0x02, 0x0E, 0x02, 0x0D, 0x02, 0x0C, 0x02, 0x0E, 0x02, 0x0C, 0x02, 0x0F, 0x02, 0x0A, 0x02,
+	0x0C, 0x02, 0x02, 0x03, 0x08, 0x03, 0x02, 0x02, 0x07, 0x03, 0x03, 0x02, 0x08, 0x02, 0x03, 0x03,
+	0x06, 0x02, 0x05, 0x02, 0x06, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x02,
+	0x14, 0x0A, 0x14, 0x0A, 0x15, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x08, 0x17, 0x06,
+	0x48, 0x65, 0x08, 0x07, 0x02, 0x0C, 0x0A, 0x05, 0x02, 0x0C, 0x03, 0x06, 0x03, 0x03, 0x02, 0x0C,
+	0x03, 0x0C, 0x02, 0x0C, 0x03, 0x0C, 0x02, 0x0D, 0x02, 0x0C, 0x02, 0x0D, 0x03, 0x0B, 0x04, 0x0C,
+	0x02, 0x0B, 0x02, 0x01, 0x02, 0x0C, 0x02, 0x0A, 0x02, 0x02, 0x02, 0x0C, 0x02, 0x09, 0x02, 0x03,
+	0x02, 0x0C, 0x02, 0x08, 0x02, 0x04, 0x02, 0x0D, 0x02, 0x06, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x05,
+	0x02, 0x05, 0x02, 0x0F, 0x02, 0x03, 0x02, 0x05, 0x02, 0x14, 0x02, 0x05, 0x03, 0x13, 0x02, 0x06,
+	0x02, 0x13, 0x02, 0x06, 0x03, 0x12, 0x03, 0x06, 0x02, 0x12, 0x04, 0x06, 0x02, 0x11, 0x02, 0x01,
+	0x0A, 0x10, 0x02, 0x02, 0x0A, 0x0F, 0x02, 0x04, 0x02, 0x04, 0x02, 0x0F, 0x02, 0x05, 0x02, 0x04,
+	0x02, 0x0E, 0x02, 0x06, 0x08, 0x0E, 0x01, 0x08, 0x06, 0x48, 0x49, 0x04, 0x19, 0x06, 0x17, 0x03,
+	0x02, 0x03, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x04, 0x14, 0x02,
+	0x04, 0x04, 0x14, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x04, 0x14, 0x02, 0x01, 0x02, 0x01, 0x04,
+	0x14, 0x02, 0x01, 0x02, 0x01, 0x02, 0x16, 0x02, 0x01, 0x02, 0x01, 0x04, 0x14, 0x02, 0x01, 0x02,
+	0x01, 0x04, 0x14, 0x02, 0x01, 0x02, 0x01, 0x03, 0x15, 0x02, 0x01, 0x02, 0x01, 0x02, 0x16, 0x02,
+	0x01, 0x02, 0x01, 0x02, 0x15, 0x03, 0x01, 0x02, 0x01, 0x03, 0x13, 0x03, 0x01, 0x04, 0x01, 0x03,
+	0x12, 0x02, 0x01, 0x06, 0x01, 0x02, 0x12, 0x02, 0x01, 0x06, 0x01, 0x02, 0x12, 0x02, 0x01, 0x06,
+	0x01, 0x02, 0x12, 0x02, 0x01, 0x06, 0x01, 0x02, 0x12, 0x02, 0x02, 0x04, 0x02, 0x02, 0x13, 0x02,
+	0x06, 0x02, 0x14, 0x04, 0x02, 0x04, 0x16, 0x06, 0x48, 0x82, 0x02, 0x09, 0x05, 0x0D, 0x04, 0x08,
+	0x06, 0x0B, 0x05, 0x0C, 0x02, 0x0B, 0x02, 0x02, 0x02, 0x0B, 0x02, 0x0A, 0x02, 0x03, 0x03, 0x0A,
+	0x02, 0x09, 0x03, 0x04, 0x02, 0x08, 0x04, 0x09, 0x02, 0x06, 0x02, 0x07, 0x04, 0x08, 0x03, 0x06,
+	0x02, 0x09, 0x02, 0x08, 0x0C, 0x08, 0x02, 0x07, 0x0E, 0x07, 0x02, 0x07, 0x02, 0x0A, 0x02, 0x06,
+	0x03, 0x07, 0x02, 0x0A, 0x02, 0x05, 0x04, 0x06, 0x02, 0x0B, 0x03, 0x06, 0x02, 0x06, 0x02, 0x0C,
+	0x02, 0x06, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x05, 0x03, 0x06,
+	0x02, 0x0C, 0x02, 0x04, 0x04, 0x07, 0x02, 0x0A, 0x02, 0x06, 0x03, 0x07, 0x02, 0x09, 0x03, 0x07,
+	0x02, 0x08, 0x03, 0x06, 0x03, 0x08, 0x02, 0x09, 0x03, 0x03, 0x04, 0x08, 0x03, 0x0A, 0x08, 0x06,
+	0x05, 0x0D, 0x04, 0x09, 0x03, 0x5F, 0x4A, 0x02, 0x1B, 0x03, 0x1A, 0x04, 0x19, 0x05, 0x18, 0x03,
+	0x01, 0x02, 0x17, 0x03, 0x02, 0x02, 0x02, 0x03, 0x12, 0x02, 0x03, 0x02, 0x02, 0x03, 0x11, 0x02,
+	0x04, 0x02, 0x02, 0x04, 0x0F, 0x03, 0x04, 0x03, 0x01, 0x05, 0x0E, 0x02, 0x06, 0x05, 0x01, 0x02,
+	0x0D, 0x02, 0x08, 0x03, 0x03, 0x02, 0x0C, 0x02, 0x0E, 0x02, 0x0B, 0x03, 0x0E, 0x03, 0x0A, 0x02,
+	0x07, 0x02, 0x07, 0x02, 0x0A, 0x02, 0x06, 0x04, 0x06, 0x02, 0x0A, 0x02, 0x05, 0x06, 0x05, 0x02,
+	0x0A, 0x02, 0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x0A, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02,
+	0x0A, 0x02, 0x03, 0x03, 0x04, 0x03, 0x03, 0x02, 0x0B, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+	0x0C, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x0D, 0x02, 0x01, 0x02, 0x06, 0x02, 0x01, 0x02,
+	0x0E, 0x05, 0x06, 0x05, 0x0F, 0x05, 0x03, 0x06, 0x12, 0x0A, 0x16, 0x06, 0x48, 0x2A, 0x06, 0x17,
+	0x08, 0x15, 0x03, 0x04, 0x03, 0x13, 0x03, 0x06, 0x03, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08,
+	0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x0C, 0x12,
+	0x0C, 0x11, 0x04, 0x06, 0x04, 0x0F, 0x03, 0x0A, 0x03, 0x0D, 0x03, 0x0C, 0x03, 0x0C, 0x02, 0x06,
+	0x02, 0x06, 0x02, 0x0C, 0x02, 0x05, 0x04, 0x05, 0x02, 0x0B, 0x02, 0x05, 0x06, 0x05, 0x02, 0x0A,
+	0x02, 0x05, 0x06, 0x05, 0x02, 0x0A, 0x02, 0x05, 0x06, 0x05, 0x02, 0x0A, 0x02, 0x06, 0x04, 0x06,
+	0x02, 0x0A, 0x02, 0x07, 0x02, 0x07, 0x02, 0x0A, 0x02, 0x07, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x06,
+	0x02, 0x06, 0x02, 0x0C, 0x03, 0x05, 0x02, 0x05, 0x03, 0x0D, 0x02, 0x0C, 0x02, 0x0F, 0x03, 0x08,
+	0x03, 0x11, 0x04, 0x04, 0x04, 0x13, 0x0A, 0x17, 0x04, 0x0D, 0x2A, 0x06, 0x17, 0x08, 0x15, 0x03,
+	0x04, 0x03, 0x13, 0x03, 0x06, 0x03, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02, 0x08, 0x02, 0x12, 0x02,
+	0x08, 0x02, 0x12, 0x02, 0x1C, 0x02, 0x1C, 0x0A, 0x14, 0x0C, 0x11, 0x04, 0x06, 0x04, 0x0F, 0x03,
+	0x0A, 0x03, 0x0D, 0x03, 0x0C, 0x03, 0x0C, 0x02, 0x06, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x05, 0x04,
+	0x05, 0x02, 0x0B, 0x02, 0x05, 0x06, 0x05, 0x02, 0x0A, 0x02, 0x05, 0x06, 0x05, 0x02, 0x0A, 0x02,
+	0x05, 0x06, 0x05, 0x02, 0x0A, 0x02, 0x06, 0x04, 0x06, 0x02, 0x0A, 0x02, 0x07, 0x02, 0x07, 0x02,
+	0x0A, 0x02, 0x07, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x06, 0x02, 0x06, 0x02, 0x0C, 0x03, 0x05, 0x02,
+	0x05, 0x03, 0x0D, 0x02, 0x0C, 0x02, 0x0F, 0x03, 0x08, 0x03, 0x11, 0x04, 0x04, 0x04, 0x13, 0x0A,
+	0x17, 0x04, 0x0D, 0x80, 0x03, 0x08, 0x03, 0x0D, 0x08, 0x04, 0x08, 0x09, 0x04, 0x03, 0x03, 0x02,
+	0x03, 0x03, 0x04, 0x08, 0x02, 0x06, 0x06, 0x06, 0x02, 0x07, 0x02, 0x08, 0x04, 0x08, 0x02, 0x06,
+	0x02, 0x09, 0x02, 0x09, 0x02, 0x05, 0x02, 0x16, 0x01, 0x05, 0x02, 0x16, 0x02, 0x05, 0x02, 0x14,
+	0x02, 0x06, 0x02, 0x14, 0x02, 0x06, 0x03, 0x12, 0x03, 0x07, 0x03, 0x10, 0x03, 0x09, 0x02, 0x10,
+	0x02, 0x0B, 0x02, 0x0E, 0x02, 0x0C, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0A, 0x03, 0x0F, 0x03, 0x08,
+	0x03, 0x11, 0x03, 0x06, 0x03, 0x14, 0x03, 0x02, 0x04, 0x16, 0x06, 0x19, 0x04, 0x1B, 0x02, 0x86,
+	0x45, 0x05, 0x02, 0x05, 0x12, 0x0C, 0x11, 0x02, 0x04, 0x02, 0x04, 0x02, 0x10, 0x02, 0x04, 0x02,
+	0x04, 0x02, 0x0F, 0x03, 0x04, 0x02, 0x04, 0x03, 0x0C, 0x04, 0x05, 0x02, 0x05, 0x04, 0x09, 0x03,
+	0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x03, 0x07, 0x03, 0x05, 0x02, 0x01, 0x02, 0x01, 0x02,
+	0x05, 0x03, 0x06, 0x02, 0x04, 0x04, 0x01, 0x02, 0x01, 0x04, 0x04, 0x02, 0x06, 0x02, 0x04, 0x02,
+	0x03, 0x02, 0x03, 0x02, 0x04, 0x02, 0x06, 0x01, 0x0A, 0x02, 0x0A, 0x02, 0x05, 0x02, 0x01, 0x05,
+	0x03, 0x02, 0x03, 0x05, 0x01, 0x02, 0x06, 0x09, 0x02, 0x02, 0x02, 0x09, 0x06, 0x03, 0x04, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x02, 0x09, 0x02,
+	0x09, 0x02, 0x06, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x06, 0x02, 0x03, 0x04,
+	0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x07, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x02,
+	0x08, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x04, 0x02, 0x09, 0x03, 0x03, 0x01, 0x02, 0x02,
+	0x02, 0x01, 0x03, 0x03, 0x0B, 0x04, 0x04, 0x02, 0x04, 0x05, 0x0C, 0x03, 0x04, 0x02, 0x04, 0x03,
+	0x0F, 0x02, 0x04, 0x02, 0x04, 0x02, 0x11, 0x0C, 0x13, 0x0A, 0x46, 0xC1, 0x04, 0x17, 0x0A, 0x12,
+	0x05, 0x04, 0x05, 0x0F, 0x04, 0x09, 0x03, 0x0D, 0x03, 0x02, 0x08, 0x02, 0x04, 0x09, 0x04, 0x01,
+	0x0C, 0x02, 0x03, 0x05, 0x05, 0x03, 0x03, 0x06, 0x03, 0x03, 0x05, 0x02, 0x04, 0x14, 0x04, 0x25,
+	0x12, 0x0C, 0x11, 0x08, 0x03, 0x16, 0x03, 0x02, 0x05, 0x03, 0x02, 0x08, 0x02, 0x03, 0x05, 0x05,
+	0x03, 0x02, 0x0C, 0x02, 0x03, 0x09, 0x04, 0x02, 0x09, 0x02, 0x03, 0x0C, 0x03, 0x0A, 0x04, 0x0E,
+	0x04, 0x06, 0x04, 0x12, 0x0B, 0x15, 0x06, 0xA2, 0xBE, 0x0A, 0x11, 0x07, 0x02, 0x07, 0x0D, 0x04,
+	0x0A, 0x04, 0x0B, 0x03, 0x0E, 0x03, 0x09, 0x03, 0x10, 0x03, 0x07, 0x02, 0x07, 0x06, 0x06, 0x03,
+	0x05, 0x03, 0x06, 0x08, 0x06, 0x03, 0x03, 0x03, 0x06, 0x02, 0x06, 0x02, 0x06, 0x03, 0x02, 0x02,
+	0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x01, 0x03, 0x06, 0x02, 0x08, 0x02, 0x06, 0x05, 0x07, 0x02,
+	0x08, 0x02, 0x07, 0x04, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02, 0x09, 0x02, 0x08, 0x02, 0x13, 0x02,
+	0x06, 0x02, 0x14, 0x04, 0x02, 0x04, 0x15, 0x08, 0x18, 0x04, 0xDF, 0x56, 0x01, 0x1C, 0x03, 0x1A,
+	0x03, 0x1A, 0x03, 0x0E, 0x09, 0x03, 0x03, 0x0C, 0x07, 0x02, 0x03, 0x02, 0x03, 0x0C, 0x04, 0x0A,
+	0x04, 0x0B, 0x03, 0x0B, 0x06, 0x08, 0x04, 0x0B, 0x03, 0x02, 0x03, 0x07, 0x03, 0x06, 0x03, 0x02,
+	0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x02, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x02, 0x03,
+	0x05, 0x06, 0x03, 0x02, 0x02, 0x06, 0x03, 0x02, 0x03, 0x01, 0x03, 0x06, 0x02, 0x01, 0x03, 0x06,
+	0x02, 0x02, 0x03, 0x03, 0x02, 0x06, 0x05, 0x07, 0x01, 0x02, 0x03, 0x04, 0x02, 0x07, 0x04, 0x09,
+	0x03, 0x05, 0x02, 0x07, 0x02, 0x0A, 0x03, 0x06, 0x02, 0x12, 0x03, 0x06, 0x02, 0x12, 0x06, 0x02,
+	0x04, 0x11, 0x03, 0x01, 0x08, 0x11, 0x03, 0x04, 0x04, 0x12, 0x03, 0x1A, 0x03, 0x1A, 0x03, 0x1A,
+	0x03, 0x1C, 0x01, 0x56, 0xA2, 0x06, 0x16, 0x0A, 0x13, 0x03, 0x06, 0x03, 0x11, 0x03, 0x08, 0x03,
+	0x0F, 0x03, 0x0A, 0x03, 0x0E, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0C, 0x02, 0x0E, 0x02,
+	0x0A, 0x04, 0x0E, 0x04, 0x06, 0x06, 0x0E, 0x06, 0x03, 0x03, 0x16, 0x03, 0x01, 0x03, 0x18, 0x05,
+	0x1A, 0x04, 0x1A, 0x04, 0x1A, 0x04, 0x1A, 0x02, 0x01, 0x02, 0x18, 0x02, 0x02, 0x04, 0x14, 0x04,
+	0x03, 0x1A, 0xB6, 0x68, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x14, 0x02, 0x0E, 0x02, 0x0C, 0x03, 0x0C,
+	0x03, 0x0D, 0x02, 0x04, 0x04, 0x04, 0x02, 0x12, 0x08, 0x15, 0x03, 0x04, 0x03, 0x13, 0x03, 0x06,
+	0x03, 0x12, 0x02, 0x08, 0x02, 0x11, 0x02, 0x0A, 0x02, 0x0B, 0x03, 0x02, 0x02, 0x0A, 0x02, 0x02,
+	0x03, 0x06, 0x03, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x03, 0x0B, 0x02, 0x0A, 0x02, 0x11, 0x02, 0x08,
+	0x02, 0x12, 0x03, 0x06, 0x03, 0x13, 0x03, 0x04, 0x03, 0x15, 0x08, 0x12, 0x02, 0x04, 0x04, 0x04,
+	0x02, 0x0D, 0x03, 0x0C, 0x03, 0x0C, 0x02, 0x0E, 0x02, 0x14, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x68,
+	0x84, 0x06, 0x16, 0x0A, 0x13, 0x03, 0x06, 0x03, 0x12, 0x02, 0x08, 0x02, 0x11, 0x02, 0x0A, 0x02,
+	0x10, 0x02, 0x0A, 0x02, 0x0F, 0x03, 0x0A, 0x03, 0x0B, 0x05, 0x0B, 0x06, 0x07, 0x06, 0x0C, 0x06,
+	0x05, 0x03, 0x14, 0x03, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02, 0x04, 0x02, 0x16, 0x02,
+	0x04, 0x02, 0x16, 0x02, 0x04, 0x03, 0x14, 0x03, 0x05, 0x18, 0x07, 0x16, 0x0B, 0x02, 0x05, 0x02,
+	0x04, 0x03, 0x0E, 0x02, 0x04, 0x03, 0x04, 0x03, 0x0D, 0x02, 0x05, 0x02, 0x05, 0x02, 0x0D, 0x03,
+	0x04, 0x02, 0x05, 0x02, 0x0E, 0x02, 0x05, 0x02, 0x05, 0x02, 0x81,
+};
+
+/**
+ * @brief 30x30 compressed icon offsets.
+ */
+const uint32_t icon30_rle_offset[] = {
+	0, 69, 162, 255, 348, 441, 528, 715,
+	886, 1031, 1136, 1227, 1240, 1264, 1304, 1367,
+	1466, 1553, 1660, 1807, 1908, 1962, 2023, 2114,
+	2205, 2298, 2475, 2544, 2683, 2822, 2975, 3128,
+	3237, 3370, 3471, 3532, 3659, 3766, 3873, 3948,
+	4069, 4146, 4197, 4276, 4381, 4496, 4619, 4732,
+	4819, 4936, 5057, 5178, 5305, 5430, 5565, 5690,
+	5811, 5904, 6091, 6168, 6251, 6372, 6435, 6528,
+};
+
+icon_font_t icon_30_rle = {
+    30,
+    30,
+    0,
+    icon30_rle_data,
+    icon30_rle_offset
+};
+
+/**
+ * @brief 59x59 compressed icon data array.
+ */
+const uint8_t icon59_rle_data[] = {
+	0xFF, 0xFF, 0x94, 0x25, 0x14, 0x28, 0x12, 0x2A, 0x11, 0x2A, 0x10, 0x04, 0x24, 0x04, 0x0F, 0x04,
+	0x24, 0x04, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04,
+	0x25, 0x04, 0x0E, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04,
+	0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04,
+	0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04,
+	0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04,
+	0x25, 0x08, 0x0A, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x03, 0x0F, 0x04,
+	0x25, 0x03, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x24, 0x04, 0x10, 0x2A,
+	0x11, 0x2A, 0x12, 0x28, 0x15, 0x25, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x94, 0x25, 0x14, 0x28, 0x12,
+	0x2A, 0x11, 0x2A, 0x10, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x25, 0x03, 0x0F,
+	0x04, 0x05, 0x04, 0x1C, 0x03, 0x0F, 0x04, 0x04, 0x06, 0x1B, 0x03, 0x0F, 0x04, 0x04, 0x07, 0x1A,
+	0x04, 0x0E, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04,
+	0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A,
+	0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A,
+	0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04,
+	0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A,
+	0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A,
+	0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x08, 0x0A, 0x04, 0x04, 0x07, 0x1A, 0x04, 0x0E, 0x04, 0x04,
+	0x06, 0x1B, 0x03, 0x0F, 0x04, 0x05, 0x04, 0x1C, 0x03, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x24,
+	0x04, 0x0F, 0x04, 0x24, 0x04, 0x10, 0x2A, 0x11, 0x2A, 0x12, 0x28, 0x15, 0x25, 0xFF, 0xFF, 0x98,
+	0xFF, 0xFF, 0x94, 0x25, 0x14, 0x28, 0x12, 0x2A, 0x11, 0x2A, 0x10, 0x04, 0x24, 0x04, 0x0F, 0x04,
+	0x24, 0x04, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x05, 0x0C, 0x14, 0x03, 0x0F, 0x04, 0x04, 0x0E,
+	0x13, 0x03, 0x0F, 0x04, 0x04, 0x0E, 0x13, 0x04, 0x0E, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04,
+	0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08,
+	0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E,
+	0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04,
+	0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08,
+	0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E,
+	0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04, 0x04, 0x0E, 0x13, 0x08, 0x0A, 0x04,
+	0x04, 0x0E, 0x13, 0x04, 0x0E, 0x04, 0x04, 0x0E, 0x13, 0x03, 0x0F, 0x04, 0x05, 0x0C, 0x14, 0x03,
+	0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x24, 0x04, 0x10, 0x2A, 0x11, 0x2A,
+	0x12, 0x28, 0x15, 0x25, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x94, 0x25, 0x14, 0x28, 0x12, 0x2A, 0x11,
+	0x2A, 0x10, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x05,
+	0x12, 0x0E, 0x03, 0x0F, 0x04, 0x04, 0x14, 0x0D, 0x03, 0x0F, 0x04, 0x04, 0x14, 0x0D, 0x04, 0x0E,
+	0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D,
+	0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04,
+	0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A,
+	0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D,
+	0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04,
+	0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A,
+	0x04, 0x04, 0x14, 0x0D, 0x08, 0x0A, 0x04, 0x04, 0x14, 0x0D, 0x04, 0x0E, 0x04, 0x04, 0x14, 0x0D,
+	0x03, 0x0F, 0x04, 0x05, 0x12, 0x0E, 0x03, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x24, 0x04, 0x0F,
+	0x04, 0x24, 0x04, 0x10, 0x2A, 0x11, 0x2A, 0x12, 0x28, 0x15, 0x25, 0xFF, 0xFF, 0x98, 0xFF, 0xFF,
+	0x94, 0x25, 0x14, 0x28, 0x12, 0x2A, 0x11, 0x2A, 0x10, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x24, 0x04,
+	0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x05, 0x1A, 0x06, 0x03, 0x0F, 0x04, 0x04, 0x1D, 0x04, 0x03,
+	0x0F, 0x04, 0x04, 0x1D, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D,
+	0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04,
+	0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08,
+	0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D,
+	0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04,
+	0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08,
+	0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D, 0x04, 0x08, 0x0A, 0x04, 0x04, 0x1D,
+	0x04, 0x04, 0x0E, 0x04, 0x04, 0x1D, 0x04, 0x03, 0x0F, 0x04, 0x05, 0x1A, 0x06, 0x03, 0x0F, 0x04,
+	0x25, 0x03, 0x0F, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x24, 0x04, 0x10, 0x2A, 0x11, 0x2A, 0x12, 0x28,
+	0x15, 0x25, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x94, 0x25, 0x14, 0x28, 0x12, 0x2A, 0x11, 0x2A, 0x10,
+	0x04, 0x24, 0x04, 0x0F, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x25, 0x03, 0x0F,
+	0x04, 0x25, 0x03, 0x0F, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x08, 0x0A, 0x04, 0x10, 0x01, 0x14,
+	0x08, 0x0A, 0x04, 0x10, 0x03, 0x12, 0x08, 0x0A, 0x04, 0x10, 0x04, 0x11, 0x08, 0x0A, 0x04, 0x10,
+	0x05, 0x10, 0x08, 0x0A, 0x04, 0x10, 0x07, 0x0E, 0x08, 0x0A, 0x04, 0x07, 0x03, 0x06, 0x09, 0x0C,
+	0x08, 0x0A, 0x04, 0x07, 0x06, 0x03, 0x0A, 0x0B, 0x08, 0x0A, 0x04, 0x09, 0x13, 0x09, 0x08, 0x0A,
+	0x04, 0x0A, 0x0B, 0x02, 0x05, 0x09, 0x08, 0x0A, 0x04, 0x0C, 0x09, 0x06, 0x02, 0x08, 0x08, 0x0A,
+	0x04, 0x0D, 0x08, 0x10, 0x08, 0x0A, 0x04, 0x0E, 0x07, 0x10, 0x08, 0x0A, 0x04, 0x10, 0x05, 0x10,
+	0x08, 0x0A, 0x04, 0x12, 0x03, 0x10, 0x08, 0x0A, 0x04, 0x13, 0x01, 0x11, 0x08, 0x0A, 0x04, 0x25,
+	0x08, 0x0A, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x25, 0x03, 0x0F, 0x04, 0x25,
+	0x03, 0x0F, 0x04, 0x24, 0x04, 0x0F, 0x04, 0x24, 0x04, 0x10, 0x2A, 0x11, 0x2A, 0x12, 0x28, 0x15,
+	0x25, 0xFF, 0xFF, 0x98, 0xFF, 0xCA, 0x03, 0x36, 0x07, 0x33, 0x09, 0x31, 0x0B, 0x30, 0x04, 0x03,
+	0x04, 0x2F, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05,
+	0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05,
+	0x04, 0x22, 0x05, 0x07, 0x04, 0x05, 0x04, 0x20, 0x09, 0x05, 0x04, 0x05, 0x04, 0x1F, 0x0B, 0x04,
+	0x04, 0x05, 0x04, 0x1F, 0x05, 0x01, 0x05, 0x04, 0x04, 0x05, 0x04, 0x1F, 0x04, 0x03, 0x04, 0x04,
+	0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x12, 0x05, 0x07, 0x04, 0x05,
+	0x04, 0x03, 0x04, 0x05, 0x04, 0x10, 0x08, 0x06, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x10,
+	0x09, 0x05, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0F, 0x0B, 0x04, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x0F, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03,
+	0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x05, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x05, 0x0F, 0x0B, 0x05, 0x0B, 0x05,
+	0x0B, 0x11, 0x09, 0x07, 0x09, 0x07, 0x09, 0x13, 0x08, 0x08, 0x07, 0x08, 0x08, 0x15, 0x05, 0x0B,
+	0x05, 0x0B, 0x05, 0xFF, 0x33, 0xFF, 0xC9, 0x05, 0x34, 0x09, 0x31, 0x0A, 0x31, 0x0B, 0x30, 0x03,
+	0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04,
+	0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x22, 0x05,
+	0x07, 0x04, 0x05, 0x04, 0x21, 0x07, 0x06, 0x04, 0x05, 0x04, 0x20, 0x09, 0x05, 0x04, 0x05, 0x04,
+	0x1F, 0x0B, 0x04, 0x04, 0x05, 0x04, 0x1F, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05, 0x04, 0x1E, 0x04,
+	0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04,
+	0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04,
+	0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x04,
+	0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x13, 0x03, 0x08, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04,
+	0x11, 0x07, 0x06, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x10, 0x09, 0x05, 0x04, 0x05, 0x04,
+	0x03, 0x04, 0x05, 0x04, 0x0F, 0x0B, 0x04, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0F, 0x0B,
+	0x04, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04,
+	0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04,
+	0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04,
+	0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04,
+	0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D,
+	0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04,
+	0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04,
+	0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04,
+	0x0E, 0x0D, 0x04, 0x04, 0x03, 0x04, 0x04, 0x05, 0x04, 0x04, 0x0F, 0x0B, 0x05, 0x05, 0x01, 0x05,
+	0x05, 0x05, 0x01, 0x05, 0x10, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x11, 0x09, 0x07, 0x09, 0x07, 0x09,
+	0x13, 0x07, 0x09, 0x07, 0x09, 0x07, 0x17, 0x01, 0x0F, 0x01, 0x0F, 0x01, 0xFF, 0x35, 0xFF, 0xC9,
+	0x05, 0x34, 0x09, 0x31, 0x0A, 0x31, 0x0B, 0x30, 0x03, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E,
+	0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x2E,
+	0x04, 0x05, 0x04, 0x2E, 0x04, 0x05, 0x04, 0x22, 0x05, 0x07, 0x04, 0x05, 0x04, 0x21, 0x07, 0x06,
+	0x04, 0x05, 0x04, 0x20, 0x09, 0x05, 0x04, 0x05, 0x04, 0x1F, 0x0B, 0x04, 0x04, 0x05, 0x04, 0x1F,
+	0x0B, 0x04, 0x04, 0x05, 0x04, 0x1E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x0D, 0x03, 0x04, 0x05,
+	0x04, 0x1E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x0D, 0x03,
+	0x04, 0x05, 0x04, 0x1E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x1E, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x13,
+	0x03, 0x08, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x11, 0x07, 0x06, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x10,
+	0x09, 0x05, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0F, 0x0B, 0x04, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0F,
+	0x0B, 0x04, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E,
+	0x0D, 0x03, 0x0D, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x0D, 0x04, 0x0B, 0x04, 0x05, 0x04, 0x04, 0x0F,
+	0x0B, 0x05, 0x0B, 0x05, 0x05, 0x01, 0x05, 0x10, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x11, 0x09, 0x07,
+	0x09, 0x07, 0x09, 0x13, 0x07, 0x09, 0x07, 0x09, 0x07, 0x17, 0x01, 0x0F, 0x01, 0x0F, 0x01, 0xFF,
+	0x35, 0xFF, 0xC9, 0x05, 0x34, 0x09, 0x31, 0x0A, 0x31, 0x0B, 0x30, 0x0C, 0x2E, 0x0D, 0x2E, 0x0D,
+	0x2E, 0x0D, 0x2E, 0x0D, 0x2E, 0x0D, 0x2E, 0x0D, 0x2E, 0x0D, 0x22, 0x05, 0x07, 0x0D, 0x21, 0x07,
+	0x06, 0x0D, 0x20, 0x09, 0x05, 0x0D, 0x1F, 0x0B, 0x04, 0x0D, 0x1F, 0x0B, 0x04, 0x0D, 0x1E, 0x0D,
+	0x03, 0x0D, 0x1E, 0x0D, 0x03, 0x0D, 0x1E, 0x0D, 0x03, 0x0D, 0x1E, 0x0D, 0x03, 0x0D, 0x1E, 0x0D,
+	0x03, 0x0D, 0x1E, 0x0D, 0x03, 0x0D, 0x1E, 0x0D, 0x03, 0x0D, 0x13, 0x03, 0x08, 0x0D, 0x03, 0x0D,
+	0x11, 0x07, 0x06, 0x0D, 0x03, 0x0D, 0x10, 0x09, 0x05, 0x0D, 0x03, 0x0D, 0x0F, 0x0B, 0x04, 0x0D,
+	0x03, 0x0D, 0x0F, 0x0B, 0x04, 0x0D, 0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D,
+	0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D,
+	0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D,
+	0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D,
+	0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D, 0x0E, 0x0D, 0x03, 0x0D, 0x03, 0x0D,
+	0x0E, 0x0D, 0x04, 0x0B, 0x04, 0x0D, 0x0F, 0x0B, 0x05, 0x0B, 0x05, 0x0B, 0x10, 0x0B, 0x05, 0x0B,
+	0x05, 0x0B, 0x11, 0x09, 0x07, 0x09, 0x07, 0x09, 0x13, 0x07, 0x09, 0x07, 0x09, 0x07, 0x17, 0x01,
+	0x0F, 0x01, 0x0F, 0x01, 0xFF, 0x35, 0xFF, 0xB9, 0x05, 0x35, 0x07, 0x33, 0x09, 0x32, 0x09, 0x31,
+	0x05, 0x01, 0x05, 0x30, 0x04, 0x03, 0x04, 0x2F, 0x05, 0x03, 0x05, 0x2E, 0x04, 0x05, 0x04, 0x2D,
+	0x05, 0x05, 0x05, 0x2C, 0x04, 0x07, 0x04, 0x2B, 0x05, 0x07, 0x05, 0x2A, 0x04, 0x09, 0x04, 0x29,
+	0x05, 0x09, 0x05, 0x28, 0x04, 0x0B, 0x04, 0x27, 0x05, 0x0B, 0x05, 0x26, 0x04, 0x0D, 0x04, 0x25,
+	0x05, 0x0D, 0x05, 0x24, 0x04, 0x0F, 0x04, 0x23, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x21,
+	0x04, 0x13, 0x04, 0x20, 0x04, 0x13, 0x04, 0x1F, 0x04, 0x15, 0x04, 0x1E, 0x04, 0x15, 0x04, 0x1D,
+	0x04, 0x17, 0x04, 0x1C, 0x04, 0x17, 0x04, 0x1B, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19, 0x04, 0x19,
+	0x04, 0x1B, 0x04, 0x18, 0x04, 0x1B, 0x04, 0x17, 0x04, 0x1D, 0x04, 0x16, 0x04, 0x1D, 0x04, 0x15,
+	0x04, 0x1F, 0x04, 0x14, 0x04, 0x0D, 0x05, 0x0D, 0x04, 0x13, 0x04, 0x0B, 0x0B, 0x0B, 0x04, 0x12,
+	0x04, 0x07, 0x13, 0x07, 0x04, 0x12, 0x04, 0x05, 0x17, 0x05, 0x04, 0x12, 0x12, 0x05, 0x12, 0x12,
+	0x0F, 0x0B, 0x0F, 0x12, 0x0B, 0x13, 0x0A, 0x14, 0x07, 0x19, 0x06, 0xFF, 0xFF, 0x96, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0x03, 0x36, 0x07, 0x33, 0x09, 0x32, 0x09, 0x32,
+	0x09, 0x32, 0x09, 0x32, 0x09, 0x32, 0x09, 0x33, 0x07, 0x35, 0x05, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x09, 0x2F, 0x0E, 0x2C, 0x11, 0x28, 0x14, 0x26, 0x07, 0x08, 0x07,
+	0x25, 0x05, 0x0D, 0x05, 0x24, 0x04, 0x0F, 0x04, 0x25, 0x02, 0x11, 0x02, 0xE0, 0x03, 0x36, 0x07,
+	0x33, 0x09, 0x32, 0x09, 0x32, 0x09, 0x32, 0x09, 0x32, 0x09, 0x32, 0x09, 0x33, 0x07, 0x35, 0x05,
+	0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x0A, 0x2E, 0x11, 0x27, 0x16, 0x23, 0x1A, 0x20, 0x08,
+	0x0C, 0x09, 0x1C, 0x08, 0x11, 0x07, 0x1A, 0x06, 0x16, 0x07, 0x17, 0x06, 0x19, 0x06, 0x15, 0x05,
+	0x1C, 0x06, 0x14, 0x04, 0x1F, 0x04, 0x15, 0x02, 0x21, 0x02, 0x24, 0x09, 0x2F, 0x0E, 0x2C, 0x11,
+	0x28, 0x14, 0x26, 0x07, 0x08, 0x07, 0x25, 0x05, 0x0D, 0x05, 0x24, 0x04, 0x0F, 0x04, 0x25, 0x02,
+	0x11, 0x02, 0xE0, 0x03, 0x36, 0x07, 0x33, 0x09, 0x32, 0x09, 0x32, 0x09, 0x32, 0x09, 0x32, 0x09,
+	0x32, 0x09, 0x33, 0x07, 0x35, 0x05, 0xFF, 0xF4, 0xFF, 0xF2, 0x08, 0x2D, 0x15, 0x23, 0x1A, 0x1E,
+	0x20, 0x1A, 0x0B, 0x0C, 0x0C, 0x16, 0x09, 0x15, 0x09, 0x12, 0x08, 0x1A, 0x08, 0x10, 0x06, 0x20,
+	0x07, 0x0D, 0x06, 0x23, 0x06, 0x0A, 0x06, 0x26, 0x06, 0x08, 0x06, 0x28, 0x06, 0x06, 0x05, 0x11,
+	0x0A, 0x11, 0x05, 0x05, 0x04, 0x0F, 0x11, 0x0E, 0x04, 0x06, 0x02, 0x0D, 0x16, 0x0D, 0x03, 0x13,
+	0x1A, 0x20, 0x08, 0x0C, 0x09, 0x1C, 0x08, 0x11, 0x07, 0x1A, 0x06, 0x16, 0x07, 0x17, 0x06, 0x19,
+	0x06, 0x15, 0x05, 0x1C, 0x06, 0x14, 0x04, 0x1F, 0x04, 0x15, 0x02, 0x21, 0x02, 0x24, 0x09, 0x2F,
+	0x0E, 0x2C, 0x11, 0x28, 0x14, 0x26, 0x07, 0x08, 0x07, 0x25, 0x05, 0x0D, 0x05, 0x24, 0x04, 0x0F,
+	0x04, 0x25, 0x02, 0x11, 0x02, 0xE0, 0x03, 0x36, 0x07, 0x33, 0x09, 0x32, 0x09, 0x32, 0x09, 0x32,
+	0x09, 0x32, 0x09, 0x32, 0x09, 0x33, 0x07, 0x35, 0x05, 0xFF, 0xF4, 0xFF, 0x20, 0x02, 0x39, 0x03,
+	0x36, 0x05, 0x36, 0x04, 0x1F, 0x08, 0x0E, 0x05, 0x1A, 0x15, 0x07, 0x04, 0x18, 0x18, 0x05, 0x05,
+	0x16, 0x1A, 0x06, 0x04, 0x16, 0x0C, 0x0B, 0x03, 0x05, 0x05, 0x15, 0x09, 0x18, 0x06, 0x12, 0x08,
+	0x19, 0x09, 0x10, 0x07, 0x1B, 0x0B, 0x0D, 0x06, 0x1B, 0x05, 0x03, 0x06, 0x0A, 0x06, 0x1D, 0x04,
+	0x05, 0x06, 0x08, 0x06, 0x1C, 0x05, 0x07, 0x06, 0x06, 0x05, 0x11, 0x07, 0x06, 0x04, 0x0A, 0x05,
+	0x05, 0x04, 0x0F, 0x09, 0x05, 0x05, 0x0C, 0x04, 0x06, 0x02, 0x0D, 0x0B, 0x06, 0x05, 0x0D, 0x03,
+	0x13, 0x0C, 0x05, 0x09, 0x20, 0x08, 0x09, 0x0C, 0x1C, 0x08, 0x0A, 0x0E, 0x1A, 0x07, 0x0B, 0x05,
+	0x05, 0x07, 0x17, 0x06, 0x0C, 0x05, 0x08, 0x06, 0x15, 0x05, 0x0D, 0x05, 0x0A, 0x06, 0x14, 0x04,
+	0x0D, 0x05, 0x0D, 0x04, 0x15, 0x02, 0x0D, 0x05, 0x0F, 0x02, 0x24, 0x09, 0x31, 0x0C, 0x2E, 0x0F,
+	0x2B, 0x11, 0x2A, 0x04, 0x07, 0x07, 0x27, 0x05, 0x0B, 0x05, 0x26, 0x04, 0x0D, 0x04, 0x24, 0x05,
+	0x0F, 0x02, 0x25, 0x04, 0x35, 0x05, 0x36, 0x04, 0x35, 0x05, 0x09, 0x03, 0x2A, 0x04, 0x08, 0x07,
+	0x26, 0x05, 0x08, 0x09, 0x25, 0x04, 0x09, 0x09, 0x23, 0x05, 0x0A, 0x09, 0x23, 0x04, 0x0B, 0x09,
+	0x21, 0x05, 0x0C, 0x09, 0x21, 0x04, 0x0D, 0x09, 0x1F, 0x05, 0x0F, 0x07, 0x20, 0x04, 0x11, 0x05,
+	0x20, 0x04, 0x37, 0x03, 0x39, 0x01, 0xFF, 0x5C, 0xFF, 0x7C, 0x03, 0x38, 0x04, 0x37, 0x05, 0x36,
+	0x07, 0x34, 0x08, 0x33, 0x09, 0x32, 0x0A, 0x31, 0x04, 0x01, 0x06, 0x30, 0x04, 0x02, 0x06, 0x2F,
+	0x04, 0x03, 0x06, 0x2E, 0x04, 0x04, 0x06, 0x2D, 0x04, 0x06, 0x05, 0x2C, 0x04, 0x07, 0x05, 0x2B,
+	0x04, 0x08, 0x05, 0x2A, 0x04, 0x07, 0x05, 0x22, 0x04, 0x05, 0x04, 0x06, 0x06, 0x22, 0x05, 0x04,
+	0x04, 0x04, 0x07, 0x23, 0x07, 0x02, 0x04, 0x03, 0x07, 0x26, 0x06, 0x01, 0x04, 0x02, 0x06, 0x29,
+	0x0A, 0x01, 0x06, 0x2B, 0x0F, 0x2D, 0x0D, 0x2F, 0x0A, 0x33, 0x07, 0x34, 0x07, 0x33, 0x09, 0x31,
+	0x0B, 0x2E, 0x0F, 0x2C, 0x10, 0x29, 0x0B, 0x02, 0x06, 0x27, 0x06, 0x02, 0x04, 0x03, 0x06, 0x25,
+	0x06, 0x03, 0x04, 0x04, 0x06, 0x24, 0x04, 0x05, 0x04, 0x06, 0x05, 0x24, 0x02, 0x06, 0x04, 0x07,
+	0x05, 0x2B, 0x04, 0x08, 0x05, 0x2A, 0x04, 0x07, 0x06, 0x2A, 0x04, 0x06, 0x06, 0x2B, 0x04, 0x05,
+	0x06, 0x2C, 0x04, 0x04, 0x06, 0x2D, 0x04, 0x03, 0x05, 0x2F, 0x04, 0x02, 0x05, 0x30, 0x04, 0x01,
+	0x05, 0x31, 0x09, 0x32, 0x08, 0x33, 0x07, 0x34, 0x06, 0x35, 0x04, 0x37, 0x03, 0x39, 0x01, 0xFF,
+	0x0D, 0xFF, 0xFF, 0xFF, 0x07, 0x0E, 0x04, 0x1E, 0x0A, 0x10, 0x03, 0x20, 0x08, 0x10, 0x03, 0x21,
+	0x07, 0x10, 0x04, 0x20, 0x07, 0x03, 0x03, 0x03, 0x03, 0x04, 0x20, 0x04, 0x07, 0x03, 0x03, 0x03,
+	0x03, 0x04, 0x21, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x04, 0x21, 0x03, 0x07, 0x03, 0x03, 0x03,
+	0x03, 0x04, 0x21, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x04, 0x21, 0x03, 0x07, 0x03, 0x09, 0x04,
+	0x21, 0x03, 0x07, 0x03, 0x09, 0x04, 0x21, 0x03, 0x07, 0x03, 0x09, 0x04, 0x21, 0x03, 0x07, 0x10,
+	0x21, 0x03, 0x07, 0x10, 0x21, 0x03, 0x07, 0x10, 0x21, 0x03, 0x07, 0x0F, 0x22, 0x03, 0x0D, 0x03,
+	0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03,
+	0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03,
+	0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03,
+	0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x27, 0x04, 0x0D, 0x03, 0x04, 0x27, 0x0D, 0x03,
+	0x04, 0x27, 0x0D, 0x03, 0x04, 0x25, 0x0F, 0x03, 0x04, 0x23, 0x11, 0x03, 0x0A, 0x04, 0x0A, 0x03,
+	0x1D, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x1D, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x1D, 0x03, 0x0A, 0x04,
+	0x0A, 0x03, 0x1D, 0x03, 0x0A, 0x04, 0x0A, 0x03, 0x1D, 0x03, 0x0A, 0x04, 0x0A, 0x04, 0x1C, 0x03,
+	0x04, 0x1D, 0x17, 0x03, 0x04, 0x1D, 0x17, 0x03, 0x05, 0x1C, 0x20, 0x1A, 0x49, 0xFF, 0xFF, 0xCA,
+	0x0F, 0x04, 0x1E, 0x0A, 0x10, 0x03, 0x20, 0x08, 0x10, 0x03, 0x21, 0x07, 0x10, 0x04, 0x20, 0x07,
+	0x03, 0x03, 0x03, 0x03, 0x04, 0x21, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x04, 0x21, 0x03, 0x07,
+	0x03, 0x03, 0x03, 0x03, 0x04, 0x21, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x04, 0x21, 0x03, 0x07,
+	0x03, 0x04, 0x01, 0x04, 0x04, 0x21, 0x03, 0x07, 0x03, 0x09, 0x04, 0x21, 0x03, 0x07, 0x03, 0x09,
+	0x04, 0x21, 0x03, 0x07, 0x03, 0x09, 0x04, 0x21, 0x03, 0x07, 0x04, 0x07, 0x05, 0x21, 0x03, 0x07,
+	0x10, 0x21, 0x03, 0x07, 0x10, 0x21, 0x03, 0x08, 0x0E, 0x22, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D,
+	0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D, 0x03, 0x28, 0x03, 0x0D,
+	0x03, 0x1A, 0x08, 0x06, 0x03, 0x0D, 0x03, 0x17, 0x0E, 0x04, 0x02, 0x0D, 0x03, 0x16, 0x10, 0x04,
+	0x01, 0x0D, 0x03, 0x15, 0x12, 0x03, 0x01, 0x0D, 0x03, 0x14, 0x14, 0x10, 0x03, 0x13, 0x16, 0x0F,
+	0x03, 0x12, 0x05, 0x02, 0x0A, 0x02, 0x05, 0x0E, 0x03, 0x12, 0x05, 0x03, 0x08, 0x03, 0x05, 0x0E,
+	0x03, 0x11, 0x07, 0x03, 0x06, 0x04, 0x06, 0x0D, 0x03, 0x05, 0x09, 0x03, 0x08, 0x03, 0x04, 0x04,
+	0x07, 0x0D, 0x03, 0x04, 0x0A, 0x03, 0x09, 0x03, 0x02, 0x04, 0x08, 0x0D, 0x03, 0x04, 0x0A, 0x03,
+	0x0A, 0x07, 0x09, 0x0D, 0x03, 0x04, 0x0A, 0x03, 0x0B, 0x05, 0x0A, 0x0D, 0x03, 0x0A, 0x04, 0x03,
+	0x0B, 0x04, 0x0B, 0x0D, 0x03, 0x0A, 0x04, 0x03, 0x0A, 0x06, 0x0A, 0x0D, 0x03, 0x0A, 0x04, 0x03,
+	0x09, 0x08, 0x09, 0x0D, 0x03, 0x0A, 0x04, 0x03, 0x08, 0x04, 0x03, 0x03, 0x08, 0x0D, 0x03, 0x0A,
+	0x04, 0x03, 0x07, 0x04, 0x05, 0x03, 0x07, 0x0D, 0x03, 0x0A, 0x04, 0x03, 0x06, 0x04, 0x07, 0x03,
+	0x06, 0x0D, 0x03, 0x05, 0x0A, 0x03, 0x05, 0x03, 0x09, 0x02, 0x05, 0x0E, 0x03, 0x04, 0x0C, 0x02,
+	0x05, 0x02, 0x10, 0x0F, 0x03, 0x04, 0x0C, 0x03, 0x16, 0x0F, 0x03, 0x04, 0x0D, 0x03, 0x14, 0x28,
+	0x12, 0x2A, 0x10, 0x2D, 0x0C, 0x0A, 0x27, 0x08, 0xFF, 0xC7, 0x01, 0x38, 0x05, 0x36, 0x05, 0x35,
+	0x07, 0x34, 0x07, 0x33, 0x09, 0x31, 0x0B, 0x2F, 0x0D, 0x2E, 0x0D, 0x2F, 0x0B, 0x34, 0x03, 0x08,
+	0x09, 0x27, 0x03, 0x07, 0x0B, 0x26, 0x03, 0x07, 0x0B, 0x26, 0x03, 0x07, 0x0B, 0x18, 0x05, 0x09,
+	0x03, 0x07, 0x04, 0x04, 0x03, 0x17, 0x08, 0x07, 0x03, 0x07, 0x04, 0x04, 0x03, 0x16, 0x0A, 0x06,
+	0x03, 0x07, 0x04, 0x04, 0x03, 0x15, 0x05, 0x01, 0x05, 0x06, 0x03, 0x07, 0x0B, 0x15, 0x04, 0x03,
+	0x04, 0x06, 0x03, 0x07, 0x0B, 0x15, 0x04, 0x03, 0x04, 0x06, 0x03, 0x07, 0x0B, 0x15, 0x05, 0x02,
+	0x04, 0x06, 0x03, 0x08, 0x0A, 0x15, 0x0B, 0x06, 0x03, 0x0B, 0x04, 0x19, 0x09, 0x07, 0x03, 0x0B,
+	0x04, 0x1A, 0x08, 0x07, 0x03, 0x0B, 0x04, 0x1B, 0x05, 0x09, 0x03, 0x0A, 0x04, 0x1D, 0x04, 0x09,
+	0x03, 0x09, 0x05, 0x1D, 0x04, 0x09, 0x10, 0x1E, 0x04, 0x09, 0x10, 0x1E, 0x04, 0x09, 0x0F, 0x1F,
+	0x06, 0x07, 0x0C, 0x23, 0x10, 0x2C, 0x0F, 0x2D, 0x0D, 0x35, 0x06, 0x37, 0x04, 0x37, 0x04, 0x36,
+	0x07, 0x33, 0x09, 0x31, 0x0B, 0x2F, 0x0D, 0x2E, 0x04, 0x05, 0x04, 0x2E, 0x03, 0x07, 0x03, 0x2D,
+	0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2D, 0x04, 0x05, 0x04, 0x2E,
+	0x05, 0x03, 0x05, 0x2E, 0x0D, 0x2F, 0x0B, 0x31, 0x09, 0x54, 0xFF, 0xFF, 0xFF, 0xD5, 0x03, 0x37,
+	0x05, 0x36, 0x06, 0x35, 0x07, 0x34, 0x08, 0x33, 0x09, 0x32, 0x0A, 0x31, 0x04, 0x01, 0x06, 0x30,
+	0x04, 0x02, 0x06, 0x17, 0x1C, 0x03, 0x06, 0x15, 0x1D, 0x04, 0x06, 0x13, 0x1E, 0x05, 0x06, 0x12,
+	0x1D, 0x07, 0x06, 0x11, 0x04, 0x21, 0x06, 0x10, 0x04, 0x22, 0x06, 0x0F, 0x04, 0x23, 0x06, 0x0E,
+	0x04, 0x24, 0x05, 0x0E, 0x04, 0x23, 0x05, 0x0F, 0x04, 0x22, 0x05, 0x10, 0x04, 0x21, 0x05, 0x11,
+	0x1C, 0x08, 0x05, 0x12, 0x1E, 0x05, 0x06, 0x12, 0x1E, 0x04, 0x06, 0x14, 0x1D, 0x03, 0x06, 0x2E,
+	0x04, 0x02, 0x06, 0x2F, 0x04, 0x01, 0x06, 0x30, 0x04, 0x01, 0x05, 0x31, 0x09, 0x32, 0x08, 0x33,
+	0x07, 0x34, 0x06, 0x35, 0x05, 0x36, 0x04, 0x38, 0x02, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0xFF, 0x8F,
+	0x04, 0x36, 0x05, 0x35, 0x06, 0x34, 0x07, 0x33, 0x08, 0x32, 0x09, 0x31, 0x05, 0x01, 0x04, 0x30,
+	0x05, 0x02, 0x04, 0x2F, 0x05, 0x03, 0x04, 0x2D, 0x06, 0x04, 0x04, 0x2C, 0x06, 0x05, 0x1E, 0x11,
+	0x05, 0x07, 0x1F, 0x0F, 0x05, 0x08, 0x1F, 0x0E, 0x05, 0x0A, 0x1E, 0x0D, 0x05, 0x25, 0x04, 0x0B,
+	0x06, 0x26, 0x04, 0x0A, 0x06, 0x27, 0x04, 0x0A, 0x05, 0x28, 0x04, 0x0A, 0x05, 0x28, 0x04, 0x0B,
+	0x06, 0x26, 0x04, 0x0C, 0x06, 0x25, 0x04, 0x0D, 0x06, 0x0B, 0x1D, 0x0E, 0x06, 0x09, 0x1E, 0x0F,
+	0x06, 0x07, 0x1F, 0x10, 0x06, 0x06, 0x1F, 0x11, 0x06, 0x05, 0x05, 0x2C, 0x06, 0x04, 0x04, 0x2F,
+	0x05, 0x03, 0x04, 0x30, 0x05, 0x02, 0x04, 0x31, 0x05, 0x01, 0x04, 0x32, 0x09, 0x33, 0x08, 0x34,
+	0x07, 0x36, 0x05, 0x37, 0x04, 0x38, 0x03, 0xFF, 0xF9, 0xFF, 0xF1, 0x0B, 0x2E, 0x0F, 0x2C, 0x0F,
+	0x2C, 0x0F, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04,
+	0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04,
+	0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04,
+	0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04,
+	0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04,
+	0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x22, 0x0E,
+	0x07, 0x0E, 0x17, 0x0F, 0x07, 0x0F, 0x16, 0x0F, 0x07, 0x0F, 0x17, 0x0D, 0x09, 0x0D, 0x19, 0x04,
+	0x19, 0x04, 0x1B, 0x04, 0x17, 0x04, 0x1C, 0x05, 0x15, 0x05, 0x1D, 0x05, 0x13, 0x05, 0x1F, 0x05,
+	0x11, 0x05, 0x21, 0x05, 0x0F, 0x05, 0x23, 0x05, 0x0D, 0x05, 0x25, 0x05, 0x0B, 0x05, 0x27, 0x05,
+	0x09, 0x05, 0x29, 0x05, 0x07, 0x05, 0x2A, 0x06, 0x05, 0x06, 0x2B, 0x06, 0x03, 0x06, 0x2D, 0x06,
+	0x01, 0x06, 0x2F, 0x0B, 0x31, 0x09, 0x33, 0x07, 0x35, 0x05, 0x37, 0x03, 0x92, 0xFF, 0xF6, 0x01,
+	0x38, 0x05, 0x35, 0x07, 0x34, 0x07, 0x33, 0x09, 0x31, 0x05, 0x01, 0x05, 0x2F, 0x05, 0x03, 0x05,
+	0x2D, 0x05, 0x05, 0x05, 0x2B, 0x05, 0x07, 0x05, 0x29, 0x05, 0x09, 0x05, 0x28, 0x04, 0x0B, 0x04,
+	0x27, 0x04, 0x0D, 0x04, 0x25, 0x05, 0x0D, 0x05, 0x23, 0x05, 0x0F, 0x05, 0x21, 0x05, 0x11, 0x05,
+	0x1F, 0x05, 0x13, 0x05, 0x1D, 0x05, 0x15, 0x05, 0x1B, 0x05, 0x17, 0x05, 0x19, 0x0C, 0x0B, 0x0C,
+	0x17, 0x0E, 0x09, 0x0E, 0x16, 0x0F, 0x07, 0x0F, 0x16, 0x0F, 0x07, 0x0F, 0x17, 0x0E, 0x07, 0x0E,
+	0x22, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04,
+	0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04,
+	0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04,
+	0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04,
+	0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04,
+	0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x0F, 0x2C, 0x0F,
+	0x2C, 0x0F, 0x2E, 0x0B, 0x53, 0xFF, 0xE5, 0x05, 0x34, 0x09, 0x31, 0x0C, 0x2F, 0x04, 0x02, 0x07,
+	0x2E, 0x04, 0x03, 0x08, 0x2C, 0x04, 0x05, 0x08, 0x2A, 0x04, 0x07, 0x08, 0x28, 0x04, 0x09, 0x08,
+	0x26, 0x04, 0x0B, 0x08, 0x24, 0x04, 0x0D, 0x07, 0x23, 0x04, 0x0F, 0x07, 0x21, 0x04, 0x10, 0x08,
+	0x1F, 0x04, 0x12, 0x08, 0x1D, 0x04, 0x14, 0x07, 0x1C, 0x04, 0x16, 0x07, 0x1A, 0x04, 0x17, 0x08,
+	0x18, 0x04, 0x19, 0x08, 0x16, 0x04, 0x1B, 0x08, 0x14, 0x04, 0x1D, 0x08, 0x12, 0x04, 0x1F, 0x07,
+	0x11, 0x04, 0x21, 0x07, 0x0F, 0x04, 0x22, 0x06, 0x0F, 0x04, 0x24, 0x05, 0x0E, 0x04, 0x25, 0x04,
+	0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x22, 0x06, 0x0F, 0x04, 0x21, 0x07,
+	0x0F, 0x04, 0x1F, 0x08, 0x10, 0x04, 0x1D, 0x08, 0x12, 0x04, 0x1C, 0x07, 0x14, 0x04, 0x1A, 0x07,
+	0x16, 0x04, 0x18, 0x08, 0x17, 0x04, 0x16, 0x08, 0x19, 0x04, 0x14, 0x08, 0x1B, 0x04, 0x13, 0x07,
+	0x1D, 0x04, 0x10, 0x09, 0x1E, 0x04, 0x0F, 0x08, 0x20, 0x04, 0x0D, 0x08, 0x22, 0x04, 0x0B, 0x08,
+	0x24, 0x04, 0x0A, 0x07, 0x26, 0x04, 0x08, 0x07, 0x28, 0x04, 0x06, 0x08, 0x29, 0x04, 0x04, 0x08,
+	0x2B, 0x04, 0x02, 0x08, 0x2D, 0x0C, 0x30, 0x0A, 0x32, 0x07, 0xDA, 0xFF, 0xFF, 0x1F, 0x0C, 0x0F,
+	0x0C, 0x13, 0x0E, 0x0D, 0x0E, 0x11, 0x10, 0x0B, 0x10, 0x10, 0x10, 0x0B, 0x10, 0x0F, 0x04, 0x09,
+	0x05, 0x09, 0x05, 0x09, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A,
+	0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x0A, 0x04, 0x0E, 0x05, 0x08,
+	0x04, 0x0B, 0x04, 0x08, 0x05, 0x0F, 0x10, 0x0B, 0x10, 0x11, 0x0E, 0x0D, 0x0E, 0x13, 0x0C, 0x0F,
+	0x0C, 0x16, 0x08, 0x13, 0x08, 0xBD, 0xFF, 0xFF, 0x30, 0x05, 0x35, 0x07, 0x33, 0x09, 0x31, 0x0B,
+	0x2F, 0x05, 0x03, 0x05, 0x2E, 0x05, 0x03, 0x05, 0x2D, 0x05, 0x05, 0x05, 0x2B, 0x05, 0x07, 0x05,
+	0x29, 0x05, 0x09, 0x05, 0x27, 0x05, 0x0B, 0x05, 0x26, 0x04, 0x0D, 0x04, 0x25, 0x04, 0x0F, 0x04,
+	0x23, 0x05, 0x0F, 0x05, 0x21, 0x05, 0x11, 0x05, 0x1F, 0x05, 0x13, 0x05, 0x1D, 0x05, 0x15, 0x05,
+	0x1B, 0x06, 0x15, 0x06, 0x1A, 0x05, 0x17, 0x05, 0x19, 0x05, 0x19, 0x05, 0x17, 0x05, 0x1B, 0x05,
+	0x15, 0x05, 0x1D, 0x05, 0x13, 0x05, 0x1F, 0x05, 0x12, 0x04, 0x21, 0x04, 0x11, 0x04, 0x23, 0x04,
+	0x10, 0x04, 0x23, 0x04, 0x10, 0x2B, 0x10, 0x2B, 0x11, 0x29, 0x12, 0x29, 0xFF, 0x3C, 0x25, 0x15,
+	0x27, 0x12, 0x2B, 0x10, 0x2B, 0x0F, 0x05, 0x23, 0x05, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25,
+	0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x05, 0x23, 0x05, 0x0F, 0x2B, 0x11, 0x29, 0x13, 0x27, 0x16,
+	0x23, 0xBD, 0xFF, 0xFF, 0x93, 0x02, 0x16, 0x02, 0x1F, 0x06, 0x12, 0x05, 0x1D, 0x08, 0x10, 0x07,
+	0x1C, 0x09, 0x0E, 0x0A, 0x1A, 0x04, 0x01, 0x06, 0x0C, 0x04, 0x01, 0x06, 0x19, 0x04, 0x02, 0x06,
+	0x0B, 0x04, 0x03, 0x05, 0x18, 0x04, 0x03, 0x06, 0x0A, 0x04, 0x04, 0x06, 0x16, 0x04, 0x05, 0x06,
+	0x08, 0x04, 0x05, 0x06, 0x15, 0x04, 0x05, 0x06, 0x08, 0x04, 0x06, 0x06, 0x14, 0x04, 0x07, 0x06,
+	0x06, 0x04, 0x07, 0x06, 0x13, 0x04, 0x08, 0x06, 0x05, 0x04, 0x08, 0x06, 0x12, 0x04, 0x09, 0x06,
+	0x04, 0x04, 0x09, 0x06, 0x11, 0x04, 0x0A, 0x06, 0x03, 0x04, 0x0B, 0x05, 0x10, 0x04, 0x0C, 0x05,
+	0x02, 0x04, 0x0C, 0x06, 0x0E, 0x04, 0x0D, 0x0A, 0x0D, 0x06, 0x0D, 0x04, 0x0E, 0x09, 0x0E, 0x06,
+	0x0C, 0x04, 0x0F, 0x08, 0x10, 0x05, 0x0B, 0x04, 0x10, 0x07, 0x11, 0x06, 0x09, 0x04, 0x11, 0x06,
+	0x12, 0x06, 0x08, 0x04, 0x12, 0x05, 0x13, 0x05, 0x08, 0x04, 0x13, 0x04, 0x14, 0x04, 0x08, 0x04,
+	0x13, 0x04, 0x14, 0x04, 0x08, 0x04, 0x13, 0x04, 0x14, 0x04, 0x08, 0x04, 0x12, 0x05, 0x12, 0x06,
+	0x08, 0x04, 0x11, 0x06, 0x11, 0x06, 0x09, 0x04, 0x10, 0x07, 0x10, 0x06, 0x0A, 0x04, 0x0E, 0x09,
+	0x0F, 0x05, 0x0C, 0x04, 0x0D, 0x0A, 0x0D, 0x06, 0x0D, 0x04, 0x0C, 0x05, 0x02, 0x04, 0x0C, 0x06,
+	0x0E, 0x04, 0x0B, 0x06, 0x02, 0x04, 0x0B, 0x06, 0x0F, 0x04, 0x09, 0x06, 0x04, 0x04, 0x0A, 0x06,
+	0x10, 0x04, 0x08, 0x07, 0x04, 0x04, 0x09, 0x06, 0x11, 0x04, 0x07, 0x06, 0x06, 0x04, 0x08, 0x06,
+	0x12, 0x04, 0x06, 0x06, 0x07, 0x04, 0x07, 0x05, 0x14, 0x04, 0x05, 0x06, 0x08, 0x04, 0x05, 0x06,
+	0x15, 0x04, 0x04, 0x05, 0x0A, 0x04, 0x04, 0x06, 0x16, 0x04, 0x03, 0x05, 0x0B, 0x04, 0x03, 0x05,
+	0x18, 0x04, 0x01, 0x06, 0x0C, 0x04, 0x01, 0x06, 0x19, 0x0A, 0x0D, 0x0A, 0x1A, 0x09, 0x0F, 0x08,
+	0x1C, 0x06, 0x11, 0x07, 0x1F, 0x03, 0x14, 0x03, 0xFF, 0x7C, 0xFF, 0xFF, 0xA4, 0x02, 0x16, 0x02,
+	0x20, 0x05, 0x12, 0x06, 0x1D, 0x07, 0x10, 0x08, 0x1A, 0x0A, 0x0E, 0x09, 0x19, 0x06, 0x01, 0x04,
+	0x0C, 0x06, 0x01, 0x04, 0x18, 0x05, 0x03, 0x04, 0x0B, 0x06, 0x02, 0x04, 0x16, 0x06, 0x04, 0x04,
+	0x0A, 0x06, 0x03, 0x04, 0x15, 0x06, 0x05, 0x04, 0x08, 0x06, 0x05, 0x04, 0x14, 0x06, 0x06, 0x04,
+	0x08, 0x06, 0x05, 0x04, 0x13, 0x06, 0x07, 0x04, 0x06, 0x06, 0x07, 0x04, 0x12, 0x06, 0x08, 0x04,
+	0x05, 0x06, 0x08, 0x04, 0x11, 0x06, 0x09, 0x04, 0x04, 0x06, 0x09, 0x04, 0x10, 0x05, 0x0B, 0x04,
+	0x03, 0x06, 0x0A, 0x04, 0x0E, 0x06, 0x0C, 0x04, 0x02, 0x05, 0x0C, 0x04, 0x0D, 0x06, 0x0D, 0x0A,
+	0x0D, 0x04, 0x0C, 0x06, 0x0E, 0x09, 0x0E, 0x04, 0x0B, 0x05, 0x10, 0x08, 0x0F, 0x04, 0x09, 0x06,
+	0x11, 0x07, 0x10, 0x04, 0x08, 0x06, 0x12, 0x06, 0x11, 0x04, 0x08, 0x05, 0x13, 0x05, 0x12, 0x04,
+	0x08, 0x04, 0x14, 0x04, 0x13, 0x04, 0x08, 0x04, 0x14, 0x04, 0x13, 0x04, 0x08, 0x04, 0x14, 0x04,
+	0x13, 0x04, 0x08, 0x06, 0x12, 0x05, 0x12, 0x04, 0x09, 0x06, 0x11, 0x06, 0x11, 0x04, 0x0A, 0x06,
+	0x10, 0x08, 0x0F, 0x04, 0x0C, 0x06, 0x0E, 0x09, 0x0E, 0x04, 0x0D, 0x06, 0x0D, 0x0A, 0x0D, 0x04,
+	0x0E, 0x06, 0x0C, 0x04, 0x02, 0x05, 0x0C, 0x04, 0x0F, 0x06, 0x0B, 0x04, 0x02, 0x06, 0x0B, 0x04,
+	0x10, 0x06, 0x0A, 0x04, 0x04, 0x06, 0x09, 0x04, 0x11, 0x06, 0x09, 0x04, 0x05, 0x06, 0x08, 0x04,
+	0x13, 0x05, 0x08, 0x04, 0x06, 0x06, 0x07, 0x04, 0x14, 0x06, 0x06, 0x04, 0x07, 0x06, 0x06, 0x04,
+	0x15, 0x06, 0x05, 0x04, 0x08, 0x06, 0x05, 0x04, 0x16, 0x06, 0x04, 0x04, 0x0A, 0x05, 0x04, 0x04,
+	0x18, 0x05, 0x03, 0x04, 0x0B, 0x06, 0x02, 0x04, 0x19, 0x06, 0x01, 0x04, 0x0C, 0x06, 0x01, 0x04,
+	0x1A, 0x0A, 0x0D, 0x0A, 0x1B, 0x08, 0x0F, 0x09, 0x1C, 0x07, 0x11, 0x06, 0x1F, 0x03, 0x14, 0x03,
+	0xFF, 0x6B, 0xFF, 0xFF, 0x5A, 0x03, 0x1D, 0x07, 0x13, 0x06, 0x1A, 0x09, 0x11, 0x09, 0x17, 0x0B,
+	0x0F, 0x0B, 0x15, 0x0D, 0x0E, 0x04, 0x02, 0x07, 0x13, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x03, 0x08,
+	0x11, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x07, 0x10, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x07, 0x07,
+	0x0E, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x08, 0x07, 0x0D, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x0A, 0x07,
+	0x0B, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x0C, 0x07, 0x09, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x0D, 0x07,
+	0x08, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x0F, 0x07, 0x06, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x11, 0x06,
+	0x05, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x12, 0x07, 0x03, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x13, 0x08,
+	0x01, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x15, 0x0B, 0x05, 0x04, 0x0E, 0x04, 0x17, 0x09, 0x05, 0x04,
+	0x0E, 0x04, 0x19, 0x07, 0x05, 0x04, 0x0E, 0x04, 0x1A, 0x06, 0x05, 0x04, 0x0E, 0x04, 0x1C, 0x04,
+	0x05, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x05, 0x04, 0x0E, 0x04,
+	0x1C, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x1B, 0x05, 0x05, 0x04, 0x0E, 0x04, 0x19, 0x07, 0x05, 0x04,
+	0x0E, 0x04, 0x17, 0x09, 0x05, 0x04, 0x0E, 0x04, 0x16, 0x0A, 0x05, 0x04, 0x0E, 0x04, 0x14, 0x07,
+	0x01, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x13, 0x07, 0x02, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x11, 0x07,
+	0x04, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x0F, 0x08, 0x05, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x0E, 0x07,
+	0x07, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x0C, 0x07, 0x09, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x0B, 0x07,
+	0x0A, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x09, 0x07, 0x0C, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x07, 0x07,
+	0x0E, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x08, 0x0F, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x04, 0x07,
+	0x11, 0x04, 0x05, 0x04, 0x0E, 0x04, 0x03, 0x06, 0x13, 0x04, 0x05, 0x04, 0x0E, 0x0C, 0x14, 0x0D,
+	0x0F, 0x09, 0x17, 0x0C, 0x0F, 0x08, 0x18, 0x0B, 0x11, 0x05, 0x1B, 0x09, 0xFF, 0x31, 0xFF, 0xFF,
+	0x5A, 0x07, 0x1D, 0x03, 0x13, 0x09, 0x1A, 0x06, 0x11, 0x0B, 0x17, 0x09, 0x0F, 0x0D, 0x15, 0x0B,
+	0x0E, 0x04, 0x05, 0x04, 0x13, 0x07, 0x02, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x11, 0x08, 0x03, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x10, 0x07, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x0E, 0x07, 0x07, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x0D, 0x07, 0x08, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x0B, 0x07, 0x0A, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x09, 0x08, 0x0B, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x08, 0x07, 0x0D, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x06, 0x07, 0x0F, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x05, 0x06, 0x11, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x03, 0x07, 0x12, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x01, 0x08, 0x13, 0x04,
+	0x0E, 0x04, 0x05, 0x0B, 0x15, 0x04, 0x0E, 0x04, 0x05, 0x09, 0x17, 0x04, 0x0E, 0x04, 0x05, 0x08,
+	0x18, 0x04, 0x0E, 0x04, 0x05, 0x06, 0x1A, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x1C, 0x04, 0x0E, 0x04,
+	0x05, 0x04, 0x1C, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x1C, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x1C, 0x04,
+	0x0E, 0x04, 0x05, 0x05, 0x1B, 0x04, 0x0E, 0x04, 0x05, 0x07, 0x19, 0x04, 0x0E, 0x04, 0x05, 0x09,
+	0x17, 0x04, 0x0E, 0x04, 0x05, 0x0A, 0x16, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x01, 0x07, 0x14, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x03, 0x06, 0x13, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x04, 0x07, 0x11, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x05, 0x08, 0x0F, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x07, 0x07, 0x0E, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x09, 0x07, 0x0C, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x0B, 0x07, 0x0A, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x0C, 0x07, 0x09, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x0E, 0x07, 0x07, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x0F, 0x08, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x04, 0x11, 0x07, 0x04, 0x04,
+	0x0E, 0x04, 0x05, 0x04, 0x13, 0x07, 0x02, 0x04, 0x0E, 0x0D, 0x14, 0x0C, 0x0E, 0x0C, 0x17, 0x09,
+	0x10, 0x0B, 0x18, 0x08, 0x11, 0x09, 0x1B, 0x05, 0xFF, 0x31, 0xFF, 0xBB, 0x01, 0x39, 0x03, 0x38,
+	0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x30, 0x02, 0x06, 0x03, 0x05, 0x03, 0x26,
+	0x05, 0x05, 0x03, 0x05, 0x05, 0x23, 0x06, 0x05, 0x03, 0x05, 0x06, 0x20, 0x08, 0x05, 0x03, 0x05,
+	0x08, 0x1D, 0x07, 0x07, 0x03, 0x07, 0x07, 0x1B, 0x06, 0x09, 0x03, 0x09, 0x06, 0x19, 0x06, 0x0A,
+	0x03, 0x0A, 0x06, 0x18, 0x05, 0x0B, 0x03, 0x0B, 0x05, 0x17, 0x05, 0x0C, 0x03, 0x0C, 0x05, 0x16,
+	0x04, 0x0D, 0x03, 0x0D, 0x04, 0x15, 0x04, 0x0E, 0x03, 0x0E, 0x04, 0x13, 0x04, 0x0F, 0x03, 0x0F,
+	0x04, 0x12, 0x04, 0x0F, 0x03, 0x0F, 0x04, 0x12, 0x04, 0x0F, 0x03, 0x0F, 0x04, 0x11, 0x04, 0x10,
+	0x03, 0x10, 0x04, 0x10, 0x04, 0x10, 0x03, 0x10, 0x04, 0x10, 0x04, 0x10, 0x03, 0x10, 0x04, 0x0F,
+	0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E,
+	0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0F, 0x03, 0x25, 0x03, 0x10,
+	0x04, 0x23, 0x04, 0x10, 0x04, 0x23, 0x04, 0x11, 0x04, 0x21, 0x04, 0x12, 0x04, 0x21, 0x04, 0x12,
+	0x04, 0x21, 0x04, 0x13, 0x04, 0x1F, 0x04, 0x14, 0x05, 0x1D, 0x05, 0x15, 0x05, 0x1B, 0x05, 0x16,
+	0x05, 0x1B, 0x05, 0x17, 0x06, 0x17, 0x06, 0x19, 0x06, 0x15, 0x06, 0x1B, 0x06, 0x13, 0x06, 0x1D,
+	0x07, 0x0F, 0x07, 0x1F, 0x0A, 0x07, 0x0A, 0x22, 0x17, 0x26, 0x13, 0x2A, 0x0F, 0x32, 0x03, 0x92,
+	0xFF, 0xB6, 0x0B, 0x2F, 0x0D, 0x2E, 0x0D, 0x2E, 0x0D, 0x2D, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07,
+	0x04, 0x2C, 0x04, 0x07, 0x04, 0x22, 0x02, 0x07, 0x05, 0x07, 0x04, 0x21, 0x05, 0x04, 0x05, 0x09,
+	0x04, 0x05, 0x05, 0x15, 0x0E, 0x0A, 0x0F, 0x13, 0x0F, 0x0B, 0x0F, 0x12, 0x0E, 0x0D, 0x0E, 0x11,
+	0x05, 0x04, 0x03, 0x12, 0x05, 0x03, 0x05, 0x10, 0x04, 0x23, 0x04, 0x0F, 0x04, 0x25, 0x04, 0x0E,
+	0x04, 0x0F, 0x07, 0x0F, 0x04, 0x0D, 0x05, 0x0D, 0x0B, 0x0D, 0x04, 0x0D, 0x04, 0x0D, 0x0D, 0x0D,
+	0x04, 0x0C, 0x06, 0x0A, 0x06, 0x03, 0x06, 0x0B, 0x05, 0x0D, 0x06, 0x08, 0x05, 0x07, 0x05, 0x08,
+	0x07, 0x0F, 0x05, 0x07, 0x04, 0x09, 0x04, 0x08, 0x05, 0x12, 0x04, 0x06, 0x04, 0x0B, 0x04, 0x06,
+	0x05, 0x13, 0x05, 0x05, 0x04, 0x0B, 0x04, 0x05, 0x05, 0x15, 0x04, 0x05, 0x03, 0x0D, 0x03, 0x05,
+	0x04, 0x16, 0x04, 0x05, 0x03, 0x0D, 0x03, 0x05, 0x04, 0x16, 0x04, 0x05, 0x03, 0x0D, 0x03, 0x05,
+	0x04, 0x15, 0x05, 0x05, 0x04, 0x0B, 0x04, 0x05, 0x05, 0x13, 0x05, 0x06, 0x04, 0x0B, 0x04, 0x06,
+	0x04, 0x12, 0x05, 0x08, 0x04, 0x09, 0x04, 0x07, 0x05, 0x0F, 0x07, 0x08, 0x05, 0x07, 0x05, 0x08,
+	0x06, 0x0D, 0x05, 0x0B, 0x06, 0x03, 0x06, 0x0A, 0x06, 0x0C, 0x04, 0x0D, 0x0D, 0x0D, 0x04, 0x0D,
+	0x04, 0x0D, 0x0B, 0x0D, 0x05, 0x0D, 0x04, 0x0F, 0x07, 0x0F, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0F,
+	0x04, 0x23, 0x04, 0x10, 0x05, 0x03, 0x05, 0x12, 0x03, 0x04, 0x05, 0x11, 0x0E, 0x0D, 0x0E, 0x12,
+	0x0F, 0x0B, 0x0F, 0x13, 0x0F, 0x09, 0x0F, 0x15, 0x05, 0x05, 0x04, 0x09, 0x05, 0x04, 0x05, 0x21,
+	0x04, 0x07, 0x05, 0x07, 0x02, 0x22, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x04, 0x07,
+	0x04, 0x2D, 0x0D, 0x2E, 0x0D, 0x2E, 0x0D, 0x30, 0x09, 0xCA, 0xFF, 0xF4, 0x05, 0x32, 0x0D, 0x2C,
+	0x11, 0x28, 0x14, 0x26, 0x08, 0x07, 0x07, 0x24, 0x06, 0x0D, 0x05, 0x23, 0x05, 0x0F, 0x03, 0x23,
+	0x05, 0x35, 0x05, 0x36, 0x04, 0x37, 0x04, 0x17, 0x03, 0x1C, 0x04, 0x17, 0x05, 0x1B, 0x04, 0x16,
+	0x07, 0x1A, 0x03, 0x16, 0x09, 0x19, 0x03, 0x15, 0x0B, 0x17, 0x04, 0x14, 0x0D, 0x16, 0x04, 0x13,
+	0x0F, 0x15, 0x04, 0x12, 0x06, 0x01, 0x04, 0x01, 0x05, 0x14, 0x04, 0x11, 0x05, 0x03, 0x04, 0x01,
+	0x06, 0x13, 0x04, 0x11, 0x05, 0x03, 0x04, 0x02, 0x05, 0x13, 0x04, 0x12, 0x02, 0x05, 0x04, 0x03,
+	0x03, 0x14, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19,
+	0x04, 0x1A, 0x04, 0x19, 0x04, 0x14, 0x03, 0x03, 0x04, 0x05, 0x02, 0x12, 0x04, 0x13, 0x05, 0x02,
+	0x04, 0x03, 0x05, 0x11, 0x04, 0x13, 0x06, 0x01, 0x04, 0x03, 0x05, 0x11, 0x04, 0x14, 0x0A, 0x01,
+	0x06, 0x12, 0x04, 0x15, 0x0F, 0x13, 0x04, 0x16, 0x0D, 0x14, 0x04, 0x17, 0x0B, 0x15, 0x03, 0x19,
+	0x09, 0x16, 0x03, 0x1A, 0x07, 0x16, 0x04, 0x1B, 0x05, 0x17, 0x04, 0x1C, 0x03, 0x17, 0x04, 0x37,
+	0x04, 0x36, 0x04, 0x36, 0x05, 0x23, 0x03, 0x0F, 0x05, 0x23, 0x05, 0x0D, 0x06, 0x24, 0x07, 0x07,
+	0x08, 0x26, 0x14, 0x28, 0x11, 0x2C, 0x0D, 0x32, 0x05, 0xFF, 0x08, 0xFF, 0xFF, 0x32, 0x01, 0x39,
+	0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38,
+	0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38,
+	0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x31, 0x03, 0x04,
+	0x03, 0x04, 0x03, 0x2A, 0x04, 0x03, 0x03, 0x03, 0x04, 0x2A, 0x05, 0x02, 0x03, 0x02, 0x05, 0x2B,
+	0x05, 0x01, 0x03, 0x01, 0x05, 0x2D, 0x0D, 0x2F, 0x0B, 0x31, 0x09, 0x21, 0x02, 0x10, 0x07, 0x10,
+	0x02, 0x0F, 0x04, 0x10, 0x05, 0x10, 0x04, 0x0E, 0x04, 0x11, 0x03, 0x11, 0x04, 0x0E, 0x04, 0x12,
+	0x01, 0x12, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E,
+	0x04, 0x25, 0x04, 0x0F, 0x04, 0x23, 0x04, 0x10, 0x05, 0x21, 0x05, 0x10, 0x2B, 0x11, 0x29, 0x13,
+	0x27, 0x17, 0x21, 0xFF, 0x35, 0xFF, 0xFF, 0x22, 0x1B, 0x1D, 0x1F, 0x1B, 0x21, 0x19, 0x23, 0x18,
+	0x05, 0x03, 0x04, 0x10, 0x08, 0x17, 0x04, 0x04, 0x04, 0x10, 0x09, 0x15, 0x04, 0x05, 0x04, 0x10,
+	0x03, 0x02, 0x05, 0x14, 0x04, 0x05, 0x04, 0x10, 0x03, 0x03, 0x05, 0x13, 0x04, 0x05, 0x04, 0x10,
+	0x03, 0x04, 0x05, 0x12, 0x04, 0x05, 0x04, 0x10, 0x03, 0x05, 0x06, 0x10, 0x04, 0x05, 0x04, 0x10,
+	0x03, 0x06, 0x06, 0x0F, 0x04, 0x05, 0x04, 0x0F, 0x04, 0x07, 0x06, 0x0E, 0x04, 0x05, 0x17, 0x09,
+	0x04, 0x0E, 0x04, 0x06, 0x15, 0x0A, 0x04, 0x0E, 0x04, 0x07, 0x13, 0x0B, 0x04, 0x0E, 0x04, 0x25,
+	0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25,
+	0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x05,
+	0x1B, 0x05, 0x04, 0x0E, 0x04, 0x04, 0x1D, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x1D, 0x04, 0x04, 0x0E,
+	0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E,
+	0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E,
+	0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E,
+	0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E,
+	0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E,
+	0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0E,
+	0x04, 0x04, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0F, 0x04, 0x03, 0x04, 0x15, 0x04, 0x03, 0x04, 0x10,
+	0x05, 0x01, 0x05, 0x15, 0x05, 0x01, 0x05, 0x10, 0x2B, 0x11, 0x29, 0x13, 0x27, 0x17, 0x21, 0xFF,
+	0x35, 0xFF, 0xFC, 0x05, 0x32, 0x0D, 0x2D, 0x0F, 0x2A, 0x11, 0x29, 0x07, 0x05, 0x05, 0x29, 0x06,
+	0x06, 0x05, 0x2A, 0x04, 0x07, 0x05, 0x2A, 0x04, 0x07, 0x05, 0x2A, 0x05, 0x06, 0x05, 0x09, 0x02,
+	0x20, 0x04, 0x06, 0x05, 0x09, 0x04, 0x1F, 0x04, 0x05, 0x05, 0x09, 0x05, 0x1E, 0x04, 0x06, 0x04,
+	0x09, 0x06, 0x1E, 0x04, 0x05, 0x04, 0x09, 0x07, 0x1E, 0x04, 0x05, 0x04, 0x08, 0x09, 0x1D, 0x04,
+	0x05, 0x04, 0x07, 0x05, 0x01, 0x04, 0x1D, 0x04, 0x05, 0x04, 0x06, 0x05, 0x02, 0x04, 0x1D, 0x04,
+	0x05, 0x04, 0x05, 0x05, 0x03, 0x04, 0x1D, 0x04, 0x06, 0x0C, 0x04, 0x04, 0x1D, 0x04, 0x06, 0x0B,
+	0x04, 0x04, 0x1E, 0x04, 0x07, 0x08, 0x06, 0x04, 0x1D, 0x05, 0x09, 0x05, 0x07, 0x04, 0x1C, 0x05,
+	0x15, 0x05, 0x1B, 0x05, 0x16, 0x04, 0x1B, 0x05, 0x16, 0x04, 0x1B, 0x05, 0x15, 0x05, 0x1B, 0x05,
+	0x14, 0x07, 0x1A, 0x05, 0x0B, 0x10, 0x1A, 0x05, 0x0B, 0x0F, 0x1B, 0x05, 0x0B, 0x0F, 0x1A, 0x06,
+	0x0B, 0x0D, 0x1D, 0x05, 0x0B, 0x05, 0x24, 0x06, 0x0B, 0x05, 0x25, 0x05, 0x0B, 0x05, 0x24, 0x06,
+	0x0B, 0x05, 0x25, 0x05, 0x0B, 0x05, 0x25, 0x05, 0x0B, 0x05, 0x26, 0x04, 0x0B, 0x05, 0x26, 0x04,
+	0x0B, 0x05, 0x27, 0x04, 0x0A, 0x05, 0x28, 0x04, 0x09, 0x05, 0x29, 0x04, 0x08, 0x05, 0x2B, 0x04,
+	0x06, 0x05, 0x2C, 0x05, 0x04, 0x05, 0x2D, 0x0D, 0x2F, 0x0C, 0x30, 0x09, 0x35, 0x04, 0xFF, 0x18,
+	0xFF, 0xAB, 0x14, 0x26, 0x16, 0x24, 0x18, 0x22, 0x1A, 0x21, 0x04, 0x0F, 0x08, 0x20, 0x03, 0x10,
+	0x09, 0x1F, 0x03, 0x10, 0x0A, 0x1E, 0x03, 0x10, 0x04, 0x02, 0x05, 0x1D, 0x03, 0x10, 0x04, 0x03,
+	0x05, 0x1C, 0x03, 0x10, 0x04, 0x04, 0x05, 0x1B, 0x03, 0x10, 0x04, 0x05, 0x05, 0x1A, 0x03, 0x10,
+	0x04, 0x06, 0x05, 0x19, 0x03, 0x10, 0x04, 0x07, 0x05, 0x18, 0x03, 0x10, 0x04, 0x08, 0x05, 0x17,
+	0x03, 0x11, 0x03, 0x09, 0x05, 0x16, 0x03, 0x11, 0x04, 0x08, 0x06, 0x15, 0x03, 0x11, 0x12, 0x15,
+	0x03, 0x12, 0x12, 0x14, 0x03, 0x13, 0x11, 0x14, 0x03, 0x15, 0x0F, 0x14, 0x03, 0x21, 0x03, 0x14,
+	0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14,
+	0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14,
+	0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14,
+	0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14,
+	0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14,
+	0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x04, 0x1F, 0x04, 0x14,
+	0x27, 0x15, 0x25, 0x17, 0x23, 0x19, 0x21, 0xBE, 0xFF, 0xFF, 0xCE, 0x0E, 0x2C, 0x11, 0x29, 0x13,
+	0x27, 0x05, 0x0A, 0x06, 0x26, 0x04, 0x0D, 0x06, 0x24, 0x04, 0x0E, 0x06, 0x23, 0x04, 0x0F, 0x1B,
+	0x0D, 0x04, 0x11, 0x1A, 0x0C, 0x04, 0x10, 0x1C, 0x0B, 0x04, 0x0F, 0x1E, 0x0A, 0x04, 0x0E, 0x06,
+	0x15, 0x04, 0x0A, 0x04, 0x0C, 0x06, 0x17, 0x04, 0x0A, 0x15, 0x18, 0x04, 0x0A, 0x14, 0x19, 0x04,
+	0x0A, 0x13, 0x1A, 0x04, 0x0A, 0x11, 0x1C, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04,
+	0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04,
+	0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04,
+	0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04,
+	0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04,
+	0x0A, 0x04, 0x29, 0x04, 0x0A, 0x05, 0x27, 0x05, 0x0B, 0x2F, 0x0D, 0x2D, 0x0F, 0x2B, 0xFF, 0xE1,
+	0xFF, 0xBA, 0x03, 0x37, 0x05, 0x34, 0x09, 0x31, 0x0B, 0x2F, 0x06, 0x01, 0x06, 0x2D, 0x06, 0x03,
+	0x06, 0x2B, 0x06, 0x05, 0x06, 0x28, 0x07, 0x08, 0x06, 0x25, 0x06, 0x0B, 0x06, 0x23, 0x06, 0x0D,
+	0x06, 0x20, 0x06, 0x11, 0x06, 0x1D, 0x06, 0x13, 0x06, 0x1B, 0x06, 0x15, 0x06, 0x19, 0x06, 0x17,
+	0x06, 0x17, 0x06, 0x19, 0x06, 0x15, 0x05, 0x1D, 0x05, 0x13, 0x05, 0x1F, 0x05, 0x11, 0x05, 0x21,
+	0x05, 0x10, 0x04, 0x23, 0x04, 0x0F, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25,
+	0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25,
+	0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x0E, 0x09, 0x0E, 0x04, 0x0E,
+	0x04, 0x0C, 0x0D, 0x0C, 0x04, 0x0E, 0x04, 0x0C, 0x0D, 0x0C, 0x04, 0x0E, 0x04, 0x0B, 0x0F, 0x0B,
+	0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B, 0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B,
+	0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B, 0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B,
+	0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B, 0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B,
+	0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B, 0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B,
+	0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B, 0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B,
+	0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B, 0x04, 0x0E, 0x04, 0x0B, 0x04, 0x07, 0x04, 0x0B,
+	0x04, 0x0E, 0x13, 0x07, 0x13, 0x0E, 0x13, 0x07, 0x13, 0x0F, 0x11, 0x09, 0x11, 0x11, 0x0F, 0x0B,
+	0x0F, 0xF5, 0xFF, 0x7F, 0x03, 0x34, 0x0B, 0x2E, 0x0F, 0x2B, 0x11, 0x29, 0x07, 0x05, 0x07, 0x27,
+	0x06, 0x09, 0x06, 0x26, 0x05, 0x0B, 0x05, 0x25, 0x05, 0x0D, 0x05, 0x24, 0x04, 0x0F, 0x04, 0x23,
+	0x04, 0x11, 0x03, 0x23, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22,
+	0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x23, 0x03, 0x11, 0x03, 0x24, 0x04, 0x0F, 0x04, 0x24,
+	0x05, 0x0D, 0x05, 0x25, 0x05, 0x0B, 0x05, 0x26, 0x06, 0x09, 0x06, 0x27, 0x07, 0x05, 0x07, 0x29,
+	0x11, 0x2B, 0x0F, 0x2E, 0x0B, 0x32, 0x07, 0xFF, 0x4E, 0x23, 0x17, 0x25, 0x15, 0x27, 0x14, 0x05,
+	0x1D, 0x05, 0x14, 0x04, 0x1F, 0x04, 0x14, 0x03, 0x21, 0x03, 0x14, 0x03, 0x21, 0x03, 0x14, 0x04,
+	0x1F, 0x04, 0x14, 0x04, 0x1F, 0x04, 0x14, 0x04, 0x1F, 0x03, 0x16, 0x04, 0x1D, 0x04, 0x16, 0x05,
+	0x1B, 0x05, 0x17, 0x05, 0x19, 0x05, 0x19, 0x06, 0x15, 0x06, 0x1B, 0x08, 0x0F, 0x08, 0x1D, 0x0A,
+	0x09, 0x0A, 0x20, 0x19, 0x24, 0x15, 0x29, 0x0F, 0x33, 0x01, 0xCE, 0xFF, 0xFF, 0xFF, 0x36, 0x03,
+	0x37, 0x04, 0x36, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05,
+	0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05,
+	0x35, 0x05, 0x17, 0x03, 0x1B, 0x05, 0x18, 0x04, 0x19, 0x05, 0x19, 0x05, 0x17, 0x05, 0x1B, 0x05,
+	0x15, 0x05, 0x1D, 0x05, 0x13, 0x05, 0x1F, 0x05, 0x11, 0x05, 0x21, 0x05, 0x0F, 0x05, 0x23, 0x05,
+	0x0D, 0x05, 0x25, 0x05, 0x0B, 0x05, 0x27, 0x05, 0x09, 0x05, 0x29, 0x05, 0x07, 0x05, 0x2B, 0x05,
+	0x05, 0x05, 0x2D, 0x05, 0x03, 0x05, 0x2F, 0x0B, 0x31, 0x09, 0x33, 0x07, 0x35, 0x05, 0x37, 0x03,
+	0xFF, 0xFF, 0x75, 0xFF, 0xFF, 0x59, 0x03, 0x23, 0x03, 0x12, 0x03, 0x23, 0x03, 0x12, 0x05, 0x1F,
+	0x05, 0x13, 0x04, 0x1F, 0x04, 0x15, 0x05, 0x1B, 0x05, 0x17, 0x04, 0x1B, 0x04, 0x19, 0x05, 0x17,
+	0x05, 0x1B, 0x04, 0x17, 0x04, 0x1D, 0x05, 0x13, 0x05, 0x1F, 0x04, 0x13, 0x04, 0x21, 0x05, 0x0F,
+	0x05, 0x23, 0x04, 0x0F, 0x04, 0x25, 0x05, 0x0B, 0x05, 0x27, 0x05, 0x09, 0x05, 0x29, 0x05, 0x07,
+	0x05, 0x2B, 0x05, 0x05, 0x05, 0x2D, 0x05, 0x03, 0x05, 0x2F, 0x05, 0x01, 0x05, 0x31, 0x09, 0x33,
+	0x07, 0x34, 0x07, 0x34, 0x07, 0x33, 0x09, 0x31, 0x0B, 0x2F, 0x05, 0x03, 0x05, 0x2D, 0x05, 0x05,
+	0x05, 0x2B, 0x05, 0x07, 0x05, 0x29, 0x05, 0x09, 0x05, 0x28, 0x04, 0x0B, 0x04, 0x26, 0x05, 0x0D,
+	0x05, 0x24, 0x04, 0x0F, 0x04, 0x22, 0x05, 0x11, 0x05, 0x20, 0x04, 0x13, 0x04, 0x1E, 0x05, 0x15,
+	0x05, 0x1C, 0x04, 0x17, 0x04, 0x1A, 0x05, 0x19, 0x05, 0x18, 0x04, 0x1B, 0x04, 0x16, 0x05, 0x1D,
+	0x05, 0x14, 0x04, 0x1F, 0x04, 0x13, 0x04, 0x21, 0x04, 0x12, 0x03, 0x23, 0x03, 0x12, 0x02, 0x25,
+	0x02, 0xFF, 0xA7, 0xFF, 0xBB, 0x01, 0x37, 0x07, 0x33, 0x09, 0x32, 0x09, 0x31, 0x05, 0x01, 0x05,
+	0x30, 0x04, 0x03, 0x04, 0x2F, 0x04, 0x05, 0x04, 0x2D, 0x05, 0x05, 0x05, 0x2C, 0x04, 0x07, 0x04,
+	0x2B, 0x05, 0x07, 0x05, 0x2A, 0x04, 0x09, 0x04, 0x29, 0x04, 0x0B, 0x04, 0x27, 0x05, 0x0B, 0x05,
+	0x26, 0x04, 0x0D, 0x04, 0x25, 0x05, 0x06, 0x01, 0x06, 0x05, 0x24, 0x04, 0x06, 0x03, 0x06, 0x04,
+	0x23, 0x05, 0x06, 0x03, 0x06, 0x05, 0x22, 0x04, 0x07, 0x03, 0x07, 0x04, 0x21, 0x05, 0x07, 0x03,
+	0x07, 0x05, 0x20, 0x04, 0x08, 0x03, 0x08, 0x04, 0x1F, 0x04, 0x09, 0x03, 0x09, 0x04, 0x1E, 0x04,
+	0x09, 0x03, 0x09, 0x04, 0x1D, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x1C, 0x04, 0x0A, 0x03, 0x0A, 0x04,
+	0x1B, 0x04, 0x0B, 0x03, 0x0B, 0x04, 0x19, 0x05, 0x0B, 0x03, 0x0B, 0x05, 0x18, 0x04, 0x0C, 0x03,
+	0x0C, 0x04, 0x17, 0x05, 0x0C, 0x03, 0x0C, 0x05, 0x16, 0x04, 0x0D, 0x03, 0x0D, 0x04, 0x15, 0x04,
+	0x0E, 0x03, 0x0E, 0x04, 0x14, 0x04, 0x1F, 0x04, 0x13, 0x04, 0x21, 0x04, 0x11, 0x05, 0x21, 0x05,
+	0x10, 0x04, 0x11, 0x01, 0x11, 0x04, 0x0F, 0x05, 0x10, 0x03, 0x10, 0x05, 0x0E, 0x04, 0x10, 0x05,
+	0x10, 0x04, 0x0D, 0x04, 0x11, 0x05, 0x11, 0x04, 0x0C, 0x04, 0x12, 0x03, 0x12, 0x04, 0x0B, 0x04,
+	0x14, 0x01, 0x14, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04,
+	0x0A, 0x31, 0x0B, 0x2F, 0x0D, 0x2D, 0x0F, 0x2B, 0xFF, 0x6B, 0xFF, 0x7F, 0x03, 0x31, 0x11, 0x29,
+	0x13, 0x25, 0x19, 0x21, 0x0A, 0x07, 0x0A, 0x1E, 0x07, 0x11, 0x07, 0x1B, 0x07, 0x13, 0x07, 0x19,
+	0x06, 0x17, 0x06, 0x17, 0x05, 0x1B, 0x05, 0x15, 0x05, 0x1D, 0x05, 0x14, 0x04, 0x1F, 0x04, 0x13,
+	0x04, 0x10, 0x01, 0x10, 0x04, 0x11, 0x05, 0x0F, 0x03, 0x0F, 0x05, 0x10, 0x04, 0x10, 0x03, 0x10,
+	0x04, 0x0F, 0x04, 0x11, 0x03, 0x11, 0x04, 0x0E, 0x04, 0x11, 0x03, 0x11, 0x04, 0x0D, 0x04, 0x12,
+	0x03, 0x12, 0x04, 0x0C, 0x04, 0x12, 0x03, 0x12, 0x04, 0x0C, 0x04, 0x12, 0x03, 0x12, 0x04, 0x0B,
+	0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13,
+	0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x13,
+	0x03, 0x13, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A,
+	0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13,
+	0x04, 0x0B, 0x03, 0x29, 0x03, 0x0C, 0x04, 0x27, 0x04, 0x0C, 0x04, 0x27, 0x04, 0x0D, 0x04, 0x12,
+	0x01, 0x12, 0x04, 0x0E, 0x04, 0x10, 0x05, 0x10, 0x04, 0x0E, 0x04, 0x10, 0x05, 0x10, 0x04, 0x0F,
+	0x04, 0x0F, 0x05, 0x0F, 0x04, 0x11, 0x04, 0x0F, 0x03, 0x0F, 0x04, 0x12, 0x05, 0x1F, 0x05, 0x13,
+	0x05, 0x1D, 0x05, 0x14, 0x06, 0x1B, 0x06, 0x15, 0x06, 0x19, 0x06, 0x17, 0x06, 0x17, 0x06, 0x19,
+	0x07, 0x13, 0x07, 0x1C, 0x08, 0x0D, 0x08, 0x1F, 0x0A, 0x07, 0x0A, 0x22, 0x17, 0x26, 0x13, 0x2C,
+	0x0B, 0x35, 0x01, 0xCE, 0xFF, 0x7F, 0x03, 0x31, 0x11, 0x29, 0x13, 0x25, 0x19, 0x21, 0x0A, 0x07,
+	0x0A, 0x1E, 0x07, 0x11, 0x07, 0x1B, 0x07, 0x13, 0x07, 0x19, 0x06, 0x17, 0x06, 0x17, 0x05, 0x1B,
+	0x05, 0x15, 0x05, 0x1D, 0x05, 0x14, 0x04, 0x1F, 0x04, 0x13, 0x04, 0x0F, 0x03, 0x0F, 0x04, 0x11,
+	0x05, 0x0D, 0x07, 0x0D, 0x05, 0x10, 0x04, 0x0D, 0x09, 0x0D, 0x04, 0x0F, 0x04, 0x0D, 0x0B, 0x0D,
+	0x04, 0x0E, 0x04, 0x0C, 0x05, 0x03, 0x05, 0x0C, 0x04, 0x0D, 0x04, 0x0D, 0x04, 0x05, 0x04, 0x0D,
+	0x04, 0x0C, 0x04, 0x0C, 0x04, 0x07, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x07, 0x04, 0x0C,
+	0x04, 0x0B, 0x04, 0x0D, 0x04, 0x07, 0x04, 0x0D, 0x04, 0x0A, 0x04, 0x0E, 0x03, 0x07, 0x03, 0x0E,
+	0x04, 0x0A, 0x04, 0x17, 0x04, 0x0E, 0x04, 0x0A, 0x04, 0x16, 0x05, 0x0E, 0x04, 0x0A, 0x04, 0x15,
+	0x06, 0x0E, 0x04, 0x0A, 0x04, 0x14, 0x06, 0x0F, 0x04, 0x0A, 0x04, 0x14, 0x05, 0x10, 0x04, 0x0A,
+	0x04, 0x13, 0x05, 0x11, 0x04, 0x0A, 0x04, 0x13, 0x04, 0x12, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13,
+	0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0B, 0x03, 0x13, 0x03, 0x13, 0x03, 0x0C, 0x04, 0x27,
+	0x04, 0x0C, 0x04, 0x27, 0x04, 0x0D, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x12, 0x01, 0x12, 0x04, 0x0E,
+	0x04, 0x11, 0x03, 0x11, 0x04, 0x0F, 0x04, 0x0F, 0x05, 0x0F, 0x04, 0x11, 0x04, 0x0E, 0x05, 0x0E,
+	0x04, 0x12, 0x05, 0x0E, 0x03, 0x0E, 0x05, 0x13, 0x05, 0x0E, 0x01, 0x0E, 0x05, 0x14, 0x06, 0x1B,
+	0x06, 0x15, 0x06, 0x19, 0x06, 0x17, 0x06, 0x17, 0x06, 0x19, 0x07, 0x13, 0x07, 0x1C, 0x08, 0x0D,
+	0x08, 0x1F, 0x0A, 0x07, 0x0A, 0x22, 0x17, 0x26, 0x13, 0x2C, 0x0B, 0x35, 0x01, 0xCE, 0xFF, 0x7F,
+	0x03, 0x31, 0x11, 0x29, 0x13, 0x25, 0x19, 0x21, 0x0A, 0x07, 0x0A, 0x1E, 0x07, 0x11, 0x07, 0x1B,
+	0x07, 0x13, 0x07, 0x19, 0x06, 0x17, 0x06, 0x17, 0x05, 0x1B, 0x05, 0x15, 0x05, 0x1D, 0x05, 0x14,
+	0x04, 0x1F, 0x04, 0x13, 0x04, 0x21, 0x04, 0x11, 0x05, 0x21, 0x05, 0x10, 0x04, 0x23, 0x04, 0x0F,
+	0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0D, 0x04, 0x27, 0x04, 0x0C, 0x04, 0x07, 0x19, 0x07,
+	0x04, 0x0C, 0x04, 0x05, 0x1D, 0x05, 0x04, 0x0B, 0x04, 0x05, 0x1F, 0x05, 0x04, 0x0A, 0x04, 0x05,
+	0x1F, 0x05, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x19, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x19,
+	0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x19, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x19,
+	0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x19, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x04, 0x19,
+	0x04, 0x04, 0x04, 0x0A, 0x04, 0x05, 0x1F, 0x05, 0x04, 0x0A, 0x04, 0x05, 0x1F, 0x05, 0x04, 0x0A,
+	0x04, 0x06, 0x1D, 0x06, 0x04, 0x0B, 0x03, 0x07, 0x1B, 0x07, 0x03, 0x0C, 0x04, 0x27, 0x04, 0x0C,
+	0x04, 0x27, 0x04, 0x0D, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x04, 0x25, 0x04, 0x0F,
+	0x04, 0x23, 0x04, 0x11, 0x04, 0x21, 0x04, 0x12, 0x05, 0x1F, 0x05, 0x13, 0x05, 0x1D, 0x05, 0x14,
+	0x06, 0x1B, 0x06, 0x15, 0x06, 0x19, 0x06, 0x17, 0x06, 0x17, 0x06, 0x19, 0x07, 0x13, 0x07, 0x1C,
+	0x08, 0x0D, 0x08, 0x1F, 0x0A, 0x07, 0x0A, 0x22, 0x17, 0x26, 0x13, 0x2C, 0x0B, 0x35, 0x01, 0xCE,
+	0xFF, 0xB8, 0x04, 0x36, 0x07, 0x34, 0x07, 0x33, 0x09, 0x31, 0x05, 0x01, 0x04, 0x30, 0x05, 0x02,
+	0x04, 0x30, 0x05, 0x02, 0x04, 0x2F, 0x05, 0x03, 0x04, 0x2E, 0x05, 0x04, 0x04, 0x2E, 0x04, 0x05,
+	0x04, 0x2D, 0x04, 0x05, 0x05, 0x2C, 0x05, 0x05, 0x04, 0x2C, 0x05, 0x06, 0x04, 0x2B, 0x05, 0x07,
+	0x04, 0x2A, 0x05, 0x07, 0x04, 0x2A, 0x06, 0x07, 0x05, 0x28, 0x06, 0x08, 0x12, 0x1B, 0x05, 0x09,
+	0x13, 0x19, 0x05, 0x0B, 0x13, 0x18, 0x04, 0x1B, 0x04, 0x17, 0x04, 0x1D, 0x04, 0x16, 0x04, 0x1D,
+	0x04, 0x16, 0x04, 0x1D, 0x04, 0x16, 0x04, 0x1D, 0x04, 0x16, 0x04, 0x1D, 0x04, 0x16, 0x04, 0x1D,
+	0x04, 0x16, 0x04, 0x1D, 0x04, 0x16, 0x04, 0x1D, 0x03, 0x17, 0x04, 0x1C, 0x04, 0x17, 0x04, 0x1C,
+	0x04, 0x17, 0x04, 0x1C, 0x04, 0x17, 0x04, 0x1C, 0x04, 0x17, 0x04, 0x1C, 0x03, 0x18, 0x04, 0x1B,
+	0x04, 0x18, 0x04, 0x1B, 0x04, 0x19, 0x03, 0x1B, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19, 0x04, 0x1A,
+	0x04, 0x1A, 0x04, 0x19, 0x04, 0x1A, 0x05, 0x17, 0x04, 0x1C, 0x05, 0x16, 0x04, 0x1D, 0x07, 0x11,
+	0x06, 0x1E, 0x1C, 0x21, 0x19, 0x23, 0x17, 0x27, 0x11, 0xFF, 0x77, 0xFF, 0x45, 0x01, 0x35, 0x0B,
+	0x2C, 0x13, 0x26, 0x17, 0x22, 0x0A, 0x07, 0x0A, 0x1F, 0x08, 0x0D, 0x08, 0x1C, 0x07, 0x13, 0x07,
+	0x19, 0x06, 0x17, 0x06, 0x17, 0x06, 0x19, 0x06, 0x15, 0x06, 0x1B, 0x06, 0x14, 0x05, 0x0C, 0x01,
+	0x10, 0x05, 0x13, 0x05, 0x0C, 0x03, 0x10, 0x05, 0x12, 0x04, 0x0D, 0x04, 0x10, 0x04, 0x11, 0x04,
+	0x0E, 0x04, 0x11, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x12, 0x04, 0x0E, 0x04, 0x0F, 0x04, 0x12, 0x04,
+	0x0E, 0x04, 0x0F, 0x04, 0x12, 0x04, 0x0D, 0x04, 0x10, 0x04, 0x13, 0x04, 0x0C, 0x04, 0x10, 0x04,
+	0x13, 0x04, 0x0C, 0x03, 0x11, 0x04, 0x14, 0x03, 0x0B, 0x04, 0x11, 0x04, 0x14, 0x04, 0x0A, 0x04,
+	0x11, 0x04, 0x14, 0x04, 0x0A, 0x04, 0x11, 0x04, 0x14, 0x04, 0x0A, 0x04, 0x11, 0x04, 0x14, 0x04,
+	0x0A, 0x04, 0x11, 0x04, 0x14, 0x04, 0x0A, 0x04, 0x11, 0x04, 0x14, 0x04, 0x0A, 0x04, 0x11, 0x05,
+	0x13, 0x04, 0x0A, 0x04, 0x12, 0x05, 0x12, 0x04, 0x0A, 0x04, 0x13, 0x05, 0x11, 0x04, 0x0A, 0x04,
+	0x14, 0x05, 0x10, 0x04, 0x0A, 0x04, 0x15, 0x05, 0x0F, 0x04, 0x0B, 0x04, 0x15, 0x05, 0x0D, 0x04,
+	0x0C, 0x04, 0x16, 0x04, 0x0D, 0x04, 0x0C, 0x04, 0x27, 0x04, 0x0D, 0x04, 0x25, 0x04, 0x0E, 0x04,
+	0x25, 0x04, 0x0F, 0x04, 0x23, 0x04, 0x10, 0x05, 0x21, 0x05, 0x11, 0x04, 0x21, 0x04, 0x13, 0x04,
+	0x1F, 0x04, 0x14, 0x05, 0x1D, 0x05, 0x15, 0x05, 0x1B, 0x05, 0x17, 0x06, 0x17, 0x06, 0x19, 0x07,
+	0x13, 0x07, 0x1B, 0x07, 0x11, 0x07, 0x1E, 0x0A, 0x07, 0x0A, 0x21, 0x19, 0x25, 0x13, 0x29, 0x11,
+	0x31, 0x03, 0xFF, 0x09, 0xB8, 0x03, 0x27, 0x03, 0x0E, 0x04, 0x25, 0x04, 0x0E, 0x05, 0x11, 0x01,
+	0x11, 0x05, 0x0F, 0x04, 0x0C, 0x0B, 0x0C, 0x04, 0x10, 0x03, 0x0A, 0x11, 0x0A, 0x03, 0x1C, 0x13,
+	0x27, 0x08, 0x05, 0x08, 0x25, 0x06, 0x0B, 0x06, 0x23, 0x05, 0x0F, 0x05, 0x21, 0x05, 0x11, 0x05,
+	0x1F, 0x05, 0x13, 0x05, 0x1D, 0x05, 0x15, 0x05, 0x1C, 0x04, 0x17, 0x04, 0x1B, 0x05, 0x17, 0x05,
+	0x1A, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19, 0x04, 0x0E, 0x06, 0x06, 0x04, 0x19, 0x04, 0x06, 0x06,
+	0x01, 0x07, 0x06, 0x03, 0x1B, 0x03, 0x06, 0x0E, 0x06, 0x03, 0x1B, 0x03, 0x06, 0x07, 0x01, 0x05,
+	0x07, 0x03, 0x1B, 0x03, 0x07, 0x05, 0x0E, 0x03, 0x1B, 0x03, 0x1A, 0x03, 0x1B, 0x03, 0x1A, 0x03,
+	0x1B, 0x03, 0x1A, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19, 0x04, 0x1B, 0x04,
+	0x17, 0x04, 0x1C, 0x04, 0x17, 0x04, 0x1D, 0x04, 0x15, 0x04, 0x1E, 0x05, 0x13, 0x05, 0x1F, 0x05,
+	0x11, 0x05, 0x18, 0x04, 0x05, 0x05, 0x0F, 0x05, 0x05, 0x04, 0x0F, 0x05, 0x06, 0x04, 0x0F, 0x04,
+	0x06, 0x05, 0x0E, 0x05, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x05, 0x0E, 0x04, 0x08, 0x04, 0x0D, 0x04,
+	0x08, 0x04, 0x0E, 0x03, 0x09, 0x04, 0x0D, 0x04, 0x09, 0x03, 0x1A, 0x04, 0x0D, 0x04, 0x26, 0x04,
+	0x0D, 0x04, 0x26, 0x04, 0x0D, 0x04, 0x27, 0x13, 0x28, 0x13, 0x28, 0x13, 0x29, 0x11, 0x2A, 0x04,
+	0x09, 0x04, 0x2A, 0x04, 0x09, 0x04, 0x2A, 0x04, 0x09, 0x04, 0x2A, 0x04, 0x09, 0x04, 0x2B, 0x04,
+	0x07, 0x04, 0x2C, 0x0F, 0x2C, 0x0F, 0x2D, 0x0D, 0x31, 0x07, 0xFF, 0x07, 0xFF, 0x45, 0x02, 0x15,
+	0x01, 0x1E, 0x0B, 0x10, 0x03, 0x1A, 0x11, 0x0C, 0x04, 0x19, 0x13, 0x0A, 0x04, 0x19, 0x08, 0x05,
+	0x08, 0x08, 0x05, 0x18, 0x06, 0x0B, 0x06, 0x06, 0x04, 0x19, 0x05, 0x0F, 0x04, 0x05, 0x05, 0x18,
+	0x05, 0x11, 0x01, 0x06, 0x04, 0x19, 0x05, 0x18, 0x05, 0x18, 0x05, 0x18, 0x04, 0x1A, 0x04, 0x18,
+	0x05, 0x19, 0x05, 0x17, 0x05, 0x1A, 0x04, 0x17, 0x06, 0x1A, 0x04, 0x16, 0x07, 0x1A, 0x04, 0x15,
+	0x08, 0x1A, 0x03, 0x15, 0x05, 0x01, 0x03, 0x1A, 0x03, 0x14, 0x05, 0x02, 0x03, 0x1A, 0x03, 0x13,
+	0x05, 0x03, 0x03, 0x1A, 0x03, 0x12, 0x05, 0x04, 0x03, 0x1A, 0x03, 0x11, 0x05, 0x05, 0x03, 0x1A,
+	0x03, 0x10, 0x05, 0x06, 0x03, 0x1A, 0x04, 0x0E, 0x05, 0x06, 0x04, 0x1A, 0x04, 0x0D, 0x05, 0x07,
+	0x04, 0x1A, 0x04, 0x0C, 0x05, 0x08, 0x04, 0x1B, 0x04, 0x0A, 0x05, 0x08, 0x04, 0x1C, 0x05, 0x08,
+	0x05, 0x09, 0x04, 0x1D, 0x04, 0x07, 0x05, 0x09, 0x04, 0x1E, 0x05, 0x05, 0x05, 0x09, 0x05, 0x1F,
+	0x03, 0x05, 0x05, 0x09, 0x05, 0x27, 0x05, 0x09, 0x05, 0x27, 0x05, 0x0A, 0x04, 0x27, 0x05, 0x0B,
+	0x04, 0x26, 0x05, 0x0B, 0x04, 0x26, 0x05, 0x0C, 0x04, 0x25, 0x05, 0x0D, 0x04, 0x24, 0x06, 0x0D,
+	0x04, 0x23, 0x07, 0x0D, 0x04, 0x22, 0x18, 0x22, 0x05, 0x01, 0x13, 0x21, 0x05, 0x02, 0x13, 0x20,
+	0x04, 0x05, 0x12, 0x1F, 0x05, 0x05, 0x04, 0x09, 0x04, 0x1F, 0x04, 0x07, 0x04, 0x09, 0x04, 0x1E,
+	0x05, 0x07, 0x04, 0x09, 0x04, 0x1D, 0x04, 0x09, 0x04, 0x09, 0x04, 0x1C, 0x05, 0x0A, 0x04, 0x07,
+	0x04, 0x1C, 0x04, 0x0C, 0x0F, 0x1B, 0x05, 0x0C, 0x0F, 0x1B, 0x03, 0x0F, 0x0D, 0x1D, 0x02, 0x12,
+	0x07, 0xFF, 0x07, 0xFF, 0x41, 0x09, 0x31, 0x0B, 0x2F, 0x0D, 0x2E, 0x05, 0x03, 0x05, 0x2D, 0x05,
+	0x05, 0x05, 0x2C, 0x04, 0x07, 0x04, 0x2C, 0x03, 0x09, 0x03, 0x2B, 0x04, 0x09, 0x04, 0x2A, 0x04,
+	0x09, 0x04, 0x2A, 0x04, 0x09, 0x07, 0x27, 0x04, 0x09, 0x08, 0x26, 0x04, 0x09, 0x08, 0x26, 0x04,
+	0x09, 0x07, 0x27, 0x04, 0x09, 0x04, 0x2A, 0x04, 0x09, 0x04, 0x2A, 0x04, 0x09, 0x04, 0x2A, 0x04,
+	0x03, 0x03, 0x03, 0x08, 0x26, 0x04, 0x03, 0x03, 0x03, 0x08, 0x26, 0x04, 0x03, 0x03, 0x03, 0x07,
+	0x27, 0x04, 0x03, 0x03, 0x03, 0x04, 0x2A, 0x04, 0x03, 0x03, 0x03, 0x04, 0x2A, 0x04, 0x03, 0x03,
+	0x03, 0x04, 0x2A, 0x04, 0x03, 0x03, 0x03, 0x08, 0x26, 0x04, 0x03, 0x03, 0x03, 0x08, 0x26, 0x04,
+	0x03, 0x03, 0x03, 0x07, 0x27, 0x04, 0x03, 0x03, 0x03, 0x05, 0x29, 0x04, 0x03, 0x03, 0x03, 0x04,
+	0x2A, 0x04, 0x03, 0x03, 0x03, 0x04, 0x2A, 0x04, 0x03, 0x03, 0x03, 0x04, 0x2A, 0x04, 0x03, 0x03,
+	0x03, 0x04, 0x29, 0x05, 0x03, 0x03, 0x03, 0x05, 0x28, 0x05, 0x03, 0x03, 0x03, 0x05, 0x27, 0x05,
+	0x04, 0x03, 0x04, 0x05, 0x26, 0x04, 0x03, 0x07, 0x03, 0x04, 0x25, 0x04, 0x03, 0x09, 0x03, 0x04,
+	0x24, 0x04, 0x02, 0x0B, 0x02, 0x04, 0x23, 0x04, 0x03, 0x0B, 0x03, 0x04, 0x22, 0x04, 0x02, 0x0D,
+	0x02, 0x04, 0x22, 0x04, 0x02, 0x0D, 0x02, 0x04, 0x22, 0x04, 0x02, 0x0D, 0x02, 0x04, 0x22, 0x04,
+	0x03, 0x0B, 0x03, 0x04, 0x23, 0x03, 0x03, 0x0B, 0x03, 0x03, 0x24, 0x04, 0x03, 0x09, 0x03, 0x04,
+	0x24, 0x04, 0x04, 0x07, 0x04, 0x04, 0x25, 0x04, 0x04, 0x05, 0x04, 0x04, 0x26, 0x05, 0x0B, 0x05,
+	0x27, 0x06, 0x07, 0x06, 0x29, 0x11, 0x2B, 0x0F, 0x2E, 0x0B, 0x32, 0x07, 0xCB, 0xFF, 0xED, 0x03,
+	0x13, 0x07, 0x1D, 0x05, 0x12, 0x09, 0x1B, 0x06, 0x11, 0x0A, 0x19, 0x07, 0x12, 0x09, 0x18, 0x09,
+	0x17, 0x04, 0x16, 0x0B, 0x16, 0x04, 0x16, 0x04, 0x03, 0x04, 0x16, 0x04, 0x15, 0x04, 0x05, 0x04,
+	0x15, 0x04, 0x14, 0x05, 0x05, 0x05, 0x14, 0x04, 0x13, 0x05, 0x07, 0x05, 0x13, 0x04, 0x13, 0x04,
+	0x08, 0x05, 0x10, 0x07, 0x13, 0x04, 0x09, 0x05, 0x0F, 0x07, 0x12, 0x04, 0x0B, 0x04, 0x0F, 0x07,
+	0x11, 0x04, 0x0D, 0x04, 0x0F, 0x06, 0x11, 0x04, 0x0D, 0x04, 0x11, 0x04, 0x10, 0x05, 0x0D, 0x05,
+	0x10, 0x04, 0x10, 0x17, 0x10, 0x04, 0x0F, 0x19, 0x0F, 0x04, 0x0F, 0x19, 0x0F, 0x04, 0x0F, 0x1A,
+	0x0E, 0x04, 0x0E, 0x04, 0x13, 0x04, 0x0B, 0x07, 0x0D, 0x04, 0x14, 0x04, 0x0B, 0x07, 0x0D, 0x04,
+	0x15, 0x04, 0x0A, 0x07, 0x0D, 0x04, 0x15, 0x04, 0x0A, 0x07, 0x0D, 0x04, 0x15, 0x04, 0x0D, 0x04,
+	0x0D, 0x04, 0x16, 0x03, 0x0D, 0x04, 0x0C, 0x04, 0x17, 0x03, 0x0D, 0x04, 0x0C, 0x04, 0x17, 0x04,
+	0x0C, 0x04, 0x0C, 0x04, 0x17, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x17, 0x04, 0x0C, 0x04, 0x0C, 0x04,
+	0x17, 0x04, 0x0A, 0x06, 0x0D, 0x03, 0x17, 0x03, 0x0A, 0x07, 0x0D, 0x04, 0x15, 0x04, 0x0A, 0x07,
+	0x0D, 0x04, 0x15, 0x04, 0x0A, 0x07, 0x0D, 0x04, 0x15, 0x04, 0x0D, 0x04, 0x0D, 0x05, 0x13, 0x04,
+	0x0E, 0x04, 0x0E, 0x05, 0x11, 0x05, 0x0E, 0x04, 0x0F, 0x04, 0x11, 0x04, 0x0F, 0x04, 0x10, 0x05,
+	0x0D, 0x05, 0x10, 0x04, 0x11, 0x06, 0x09, 0x06, 0x11, 0x04, 0x12, 0x13, 0x0C, 0x09, 0x14, 0x11,
+	0x0C, 0x0A, 0x15, 0x0F, 0x0D, 0x09, 0x19, 0x09, 0x10, 0x08, 0xFF, 0xA7, 0xFF, 0x43, 0x05, 0x35,
+	0x06, 0x34, 0x07, 0x33, 0x08, 0x32, 0x09, 0x31, 0x0A, 0x30, 0x06, 0x01, 0x04, 0x30, 0x05, 0x02,
+	0x04, 0x2F, 0x05, 0x03, 0x04, 0x04, 0x03, 0x27, 0x05, 0x04, 0x04, 0x04, 0x04, 0x25, 0x05, 0x05,
+	0x04, 0x04, 0x05, 0x24, 0x04, 0x06, 0x04, 0x04, 0x05, 0x23, 0x04, 0x07, 0x04, 0x04, 0x06, 0x21,
+	0x05, 0x07, 0x04, 0x04, 0x07, 0x1F, 0x05, 0x08, 0x04, 0x04, 0x08, 0x1E, 0x04, 0x09, 0x04, 0x03,
+	0x04, 0x01, 0x04, 0x1D, 0x05, 0x0A, 0x0A, 0x01, 0x05, 0x1C, 0x04, 0x0B, 0x09, 0x03, 0x04, 0x1B,
+	0x04, 0x0D, 0x08, 0x04, 0x04, 0x1A, 0x04, 0x0E, 0x06, 0x05, 0x04, 0x19, 0x04, 0x1B, 0x04, 0x18,
+	0x04, 0x1B, 0x04, 0x17, 0x04, 0x1D, 0x04, 0x16, 0x04, 0x1D, 0x04, 0x16, 0x04, 0x0D, 0x03, 0x0D,
+	0x04, 0x16, 0x03, 0x0D, 0x05, 0x0D, 0x03, 0x15, 0x04, 0x0C, 0x07, 0x0C, 0x04, 0x14, 0x04, 0x0B,
+	0x09, 0x0B, 0x04, 0x14, 0x04, 0x0A, 0x0B, 0x0A, 0x04, 0x14, 0x04, 0x0A, 0x05, 0x01, 0x05, 0x0A,
+	0x04, 0x14, 0x03, 0x0A, 0x05, 0x03, 0x05, 0x0A, 0x03, 0x14, 0x04, 0x09, 0x04, 0x05, 0x04, 0x09,
+	0x04, 0x14, 0x04, 0x08, 0x04, 0x07, 0x04, 0x08, 0x04, 0x14, 0x04, 0x07, 0x05, 0x07, 0x05, 0x07,
+	0x04, 0x15, 0x03, 0x07, 0x04, 0x09, 0x04, 0x07, 0x03, 0x16, 0x04, 0x06, 0x04, 0x09, 0x04, 0x06,
+	0x04, 0x16, 0x04, 0x05, 0x04, 0x0B, 0x04, 0x05, 0x04, 0x16, 0x04, 0x05, 0x04, 0x0B, 0x04, 0x05,
+	0x04, 0x17, 0x04, 0x04, 0x04, 0x0B, 0x04, 0x04, 0x04, 0x18, 0x05, 0x03, 0x03, 0x0D, 0x03, 0x03,
+	0x05, 0x19, 0x04, 0x03, 0x03, 0x0D, 0x03, 0x03, 0x04, 0x1B, 0x04, 0x02, 0x04, 0x0B, 0x04, 0x02,
+	0x04, 0x1C, 0x0A, 0x0B, 0x0A, 0x1D, 0x0A, 0x09, 0x0A, 0x1F, 0x09, 0x09, 0x09, 0x22, 0x0A, 0x03,
+	0x0A, 0x25, 0x15, 0x27, 0x13, 0x2B, 0x0D, 0x33, 0x03, 0xFF, 0x09, 0x90, 0x07, 0x31, 0x0D, 0x2D,
+	0x0F, 0x2B, 0x11, 0x29, 0x06, 0x07, 0x06, 0x27, 0x05, 0x0B, 0x05, 0x26, 0x04, 0x0D, 0x04, 0x25,
+	0x05, 0x0D, 0x05, 0x24, 0x04, 0x0F, 0x04, 0x23, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22,
+	0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22,
+	0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22, 0x04, 0x04, 0x09, 0x04, 0x04, 0x22, 0x05, 0x01,
+	0x0D, 0x01, 0x05, 0x22, 0x19, 0x22, 0x19, 0x22, 0x08, 0x09, 0x08, 0x21, 0x07, 0x0D, 0x07, 0x1F,
+	0x06, 0x11, 0x06, 0x1D, 0x05, 0x15, 0x05, 0x1B, 0x05, 0x17, 0x05, 0x1A, 0x04, 0x19, 0x04, 0x19,
+	0x05, 0x19, 0x05, 0x18, 0x04, 0x0B, 0x05, 0x0B, 0x04, 0x17, 0x04, 0x0B, 0x07, 0x0B, 0x04, 0x16,
+	0x04, 0x0A, 0x09, 0x0A, 0x04, 0x16, 0x04, 0x09, 0x0B, 0x09, 0x04, 0x15, 0x04, 0x0A, 0x0B, 0x0A,
+	0x04, 0x14, 0x04, 0x09, 0x0D, 0x09, 0x04, 0x14, 0x04, 0x09, 0x0D, 0x09, 0x04, 0x14, 0x04, 0x09,
+	0x0D, 0x09, 0x04, 0x14, 0x03, 0x0B, 0x0B, 0x0B, 0x03, 0x14, 0x03, 0x0B, 0x0B, 0x0B, 0x03, 0x14,
+	0x04, 0x0B, 0x09, 0x0B, 0x04, 0x14, 0x04, 0x0C, 0x07, 0x0C, 0x04, 0x14, 0x04, 0x0D, 0x05, 0x0D,
+	0x04, 0x15, 0x03, 0x0D, 0x05, 0x0D, 0x03, 0x16, 0x04, 0x0C, 0x05, 0x0C, 0x04, 0x16, 0x04, 0x0C,
+	0x05, 0x0C, 0x04, 0x16, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x17, 0x04, 0x0B, 0x05, 0x0B, 0x04, 0x18,
+	0x05, 0x19, 0x05, 0x19, 0x05, 0x17, 0x05, 0x1B, 0x05, 0x16, 0x04, 0x1D, 0x05, 0x13, 0x05, 0x1F,
+	0x06, 0x0F, 0x06, 0x21, 0x06, 0x0D, 0x06, 0x23, 0x0A, 0x03, 0x0A, 0x25, 0x15, 0x28, 0x11, 0x2C,
+	0x0D, 0x52, 0x90, 0x07, 0x31, 0x0D, 0x2D, 0x0F, 0x2B, 0x11, 0x29, 0x06, 0x07, 0x06, 0x27, 0x05,
+	0x0B, 0x05, 0x26, 0x04, 0x0D, 0x04, 0x25, 0x05, 0x0D, 0x05, 0x24, 0x04, 0x0F, 0x04, 0x23, 0x04,
+	0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22, 0x04,
+	0x11, 0x03, 0x23, 0x04, 0x37, 0x04, 0x37, 0x04, 0x37, 0x04, 0x04, 0x09, 0x2A, 0x05, 0x01, 0x0D,
+	0x28, 0x16, 0x25, 0x17, 0x24, 0x08, 0x09, 0x08, 0x21, 0x07, 0x0D, 0x07, 0x1F, 0x06, 0x11, 0x06,
+	0x1D, 0x05, 0x15, 0x05, 0x1B, 0x05, 0x17, 0x05, 0x1A, 0x04, 0x19, 0x04, 0x19, 0x05, 0x19, 0x05,
+	0x18, 0x04, 0x0B, 0x05, 0x0B, 0x04, 0x17, 0x04, 0x0B, 0x07, 0x0B, 0x04, 0x16, 0x04, 0x0A, 0x09,
+	0x0A, 0x04, 0x16, 0x04, 0x09, 0x0B, 0x09, 0x04, 0x15, 0x04, 0x0A, 0x0B, 0x0A, 0x04, 0x14, 0x04,
+	0x09, 0x0D, 0x09, 0x04, 0x14, 0x04, 0x09, 0x0D, 0x09, 0x04, 0x14, 0x04, 0x09, 0x0D, 0x09, 0x04,
+	0x14, 0x03, 0x0B, 0x0B, 0x0B, 0x03, 0x14, 0x03, 0x0B, 0x0B, 0x0B, 0x03, 0x14, 0x04, 0x0B, 0x09,
+	0x0B, 0x04, 0x14, 0x04, 0x0C, 0x07, 0x0C, 0x04, 0x14, 0x04, 0x0D, 0x05, 0x0D, 0x04, 0x15, 0x03,
+	0x0D, 0x05, 0x0D, 0x03, 0x16, 0x04, 0x0C, 0x05, 0x0C, 0x04, 0x16, 0x04, 0x0C, 0x05, 0x0C, 0x04,
+	0x16, 0x05, 0x0B, 0x05, 0x0B, 0x05, 0x17, 0x04, 0x0B, 0x05, 0x0B, 0x04, 0x18, 0x05, 0x19, 0x05,
+	0x19, 0x05, 0x17, 0x05, 0x1B, 0x05, 0x16, 0x04, 0x1D, 0x05, 0x13, 0x05, 0x1F, 0x06, 0x0F, 0x06,
+	0x21, 0x06, 0x0D, 0x06, 0x23, 0x0A, 0x03, 0x0A, 0x25, 0x15, 0x28, 0x11, 0x2C, 0x0D, 0x52, 0xFF,
+	0xFF, 0x22, 0x0A, 0x0D, 0x0A, 0x19, 0x0D, 0x09, 0x0D, 0x16, 0x10, 0x07, 0x10, 0x13, 0x12, 0x05,
+	0x12, 0x11, 0x06, 0x09, 0x05, 0x03, 0x05, 0x09, 0x06, 0x0F, 0x05, 0x0C, 0x0B, 0x0C, 0x05, 0x0E,
+	0x04, 0x0E, 0x09, 0x0E, 0x04, 0x0D, 0x04, 0x10, 0x07, 0x10, 0x04, 0x0C, 0x04, 0x11, 0x05, 0x11,
+	0x04, 0x0B, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x14, 0x01, 0x14, 0x04, 0x0A, 0x04, 0x29,
+	0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29, 0x04, 0x0A, 0x04, 0x29,
+	0x04, 0x0A, 0x04, 0x29, 0x04, 0x0B, 0x04, 0x27, 0x04, 0x0C, 0x05, 0x25, 0x05, 0x0D, 0x04, 0x25,
+	0x04, 0x0E, 0x05, 0x23, 0x05, 0x0F, 0x05, 0x21, 0x05, 0x11, 0x05, 0x1F, 0x05, 0x13, 0x04, 0x1F,
+	0x04, 0x15, 0x04, 0x1D, 0x04, 0x16, 0x05, 0x1B, 0x05, 0x17, 0x05, 0x19, 0x05, 0x19, 0x05, 0x17,
+	0x05, 0x1B, 0x05, 0x15, 0x05, 0x1D, 0x05, 0x13, 0x05, 0x1F, 0x05, 0x11, 0x05, 0x21, 0x05, 0x0F,
+	0x05, 0x23, 0x05, 0x0D, 0x05, 0x25, 0x05, 0x0B, 0x05, 0x27, 0x05, 0x09, 0x05, 0x29, 0x06, 0x05,
+	0x06, 0x2C, 0x05, 0x03, 0x05, 0x2F, 0x05, 0x01, 0x05, 0x31, 0x09, 0x33, 0x07, 0x35, 0x05, 0x37,
+	0x03, 0x39, 0x01, 0xFF, 0xBB, 0xC8, 0x01, 0x0B, 0x01, 0x2B, 0x07, 0x05, 0x07, 0x26, 0x0B, 0x01,
+	0x0B, 0x24, 0x17, 0x23, 0x05, 0x03, 0x09, 0x04, 0x04, 0x22, 0x04, 0x06, 0x05, 0x06, 0x04, 0x22,
+	0x03, 0x08, 0x04, 0x07, 0x03, 0x22, 0x03, 0x08, 0x03, 0x08, 0x04, 0x20, 0x04, 0x08, 0x03, 0x08,
+	0x04, 0x1E, 0x06, 0x08, 0x03, 0x08, 0x06, 0x1A, 0x07, 0x09, 0x03, 0x09, 0x07, 0x16, 0x09, 0x09,
+	0x03, 0x09, 0x09, 0x13, 0x07, 0x06, 0x03, 0x03, 0x03, 0x04, 0x02, 0x06, 0x07, 0x11, 0x06, 0x07,
+	0x04, 0x03, 0x03, 0x03, 0x04, 0x07, 0x06, 0x0F, 0x06, 0x09, 0x03, 0x03, 0x03, 0x03, 0x04, 0x08,
+	0x06, 0x0E, 0x05, 0x09, 0x04, 0x03, 0x03, 0x03, 0x04, 0x09, 0x05, 0x0D, 0x05, 0x09, 0x05, 0x03,
+	0x03, 0x03, 0x05, 0x09, 0x05, 0x0C, 0x04, 0x07, 0x08, 0x03, 0x03, 0x03, 0x08, 0x07, 0x04, 0x0B,
+	0x04, 0x08, 0x07, 0x04, 0x03, 0x04, 0x07, 0x08, 0x04, 0x0A, 0x04, 0x08, 0x05, 0x06, 0x03, 0x06,
+	0x05, 0x08, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A, 0x04, 0x13, 0x03, 0x13, 0x04, 0x0A,
+	0x04, 0x04, 0x06, 0x09, 0x03, 0x09, 0x06, 0x04, 0x04, 0x0A, 0x04, 0x02, 0x09, 0x08, 0x03, 0x08,
+	0x09, 0x02, 0x04, 0x0A, 0x04, 0x01, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x01, 0x04, 0x0B, 0x11, 0x05,
+	0x03, 0x05, 0x11, 0x0C, 0x07, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x07, 0x0D, 0x05, 0x08,
+	0x03, 0x05, 0x03, 0x05, 0x03, 0x08, 0x05, 0x0E, 0x04, 0x0A, 0x02, 0x05, 0x03, 0x05, 0x02, 0x0A,
+	0x04, 0x0E, 0x04, 0x11, 0x03, 0x11, 0x04, 0x0E, 0x04, 0x11, 0x03, 0x11, 0x04, 0x0E, 0x04, 0x11,
+	0x03, 0x11, 0x04, 0x0E, 0x04, 0x11, 0x03, 0x11, 0x04, 0x0E, 0x04, 0x05, 0x06, 0x06, 0x03, 0x06,
+	0x06, 0x05, 0x04, 0x0E, 0x04, 0x05, 0x07, 0x05, 0x03, 0x05, 0x07, 0x05, 0x04, 0x0E, 0x04, 0x05,
+	0x08, 0x04, 0x03, 0x04, 0x08, 0x05, 0x04, 0x0E, 0x04, 0x08, 0x05, 0x04, 0x03, 0x04, 0x05, 0x08,
+	0x04, 0x0E, 0x04, 0x09, 0x04, 0x04, 0x03, 0x04, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x09, 0x04, 0x03,
+	0x03, 0x03, 0x04, 0x09, 0x04, 0x10, 0x04, 0x09, 0x04, 0x03, 0x03, 0x03, 0x04, 0x09, 0x04, 0x11,
+	0x05, 0x07, 0x04, 0x03, 0x03, 0x03, 0x04, 0x08, 0x04, 0x13, 0x06, 0x05, 0x04, 0x03, 0x03, 0x04,
+	0x03, 0x05, 0x06, 0x14, 0x08, 0x04, 0x01, 0x05, 0x03, 0x05, 0x01, 0x04, 0x08, 0x16, 0x07, 0x09,
+	0x03, 0x09, 0x07, 0x19, 0x07, 0x08, 0x03, 0x08, 0x07, 0x1D, 0x04, 0x08, 0x03, 0x08, 0x04, 0x21,
+	0x03, 0x08, 0x03, 0x08, 0x03, 0x22, 0x03, 0x07, 0x05, 0x07, 0x03, 0x22, 0x06, 0x03, 0x07, 0x04,
+	0x05, 0x23, 0x17, 0x24, 0x17, 0x26, 0x08, 0x03, 0x08, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x19, 0x0D,
+	0x2C, 0x12, 0x27, 0x16, 0x23, 0x0A, 0x06, 0x09, 0x20, 0x08, 0x0D, 0x08, 0x1D, 0x07, 0x11, 0x07,
+	0x1B, 0x06, 0x08, 0x05, 0x08, 0x06, 0x18, 0x07, 0x05, 0x0D, 0x05, 0x07, 0x15, 0x07, 0x03, 0x13,
+	0x04, 0x07, 0x11, 0x07, 0x03, 0x17, 0x03, 0x07, 0x0F, 0x06, 0x04, 0x08, 0x09, 0x08, 0x04, 0x06,
+	0x0B, 0x08, 0x05, 0x06, 0x0D, 0x06, 0x05, 0x08, 0x05, 0x0A, 0x07, 0x02, 0x13, 0x02, 0x07, 0x0A,
+	0x02, 0x08, 0x29, 0x08, 0x02, 0x06, 0x2D, 0x06, 0x04, 0x01, 0x33, 0x01, 0x0E, 0x23, 0x18, 0x23,
+	0x18, 0x23, 0x19, 0x21, 0x10, 0x03, 0x31, 0x03, 0x03, 0x07, 0x2B, 0x07, 0x02, 0x09, 0x27, 0x09,
+	0x03, 0x0A, 0x06, 0x04, 0x10, 0x04, 0x05, 0x0A, 0x07, 0x08, 0x04, 0x07, 0x0B, 0x07, 0x04, 0x08,
+	0x0C, 0x07, 0x04, 0x18, 0x03, 0x07, 0x10, 0x07, 0x03, 0x15, 0x04, 0x06, 0x14, 0x06, 0x05, 0x10,
+	0x04, 0x07, 0x16, 0x07, 0x06, 0x0A, 0x06, 0x06, 0x19, 0x07, 0x13, 0x07, 0x1C, 0x07, 0x10, 0x06,
+	0x1F, 0x09, 0x0A, 0x08, 0x22, 0x0B, 0x01, 0x0C, 0x25, 0x14, 0x29, 0x10, 0x2E, 0x09, 0xFF, 0xFF,
+	0x69, 0xFF, 0xFF, 0xA3, 0x0B, 0x2D, 0x11, 0x26, 0x19, 0x21, 0x1B, 0x1D, 0x0A, 0x0D, 0x0A, 0x19,
+	0x08, 0x13, 0x08, 0x17, 0x07, 0x17, 0x07, 0x15, 0x06, 0x1B, 0x06, 0x13, 0x06, 0x1D, 0x06, 0x11,
+	0x05, 0x21, 0x05, 0x0F, 0x05, 0x0E, 0x07, 0x0E, 0x05, 0x0D, 0x05, 0x0D, 0x0B, 0x0D, 0x05, 0x0B,
+	0x05, 0x0C, 0x0F, 0x0C, 0x05, 0x09, 0x05, 0x0C, 0x11, 0x0C, 0x05, 0x07, 0x05, 0x0C, 0x06, 0x07,
+	0x06, 0x0C, 0x05, 0x06, 0x04, 0x0D, 0x04, 0x0B, 0x04, 0x0D, 0x04, 0x05, 0x05, 0x0C, 0x04, 0x0D,
+	0x04, 0x0C, 0x05, 0x04, 0x04, 0x0D, 0x04, 0x0D, 0x04, 0x0D, 0x04, 0x03, 0x04, 0x0D, 0x04, 0x0F,
+	0x04, 0x0D, 0x04, 0x02, 0x04, 0x0D, 0x04, 0x0F, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x0D, 0x03, 0x11,
+	0x03, 0x0D, 0x04, 0x01, 0x04, 0x0E, 0x03, 0x11, 0x03, 0x0E, 0x08, 0x0E, 0x03, 0x11, 0x03, 0x0E,
+	0x08, 0x0E, 0x04, 0x0F, 0x04, 0x0E, 0x04, 0x01, 0x02, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x02, 0x13,
+	0x04, 0x0F, 0x04, 0x25, 0x04, 0x0D, 0x04, 0x26, 0x05, 0x0B, 0x05, 0x27, 0x05, 0x09, 0x05, 0x28,
+	0x07, 0x05, 0x07, 0x29, 0x11, 0x2C, 0x0D, 0x30, 0x09, 0xFF, 0xFF, 0xFF, 0x91, 0xFF, 0x5B, 0x03,
+	0x37, 0x04, 0x36, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x20, 0x0B, 0x0A, 0x05, 0x1E, 0x11,
+	0x06, 0x05, 0x1B, 0x15, 0x05, 0x05, 0x1B, 0x15, 0x05, 0x05, 0x19, 0x0A, 0x12, 0x05, 0x19, 0x08,
+	0x14, 0x07, 0x17, 0x07, 0x15, 0x09, 0x15, 0x06, 0x16, 0x0B, 0x13, 0x06, 0x16, 0x05, 0x02, 0x06,
+	0x10, 0x06, 0x17, 0x05, 0x05, 0x05, 0x0F, 0x05, 0x0E, 0x04, 0x05, 0x05, 0x07, 0x05, 0x0D, 0x05,
+	0x0D, 0x05, 0x05, 0x05, 0x09, 0x05, 0x0B, 0x05, 0x0C, 0x06, 0x05, 0x05, 0x0B, 0x05, 0x09, 0x05,
+	0x0C, 0x06, 0x05, 0x06, 0x0C, 0x05, 0x07, 0x05, 0x0C, 0x06, 0x05, 0x08, 0x0C, 0x05, 0x06, 0x04,
+	0x0D, 0x04, 0x06, 0x09, 0x0D, 0x04, 0x05, 0x05, 0x0C, 0x04, 0x06, 0x05, 0x02, 0x04, 0x0C, 0x05,
+	0x04, 0x04, 0x0D, 0x04, 0x05, 0x05, 0x03, 0x04, 0x0D, 0x04, 0x03, 0x04, 0x0D, 0x04, 0x05, 0x05,
+	0x05, 0x04, 0x0D, 0x04, 0x02, 0x04, 0x0D, 0x03, 0x05, 0x05, 0x06, 0x04, 0x0D, 0x04, 0x02, 0x04,
+	0x0D, 0x02, 0x05, 0x05, 0x08, 0x03, 0x0D, 0x04, 0x01, 0x04, 0x0E, 0x01, 0x05, 0x05, 0x09, 0x03,
+	0x0E, 0x08, 0x13, 0x05, 0x0A, 0x03, 0x0E, 0x08, 0x12, 0x05, 0x0A, 0x04, 0x0E, 0x04, 0x01, 0x02,
+	0x12, 0x05, 0x0B, 0x04, 0x0F, 0x02, 0x15, 0x05, 0x0C, 0x04, 0x25, 0x05, 0x0C, 0x04, 0x25, 0x06,
+	0x0B, 0x05, 0x24, 0x08, 0x09, 0x05, 0x24, 0x0B, 0x05, 0x07, 0x23, 0x05, 0x01, 0x11, 0x23, 0x05,
+	0x04, 0x0D, 0x24, 0x05, 0x07, 0x09, 0x25, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x35, 0x05,
+	0x35, 0x05, 0x35, 0x05, 0x35, 0x05, 0x36, 0x04, 0x37, 0x03, 0xFF, 0x5B, 0xFF, 0xFF, 0x6A, 0x07,
+	0x30, 0x0F, 0x2A, 0x13, 0x27, 0x0A, 0x01, 0x0A, 0x25, 0x07, 0x09, 0x07, 0x23, 0x05, 0x0F, 0x05,
+	0x21, 0x05, 0x11, 0x05, 0x1F, 0x05, 0x13, 0x05, 0x1D, 0x05, 0x15, 0x05, 0x1C, 0x04, 0x17, 0x04,
+	0x1B, 0x04, 0x19, 0x04, 0x1A, 0x04, 0x19, 0x04, 0x1A, 0x03, 0x1B, 0x03, 0x19, 0x04, 0x1B, 0x04,
+	0x18, 0x04, 0x1B, 0x04, 0x18, 0x03, 0x1D, 0x03, 0x13, 0x08, 0x1D, 0x08, 0x0C, 0x0A, 0x1D, 0x0A,
+	0x09, 0x0B, 0x1D, 0x0B, 0x07, 0x0A, 0x21, 0x0A, 0x05, 0x06, 0x2B, 0x06, 0x03, 0x05, 0x2F, 0x05,
+	0x02, 0x04, 0x31, 0x04, 0x02, 0x04, 0x31, 0x04, 0x01, 0x04, 0x33, 0x08, 0x33, 0x08, 0x33, 0x08,
+	0x33, 0x08, 0x33, 0x08, 0x33, 0x04, 0x01, 0x04, 0x31, 0x04, 0x02, 0x04, 0x31, 0x04, 0x03, 0x04,
+	0x2F, 0x04, 0x04, 0x06, 0x2B, 0x06, 0x05, 0x35, 0x07, 0x33, 0x0A, 0x2F, 0x0E, 0x2B, 0xFF, 0xFF,
+	0x93, 0xFF, 0x44, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x29, 0x01,
+	0x0E, 0x03, 0x0E, 0x01, 0x19, 0x03, 0x1D, 0x03, 0x17, 0x05, 0x1B, 0x05, 0x17, 0x05, 0x19, 0x05,
+	0x19, 0x05, 0x17, 0x05, 0x1B, 0x04, 0x08, 0x07, 0x08, 0x04, 0x1D, 0x02, 0x06, 0x0D, 0x06, 0x02,
+	0x25, 0x0F, 0x2B, 0x11, 0x29, 0x06, 0x07, 0x06, 0x27, 0x05, 0x0B, 0x05, 0x25, 0x05, 0x0D, 0x05,
+	0x23, 0x05, 0x0F, 0x05, 0x22, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x21, 0x04, 0x13, 0x04,
+	0x20, 0x04, 0x13, 0x04, 0x15, 0x07, 0x04, 0x04, 0x13, 0x04, 0x04, 0x07, 0x0A, 0x07, 0x04, 0x04,
+	0x13, 0x04, 0x04, 0x07, 0x0A, 0x07, 0x04, 0x04, 0x13, 0x04, 0x04, 0x07, 0x15, 0x04, 0x13, 0x04,
+	0x20, 0x04, 0x13, 0x04, 0x21, 0x04, 0x11, 0x04, 0x22, 0x04, 0x11, 0x04, 0x22, 0x05, 0x0F, 0x05,
+	0x23, 0x05, 0x0D, 0x05, 0x25, 0x05, 0x0B, 0x05, 0x27, 0x06, 0x07, 0x06, 0x29, 0x11, 0x2B, 0x0F,
+	0x25, 0x02, 0x06, 0x0D, 0x06, 0x02, 0x1D, 0x04, 0x08, 0x06, 0x09, 0x04, 0x1B, 0x05, 0x17, 0x05,
+	0x19, 0x05, 0x19, 0x05, 0x18, 0x04, 0x1B, 0x04, 0x18, 0x03, 0x1D, 0x03, 0x28, 0x03, 0x38, 0x03,
+	0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0x38, 0x03, 0xFF, 0x44, 0xFF, 0xB9, 0x05, 0x33,
+	0x0B, 0x2E, 0x0F, 0x2A, 0x13, 0x27, 0x07, 0x07, 0x07, 0x25, 0x06, 0x0B, 0x06, 0x24, 0x05, 0x0D,
+	0x05, 0x23, 0x05, 0x0F, 0x05, 0x22, 0x04, 0x11, 0x04, 0x21, 0x04, 0x13, 0x04, 0x20, 0x03, 0x15,
+	0x03, 0x1F, 0x04, 0x15, 0x04, 0x1E, 0x04, 0x15, 0x04, 0x1E, 0x04, 0x15, 0x04, 0x1A, 0x08, 0x15,
+	0x08, 0x14, 0x0A, 0x15, 0x0A, 0x10, 0x0B, 0x16, 0x0C, 0x0D, 0x0C, 0x17, 0x0C, 0x0B, 0x06, 0x25,
+	0x06, 0x0A, 0x05, 0x27, 0x05, 0x0A, 0x04, 0x29, 0x04, 0x09, 0x04, 0x2B, 0x04, 0x08, 0x04, 0x2B,
+	0x04, 0x08, 0x03, 0x2D, 0x03, 0x08, 0x03, 0x2D, 0x03, 0x08, 0x03, 0x2D, 0x03, 0x08, 0x04, 0x2B,
+	0x04, 0x08, 0x04, 0x2B, 0x04, 0x09, 0x04, 0x29, 0x04, 0x0A, 0x05, 0x27, 0x05, 0x0B, 0x05, 0x25,
+	0x05, 0x0C, 0x2F, 0x0D, 0x2D, 0x10, 0x29, 0x14, 0x25, 0x19, 0x04, 0x09, 0x05, 0x09, 0x04, 0x1B,
+	0x05, 0x09, 0x04, 0x09, 0x05, 0x1B, 0x04, 0x09, 0x05, 0x09, 0x04, 0x1B, 0x04, 0x0A, 0x04, 0x09,
+	0x05, 0x1B, 0x04, 0x09, 0x04, 0x09, 0x05, 0x1B, 0x04, 0x09, 0x05, 0x09, 0x04, 0x1B, 0x05, 0x09,
+	0x04, 0x09, 0x05, 0x1B, 0x04, 0x09, 0x05, 0x09, 0x04, 0x1C, 0x04, 0x0A, 0x03, 0x0A, 0x03, 0x1E,
+	0x01, 0x0D, 0x01, 0x0C, 0x02, 0xFF, 0xB1,
+};
+
+/**
+ * @brief 59x59 compressed icon offsets.
+ */
+const uint32_t icon59_rle_offset[] = {
+	0, 137, 320, 503, 686, 869, 1044, 1413,
+	1758, 2049, 2262, 2430, 2461, 2514, 2600, 2731,
+	2936, 3105, 3325, 3622, 3818, 3932, 4057, 4237,
+	4421, 4603, 4950, 5090, 5370, 5650, 5950, 6250,
+	6464, 6730, 6923, 7061, 7329, 7536, 7736, 7888,
+	8130, 8283, 8387, 8547, 8762, 8996, 9246, 9472,
+	9643, 9876, 10108, 10355, 10605, 10844, 11115, 11362,
+	11599, 11781, 12171, 12337, 12509, 12748, 12881, 13068,
+};
+
+icon_font_t icon_59_rle = {
+    59,
+    59,
+    0,
+    icon59_rle_data,
+    icon59_rle_offset
+};
+
+/**
+ * @brief 89x89 compressed icon data array.
+ */
+const uint8_t icon89_rle_data[] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x33, 0x24, 0x38, 0x1F, 0x3B, 0x1D, 0x3D, 0x1B, 0x3F, 0x1A,
+	0x40, 0x18, 0x07, 0x33, 0x07, 0x18, 0x06, 0x36, 0x06, 0x17, 0x05, 0x37, 0x06, 0x16, 0x06, 0x37,
+	0x06, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38,
+	0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x0B, 0x10, 0x06, 0x38, 0x0C, 0x0F, 0x06, 0x38,
+	0x0C, 0x0F, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38,
+	0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38,
+	0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38,
+	0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38,
+	0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38,
+	0x0D, 0x0E, 0x06, 0x38, 0x0D, 0x0E, 0x06, 0x38, 0x0C, 0x0F, 0x06, 0x38, 0x0C, 0x0F, 0x06, 0x38,
+	0x0A, 0x11, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38,
+	0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x37, 0x06, 0x17, 0x05, 0x37, 0x06, 0x17, 0x06, 0x36,
+	0x06, 0x17, 0x07, 0x33, 0x07, 0x19, 0x40, 0x19, 0x3F, 0x1B, 0x3D, 0x1D, 0x3B, 0x20, 0x38, 0x23,
+	0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x33, 0x24, 0x38,
+	0x1F, 0x3B, 0x1D, 0x3D, 0x1B, 0x3F, 0x1A, 0x40, 0x18, 0x07, 0x33, 0x07, 0x18, 0x06, 0x36, 0x06,
+	0x17, 0x05, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x08, 0x06,
+	0x2A, 0x05, 0x16, 0x06, 0x07, 0x09, 0x28, 0x05, 0x16, 0x06, 0x06, 0x0A, 0x28, 0x05, 0x16, 0x06,
+	0x06, 0x0B, 0x27, 0x05, 0x16, 0x06, 0x06, 0x0B, 0x27, 0x0B, 0x10, 0x06, 0x06, 0x0B, 0x27, 0x0C,
+	0x0F, 0x06, 0x06, 0x0B, 0x27, 0x0C, 0x0F, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B,
+	0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06,
+	0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D,
+	0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B,
+	0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06,
+	0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D,
+	0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B,
+	0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06,
+	0x06, 0x0B, 0x27, 0x0D, 0x0E, 0x06, 0x06, 0x0B, 0x27, 0x0C, 0x0F, 0x06, 0x06, 0x0B, 0x27, 0x0C,
+	0x0F, 0x06, 0x06, 0x0B, 0x27, 0x0A, 0x11, 0x06, 0x06, 0x0B, 0x27, 0x05, 0x16, 0x06, 0x06, 0x0A,
+	0x28, 0x05, 0x16, 0x06, 0x07, 0x09, 0x28, 0x05, 0x16, 0x06, 0x08, 0x06, 0x2A, 0x05, 0x16, 0x06,
+	0x38, 0x05, 0x16, 0x06, 0x37, 0x06, 0x17, 0x05, 0x37, 0x06, 0x17, 0x06, 0x36, 0x06, 0x17, 0x07,
+	0x33, 0x07, 0x19, 0x40, 0x19, 0x3F, 0x1B, 0x3D, 0x1D, 0x3B, 0x20, 0x38, 0x23, 0x33, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x33, 0x24, 0x38, 0x1F, 0x3B, 0x1D,
+	0x3D, 0x1B, 0x3F, 0x1A, 0x40, 0x18, 0x07, 0x33, 0x07, 0x18, 0x06, 0x36, 0x06, 0x17, 0x05, 0x37,
+	0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x08, 0x11, 0x1F, 0x05, 0x16,
+	0x06, 0x07, 0x14, 0x1D, 0x05, 0x16, 0x06, 0x06, 0x15, 0x1D, 0x05, 0x16, 0x06, 0x06, 0x16, 0x1C,
+	0x05, 0x16, 0x06, 0x06, 0x16, 0x1C, 0x0B, 0x10, 0x06, 0x06, 0x16, 0x1C, 0x0C, 0x0F, 0x06, 0x06,
+	0x16, 0x1C, 0x0C, 0x0F, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E,
+	0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C,
+	0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06,
+	0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E,
+	0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C,
+	0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06,
+	0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E,
+	0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C,
+	0x0D, 0x0E, 0x06, 0x06, 0x16, 0x1C, 0x0C, 0x0F, 0x06, 0x06, 0x16, 0x1C, 0x0C, 0x0F, 0x06, 0x06,
+	0x16, 0x1C, 0x0A, 0x11, 0x06, 0x06, 0x16, 0x1C, 0x05, 0x16, 0x06, 0x06, 0x15, 0x1D, 0x05, 0x16,
+	0x06, 0x07, 0x14, 0x1D, 0x05, 0x16, 0x06, 0x08, 0x11, 0x1F, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16,
+	0x06, 0x37, 0x06, 0x17, 0x05, 0x37, 0x06, 0x17, 0x06, 0x36, 0x06, 0x17, 0x07, 0x33, 0x07, 0x19,
+	0x40, 0x19, 0x3F, 0x1B, 0x3D, 0x1D, 0x3B, 0x20, 0x38, 0x23, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x33, 0x24, 0x38, 0x1F, 0x3B, 0x1D, 0x3D, 0x1B, 0x3F,
+	0x1A, 0x40, 0x18, 0x07, 0x33, 0x07, 0x18, 0x06, 0x36, 0x06, 0x17, 0x05, 0x37, 0x06, 0x16, 0x06,
+	0x37, 0x06, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x08, 0x1A, 0x16, 0x05, 0x16, 0x06, 0x07, 0x1D,
+	0x14, 0x05, 0x16, 0x06, 0x06, 0x1F, 0x13, 0x05, 0x16, 0x06, 0x06, 0x1F, 0x13, 0x05, 0x16, 0x06,
+	0x06, 0x1F, 0x13, 0x0B, 0x10, 0x06, 0x06, 0x1F, 0x13, 0x0C, 0x0F, 0x06, 0x06, 0x1F, 0x13, 0x0C,
+	0x0F, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F,
+	0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06,
+	0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D,
+	0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F,
+	0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06,
+	0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D,
+	0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F,
+	0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06, 0x06, 0x1F, 0x13, 0x0D, 0x0E, 0x06,
+	0x06, 0x1F, 0x13, 0x0C, 0x0F, 0x06, 0x06, 0x1F, 0x13, 0x0C, 0x0F, 0x06, 0x06, 0x1F, 0x13, 0x0A,
+	0x11, 0x06, 0x06, 0x1F, 0x13, 0x05, 0x16, 0x06, 0x06, 0x1F, 0x13, 0x05, 0x16, 0x06, 0x07, 0x1D,
+	0x14, 0x05, 0x16, 0x06, 0x08, 0x1A, 0x16, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x37, 0x06,
+	0x17, 0x05, 0x37, 0x06, 0x17, 0x06, 0x36, 0x06, 0x17, 0x07, 0x33, 0x07, 0x19, 0x40, 0x19, 0x3F,
+	0x1B, 0x3D, 0x1D, 0x3B, 0x20, 0x38, 0x23, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xA4, 0x33, 0x24, 0x38, 0x1F, 0x3B, 0x1D, 0x3D, 0x1B, 0x3F, 0x1A, 0x40, 0x18,
+	0x07, 0x33, 0x07, 0x18, 0x06, 0x36, 0x06, 0x17, 0x05, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16,
+	0x06, 0x38, 0x05, 0x16, 0x06, 0x08, 0x27, 0x09, 0x05, 0x16, 0x06, 0x07, 0x2A, 0x07, 0x05, 0x16,
+	0x06, 0x06, 0x2C, 0x06, 0x05, 0x16, 0x06, 0x06, 0x2C, 0x06, 0x05, 0x16, 0x06, 0x06, 0x2C, 0x06,
+	0x0B, 0x10, 0x06, 0x06, 0x2C, 0x06, 0x0C, 0x0F, 0x06, 0x06, 0x2C, 0x06, 0x0C, 0x0F, 0x06, 0x06,
+	0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E,
+	0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06,
+	0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06,
+	0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E,
+	0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06,
+	0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06,
+	0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E,
+	0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06, 0x0D, 0x0E, 0x06, 0x06, 0x2C, 0x06,
+	0x0C, 0x0F, 0x06, 0x06, 0x2C, 0x06, 0x0C, 0x0F, 0x06, 0x06, 0x2C, 0x06, 0x0A, 0x11, 0x06, 0x06,
+	0x2C, 0x06, 0x05, 0x16, 0x06, 0x06, 0x2C, 0x06, 0x05, 0x16, 0x06, 0x07, 0x2A, 0x07, 0x05, 0x16,
+	0x06, 0x08, 0x27, 0x09, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x37, 0x06, 0x17, 0x05, 0x37,
+	0x06, 0x17, 0x06, 0x36, 0x06, 0x17, 0x07, 0x33, 0x07, 0x19, 0x40, 0x19, 0x3F, 0x1B, 0x3D, 0x1D,
+	0x3B, 0x20, 0x38, 0x23, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xA4, 0x33, 0x24, 0x38, 0x1F, 0x3B, 0x1D, 0x3D, 0x1B, 0x3F, 0x1A, 0x40, 0x18, 0x07, 0x33, 0x07,
+	0x18, 0x06, 0x36, 0x06, 0x17, 0x05, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x38, 0x05,
+	0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05,
+	0x16, 0x06, 0x38, 0x0B, 0x10, 0x06, 0x38, 0x0C, 0x0F, 0x06, 0x19, 0x01, 0x1E, 0x0C, 0x0F, 0x06,
+	0x18, 0x03, 0x1D, 0x0D, 0x0E, 0x06, 0x18, 0x05, 0x1B, 0x0D, 0x0E, 0x06, 0x18, 0x06, 0x1A, 0x0D,
+	0x0E, 0x06, 0x18, 0x08, 0x18, 0x0D, 0x0E, 0x06, 0x18, 0x09, 0x17, 0x0D, 0x0E, 0x06, 0x18, 0x0B,
+	0x15, 0x0D, 0x0E, 0x06, 0x18, 0x0C, 0x14, 0x0D, 0x0E, 0x06, 0x0B, 0x04, 0x09, 0x0E, 0x12, 0x0D,
+	0x0E, 0x06, 0x0B, 0x07, 0x06, 0x0F, 0x11, 0x0D, 0x0E, 0x06, 0x0C, 0x09, 0x03, 0x11, 0x0F, 0x0D,
+	0x0E, 0x06, 0x0E, 0x1C, 0x0E, 0x0D, 0x0E, 0x06, 0x0F, 0x11, 0x03, 0x08, 0x0D, 0x0D, 0x0E, 0x06,
+	0x10, 0x10, 0x06, 0x06, 0x0C, 0x0D, 0x0E, 0x06, 0x12, 0x0E, 0x09, 0x03, 0x0C, 0x0D, 0x0E, 0x06,
+	0x13, 0x0D, 0x18, 0x0D, 0x0E, 0x06, 0x15, 0x0B, 0x18, 0x0D, 0x0E, 0x06, 0x16, 0x0A, 0x18, 0x0D,
+	0x0E, 0x06, 0x18, 0x08, 0x18, 0x0D, 0x0E, 0x06, 0x19, 0x07, 0x18, 0x0D, 0x0E, 0x06, 0x1B, 0x05,
+	0x18, 0x0D, 0x0E, 0x06, 0x1C, 0x03, 0x19, 0x0D, 0x0E, 0x06, 0x1E, 0x01, 0x19, 0x0C, 0x0F, 0x06,
+	0x38, 0x0C, 0x0F, 0x06, 0x38, 0x0A, 0x11, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06,
+	0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x38, 0x05, 0x16, 0x06, 0x37, 0x06, 0x17, 0x05,
+	0x37, 0x06, 0x17, 0x06, 0x36, 0x06, 0x17, 0x07, 0x33, 0x07, 0x19, 0x40, 0x19, 0x3F, 0x1B, 0x3D,
+	0x1D, 0x3B, 0x20, 0x38, 0x23, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x19, 0x05, 0x52, 0x09, 0x4E, 0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x49, 0x11, 0x48, 0x06, 0x05, 0x06,
+	0x48, 0x05, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06,
+	0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06,
+	0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06,
+	0x34, 0x07, 0x0B, 0x06, 0x07, 0x06, 0x32, 0x0B, 0x09, 0x06, 0x07, 0x06, 0x31, 0x0D, 0x08, 0x06,
+	0x07, 0x06, 0x30, 0x0F, 0x07, 0x06, 0x07, 0x06, 0x2F, 0x11, 0x06, 0x06, 0x07, 0x06, 0x2F, 0x07,
+	0x03, 0x07, 0x06, 0x06, 0x07, 0x06, 0x2F, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x06, 0x2E, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x1D, 0x05, 0x0C, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06,
+	0x1B, 0x09, 0x0A, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x19, 0x0C, 0x09, 0x06, 0x07, 0x06,
+	0x05, 0x06, 0x07, 0x06, 0x18, 0x0E, 0x08, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x18, 0x0F,
+	0x07, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x17, 0x11, 0x06, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x17, 0x06, 0x04, 0x07, 0x06, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x16, 0x06, 0x06, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x06, 0x06, 0x17, 0x07,
+	0x03, 0x07, 0x07, 0x07, 0x03, 0x07, 0x07, 0x07, 0x03, 0x07, 0x18, 0x11, 0x07, 0x11, 0x07, 0x11,
+	0x19, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x1B, 0x0D, 0x0B, 0x0D, 0x0B, 0x0D, 0x1D, 0x0B, 0x0D, 0x0B,
+	0x0D, 0x0B, 0x1F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x23, 0x02, 0x16, 0x03, 0x16, 0x02, 0xFF, 0xFF,
+	0x84, 0xFF, 0xFF, 0xFF, 0xBF, 0x05, 0x52, 0x09, 0x4E, 0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x49, 0x11,
+	0x48, 0x06, 0x05, 0x06, 0x48, 0x05, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06,
+	0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06,
+	0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06,
+	0x46, 0x06, 0x07, 0x06, 0x34, 0x07, 0x0B, 0x06, 0x07, 0x06, 0x32, 0x0B, 0x09, 0x06, 0x07, 0x06,
+	0x31, 0x0D, 0x08, 0x06, 0x07, 0x06, 0x30, 0x0F, 0x07, 0x06, 0x07, 0x06, 0x2F, 0x11, 0x06, 0x06,
+	0x07, 0x06, 0x2F, 0x07, 0x03, 0x07, 0x06, 0x06, 0x07, 0x06, 0x2F, 0x06, 0x05, 0x06, 0x06, 0x06,
+	0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x2E, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x1D, 0x05, 0x0C, 0x06, 0x07, 0x06,
+	0x05, 0x06, 0x07, 0x06, 0x1B, 0x09, 0x0A, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x19, 0x0C,
+	0x09, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x18, 0x0E, 0x08, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x18, 0x0F, 0x07, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x17, 0x11, 0x06, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x17, 0x11, 0x06, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x12, 0x06, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13,
+	0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13,
+	0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06,
+	0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x06, 0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x16, 0x12,
+	0x07, 0x06, 0x05, 0x06, 0x07, 0x06, 0x06, 0x06, 0x17, 0x11, 0x07, 0x07, 0x03, 0x07, 0x07, 0x07,
+	0x03, 0x07, 0x18, 0x11, 0x07, 0x11, 0x07, 0x11, 0x19, 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x1B, 0x0D,
+	0x0B, 0x0D, 0x0B, 0x0D, 0x1D, 0x0B, 0x0D, 0x0B, 0x0D, 0x0B, 0x1F, 0x09, 0x0F, 0x09, 0x0F, 0x09,
+	0x23, 0x02, 0x16, 0x03, 0x16, 0x02, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xBF, 0x05, 0x52, 0x09,
+	0x4E, 0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x49, 0x11, 0x48, 0x06, 0x05, 0x06, 0x48, 0x05, 0x07, 0x06,
+	0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06,
+	0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06,
+	0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x46, 0x06, 0x07, 0x06, 0x34, 0x07, 0x0B, 0x06,
+	0x07, 0x06, 0x32, 0x0B, 0x09, 0x06, 0x07, 0x06, 0x31, 0x0D, 0x08, 0x06, 0x07, 0x06, 0x30, 0x0F,
+	0x07, 0x06, 0x07, 0x06, 0x2F, 0x11, 0x06, 0x06, 0x07, 0x06, 0x2F, 0x11, 0x06, 0x06, 0x07, 0x06,
+	0x2F, 0x11, 0x06, 0x06, 0x07, 0x06, 0x2E, 0x13, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x13, 0x05, 0x06,
+	0x07, 0x06, 0x2E, 0x13, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x13, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x13,
+	0x05, 0x06, 0x07, 0x06, 0x2E, 0x13, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x2E, 0x13, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x13, 0x05, 0x06, 0x07, 0x06, 0x2E, 0x13, 0x05, 0x06,
+	0x07, 0x06, 0x2E, 0x13, 0x05, 0x06, 0x07, 0x06, 0x1D, 0x05, 0x0C, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x1B, 0x09, 0x0A, 0x13, 0x05, 0x06, 0x07, 0x06, 0x19, 0x0C, 0x09, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x18, 0x0E, 0x08, 0x13, 0x05, 0x06, 0x07, 0x06, 0x18, 0x0F, 0x07, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x17, 0x11, 0x06, 0x13, 0x05, 0x06, 0x07, 0x06, 0x17, 0x11, 0x06, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x12, 0x06, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x06, 0x07, 0x06, 0x16, 0x12, 0x07, 0x11, 0x07, 0x06, 0x06, 0x06,
+	0x17, 0x11, 0x07, 0x11, 0x07, 0x07, 0x03, 0x07, 0x18, 0x11, 0x07, 0x11, 0x07, 0x11, 0x19, 0x0F,
+	0x09, 0x0F, 0x09, 0x0F, 0x1B, 0x0D, 0x0B, 0x0D, 0x0B, 0x0D, 0x1D, 0x0B, 0x0D, 0x0B, 0x0D, 0x0B,
+	0x1F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x23, 0x02, 0x16, 0x03, 0x16, 0x02, 0xFF, 0xFF, 0xDD, 0xFF,
+	0xFF, 0xFF, 0xBF, 0x05, 0x52, 0x09, 0x4E, 0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x49, 0x11, 0x48, 0x11,
+	0x48, 0x12, 0x46, 0x13, 0x46, 0x13, 0x46, 0x13, 0x46, 0x13, 0x46, 0x13, 0x46, 0x13, 0x46, 0x13,
+	0x46, 0x13, 0x46, 0x13, 0x46, 0x13, 0x46, 0x13, 0x34, 0x07, 0x0B, 0x13, 0x32, 0x0B, 0x09, 0x13,
+	0x31, 0x0D, 0x08, 0x13, 0x30, 0x0F, 0x07, 0x13, 0x2F, 0x11, 0x06, 0x13, 0x2F, 0x11, 0x06, 0x13,
+	0x2F, 0x11, 0x06, 0x13, 0x2E, 0x13, 0x05, 0x13, 0x2E, 0x13, 0x05, 0x13, 0x2E, 0x13, 0x05, 0x13,
+	0x2E, 0x13, 0x05, 0x13, 0x2E, 0x13, 0x05, 0x13, 0x2E, 0x13, 0x05, 0x13, 0x2E, 0x13, 0x05, 0x13,
+	0x2E, 0x13, 0x05, 0x13, 0x2E, 0x13, 0x05, 0x13, 0x2E, 0x13, 0x05, 0x13, 0x2E, 0x13, 0x05, 0x13,
+	0x1D, 0x05, 0x0C, 0x13, 0x05, 0x13, 0x1B, 0x09, 0x0A, 0x13, 0x05, 0x13, 0x19, 0x0C, 0x09, 0x13,
+	0x05, 0x13, 0x18, 0x0E, 0x08, 0x13, 0x05, 0x13, 0x18, 0x0F, 0x07, 0x13, 0x05, 0x13, 0x17, 0x11,
+	0x06, 0x13, 0x05, 0x13, 0x17, 0x11, 0x06, 0x13, 0x05, 0x13, 0x16, 0x12, 0x06, 0x13, 0x05, 0x13,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13,
+	0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13,
+	0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13,
+	0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13,
+	0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13,
+	0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x13, 0x05, 0x13, 0x05, 0x13, 0x16, 0x12, 0x07, 0x11,
+	0x07, 0x12, 0x17, 0x11, 0x07, 0x11, 0x07, 0x11, 0x18, 0x11, 0x07, 0x11, 0x07, 0x11, 0x19, 0x0F,
+	0x09, 0x0F, 0x09, 0x0F, 0x1B, 0x0D, 0x0B, 0x0D, 0x0B, 0x0D, 0x1D, 0x0B, 0x0D, 0x0B, 0x0D, 0x0B,
+	0x1F, 0x09, 0x0F, 0x09, 0x0F, 0x09, 0x23, 0x02, 0x16, 0x03, 0x16, 0x02, 0xFF, 0xFF, 0xDD, 0xFF,
+	0xFF, 0xFF, 0xA8, 0x03, 0x54, 0x07, 0x51, 0x09, 0x4F, 0x0B, 0x4D, 0x0D, 0x4C, 0x0D, 0x4B, 0x07,
+	0x01, 0x07, 0x4A, 0x06, 0x03, 0x06, 0x49, 0x07, 0x03, 0x07, 0x48, 0x06, 0x05, 0x06, 0x47, 0x07,
+	0x05, 0x07, 0x46, 0x06, 0x07, 0x06, 0x45, 0x07, 0x07, 0x07, 0x44, 0x06, 0x09, 0x06, 0x43, 0x07,
+	0x09, 0x07, 0x42, 0x06, 0x0B, 0x06, 0x41, 0x07, 0x0B, 0x07, 0x40, 0x06, 0x0D, 0x06, 0x3F, 0x07,
+	0x0D, 0x07, 0x3E, 0x06, 0x0F, 0x06, 0x3D, 0x07, 0x0F, 0x07, 0x3C, 0x06, 0x11, 0x06, 0x3B, 0x07,
+	0x11, 0x07, 0x3A, 0x06, 0x13, 0x06, 0x39, 0x07, 0x13, 0x07, 0x38, 0x06, 0x15, 0x06, 0x37, 0x07,
+	0x15, 0x07, 0x36, 0x06, 0x17, 0x06, 0x35, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x33, 0x06,
+	0x1B, 0x06, 0x32, 0x06, 0x1B, 0x06, 0x31, 0x06, 0x1D, 0x06, 0x30, 0x06, 0x1D, 0x06, 0x2F, 0x06,
+	0x1F, 0x06, 0x2E, 0x06, 0x1F, 0x06, 0x2D, 0x06, 0x21, 0x06, 0x2C, 0x06, 0x21, 0x06, 0x2B, 0x06,
+	0x23, 0x06, 0x2A, 0x06, 0x23, 0x06, 0x29, 0x06, 0x25, 0x06, 0x28, 0x06, 0x25, 0x06, 0x27, 0x06,
+	0x27, 0x06, 0x26, 0x06, 0x27, 0x06, 0x25, 0x06, 0x29, 0x06, 0x24, 0x06, 0x29, 0x06, 0x23, 0x06,
+	0x2B, 0x06, 0x22, 0x06, 0x2B, 0x06, 0x21, 0x06, 0x2D, 0x06, 0x20, 0x06, 0x2D, 0x06, 0x1F, 0x06,
+	0x16, 0x03, 0x16, 0x06, 0x1E, 0x06, 0x13, 0x09, 0x13, 0x06, 0x1D, 0x06, 0x11, 0x0F, 0x11, 0x06,
+	0x1C, 0x06, 0x0E, 0x15, 0x0E, 0x06, 0x1B, 0x06, 0x0B, 0x1D, 0x0B, 0x06, 0x1A, 0x06, 0x08, 0x23,
+	0x08, 0x06, 0x1A, 0x06, 0x05, 0x13, 0x03, 0x13, 0x05, 0x06, 0x1A, 0x1B, 0x09, 0x1B, 0x1A, 0x17,
+	0x11, 0x17, 0x1B, 0x13, 0x17, 0x13, 0x1C, 0x10, 0x1D, 0x0F, 0x1E, 0x0B, 0x25, 0x0A, 0x21, 0x06,
+	0x2B, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x05, 0x52,
+	0x09, 0x4F, 0x0B, 0x4D, 0x0D, 0x4C, 0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A,
+	0x0F, 0x4B, 0x0D, 0x4C, 0x0D, 0x4D, 0x0B, 0x4F, 0x09, 0x52, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD,
+	0x07, 0x4E, 0x0F, 0x47, 0x14, 0x43, 0x18, 0x40, 0x1B, 0x3C, 0x1E, 0x3A, 0x0B, 0x0A, 0x0B, 0x38,
+	0x09, 0x10, 0x09, 0x37, 0x08, 0x13, 0x08, 0x35, 0x07, 0x16, 0x07, 0x36, 0x05, 0x18, 0x06, 0x37,
+	0x03, 0x1B, 0x03, 0xFF, 0xFF, 0x05, 0x05, 0x52, 0x09, 0x4F, 0x0B, 0x4D, 0x0D, 0x4C, 0x0D, 0x4B,
+	0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4B, 0x0D, 0x4C, 0x0D, 0x4D, 0x0B, 0x4F,
+	0x09, 0x52, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x43, 0x10, 0x45, 0x18, 0x3E, 0x1E, 0x39, 0x22, 0x35, 0x26, 0x31, 0x11, 0x08, 0x11,
+	0x2E, 0x0D, 0x12, 0x0E, 0x2A, 0x0C, 0x18, 0x0C, 0x28, 0x0B, 0x1D, 0x0A, 0x26, 0x09, 0x22, 0x0A,
+	0x23, 0x09, 0x25, 0x09, 0x21, 0x08, 0x28, 0x09, 0x1F, 0x08, 0x2A, 0x08, 0x1F, 0x07, 0x2D, 0x07,
+	0x1E, 0x06, 0x2F, 0x05, 0x20, 0x03, 0x32, 0x04, 0x39, 0x07, 0x4E, 0x0F, 0x47, 0x14, 0x43, 0x18,
+	0x40, 0x1B, 0x3C, 0x1E, 0x3A, 0x0B, 0x0A, 0x0B, 0x38, 0x09, 0x10, 0x09, 0x37, 0x08, 0x13, 0x08,
+	0x35, 0x07, 0x16, 0x07, 0x36, 0x05, 0x18, 0x06, 0x37, 0x03, 0x1B, 0x03, 0xFF, 0xFF, 0x05, 0x05,
+	0x52, 0x09, 0x4F, 0x0B, 0x4D, 0x0D, 0x4C, 0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F,
+	0x4A, 0x0F, 0x4B, 0x0D, 0x4C, 0x0D, 0x4D, 0x0B, 0x4F, 0x09, 0x52, 0x05, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0x0C, 0x47, 0x18, 0x3D, 0x20, 0x36, 0x26, 0x30, 0x2C, 0x2B,
+	0x30, 0x27, 0x11, 0x12, 0x11, 0x23, 0x0F, 0x1A, 0x0F, 0x20, 0x0D, 0x21, 0x0D, 0x1C, 0x0C, 0x26,
+	0x0C, 0x19, 0x0C, 0x2B, 0x0B, 0x16, 0x0A, 0x30, 0x0A, 0x14, 0x0A, 0x33, 0x0A, 0x11, 0x09, 0x36,
+	0x0A, 0x0E, 0x09, 0x3A, 0x09, 0x0C, 0x09, 0x3C, 0x09, 0x0A, 0x09, 0x3F, 0x08, 0x08, 0x08, 0x19,
+	0x10, 0x19, 0x08, 0x07, 0x07, 0x16, 0x18, 0x16, 0x07, 0x07, 0x06, 0x14, 0x1E, 0x14, 0x06, 0x08,
+	0x04, 0x13, 0x22, 0x13, 0x05, 0x09, 0x02, 0x12, 0x26, 0x13, 0x01, 0x1D, 0x11, 0x08, 0x11, 0x2E,
+	0x0D, 0x12, 0x0E, 0x2A, 0x0C, 0x18, 0x0C, 0x28, 0x0B, 0x1D, 0x0A, 0x26, 0x09, 0x22, 0x0A, 0x23,
+	0x09, 0x25, 0x09, 0x21, 0x08, 0x28, 0x09, 0x1F, 0x08, 0x2A, 0x08, 0x1F, 0x07, 0x2D, 0x07, 0x1E,
+	0x06, 0x2F, 0x05, 0x20, 0x03, 0x32, 0x04, 0x39, 0x07, 0x4E, 0x0F, 0x47, 0x14, 0x43, 0x18, 0x40,
+	0x1B, 0x3C, 0x1E, 0x3A, 0x0B, 0x0A, 0x0B, 0x38, 0x09, 0x10, 0x09, 0x37, 0x08, 0x13, 0x08, 0x35,
+	0x07, 0x16, 0x07, 0x36, 0x05, 0x18, 0x06, 0x37, 0x03, 0x1B, 0x03, 0xFF, 0xFF, 0x05, 0x05, 0x52,
+	0x09, 0x4F, 0x0B, 0x4D, 0x0D, 0x4C, 0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A, 0x0F, 0x4A,
+	0x0F, 0x4B, 0x0D, 0x4C, 0x0D, 0x4D, 0x0B, 0x4F, 0x09, 0x52, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A,
+	0xFF, 0xFF, 0x66, 0x02, 0x56, 0x04, 0x54, 0x06, 0x52, 0x07, 0x51, 0x07, 0x51, 0x07, 0x2F, 0x0C,
+	0x16, 0x07, 0x2A, 0x18, 0x0F, 0x07, 0x27, 0x20, 0x0A, 0x07, 0x25, 0x24, 0x08, 0x07, 0x23, 0x26,
+	0x08, 0x07, 0x22, 0x27, 0x08, 0x07, 0x21, 0x12, 0x11, 0x05, 0x08, 0x07, 0x20, 0x0F, 0x22, 0x08,
+	0x1F, 0x0D, 0x24, 0x0A, 0x1C, 0x0C, 0x26, 0x0C, 0x19, 0x0C, 0x27, 0x0F, 0x16, 0x0B, 0x28, 0x11,
+	0x14, 0x0A, 0x29, 0x07, 0x03, 0x0A, 0x11, 0x09, 0x2A, 0x07, 0x05, 0x0A, 0x0E, 0x09, 0x2B, 0x07,
+	0x08, 0x09, 0x0C, 0x09, 0x2B, 0x07, 0x0A, 0x09, 0x0A, 0x09, 0x2B, 0x07, 0x0D, 0x08, 0x08, 0x08,
+	0x19, 0x0B, 0x08, 0x07, 0x0F, 0x08, 0x07, 0x07, 0x16, 0x0E, 0x08, 0x07, 0x11, 0x07, 0x07, 0x06,
+	0x14, 0x10, 0x08, 0x07, 0x13, 0x06, 0x08, 0x04, 0x13, 0x11, 0x08, 0x09, 0x13, 0x05, 0x09, 0x01,
+	0x13, 0x12, 0x08, 0x0C, 0x13, 0x01, 0x1D, 0x12, 0x09, 0x0F, 0x2E, 0x0D, 0x0E, 0x12, 0x2A, 0x0C,
+	0x10, 0x14, 0x28, 0x0A, 0x12, 0x07, 0x05, 0x0A, 0x26, 0x0A, 0x12, 0x07, 0x08, 0x0A, 0x23, 0x09,
+	0x13, 0x07, 0x0A, 0x0A, 0x21, 0x08, 0x14, 0x07, 0x0D, 0x09, 0x1F, 0x08, 0x14, 0x07, 0x0F, 0x08,
+	0x1F, 0x07, 0x14, 0x07, 0x12, 0x07, 0x1E, 0x06, 0x14, 0x07, 0x14, 0x05, 0x20, 0x03, 0x15, 0x07,
+	0x16, 0x04, 0x37, 0x08, 0x50, 0x0E, 0x4A, 0x11, 0x47, 0x14, 0x44, 0x17, 0x41, 0x19, 0x3F, 0x07,
+	0x09, 0x0B, 0x3D, 0x07, 0x0D, 0x09, 0x3B, 0x07, 0x10, 0x08, 0x39, 0x07, 0x12, 0x07, 0x38, 0x07,
+	0x14, 0x06, 0x37, 0x07, 0x17, 0x03, 0x37, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07,
+	0x51, 0x07, 0x0D, 0x05, 0x3F, 0x07, 0x0C, 0x09, 0x3C, 0x07, 0x0C, 0x0B, 0x3A, 0x07, 0x0C, 0x0D,
+	0x38, 0x07, 0x0D, 0x0D, 0x37, 0x07, 0x0D, 0x0F, 0x35, 0x07, 0x0E, 0x0F, 0x34, 0x07, 0x0F, 0x0F,
+	0x33, 0x07, 0x10, 0x0F, 0x32, 0x07, 0x11, 0x0F, 0x31, 0x07, 0x13, 0x0D, 0x31, 0x07, 0x14, 0x0D,
+	0x30, 0x07, 0x16, 0x0B, 0x30, 0x07, 0x18, 0x09, 0x30, 0x07, 0x1B, 0x05, 0x31, 0x07, 0x52, 0x06,
+	0x54, 0x04, 0x56, 0x02, 0xFF, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF1, 0x01, 0x57, 0x04, 0x54, 0x06,
+	0x53, 0x07, 0x52, 0x08, 0x51, 0x0A, 0x4F, 0x0B, 0x4E, 0x0C, 0x4D, 0x0D, 0x4C, 0x0E, 0x4B, 0x06,
+	0x01, 0x08, 0x4A, 0x06, 0x02, 0x08, 0x49, 0x06, 0x03, 0x08, 0x48, 0x06, 0x04, 0x08, 0x47, 0x06,
+	0x05, 0x08, 0x46, 0x06, 0x06, 0x09, 0x44, 0x06, 0x07, 0x09, 0x43, 0x06, 0x08, 0x09, 0x42, 0x06,
+	0x0A, 0x08, 0x41, 0x06, 0x0B, 0x08, 0x40, 0x06, 0x0C, 0x08, 0x3F, 0x06, 0x0D, 0x07, 0x3F, 0x06,
+	0x0C, 0x08, 0x33, 0x04, 0x08, 0x06, 0x0B, 0x08, 0x33, 0x06, 0x07, 0x06, 0x0A, 0x08, 0x34, 0x07,
+	0x06, 0x06, 0x08, 0x09, 0x35, 0x09, 0x04, 0x06, 0x07, 0x09, 0x37, 0x09, 0x03, 0x06, 0x06, 0x09,
+	0x39, 0x09, 0x02, 0x06, 0x05, 0x09, 0x3B, 0x09, 0x01, 0x06, 0x04, 0x08, 0x3F, 0x0E, 0x02, 0x09,
+	0x41, 0x0D, 0x01, 0x09, 0x43, 0x15, 0x45, 0x13, 0x47, 0x10, 0x4B, 0x0D, 0x4D, 0x0B, 0x4F, 0x09,
+	0x4F, 0x0B, 0x4D, 0x0D, 0x4A, 0x10, 0x48, 0x13, 0x45, 0x15, 0x43, 0x0D, 0x01, 0x09, 0x41, 0x0E,
+	0x02, 0x09, 0x3E, 0x09, 0x01, 0x06, 0x04, 0x08, 0x3C, 0x09, 0x02, 0x06, 0x05, 0x09, 0x39, 0x09,
+	0x03, 0x06, 0x06, 0x09, 0x37, 0x09, 0x04, 0x06, 0x07, 0x09, 0x36, 0x07, 0x06, 0x06, 0x08, 0x09,
+	0x35, 0x06, 0x07, 0x06, 0x0A, 0x08, 0x35, 0x04, 0x08, 0x06, 0x0B, 0x08, 0x40, 0x06, 0x0C, 0x08,
+	0x3F, 0x06, 0x0D, 0x07, 0x3F, 0x06, 0x0C, 0x08, 0x3F, 0x06, 0x0B, 0x08, 0x40, 0x06, 0x0A, 0x08,
+	0x41, 0x06, 0x08, 0x09, 0x42, 0x06, 0x07, 0x09, 0x43, 0x06, 0x06, 0x09, 0x44, 0x06, 0x05, 0x08,
+	0x46, 0x06, 0x04, 0x08, 0x47, 0x06, 0x03, 0x08, 0x48, 0x06, 0x02, 0x08, 0x49, 0x06, 0x01, 0x08,
+	0x4A, 0x0E, 0x4B, 0x0D, 0x4C, 0x0C, 0x4D, 0x0B, 0x4E, 0x0A, 0x4F, 0x08, 0x51, 0x07, 0x52, 0x06,
+	0x54, 0x04, 0x56, 0x01, 0xFF, 0xFF, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x16,
+	0x06, 0x2D, 0x0F, 0x17, 0x06, 0x2F, 0x0D, 0x18, 0x05, 0x30, 0x0C, 0x18, 0x05, 0x31, 0x0B, 0x18,
+	0x05, 0x31, 0x0B, 0x05, 0x03, 0x07, 0x03, 0x06, 0x2F, 0x08, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06,
+	0x31, 0x06, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06,
+	0x32, 0x05, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06,
+	0x32, 0x05, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x05, 0x03, 0x05, 0x06,
+	0x32, 0x05, 0x0A, 0x05, 0x0D, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x0D, 0x06, 0x32, 0x05, 0x0A, 0x05,
+	0x0D, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x0D, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x0D, 0x06, 0x32, 0x05,
+	0x0A, 0x18, 0x32, 0x05, 0x0A, 0x18, 0x32, 0x05, 0x0A, 0x18, 0x32, 0x05, 0x0A, 0x18, 0x32, 0x05,
+	0x0A, 0x17, 0x33, 0x05, 0x0B, 0x15, 0x34, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05,
+	0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05,
+	0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05,
+	0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05,
+	0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05,
+	0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3B, 0x06, 0x13, 0x05, 0x3B, 0x06,
+	0x13, 0x05, 0x06, 0x3B, 0x13, 0x05, 0x06, 0x3A, 0x14, 0x05, 0x06, 0x3A, 0x14, 0x05, 0x06, 0x39,
+	0x15, 0x05, 0x06, 0x37, 0x17, 0x05, 0x06, 0x35, 0x19, 0x05, 0x0F, 0x06, 0x0F, 0x05, 0x2B, 0x05,
+	0x0F, 0x06, 0x0F, 0x05, 0x2B, 0x05, 0x0F, 0x06, 0x0F, 0x05, 0x2B, 0x05, 0x0F, 0x06, 0x0F, 0x05,
+	0x2B, 0x05, 0x0F, 0x06, 0x0F, 0x05, 0x2B, 0x05, 0x0F, 0x06, 0x0F, 0x05, 0x2B, 0x05, 0x0F, 0x06,
+	0x0F, 0x05, 0x2B, 0x05, 0x0F, 0x06, 0x0F, 0x05, 0x2B, 0x05, 0x0F, 0x06, 0x0F, 0x05, 0x2B, 0x05,
+	0x07, 0x2A, 0x23, 0x05, 0x06, 0x2C, 0x22, 0x05, 0x06, 0x2C, 0x22, 0x05, 0x06, 0x2C, 0x22, 0x05,
+	0x07, 0x2B, 0x24, 0x01, 0x0A, 0x28, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x15, 0x07,
+	0x2D, 0x0F, 0x17, 0x06, 0x2F, 0x0D, 0x18, 0x05, 0x30, 0x0C, 0x18, 0x05, 0x31, 0x0B, 0x18, 0x05,
+	0x31, 0x0B, 0x18, 0x06, 0x31, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06, 0x31, 0x06, 0x0A, 0x05, 0x04,
+	0x05, 0x04, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x04,
+	0x05, 0x04, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x04, 0x05, 0x04, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x04,
+	0x05, 0x04, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x05, 0x03, 0x05, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x0D,
+	0x06, 0x32, 0x05, 0x0A, 0x05, 0x0D, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x0D, 0x06, 0x32, 0x05, 0x0A,
+	0x05, 0x0D, 0x06, 0x32, 0x05, 0x0A, 0x05, 0x0D, 0x06, 0x32, 0x05, 0x0A, 0x06, 0x0C, 0x06, 0x32,
+	0x05, 0x0A, 0x18, 0x32, 0x05, 0x0A, 0x18, 0x32, 0x05, 0x0A, 0x18, 0x32, 0x05, 0x0A, 0x17, 0x33,
+	0x05, 0x0B, 0x16, 0x33, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C,
+	0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x3C,
+	0x05, 0x13, 0x05, 0x3C, 0x05, 0x13, 0x05, 0x27, 0x0C, 0x09, 0x05, 0x13, 0x05, 0x24, 0x12, 0x06,
+	0x05, 0x13, 0x05, 0x22, 0x16, 0x06, 0x03, 0x13, 0x05, 0x21, 0x18, 0x06, 0x02, 0x13, 0x05, 0x20,
+	0x1A, 0x05, 0x02, 0x13, 0x05, 0x1E, 0x1D, 0x05, 0x01, 0x13, 0x05, 0x1E, 0x1E, 0x18, 0x05, 0x1D,
+	0x20, 0x17, 0x05, 0x1C, 0x22, 0x16, 0x05, 0x1B, 0x07, 0x03, 0x10, 0x03, 0x06, 0x16, 0x05, 0x1B,
+	0x07, 0x04, 0x0E, 0x04, 0x07, 0x15, 0x05, 0x1A, 0x08, 0x05, 0x0C, 0x05, 0x07, 0x15, 0x05, 0x1A,
+	0x09, 0x05, 0x0A, 0x05, 0x09, 0x14, 0x05, 0x1A, 0x0A, 0x05, 0x08, 0x05, 0x0A, 0x14, 0x05, 0x06,
+	0x0F, 0x04, 0x0C, 0x05, 0x06, 0x05, 0x0C, 0x13, 0x05, 0x06, 0x0F, 0x04, 0x0D, 0x05, 0x04, 0x05,
+	0x0D, 0x13, 0x05, 0x06, 0x0F, 0x04, 0x0E, 0x05, 0x02, 0x05, 0x0E, 0x13, 0x05, 0x06, 0x0F, 0x04,
+	0x0F, 0x0A, 0x0F, 0x13, 0x05, 0x06, 0x0F, 0x04, 0x10, 0x08, 0x10, 0x13, 0x05, 0x06, 0x0F, 0x04,
+	0x11, 0x06, 0x11, 0x13, 0x05, 0x0F, 0x06, 0x04, 0x11, 0x06, 0x11, 0x13, 0x05, 0x0F, 0x06, 0x04,
+	0x10, 0x08, 0x10, 0x13, 0x05, 0x0F, 0x06, 0x04, 0x0F, 0x0A, 0x0F, 0x13, 0x05, 0x0F, 0x06, 0x04,
+	0x0E, 0x05, 0x02, 0x05, 0x0E, 0x13, 0x05, 0x0F, 0x06, 0x04, 0x0D, 0x05, 0x04, 0x05, 0x0D, 0x13,
+	0x05, 0x0F, 0x06, 0x04, 0x0C, 0x05, 0x06, 0x05, 0x0C, 0x13, 0x05, 0x0F, 0x06, 0x05, 0x0A, 0x05,
+	0x08, 0x05, 0x0A, 0x14, 0x05, 0x0F, 0x06, 0x05, 0x09, 0x05, 0x0A, 0x05, 0x09, 0x14, 0x05, 0x0F,
+	0x06, 0x05, 0x08, 0x05, 0x0C, 0x05, 0x07, 0x15, 0x05, 0x07, 0x10, 0x04, 0x07, 0x04, 0x0E, 0x04,
+	0x07, 0x15, 0x05, 0x06, 0x11, 0x04, 0x07, 0x03, 0x10, 0x02, 0x07, 0x16, 0x05, 0x06, 0x12, 0x04,
+	0x22, 0x16, 0x05, 0x06, 0x12, 0x05, 0x20, 0x17, 0x05, 0x06, 0x13, 0x05, 0x1E, 0x19, 0x03, 0x09,
+	0x12, 0x05, 0x1C, 0x3E, 0x1A, 0x40, 0x18, 0x43, 0x14, 0x47, 0x10, 0x10, 0x3B, 0x0C, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x15, 0x01, 0x56, 0x05, 0x53, 0x07, 0x52, 0x07, 0x51, 0x09, 0x4F, 0x0B, 0x4E, 0x0B,
+	0x4D, 0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x49, 0x11, 0x47, 0x13, 0x46, 0x13, 0x46, 0x13, 0x47, 0x11,
+	0x4E, 0x05, 0x0C, 0x0D, 0x3B, 0x05, 0x0B, 0x10, 0x39, 0x05, 0x0B, 0x10, 0x39, 0x05, 0x0A, 0x11,
+	0x39, 0x05, 0x0A, 0x11, 0x39, 0x05, 0x0A, 0x11, 0x25, 0x06, 0x0E, 0x05, 0x0A, 0x06, 0x06, 0x05,
+	0x23, 0x0A, 0x0C, 0x05, 0x0A, 0x06, 0x06, 0x05, 0x22, 0x0C, 0x0B, 0x05, 0x0A, 0x06, 0x06, 0x05,
+	0x21, 0x0E, 0x0A, 0x05, 0x0A, 0x06, 0x06, 0x05, 0x20, 0x10, 0x09, 0x05, 0x0A, 0x06, 0x06, 0x05,
+	0x20, 0x07, 0x02, 0x07, 0x09, 0x05, 0x0A, 0x11, 0x20, 0x06, 0x04, 0x06, 0x09, 0x05, 0x0A, 0x11,
+	0x20, 0x05, 0x06, 0x05, 0x09, 0x05, 0x0A, 0x11, 0x20, 0x05, 0x06, 0x05, 0x09, 0x05, 0x0B, 0x10,
+	0x20, 0x06, 0x04, 0x06, 0x09, 0x05, 0x0B, 0x10, 0x20, 0x07, 0x03, 0x06, 0x09, 0x05, 0x0C, 0x0E,
+	0x21, 0x10, 0x09, 0x05, 0x10, 0x06, 0x26, 0x0E, 0x0A, 0x05, 0x10, 0x06, 0x27, 0x0D, 0x0A, 0x05,
+	0x10, 0x06, 0x28, 0x0B, 0x0B, 0x05, 0x10, 0x06, 0x29, 0x08, 0x0D, 0x05, 0x10, 0x05, 0x2B, 0x06,
+	0x0E, 0x05, 0x0F, 0x06, 0x2B, 0x06, 0x0E, 0x05, 0x0E, 0x07, 0x2B, 0x06, 0x0E, 0x05, 0x03, 0x11,
+	0x2C, 0x06, 0x0E, 0x19, 0x2C, 0x06, 0x0E, 0x18, 0x2D, 0x06, 0x0E, 0x17, 0x2F, 0x06, 0x0D, 0x16,
+	0x30, 0x08, 0x0B, 0x13, 0x34, 0x10, 0x02, 0x08, 0x3F, 0x18, 0x42, 0x17, 0x43, 0x15, 0x46, 0x13,
+	0x4F, 0x0A, 0x52, 0x07, 0x53, 0x06, 0x53, 0x06, 0x53, 0x06, 0x51, 0x0B, 0x4D, 0x0D, 0x4A, 0x11,
+	0x48, 0x11, 0x47, 0x13, 0x45, 0x07, 0x07, 0x07, 0x44, 0x06, 0x09, 0x06, 0x44, 0x06, 0x09, 0x06,
+	0x44, 0x05, 0x0B, 0x05, 0x43, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06,
+	0x43, 0x05, 0x0B, 0x05, 0x44, 0x06, 0x09, 0x06, 0x44, 0x07, 0x07, 0x07, 0x45, 0x07, 0x05, 0x07,
+	0x46, 0x13, 0x47, 0x11, 0x49, 0x0F, 0x4B, 0x0D, 0x4E, 0x09, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x93, 0x04, 0x54, 0x06, 0x53, 0x07, 0x52, 0x08, 0x51, 0x09, 0x50, 0x0A, 0x4F,
+	0x0B, 0x4E, 0x0C, 0x4D, 0x0D, 0x4C, 0x0E, 0x4B, 0x06, 0x01, 0x08, 0x4A, 0x06, 0x02, 0x08, 0x49,
+	0x06, 0x03, 0x08, 0x48, 0x06, 0x04, 0x08, 0x22, 0x2B, 0x05, 0x08, 0x20, 0x2C, 0x06, 0x08, 0x1E,
+	0x2D, 0x07, 0x08, 0x1D, 0x2D, 0x08, 0x08, 0x1C, 0x2C, 0x0A, 0x08, 0x1B, 0x2B, 0x0C, 0x08, 0x1A,
+	0x06, 0x32, 0x08, 0x19, 0x06, 0x33, 0x08, 0x18, 0x06, 0x34, 0x08, 0x17, 0x06, 0x35, 0x08, 0x16,
+	0x06, 0x36, 0x07, 0x16, 0x06, 0x35, 0x08, 0x16, 0x06, 0x35, 0x07, 0x17, 0x06, 0x34, 0x07, 0x18,
+	0x06, 0x33, 0x07, 0x19, 0x06, 0x32, 0x07, 0x1A, 0x06, 0x31, 0x07, 0x1B, 0x2B, 0x0B, 0x08, 0x1B,
+	0x2C, 0x09, 0x08, 0x1C, 0x2D, 0x07, 0x08, 0x1D, 0x2D, 0x06, 0x08, 0x1F, 0x2C, 0x05, 0x08, 0x21,
+	0x2B, 0x04, 0x08, 0x47, 0x06, 0x03, 0x08, 0x48, 0x06, 0x02, 0x08, 0x49, 0x06, 0x02, 0x07, 0x4A,
+	0x06, 0x01, 0x07, 0x4B, 0x0D, 0x4C, 0x0C, 0x4D, 0x0B, 0x4E, 0x0B, 0x4E, 0x0A, 0x4F, 0x09, 0x50,
+	0x08, 0x51, 0x07, 0x52, 0x06, 0x54, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x04, 0x54, 0x06, 0x52, 0x07, 0x51, 0x08, 0x50, 0x09, 0x4E, 0x0B,
+	0x4D, 0x0C, 0x4C, 0x0D, 0x4B, 0x0E, 0x4A, 0x08, 0x01, 0x06, 0x49, 0x08, 0x02, 0x06, 0x48, 0x08,
+	0x03, 0x06, 0x47, 0x08, 0x04, 0x06, 0x46, 0x08, 0x05, 0x06, 0x44, 0x09, 0x06, 0x06, 0x43, 0x09,
+	0x07, 0x06, 0x42, 0x09, 0x08, 0x2D, 0x1A, 0x08, 0x0A, 0x2E, 0x18, 0x08, 0x0B, 0x2E, 0x17, 0x08,
+	0x0C, 0x2F, 0x15, 0x08, 0x0E, 0x2E, 0x14, 0x08, 0x10, 0x2D, 0x13, 0x08, 0x38, 0x06, 0x11, 0x09,
+	0x39, 0x06, 0x10, 0x09, 0x3A, 0x06, 0x0F, 0x09, 0x3B, 0x06, 0x0F, 0x07, 0x3D, 0x06, 0x0E, 0x08,
+	0x3D, 0x06, 0x0F, 0x07, 0x3D, 0x06, 0x0F, 0x09, 0x3B, 0x06, 0x10, 0x09, 0x3A, 0x06, 0x11, 0x09,
+	0x39, 0x06, 0x13, 0x08, 0x38, 0x06, 0x14, 0x08, 0x10, 0x2D, 0x15, 0x08, 0x0E, 0x2E, 0x16, 0x08,
+	0x0C, 0x2F, 0x17, 0x08, 0x0B, 0x2E, 0x19, 0x08, 0x0A, 0x2E, 0x1A, 0x09, 0x08, 0x2C, 0x1D, 0x09,
+	0x07, 0x06, 0x44, 0x09, 0x06, 0x06, 0x46, 0x08, 0x05, 0x06, 0x47, 0x08, 0x04, 0x06, 0x48, 0x08,
+	0x03, 0x06, 0x49, 0x08, 0x02, 0x06, 0x4A, 0x08, 0x01, 0x06, 0x4B, 0x0E, 0x4C, 0x0D, 0x4D, 0x0C,
+	0x4E, 0x0B, 0x50, 0x09, 0x51, 0x08, 0x52, 0x07, 0x53, 0x06, 0x54, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x11, 0x46, 0x15, 0x43, 0x17, 0x42, 0x17, 0x42, 0x17, 0x42,
+	0x17, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B,
+	0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B,
+	0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B,
+	0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B,
+	0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B,
+	0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B,
+	0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B,
+	0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B,
+	0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x33, 0x15, 0x0B,
+	0x15, 0x23, 0x16, 0x0B, 0x16, 0x22, 0x16, 0x0B, 0x16, 0x22, 0x16, 0x0B, 0x16, 0x22, 0x15, 0x0D,
+	0x15, 0x23, 0x13, 0x0F, 0x13, 0x25, 0x07, 0x25, 0x07, 0x27, 0x07, 0x23, 0x07, 0x29, 0x07, 0x21,
+	0x07, 0x2B, 0x07, 0x1F, 0x07, 0x2C, 0x08, 0x1D, 0x08, 0x2D, 0x08, 0x1B, 0x08, 0x2F, 0x08, 0x19,
+	0x08, 0x31, 0x08, 0x17, 0x08, 0x33, 0x08, 0x15, 0x08, 0x35, 0x07, 0x15, 0x07, 0x37, 0x07, 0x13,
+	0x07, 0x39, 0x07, 0x11, 0x07, 0x3B, 0x07, 0x0F, 0x07, 0x3D, 0x07, 0x0D, 0x07, 0x3E, 0x08, 0x0B,
+	0x08, 0x3F, 0x08, 0x09, 0x08, 0x41, 0x08, 0x07, 0x08, 0x43, 0x08, 0x05, 0x08, 0x45, 0x08, 0x03,
+	0x08, 0x47, 0x07, 0x03, 0x07, 0x49, 0x0F, 0x4B, 0x0D, 0x4D, 0x0B, 0x4F, 0x09, 0x50, 0x09, 0x51,
+	0x07, 0x53, 0x05, 0x56, 0x01, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x01, 0x56, 0x05, 0x53, 0x07,
+	0x51, 0x09, 0x50, 0x09, 0x4F, 0x0B, 0x4D, 0x0D, 0x4B, 0x0F, 0x49, 0x07, 0x03, 0x07, 0x47, 0x08,
+	0x03, 0x08, 0x45, 0x08, 0x05, 0x08, 0x43, 0x08, 0x07, 0x08, 0x41, 0x08, 0x09, 0x08, 0x3F, 0x08,
+	0x0B, 0x08, 0x3E, 0x07, 0x0D, 0x07, 0x3D, 0x07, 0x0F, 0x07, 0x3B, 0x07, 0x11, 0x07, 0x39, 0x07,
+	0x13, 0x07, 0x37, 0x07, 0x15, 0x07, 0x35, 0x08, 0x15, 0x08, 0x33, 0x08, 0x17, 0x08, 0x31, 0x08,
+	0x19, 0x08, 0x2F, 0x08, 0x1B, 0x08, 0x2D, 0x08, 0x1D, 0x08, 0x2C, 0x07, 0x1F, 0x07, 0x2B, 0x07,
+	0x21, 0x07, 0x29, 0x07, 0x23, 0x07, 0x27, 0x07, 0x25, 0x07, 0x25, 0x13, 0x0F, 0x13, 0x23, 0x15,
+	0x0D, 0x15, 0x22, 0x16, 0x0B, 0x16, 0x22, 0x16, 0x0B, 0x16, 0x22, 0x16, 0x0B, 0x16, 0x23, 0x15,
+	0x0B, 0x15, 0x33, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06,
+	0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06,
+	0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06,
+	0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06,
+	0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06,
+	0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06,
+	0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06,
+	0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06,
+	0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x17,
+	0x42, 0x17, 0x42, 0x17, 0x42, 0x17, 0x43, 0x15, 0x46, 0x11, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0x42,
+	0x07, 0x50, 0x0B, 0x4D, 0x0E, 0x4A, 0x11, 0x48, 0x12, 0x46, 0x07, 0x03, 0x0B, 0x44, 0x06, 0x05,
+	0x0C, 0x42, 0x06, 0x07, 0x0C, 0x40, 0x06, 0x09, 0x0C, 0x3E, 0x06, 0x0B, 0x0B, 0x3D, 0x06, 0x0D,
+	0x0B, 0x3B, 0x06, 0x0F, 0x0B, 0x39, 0x06, 0x10, 0x0C, 0x37, 0x06, 0x12, 0x0C, 0x35, 0x06, 0x14,
+	0x0B, 0x34, 0x06, 0x16, 0x0B, 0x32, 0x06, 0x18, 0x0B, 0x30, 0x06, 0x19, 0x0C, 0x2E, 0x06, 0x1B,
+	0x0C, 0x2C, 0x06, 0x1D, 0x0B, 0x2B, 0x06, 0x1F, 0x0B, 0x29, 0x06, 0x21, 0x0B, 0x27, 0x06, 0x22,
+	0x0C, 0x25, 0x06, 0x24, 0x0C, 0x23, 0x06, 0x26, 0x0C, 0x21, 0x06, 0x28, 0x0B, 0x20, 0x06, 0x2A,
+	0x0B, 0x1E, 0x06, 0x2B, 0x0C, 0x1C, 0x06, 0x2D, 0x0C, 0x1A, 0x06, 0x2F, 0x0B, 0x19, 0x06, 0x31,
+	0x0B, 0x17, 0x06, 0x33, 0x0A, 0x16, 0x06, 0x34, 0x09, 0x16, 0x06, 0x36, 0x08, 0x15, 0x06, 0x38,
+	0x06, 0x15, 0x06, 0x39, 0x05, 0x15, 0x06, 0x39, 0x05, 0x15, 0x06, 0x38, 0x06, 0x15, 0x06, 0x38,
+	0x06, 0x15, 0x06, 0x36, 0x08, 0x15, 0x06, 0x34, 0x09, 0x16, 0x06, 0x33, 0x0A, 0x16, 0x06, 0x31,
+	0x0B, 0x17, 0x06, 0x2F, 0x0B, 0x19, 0x06, 0x2D, 0x0C, 0x1A, 0x06, 0x2B, 0x0C, 0x1C, 0x06, 0x2A,
+	0x0B, 0x1E, 0x06, 0x28, 0x0B, 0x20, 0x06, 0x26, 0x0C, 0x21, 0x06, 0x24, 0x0C, 0x23, 0x06, 0x22,
+	0x0C, 0x25, 0x06, 0x21, 0x0B, 0x27, 0x06, 0x1F, 0x0B, 0x29, 0x06, 0x1D, 0x0B, 0x2B, 0x06, 0x1B,
+	0x0C, 0x2C, 0x06, 0x19, 0x0C, 0x2E, 0x06, 0x18, 0x0B, 0x30, 0x06, 0x16, 0x0B, 0x32, 0x06, 0x14,
+	0x0B, 0x34, 0x06, 0x12, 0x0C, 0x35, 0x06, 0x10, 0x0C, 0x37, 0x06, 0x0F, 0x0B, 0x39, 0x06, 0x0D,
+	0x0B, 0x3B, 0x06, 0x0B, 0x0B, 0x3D, 0x06, 0x09, 0x0C, 0x3E, 0x06, 0x07, 0x0C, 0x40, 0x06, 0x05,
+	0x0C, 0x42, 0x07, 0x03, 0x0B, 0x45, 0x12, 0x47, 0x11, 0x49, 0x0E, 0x4C, 0x0B, 0x50, 0x07, 0xFF,
+	0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x0D, 0x1B, 0x0D, 0x21, 0x12, 0x17, 0x12, 0x1D, 0x14, 0x15,
+	0x14, 0x1B, 0x16, 0x13, 0x16, 0x19, 0x18, 0x11, 0x18, 0x18, 0x18, 0x11, 0x18, 0x17, 0x07, 0x0C,
+	0x07, 0x0F, 0x07, 0x0C, 0x07, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E,
+	0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x0E, 0x06, 0x16, 0x07, 0x0C,
+	0x07, 0x0F, 0x07, 0x0C, 0x07, 0x17, 0x18, 0x11, 0x18, 0x18, 0x18, 0x11, 0x18, 0x19, 0x16, 0x13,
+	0x16, 0x1B, 0x14, 0x15, 0x14, 0x1D, 0x12, 0x17, 0x12, 0x21, 0x0D, 0x1B, 0x0D, 0xFF, 0xD0, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xB4, 0x03, 0x54, 0x07, 0x51, 0x09, 0x4F, 0x0B, 0x4D, 0x0D, 0x4B, 0x0F, 0x49,
+	0x07, 0x03, 0x07, 0x47, 0x08, 0x03, 0x08, 0x45, 0x08, 0x05, 0x08, 0x44, 0x07, 0x07, 0x07, 0x43,
+	0x07, 0x09, 0x07, 0x41, 0x07, 0x0B, 0x07, 0x3F, 0x07, 0x0D, 0x07, 0x3D, 0x08, 0x0D, 0x08, 0x3B,
+	0x08, 0x0F, 0x08, 0x3A, 0x07, 0x11, 0x07, 0x39, 0x07, 0x13, 0x07, 0x37, 0x07, 0x15, 0x07, 0x35,
+	0x07, 0x17, 0x07, 0x33, 0x08, 0x17, 0x08, 0x31, 0x08, 0x19, 0x08, 0x30, 0x07, 0x1B, 0x07, 0x2F,
+	0x07, 0x1D, 0x07, 0x2D, 0x07, 0x1F, 0x07, 0x2B, 0x07, 0x21, 0x07, 0x29, 0x08, 0x21, 0x08, 0x27,
+	0x08, 0x23, 0x08, 0x26, 0x07, 0x25, 0x07, 0x25, 0x07, 0x27, 0x07, 0x23, 0x07, 0x29, 0x07, 0x21,
+	0x07, 0x2B, 0x07, 0x1F, 0x08, 0x2B, 0x08, 0x1D, 0x08, 0x2D, 0x08, 0x1C, 0x07, 0x2F, 0x07, 0x1B,
+	0x07, 0x31, 0x07, 0x19, 0x07, 0x33, 0x07, 0x18, 0x06, 0x35, 0x06, 0x18, 0x06, 0x35, 0x06, 0x18,
+	0x05, 0x37, 0x05, 0x18, 0x41, 0x18, 0x41, 0x19, 0x3F, 0x1A, 0x3F, 0x1B, 0x3D, 0x1E, 0x39, 0xFF,
+	0xFF, 0x92, 0x37, 0x20, 0x3B, 0x1D, 0x3D, 0x1B, 0x3F, 0x19, 0x41, 0x18, 0x41, 0x17, 0x07, 0x35,
+	0x07, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37,
+	0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x07, 0x35, 0x07, 0x17, 0x41, 0x18, 0x41, 0x19, 0x3F, 0x1B,
+	0x3D, 0x1D, 0x3B, 0x21, 0x35, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x04, 0x20, 0x03,
+	0x30, 0x08, 0x1B, 0x08, 0x2D, 0x0A, 0x19, 0x0A, 0x2B, 0x0C, 0x18, 0x0B, 0x2A, 0x0D, 0x16, 0x0E,
+	0x28, 0x0F, 0x14, 0x0F, 0x26, 0x06, 0x02, 0x09, 0x13, 0x05, 0x02, 0x09, 0x25, 0x06, 0x03, 0x09,
+	0x12, 0x05, 0x04, 0x08, 0x24, 0x06, 0x05, 0x08, 0x11, 0x05, 0x05, 0x08, 0x23, 0x06, 0x06, 0x08,
+	0x10, 0x05, 0x06, 0x09, 0x21, 0x06, 0x07, 0x09, 0x0E, 0x05, 0x07, 0x09, 0x20, 0x06, 0x08, 0x09,
+	0x0D, 0x05, 0x08, 0x09, 0x1F, 0x06, 0x09, 0x09, 0x0C, 0x05, 0x0A, 0x08, 0x1E, 0x06, 0x0A, 0x09,
+	0x0B, 0x05, 0x0B, 0x08, 0x1D, 0x06, 0x0C, 0x08, 0x0A, 0x05, 0x0C, 0x09, 0x1B, 0x06, 0x0D, 0x09,
+	0x08, 0x05, 0x0D, 0x09, 0x1A, 0x06, 0x0E, 0x09, 0x07, 0x05, 0x0E, 0x09, 0x19, 0x06, 0x0F, 0x09,
+	0x06, 0x05, 0x0F, 0x09, 0x18, 0x06, 0x10, 0x09, 0x05, 0x05, 0x11, 0x08, 0x17, 0x06, 0x12, 0x08,
+	0x04, 0x05, 0x12, 0x09, 0x15, 0x06, 0x13, 0x08, 0x03, 0x05, 0x13, 0x09, 0x14, 0x06, 0x14, 0x09,
+	0x01, 0x05, 0x14, 0x09, 0x13, 0x06, 0x15, 0x0E, 0x15, 0x09, 0x12, 0x06, 0x16, 0x0D, 0x17, 0x08,
+	0x11, 0x06, 0x18, 0x0B, 0x18, 0x08, 0x10, 0x06, 0x19, 0x0A, 0x19, 0x09, 0x0E, 0x06, 0x1A, 0x09,
+	0x1A, 0x09, 0x0D, 0x06, 0x1B, 0x08, 0x1B, 0x09, 0x0C, 0x06, 0x1C, 0x07, 0x1C, 0x08, 0x0C, 0x06,
+	0x1D, 0x06, 0x1E, 0x07, 0x0B, 0x06, 0x1E, 0x05, 0x1F, 0x06, 0x0B, 0x06, 0x1E, 0x05, 0x1F, 0x06,
+	0x0B, 0x06, 0x1E, 0x05, 0x1F, 0x06, 0x0B, 0x06, 0x1D, 0x06, 0x1E, 0x07, 0x0B, 0x06, 0x1C, 0x07,
+	0x1C, 0x08, 0x0C, 0x06, 0x1B, 0x08, 0x1B, 0x09, 0x0C, 0x06, 0x1A, 0x09, 0x1A, 0x09, 0x0D, 0x06,
+	0x19, 0x0A, 0x19, 0x09, 0x0E, 0x06, 0x18, 0x0B, 0x18, 0x08, 0x10, 0x06, 0x16, 0x0D, 0x17, 0x08,
+	0x11, 0x06, 0x15, 0x0E, 0x15, 0x09, 0x12, 0x06, 0x14, 0x09, 0x01, 0x05, 0x14, 0x09, 0x13, 0x06,
+	0x13, 0x08, 0x03, 0x05, 0x13, 0x09, 0x14, 0x06, 0x12, 0x08, 0x04, 0x05, 0x12, 0x09, 0x15, 0x06,
+	0x10, 0x09, 0x05, 0x05, 0x11, 0x08, 0x17, 0x06, 0x0F, 0x09, 0x06, 0x05, 0x0F, 0x09, 0x18, 0x06,
+	0x0E, 0x09, 0x07, 0x05, 0x0E, 0x09, 0x19, 0x06, 0x0D, 0x09, 0x08, 0x05, 0x0D, 0x09, 0x1A, 0x06,
+	0x0C, 0x08, 0x0A, 0x05, 0x0C, 0x09, 0x1B, 0x06, 0x0A, 0x09, 0x0B, 0x05, 0x0B, 0x08, 0x1D, 0x06,
+	0x09, 0x09, 0x0C, 0x05, 0x0A, 0x08, 0x1E, 0x06, 0x08, 0x09, 0x0D, 0x05, 0x08, 0x09, 0x1F, 0x06,
+	0x07, 0x09, 0x0E, 0x05, 0x07, 0x09, 0x20, 0x06, 0x06, 0x08, 0x10, 0x05, 0x06, 0x09, 0x21, 0x06,
+	0x05, 0x08, 0x11, 0x05, 0x05, 0x08, 0x23, 0x06, 0x03, 0x09, 0x12, 0x05, 0x04, 0x08, 0x24, 0x06,
+	0x02, 0x09, 0x13, 0x05, 0x02, 0x09, 0x26, 0x0F, 0x14, 0x0F, 0x27, 0x0D, 0x16, 0x0E, 0x28, 0x0C,
+	0x18, 0x0B, 0x2B, 0x0A, 0x19, 0x0A, 0x2D, 0x08, 0x1B, 0x08, 0x30, 0x04, 0x20, 0x03, 0xFF, 0xFF,
+	0xFF, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x03, 0x20, 0x04, 0x30, 0x08, 0x1B, 0x08,
+	0x2D, 0x0A, 0x19, 0x0A, 0x2B, 0x0B, 0x18, 0x0C, 0x28, 0x0E, 0x16, 0x0D, 0x27, 0x0F, 0x14, 0x0F,
+	0x26, 0x09, 0x02, 0x05, 0x13, 0x09, 0x02, 0x06, 0x24, 0x08, 0x04, 0x05, 0x12, 0x09, 0x03, 0x06,
+	0x23, 0x08, 0x05, 0x05, 0x11, 0x09, 0x04, 0x06, 0x21, 0x09, 0x06, 0x05, 0x10, 0x08, 0x06, 0x06,
+	0x20, 0x09, 0x07, 0x05, 0x0E, 0x09, 0x07, 0x06, 0x1F, 0x09, 0x08, 0x05, 0x0D, 0x09, 0x08, 0x06,
+	0x1E, 0x09, 0x09, 0x05, 0x0C, 0x09, 0x09, 0x06, 0x1D, 0x08, 0x0B, 0x05, 0x0B, 0x09, 0x0A, 0x06,
+	0x1C, 0x08, 0x0C, 0x05, 0x0A, 0x08, 0x0C, 0x06, 0x1A, 0x09, 0x0D, 0x05, 0x09, 0x08, 0x0D, 0x06,
+	0x19, 0x09, 0x0E, 0x05, 0x07, 0x09, 0x0E, 0x06, 0x18, 0x09, 0x0F, 0x05, 0x06, 0x09, 0x0F, 0x06,
+	0x17, 0x08, 0x11, 0x05, 0x05, 0x09, 0x10, 0x06, 0x16, 0x08, 0x12, 0x05, 0x04, 0x08, 0x12, 0x06,
+	0x14, 0x09, 0x13, 0x05, 0x03, 0x08, 0x13, 0x06, 0x13, 0x09, 0x14, 0x05, 0x01, 0x09, 0x14, 0x06,
+	0x12, 0x09, 0x15, 0x0E, 0x15, 0x06, 0x11, 0x09, 0x16, 0x0D, 0x16, 0x06, 0x10, 0x08, 0x18, 0x0C,
+	0x17, 0x06, 0x0E, 0x09, 0x19, 0x0A, 0x19, 0x06, 0x0D, 0x09, 0x1A, 0x09, 0x1A, 0x06, 0x0C, 0x09,
+	0x1B, 0x08, 0x1B, 0x06, 0x0C, 0x08, 0x1C, 0x07, 0x1C, 0x06, 0x0B, 0x07, 0x1E, 0x06, 0x1D, 0x06,
+	0x0B, 0x06, 0x1F, 0x05, 0x1E, 0x06, 0x0B, 0x06, 0x1F, 0x05, 0x1E, 0x06, 0x0B, 0x06, 0x1F, 0x05,
+	0x1E, 0x06, 0x0B, 0x07, 0x1E, 0x06, 0x1D, 0x06, 0x0C, 0x08, 0x1C, 0x07, 0x1C, 0x06, 0x0C, 0x09,
+	0x1B, 0x08, 0x1B, 0x06, 0x0D, 0x09, 0x1A, 0x09, 0x1A, 0x06, 0x0E, 0x09, 0x19, 0x0A, 0x19, 0x06,
+	0x10, 0x08, 0x18, 0x0C, 0x17, 0x06, 0x11, 0x09, 0x16, 0x0D, 0x16, 0x06, 0x12, 0x09, 0x15, 0x0E,
+	0x15, 0x06, 0x13, 0x09, 0x14, 0x05, 0x01, 0x09, 0x14, 0x06, 0x14, 0x09, 0x13, 0x05, 0x03, 0x08,
+	0x13, 0x06, 0x16, 0x08, 0x12, 0x05, 0x04, 0x08, 0x12, 0x06, 0x17, 0x08, 0x11, 0x05, 0x05, 0x09,
+	0x10, 0x06, 0x18, 0x09, 0x0F, 0x05, 0x06, 0x09, 0x0F, 0x06, 0x19, 0x09, 0x0E, 0x05, 0x07, 0x09,
+	0x0E, 0x06, 0x1A, 0x09, 0x0D, 0x05, 0x09, 0x08, 0x0D, 0x06, 0x1C, 0x08, 0x0C, 0x05, 0x0A, 0x08,
+	0x0C, 0x06, 0x1D, 0x08, 0x0B, 0x05, 0x0B, 0x09, 0x0A, 0x06, 0x1E, 0x09, 0x09, 0x05, 0x0C, 0x09,
+	0x09, 0x06, 0x1F, 0x09, 0x08, 0x05, 0x0D, 0x09, 0x08, 0x06, 0x20, 0x09, 0x07, 0x05, 0x0E, 0x09,
+	0x07, 0x06, 0x21, 0x09, 0x06, 0x05, 0x10, 0x08, 0x06, 0x06, 0x23, 0x08, 0x05, 0x05, 0x11, 0x09,
+	0x04, 0x06, 0x24, 0x08, 0x04, 0x05, 0x12, 0x09, 0x03, 0x06, 0x25, 0x09, 0x02, 0x05, 0x13, 0x09,
+	0x02, 0x06, 0x26, 0x0F, 0x14, 0x0F, 0x28, 0x0E, 0x16, 0x0D, 0x2A, 0x0B, 0x18, 0x0C, 0x2B, 0x0A,
+	0x19, 0x0A, 0x2D, 0x08, 0x1B, 0x08, 0x30, 0x03, 0x20, 0x04, 0xFF, 0xFF, 0xFF, 0x30, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x4C, 0x03, 0x2D, 0x0A, 0x1D, 0x07, 0x29, 0x0D, 0x1B, 0x0A, 0x26, 0x0F, 0x19,
+	0x0D, 0x23, 0x11, 0x18, 0x0E, 0x22, 0x12, 0x16, 0x11, 0x1F, 0x13, 0x16, 0x06, 0x02, 0x0B, 0x1D,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x04, 0x0A, 0x1C, 0x06, 0x07, 0x06, 0x16, 0x06, 0x05, 0x0B, 0x1A,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x07, 0x0A, 0x19, 0x06, 0x07, 0x06, 0x16, 0x06, 0x08, 0x0B, 0x17,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x0A, 0x0B, 0x15, 0x06, 0x07, 0x06, 0x16, 0x06, 0x0C, 0x0A, 0x14,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x0D, 0x0B, 0x12, 0x06, 0x07, 0x06, 0x16, 0x06, 0x0F, 0x0B, 0x10,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x11, 0x0A, 0x0F, 0x06, 0x07, 0x06, 0x16, 0x06, 0x12, 0x0B, 0x0D,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x14, 0x0A, 0x0C, 0x06, 0x07, 0x06, 0x16, 0x06, 0x15, 0x0B, 0x0A,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x17, 0x0B, 0x08, 0x06, 0x07, 0x06, 0x16, 0x06, 0x19, 0x0A, 0x07,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x1A, 0x0B, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x1C, 0x0B, 0x03,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x1D, 0x0B, 0x02, 0x06, 0x07, 0x06, 0x16, 0x06, 0x1F, 0x11, 0x07,
+	0x06, 0x16, 0x06, 0x21, 0x0F, 0x07, 0x06, 0x16, 0x06, 0x22, 0x0E, 0x07, 0x06, 0x16, 0x06, 0x24,
+	0x0C, 0x07, 0x06, 0x16, 0x06, 0x26, 0x0A, 0x07, 0x06, 0x16, 0x06, 0x27, 0x09, 0x07, 0x06, 0x16,
+	0x06, 0x29, 0x07, 0x07, 0x06, 0x16, 0x06, 0x2A, 0x06, 0x07, 0x06, 0x16, 0x06, 0x2A, 0x06, 0x07,
+	0x06, 0x16, 0x06, 0x2A, 0x06, 0x07, 0x06, 0x16, 0x06, 0x2A, 0x06, 0x07, 0x06, 0x16, 0x06, 0x2A,
+	0x06, 0x07, 0x06, 0x16, 0x06, 0x29, 0x07, 0x07, 0x06, 0x16, 0x06, 0x27, 0x09, 0x07, 0x06, 0x16,
+	0x06, 0x26, 0x0A, 0x07, 0x06, 0x16, 0x06, 0x24, 0x0C, 0x07, 0x06, 0x16, 0x06, 0x22, 0x0E, 0x07,
+	0x06, 0x16, 0x06, 0x21, 0x0F, 0x07, 0x06, 0x16, 0x06, 0x1F, 0x11, 0x07, 0x06, 0x16, 0x06, 0x1D,
+	0x0B, 0x02, 0x06, 0x07, 0x06, 0x16, 0x06, 0x1C, 0x0B, 0x03, 0x06, 0x07, 0x06, 0x16, 0x06, 0x1A,
+	0x0B, 0x05, 0x06, 0x07, 0x06, 0x16, 0x06, 0x19, 0x0A, 0x07, 0x06, 0x07, 0x06, 0x16, 0x06, 0x17,
+	0x0B, 0x08, 0x06, 0x07, 0x06, 0x16, 0x06, 0x15, 0x0B, 0x0A, 0x06, 0x07, 0x06, 0x16, 0x06, 0x14,
+	0x0A, 0x0C, 0x06, 0x07, 0x06, 0x16, 0x06, 0x12, 0x0B, 0x0D, 0x06, 0x07, 0x06, 0x16, 0x06, 0x11,
+	0x0A, 0x0F, 0x06, 0x07, 0x06, 0x16, 0x06, 0x0F, 0x0B, 0x10, 0x06, 0x07, 0x06, 0x16, 0x06, 0x0D,
+	0x0B, 0x12, 0x06, 0x07, 0x06, 0x16, 0x06, 0x0C, 0x0A, 0x14, 0x06, 0x07, 0x06, 0x16, 0x06, 0x0A,
+	0x0B, 0x15, 0x06, 0x07, 0x06, 0x16, 0x06, 0x08, 0x0B, 0x17, 0x06, 0x07, 0x06, 0x16, 0x06, 0x07,
+	0x0A, 0x19, 0x06, 0x07, 0x06, 0x16, 0x06, 0x05, 0x0B, 0x1A, 0x06, 0x07, 0x06, 0x16, 0x06, 0x04,
+	0x0A, 0x1C, 0x06, 0x07, 0x06, 0x16, 0x06, 0x02, 0x0B, 0x1D, 0x06, 0x07, 0x06, 0x16, 0x11, 0x1F,
+	0x13, 0x17, 0x0E, 0x22, 0x12, 0x17, 0x0D, 0x23, 0x11, 0x19, 0x0A, 0x26, 0x0F, 0x1B, 0x07, 0x29,
+	0x0D, 0x1E, 0x03, 0x2D, 0x0A, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x0A, 0x2D,
+	0x03, 0x1E, 0x0D, 0x29, 0x07, 0x1B, 0x0F, 0x26, 0x0A, 0x19, 0x11, 0x23, 0x0D, 0x17, 0x12, 0x22,
+	0x0E, 0x17, 0x13, 0x1F, 0x11, 0x16, 0x06, 0x07, 0x06, 0x1D, 0x0B, 0x02, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x1C, 0x0B, 0x03, 0x06, 0x16, 0x06, 0x07, 0x06, 0x1A, 0x0B, 0x05, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x19, 0x0A, 0x07, 0x06, 0x16, 0x06, 0x07, 0x06, 0x17, 0x0B, 0x08, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x15, 0x0B, 0x0A, 0x06, 0x16, 0x06, 0x07, 0x06, 0x14, 0x0A, 0x0C, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x12, 0x0B, 0x0D, 0x06, 0x16, 0x06, 0x07, 0x06, 0x11, 0x0A, 0x0F, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x0F, 0x0B, 0x10, 0x06, 0x16, 0x06, 0x07, 0x06, 0x0D, 0x0B, 0x12, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x0C, 0x0A, 0x14, 0x06, 0x16, 0x06, 0x07, 0x06, 0x0A, 0x0B, 0x15, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x08, 0x0B, 0x17, 0x06, 0x16, 0x06, 0x07, 0x06, 0x07, 0x0A, 0x19, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x05, 0x0B, 0x1A, 0x06, 0x16, 0x06, 0x07, 0x06, 0x04, 0x0A, 0x1C, 0x06, 0x16, 0x06, 0x07,
+	0x06, 0x02, 0x0B, 0x1D, 0x06, 0x16, 0x06, 0x07, 0x11, 0x1F, 0x06, 0x16, 0x06, 0x07, 0x0F, 0x21,
+	0x06, 0x16, 0x06, 0x07, 0x0E, 0x22, 0x06, 0x16, 0x06, 0x07, 0x0C, 0x24, 0x06, 0x16, 0x06, 0x07,
+	0x0B, 0x25, 0x06, 0x16, 0x06, 0x07, 0x09, 0x27, 0x06, 0x16, 0x06, 0x07, 0x07, 0x29, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x2A, 0x06, 0x16, 0x06, 0x07, 0x06, 0x2A, 0x06, 0x16, 0x06, 0x07, 0x06, 0x2A,
+	0x06, 0x16, 0x06, 0x07, 0x06, 0x2A, 0x06, 0x16, 0x06, 0x07, 0x06, 0x2A, 0x06, 0x16, 0x06, 0x07,
+	0x07, 0x29, 0x06, 0x16, 0x06, 0x07, 0x09, 0x27, 0x06, 0x16, 0x06, 0x07, 0x0B, 0x25, 0x06, 0x16,
+	0x06, 0x07, 0x0C, 0x24, 0x06, 0x16, 0x06, 0x07, 0x0E, 0x22, 0x06, 0x16, 0x06, 0x07, 0x0F, 0x21,
+	0x06, 0x16, 0x06, 0x07, 0x11, 0x1F, 0x06, 0x16, 0x06, 0x07, 0x06, 0x02, 0x0B, 0x1D, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x04, 0x0A, 0x1C, 0x06, 0x16, 0x06, 0x07, 0x06, 0x05, 0x0B, 0x1A, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x07, 0x0A, 0x19, 0x06, 0x16, 0x06, 0x07, 0x06, 0x08, 0x0B, 0x17, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x0A, 0x0B, 0x15, 0x06, 0x16, 0x06, 0x07, 0x06, 0x0C, 0x0A, 0x14, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x0D, 0x0B, 0x12, 0x06, 0x16, 0x06, 0x07, 0x06, 0x0F, 0x0B, 0x10, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x11, 0x0A, 0x0F, 0x06, 0x16, 0x06, 0x07, 0x06, 0x12, 0x0B, 0x0D, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x14, 0x0A, 0x0C, 0x06, 0x16, 0x06, 0x07, 0x06, 0x15, 0x0B, 0x0A, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x17, 0x0B, 0x08, 0x06, 0x16, 0x06, 0x07, 0x06, 0x19, 0x0A, 0x07, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x1A, 0x0B, 0x05, 0x06, 0x16, 0x06, 0x07, 0x06, 0x1C, 0x0B, 0x03, 0x06, 0x16,
+	0x06, 0x07, 0x06, 0x1D, 0x0B, 0x02, 0x06, 0x16, 0x13, 0x1F, 0x11, 0x16, 0x12, 0x22, 0x0E, 0x18,
+	0x11, 0x23, 0x0D, 0x19, 0x0F, 0x26, 0x0A, 0x1B, 0x0D, 0x29, 0x07, 0x1D, 0x0A, 0x2D, 0x03, 0xFF,
+	0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x56, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05,
+	0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x49, 0x02, 0x09, 0x05, 0x08, 0x03,
+	0x3C, 0x06, 0x07, 0x05, 0x07, 0x06, 0x38, 0x08, 0x07, 0x05, 0x07, 0x08, 0x35, 0x09, 0x07, 0x05,
+	0x07, 0x09, 0x32, 0x0B, 0x07, 0x05, 0x07, 0x0B, 0x2F, 0x0B, 0x08, 0x05, 0x08, 0x0B, 0x2D, 0x0A,
+	0x0A, 0x05, 0x0A, 0x0A, 0x2B, 0x09, 0x0C, 0x05, 0x0C, 0x09, 0x29, 0x09, 0x0D, 0x05, 0x0D, 0x09,
+	0x27, 0x08, 0x0F, 0x05, 0x0F, 0x08, 0x25, 0x08, 0x10, 0x05, 0x10, 0x08, 0x24, 0x07, 0x11, 0x05,
+	0x11, 0x07, 0x23, 0x07, 0x12, 0x05, 0x12, 0x07, 0x21, 0x07, 0x13, 0x05, 0x13, 0x07, 0x20, 0x06,
+	0x14, 0x05, 0x14, 0x06, 0x1F, 0x07, 0x14, 0x05, 0x14, 0x07, 0x1E, 0x06, 0x15, 0x05, 0x15, 0x06,
+	0x1D, 0x06, 0x16, 0x05, 0x16, 0x06, 0x1C, 0x06, 0x16, 0x05, 0x16, 0x06, 0x1B, 0x06, 0x17, 0x05,
+	0x17, 0x06, 0x1A, 0x06, 0x17, 0x05, 0x17, 0x06, 0x1A, 0x05, 0x18, 0x05, 0x18, 0x05, 0x19, 0x06,
+	0x18, 0x05, 0x18, 0x06, 0x18, 0x06, 0x18, 0x05, 0x18, 0x06, 0x18, 0x06, 0x18, 0x05, 0x18, 0x06,
+	0x18, 0x05, 0x1B, 0x01, 0x1B, 0x05, 0x17, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06,
+	0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06,
+	0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x17, 0x05,
+	0x37, 0x05, 0x18, 0x05, 0x37, 0x05, 0x18, 0x06, 0x35, 0x06, 0x18, 0x06, 0x35, 0x06, 0x18, 0x06,
+	0x35, 0x06, 0x19, 0x06, 0x33, 0x06, 0x1A, 0x06, 0x33, 0x06, 0x1A, 0x07, 0x31, 0x07, 0x1B, 0x06,
+	0x31, 0x06, 0x1C, 0x07, 0x2F, 0x07, 0x1D, 0x06, 0x2F, 0x06, 0x1E, 0x07, 0x2D, 0x07, 0x1F, 0x07,
+	0x2B, 0x07, 0x21, 0x07, 0x29, 0x07, 0x22, 0x07, 0x29, 0x07, 0x23, 0x08, 0x26, 0x07, 0x25, 0x08,
+	0x23, 0x08, 0x27, 0x08, 0x21, 0x08, 0x29, 0x08, 0x1F, 0x08, 0x2B, 0x09, 0x1B, 0x09, 0x2D, 0x0A,
+	0x17, 0x0A, 0x2F, 0x0C, 0x11, 0x0C, 0x31, 0x0E, 0x0B, 0x0E, 0x34, 0x23, 0x38, 0x1F, 0x3C, 0x1B,
+	0x40, 0x17, 0x45, 0x11, 0x4F, 0x03, 0xFF, 0x37, 0xFF, 0xFF, 0xFF, 0xA8, 0x03, 0x4F, 0x11, 0x46,
+	0x15, 0x44, 0x15, 0x44, 0x15, 0x44, 0x15, 0x44, 0x06, 0x09, 0x06, 0x44, 0x05, 0x0B, 0x05, 0x43,
+	0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x33, 0x03, 0x0B, 0x07, 0x0B,
+	0x06, 0x32, 0x06, 0x09, 0x06, 0x0D, 0x06, 0x0A, 0x05, 0x21, 0x09, 0x05, 0x08, 0x0D, 0x07, 0x06,
+	0x08, 0x20, 0x16, 0x0E, 0x16, 0x1F, 0x15, 0x10, 0x16, 0x1D, 0x16, 0x11, 0x16, 0x1B, 0x16, 0x13,
+	0x15, 0x1B, 0x07, 0x03, 0x0A, 0x16, 0x0C, 0x02, 0x07, 0x19, 0x07, 0x07, 0x04, 0x1C, 0x07, 0x05,
+	0x07, 0x18, 0x06, 0x35, 0x06, 0x17, 0x06, 0x36, 0x07, 0x16, 0x06, 0x37, 0x06, 0x15, 0x06, 0x18,
+	0x09, 0x17, 0x07, 0x14, 0x06, 0x15, 0x0F, 0x15, 0x06, 0x13, 0x07, 0x14, 0x11, 0x14, 0x06, 0x13,
+	0x06, 0x14, 0x13, 0x14, 0x06, 0x12, 0x08, 0x11, 0x15, 0x12, 0x07, 0x12, 0x09, 0x0F, 0x09, 0x05,
+	0x09, 0x10, 0x08, 0x13, 0x09, 0x0D, 0x08, 0x09, 0x08, 0x0D, 0x0A, 0x14, 0x09, 0x0B, 0x07, 0x0D,
+	0x07, 0x0B, 0x09, 0x18, 0x08, 0x0A, 0x06, 0x0F, 0x06, 0x0B, 0x08, 0x1A, 0x07, 0x0A, 0x06, 0x0F,
+	0x06, 0x0A, 0x08, 0x1C, 0x07, 0x08, 0x06, 0x11, 0x06, 0x09, 0x06, 0x1F, 0x06, 0x08, 0x06, 0x11,
+	0x06, 0x08, 0x06, 0x20, 0x06, 0x08, 0x05, 0x13, 0x05, 0x08, 0x06, 0x21, 0x05, 0x08, 0x05, 0x13,
+	0x05, 0x08, 0x06, 0x21, 0x05, 0x08, 0x05, 0x13, 0x05, 0x08, 0x05, 0x21, 0x06, 0x08, 0x05, 0x13,
+	0x05, 0x08, 0x05, 0x21, 0x06, 0x08, 0x05, 0x13, 0x05, 0x08, 0x06, 0x20, 0x06, 0x08, 0x06, 0x11,
+	0x06, 0x08, 0x06, 0x1F, 0x06, 0x09, 0x06, 0x11, 0x06, 0x08, 0x07, 0x1C, 0x08, 0x0A, 0x06, 0x0F,
+	0x06, 0x0A, 0x07, 0x1A, 0x08, 0x0B, 0x06, 0x0F, 0x06, 0x0A, 0x08, 0x18, 0x09, 0x0B, 0x07, 0x0D,
+	0x06, 0x0C, 0x09, 0x14, 0x0A, 0x0D, 0x08, 0x09, 0x08, 0x0D, 0x09, 0x13, 0x08, 0x10, 0x09, 0x05,
+	0x09, 0x0F, 0x09, 0x12, 0x07, 0x12, 0x15, 0x11, 0x08, 0x12, 0x06, 0x14, 0x13, 0x14, 0x06, 0x13,
+	0x06, 0x14, 0x11, 0x14, 0x07, 0x13, 0x06, 0x15, 0x0E, 0x16, 0x06, 0x14, 0x07, 0x17, 0x09, 0x18,
+	0x06, 0x15, 0x06, 0x37, 0x06, 0x16, 0x07, 0x36, 0x06, 0x17, 0x06, 0x35, 0x06, 0x18, 0x07, 0x05,
+	0x07, 0x1C, 0x04, 0x07, 0x07, 0x19, 0x07, 0x02, 0x0C, 0x16, 0x0A, 0x03, 0x07, 0x1B, 0x15, 0x13,
+	0x16, 0x1B, 0x16, 0x11, 0x16, 0x1D, 0x16, 0x0F, 0x16, 0x1F, 0x16, 0x0E, 0x16, 0x20, 0x08, 0x06,
+	0x07, 0x0D, 0x08, 0x05, 0x09, 0x21, 0x05, 0x0A, 0x06, 0x0D, 0x06, 0x09, 0x06, 0x32, 0x06, 0x0B,
+	0x07, 0x0B, 0x03, 0x33, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x06, 0x0B, 0x06, 0x43,
+	0x05, 0x0B, 0x05, 0x44, 0x09, 0x03, 0x09, 0x44, 0x15, 0x44, 0x15, 0x44, 0x15, 0x45, 0x13, 0x49,
+	0x0D, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x07, 0x4E, 0x0F, 0x47, 0x15, 0x42, 0x19, 0x3F,
+	0x1B, 0x3C, 0x1E, 0x3A, 0x0C, 0x09, 0x0C, 0x37, 0x0A, 0x0F, 0x09, 0x36, 0x09, 0x13, 0x08, 0x35,
+	0x07, 0x16, 0x06, 0x35, 0x07, 0x19, 0x04, 0x34, 0x07, 0x51, 0x07, 0x52, 0x06, 0x52, 0x07, 0x52,
+	0x06, 0x24, 0x03, 0x2C, 0x06, 0x23, 0x05, 0x2A, 0x06, 0x23, 0x07, 0x29, 0x06, 0x22, 0x09, 0x28,
+	0x06, 0x21, 0x0B, 0x27, 0x05, 0x21, 0x0D, 0x26, 0x05, 0x20, 0x0F, 0x24, 0x06, 0x1F, 0x11, 0x23,
+	0x06, 0x1E, 0x13, 0x22, 0x06, 0x1D, 0x15, 0x21, 0x06, 0x1C, 0x08, 0x01, 0x06, 0x01, 0x07, 0x20,
+	0x06, 0x1B, 0x08, 0x02, 0x06, 0x02, 0x07, 0x1F, 0x06, 0x1A, 0x08, 0x03, 0x06, 0x02, 0x08, 0x1E,
+	0x06, 0x1A, 0x07, 0x04, 0x06, 0x03, 0x08, 0x1D, 0x06, 0x1A, 0x06, 0x05, 0x06, 0x04, 0x07, 0x1D,
+	0x06, 0x1A, 0x05, 0x06, 0x06, 0x05, 0x05, 0x1E, 0x06, 0x1B, 0x03, 0x07, 0x06, 0x07, 0x02, 0x1F,
+	0x06, 0x25, 0x06, 0x28, 0x06, 0x25, 0x06, 0x28, 0x06, 0x25, 0x06, 0x28, 0x06, 0x25, 0x06, 0x28,
+	0x06, 0x25, 0x06, 0x28, 0x06, 0x25, 0x06, 0x28, 0x06, 0x25, 0x06, 0x1F, 0x02, 0x07, 0x06, 0x07,
+	0x03, 0x1B, 0x06, 0x1E, 0x05, 0x05, 0x06, 0x06, 0x05, 0x1A, 0x06, 0x1D, 0x07, 0x04, 0x06, 0x05,
+	0x06, 0x1A, 0x06, 0x1D, 0x08, 0x03, 0x06, 0x04, 0x07, 0x1A, 0x06, 0x1E, 0x08, 0x02, 0x06, 0x03,
+	0x08, 0x1A, 0x06, 0x1F, 0x08, 0x01, 0x06, 0x02, 0x08, 0x1B, 0x06, 0x20, 0x0E, 0x01, 0x08, 0x1C,
+	0x06, 0x21, 0x15, 0x1D, 0x06, 0x22, 0x13, 0x1E, 0x06, 0x23, 0x11, 0x1F, 0x06, 0x24, 0x0F, 0x20,
+	0x05, 0x26, 0x0D, 0x21, 0x05, 0x27, 0x0B, 0x21, 0x06, 0x28, 0x09, 0x22, 0x06, 0x29, 0x07, 0x23,
+	0x06, 0x2A, 0x05, 0x23, 0x06, 0x2C, 0x03, 0x24, 0x06, 0x52, 0x06, 0x53, 0x06, 0x52, 0x06, 0x52,
+	0x07, 0x34, 0x04, 0x19, 0x07, 0x35, 0x06, 0x16, 0x07, 0x35, 0x08, 0x13, 0x09, 0x36, 0x09, 0x0F,
+	0x0A, 0x37, 0x0C, 0x09, 0x0C, 0x3A, 0x1E, 0x3C, 0x1B, 0x3F, 0x19, 0x42, 0x15, 0x47, 0x0F, 0x4E,
+	0x07, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x03, 0x55, 0x05, 0x54, 0x05, 0x54,
+	0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54,
+	0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54,
+	0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54,
+	0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x4A,
+	0x02, 0x08, 0x05, 0x08, 0x02, 0x3F, 0x05, 0x06, 0x05, 0x06, 0x05, 0x3E, 0x06, 0x05, 0x05, 0x05,
+	0x06, 0x3E, 0x07, 0x04, 0x05, 0x04, 0x07, 0x3E, 0x08, 0x03, 0x05, 0x03, 0x08, 0x3F, 0x08, 0x02,
+	0x05, 0x02, 0x08, 0x41, 0x08, 0x01, 0x05, 0x01, 0x08, 0x43, 0x15, 0x45, 0x13, 0x47, 0x11, 0x49,
+	0x0F, 0x4B, 0x0D, 0x18, 0x01, 0x19, 0x04, 0x17, 0x0B, 0x17, 0x04, 0x17, 0x06, 0x17, 0x09, 0x17,
+	0x06, 0x16, 0x06, 0x18, 0x07, 0x18, 0x06, 0x16, 0x06, 0x19, 0x05, 0x19, 0x06, 0x16, 0x06, 0x1A,
+	0x03, 0x1A, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16,
+	0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x17,
+	0x06, 0x35, 0x06, 0x18, 0x07, 0x33, 0x07, 0x18, 0x41, 0x19, 0x3F, 0x1B, 0x3D, 0x1D, 0x3B, 0x1F,
+	0x39, 0x23, 0x33, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x29, 0x2D, 0x2D, 0x2B, 0x2F,
+	0x29, 0x31, 0x27, 0x33, 0x25, 0x36, 0x23, 0x07, 0x05, 0x06, 0x18, 0x0D, 0x22, 0x06, 0x06, 0x06,
+	0x18, 0x0E, 0x20, 0x06, 0x07, 0x06, 0x18, 0x05, 0x01, 0x09, 0x1F, 0x06, 0x07, 0x06, 0x18, 0x05,
+	0x03, 0x08, 0x1E, 0x06, 0x07, 0x06, 0x18, 0x05, 0x04, 0x08, 0x1D, 0x06, 0x07, 0x06, 0x18, 0x05,
+	0x05, 0x08, 0x1C, 0x06, 0x07, 0x06, 0x18, 0x05, 0x06, 0x08, 0x1B, 0x06, 0x07, 0x06, 0x18, 0x05,
+	0x07, 0x09, 0x19, 0x06, 0x07, 0x06, 0x18, 0x05, 0x08, 0x09, 0x18, 0x06, 0x07, 0x06, 0x18, 0x05,
+	0x09, 0x09, 0x17, 0x06, 0x07, 0x06, 0x17, 0x06, 0x0A, 0x09, 0x16, 0x06, 0x07, 0x23, 0x0C, 0x07,
+	0x16, 0x06, 0x08, 0x22, 0x0D, 0x06, 0x16, 0x06, 0x08, 0x21, 0x0E, 0x06, 0x16, 0x06, 0x09, 0x1F,
+	0x0F, 0x06, 0x16, 0x06, 0x0A, 0x1D, 0x10, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06,
+	0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06,
+	0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06,
+	0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x08, 0x27, 0x08, 0x06, 0x16, 0x06,
+	0x07, 0x29, 0x07, 0x06, 0x16, 0x06, 0x06, 0x2B, 0x06, 0x06, 0x16, 0x06, 0x06, 0x2B, 0x06, 0x06,
+	0x16, 0x06, 0x05, 0x2D, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06, 0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x16, 0x06,
+	0x05, 0x06, 0x21, 0x06, 0x05, 0x06, 0x17, 0x06, 0x04, 0x06, 0x21, 0x06, 0x04, 0x06, 0x18, 0x07,
+	0x03, 0x06, 0x21, 0x06, 0x03, 0x07, 0x18, 0x41, 0x19, 0x3F, 0x1B, 0x3D, 0x1D, 0x3B, 0x1F, 0x39,
+	0x23, 0x33, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x06, 0x4F, 0x0E, 0x48, 0x14, 0x43,
+	0x17, 0x41, 0x18, 0x3F, 0x1A, 0x3E, 0x0B, 0x07, 0x08, 0x3E, 0x0A, 0x08, 0x08, 0x3E, 0x09, 0x09,
+	0x08, 0x3F, 0x07, 0x0A, 0x08, 0x3F, 0x07, 0x0A, 0x08, 0x3F, 0x07, 0x0A, 0x08, 0x40, 0x06, 0x0A,
+	0x08, 0x0D, 0x03, 0x30, 0x07, 0x09, 0x08, 0x0D, 0x05, 0x2F, 0x06, 0x09, 0x08, 0x0D, 0x06, 0x2F,
+	0x06, 0x09, 0x07, 0x0D, 0x07, 0x2E, 0x06, 0x09, 0x07, 0x0D, 0x09, 0x2D, 0x06, 0x08, 0x07, 0x0D,
+	0x0A, 0x2D, 0x05, 0x09, 0x06, 0x0D, 0x0B, 0x2D, 0x05, 0x08, 0x06, 0x0D, 0x0C, 0x2C, 0x06, 0x08,
+	0x06, 0x0C, 0x0E, 0x2B, 0x06, 0x08, 0x06, 0x0B, 0x08, 0x01, 0x06, 0x2B, 0x06, 0x08, 0x06, 0x0A,
+	0x08, 0x02, 0x06, 0x2B, 0x06, 0x08, 0x06, 0x09, 0x08, 0x03, 0x06, 0x2B, 0x06, 0x08, 0x06, 0x08,
+	0x08, 0x04, 0x06, 0x2C, 0x05, 0x09, 0x06, 0x06, 0x08, 0x05, 0x06, 0x2C, 0x05, 0x09, 0x13, 0x06,
+	0x05, 0x2D, 0x05, 0x0A, 0x11, 0x06, 0x06, 0x2D, 0x06, 0x0A, 0x0F, 0x07, 0x06, 0x2C, 0x07, 0x0B,
+	0x0C, 0x09, 0x06, 0x2B, 0x08, 0x0C, 0x0A, 0x09, 0x06, 0x2B, 0x08, 0x0F, 0x06, 0x0B, 0x06, 0x2A,
+	0x08, 0x20, 0x07, 0x29, 0x08, 0x21, 0x06, 0x29, 0x08, 0x21, 0x07, 0x28, 0x08, 0x21, 0x07, 0x28,
+	0x08, 0x21, 0x07, 0x28, 0x08, 0x20, 0x08, 0x28, 0x08, 0x1F, 0x0A, 0x27, 0x08, 0x11, 0x03, 0x0A,
+	0x0B, 0x27, 0x08, 0x11, 0x18, 0x27, 0x08, 0x11, 0x17, 0x28, 0x08, 0x11, 0x17, 0x28, 0x08, 0x11,
+	0x16, 0x29, 0x08, 0x11, 0x14, 0x2B, 0x08, 0x11, 0x08, 0x04, 0x04, 0x2F, 0x08, 0x11, 0x08, 0x37,
+	0x08, 0x11, 0x08, 0x37, 0x08, 0x11, 0x08, 0x37, 0x08, 0x11, 0x08, 0x37, 0x08, 0x11, 0x08, 0x37,
+	0x08, 0x11, 0x08, 0x38, 0x07, 0x11, 0x08, 0x38, 0x07, 0x11, 0x08, 0x38, 0x07, 0x11, 0x08, 0x39,
+	0x06, 0x11, 0x08, 0x3A, 0x06, 0x10, 0x08, 0x3A, 0x06, 0x10, 0x08, 0x3B, 0x06, 0x0F, 0x08, 0x3C,
+	0x06, 0x0E, 0x08, 0x3D, 0x06, 0x0D, 0x08, 0x3E, 0x06, 0x0C, 0x08, 0x40, 0x06, 0x0A, 0x08, 0x41,
+	0x07, 0x08, 0x08, 0x43, 0x07, 0x05, 0x09, 0x44, 0x14, 0x46, 0x12, 0x48, 0x10, 0x4A, 0x0D, 0x4E,
+	0x0A, 0x51, 0x05, 0xFF, 0xFF, 0x5A, 0xFF, 0xFF, 0xFF, 0x93, 0x1A, 0x3C, 0x1F, 0x39, 0x21, 0x37,
+	0x23, 0x35, 0x25, 0x34, 0x26, 0x32, 0x07, 0x16, 0x0B, 0x31, 0x06, 0x17, 0x0C, 0x30, 0x05, 0x18,
+	0x0D, 0x2F, 0x05, 0x18, 0x0E, 0x2E, 0x05, 0x18, 0x06, 0x01, 0x08, 0x2D, 0x05, 0x18, 0x06, 0x02,
+	0x08, 0x2C, 0x05, 0x18, 0x06, 0x03, 0x08, 0x2B, 0x05, 0x18, 0x06, 0x04, 0x08, 0x2A, 0x05, 0x18,
+	0x06, 0x05, 0x08, 0x29, 0x05, 0x18, 0x06, 0x06, 0x08, 0x28, 0x05, 0x18, 0x06, 0x07, 0x08, 0x27,
+	0x05, 0x18, 0x06, 0x08, 0x08, 0x26, 0x05, 0x18, 0x06, 0x09, 0x08, 0x25, 0x05, 0x18, 0x06, 0x0A,
+	0x08, 0x24, 0x05, 0x18, 0x06, 0x0B, 0x08, 0x23, 0x05, 0x18, 0x06, 0x0C, 0x08, 0x22, 0x05, 0x19,
+	0x05, 0x0D, 0x08, 0x21, 0x05, 0x19, 0x06, 0x0D, 0x08, 0x20, 0x05, 0x19, 0x08, 0x0B, 0x09, 0x1F,
+	0x05, 0x19, 0x1C, 0x1F, 0x05, 0x1A, 0x1C, 0x1E, 0x05, 0x1B, 0x1B, 0x1E, 0x05, 0x1C, 0x1A, 0x1E,
+	0x05, 0x1E, 0x18, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E,
+	0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x06, 0x2F, 0x06, 0x1E, 0x07, 0x2D, 0x07, 0x1F,
+	0x39, 0x20, 0x39, 0x21, 0x37, 0x23, 0x35, 0x25, 0x33, 0x29, 0x2D, 0xFF, 0x7B, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x55, 0x14, 0x43, 0x18, 0x40, 0x1B, 0x3D, 0x1D, 0x3B, 0x1F, 0x3A, 0x07, 0x0F,
+	0x0A, 0x39, 0x06, 0x13, 0x08, 0x37, 0x06, 0x15, 0x09, 0x35, 0x06, 0x16, 0x09, 0x34, 0x06, 0x17,
+	0x28, 0x14, 0x06, 0x19, 0x28, 0x12, 0x06, 0x1A, 0x28, 0x11, 0x06, 0x19, 0x2A, 0x10, 0x06, 0x18,
+	0x2C, 0x0F, 0x06, 0x17, 0x2D, 0x0F, 0x06, 0x16, 0x09, 0x1F, 0x06, 0x0F, 0x06, 0x15, 0x08, 0x22,
+	0x06, 0x0E, 0x06, 0x13, 0x09, 0x23, 0x06, 0x0E, 0x21, 0x24, 0x06, 0x0E, 0x20, 0x25, 0x06, 0x0E,
+	0x1F, 0x26, 0x06, 0x0E, 0x1D, 0x28, 0x06, 0x0E, 0x1C, 0x29, 0x06, 0x0E, 0x1A, 0x2B, 0x06, 0x0E,
+	0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E,
+	0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E,
+	0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E,
+	0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E,
+	0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E,
+	0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E,
+	0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x06, 0x0F,
+	0x06, 0x3D, 0x06, 0x10, 0x07, 0x3B, 0x07, 0x10, 0x49, 0x11, 0x47, 0x13, 0x45, 0x15, 0x43, 0x18,
+	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xFF, 0xFF, 0xFF, 0xA9, 0x01, 0x56, 0x05, 0x53, 0x07, 0x51,
+	0x09, 0x4E, 0x0D, 0x4B, 0x0F, 0x49, 0x11, 0x47, 0x09, 0x02, 0x09, 0x43, 0x09, 0x05, 0x09, 0x41,
+	0x09, 0x07, 0x09, 0x3F, 0x09, 0x09, 0x09, 0x3D, 0x09, 0x0C, 0x09, 0x39, 0x09, 0x0F, 0x09, 0x37,
+	0x09, 0x11, 0x09, 0x35, 0x09, 0x13, 0x09, 0x32, 0x09, 0x17, 0x09, 0x2F, 0x09, 0x19, 0x09, 0x2D,
+	0x09, 0x1B, 0x09, 0x2B, 0x09, 0x1D, 0x09, 0x28, 0x09, 0x21, 0x09, 0x25, 0x09, 0x23, 0x09, 0x23,
+	0x09, 0x25, 0x09, 0x21, 0x09, 0x27, 0x09, 0x1F, 0x08, 0x2B, 0x08, 0x1D, 0x08, 0x2D, 0x08, 0x1B,
+	0x08, 0x2F, 0x08, 0x1A, 0x07, 0x31, 0x07, 0x19, 0x07, 0x33, 0x07, 0x18, 0x06, 0x35, 0x06, 0x17,
+	0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16,
+	0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16,
+	0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16,
+	0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x16, 0x06, 0x15, 0x0D, 0x15, 0x06, 0x16, 0x06, 0x13,
+	0x11, 0x13, 0x06, 0x16, 0x06, 0x12, 0x13, 0x12, 0x06, 0x16, 0x06, 0x11, 0x15, 0x11, 0x06, 0x16,
+	0x06, 0x11, 0x15, 0x11, 0x06, 0x16, 0x06, 0x10, 0x17, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B,
+	0x06, 0x10, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0B, 0x06, 0x10, 0x06, 0x16, 0x1C, 0x0B, 0x1C, 0x16,
+	0x1C, 0x0B, 0x1C, 0x16, 0x1C, 0x0B, 0x1C, 0x17, 0x1A, 0x0D, 0x1A, 0x19, 0x18, 0x0F, 0x18, 0x1B,
+	0x16, 0x11, 0x16, 0xFF, 0xFF, 0x26, 0xFF, 0xFF, 0xFF, 0x4F, 0x03, 0x51, 0x0D, 0x4A, 0x11, 0x46,
+	0x15, 0x43, 0x17, 0x41, 0x19, 0x3F, 0x0A, 0x07, 0x0A, 0x3D, 0x09, 0x0B, 0x09, 0x3B, 0x08, 0x0F,
+	0x08, 0x3A, 0x07, 0x11, 0x07, 0x39, 0x07, 0x13, 0x07, 0x38, 0x06, 0x15, 0x06, 0x37, 0x06, 0x17,
+	0x06, 0x36, 0x06, 0x17, 0x06, 0x35, 0x06, 0x19, 0x05, 0x35, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19,
+	0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19,
+	0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x35, 0x05, 0x19, 0x05, 0x36, 0x06, 0x17,
+	0x06, 0x36, 0x06, 0x17, 0x06, 0x37, 0x06, 0x15, 0x06, 0x38, 0x07, 0x13, 0x07, 0x39, 0x07, 0x11,
+	0x07, 0x3A, 0x08, 0x0F, 0x08, 0x3B, 0x09, 0x0B, 0x09, 0x3D, 0x0A, 0x07, 0x0A, 0x3F, 0x19, 0x41,
+	0x17, 0x43, 0x15, 0x46, 0x11, 0x4B, 0x0B, 0xFF, 0xFF, 0xFF, 0x05, 0x33, 0x25, 0x35, 0x23, 0x37,
+	0x21, 0x39, 0x1F, 0x3B, 0x1E, 0x07, 0x2D, 0x07, 0x1E, 0x06, 0x2F, 0x06, 0x1E, 0x05, 0x31, 0x05,
+	0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x05, 0x31, 0x05, 0x1E, 0x06, 0x2F, 0x06,
+	0x1E, 0x06, 0x2F, 0x06, 0x1E, 0x06, 0x2F, 0x06, 0x1E, 0x06, 0x2F, 0x05, 0x20, 0x06, 0x2D, 0x06,
+	0x20, 0x07, 0x2B, 0x07, 0x21, 0x07, 0x29, 0x07, 0x22, 0x08, 0x27, 0x07, 0x24, 0x08, 0x25, 0x08,
+	0x25, 0x09, 0x21, 0x09, 0x27, 0x0A, 0x1D, 0x0A, 0x29, 0x0C, 0x17, 0x0C, 0x2B, 0x10, 0x0D, 0x10,
+	0x2E, 0x29, 0x32, 0x25, 0x36, 0x21, 0x3A, 0x1D, 0x40, 0x15, 0x4D, 0x03, 0xFF, 0xE9, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x04, 0x54, 0x05, 0x53, 0x06, 0x52, 0x07, 0x51, 0x08, 0x50, 0x08,
+	0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08,
+	0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08,
+	0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x50, 0x08, 0x24, 0x01, 0x2B, 0x08, 0x23, 0x05,
+	0x28, 0x08, 0x24, 0x06, 0x26, 0x08, 0x25, 0x07, 0x24, 0x08, 0x26, 0x08, 0x22, 0x08, 0x28, 0x08,
+	0x20, 0x08, 0x2A, 0x08, 0x1E, 0x08, 0x2C, 0x08, 0x1C, 0x08, 0x2E, 0x08, 0x1A, 0x08, 0x30, 0x08,
+	0x18, 0x08, 0x32, 0x08, 0x16, 0x08, 0x34, 0x08, 0x14, 0x08, 0x36, 0x08, 0x12, 0x08, 0x38, 0x08,
+	0x10, 0x08, 0x3A, 0x08, 0x0E, 0x08, 0x3C, 0x08, 0x0C, 0x08, 0x3E, 0x08, 0x0A, 0x08, 0x40, 0x08,
+	0x08, 0x08, 0x42, 0x08, 0x06, 0x08, 0x44, 0x08, 0x04, 0x08, 0x46, 0x08, 0x02, 0x08, 0x48, 0x10,
+	0x4A, 0x0E, 0x4C, 0x0C, 0x4E, 0x0A, 0x50, 0x08, 0x52, 0x06, 0x54, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0x03, 0x37, 0x03, 0x1B, 0x05, 0x35, 0x05, 0x1A,
+	0x06, 0x33, 0x06, 0x1A, 0x07, 0x31, 0x07, 0x1B, 0x07, 0x2F, 0x07, 0x1D, 0x07, 0x2D, 0x07, 0x1F,
+	0x07, 0x2B, 0x07, 0x21, 0x07, 0x29, 0x07, 0x23, 0x07, 0x27, 0x07, 0x25, 0x07, 0x25, 0x07, 0x27,
+	0x07, 0x23, 0x07, 0x29, 0x07, 0x21, 0x07, 0x2B, 0x07, 0x1F, 0x07, 0x2D, 0x07, 0x1D, 0x07, 0x2F,
+	0x07, 0x1B, 0x07, 0x31, 0x07, 0x19, 0x07, 0x33, 0x07, 0x17, 0x07, 0x35, 0x07, 0x15, 0x07, 0x37,
+	0x07, 0x13, 0x07, 0x39, 0x07, 0x11, 0x07, 0x3B, 0x07, 0x0F, 0x07, 0x3D, 0x07, 0x0D, 0x07, 0x3F,
+	0x07, 0x0B, 0x07, 0x41, 0x07, 0x09, 0x07, 0x43, 0x07, 0x07, 0x07, 0x45, 0x07, 0x05, 0x07, 0x47,
+	0x07, 0x03, 0x07, 0x49, 0x0F, 0x4B, 0x0D, 0x4D, 0x0B, 0x4F, 0x09, 0x50, 0x09, 0x50, 0x09, 0x4F,
+	0x0B, 0x4D, 0x0D, 0x4B, 0x0F, 0x49, 0x07, 0x03, 0x07, 0x47, 0x07, 0x05, 0x07, 0x45, 0x07, 0x07,
+	0x07, 0x43, 0x07, 0x09, 0x07, 0x41, 0x07, 0x0B, 0x07, 0x3F, 0x07, 0x0D, 0x07, 0x3D, 0x07, 0x0F,
+	0x07, 0x3B, 0x07, 0x11, 0x07, 0x39, 0x07, 0x13, 0x07, 0x37, 0x07, 0x15, 0x07, 0x35, 0x07, 0x17,
+	0x07, 0x33, 0x07, 0x19, 0x07, 0x31, 0x07, 0x1B, 0x07, 0x2F, 0x07, 0x1D, 0x07, 0x2D, 0x07, 0x1F,
+	0x07, 0x2B, 0x07, 0x21, 0x07, 0x29, 0x07, 0x23, 0x07, 0x27, 0x07, 0x25, 0x07, 0x25, 0x07, 0x27,
+	0x07, 0x23, 0x07, 0x29, 0x07, 0x21, 0x07, 0x2B, 0x07, 0x1F, 0x07, 0x2D, 0x07, 0x1D, 0x07, 0x2F,
+	0x07, 0x1B, 0x07, 0x31, 0x07, 0x1A, 0x06, 0x33, 0x06, 0x1A, 0x05, 0x35, 0x05, 0x1B, 0x03, 0x37,
+	0x03, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x03, 0x53, 0x09, 0x4F, 0x0B, 0x4D,
+	0x0D, 0x4B, 0x0F, 0x4A, 0x0F, 0x49, 0x07, 0x03, 0x07, 0x48, 0x06, 0x05, 0x06, 0x47, 0x06, 0x07,
+	0x06, 0x45, 0x07, 0x07, 0x07, 0x44, 0x06, 0x09, 0x06, 0x43, 0x07, 0x09, 0x07, 0x42, 0x06, 0x0B,
+	0x06, 0x41, 0x07, 0x0B, 0x07, 0x40, 0x06, 0x0D, 0x06, 0x3F, 0x07, 0x0D, 0x07, 0x3E, 0x06, 0x0F,
+	0x06, 0x3D, 0x06, 0x11, 0x06, 0x3B, 0x07, 0x11, 0x07, 0x3A, 0x06, 0x13, 0x06, 0x39, 0x07, 0x13,
+	0x07, 0x38, 0x06, 0x09, 0x03, 0x09, 0x06, 0x37, 0x07, 0x08, 0x05, 0x08, 0x07, 0x36, 0x06, 0x09,
+	0x05, 0x09, 0x06, 0x35, 0x07, 0x09, 0x05, 0x09, 0x07, 0x34, 0x06, 0x0A, 0x05, 0x0A, 0x06, 0x33,
+	0x06, 0x0B, 0x05, 0x0B, 0x06, 0x31, 0x07, 0x0B, 0x05, 0x0B, 0x07, 0x30, 0x06, 0x0C, 0x05, 0x0C,
+	0x06, 0x2F, 0x07, 0x0C, 0x05, 0x0C, 0x07, 0x2E, 0x06, 0x0D, 0x05, 0x0D, 0x06, 0x2D, 0x07, 0x0D,
+	0x05, 0x0D, 0x07, 0x2C, 0x06, 0x0E, 0x05, 0x0E, 0x06, 0x2B, 0x07, 0x0E, 0x05, 0x0E, 0x07, 0x2A,
+	0x06, 0x0F, 0x05, 0x0F, 0x06, 0x29, 0x06, 0x10, 0x05, 0x10, 0x06, 0x27, 0x07, 0x10, 0x05, 0x10,
+	0x07, 0x26, 0x06, 0x11, 0x05, 0x11, 0x06, 0x25, 0x07, 0x11, 0x05, 0x11, 0x07, 0x24, 0x06, 0x12,
+	0x05, 0x12, 0x06, 0x23, 0x07, 0x12, 0x05, 0x12, 0x07, 0x22, 0x06, 0x13, 0x05, 0x13, 0x06, 0x21,
+	0x07, 0x13, 0x05, 0x13, 0x07, 0x20, 0x06, 0x14, 0x05, 0x14, 0x06, 0x1F, 0x06, 0x16, 0x03, 0x16,
+	0x06, 0x1E, 0x06, 0x2F, 0x06, 0x1D, 0x06, 0x31, 0x06, 0x1B, 0x07, 0x31, 0x07, 0x1A, 0x06, 0x33,
+	0x06, 0x19, 0x07, 0x33, 0x07, 0x18, 0x06, 0x19, 0x03, 0x19, 0x06, 0x17, 0x07, 0x18, 0x05, 0x18,
+	0x07, 0x16, 0x06, 0x18, 0x07, 0x18, 0x06, 0x15, 0x06, 0x19, 0x07, 0x19, 0x06, 0x14, 0x06, 0x19,
+	0x07, 0x19, 0x06, 0x13, 0x06, 0x1A, 0x07, 0x1A, 0x06, 0x11, 0x07, 0x1B, 0x05, 0x1B, 0x07, 0x10,
+	0x06, 0x1D, 0x03, 0x1D, 0x06, 0x10, 0x06, 0x3D, 0x06, 0x10, 0x05, 0x3F, 0x05, 0x0F, 0x06, 0x3F,
+	0x06, 0x0F, 0x05, 0x3F, 0x05, 0x10, 0x06, 0x3D, 0x06, 0x10, 0x49, 0x11, 0x47, 0x12, 0x47, 0x13,
+	0x45, 0x15, 0x43, 0x18, 0x3F, 0xFF, 0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0xFF, 0x4F, 0x03, 0x4F, 0x11,
+	0x44, 0x19, 0x3E, 0x1D, 0x3A, 0x21, 0x36, 0x25, 0x32, 0x0F, 0x0B, 0x0F, 0x2F, 0x0C, 0x13, 0x0C,
+	0x2C, 0x0B, 0x19, 0x0B, 0x29, 0x0A, 0x1D, 0x0A, 0x27, 0x09, 0x21, 0x09, 0x25, 0x09, 0x23, 0x09,
+	0x23, 0x08, 0x27, 0x08, 0x21, 0x08, 0x29, 0x08, 0x1F, 0x08, 0x2B, 0x08, 0x1E, 0x07, 0x2D, 0x07,
+	0x1D, 0x07, 0x2F, 0x07, 0x1B, 0x07, 0x17, 0x03, 0x17, 0x07, 0x1A, 0x06, 0x17, 0x05, 0x17, 0x06,
+	0x19, 0x07, 0x17, 0x05, 0x17, 0x07, 0x18, 0x06, 0x18, 0x05, 0x18, 0x06, 0x17, 0x06, 0x19, 0x05,
+	0x19, 0x06, 0x16, 0x06, 0x19, 0x05, 0x19, 0x06, 0x15, 0x06, 0x1A, 0x05, 0x1A, 0x06, 0x14, 0x06,
+	0x1A, 0x05, 0x1A, 0x06, 0x13, 0x06, 0x1B, 0x05, 0x1B, 0x06, 0x12, 0x06, 0x1B, 0x05, 0x1B, 0x06,
+	0x12, 0x06, 0x1B, 0x05, 0x1B, 0x06, 0x12, 0x05, 0x1C, 0x05, 0x1C, 0x05, 0x11, 0x06, 0x1C, 0x05,
+	0x1C, 0x06, 0x10, 0x06, 0x1C, 0x05, 0x1C, 0x06, 0x10, 0x06, 0x1C, 0x05, 0x1C, 0x06, 0x10, 0x05,
+	0x1D, 0x05, 0x1D, 0x05, 0x10, 0x05, 0x1D, 0x05, 0x1D, 0x05, 0x10, 0x05, 0x1D, 0x05, 0x1D, 0x05,
+	0x0F, 0x06, 0x1D, 0x05, 0x1D, 0x05, 0x0F, 0x06, 0x1D, 0x05, 0x1D, 0x06, 0x0E, 0x06, 0x1D, 0x05,
+	0x1D, 0x06, 0x0E, 0x06, 0x1D, 0x05, 0x1D, 0x06, 0x0E, 0x06, 0x1D, 0x05, 0x1D, 0x05, 0x10, 0x05,
+	0x1D, 0x05, 0x1D, 0x05, 0x10, 0x05, 0x1D, 0x05, 0x1D, 0x05, 0x10, 0x05, 0x1D, 0x05, 0x1D, 0x05,
+	0x10, 0x06, 0x1C, 0x05, 0x1C, 0x06, 0x10, 0x06, 0x1D, 0x03, 0x1D, 0x06, 0x10, 0x06, 0x3D, 0x06,
+	0x11, 0x05, 0x3D, 0x05, 0x12, 0x06, 0x3B, 0x06, 0x12, 0x06, 0x3B, 0x06, 0x12, 0x06, 0x3B, 0x06,
+	0x13, 0x06, 0x1C, 0x01, 0x1C, 0x06, 0x14, 0x06, 0x1A, 0x05, 0x1A, 0x06, 0x15, 0x06, 0x18, 0x07,
+	0x18, 0x06, 0x16, 0x06, 0x18, 0x07, 0x18, 0x06, 0x17, 0x06, 0x17, 0x07, 0x17, 0x06, 0x18, 0x07,
+	0x16, 0x07, 0x16, 0x07, 0x19, 0x06, 0x17, 0x05, 0x17, 0x06, 0x1A, 0x07, 0x17, 0x03, 0x17, 0x07,
+	0x1B, 0x07, 0x2F, 0x07, 0x1D, 0x07, 0x2D, 0x07, 0x1E, 0x08, 0x2B, 0x08, 0x1F, 0x08, 0x29, 0x08,
+	0x21, 0x08, 0x27, 0x08, 0x23, 0x09, 0x23, 0x09, 0x25, 0x09, 0x21, 0x09, 0x27, 0x0A, 0x1D, 0x0A,
+	0x29, 0x0B, 0x19, 0x0B, 0x2C, 0x0C, 0x13, 0x0C, 0x2F, 0x0F, 0x0B, 0x0F, 0x32, 0x25, 0x36, 0x21,
+	0x3A, 0x1D, 0x3E, 0x19, 0x44, 0x11, 0x4F, 0x03, 0xFF, 0xE9, 0xFF, 0xFF, 0xFF, 0x4F, 0x03, 0x4F,
+	0x11, 0x44, 0x19, 0x3E, 0x1D, 0x3A, 0x21, 0x36, 0x25, 0x32, 0x0F, 0x0B, 0x0F, 0x2F, 0x0C, 0x13,
+	0x0C, 0x2C, 0x0B, 0x19, 0x0B, 0x29, 0x0A, 0x1D, 0x0A, 0x27, 0x09, 0x21, 0x09, 0x25, 0x09, 0x23,
+	0x09, 0x23, 0x08, 0x27, 0x08, 0x21, 0x08, 0x29, 0x08, 0x1F, 0x08, 0x2B, 0x08, 0x1E, 0x07, 0x2D,
+	0x07, 0x1D, 0x07, 0x2F, 0x07, 0x1B, 0x07, 0x16, 0x05, 0x16, 0x07, 0x1A, 0x06, 0x14, 0x0B, 0x14,
+	0x06, 0x19, 0x07, 0x13, 0x0D, 0x13, 0x07, 0x18, 0x06, 0x13, 0x0F, 0x13, 0x06, 0x17, 0x06, 0x13,
+	0x11, 0x13, 0x06, 0x16, 0x06, 0x12, 0x13, 0x12, 0x06, 0x15, 0x06, 0x12, 0x08, 0x05, 0x08, 0x12,
+	0x06, 0x14, 0x06, 0x12, 0x06, 0x09, 0x06, 0x12, 0x06, 0x13, 0x06, 0x13, 0x06, 0x09, 0x06, 0x13,
+	0x06, 0x12, 0x06, 0x13, 0x05, 0x0B, 0x05, 0x13, 0x06, 0x12, 0x06, 0x12, 0x06, 0x0B, 0x06, 0x12,
+	0x06, 0x12, 0x05, 0x13, 0x06, 0x0B, 0x06, 0x13, 0x05, 0x11, 0x06, 0x13, 0x06, 0x0B, 0x06, 0x13,
+	0x06, 0x10, 0x06, 0x14, 0x05, 0x0B, 0x05, 0x14, 0x06, 0x10, 0x06, 0x15, 0x03, 0x0C, 0x05, 0x14,
+	0x06, 0x10, 0x05, 0x24, 0x06, 0x15, 0x05, 0x10, 0x05, 0x23, 0x07, 0x15, 0x05, 0x10, 0x05, 0x22,
+	0x07, 0x16, 0x05, 0x0F, 0x06, 0x21, 0x08, 0x16, 0x05, 0x0F, 0x06, 0x20, 0x08, 0x17, 0x06, 0x0E,
+	0x06, 0x1F, 0x08, 0x18, 0x06, 0x0E, 0x06, 0x1E, 0x08, 0x19, 0x06, 0x0E, 0x06, 0x1E, 0x07, 0x1A,
+	0x05, 0x10, 0x05, 0x1D, 0x07, 0x1B, 0x05, 0x10, 0x05, 0x1D, 0x06, 0x1C, 0x05, 0x10, 0x05, 0x1D,
+	0x05, 0x1D, 0x05, 0x10, 0x06, 0x1C, 0x05, 0x1C, 0x06, 0x10, 0x06, 0x1C, 0x05, 0x1C, 0x06, 0x10,
+	0x06, 0x1C, 0x05, 0x1C, 0x06, 0x11, 0x05, 0x1D, 0x03, 0x1D, 0x05, 0x12, 0x06, 0x3B, 0x06, 0x12,
+	0x06, 0x3B, 0x06, 0x12, 0x06, 0x3B, 0x06, 0x13, 0x06, 0x39, 0x06, 0x14, 0x06, 0x39, 0x06, 0x15,
+	0x06, 0x1A, 0x03, 0x1A, 0x06, 0x16, 0x06, 0x19, 0x05, 0x19, 0x06, 0x17, 0x06, 0x17, 0x07, 0x17,
+	0x06, 0x18, 0x07, 0x16, 0x07, 0x16, 0x07, 0x19, 0x06, 0x16, 0x07, 0x16, 0x06, 0x1A, 0x07, 0x15,
+	0x07, 0x15, 0x07, 0x1B, 0x07, 0x15, 0x05, 0x15, 0x07, 0x1D, 0x07, 0x15, 0x03, 0x15, 0x07, 0x1E,
+	0x08, 0x2B, 0x08, 0x1F, 0x08, 0x29, 0x08, 0x21, 0x08, 0x27, 0x08, 0x23, 0x09, 0x23, 0x09, 0x25,
+	0x09, 0x21, 0x09, 0x27, 0x0A, 0x1D, 0x0A, 0x29, 0x0B, 0x19, 0x0B, 0x2C, 0x0C, 0x13, 0x0C, 0x2F,
+	0x0F, 0x0B, 0x0F, 0x32, 0x25, 0x36, 0x21, 0x3A, 0x1D, 0x3E, 0x19, 0x44, 0x11, 0x4F, 0x03, 0xFF,
+	0xE9, 0xFF, 0xFF, 0xFF, 0x4F, 0x03, 0x4F, 0x11, 0x44, 0x19, 0x3E, 0x1D, 0x3A, 0x21, 0x36, 0x25,
+	0x32, 0x0F, 0x0B, 0x0F, 0x2F, 0x0C, 0x13, 0x0C, 0x2C, 0x0B, 0x19, 0x0B, 0x29, 0x0A, 0x1D, 0x0A,
+	0x27, 0x09, 0x21, 0x09, 0x25, 0x09, 0x23, 0x09, 0x23, 0x08, 0x27, 0x08, 0x21, 0x08, 0x29, 0x08,
+	0x1F, 0x08, 0x2B, 0x08, 0x1E, 0x07, 0x2D, 0x07, 0x1D, 0x07, 0x2F, 0x07, 0x1B, 0x07, 0x31, 0x07,
+	0x1A, 0x06, 0x33, 0x06, 0x19, 0x07, 0x33, 0x07, 0x18, 0x06, 0x35, 0x06, 0x17, 0x06, 0x37, 0x06,
+	0x16, 0x06, 0x37, 0x06, 0x15, 0x06, 0x39, 0x06, 0x14, 0x06, 0x39, 0x06, 0x13, 0x06, 0x3B, 0x06,
+	0x12, 0x06, 0x0B, 0x25, 0x0B, 0x06, 0x12, 0x06, 0x08, 0x2B, 0x08, 0x06, 0x12, 0x05, 0x08, 0x2D,
+	0x08, 0x05, 0x11, 0x06, 0x07, 0x2F, 0x07, 0x06, 0x10, 0x06, 0x07, 0x2F, 0x07, 0x06, 0x10, 0x06,
+	0x07, 0x2F, 0x07, 0x06, 0x10, 0x05, 0x07, 0x06, 0x25, 0x06, 0x07, 0x05, 0x10, 0x05, 0x07, 0x06,
+	0x25, 0x06, 0x07, 0x05, 0x10, 0x05, 0x07, 0x06, 0x25, 0x06, 0x07, 0x05, 0x0F, 0x06, 0x07, 0x06,
+	0x25, 0x06, 0x07, 0x05, 0x0F, 0x06, 0x07, 0x06, 0x25, 0x06, 0x07, 0x06, 0x0E, 0x06, 0x07, 0x06,
+	0x25, 0x06, 0x07, 0x06, 0x0E, 0x06, 0x07, 0x06, 0x25, 0x06, 0x07, 0x06, 0x0E, 0x06, 0x07, 0x06,
+	0x25, 0x06, 0x07, 0x05, 0x10, 0x05, 0x07, 0x06, 0x25, 0x06, 0x07, 0x05, 0x10, 0x05, 0x08, 0x2F,
+	0x08, 0x05, 0x10, 0x05, 0x08, 0x2F, 0x08, 0x05, 0x10, 0x06, 0x07, 0x2F, 0x07, 0x06, 0x10, 0x06,
+	0x08, 0x2D, 0x08, 0x06, 0x10, 0x06, 0x09, 0x2B, 0x09, 0x06, 0x11, 0x05, 0x0B, 0x27, 0x0B, 0x05,
+	0x12, 0x06, 0x3B, 0x06, 0x12, 0x06, 0x3B, 0x06, 0x12, 0x06, 0x3B, 0x06, 0x13, 0x06, 0x39, 0x06,
+	0x14, 0x06, 0x39, 0x06, 0x15, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37, 0x06, 0x17, 0x06, 0x35, 0x06,
+	0x18, 0x07, 0x33, 0x07, 0x19, 0x06, 0x33, 0x06, 0x1A, 0x07, 0x31, 0x07, 0x1B, 0x07, 0x2F, 0x07,
+	0x1D, 0x07, 0x2D, 0x07, 0x1E, 0x08, 0x2B, 0x08, 0x1F, 0x08, 0x29, 0x08, 0x21, 0x08, 0x27, 0x08,
+	0x23, 0x09, 0x23, 0x09, 0x25, 0x09, 0x21, 0x09, 0x27, 0x0A, 0x1D, 0x0A, 0x29, 0x0B, 0x19, 0x0B,
+	0x2C, 0x0C, 0x13, 0x0C, 0x2F, 0x0F, 0x0B, 0x0F, 0x32, 0x25, 0x36, 0x21, 0x3A, 0x1D, 0x3E, 0x19,
+	0x44, 0x11, 0x4F, 0x03, 0xFF, 0xE9, 0xFF, 0xFF, 0xFF, 0xA5, 0x05, 0x53, 0x07, 0x51, 0x0A, 0x4F,
+	0x0A, 0x4E, 0x0C, 0x4C, 0x0D, 0x4C, 0x06, 0x02, 0x06, 0x4A, 0x07, 0x02, 0x06, 0x49, 0x07, 0x03,
+	0x06, 0x48, 0x07, 0x04, 0x06, 0x48, 0x07, 0x04, 0x06, 0x47, 0x07, 0x05, 0x06, 0x46, 0x07, 0x06,
+	0x06, 0x45, 0x07, 0x07, 0x06, 0x45, 0x07, 0x07, 0x05, 0x45, 0x07, 0x07, 0x06, 0x44, 0x07, 0x08,
+	0x06, 0x43, 0x07, 0x09, 0x06, 0x42, 0x08, 0x08, 0x06, 0x43, 0x07, 0x09, 0x06, 0x42, 0x07, 0x0A,
+	0x06, 0x41, 0x07, 0x0A, 0x06, 0x41, 0x07, 0x0B, 0x06, 0x40, 0x08, 0x0B, 0x06, 0x3F, 0x08, 0x0C,
+	0x1A, 0x2A, 0x08, 0x0D, 0x1B, 0x29, 0x07, 0x0E, 0x1C, 0x27, 0x07, 0x10, 0x1C, 0x26, 0x06, 0x12,
+	0x1C, 0x24, 0x06, 0x28, 0x07, 0x24, 0x06, 0x29, 0x07, 0x22, 0x06, 0x2B, 0x06, 0x22, 0x06, 0x2C,
+	0x05, 0x22, 0x06, 0x2C, 0x05, 0x22, 0x05, 0x2D, 0x05, 0x22, 0x05, 0x2D, 0x05, 0x22, 0x05, 0x2C,
+	0x06, 0x22, 0x05, 0x2C, 0x06, 0x22, 0x05, 0x2C, 0x06, 0x22, 0x05, 0x2C, 0x06, 0x22, 0x05, 0x2C,
+	0x06, 0x22, 0x05, 0x2C, 0x05, 0x23, 0x05, 0x2C, 0x05, 0x23, 0x05, 0x2B, 0x06, 0x23, 0x05, 0x2B,
+	0x06, 0x23, 0x05, 0x2B, 0x06, 0x23, 0x05, 0x2B, 0x06, 0x23, 0x05, 0x2B, 0x06, 0x23, 0x05, 0x2B,
+	0x05, 0x24, 0x05, 0x2B, 0x05, 0x24, 0x05, 0x2A, 0x06, 0x24, 0x06, 0x29, 0x06, 0x24, 0x06, 0x29,
+	0x06, 0x24, 0x06, 0x29, 0x06, 0x25, 0x05, 0x29, 0x06, 0x25, 0x06, 0x28, 0x05, 0x26, 0x06, 0x28,
+	0x05, 0x27, 0x06, 0x26, 0x06, 0x27, 0x07, 0x25, 0x06, 0x28, 0x07, 0x24, 0x06, 0x28, 0x08, 0x22,
+	0x06, 0x2A, 0x08, 0x21, 0x06, 0x2B, 0x09, 0x1D, 0x08, 0x2C, 0x0A, 0x1A, 0x08, 0x2E, 0x2A, 0x30,
+	0x28, 0x33, 0x25, 0x35, 0x23, 0x39, 0x1E, 0x3E, 0x18, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF5,
+	0x03, 0x4F, 0x11, 0x44, 0x19, 0x3E, 0x1D, 0x3A, 0x21, 0x36, 0x25, 0x32, 0x0F, 0x0B, 0x0F, 0x2F,
+	0x0C, 0x13, 0x0C, 0x2C, 0x0B, 0x19, 0x0B, 0x29, 0x0A, 0x1D, 0x0A, 0x27, 0x09, 0x21, 0x09, 0x25,
+	0x09, 0x23, 0x09, 0x23, 0x08, 0x27, 0x08, 0x21, 0x08, 0x29, 0x08, 0x1F, 0x08, 0x2B, 0x08, 0x1E,
+	0x07, 0x13, 0x02, 0x18, 0x07, 0x1D, 0x07, 0x12, 0x05, 0x18, 0x07, 0x1B, 0x07, 0x13, 0x05, 0x19,
+	0x07, 0x1A, 0x06, 0x14, 0x06, 0x19, 0x06, 0x19, 0x07, 0x14, 0x06, 0x19, 0x07, 0x18, 0x06, 0x15,
+	0x06, 0x1A, 0x06, 0x17, 0x06, 0x16, 0x06, 0x1B, 0x06, 0x16, 0x06, 0x16, 0x06, 0x1B, 0x06, 0x15,
+	0x06, 0x17, 0x06, 0x1C, 0x06, 0x14, 0x06, 0x17, 0x06, 0x1C, 0x06, 0x13, 0x06, 0x18, 0x06, 0x1D,
+	0x06, 0x12, 0x06, 0x18, 0x06, 0x1D, 0x06, 0x12, 0x06, 0x18, 0x06, 0x1D, 0x06, 0x12, 0x05, 0x19,
+	0x06, 0x1E, 0x05, 0x11, 0x06, 0x19, 0x06, 0x1E, 0x06, 0x10, 0x06, 0x19, 0x06, 0x1E, 0x06, 0x10,
+	0x06, 0x19, 0x06, 0x1E, 0x06, 0x10, 0x05, 0x1A, 0x06, 0x1F, 0x05, 0x10, 0x05, 0x1A, 0x06, 0x1F,
+	0x05, 0x10, 0x05, 0x1A, 0x06, 0x1F, 0x05, 0x0F, 0x06, 0x1A, 0x06, 0x1F, 0x05, 0x0F, 0x06, 0x1A,
+	0x06, 0x1F, 0x06, 0x0E, 0x06, 0x1A, 0x06, 0x1F, 0x06, 0x0E, 0x06, 0x1A, 0x07, 0x1E, 0x06, 0x0E,
+	0x06, 0x1A, 0x08, 0x1D, 0x05, 0x10, 0x05, 0x1B, 0x08, 0x1C, 0x05, 0x10, 0x05, 0x1C, 0x08, 0x1B,
+	0x05, 0x10, 0x05, 0x1D, 0x08, 0x1A, 0x05, 0x10, 0x06, 0x1D, 0x08, 0x18, 0x06, 0x10, 0x06, 0x1E,
+	0x08, 0x17, 0x06, 0x10, 0x06, 0x1F, 0x08, 0x16, 0x06, 0x11, 0x05, 0x20, 0x07, 0x16, 0x05, 0x12,
+	0x06, 0x20, 0x07, 0x14, 0x06, 0x12, 0x06, 0x21, 0x06, 0x14, 0x06, 0x12, 0x06, 0x22, 0x04, 0x15,
+	0x06, 0x13, 0x06, 0x39, 0x06, 0x14, 0x06, 0x39, 0x06, 0x15, 0x06, 0x37, 0x06, 0x16, 0x06, 0x37,
+	0x06, 0x17, 0x06, 0x35, 0x06, 0x18, 0x07, 0x33, 0x07, 0x19, 0x06, 0x33, 0x06, 0x1A, 0x07, 0x31,
+	0x07, 0x1B, 0x07, 0x2F, 0x07, 0x1D, 0x07, 0x2D, 0x07, 0x1E, 0x08, 0x2B, 0x08, 0x1F, 0x08, 0x29,
+	0x08, 0x21, 0x08, 0x27, 0x08, 0x23, 0x09, 0x23, 0x09, 0x25, 0x09, 0x21, 0x09, 0x27, 0x0A, 0x1D,
+	0x0A, 0x29, 0x0B, 0x19, 0x0B, 0x2C, 0x0C, 0x13, 0x0C, 0x2F, 0x0F, 0x0B, 0x0F, 0x32, 0x25, 0x36,
+	0x21, 0x3A, 0x1D, 0x3E, 0x19, 0x44, 0x11, 0x4F, 0x03, 0xFF, 0xFF, 0x43, 0xFF, 0x71, 0x02, 0x3D,
+	0x02, 0x16, 0x05, 0x3B, 0x05, 0x14, 0x06, 0x39, 0x06, 0x14, 0x07, 0x37, 0x07, 0x14, 0x08, 0x19,
+	0x03, 0x19, 0x08, 0x15, 0x07, 0x13, 0x0F, 0x13, 0x07, 0x17, 0x06, 0x10, 0x15, 0x10, 0x06, 0x19,
+	0x04, 0x0F, 0x19, 0x0F, 0x04, 0x1C, 0x01, 0x0F, 0x1B, 0x0F, 0x01, 0x2C, 0x1F, 0x39, 0x0C, 0x09,
+	0x0C, 0x37, 0x0A, 0x0F, 0x0A, 0x35, 0x09, 0x13, 0x09, 0x33, 0x08, 0x17, 0x08, 0x31, 0x08, 0x19,
+	0x08, 0x2F, 0x08, 0x1B, 0x08, 0x2E, 0x07, 0x1D, 0x07, 0x2D, 0x07, 0x1F, 0x07, 0x2B, 0x07, 0x21,
+	0x07, 0x2A, 0x06, 0x23, 0x06, 0x29, 0x07, 0x23, 0x07, 0x28, 0x06, 0x25, 0x06, 0x28, 0x06, 0x25,
+	0x06, 0x27, 0x06, 0x27, 0x06, 0x26, 0x06, 0x27, 0x06, 0x14, 0x09, 0x09, 0x06, 0x27, 0x06, 0x09,
+	0x09, 0x01, 0x0B, 0x08, 0x06, 0x27, 0x06, 0x08, 0x16, 0x08, 0x05, 0x29, 0x05, 0x08, 0x16, 0x08,
+	0x05, 0x29, 0x05, 0x08, 0x0B, 0x01, 0x09, 0x09, 0x05, 0x29, 0x05, 0x09, 0x09, 0x14, 0x05, 0x29,
+	0x05, 0x26, 0x05, 0x29, 0x05, 0x26, 0x05, 0x29, 0x05, 0x26, 0x05, 0x29, 0x05, 0x26, 0x06, 0x27,
+	0x06, 0x26, 0x06, 0x27, 0x06, 0x26, 0x06, 0x27, 0x06, 0x27, 0x05, 0x27, 0x05, 0x28, 0x06, 0x25,
+	0x06, 0x28, 0x06, 0x25, 0x06, 0x29, 0x06, 0x23, 0x06, 0x2A, 0x06, 0x23, 0x06, 0x2B, 0x06, 0x21,
+	0x06, 0x2C, 0x07, 0x1F, 0x07, 0x2D, 0x07, 0x1D, 0x07, 0x2E, 0x08, 0x1B, 0x08, 0x2F, 0x08, 0x19,
+	0x08, 0x25, 0x04, 0x08, 0x07, 0x19, 0x07, 0x08, 0x04, 0x19, 0x06, 0x08, 0x07, 0x17, 0x07, 0x08,
+	0x06, 0x17, 0x07, 0x09, 0x06, 0x17, 0x06, 0x09, 0x07, 0x15, 0x08, 0x0A, 0x05, 0x17, 0x05, 0x0A,
+	0x08, 0x14, 0x07, 0x0B, 0x06, 0x15, 0x06, 0x0B, 0x07, 0x14, 0x06, 0x0C, 0x06, 0x15, 0x06, 0x0C,
+	0x06, 0x14, 0x05, 0x0D, 0x06, 0x15, 0x06, 0x0D, 0x05, 0x15, 0x03, 0x0F, 0x05, 0x15, 0x05, 0x0F,
+	0x03, 0x28, 0x06, 0x13, 0x06, 0x3A, 0x06, 0x13, 0x06, 0x3A, 0x06, 0x13, 0x06, 0x3A, 0x06, 0x13,
+	0x06, 0x3B, 0x05, 0x13, 0x05, 0x3C, 0x1D, 0x3C, 0x1D, 0x3C, 0x1D, 0x3D, 0x1B, 0x3E, 0x1B, 0x3E,
+	0x1B, 0x3E, 0x06, 0x0F, 0x06, 0x3E, 0x06, 0x0F, 0x06, 0x3F, 0x05, 0x0F, 0x05, 0x40, 0x06, 0x0D,
+	0x06, 0x40, 0x06, 0x0D, 0x06, 0x40, 0x06, 0x0D, 0x06, 0x41, 0x06, 0x0B, 0x06, 0x42, 0x17, 0x42,
+	0x17, 0x43, 0x15, 0x45, 0x13, 0x48, 0x0F, 0x4D, 0x09, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF5, 0x04,
+	0x1F, 0x02, 0x2E, 0x0F, 0x19, 0x04, 0x2A, 0x15, 0x15, 0x06, 0x27, 0x19, 0x12, 0x07, 0x26, 0x1B,
+	0x10, 0x07, 0x25, 0x1F, 0x0D, 0x07, 0x25, 0x0C, 0x09, 0x0C, 0x0B, 0x07, 0x25, 0x0A, 0x0F, 0x0A,
+	0x09, 0x07, 0x25, 0x09, 0x13, 0x08, 0x08, 0x07, 0x25, 0x08, 0x17, 0x05, 0x08, 0x07, 0x25, 0x08,
+	0x19, 0x03, 0x08, 0x07, 0x25, 0x08, 0x24, 0x07, 0x26, 0x07, 0x24, 0x07, 0x26, 0x07, 0x24, 0x07,
+	0x26, 0x07, 0x24, 0x07, 0x27, 0x06, 0x24, 0x07, 0x27, 0x07, 0x23, 0x07, 0x28, 0x06, 0x23, 0x08,
+	0x28, 0x06, 0x22, 0x09, 0x27, 0x06, 0x22, 0x0A, 0x27, 0x06, 0x21, 0x0C, 0x26, 0x06, 0x20, 0x0D,
+	0x26, 0x05, 0x20, 0x07, 0x01, 0x06, 0x26, 0x05, 0x1F, 0x07, 0x03, 0x05, 0x26, 0x05, 0x1E, 0x07,
+	0x04, 0x05, 0x26, 0x05, 0x1D, 0x07, 0x05, 0x05, 0x26, 0x05, 0x1C, 0x07, 0x06, 0x05, 0x26, 0x05,
+	0x1B, 0x07, 0x07, 0x05, 0x26, 0x05, 0x1A, 0x07, 0x08, 0x05, 0x26, 0x05, 0x19, 0x07, 0x09, 0x05,
+	0x26, 0x06, 0x17, 0x07, 0x09, 0x06, 0x26, 0x06, 0x16, 0x07, 0x0A, 0x06, 0x26, 0x06, 0x15, 0x07,
+	0x0B, 0x06, 0x27, 0x05, 0x14, 0x07, 0x0C, 0x05, 0x28, 0x06, 0x12, 0x07, 0x0C, 0x06, 0x28, 0x06,
+	0x11, 0x07, 0x0D, 0x06, 0x29, 0x06, 0x0F, 0x07, 0x0D, 0x06, 0x2A, 0x07, 0x0D, 0x07, 0x0E, 0x06,
+	0x2B, 0x06, 0x0C, 0x07, 0x0E, 0x06, 0x2C, 0x07, 0x0A, 0x07, 0x0E, 0x07, 0x2D, 0x07, 0x08, 0x07,
+	0x0E, 0x07, 0x2E, 0x06, 0x08, 0x07, 0x0E, 0x08, 0x2F, 0x04, 0x08, 0x07, 0x0E, 0x08, 0x31, 0x02,
+	0x08, 0x07, 0x0F, 0x07, 0x3B, 0x07, 0x0F, 0x07, 0x3B, 0x07, 0x10, 0x06, 0x3B, 0x07, 0x11, 0x06,
+	0x3A, 0x07, 0x11, 0x06, 0x3A, 0x07, 0x12, 0x06, 0x39, 0x07, 0x13, 0x06, 0x38, 0x07, 0x14, 0x06,
+	0x37, 0x08, 0x14, 0x05, 0x37, 0x09, 0x13, 0x06, 0x36, 0x0A, 0x13, 0x06, 0x35, 0x0B, 0x13, 0x06,
+	0x34, 0x0C, 0x13, 0x05, 0x34, 0x25, 0x33, 0x07, 0x02, 0x1D, 0x32, 0x07, 0x03, 0x1D, 0x31, 0x07,
+	0x05, 0x1C, 0x30, 0x07, 0x06, 0x1B, 0x30, 0x07, 0x07, 0x1B, 0x2F, 0x07, 0x08, 0x06, 0x0F, 0x06,
+	0x2E, 0x07, 0x09, 0x06, 0x0F, 0x06, 0x2D, 0x07, 0x0B, 0x05, 0x0F, 0x05, 0x2D, 0x07, 0x0C, 0x06,
+	0x0D, 0x06, 0x2C, 0x07, 0x0D, 0x06, 0x0D, 0x06, 0x2B, 0x07, 0x0E, 0x06, 0x0D, 0x06, 0x2A, 0x07,
+	0x10, 0x06, 0x0B, 0x06, 0x2A, 0x07, 0x11, 0x17, 0x29, 0x07, 0x12, 0x17, 0x28, 0x07, 0x14, 0x15,
+	0x29, 0x06, 0x16, 0x13, 0x2B, 0x04, 0x18, 0x11, 0x2D, 0x02, 0x1C, 0x0B, 0xFF, 0xFF, 0x3F, 0xFF,
+	0xFF, 0x99, 0x09, 0x4E, 0x0D, 0x4B, 0x0F, 0x49, 0x11, 0x47, 0x13, 0x45, 0x08, 0x05, 0x08, 0x44,
+	0x07, 0x07, 0x07, 0x43, 0x07, 0x09, 0x07, 0x42, 0x06, 0x0B, 0x06, 0x42, 0x05, 0x0D, 0x05, 0x42,
+	0x05, 0x0D, 0x05, 0x41, 0x06, 0x0D, 0x06, 0x40, 0x06, 0x0D, 0x06, 0x40, 0x06, 0x0D, 0x06, 0x40,
+	0x06, 0x0D, 0x0A, 0x3C, 0x06, 0x0D, 0x0B, 0x3B, 0x06, 0x0D, 0x0C, 0x3A, 0x06, 0x0D, 0x0C, 0x3A,
+	0x06, 0x0D, 0x0C, 0x3A, 0x06, 0x0D, 0x0B, 0x3B, 0x06, 0x0D, 0x06, 0x40, 0x06, 0x0D, 0x06, 0x40,
+	0x06, 0x0D, 0x06, 0x40, 0x06, 0x0D, 0x06, 0x40, 0x06, 0x05, 0x03, 0x05, 0x0B, 0x3B, 0x06, 0x04,
+	0x05, 0x04, 0x0C, 0x3A, 0x06, 0x04, 0x05, 0x04, 0x0C, 0x3A, 0x06, 0x04, 0x05, 0x04, 0x0C, 0x3A,
+	0x06, 0x04, 0x05, 0x04, 0x0B, 0x3B, 0x06, 0x04, 0x05, 0x04, 0x06, 0x40, 0x06, 0x04, 0x05, 0x04,
+	0x06, 0x40, 0x06, 0x04, 0x05, 0x04, 0x06, 0x40, 0x06, 0x04, 0x05, 0x04, 0x06, 0x40, 0x06, 0x04,
+	0x05, 0x04, 0x0B, 0x3B, 0x06, 0x04, 0x05, 0x04, 0x0C, 0x3A, 0x06, 0x04, 0x05, 0x04, 0x0C, 0x3A,
+	0x06, 0x04, 0x05, 0x04, 0x0C, 0x3A, 0x06, 0x04, 0x05, 0x04, 0x0B, 0x3B, 0x06, 0x04, 0x05, 0x04,
+	0x09, 0x3D, 0x06, 0x04, 0x05, 0x04, 0x06, 0x40, 0x06, 0x04, 0x05, 0x04, 0x06, 0x40, 0x06, 0x04,
+	0x05, 0x04, 0x06, 0x40, 0x06, 0x04, 0x05, 0x04, 0x06, 0x40, 0x06, 0x04, 0x05, 0x04, 0x06, 0x40,
+	0x06, 0x04, 0x05, 0x04, 0x06, 0x40, 0x06, 0x04, 0x05, 0x04, 0x06, 0x3F, 0x07, 0x04, 0x05, 0x04,
+	0x07, 0x3D, 0x08, 0x04, 0x05, 0x04, 0x08, 0x3B, 0x08, 0x05, 0x05, 0x05, 0x08, 0x3A, 0x07, 0x06,
+	0x05, 0x06, 0x07, 0x39, 0x07, 0x06, 0x07, 0x06, 0x07, 0x38, 0x06, 0x05, 0x0B, 0x05, 0x06, 0x37,
+	0x06, 0x05, 0x0D, 0x05, 0x06, 0x36, 0x06, 0x04, 0x0F, 0x04, 0x06, 0x35, 0x06, 0x04, 0x11, 0x04,
+	0x05, 0x35, 0x06, 0x04, 0x11, 0x04, 0x06, 0x34, 0x06, 0x04, 0x11, 0x04, 0x06, 0x34, 0x06, 0x03,
+	0x13, 0x03, 0x06, 0x34, 0x06, 0x03, 0x13, 0x03, 0x06, 0x34, 0x06, 0x03, 0x13, 0x03, 0x06, 0x34,
+	0x06, 0x03, 0x13, 0x03, 0x06, 0x34, 0x06, 0x04, 0x11, 0x04, 0x06, 0x34, 0x06, 0x04, 0x11, 0x04,
+	0x06, 0x35, 0x05, 0x04, 0x10, 0x05, 0x05, 0x36, 0x06, 0x04, 0x0F, 0x04, 0x06, 0x36, 0x06, 0x05,
+	0x0D, 0x05, 0x06, 0x37, 0x06, 0x05, 0x0B, 0x05, 0x06, 0x38, 0x07, 0x06, 0x07, 0x06, 0x07, 0x39,
+	0x07, 0x11, 0x07, 0x3A, 0x08, 0x0F, 0x08, 0x3B, 0x09, 0x0B, 0x09, 0x3D, 0x0B, 0x05, 0x0B, 0x3F,
+	0x19, 0x41, 0x17, 0x44, 0x13, 0x47, 0x11, 0x4B, 0x0B, 0xFF, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
+	0x03, 0x1E, 0x0A, 0x2D, 0x05, 0x1C, 0x0D, 0x2A, 0x07, 0x1B, 0x0E, 0x28, 0x09, 0x1A, 0x0F, 0x27,
+	0x09, 0x1B, 0x0F, 0x25, 0x0B, 0x1B, 0x0E, 0x24, 0x0D, 0x22, 0x06, 0x23, 0x0F, 0x22, 0x06, 0x21,
+	0x08, 0x01, 0x07, 0x22, 0x06, 0x21, 0x07, 0x03, 0x07, 0x21, 0x06, 0x20, 0x07, 0x05, 0x07, 0x20,
+	0x06, 0x1F, 0x07, 0x07, 0x07, 0x1F, 0x06, 0x1F, 0x06, 0x08, 0x07, 0x1F, 0x06, 0x1E, 0x07, 0x09,
+	0x07, 0x1E, 0x06, 0x1D, 0x07, 0x0B, 0x07, 0x1D, 0x06, 0x1D, 0x06, 0x0C, 0x07, 0x19, 0x0A, 0x1C,
+	0x07, 0x0D, 0x07, 0x17, 0x0B, 0x1C, 0x06, 0x0F, 0x06, 0x17, 0x0B, 0x1B, 0x06, 0x10, 0x07, 0x16,
+	0x0B, 0x1A, 0x07, 0x11, 0x06, 0x16, 0x0B, 0x1A, 0x06, 0x13, 0x06, 0x17, 0x09, 0x19, 0x07, 0x13,
+	0x06, 0x1A, 0x06, 0x19, 0x06, 0x15, 0x06, 0x19, 0x06, 0x18, 0x07, 0x15, 0x06, 0x19, 0x06, 0x18,
+	0x23, 0x18, 0x06, 0x17, 0x25, 0x17, 0x06, 0x17, 0x25, 0x17, 0x06, 0x16, 0x27, 0x16, 0x06, 0x16,
+	0x27, 0x16, 0x06, 0x16, 0x27, 0x16, 0x06, 0x15, 0x06, 0x1D, 0x06, 0x15, 0x06, 0x15, 0x06, 0x1D,
+	0x06, 0x10, 0x0B, 0x14, 0x06, 0x1E, 0x06, 0x10, 0x0B, 0x14, 0x06, 0x1F, 0x06, 0x0F, 0x0B, 0x14,
+	0x06, 0x1F, 0x06, 0x0F, 0x0B, 0x13, 0x06, 0x21, 0x05, 0x0F, 0x0B, 0x13, 0x06, 0x21, 0x06, 0x13,
+	0x06, 0x13, 0x06, 0x21, 0x06, 0x13, 0x06, 0x13, 0x06, 0x21, 0x06, 0x13, 0x06, 0x13, 0x05, 0x23,
+	0x05, 0x13, 0x06, 0x12, 0x06, 0x23, 0x05, 0x13, 0x06, 0x12, 0x06, 0x23, 0x06, 0x12, 0x06, 0x12,
+	0x06, 0x23, 0x06, 0x12, 0x06, 0x12, 0x06, 0x23, 0x06, 0x12, 0x06, 0x12, 0x06, 0x23, 0x06, 0x12,
+	0x06, 0x12, 0x06, 0x23, 0x06, 0x12, 0x06, 0x12, 0x06, 0x23, 0x05, 0x10, 0x09, 0x13, 0x05, 0x23,
+	0x05, 0x0E, 0x0B, 0x13, 0x06, 0x21, 0x06, 0x0E, 0x0B, 0x13, 0x06, 0x21, 0x06, 0x0E, 0x0B, 0x13,
+	0x06, 0x21, 0x06, 0x0E, 0x0B, 0x14, 0x06, 0x1F, 0x06, 0x10, 0x0A, 0x14, 0x06, 0x1F, 0x06, 0x14,
+	0x06, 0x14, 0x07, 0x1D, 0x06, 0x15, 0x06, 0x15, 0x07, 0x1B, 0x07, 0x15, 0x06, 0x16, 0x06, 0x1A,
+	0x07, 0x16, 0x06, 0x16, 0x07, 0x19, 0x07, 0x16, 0x06, 0x17, 0x08, 0x15, 0x08, 0x17, 0x06, 0x18,
+	0x08, 0x13, 0x08, 0x18, 0x06, 0x19, 0x09, 0x0F, 0x09, 0x19, 0x06, 0x1A, 0x0A, 0x0B, 0x0A, 0x19,
+	0x06, 0x1C, 0x1D, 0x12, 0x0E, 0x1D, 0x1B, 0x12, 0x0F, 0x1E, 0x18, 0x13, 0x0F, 0x21, 0x15, 0x14,
+	0x0E, 0x25, 0x0F, 0x17, 0x0D, 0x29, 0x09, 0x1B, 0x0A, 0xFF, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x9B,
+	0x05, 0x53, 0x07, 0x51, 0x08, 0x50, 0x09, 0x4F, 0x0A, 0x4E, 0x0B, 0x4D, 0x0C, 0x4C, 0x0D, 0x4B,
+	0x08, 0x01, 0x05, 0x4A, 0x08, 0x02, 0x05, 0x49, 0x08, 0x03, 0x05, 0x48, 0x08, 0x04, 0x05, 0x48,
+	0x07, 0x05, 0x05, 0x07, 0x03, 0x3D, 0x07, 0x06, 0x05, 0x06, 0x05, 0x3B, 0x07, 0x07, 0x05, 0x06,
+	0x06, 0x39, 0x07, 0x08, 0x05, 0x06, 0x07, 0x37, 0x07, 0x09, 0x05, 0x06, 0x08, 0x36, 0x07, 0x09,
+	0x05, 0x06, 0x08, 0x35, 0x07, 0x0A, 0x05, 0x06, 0x09, 0x33, 0x07, 0x0B, 0x05, 0x06, 0x0A, 0x31,
+	0x07, 0x0C, 0x05, 0x06, 0x0B, 0x30, 0x07, 0x0C, 0x05, 0x06, 0x0B, 0x2F, 0x07, 0x0D, 0x05, 0x06,
+	0x0C, 0x2D, 0x07, 0x0E, 0x05, 0x06, 0x05, 0x01, 0x07, 0x2C, 0x06, 0x0F, 0x06, 0x04, 0x06, 0x02,
+	0x06, 0x2B, 0x07, 0x0F, 0x10, 0x02, 0x07, 0x2A, 0x06, 0x11, 0x0E, 0x04, 0x06, 0x29, 0x07, 0x11,
+	0x0E, 0x04, 0x07, 0x28, 0x06, 0x13, 0x0C, 0x06, 0x06, 0x27, 0x06, 0x15, 0x0A, 0x08, 0x06, 0x26,
+	0x06, 0x17, 0x06, 0x0A, 0x06, 0x25, 0x06, 0x29, 0x06, 0x24, 0x06, 0x29, 0x06, 0x23, 0x06, 0x2B,
+	0x06, 0x22, 0x06, 0x2B, 0x06, 0x22, 0x06, 0x2B, 0x06, 0x21, 0x06, 0x2D, 0x06, 0x20, 0x06, 0x15,
+	0x03, 0x15, 0x06, 0x20, 0x06, 0x13, 0x07, 0x13, 0x06, 0x20, 0x05, 0x14, 0x07, 0x14, 0x05, 0x1F,
+	0x06, 0x13, 0x09, 0x13, 0x06, 0x1E, 0x06, 0x12, 0x0B, 0x12, 0x06, 0x1E, 0x06, 0x11, 0x0D, 0x11,
+	0x06, 0x1E, 0x06, 0x10, 0x0F, 0x10, 0x06, 0x1E, 0x06, 0x0F, 0x08, 0x01, 0x08, 0x0F, 0x06, 0x1E,
+	0x05, 0x10, 0x07, 0x03, 0x07, 0x10, 0x05, 0x1E, 0x05, 0x0F, 0x07, 0x05, 0x07, 0x0F, 0x05, 0x1E,
+	0x06, 0x0D, 0x07, 0x07, 0x07, 0x0D, 0x06, 0x1E, 0x06, 0x0D, 0x06, 0x09, 0x06, 0x0D, 0x06, 0x1E,
+	0x06, 0x0C, 0x07, 0x09, 0x07, 0x0C, 0x06, 0x1E, 0x06, 0x0B, 0x07, 0x0B, 0x07, 0x0B, 0x06, 0x1E,
+	0x06, 0x0B, 0x06, 0x0D, 0x06, 0x0B, 0x06, 0x1F, 0x05, 0x0B, 0x06, 0x0D, 0x06, 0x0B, 0x05, 0x20,
+	0x06, 0x09, 0x06, 0x0F, 0x06, 0x09, 0x06, 0x20, 0x06, 0x09, 0x06, 0x0F, 0x06, 0x09, 0x06, 0x20,
+	0x06, 0x08, 0x06, 0x11, 0x06, 0x08, 0x06, 0x21, 0x06, 0x07, 0x06, 0x11, 0x06, 0x07, 0x06, 0x22,
+	0x06, 0x07, 0x06, 0x11, 0x06, 0x07, 0x06, 0x23, 0x06, 0x06, 0x06, 0x11, 0x06, 0x06, 0x06, 0x24,
+	0x07, 0x05, 0x05, 0x13, 0x05, 0x05, 0x07, 0x25, 0x06, 0x05, 0x05, 0x13, 0x05, 0x05, 0x06, 0x26,
+	0x07, 0x04, 0x05, 0x13, 0x05, 0x04, 0x07, 0x27, 0x07, 0x03, 0x05, 0x13, 0x05, 0x03, 0x07, 0x29,
+	0x07, 0x02, 0x06, 0x11, 0x06, 0x02, 0x07, 0x2A, 0x08, 0x01, 0x06, 0x11, 0x06, 0x01, 0x08, 0x2B,
+	0x0F, 0x0F, 0x0F, 0x2D, 0x0E, 0x0F, 0x0E, 0x2F, 0x0E, 0x0D, 0x0E, 0x31, 0x0E, 0x0A, 0x0F, 0x34,
+	0x0F, 0x05, 0x0F, 0x37, 0x21, 0x3A, 0x1D, 0x3D, 0x1B, 0x41, 0x15, 0x47, 0x0F, 0x50, 0x03, 0xFF,
+	0xFF, 0x43, 0xFF, 0x34, 0x09, 0x4D, 0x0F, 0x48, 0x13, 0x45, 0x16, 0x41, 0x19, 0x3F, 0x0D, 0x01,
+	0x0D, 0x3D, 0x09, 0x0B, 0x09, 0x3C, 0x07, 0x0E, 0x08, 0x3B, 0x07, 0x11, 0x07, 0x39, 0x07, 0x13,
+	0x07, 0x38, 0x06, 0x15, 0x06, 0x37, 0x07, 0x15, 0x07, 0x36, 0x06, 0x17, 0x06, 0x36, 0x06, 0x17,
+	0x06, 0x35, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19,
+	0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19,
+	0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19,
+	0x06, 0x34, 0x06, 0x06, 0x0D, 0x06, 0x06, 0x34, 0x06, 0x03, 0x13, 0x03, 0x06, 0x34, 0x25, 0x34,
+	0x25, 0x34, 0x25, 0x34, 0x10, 0x05, 0x10, 0x34, 0x0B, 0x0F, 0x0B, 0x33, 0x0A, 0x13, 0x0A, 0x31,
+	0x09, 0x17, 0x09, 0x2F, 0x08, 0x1B, 0x08, 0x2D, 0x08, 0x1D, 0x08, 0x2B, 0x07, 0x21, 0x07, 0x29,
+	0x07, 0x23, 0x07, 0x28, 0x06, 0x25, 0x06, 0x27, 0x07, 0x25, 0x07, 0x25, 0x07, 0x27, 0x07, 0x24,
+	0x06, 0x29, 0x06, 0x23, 0x07, 0x10, 0x09, 0x10, 0x07, 0x22, 0x06, 0x10, 0x0B, 0x10, 0x06, 0x22,
+	0x06, 0x0F, 0x0D, 0x0F, 0x06, 0x21, 0x06, 0x0F, 0x0F, 0x0F, 0x06, 0x20, 0x06, 0x0E, 0x11, 0x0E,
+	0x06, 0x20, 0x05, 0x0F, 0x11, 0x0F, 0x05, 0x1F, 0x06, 0x0F, 0x11, 0x0F, 0x06, 0x1E, 0x06, 0x0E,
+	0x13, 0x0E, 0x06, 0x1E, 0x06, 0x0E, 0x13, 0x0E, 0x06, 0x1E, 0x06, 0x0E, 0x13, 0x0E, 0x06, 0x1E,
+	0x06, 0x0E, 0x13, 0x0E, 0x06, 0x1E, 0x05, 0x10, 0x11, 0x10, 0x05, 0x1E, 0x05, 0x10, 0x11, 0x10,
+	0x05, 0x1E, 0x05, 0x11, 0x0F, 0x11, 0x05, 0x1E, 0x06, 0x10, 0x0F, 0x10, 0x06, 0x1E, 0x06, 0x11,
+	0x0D, 0x11, 0x06, 0x1E, 0x06, 0x12, 0x0B, 0x12, 0x06, 0x1E, 0x06, 0x14, 0x07, 0x14, 0x06, 0x1E,
+	0x06, 0x14, 0x07, 0x14, 0x06, 0x1F, 0x05, 0x14, 0x07, 0x14, 0x05, 0x20, 0x06, 0x13, 0x07, 0x13,
+	0x06, 0x20, 0x06, 0x13, 0x07, 0x13, 0x06, 0x21, 0x06, 0x12, 0x07, 0x12, 0x06, 0x22, 0x06, 0x12,
+	0x07, 0x12, 0x06, 0x22, 0x07, 0x11, 0x07, 0x11, 0x07, 0x23, 0x06, 0x11, 0x07, 0x11, 0x06, 0x24,
+	0x07, 0x11, 0x05, 0x11, 0x07, 0x25, 0x07, 0x25, 0x07, 0x27, 0x07, 0x23, 0x07, 0x28, 0x07, 0x23,
+	0x07, 0x29, 0x08, 0x20, 0x07, 0x2B, 0x08, 0x1D, 0x08, 0x2D, 0x08, 0x1B, 0x08, 0x2F, 0x09, 0x17,
+	0x09, 0x31, 0x0A, 0x13, 0x0A, 0x33, 0x0B, 0x0F, 0x0B, 0x35, 0x10, 0x03, 0x10, 0x38, 0x1F, 0x3B,
+	0x1D, 0x3E, 0x19, 0x43, 0x13, 0x49, 0x0D, 0x7F, 0xFF, 0x34, 0x09, 0x4D, 0x0F, 0x48, 0x13, 0x45,
+	0x16, 0x41, 0x19, 0x3F, 0x0D, 0x01, 0x0D, 0x3D, 0x09, 0x0B, 0x09, 0x3C, 0x07, 0x0E, 0x08, 0x3B,
+	0x07, 0x11, 0x07, 0x39, 0x07, 0x13, 0x07, 0x38, 0x06, 0x15, 0x06, 0x37, 0x07, 0x15, 0x07, 0x36,
+	0x06, 0x17, 0x06, 0x36, 0x06, 0x17, 0x06, 0x35, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34,
+	0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x19, 0x06, 0x34, 0x06, 0x1A, 0x05, 0x34,
+	0x06, 0x1A, 0x04, 0x35, 0x06, 0x53, 0x06, 0x53, 0x06, 0x53, 0x06, 0x53, 0x06, 0x53, 0x06, 0x06,
+	0x0D, 0x40, 0x06, 0x03, 0x13, 0x3D, 0x1F, 0x3A, 0x21, 0x38, 0x22, 0x37, 0x10, 0x05, 0x0F, 0x35,
+	0x0B, 0x0F, 0x0B, 0x33, 0x0A, 0x13, 0x0A, 0x31, 0x09, 0x17, 0x09, 0x2F, 0x08, 0x1B, 0x08, 0x2D,
+	0x08, 0x1D, 0x08, 0x2B, 0x07, 0x21, 0x07, 0x29, 0x07, 0x23, 0x07, 0x28, 0x06, 0x25, 0x06, 0x27,
+	0x07, 0x25, 0x07, 0x25, 0x07, 0x27, 0x07, 0x24, 0x06, 0x29, 0x06, 0x23, 0x07, 0x10, 0x09, 0x10,
+	0x07, 0x22, 0x06, 0x10, 0x0B, 0x10, 0x06, 0x22, 0x06, 0x0F, 0x0D, 0x0F, 0x06, 0x21, 0x06, 0x0F,
+	0x0F, 0x0F, 0x06, 0x20, 0x06, 0x0E, 0x11, 0x0E, 0x06, 0x20, 0x05, 0x0F, 0x11, 0x0F, 0x05, 0x1F,
+	0x06, 0x0F, 0x11, 0x0F, 0x06, 0x1E, 0x06, 0x0E, 0x13, 0x0E, 0x06, 0x1E, 0x06, 0x0E, 0x13, 0x0E,
+	0x06, 0x1E, 0x06, 0x0E, 0x13, 0x0E, 0x06, 0x1E, 0x06, 0x0E, 0x13, 0x0E, 0x06, 0x1E, 0x05, 0x10,
+	0x11, 0x10, 0x05, 0x1E, 0x05, 0x10, 0x11, 0x10, 0x05, 0x1E, 0x05, 0x11, 0x0F, 0x11, 0x05, 0x1E,
+	0x06, 0x10, 0x0F, 0x10, 0x06, 0x1E, 0x06, 0x11, 0x0D, 0x11, 0x06, 0x1E, 0x06, 0x12, 0x0B, 0x12,
+	0x06, 0x1E, 0x06, 0x14, 0x07, 0x14, 0x06, 0x1E, 0x06, 0x14, 0x07, 0x14, 0x06, 0x1F, 0x05, 0x14,
+	0x07, 0x14, 0x05, 0x20, 0x06, 0x13, 0x07, 0x13, 0x06, 0x20, 0x06, 0x13, 0x07, 0x13, 0x06, 0x21,
+	0x06, 0x12, 0x07, 0x12, 0x06, 0x22, 0x06, 0x12, 0x07, 0x12, 0x06, 0x22, 0x07, 0x11, 0x07, 0x11,
+	0x07, 0x23, 0x06, 0x11, 0x07, 0x11, 0x06, 0x24, 0x07, 0x11, 0x05, 0x11, 0x07, 0x25, 0x07, 0x25,
+	0x07, 0x27, 0x07, 0x23, 0x07, 0x28, 0x07, 0x23, 0x07, 0x29, 0x08, 0x20, 0x07, 0x2B, 0x08, 0x1D,
+	0x08, 0x2D, 0x08, 0x1B, 0x08, 0x2F, 0x09, 0x17, 0x09, 0x31, 0x0A, 0x13, 0x0A, 0x33, 0x0B, 0x0F,
+	0x0B, 0x35, 0x10, 0x03, 0x10, 0x38, 0x1F, 0x3B, 0x1D, 0x3E, 0x19, 0x43, 0x13, 0x49, 0x0D, 0x7F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x09, 0x19, 0x09, 0x2B, 0x0F, 0x13, 0x0F, 0x26, 0x13, 0x0F, 0x13,
+	0x22, 0x16, 0x0C, 0x17, 0x1F, 0x19, 0x09, 0x19, 0x1D, 0x1B, 0x07, 0x1B, 0x1B, 0x0A, 0x0A, 0x09,
+	0x05, 0x09, 0x0A, 0x0A, 0x19, 0x09, 0x0E, 0x08, 0x03, 0x08, 0x0E, 0x09, 0x17, 0x08, 0x11, 0x08,
+	0x01, 0x08, 0x11, 0x08, 0x16, 0x07, 0x13, 0x0F, 0x13, 0x07, 0x15, 0x07, 0x15, 0x0D, 0x15, 0x07,
+	0x13, 0x07, 0x17, 0x0B, 0x17, 0x07, 0x12, 0x06, 0x19, 0x09, 0x19, 0x06, 0x12, 0x06, 0x1A, 0x07,
+	0x1A, 0x06, 0x11, 0x06, 0x1C, 0x05, 0x1C, 0x06, 0x10, 0x06, 0x1C, 0x05, 0x1C, 0x06, 0x10, 0x06,
+	0x1E, 0x01, 0x1E, 0x06, 0x10, 0x05, 0x3F, 0x05, 0x0F, 0x06, 0x3F, 0x05, 0x0F, 0x06, 0x3F, 0x06,
+	0x0E, 0x06, 0x3F, 0x06, 0x0E, 0x06, 0x3F, 0x05, 0x10, 0x05, 0x3F, 0x05, 0x10, 0x06, 0x3D, 0x06,
+	0x10, 0x06, 0x3D, 0x06, 0x10, 0x06, 0x3D, 0x06, 0x11, 0x06, 0x3B, 0x06, 0x12, 0x06, 0x3B, 0x06,
+	0x12, 0x07, 0x39, 0x07, 0x13, 0x07, 0x37, 0x07, 0x15, 0x06, 0x37, 0x06, 0x16, 0x07, 0x35, 0x07,
+	0x17, 0x07, 0x33, 0x07, 0x18, 0x08, 0x31, 0x07, 0x1A, 0x08, 0x2F, 0x08, 0x1B, 0x07, 0x2F, 0x07,
+	0x1D, 0x07, 0x2D, 0x07, 0x1F, 0x07, 0x2B, 0x07, 0x21, 0x07, 0x29, 0x07, 0x22, 0x08, 0x27, 0x08,
+	0x23, 0x08, 0x25, 0x08, 0x25, 0x08, 0x23, 0x08, 0x27, 0x08, 0x21, 0x08, 0x29, 0x08, 0x1F, 0x08,
+	0x2B, 0x08, 0x1D, 0x08, 0x2D, 0x08, 0x1B, 0x08, 0x2F, 0x08, 0x19, 0x08, 0x31, 0x08, 0x17, 0x08,
+	0x33, 0x08, 0x15, 0x08, 0x35, 0x08, 0x13, 0x08, 0x37, 0x08, 0x11, 0x08, 0x39, 0x08, 0x0F, 0x08,
+	0x3B, 0x08, 0x0D, 0x08, 0x3D, 0x09, 0x09, 0x09, 0x40, 0x08, 0x07, 0x09, 0x42, 0x08, 0x05, 0x08,
+	0x45, 0x08, 0x03, 0x08, 0x47, 0x08, 0x01, 0x08, 0x49, 0x0F, 0x4B, 0x0D, 0x4D, 0x0B, 0x4F, 0x09,
+	0x51, 0x07, 0x53, 0x05, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xE0, 0x03, 0x0F, 0x03,
+	0x40, 0x0B, 0x07, 0x0B, 0x3A, 0x0F, 0x03, 0x0F, 0x37, 0x11, 0x01, 0x11, 0x36, 0x23, 0x35, 0x25,
+	0x34, 0x07, 0x05, 0x0D, 0x06, 0x06, 0x33, 0x06, 0x09, 0x09, 0x09, 0x06, 0x32, 0x06, 0x0A, 0x07,
+	0x0A, 0x06, 0x32, 0x05, 0x0C, 0x06, 0x0B, 0x05, 0x32, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x32, 0x05,
+	0x0C, 0x05, 0x0C, 0x06, 0x30, 0x06, 0x0C, 0x05, 0x0C, 0x06, 0x2E, 0x08, 0x0C, 0x05, 0x0C, 0x08,
+	0x2A, 0x0A, 0x0C, 0x05, 0x0C, 0x0A, 0x26, 0x0B, 0x0D, 0x05, 0x0D, 0x0B, 0x22, 0x0D, 0x0D, 0x05,
+	0x0D, 0x0D, 0x1F, 0x0C, 0x07, 0x02, 0x06, 0x05, 0x06, 0x02, 0x07, 0x0C, 0x1D, 0x0A, 0x09, 0x05,
+	0x04, 0x05, 0x05, 0x04, 0x09, 0x0A, 0x1B, 0x09, 0x0A, 0x06, 0x04, 0x05, 0x04, 0x06, 0x0A, 0x09,
+	0x19, 0x08, 0x0C, 0x06, 0x04, 0x05, 0x04, 0x06, 0x0C, 0x08, 0x17, 0x08, 0x0E, 0x05, 0x04, 0x05,
+	0x04, 0x06, 0x0D, 0x08, 0x15, 0x08, 0x0E, 0x06, 0x04, 0x05, 0x04, 0x06, 0x0E, 0x08, 0x14, 0x07,
+	0x0F, 0x06, 0x04, 0x05, 0x04, 0x06, 0x0F, 0x07, 0x13, 0x07, 0x0E, 0x08, 0x04, 0x05, 0x04, 0x08,
+	0x0E, 0x07, 0x12, 0x06, 0x0B, 0x0B, 0x05, 0x05, 0x05, 0x0B, 0x0B, 0x06, 0x11, 0x06, 0x0B, 0x0C,
+	0x05, 0x05, 0x05, 0x0C, 0x0B, 0x06, 0x10, 0x06, 0x0B, 0x0B, 0x06, 0x05, 0x06, 0x0B, 0x0B, 0x06,
+	0x10, 0x06, 0x0B, 0x09, 0x08, 0x05, 0x08, 0x09, 0x0B, 0x06, 0x10, 0x05, 0x0D, 0x06, 0x0A, 0x05,
+	0x0A, 0x06, 0x0D, 0x05, 0x10, 0x05, 0x1D, 0x05, 0x1D, 0x06, 0x0F, 0x05, 0x1D, 0x05, 0x1D, 0x06,
+	0x0F, 0x05, 0x1D, 0x05, 0x1D, 0x06, 0x0F, 0x05, 0x06, 0x09, 0x0E, 0x05, 0x0E, 0x09, 0x06, 0x05,
+	0x10, 0x06, 0x04, 0x0C, 0x0C, 0x05, 0x0C, 0x0C, 0x04, 0x06, 0x10, 0x06, 0x02, 0x10, 0x0A, 0x05,
+	0x0A, 0x10, 0x02, 0x06, 0x10, 0x06, 0x01, 0x12, 0x09, 0x05, 0x09, 0x12, 0x01, 0x06, 0x11, 0x19,
+	0x08, 0x05, 0x08, 0x19, 0x12, 0x0D, 0x04, 0x08, 0x08, 0x05, 0x08, 0x08, 0x04, 0x0D, 0x12, 0x0B,
+	0x08, 0x07, 0x07, 0x05, 0x07, 0x07, 0x08, 0x0B, 0x13, 0x09, 0x0A, 0x06, 0x07, 0x05, 0x07, 0x06,
+	0x0A, 0x09, 0x14, 0x08, 0x0C, 0x05, 0x07, 0x05, 0x07, 0x05, 0x0C, 0x08, 0x15, 0x06, 0x0E, 0x03,
+	0x08, 0x05, 0x08, 0x03, 0x0E, 0x06, 0x16, 0x06, 0x19, 0x05, 0x19, 0x06, 0x16, 0x06, 0x19, 0x05,
+	0x1A, 0x05, 0x16, 0x05, 0x1A, 0x05, 0x1A, 0x05, 0x15, 0x06, 0x1A, 0x05, 0x1A, 0x06, 0x14, 0x06,
+	0x1A, 0x05, 0x1A, 0x06, 0x14, 0x06, 0x1A, 0x05, 0x1A, 0x06, 0x14, 0x06, 0x09, 0x07, 0x0A, 0x05,
+	0x0A, 0x07, 0x09, 0x06, 0x14, 0x06, 0x08, 0x09, 0x09, 0x05, 0x09, 0x09, 0x08, 0x06, 0x14, 0x06,
+	0x08, 0x0A, 0x08, 0x05, 0x08, 0x0A, 0x08, 0x06, 0x14, 0x06, 0x08, 0x0B, 0x07, 0x05, 0x07, 0x0B,
+	0x08, 0x06, 0x15, 0x05, 0x09, 0x0B, 0x06, 0x05, 0x06, 0x0B, 0x09, 0x06, 0x15, 0x05, 0x0D, 0x07,
+	0x06, 0x05, 0x06, 0x07, 0x0D, 0x05, 0x16, 0x06, 0x0D, 0x06, 0x06, 0x05, 0x06, 0x06, 0x0D, 0x06,
+	0x16, 0x06, 0x0E, 0x06, 0x05, 0x05, 0x05, 0x06, 0x0E, 0x06, 0x17, 0x06, 0x0D, 0x06, 0x05, 0x05,
+	0x05, 0x06, 0x0D, 0x06, 0x18, 0x06, 0x0D, 0x06, 0x05, 0x05, 0x05, 0x06, 0x0D, 0x06, 0x19, 0x06,
+	0x0C, 0x06, 0x05, 0x05, 0x05, 0x06, 0x0C, 0x07, 0x19, 0x08, 0x0A, 0x06, 0x05, 0x05, 0x05, 0x06,
+	0x0B, 0x07, 0x1B, 0x08, 0x0A, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0A, 0x08, 0x1D, 0x09, 0x08, 0x05,
+	0x05, 0x05, 0x06, 0x04, 0x08, 0x09, 0x1E, 0x0C, 0x06, 0x02, 0x07, 0x05, 0x07, 0x02, 0x06, 0x0C,
+	0x20, 0x0C, 0x0D, 0x05, 0x0D, 0x0D, 0x22, 0x0B, 0x0D, 0x05, 0x0D, 0x0B, 0x25, 0x0B, 0x0C, 0x05,
+	0x0C, 0x0B, 0x28, 0x09, 0x0C, 0x05, 0x0C, 0x09, 0x2D, 0x06, 0x0C, 0x05, 0x0C, 0x06, 0x31, 0x05,
+	0x0C, 0x05, 0x0C, 0x05, 0x32, 0x05, 0x0B, 0x07, 0x0B, 0x05, 0x32, 0x06, 0x0A, 0x07, 0x0A, 0x06,
+	0x33, 0x08, 0x05, 0x0B, 0x06, 0x08, 0x33, 0x25, 0x35, 0x23, 0x36, 0x23, 0x38, 0x0F, 0x01, 0x0F,
+	0x3C, 0x0B, 0x05, 0x0B, 0xFF, 0xFF, 0x37, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x0F, 0x47,
+	0x15, 0x42, 0x1A, 0x3D, 0x1E, 0x39, 0x22, 0x35, 0x0F, 0x08, 0x0E, 0x33, 0x0C, 0x10, 0x0C, 0x2F,
+	0x0B, 0x15, 0x0B, 0x2D, 0x0A, 0x19, 0x0B, 0x29, 0x0B, 0x1C, 0x0A, 0x27, 0x0A, 0x0C, 0x07, 0x0D,
+	0x09, 0x25, 0x09, 0x09, 0x11, 0x09, 0x0A, 0x21, 0x0A, 0x07, 0x17, 0x08, 0x09, 0x1F, 0x0A, 0x05,
+	0x1D, 0x06, 0x0A, 0x1B, 0x0A, 0x05, 0x21, 0x05, 0x0A, 0x19, 0x0A, 0x05, 0x23, 0x06, 0x0A, 0x15,
+	0x0A, 0x06, 0x0C, 0x0D, 0x0C, 0x06, 0x0A, 0x11, 0x0C, 0x07, 0x09, 0x13, 0x09, 0x07, 0x0C, 0x0A,
+	0x0F, 0x08, 0x07, 0x17, 0x07, 0x09, 0x0E, 0x05, 0x0E, 0x0B, 0x03, 0x1D, 0x03, 0x0B, 0x0E, 0x04,
+	0x0C, 0x3D, 0x0C, 0x04, 0x0B, 0x3F, 0x0B, 0x04, 0x08, 0x45, 0x08, 0x06, 0x02, 0x4D, 0x02, 0x6E,
+	0x35, 0x24, 0x35, 0x24, 0x35, 0x24, 0x35, 0x25, 0x33, 0x70, 0x05, 0x49, 0x05, 0x05, 0x09, 0x43,
+	0x09, 0x04, 0x0B, 0x3F, 0x0B, 0x04, 0x0D, 0x3B, 0x0D, 0x04, 0x0F, 0x0A, 0x04, 0x1B, 0x05, 0x0A,
+	0x0E, 0x06, 0x0E, 0x09, 0x07, 0x16, 0x07, 0x08, 0x0E, 0x0C, 0x0B, 0x07, 0x0A, 0x11, 0x0A, 0x07,
+	0x0B, 0x12, 0x0B, 0x06, 0x0D, 0x0A, 0x0D, 0x06, 0x0A, 0x16, 0x0A, 0x05, 0x24, 0x04, 0x0A, 0x1A,
+	0x0A, 0x05, 0x20, 0x05, 0x0A, 0x1C, 0x0A, 0x06, 0x1C, 0x06, 0x09, 0x20, 0x09, 0x08, 0x16, 0x07,
+	0x0A, 0x22, 0x0A, 0x09, 0x10, 0x09, 0x09, 0x25, 0x0A, 0x1F, 0x0A, 0x28, 0x0A, 0x1B, 0x0B, 0x2A,
+	0x0B, 0x18, 0x0A, 0x2E, 0x0B, 0x14, 0x0B, 0x30, 0x0D, 0x0E, 0x0C, 0x34, 0x10, 0x03, 0x11, 0x37,
+	0x20, 0x3B, 0x1C, 0x3F, 0x18, 0x43, 0x13, 0x4A, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x13, 0x11, 0x44, 0x19, 0x3D, 0x1F, 0x37, 0x25, 0x32, 0x29, 0x2E,
+	0x12, 0x09, 0x12, 0x2A, 0x0F, 0x13, 0x0F, 0x27, 0x0C, 0x1B, 0x0C, 0x24, 0x0C, 0x1F, 0x0C, 0x21,
+	0x0B, 0x23, 0x0B, 0x1F, 0x0A, 0x27, 0x0A, 0x1D, 0x09, 0x2B, 0x09, 0x1B, 0x09, 0x2D, 0x09, 0x19,
+	0x08, 0x31, 0x08, 0x17, 0x08, 0x33, 0x08, 0x15, 0x08, 0x15, 0x0B, 0x15, 0x08, 0x13, 0x08, 0x13,
+	0x11, 0x13, 0x08, 0x11, 0x07, 0x14, 0x13, 0x13, 0x08, 0x0F, 0x08, 0x12, 0x17, 0x12, 0x08, 0x0D,
+	0x08, 0x12, 0x19, 0x12, 0x07, 0x0D, 0x07, 0x12, 0x0B, 0x05, 0x0B, 0x12, 0x07, 0x0B, 0x07, 0x12,
+	0x09, 0x0B, 0x09, 0x12, 0x07, 0x0A, 0x06, 0x13, 0x07, 0x0F, 0x07, 0x13, 0x06, 0x09, 0x07, 0x12,
+	0x07, 0x11, 0x07, 0x12, 0x07, 0x07, 0x07, 0x12, 0x07, 0x13, 0x07, 0x12, 0x07, 0x06, 0x06, 0x13,
+	0x06, 0x15, 0x06, 0x13, 0x06, 0x05, 0x07, 0x13, 0x06, 0x15, 0x06, 0x13, 0x07, 0x04, 0x06, 0x13,
+	0x06, 0x17, 0x06, 0x13, 0x06, 0x04, 0x06, 0x13, 0x06, 0x17, 0x06, 0x13, 0x06, 0x03, 0x06, 0x14,
+	0x06, 0x17, 0x06, 0x14, 0x06, 0x02, 0x06, 0x14, 0x05, 0x19, 0x05, 0x14, 0x06, 0x02, 0x05, 0x15,
+	0x05, 0x19, 0x05, 0x15, 0x05, 0x01, 0x06, 0x15, 0x05, 0x19, 0x05, 0x15, 0x0C, 0x15, 0x05, 0x19,
+	0x05, 0x15, 0x0C, 0x15, 0x05, 0x19, 0x05, 0x15, 0x0B, 0x16, 0x06, 0x17, 0x06, 0x16, 0x05, 0x02,
+	0x02, 0x17, 0x06, 0x17, 0x06, 0x17, 0x02, 0x1D, 0x06, 0x17, 0x06, 0x37, 0x06, 0x15, 0x06, 0x38,
+	0x06, 0x15, 0x06, 0x39, 0x06, 0x13, 0x06, 0x3A, 0x07, 0x11, 0x07, 0x3B, 0x07, 0x0F, 0x07, 0x3C,
+	0x09, 0x0B, 0x09, 0x3D, 0x0B, 0x05, 0x0B, 0x3F, 0x19, 0x41, 0x17, 0x44, 0x13, 0x48, 0x0F, 0x4C,
+	0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xBF, 0x02, 0x56, 0x04, 0x54,
+	0x06, 0x52, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x31,
+	0x11, 0x0F, 0x07, 0x2E, 0x19, 0x0A, 0x07, 0x2C, 0x1D, 0x08, 0x07, 0x2A, 0x1F, 0x08, 0x07, 0x29,
+	0x20, 0x08, 0x07, 0x28, 0x12, 0x08, 0x07, 0x08, 0x07, 0x27, 0x0F, 0x1B, 0x07, 0x27, 0x0C, 0x1E,
+	0x09, 0x24, 0x0C, 0x1F, 0x0C, 0x21, 0x0B, 0x20, 0x0E, 0x1F, 0x0A, 0x21, 0x10, 0x1D, 0x09, 0x22,
+	0x07, 0x02, 0x09, 0x1B, 0x09, 0x22, 0x07, 0x04, 0x09, 0x18, 0x09, 0x23, 0x07, 0x07, 0x08, 0x16,
+	0x09, 0x23, 0x07, 0x09, 0x08, 0x15, 0x08, 0x15, 0x06, 0x08, 0x07, 0x0B, 0x08, 0x13, 0x08, 0x13,
+	0x08, 0x08, 0x07, 0x0D, 0x08, 0x11, 0x08, 0x13, 0x08, 0x08, 0x07, 0x0F, 0x08, 0x0F, 0x08, 0x12,
+	0x09, 0x08, 0x07, 0x11, 0x08, 0x0D, 0x08, 0x12, 0x09, 0x08, 0x08, 0x12, 0x07, 0x0D, 0x07, 0x12,
+	0x09, 0x08, 0x0A, 0x12, 0x07, 0x0B, 0x07, 0x12, 0x09, 0x08, 0x0C, 0x12, 0x07, 0x0A, 0x06, 0x13,
+	0x07, 0x09, 0x0D, 0x13, 0x06, 0x09, 0x07, 0x12, 0x07, 0x09, 0x0F, 0x12, 0x07, 0x07, 0x07, 0x12,
+	0x07, 0x09, 0x07, 0x03, 0x07, 0x12, 0x07, 0x06, 0x06, 0x13, 0x06, 0x09, 0x07, 0x05, 0x06, 0x13,
+	0x06, 0x05, 0x07, 0x13, 0x06, 0x08, 0x07, 0x06, 0x06, 0x13, 0x06, 0x05, 0x06, 0x13, 0x06, 0x08,
+	0x07, 0x08, 0x06, 0x13, 0x06, 0x04, 0x06, 0x13, 0x05, 0x08, 0x07, 0x09, 0x06, 0x13, 0x06, 0x03,
+	0x06, 0x14, 0x04, 0x08, 0x07, 0x0A, 0x06, 0x14, 0x06, 0x02, 0x06, 0x14, 0x03, 0x08, 0x07, 0x0C,
+	0x05, 0x14, 0x06, 0x02, 0x05, 0x15, 0x02, 0x08, 0x07, 0x0D, 0x05, 0x15, 0x05, 0x01, 0x06, 0x15,
+	0x01, 0x08, 0x07, 0x0E, 0x05, 0x15, 0x0C, 0x1D, 0x07, 0x0F, 0x05, 0x15, 0x0C, 0x1C, 0x07, 0x10,
+	0x05, 0x15, 0x0B, 0x1C, 0x07, 0x10, 0x06, 0x16, 0x05, 0x02, 0x02, 0x1C, 0x07, 0x11, 0x06, 0x17,
+	0x02, 0x21, 0x07, 0x12, 0x06, 0x39, 0x07, 0x12, 0x06, 0x39, 0x07, 0x13, 0x06, 0x38, 0x08, 0x12,
+	0x07, 0x37, 0x09, 0x11, 0x07, 0x37, 0x0B, 0x0F, 0x07, 0x37, 0x0E, 0x0B, 0x09, 0x36, 0x12, 0x05,
+	0x0B, 0x36, 0x07, 0x02, 0x19, 0x36, 0x07, 0x04, 0x17, 0x36, 0x07, 0x07, 0x13, 0x37, 0x07, 0x0A,
+	0x0F, 0x38, 0x07, 0x0D, 0x0B, 0x39, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51,
+	0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x51, 0x07, 0x52, 0x06, 0x54,
+	0x04, 0x56, 0x02, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0x0B, 0x4A, 0x13, 0x44,
+	0x17, 0x40, 0x1B, 0x3D, 0x1E, 0x39, 0x0F, 0x03, 0x0F, 0x37, 0x0B, 0x0D, 0x0B, 0x35, 0x09, 0x13,
+	0x09, 0x33, 0x08, 0x17, 0x08, 0x31, 0x08, 0x19, 0x08, 0x2F, 0x08, 0x1B, 0x08, 0x2D, 0x08, 0x1D,
+	0x08, 0x2C, 0x07, 0x1F, 0x07, 0x2B, 0x07, 0x21, 0x07, 0x2A, 0x06, 0x23, 0x06, 0x29, 0x06, 0x25,
+	0x06, 0x28, 0x06, 0x25, 0x06, 0x27, 0x06, 0x27, 0x06, 0x26, 0x06, 0x27, 0x06, 0x26, 0x05, 0x29,
+	0x05, 0x25, 0x06, 0x29, 0x06, 0x24, 0x06, 0x29, 0x06, 0x24, 0x06, 0x29, 0x06, 0x24, 0x05, 0x2B,
+	0x05, 0x1E, 0x0B, 0x2B, 0x0B, 0x16, 0x0D, 0x2B, 0x0D, 0x12, 0x0F, 0x2B, 0x0F, 0x0E, 0x11, 0x2B,
+	0x11, 0x0B, 0x11, 0x2D, 0x11, 0x09, 0x10, 0x31, 0x10, 0x07, 0x09, 0x41, 0x09, 0x06, 0x07, 0x45,
+	0x07, 0x05, 0x07, 0x47, 0x07, 0x04, 0x06, 0x49, 0x06, 0x03, 0x06, 0x4B, 0x06, 0x02, 0x06, 0x4B,
+	0x06, 0x02, 0x05, 0x4D, 0x05, 0x01, 0x06, 0x4D, 0x0C, 0x4D, 0x0C, 0x4D, 0x0C, 0x4D, 0x0C, 0x4D,
+	0x0C, 0x4D, 0x0C, 0x4D, 0x0C, 0x4D, 0x06, 0x01, 0x06, 0x4B, 0x06, 0x02, 0x06, 0x4B, 0x06, 0x02,
+	0x07, 0x49, 0x07, 0x03, 0x07, 0x47, 0x07, 0x05, 0x07, 0x45, 0x07, 0x06, 0x09, 0x41, 0x09, 0x07,
+	0x0B, 0x3B, 0x0B, 0x09, 0x4F, 0x0B, 0x4D, 0x0D, 0x4B, 0x10, 0x47, 0x15, 0x41, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0x9D, 0x01, 0x56, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54,
+	0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x3E, 0x01, 0x15, 0x05, 0x15, 0x01, 0x26,
+	0x04, 0x16, 0x01, 0x16, 0x04, 0x24, 0x05, 0x2B, 0x05, 0x23, 0x07, 0x29, 0x07, 0x23, 0x07, 0x27,
+	0x07, 0x25, 0x07, 0x25, 0x07, 0x27, 0x07, 0x23, 0x07, 0x29, 0x06, 0x0D, 0x09, 0x0D, 0x06, 0x2B,
+	0x05, 0x0A, 0x0F, 0x0A, 0x05, 0x2D, 0x03, 0x09, 0x13, 0x09, 0x03, 0x38, 0x17, 0x41, 0x19, 0x3F,
+	0x1B, 0x3D, 0x0A, 0x09, 0x0A, 0x3B, 0x08, 0x0E, 0x09, 0x39, 0x08, 0x11, 0x08, 0x37, 0x08, 0x13,
+	0x08, 0x36, 0x07, 0x15, 0x07, 0x35, 0x07, 0x17, 0x07, 0x34, 0x06, 0x19, 0x06, 0x33, 0x06, 0x1A,
+	0x07, 0x32, 0x06, 0x1B, 0x06, 0x32, 0x06, 0x1B, 0x06, 0x31, 0x06, 0x1D, 0x06, 0x30, 0x06, 0x1D,
+	0x06, 0x20, 0x0A, 0x06, 0x06, 0x1D, 0x06, 0x06, 0x0A, 0x10, 0x0A, 0x06, 0x06, 0x1D, 0x06, 0x06,
+	0x0A, 0x0F, 0x0C, 0x05, 0x06, 0x1D, 0x06, 0x05, 0x0C, 0x0F, 0x0A, 0x06, 0x06, 0x1D, 0x06, 0x06,
+	0x0A, 0x10, 0x0A, 0x06, 0x06, 0x1D, 0x06, 0x06, 0x0A, 0x20, 0x06, 0x1D, 0x06, 0x30, 0x06, 0x1D,
+	0x06, 0x31, 0x06, 0x1B, 0x06, 0x32, 0x06, 0x1B, 0x06, 0x32, 0x07, 0x19, 0x07, 0x33, 0x06, 0x19,
+	0x06, 0x34, 0x07, 0x17, 0x07, 0x35, 0x07, 0x15, 0x07, 0x36, 0x08, 0x13, 0x08, 0x37, 0x08, 0x11,
+	0x08, 0x39, 0x09, 0x0D, 0x09, 0x3B, 0x0A, 0x09, 0x0A, 0x3D, 0x1B, 0x3F, 0x19, 0x41, 0x17, 0x38,
+	0x03, 0x09, 0x13, 0x09, 0x03, 0x2D, 0x05, 0x0A, 0x0F, 0x0A, 0x05, 0x2B, 0x06, 0x0D, 0x08, 0x0E,
+	0x06, 0x29, 0x07, 0x23, 0x07, 0x27, 0x07, 0x25, 0x07, 0x25, 0x07, 0x27, 0x07, 0x24, 0x06, 0x29,
+	0x06, 0x24, 0x05, 0x2B, 0x05, 0x24, 0x04, 0x16, 0x01, 0x16, 0x04, 0x3C, 0x05, 0x54, 0x05, 0x54,
+	0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x56,
+	0x01, 0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0xFF, 0xFE, 0x09, 0x4D, 0x0F, 0x48, 0x13, 0x44, 0x17, 0x40,
+	0x1B, 0x3D, 0x1D, 0x3B, 0x0A, 0x0B, 0x0A, 0x39, 0x09, 0x0F, 0x09, 0x37, 0x08, 0x13, 0x08, 0x36,
+	0x07, 0x15, 0x07, 0x35, 0x07, 0x17, 0x07, 0x33, 0x07, 0x19, 0x07, 0x32, 0x06, 0x1B, 0x06, 0x31,
+	0x06, 0x1D, 0x06, 0x30, 0x06, 0x1D, 0x06, 0x30, 0x05, 0x1F, 0x05, 0x2F, 0x06, 0x1F, 0x06, 0x2E,
+	0x06, 0x1F, 0x06, 0x2E, 0x05, 0x21, 0x05, 0x2E, 0x05, 0x21, 0x05, 0x2D, 0x06, 0x21, 0x06, 0x26,
+	0x0C, 0x21, 0x0C, 0x1E, 0x0E, 0x21, 0x0E, 0x1A, 0x10, 0x21, 0x10, 0x17, 0x10, 0x22, 0x11, 0x15,
+	0x11, 0x23, 0x11, 0x13, 0x0A, 0x33, 0x0A, 0x11, 0x08, 0x39, 0x08, 0x10, 0x07, 0x3B, 0x07, 0x0F,
+	0x07, 0x3D, 0x07, 0x0E, 0x06, 0x3F, 0x06, 0x0D, 0x06, 0x41, 0x06, 0x0C, 0x06, 0x41, 0x06, 0x0C,
+	0x06, 0x41, 0x06, 0x0C, 0x05, 0x43, 0x05, 0x0C, 0x05, 0x43, 0x05, 0x0C, 0x05, 0x43, 0x05, 0x0C,
+	0x05, 0x43, 0x05, 0x0C, 0x05, 0x43, 0x05, 0x0C, 0x06, 0x41, 0x06, 0x0C, 0x06, 0x41, 0x06, 0x0C,
+	0x07, 0x3F, 0x07, 0x0D, 0x06, 0x3F, 0x06, 0x0E, 0x07, 0x3D, 0x07, 0x0F, 0x07, 0x3B, 0x07, 0x11,
+	0x08, 0x37, 0x08, 0x12, 0x47, 0x13, 0x45, 0x15, 0x43, 0x18, 0x3F, 0x1C, 0x3B, 0x20, 0x37, 0x26,
+	0x07, 0x0E, 0x06, 0x0E, 0x07, 0x29, 0x06, 0x0E, 0x07, 0x0D, 0x07, 0x29, 0x07, 0x0D, 0x07, 0x0E,
+	0x06, 0x2A, 0x06, 0x0E, 0x06, 0x0E, 0x07, 0x29, 0x06, 0x0E, 0x07, 0x0E, 0x06, 0x29, 0x07, 0x0E,
+	0x06, 0x0E, 0x07, 0x29, 0x06, 0x0E, 0x07, 0x0D, 0x07, 0x29, 0x07, 0x0E, 0x06, 0x0E, 0x06, 0x2A,
+	0x06, 0x0E, 0x06, 0x0E, 0x07, 0x29, 0x06, 0x0E, 0x07, 0x0E, 0x06, 0x29, 0x07, 0x0E, 0x06, 0x0E,
+	0x07, 0x29, 0x06, 0x0E, 0x07, 0x0E, 0x06, 0x2A, 0x06, 0x0E, 0x06, 0x0F, 0x05, 0x2B, 0x05, 0x10,
+	0x04, 0x10, 0x05, 0x2C, 0x03, 0x12, 0x02, 0x12, 0x03, 0xFF, 0xFF, 0xFF, 0xF3,
+};
+
+/**
+ * @brief 89x89 compressed icon offsets.
+ */
+const uint32_t icon89_rle_offset[] = {
+	0, 215, 500, 785, 1070, 1355, 1628, 2193,
+	2713, 3151, 3471, 3736, 3792, 3880, 4017, 4224,
+	4536, 4807, 5143, 5596, 5899, 6077, 6273, 6550,
+	6827, 7105, 7631, 7847, 8274, 8702, 9160, 9618,
+	9944, 10355, 10660, 10870, 11269, 11590, 11901, 12134,
+	12502, 12734, 12898, 13141, 13465, 13818, 14193, 14534,
+	14797, 15148, 15500, 15871, 16251, 16621, 17042, 17416,
+	17776, 18059, 18647, 18895, 19161, 19526, 19731, 20020,
+};
+
+icon_font_t icon_89_rle = {
+    89,
+    89,
+    0,
+    icon89_rle_data,
+    icon89_rle_offset
+};
+
+/*==================[end of file]============================================*/
@@ -15,7 +15,16 @@
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include "format.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "hal/gpio_ll.h"
+#include <string.h>
+#include <stdlib.h>
 /*==================[macros and definitions]=================================*/
+#undef NULL						/* Used for integer fields in this file */
 #define NULL 0
 
 #define SPI_BR 20000000				/*!< Frequency of sck for SPI communication */
@@ -23,6 +32,13 @@
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
 #define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
+#define DMA_CHUNK_SIZE 4092			/*!< Bytes per DMA transfer (SPI bus max_transfer_sz, even: whole pixels) */
+#define GLYPH_CACHE_ENTRIES 32		/*!< Maximum number of glyphs in cache */
+#define GLYPH_RUN_MAX 64			/*!< Maximum number of characters drawn as a single window */
+#define SPRITE_GROUP_MAX 16			/*!< Maximum number of side by side icons drawn as a single window */
+#define CMD_LIST_MAX 8		/*!< Transactions of a command list */
+#define CMD_SEGMENT_MAX 4	/*!< Bytes of each command list transaction (copied by the SPI driver) */
+#define FB_DIRTY_MAX 8				/*!< Maximum number of dirty rectangles tracked by the framebuffer */
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
@@ -40,7 +56,9 @@
 #define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
 #define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
 #define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define VERT_SCROLL_DEF		0x33 	/*!< Defines the vertical scrolling area of the display */
 #define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
+#define VERT_SCROLL_START	0x37 	/*!< Frame memory line shown at the start of the vertical scrolling area */
 #define PIXEL_FORMAT_SET	0x3A 	/*!< Sets the pixel format for the RGB image data used by the interface */
 #define WRITE_DISP_BRIGHT	0x51 	/*!< Adjust the brightness value of the display */
 #define WRITE_CTRL_DISP		0x53 	/*!< Control display brightness */
@@ -62,6 +80,9 @@
 #define EN_3_GAMMA			0xF2	/*!< 3 gamma control enable */
 #define PUMP_RATIO_CTRL		0xF7	/*!< Pump ratio control */
 
+#define DC_COMMAND	((void*)0)		/*!< D/C line low: command byte */
+#define DC_DATA		((void*)1)		/*!< D/C line high: parameters or data */
+
 #define HighByte(x) x >> 8			/*!< High byte of a 16 bits data */
 #define LowByte(x) x & 0xFF			/*!< Low byte of a 16 bits data */
 /*==================[typedef]================================================*/
@@ -82,6 +103,48 @@ typedef struct {
     uint32_t databytes; 	/*!< Number of bytes of data to transmit */
     uint8_t *data;			/*!< Pointer to data or parameters array */
 } lcd_cmd_t;
+
+/**
+ * @brief Commands and parameters grouped in transactions (consecutive bytes with the same D/C level)
+ */
+typedef struct {
+	uint8_t num;									/*!< Transactions in the list */
+	void *dc[CMD_LIST_MAX];							/*!< D/C level of each transaction */
+	uint8_t len[CMD_LIST_MAX];						/*!< Bytes of each transaction */
+	uint8_t bytes[CMD_LIST_MAX][CMD_SEGMENT_MAX];	/*!< Commands or parameters of each transaction */
+} cmd_list_t;
+
+/**
+ * @brief Rectangle of the LCD (inclusive coordinates)
+ */
+typedef struct {
+	int16_t x0;		/*!< Start column */
+	int16_t y0;		/*!< Start row */
+	int16_t x1;		/*!< End column */
+	int16_t y1;		/*!< End row */
+} lcd_rect_t;
+
+/**
+ * @brief Glyph expanded to RGB565 (cache entry)
+ */
+typedef struct {
+	const Font_t *font;		/*!< Font */
+	char c;					/*!< Character */
+	uint16_t foreground;	/*!< Foreground color */
+	uint16_t background;	/*!< Background color */
+	uint32_t last_use;		/*!< Value of glyph_clock on last use (LRU) */
+	uint32_t size;			/*!< Bytes of pixels */
+	uint8_t *pixels;		/*!< Pixels (2 bytes/pixel, high byte first), NULL: free entry */
+} glyph_entry_t;
+
+/**
+ * @brief Run length decoder state (formats described in tools/bitmap_rle.py)
+ */
+typedef struct {
+	const uint8_t *src;		/*!< Next compressed byte */
+	uint32_t run;			/*!< Pixels left in the current run */
+	bool flag;				/*!< 1 bit/pixel: run is foreground, RGB565: run repeats one pixel */
+} rle_state_t;
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -93,15 +156,49 @@ typedef struct {
  */
 void WriteLCD(lcd_cmd_t * data);
 
+/**
+ * @brief  		Queue command and parameters/data to LCD, without waiting for the transfer
+ * @note		data->data must not be modified until SpiQueueWait() (except for up to 4 bytes, that are copied)
+ * @param[in]  	data: Structure with the command and parameters/data to send
+ * @retval 		Number of SPI transactions queued (rejected ones are not counted)
+ */
+uint8_t QueueLCD(lcd_cmd_t * data);
+
+/**
+ * @brief  		Drive D/C line before each SPI transaction (called from the SPI ISR, 
+ * 				which runs from IRAM, so it must not call flash code)
+ * @param[in]  	dc: DC_COMMAND or DC_DATA
+ * @retval 		None
+ */
+void IRAM_ATTR SetDC(void *dc);
+
+/**
+ * @brief  		Add a command and its parameters to a command list
+ * @param[in]  	list: Command list
+ * @param[in]  	cmd: Command
+ * @param[in]  	params: Parameters
+ * @param[in]  	n: Number of parameters
+ * @retval 		None
+ */
+void CmdListAdd(cmd_list_t *list, uint8_t cmd, const uint8_t *params, uint8_t n);
+
+/**
+ * @brief  		Queue the transactions of a command list and empty it
+ * @param[in]  	list: Command list
+ * @retval 		Number of SPI transactions queued (rejected ones are not counted)
+ */
+uint8_t CmdListQueue(cmd_list_t *list);
+
 /**
  * @brief  		Define an area of frame memory where MCU can access
+ * @note		Only the addresses that differ from the last window are sent
  * @param[in]  	x1: Start column
  * @param[in]  	y1: Start row
  * @param[in]  	x2: End column
  * @param[in]  	y2: End row
- * @retval 		None
+ * @retval 		Number of SPI transactions queued
  */
-void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+uint8_t SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
 /**
  * @brief  		Fill an srea of LCD with a determined color
@@ -114,6 +211,182 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  */
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Fill an horizontal or vertical span (or any area), clipped to the LCD
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void FillSpan(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draw the 8 symmetric spans of a circle outline for consecutive points with the same y
+ * @param[in]  	x0: X center
+ * @param[in]  	y0: Y center
+ * @param[in]  	x_start: First x of the points (relative to center)
+ * @param[in]  	x_end: Last x of the points (relative to center)
+ * @param[in]  	y: Y of the points (relative to center)
+ * @param[in]	color: color
+ * @retval 		None
+ */
+void CircleSpans(int16_t x0, int16_t y0, int16_t x_start, int16_t x_end, int16_t y, uint16_t color);
+
+/**
+ * @brief  		Blend a color over a framebuffer pixel
+ * @param[in]  	x: Column
+ * @param[in]  	y: Row
+ * @param[in]	color: color
+ * @param[in]	alpha: Opacity of color (0: transparent, 256: opaque)
+ * @retval 		None
+ */
+void FbBlend(int16_t x, int16_t y, uint16_t color, uint16_t alpha);
+
+/**
+ * @brief  		Set the first frame memory line shown on the strip chart scrolling area
+ * @param[in]  	line: Frame memory line (LCD x in landscape)
+ * @retval 		Number of SPI transactions queued
+ */
+uint8_t ChartScroll(uint16_t line);
+
+/**
+ * @brief  		Free the strip chart buffers
+ * @retval 		None
+ */
+void ChartFree(void);
+
+/**
+ * @brief  		Open an area of LCD (or framebuffer) to be written with WindowWrite()
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @retval 		None
+ */
+void WindowBegin(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @brief  		Write pixels (2 bytes/pixel, high byte first) to the area opened by WindowBegin()
+ * @note		Consecutive calls continue where the previous one ended. Buffer can be reused after return
+ * @param[in]  	data: Pixels
+ * @param[in]  	bytes: Number of bytes
+ * @retval 		None
+ */
+void WindowWrite(const uint8_t *data, uint32_t bytes);
+
+/**
+ * @brief  		Add an area to the framebuffer dirty list, merging it with touching ones
+ * @param[in]  	rect: Area (already clipped to the band)
+ * @retval 		None
+ */
+void FbMarkDirty(lcd_rect_t rect);
+
+/**
+ * @brief  		Clip an area to the framebuffer band
+ * @param[inout]	rect: Area to clip (coordinates in any order)
+ * @retval 		false if the area is outside the band
+ */
+bool FbClip(lcd_rect_t *rect);
+
+/**
+ * @brief  		Queue the framebuffer dirty areas to the LCD, without waiting for the transfers
+ * @retval 		Number of SPI transactions queued
+ */
+uint16_t FbQueueFlush(void);
+
+/**
+ * @brief  		Draw a display list item with the immediate mode functions
+ * @param[in]  	item: Primitive to draw
+ * @retval 		None
+ */
+void RenderItem(const ili9341_dl_item_t *item);
+
+/**
+ * @brief  		Get a glyph from cache, expanding it if missing
+ * @note		Least recently used glyphs are freed to keep the cache budget, 
+ * 				except those used since keep_from
+ * @param[in]  	font: Font
+ * @param[in]  	c: Character
+ * @param[in]  	foreground: Foreground color
+ * @param[in]  	background: Background color
+ * @param[in]  	keep_from: Glyphs used since this value of glyph_clock can't be freed
+ * @retval 		Glyph pixels, NULL if it doesn't fit in the cache
+ */
+const uint8_t* GlyphGet(const Font_t *font, char c, uint16_t foreground, uint16_t background, uint32_t keep_from);
+
+/**
+ * @brief  		Decode pixels from a 1 bit/pixel run length encoded bitmap
+ * @param[inout]	rle: Decoder state (src pointing to the first run, run 0 and flag true before the first call)
+ * @param[out] 	dst: Pixels (2 bytes/pixel, high byte first)
+ * @param[in]  	pixels: Number of pixels to decode
+ * @param[in]  	foreground: Foreground color
+ * @param[in]  	background: Background color
+ * @retval 		None
+ */
+void RleExpandBits(rle_state_t *rle, uint8_t *dst, uint32_t pixels, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Decode pixels from a RGB565 run length encoded picture
+ * @param[inout]	rle: Decoder state (src pointing to the first header, run 0 before the first call)
+ * @param[out] 	dst: Pixels (2 bytes/pixel, high byte first)
+ * @param[in]  	pixels: Number of pixels to decode
+ * @retval 		None
+ */
+void RleExpandPixels(rle_state_t *rle, uint8_t *dst, uint32_t pixels);
+
+/**
+ * @brief  		Decode a run length encoded bitmap or picture to the area opened by WindowBegin()
+ * @note		Pixels are decoded in chunks on the DMA ping-pong buffers, while the previous chunk is sent
+ * @param[in]  	src: Compressed data
+ * @param[in]  	pixels: Number of pixels
+ * @param[in]  	bits: true: 1 bit/pixel bitmap, false: RGB565 picture
+ * @param[in]  	foreground: Foreground color (bitmaps)
+ * @param[in]  	background: Background color (bitmaps)
+ * @retval 		None
+ */
+void WindowWriteRle(const uint8_t *src, uint32_t pixels, bool bits, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Expand a row of a 1 bit/pixel bitmap (not compressed)
+ * @param[in]  	src: First byte of the row
+ * @param[out] 	dst: Pixels (2 bytes/pixel, high byte first)
+ * @param[in]  	width: Number of pixels
+ * @param[in]  	foreground: Foreground color
+ * @param[in]  	background: Background color
+ * @retval 		None
+ */
+void ExpandBitsRow(const uint8_t *src, uint8_t *dst, uint16_t width, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draw icons of the same size placed side by side (same row, adjacent) as a single window
+ * @param[in]  	sprites: Icons, from left to right
+ * @param[in]  	n: Number of icons (up to SPRITE_GROUP_MAX)
+ * @retval 		None
+ */
+void DrawSpriteGroup(const ili9341_sprite_t *sprites, uint8_t n);
+
+/**
+ * @brief  		Draw only the foreground pixels of an icon on the framebuffer
+ * @param[in]  	sprite: Icon
+ * @retval 		None
+ */
+void FbDrawSpriteTransparent(const ili9341_sprite_t *sprite);
+
+/**
+ * @brief  		Draw consecutive characters of a line as a single window, using cached glyphs
+ * @param[in]  	x: X position of the first character
+ * @param[in]  	y: Y position of the first character
+ * @param[in]  	str: Characters
+ * @param[in]  	font: Font
+ * @param[in]  	foreground: Foreground color
+ * @param[in]  	background: Background color (also used for the space between characters)
+ * @param[out] 	width: Width drawn in pixels (including the space after the last character)
+ * @retval 		Number of characters drawn, 0 if the first one can't be drawn from cache
+ */
+uint8_t DrawRun(uint16_t x, uint16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background, uint16_t *width);
+
 /*==================[internal data definition]===============================*/
 /**
  * @brief Initial LCD configuration parameters
@@ -180,9 +453,38 @@ spi_mcu_config_t spi_conf = {
 	.bitrate = SPI_BR, 
 	.transfer_mode = SPI_POLLING, 
 	.func_p = NULL,
-	.param_p = NULL };
+	.param_p = NULL,
+	.pre_func_p = SetDC };
 
 static spi_dev_t ili9341_spi;				/*!< uC SPI port */
+static uint8_t *fill_buf = NULL;			/*!< DMA buffer with DMA_CHUNK_SIZE bytes of the same color, sent repeatedly */
+static uint16_t fill_color;					/*!< Color currently stored in fill_buf */
+static bool fill_valid = false;				/*!< fill_buf holds fill_color */
+static uint8_t *bounce_buf[2] = {NULL};		/*!< DMA ping-pong buffers for pictures not DMA capable (flash) */
+static uint8_t *fb = NULL;					/*!< Framebuffer (2 bytes/pixel, high byte first), NULL: draw directly on LCD */
+static uint16_t fb_width, fb_height;		/*!< Framebuffer size (height of the band) */
+static uint16_t fb_y;						/*!< LCD row of the first framebuffer line */
+static lcd_rect_t fb_dirty[FB_DIRTY_MAX];	/*!< Areas modified since last flush */
+static uint8_t fb_dirty_num = 0;			/*!< Number of areas in fb_dirty */
+static lcd_rect_t win;						/*!< Area opened by WindowBegin() */
+static int16_t win_x, win_y;				/*!< Next pixel to write in the window */
+static uint8_t *render_buf[2] = {NULL};	/*!< Ping-pong band buffers of the display list renderer */
+static uint16_t render_rows;				/*!< Rows of each render band */
+static uint32_t render_cpu_us, render_frame_us;	/*!< Duration of the last ILI9341Render() (drawing / total) */
+static glyph_entry_t glyph_cache[GLYPH_CACHE_ENTRIES];	/*!< Cached glyphs */
+static uint32_t glyph_budget = 0;			/*!< Maximum bytes of cached glyphs, 0: cache disabled */
+static uint32_t glyph_used = 0;				/*!< Bytes of cached glyphs */
+static uint32_t glyph_clock = 0;			/*!< Incremented on each cache access */
+static uint32_t glyph_hits, glyph_misses;	/*!< Cache statistics */
+static ili9341_chart_config_t chart;		/*!< Strip chart configuration (range updated by autoscale) */
+static uint8_t *chart_grid[2] = {NULL};		/*!< Column templates: background with grid points, vertical grid line */
+static uint8_t *chart_col[2] = {NULL};		/*!< Ping-pong columns being drawn/sent */
+static uint16_t chart_x;					/*!< Next column to draw (LCD x) */
+static uint32_t chart_samples;				/*!< Columns drawn */
+static int16_t chart_last[ILI9341_CHART_TRACES];	/*!< Row of the last point of each trace, -1: none */
+static uint8_t chart_queued;				/*!< SPI transactions queued by the last column */
+static lcd_rect_t lcd_window;				/*!< Column and page addresses last sent to the LCD */
+static bool lcd_window_valid = false;		/*!< lcd_window matches the LCD */
 static gpio_t ili9341_dc, ili9341_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
 
 static orientation_properties_t lcd_orientation = {
@@ -193,24 +495,67 @@ static orientation_properties_t lcd_orientation = {
 
 /*==================[internal functions definition]==========================*/
 
-void WriteLCD(lcd_cmd_t * data){
-	SpiInit(&spi_conf);
+void IRAM_ATTR SetDC(void *dc){
+	/* gpio_t values are the GPIO numbers. The inline HAL write is IRAM safe, 
+	 * unlike GPIOOn()/GPIOOff() and gpio_set_level() */
+	gpio_ll_set_level(&GPIO, ili9341_dc, dc == DC_DATA);
+}
+
+uint8_t QueueLCD(lcd_cmd_t * data){
+	uint8_t transactions = 0;
+
 	/* If command is NULL don't send command */
 	if (data->cmd != NULL){
-		/* Send command */
-		GPIOOff(ili9341_dc);
-		SpiWrite(ili9341_spi, &data->cmd, 1);
+		/* Send command (D/C is driven by SetDC() before the transfer) */
+		transactions += SpiQueueWrite(ili9341_spi, &data->cmd, 1, DC_COMMAND);
 	}
 	/* If there are parameters or data to send */
 	if (data->databytes != NULL){
 		/* Send parameters or data */
-		GPIOOn(ili9341_dc);
-		SpiWrite(ili9341_spi, data->data, data->databytes);
+		transactions += SpiQueueWrite(ili9341_spi, data->data, data->databytes, DC_DATA);
 	}
+	return transactions;
 }
 
-void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+void WriteLCD(lcd_cmd_t * data){
+	QueueLCD(data);
+	/* Data buffer can be reused after return */
+	SpiQueueWait(ili9341_spi);
+}
+
+void CmdListAdd(cmd_list_t *list, uint8_t cmd, const uint8_t *params, uint8_t n){
+	void *dc = DC_COMMAND;
+	uint8_t byte = cmd;
+
+	for (uint8_t i = 0; i <= n; i++){
+		/* Bytes with the same D/C level go in the same transaction */
+		if (list->num == 0 || list->dc[list->num - 1] != dc || list->len[list->num - 1] == CMD_SEGMENT_MAX){
+			list->dc[list->num] = dc;
+			list->len[list->num] = 0;
+			list->num++;
+		}
+		list->bytes[list->num - 1][list->len[list->num - 1]++] = byte;
+		if (i < n){
+			dc = DC_DATA;
+			byte = params[i];
+		}
+	}
+}
+
+uint8_t CmdListQueue(cmd_list_t *list){
+	uint8_t transactions = 0;
+
+	/* Transactions up to CMD_SEGMENT_MAX bytes are copied, the list can be reused right away */
+	for (uint8_t i = 0; i < list->num; i++){
+		transactions += SpiQueueWrite(ili9341_spi, list->bytes[i], list->len[i], list->dc[i]);
+	}
+	list->num = 0;
+	return transactions;
+}
+
+uint8_t SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 	static uint16_t aux;
+	cmd_list_t list = {.num = 0};
 	/* The lower column must be send first */
 	if (x0 > x1){
 		aux = x0;
@@ -223,20 +568,41 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 		y0 = y1;
 		y1 = aux;
 	}
-	uint8_t columns[] = {HighByte(x0), LowByte(x0), HighByte(x1), LowByte(x1)};
-	lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
-	uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
-	lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
-	WriteLCD(&lcd_columns);
-	WriteLCD(&lcd_rows);
+	/* The LCD keeps the addresses: text on the same line only changes the columns */
+	if (!lcd_window_valid || x0 != lcd_window.x0 || x1 != lcd_window.x1){
+		uint8_t columns[] = {HighByte(x0), LowByte(x0), HighByte(x1), LowByte(x1)};
+		CmdListAdd(&list, COLUMN_ADDR_SET, columns, 4);
+	}
+	if (!lcd_window_valid || y0 != lcd_window.y0 || y1 != lcd_window.y1){
+		uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
+		CmdListAdd(&list, PAGE_ADDR_SET, rows, 4);
+	}
+	lcd_window.x0 = x0;
+	lcd_window.y0 = y0;
+	lcd_window.x1 = x1;
+	lcd_window.y1 = y1;
+	lcd_window_valid = true;
+	return CmdListQueue(&list);
 }
 
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	static uint16_t i;
-	static int32_t bytes_count;
-	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
+	int32_t bytes_count;
+	int16_t x_dist, y_dist;
+
+	if (fb != NULL){
+		lcd_rect_t rect = {x0, y0, x1, y1};
+		if (FbClip(&rect)){
+			for (int16_t y = rect.y0; y <= rect.y1; y++){
+				uint8_t *p = fb + ((y - fb_y) * fb_width + rect.x0) * 2;
+				for (int16_t x = rect.x0; x <= rect.x1; x++){
+					*p++ = HighByte(color);
+					*p++ = LowByte(color);
+				}
+			}
+			FbMarkDirty(rect);
+		}
+		return;
+	}
 	x_dist = x1 - x0;
 	y_dist = y1 - y0;
 	if (x0 > x1){
@@ -250,29 +616,647 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	/* Define area to fill */
 	SetCursorPosition(x0, y0, x1, y1);
 
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2){
-		pixel[i] = HighByte(color);
-		pixel[i + 1] = LowByte(color);
+	/* The buffer is only rewritten when the color changes (no transfer is using it here) */
+	if (!fill_valid || fill_color != color){
+		for (uint16_t i = 0; i < DMA_CHUNK_SIZE; i += 2){
+			fill_buf[i] = HighByte(color);
+			fill_buf[i + 1] = LowByte(color);
+		}
+		fill_color = color;
+		fill_valid = true;
 	}
 	/* Start writing LCD memory */
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+	QueueLCD(&lcd_write);
 
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
+	/* The same buffer is sent over and over: queue all the transfers and wait once */
+	while(bytes_count - DMA_CHUNK_SIZE > 0){
+		lcd_cmd_t lcd_pixel = {NULL, DMA_CHUNK_SIZE, fill_buf};
+		QueueLCD(&lcd_pixel);
+		bytes_count -= DMA_CHUNK_SIZE;
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
+	lcd_cmd_t lcd_pixel = {NULL, bytes_count, fill_buf};
 	WriteLCD(&lcd_pixel);
 }
 
+bool FbClip(lcd_rect_t *rect){
+	int16_t aux;
+	if (rect->x0 > rect->x1){
+		aux = rect->x0;
+		rect->x0 = rect->x1;
+		rect->x1 = aux;
+	}
+	if (rect->y0 > rect->y1){
+		aux = rect->y0;
+		rect->y0 = rect->y1;
+		rect->y1 = aux;
+	}
+	if (rect->x0 < 0){
+		rect->x0 = 0;
+	}
+	if (rect->x1 >= fb_width){
+		rect->x1 = fb_width - 1;
+	}
+	if (rect->y0 < fb_y){
+		rect->y0 = fb_y;
+	}
+	if (rect->y1 >= fb_y + fb_height){
+		rect->y1 = fb_y + fb_height - 1;
+	}
+	return (rect->x0 <= rect->x1) && (rect->y0 <= rect->y1);
+}
+
+void FbMarkDirty(lcd_rect_t rect){
+	uint8_t i = 0, best = 0;
+	int32_t grow, best_grow = INT32_MAX;
+	lcd_rect_t *d;
+
+	/* Merge with every area it overlaps or touches (the union may reach others) */
+	while (i < fb_dirty_num){
+		d = &fb_dirty[i];
+		if (rect.x0 <= d->x1 + 1 && d->x0 <= rect.x1 + 1 && rect.y0 <= d->y1 + 1 && d->y0 <= rect.y1 + 1){
+			rect.x0 = (d->x0 < rect.x0) ? d->x0 : rect.x0;
+			rect.y0 = (d->y0 < rect.y0) ? d->y0 : rect.y0;
+			rect.x1 = (d->x1 > rect.x1) ? d->x1 : rect.x1;
+			rect.y1 = (d->y1 > rect.y1) ? d->y1 : rect.y1;
+			fb_dirty[i] = fb_dirty[--fb_dirty_num];
+			i = 0;
+		}
+		else{
+			i++;
+		}
+	}
+	/* List full: merge with the area that grows the least */
+	if (fb_dirty_num == FB_DIRTY_MAX){
+		for (i = 0; i < fb_dirty_num; i++){
+			d = &fb_dirty[i];
+			grow = (int32_t)(((d->x1 > rect.x1) ? d->x1 : rect.x1) - ((d->x0 < rect.x0) ? d->x0 : rect.x0) + 1) *
+				(((d->y1 > rect.y1) ? d->y1 : rect.y1) - ((d->y0 < rect.y0) ? d->y0 : rect.y0) + 1) -
+				(int32_t)(d->x1 - d->x0 + 1) * (d->y1 - d->y0 + 1);
+			if (grow < best_grow){
+				best_grow = grow;
+				best = i;
+			}
+		}
+		d = &fb_dirty[best];
+		rect.x0 = (d->x0 < rect.x0) ? d->x0 : rect.x0;
+		rect.y0 = (d->y0 < rect.y0) ? d->y0 : rect.y0;
+		rect.x1 = (d->x1 > rect.x1) ? d->x1 : rect.x1;
+		rect.y1 = (d->y1 > rect.y1) ? d->y1 : rect.y1;
+		fb_dirty[best] = fb_dirty[--fb_dirty_num];
+	}
+	fb_dirty[fb_dirty_num++] = rect;
+}
+
+void FillSpan(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	int16_t aux;
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	if (x1 < 0 || y1 < 0 || x0 >= lcd_orientation.width || y0 >= lcd_orientation.height){
+		return;
+	}
+	Fill((x0 < 0) ? 0 : x0, (y0 < 0) ? 0 : y0, 
+		(x1 >= lcd_orientation.width) ? lcd_orientation.width - 1 : x1, 
+		(y1 >= lcd_orientation.height) ? lcd_orientation.height - 1 : y1, color);
+}
+
+void CircleSpans(int16_t x0, int16_t y0, int16_t x_start, int16_t x_end, int16_t y, uint16_t color){
+	if (x_start == 0){
+		/* Spans crossing the axes are drawn at once */
+		FillSpan(x0 - x_end, y0 + y, x0 + x_end, y0 + y, color);
+		FillSpan(x0 - x_end, y0 - y, x0 + x_end, y0 - y, color);
+		FillSpan(x0 + y, y0 - x_end, x0 + y, y0 + x_end, color);
+		FillSpan(x0 - y, y0 - x_end, x0 - y, y0 + x_end, color);
+		return;
+	}
+	/* Horizontal spans on top and bottom octants */
+	FillSpan(x0 + x_start, y0 + y, x0 + x_end, y0 + y, color);
+	FillSpan(x0 - x_end, y0 + y, x0 - x_start, y0 + y, color);
+	FillSpan(x0 + x_start, y0 - y, x0 + x_end, y0 - y, color);
+	FillSpan(x0 - x_end, y0 - y, x0 - x_start, y0 - y, color);
+	/* Vertical spans on left and right octants */
+	FillSpan(x0 + y, y0 + x_start, x0 + y, y0 + x_end, color);
+	FillSpan(x0 + y, y0 - x_end, x0 + y, y0 - x_start, color);
+	FillSpan(x0 - y, y0 + x_start, x0 - y, y0 + x_end, color);
+	FillSpan(x0 - y, y0 - x_end, x0 - y, y0 - x_start, color);
+}
+
+void FbBlend(int16_t x, int16_t y, uint16_t color, uint16_t alpha){
+	uint8_t *p;
+	uint16_t back;
+	uint32_t r, g, b;
+
+	if (x < 0 || x >= fb_width || y < fb_y || y >= fb_y + fb_height){
+		return;
+	}
+	p = fb + ((y - fb_y) * fb_width + x) * 2;
+	back = (p[0] << 8) | p[1];
+	/* Each RGB565 channel is mixed separately */
+	r = (((color >> 11) & 0x1F) * alpha + ((back >> 11) & 0x1F) * (256 - alpha)) >> 8;
+	g = (((color >> 5) & 0x3F) * alpha + ((back >> 5) & 0x3F) * (256 - alpha)) >> 8;
+	b = ((color & 0x1F) * alpha + (back & 0x1F) * (256 - alpha)) >> 8;
+	back = (r << 11) | (g << 5) | b;
+	p[0] = HighByte(back);
+	p[1] = LowByte(back);
+}
+
+uint8_t ChartScroll(uint16_t line){
+	uint8_t start[] = {HighByte(line), LowByte(line)};
+	lcd_cmd_t lcd_start = {VERT_SCROLL_START, 2, start};
+	/* Parameters are copied to the transaction, no need to wait */
+	return QueueLCD(&lcd_start);
+}
+
+void ChartFree(void){
+	for (uint8_t i = 0; i < 2; i++){
+		if (chart_grid[i] != NULL){
+			heap_caps_free(chart_grid[i]);
+			chart_grid[i] = NULL;
+		}
+		if (chart_col[i] != NULL){
+			heap_caps_free(chart_col[i]);
+			chart_col[i] = NULL;
+		}
+	}
+}
+
+uint16_t FbQueueFlush(void){
+	uint32_t bytes_count, chunk;
+	uint16_t transactions = 0;
+	uint8_t *p;
+	lcd_rect_t *r;
+
+	for (uint8_t i = 0; i < fb_dirty_num; i++){
+		r = &fb_dirty[i];
+		/* Wide areas are sent as whole lines: the band memory is contiguous */
+		if ((r->x1 - r->x0 + 1) * 2 >= fb_width){
+			r->x0 = 0;
+			r->x1 = fb_width - 1;
+		}
+		transactions += SetCursorPosition(r->x0, r->y0, r->x1, r->y1);
+		lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+		transactions += QueueLCD(&lcd_write);
+		p = fb + ((r->y0 - fb_y) * fb_width + r->x0) * 2;
+		if (r->x1 - r->x0 + 1 == fb_width){
+			bytes_count = (r->y1 - r->y0 + 1) * fb_width * 2;
+			while (bytes_count > 0){
+				chunk = (bytes_count > DMA_CHUNK_SIZE) ? DMA_CHUNK_SIZE : bytes_count;
+				lcd_cmd_t lcd_pixel = {NULL, chunk, p};
+				transactions += QueueLCD(&lcd_pixel);
+				p += chunk;
+				bytes_count -= chunk;
+			}
+		}
+		else{
+			/* One transfer per line */
+			for (int16_t y = r->y0; y <= r->y1; y++){
+				lcd_cmd_t lcd_pixel = {NULL, (r->x1 - r->x0 + 1) * 2, p};
+				transactions += QueueLCD(&lcd_pixel);
+				p += fb_width * 2;
+			}
+		}
+	}
+	fb_dirty_num = 0;
+	return transactions;
+}
+
+void RenderItem(const ili9341_dl_item_t *item){
+	switch(item->type){
+	case ILI9341_DL_FILL:
+		Fill(0, 0, lcd_orientation.width, lcd_orientation.height, item->color);
+		break;
+	case ILI9341_DL_PIXEL:
+		ILI9341DrawPixel(item->x0, item->y0, item->color);
+		break;
+	case ILI9341_DL_LINE:
+		ILI9341DrawLine(item->x0, item->y0, item->x1, item->y1, item->color);
+		break;
+	case ILI9341_DL_RECTANGLE:
+		ILI9341DrawRectangle(item->x0, item->y0, item->x1, item->y1, item->color);
+		break;
+	case ILI9341_DL_FILLED_RECTANGLE:
+		Fill(item->x0, item->y0, item->x1, item->y1, item->color);
+		break;
+	case ILI9341_DL_CIRCLE:
+		ILI9341DrawCircle(item->x0, item->y0, item->x1, item->color);
+		break;
+	case ILI9341_DL_FILLED_CIRCLE:
+		ILI9341DrawFilledCircle(item->x0, item->y0, item->x1, item->color);
+		break;
+	case ILI9341_DL_TRIANGLE:
+		ILI9341DrawTriangle(item->x0, item->y0, item->x1, item->y1, item->x2, item->y2, item->color);
+		break;
+	case ILI9341_DL_FILLED_TRIANGLE:
+		ILI9341DrawFilledTriangle(item->x0, item->y0, item->x1, item->y1, item->x2, item->y2, item->color);
+		break;
+	case ILI9341_DL_STRING:
+		ILI9341DrawString(item->x0, item->y0, (char*)item->data, item->font, item->color, item->background);
+		break;
+	case ILI9341_DL_PICTURE:
+		ILI9341DrawPicture(item->x0, item->y0, item->x1, item->y1, item->data);
+		break;
+	}
+}
+
+const uint8_t* GlyphGet(const Font_t *font, char c, uint16_t foreground, uint16_t background, uint32_t keep_from){
+	glyph_entry_t *e, *victim;
+	uint32_t size;
+	uint8_t width = font->info[c - ' '].width;
+	const uint8_t *src;
+	uint8_t *dst;
+
+	glyph_clock++;
+	for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+		e = &glyph_cache[i];
+		if (e->pixels != NULL && e->font == font && e->c == c && e->foreground == foreground && e->background == background){
+			e->last_use = glyph_clock;
+			glyph_hits++;
+			return e->pixels;
+		}
+	}
+	glyph_misses++;
+	size = font->font_height * width * 2;
+	if (size > glyph_budget){
+		return NULL;
+	}
+	/* Free least recently used glyphs until it fits and there is a free entry */
+	while (1){
+		victim = NULL;
+		e = NULL;
+		for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+			if (glyph_cache[i].pixels == NULL){
+				e = &glyph_cache[i];
+			}
+			else if (glyph_cache[i].last_use < keep_from && (victim == NULL || glyph_cache[i].last_use < victim->last_use)){
+				victim = &glyph_cache[i];
+			}
+		}
+		if (e != NULL && glyph_used + size <= glyph_budget){
+			break;
+		}
+		if (victim == NULL){
+			return NULL;
+		}
+		heap_caps_free(victim->pixels);
+		victim->pixels = NULL;
+		glyph_used -= victim->size;
+	}
+	e->pixels = heap_caps_malloc(size, MALLOC_CAP_DMA);
+	if (e->pixels == NULL){
+		return NULL;
+	}
+	e->font = font;
+	e->c = c;
+	e->foreground = foreground;
+	e->background = background;
+	e->size = size;
+	e->last_use = glyph_clock;
+	glyph_used += size;
+	if (font->compressed){
+		rle_state_t rle = {font->data + font->info[c - ' '].offset, 0, true};
+		RleExpandBits(&rle, e->pixels, size / 2, foreground, background);
+		return e->pixels;
+	}
+	/* Expand 1 bit/pixel rows (each one starts on a new byte) */
+	src = font->data + font->info[c - ' '].offset;
+	dst = e->pixels;
+	for (uint8_t i = 0; i < font->font_height; i++){
+		for (uint8_t j = 0; j < width; j++){
+			if (src[j / 8] & (MSK_BIT8 >> (j % 8))){
+				*dst++ = HighByte(foreground);
+				*dst++ = LowByte(foreground);
+			}
+			else{
+				*dst++ = HighByte(background);
+				*dst++ = LowByte(background);
+			}
+		}
+		src += (width + 7) / 8;
+	}
+	return e->pixels;
+}
+
+void RleExpandBits(rle_state_t *rle, uint8_t *dst, uint32_t pixels, uint16_t foreground, uint16_t background){
+	uint32_t n;
+	uint8_t high, low;
+
+	while (pixels > 0){
+		/* Next run: alternate colors, the length is a sum of bytes ended by one lower than 255 */
+		while (rle->run == 0){
+			rle->flag = !rle->flag;
+			do {
+				rle->run += *rle->src;
+			} while (*rle->src++ == 255);
+		}
+		n = (rle->run < pixels) ? rle->run : pixels;
+		high = rle->flag ? HighByte(foreground) : HighByte(background);
+		low = rle->flag ? LowByte(foreground) : LowByte(background);
+		rle->run -= n;
+		pixels -= n;
+		while (n--){
+			*dst++ = high;
+			*dst++ = low;
+		}
+	}
+}
+
+void RleExpandPixels(rle_state_t *rle, uint8_t *dst, uint32_t pixels){
+	uint32_t n;
+
+	while (pixels > 0){
+		if (rle->run == 0){
+			/* Header: literal pixels (< 128) or a repeated one */
+			rle->flag = (*rle->src >= 128);
+			rle->run = rle->flag ? *rle->src - 126 : *rle->src + 1;
+			rle->src++;
+		}
+		n = (rle->run < pixels) ? rle->run : pixels;
+		rle->run -= n;
+		pixels -= n;
+		if (rle->flag){
+			while (n--){
+				*dst++ = rle->src[0];
+				*dst++ = rle->src[1];
+			}
+			if (rle->run == 0){
+				rle->src += 2;
+			}
+		}
+		else{
+			memcpy(dst, rle->src, n * 2);
+			dst += n * 2;
+			rle->src += n * 2;
+		}
+	}
+}
+
+void WindowWriteRle(const uint8_t *src, uint32_t pixels, bool bits, uint16_t foreground, uint16_t background){
+	/* Bitmaps start with a background run: flag toggles before the first one */
+	rle_state_t rle = {src, 0, true};
+	uint32_t chunk;
+	uint8_t bounce = 0;
+
+	while (pixels > 0){
+		chunk = (pixels > DMA_CHUNK_SIZE / 2) ? DMA_CHUNK_SIZE / 2 : pixels;
+		if (fb == NULL){
+			SpiQueueWaitPending(ili9341_spi, 1);
+		}
+		if (bits){
+			RleExpandBits(&rle, bounce_buf[bounce], chunk, foreground, background);
+		}
+		else{
+			RleExpandPixels(&rle, bounce_buf[bounce], chunk);
+		}
+		if (fb != NULL){
+			WindowWrite(bounce_buf[bounce], chunk * 2);
+		}
+		else{
+			lcd_cmd_t lcd_pixels = {NULL, chunk * 2, bounce_buf[bounce]};
+			QueueLCD(&lcd_pixels);
+		}
+		bounce ^= 1;
+		pixels -= chunk;
+	}
+	if (fb == NULL){
+		SpiQueueWait(ili9341_spi);
+	}
+}
+
+void ExpandBitsRow(const uint8_t *src, uint8_t *dst, uint16_t width, uint16_t foreground, uint16_t background){
+	for (uint16_t j = 0; j < width; j++){
+		if (src[j / 8] & (MSK_BIT8 >> (j % 8))){
+			*dst++ = HighByte(foreground);
+			*dst++ = LowByte(foreground);
+		}
+		else{
+			*dst++ = HighByte(background);
+			*dst++ = LowByte(background);
+		}
+	}
+}
+
+void DrawSpriteGroup(const ili9341_sprite_t *sprites, uint8_t n){
+	rle_state_t src[SPRITE_GROUP_MAX];
+	const icon_font_t *icon_font = sprites[0].icon_font;
+	uint16_t row_bytes = 0, rows, chunk_rows;
+	uint8_t bounce = 0;
+	uint8_t *p;
+
+	/* Raw icons use src only, compressed ones are decoded row after row */
+	for (uint8_t k = 0; k < n; k++){
+		if (icon_font->rle_offset != NULL){
+			src[k] = (rle_state_t){icon_font->data + icon_font->rle_offset[sprites[k].icon], 0, true};
+		}
+		else{
+			src[k].src = icon_font->data + sprites[k].icon * icon_font->offset;
+		}
+		row_bytes += icon_font->width * 2;
+	}
+	WindowBegin(sprites[0].x, sprites[0].y, sprites[0].x + row_bytes / 2 - 1, sprites[0].y + icon_font->height - 1);
+
+	/* Rows are composed in the ping-pong buffers, sent by DMA while the next one is composed */
+	chunk_rows = DMA_CHUNK_SIZE / row_bytes;
+	for (uint16_t row = 0; row < icon_font->height; row += rows){
+		rows = (icon_font->height - row < chunk_rows) ? icon_font->height - row : chunk_rows;
+		if (fb == NULL){
+			SpiQueueWaitPending(ili9341_spi, 1);
+		}
+		p = bounce_buf[bounce];
+		for (uint16_t i = 0; i < rows; i++){
+			for (uint8_t k = 0; k < n; k++){
+				if (icon_font->rle_offset != NULL){
+					RleExpandBits(&src[k], p, icon_font->width, sprites[k].foreground, sprites[k].background);
+				}
+				else{
+					ExpandBitsRow(src[k].src, p, icon_font->width, sprites[k].foreground, sprites[k].background);
+					src[k].src += (icon_font->width + 7) / 8;
+				}
+				p += icon_font->width * 2;
+			}
+		}
+		if (fb != NULL){
+			WindowWrite(bounce_buf[bounce], rows * row_bytes);
+		}
+		else{
+			lcd_cmd_t lcd_pixels = {NULL, rows * row_bytes, bounce_buf[bounce]};
+			QueueLCD(&lcd_pixels);
+		}
+		bounce ^= 1;
+	}
+	if (fb == NULL){
+		SpiQueueWait(ili9341_spi);
+	}
+}
+
+void FbDrawSpriteTransparent(const ili9341_sprite_t *sprite){
+	const icon_font_t *icon_font = sprite->icon_font;
+	rle_state_t src = {icon_font->data + sprite->icon * icon_font->offset, 0, true};
+	lcd_rect_t rect = {sprite->x, sprite->y, sprite->x + icon_font->width - 1, sprite->y + icon_font->height - 1};
+	uint8_t *mask = bounce_buf[0];
+	int16_t x, y;
+
+	if (icon_font->rle_offset != NULL){
+		src.src = icon_font->data + icon_font->rle_offset[sprite->icon];
+	}
+	for (uint16_t i = 0; i < icon_font->height; i++){
+		/* Row expanded as a mask: foreground pixels are not 0 */
+		if (icon_font->rle_offset != NULL){
+			RleExpandBits(&src, mask, icon_font->width, 0xFFFF, 0x0000);
+		}
+		else{
+			ExpandBitsRow(src.src, mask, icon_font->width, 0xFFFF, 0x0000);
+			src.src += (icon_font->width + 7) / 8;
+		}
+		y = sprite->y + i;
+		if (y < fb_y || y >= fb_y + fb_height){
+			continue;
+		}
+		for (uint16_t j = 0; j < icon_font->width; j++){
+			x = sprite->x + j;
+			if (mask[2 * j] != 0 && x < fb_width){
+				uint8_t *pixel = fb + ((y - fb_y) * fb_width + x) * 2;
+				pixel[0] = HighByte(sprite->foreground);
+				pixel[1] = LowByte(sprite->foreground);
+			}
+		}
+	}
+	if (FbClip(&rect)){
+		FbMarkDirty(rect);
+	}
+}
+
+uint8_t DrawRun(uint16_t x, uint16_t y, const char *str, Font_t *font, uint16_t foreground, uint16_t background, uint16_t *width){
+	const uint8_t *glyph[GLYPH_RUN_MAX];
+	uint8_t n = 0;
+	uint16_t row_bytes, rows, chunk_rows;
+	uint32_t keep_from = glyph_clock + 1;
+	uint8_t bounce = 0;
+	uint8_t *p;
+
+	/* Printable characters that fit on the line, while they fit in the cache too */
+	*width = 0;
+	while (n < GLYPH_RUN_MAX && str[n] >= ' ' && str[n] <= '~' && 
+		(x + *width + font->info[str[n] - ' '].width) <= lcd_orientation.width){
+		glyph[n] = GlyphGet(font, str[n], foreground, background, keep_from);
+		if (glyph[n] == NULL){
+			break;
+		}
+		*width += font->info[str[n] - ' '].width + 1;
+		n++;
+	}
+	if (n == 0){
+		return 0;
+	}
+	/* The space after the last character is not drawn */
+	row_bytes = (*width - 1) * 2;
+	WindowBegin(x, y, x + *width - 2, y + font->font_height - 1);
+
+	/* Rows are composed from the glyphs in ping-pong buffers, sent by DMA while the next one is composed */
+	chunk_rows = DMA_CHUNK_SIZE / row_bytes;
+	for (uint16_t row = 0; row < font->font_height; row += rows){
+		rows = (font->font_height - row < chunk_rows) ? font->font_height - row : chunk_rows;
+		if (fb == NULL){
+			SpiQueueWaitPending(ili9341_spi, 1);
+		}
+		p = bounce_buf[bounce];
+		for (uint16_t i = row; i < row + rows; i++){
+			for (uint8_t k = 0; k < n; k++){
+				uint16_t glyph_bytes = font->info[str[k] - ' '].width * 2;
+				memcpy(p, glyph[k] + i * glyph_bytes, glyph_bytes);
+				p += glyph_bytes;
+				if (k < n - 1){
+					*p++ = HighByte(background);
+					*p++ = LowByte(background);
+				}
+			}
+		}
+		if (fb != NULL){
+			WindowWrite(bounce_buf[bounce], rows * row_bytes);
+		}
+		else{
+			lcd_cmd_t lcd_pixels = {NULL, rows * row_bytes, bounce_buf[bounce]};
+			QueueLCD(&lcd_pixels);
+		}
+		bounce ^= 1;
+	}
+	if (fb == NULL){
+		SpiQueueWait(ili9341_spi);
+	}
+	return n;
+}
+
+void WindowBegin(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+	if (fb != NULL){
+		/* Pixels are stored as they arrive, the window is marked as dirty once */
+		win = (lcd_rect_t){(x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0};
+		win_x = win.x0;
+		win_y = win.y0;
+		lcd_rect_t rect = win;
+		if (FbClip(&rect)){
+			FbMarkDirty(rect);
+		}
+		return;
+	}
+	SetCursorPosition(x0, y0, x1, y1);
+	/* Start writing LCD memory */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	QueueLCD(&lcd_write);
+}
+
+void WindowWrite(const uint8_t *data, uint32_t bytes){
+	uint32_t chunk;
+
+	if (fb != NULL){
+		for (uint32_t i = 0; i + 1 < bytes; i += 2){
+			/* Pixels out of the band or the LCD are discarded */
+			if (win_y >= fb_y && win_y < fb_y + fb_height && win_x < fb_width){
+				uint8_t *p = fb + ((win_y - fb_y) * fb_width + win_x) * 2;
+				p[0] = data[i];
+				p[1] = data[i + 1];
+			}
+			if (++win_x > win.x1){
+				win_x = win.x0;
+				win_y++;
+			}
+		}
+		return;
+	}
+	/* Transfers longer than DMA_CHUNK_SIZE are rejected by the SPI driver (i.e. cached glyphs of big fonts) */
+	while (bytes > 0){
+		chunk = (bytes > DMA_CHUNK_SIZE) ? DMA_CHUNK_SIZE : bytes;
+		lcd_cmd_t lcd_pixels = {NULL, chunk, (uint8_t*)data};
+		QueueLCD(&lcd_pixels);
+		data += chunk;
+		bytes -= chunk;
+	}
+	/* Data buffer can be reused after return */
+	SpiQueueWait(ili9341_spi);
+}
+
 /*==================[external functions definition]==========================*/
 
 uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
-	/* SPI configuration */
+	/* SPI configuration (the device is registered only once) */
 	spi_conf.device = spi_dev;
 	ili9341_spi = spi_dev;
+	SpiInit(&spi_conf);
+	/* DMA capable buffers for fills and pictures */
+	if (fill_buf == NULL){
+		fill_buf = heap_caps_malloc(DMA_CHUNK_SIZE, MALLOC_CAP_DMA);
+		bounce_buf[0] = heap_caps_malloc(DMA_CHUNK_SIZE, MALLOC_CAP_DMA);
+		bounce_buf[1] = heap_caps_malloc(DMA_CHUNK_SIZE, MALLOC_CAP_DMA);
+		if (fill_buf == NULL || bounce_buf[0] == NULL || bounce_buf[1] == NULL){
+			return false;
+		}
+	}
 	/* GPIOs configuration and initialization */
 	ili9341_dc = gpio_dc;
 	ili9341_rst = gpio_rst;
@@ -291,6 +1275,7 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	for (uint8_t i = 0; i < sizeof(lcd_init)/sizeof(lcd_cmd_t); i++){
 		WriteLCD(&lcd_init[i]);
 	}
+	lcd_window_valid = false;
 	/* It will be necessary to wait 5msec before sending next command after sleep out */
 	WriteLCD(&lcd_sleep_out);
 	DelayMs(10);
@@ -303,6 +1288,10 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 }
 
 void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color){
+	if (fb != NULL){
+		Fill(x, y, x, y, color);
+		return;
+	}
 	/* Define area (pixel) to fill */
 	SetCursorPosition(x, y, x, y);
 	uint8_t pixels[] = {HighByte(color), LowByte(color)};
@@ -347,6 +1336,8 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 	}
 	lcd_cmd_t lcd_mem_acc = {MEM_ACC_CTRL, 1, mem_acc};
 	WriteLCD(&lcd_mem_acc);
+	/* Addresses are interpreted in the new orientation: send them again */
+	lcd_window_valid = false;
 }
 
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
@@ -366,15 +1357,25 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
+	WindowBegin(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
+
+	/* Cached glyphs are sent at once */
+	if (glyph_budget != 0){
+		const uint8_t *glyph = GlyphGet(font, data, foreground, background, glyph_clock + 1);
+		if (glyph != NULL){
+			WindowWrite(glyph, font->font_height * font->info[data - ' '].width * 2);
+			return;
+		}
+	}
+	if (font->compressed){
+		WindowWriteRle(font->data + font->info[data - ' '].offset, font->font_height * font->info[data - ' '].width, 
+			true, foreground, background);
+		return;
+	}
 
 	/* Number of bytes to write. We have to write 2 bytes/pixel */
 	bytes_count = font->font_height * font->info[data - ' '].width * 2;
 
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
 	/* Draw font data */
 	/* go through character rows */
 	k = 0;
@@ -389,8 +1390,7 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 			}
 			/* If exceed buffer size, send buffer */
 			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
+				WindowWrite(pixel, MAX_VALUE_SIZE);
 				bytes_count -= MAX_VALUE_SIZE;
 				k++;
 			}
@@ -407,84 +1407,63 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 		}
 	}
 	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	WindowWrite(pixel, bytes_count);
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
-	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
-	/* Set coordinates */
-	lcd_x = x;
-	lcd_y = y;
+	ili9341_sprite_t sprite = {x, y, icon, icon_font, foreground, background, false};
 
 	/* If at the end of a line of display, go to new line and set x to 0 position */
-	if ((lcd_x + icon_font->width) > lcd_orientation.width)	{
-		lcd_y += icon_font->height;
-		lcd_x = 0;
+	if ((sprite.x + icon_font->width) > lcd_orientation.width)	{
+		sprite.y += icon_font->height;
+		sprite.x = 0;
 	}
+	/* Single window, sent by DMA */
+	DrawSpriteGroup(&sprite, 1);
+}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = icon_font->height * icon_font->width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+void ILI9341DrawSprites(ili9341_sprite_t *sprites, uint16_t n){
+	ili9341_sprite_t aux;
+	uint16_t i, j, group;
 
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < icon_font->height; i++)	{
-		/*  */
-		char_row = icon * icon_font->offset + i * ((icon_font->width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < icon_font->width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (icon_font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
+	/* Sort by row and column (insertion sort: batches are small and often already sorted) */
+	for (i = 1; i < n; i++){
+		aux = sprites[i];
+		for (j = i; j > 0 && (sprites[j - 1].y > aux.y || (sprites[j - 1].y == aux.y && sprites[j - 1].x > aux.x)); j--){
+			sprites[j] = sprites[j - 1];
 		}
+		sprites[j] = aux;
+	}
+	for (i = 0; i < n; i += group){
+		if (sprites[i].transparent && fb != NULL){
+			FbDrawSpriteTransparent(&sprites[i]);
+			group = 1;
+			continue;
+		}
+		/* Icons on the same row, each one starting where the previous ends, share the window */
+		group = 1;
+		while (i + group < n && group < SPRITE_GROUP_MAX &&
+			sprites[i + group].icon_font == sprites[i].icon_font &&
+			sprites[i + group].y == sprites[i].y &&
+			sprites[i + group].x == sprites[i + group - 1].x + sprites[i].icon_font->width &&
+			!(sprites[i + group].transparent && fb != NULL)){
+			group++;
+		}
+		DrawSpriteGroup(&sprites[i], group);
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint16_t i;
-	static uint16_t lcd_x, lcd_y;
-
-	/* Set coordinates */
-	lcd_x = x;
-	lcd_y = y;
-
-	for (i=0; i<dig; i++){
-		lcd_x = x + font->info[num%10 + '0' - ' '].width * (dig-1-i) + 1;
-		ILI9341DrawChar(lcd_x, lcd_y, num%10 + '0', font, foreground, background);
-		num = num/10;
+	char str[FORMAT_U32_LEN];
+	uint8_t len = FormatU32(str, num);
+	uint16_t lcd_x;
+	char c;
+
+	for(uint8_t i=0; i<dig; i++){
+		/* Digits beyond dig are discarded, missing ones are drawn as '0' */
+		c = (i < len) ? str[len-1-i] : '0';
+		lcd_x = x + font->info[c - ' '].width * (dig-1-i) + 1;
+		ILI9341DrawChar(lcd_x, y, c, font, foreground, background);
 	}
 }
 
@@ -508,11 +1487,23 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 				lcd_x = x;
 			}
 			str++;
+			continue;
 		}
 		else if (*str == '\r'){
-				str++;
-			}
+			str++;
+			continue;
+		}
 
+		/* With glyph cache, characters are drawn by lines */
+		if (glyph_budget != 0){
+			uint16_t width;
+			uint8_t n = DrawRun(lcd_x, lcd_y, str, font, foreground, background, &width);
+			if (n != 0){
+				lcd_x += width;
+				str += n;
+				continue;
+			}
+		}
 		/* Put character to LCD */
 		ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
 		lcd_x += font->info[*str - ' '].width + 1;
@@ -536,6 +1527,7 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	static uint16_t span_x, span_y, next_x, next_y;
 
 	/* Check for overflow */
 	if (x0 >= lcd_orientation.width){
@@ -573,29 +1565,87 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 	if (x_dist == 0 || y_dist == 0){
 		Fill(x0, y0, x1, y1, color);
 	}
-	/* Diagonal line */
+	/* Diagonal line: drawn as horizontal (or vertical for steep lines) spans */
 	else{
 		error = x_dist - y_dist;
+		span_x = x0;
+		span_y = y0;
 
 		while (1){
-			/* Draw start point */
-			ILI9341DrawPixel(x0, y0, color);
 			/* Loop ends when start point reaches end point */
 			if (x0 == x1 && y0 == y1){
+				Fill(span_x, span_y, x0, y0, color);
 				break;
 			}
 			error_2 = 2 * error;
+			next_x = x0;
+			next_y = y0;
 			/* Determine if line must grow in x direction */
 			if (error_2 > -y_dist){
 				error -= y_dist;
-				x0 += x_grow;	/* Move start point */
+				next_x += x_grow;
 			}
 			/* Determine if line must grow in y direction */
 			if (error_2 < x_dist){
 				error += x_dist;
-				y0 += y_grow;	/* Move start point */
+				next_y += y_grow;
+			}
+			/* The span ends when the slower coordinate changes */
+			if ((x_dist >= y_dist) ? (next_y != y0) : (next_x != x0)){
+				Fill(span_x, span_y, x0, y0, color);
+				span_x = next_x;
+				span_y = next_y;
 			}
+			x0 = next_x;	/* Move start point */
+			y0 = next_y;
+		}
+	}
+}
+
+void ILI9341DrawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	int16_t aux, dx, dy, x, y;
+	int32_t gradient, intery;
+	uint16_t frac;
+	bool steep;
+
+	if (fb == NULL){
+		ILI9341DrawLine(x0, y0, x1, y1, color);
+		return;
+	}
+	/* Walk along the longer axis, splitting each pixel between the two nearest rows (columns) */
+	steep = abs(y1 - y0) > abs(x1 - x0);
+	if (steep){
+		aux = x0; x0 = y0; y0 = aux;
+		aux = x1; x1 = y1; y1 = aux;
+	}
+	if (x0 > x1){
+		aux = x0; x0 = x1; x1 = aux;
+		aux = y0; y0 = y1; y1 = aux;
+	}
+	dx = x1 - x0;
+	dy = y1 - y0;
+	gradient = (dx == 0) ? 0 : (int32_t)dy * 65536 / dx;
+	intery = (int32_t)y0 * 65536;
+	for (x = x0; x <= x1; x++){
+		y = intery >> 16;
+		frac = (intery >> 8) & 0xFF;
+		if (steep){
+			FbBlend(y, x, color, 256 - frac);
+			FbBlend(y + 1, x, color, frac);
 		}
+		else{
+			FbBlend(x, y, color, 256 - frac);
+			FbBlend(x, y + 1, color, frac);
+		}
+		intery += gradient;
+	}
+	/* Pixels from x0 to x1, rows from the lower y to one past the higher one (swapped back if steep) */
+	lcd_rect_t rect = {x0, (y0 < y1) ? y0 : y1, x1, ((y0 > y1) ? y0 : y1) + 1};
+	if (steep){
+		rect = (lcd_rect_t){rect.y0, rect.x0, rect.y1, rect.x1};
+	}
+	if (FbClip(&rect)){
+		FbMarkDirty(rect);
 	}
 }
 
@@ -611,21 +1661,20 @@ void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 }
 
 void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
+	static int16_t f, ddF_x, ddF_y, x, y, x_start;
 
 	f = 1 - r;
 	ddF_x = 1;
 	ddF_y = -2 * r;
 	x = 0;
 	y = r;
-
-	ILI9341DrawPixel(x0, y0 + r, color);
-	ILI9341DrawPixel(x0, y0 - r, color);
-	ILI9341DrawPixel(x0 + r, y0, color);
-	ILI9341DrawPixel(x0 - r, y0, color);
+	x_start = 0;
 
     while (x < y){
         if (f >= 0){
+			/* Points from x_start to x share the same y: draw them as spans */
+			CircleSpans(x0, y0, x_start, x, y, color);
+			x_start = x + 1;
             y--;
             ddF_y += 2;
             f += ddF_y;
@@ -633,17 +1682,8 @@ void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
         x++;
         ddF_x += 2;
         f += ddF_x;
-
-        ILI9341DrawPixel(x0 + x, y0 + y, color);
-        ILI9341DrawPixel(x0 - x, y0 + y, color);
-        ILI9341DrawPixel(x0 + x, y0 - y, color);
-        ILI9341DrawPixel(x0 - x, y0 - y, color);
-
-        ILI9341DrawPixel(x0 + y, y0 + x, color);
-        ILI9341DrawPixel(x0 - y, y0 + x, color);
-        ILI9341DrawPixel(x0 + y, y0 - x, color);
-        ILI9341DrawPixel(x0 - y, y0 - x, color);
     }
+	CircleSpans(x0, y0, x_start, x, y, color);
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
@@ -655,14 +1695,13 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
 	x = 0;
 	y = r;
 
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
-
+	/* One span per scanline */
+	FillSpan(x0 - r, y0, x0 + r, y0, color);
     while (x < y){
         if (f >= 0){
+			/* Rows y0 +- y are complete: x is the widest point with this y */
+			FillSpan(x0 - x, y0 + y, x0 + x, y0 + y, color);
+			FillSpan(x0 - x, y0 - y, x0 + x, y0 - y, color);
             y--;
             ddF_y += 2;
             f += ddF_y;
@@ -671,12 +1710,13 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
         ddF_x += 2;
         f += ddF_x;
 
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
-
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
+		FillSpan(x0 - y, y0 + x, x0 + y, y0 + x, color);
+		FillSpan(x0 - y, y0 - x, x0 + y, y0 - x, color);
     }
+	if (x != y){
+		FillSpan(x0 - x, y0 + y, x0 + x, y0 + y, color);
+		FillSpan(x0 - x, y0 - y, x0 + x, y0 - y, color);
+	}
 }
 
 void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
@@ -747,7 +1787,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			FillSpan((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -761,7 +1801,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			FillSpan((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
@@ -778,7 +1818,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			FillSpan((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -790,20 +1830,25 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			FillSpan((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
 		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
+		FillSpan(x_1, y_1, x_aux, y_aux, color);
   	}
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
-	static uint16_t i, j;
-	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
+	uint32_t bytes_count, chunk;
+	uint8_t bounce = 0;
+	bool direct = esp_ptr_dma_capable(pic);
+
+	if (fb != NULL){
+		WindowBegin(x, y, x + width - 1, y + height - 1);
+		WindowWrite(pic, width * height * 2);
+		return;
+	}
 	SetCursorPosition(x, y, x + width - 1, y + height - 1);
 
 	/* Number of bytes to write. We have to write 2 bytes/pixel */
@@ -811,26 +1856,299 @@ void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
 
 	/* Start writing LCD memory */
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+	QueueLCD(&lcd_write);
+
+	while(bytes_count > 0){
+		chunk = (bytes_count > DMA_CHUNK_SIZE) ? DMA_CHUNK_SIZE : bytes_count;
+		lcd_cmd_t lcd_pixel = {NULL, chunk, (uint8_t*)pic};
+		if (!direct){
+			/* Pictures in flash go through ping-pong buffers: the previous use of 
+			 * this buffer must be finished (only the last transfer may be pending) */
+			SpiQueueWaitPending(ili9341_spi, 1);
+			memcpy(bounce_buf[bounce], pic, chunk);
+			lcd_pixel.data = bounce_buf[bounce];
+			bounce ^= 1;
+		}
+		QueueLCD(&lcd_pixel);
+		pic += chunk;
+		bytes_count -= chunk;
+	}
+	SpiQueueWait(ili9341_spi);
+}
+
+bool ILI9341FramebufferInit(uint16_t band_height){
+	ILI9341FramebufferDeInit();
+	if (band_height == 0 || band_height > lcd_orientation.height){
+		band_height = lcd_orientation.height;
+	}
+	/* DMA capable, so it can be flushed without copies */
+	fb = heap_caps_malloc(lcd_orientation.width * band_height * 2, MALLOC_CAP_DMA);
+	if (fb == NULL){
+		return false;
+	}
+	fb_width = lcd_orientation.width;
+	fb_height = band_height;
+	fb_y = 0;
+	fb_dirty_num = 0;
+	return true;
+}
+
+void ILI9341FramebufferBand(uint16_t y){
+	fb_y = y;
+	fb_dirty_num = 0;
+}
+
+uint16_t ILI9341FramebufferGetPixel(uint16_t x, uint16_t y){
+	if (fb == NULL || x >= fb_width || y < fb_y || y >= fb_y + fb_height){
+		return 0;
+	}
+	uint8_t *p = fb + ((y - fb_y) * fb_width + x) * 2;
+	return (p[0] << 8) | p[1];
+}
 
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		for (i = 0; i < MAX_VALUE_SIZE; i++){
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+void ILI9341Flush(void){
+	if (fb == NULL){
+		return;
+	}
+	FbQueueFlush();
+	/* Framebuffer can be modified after return */
+	SpiQueueWait(ili9341_spi);
+}
+
+void ILI9341FramebufferDeInit(void){
+	if (fb != NULL){
+		heap_caps_free(fb);
+		fb = NULL;
+	}
+	fb_dirty_num = 0;
+}
+
+bool ILI9341RenderInit(uint16_t band_height){
+	ILI9341RenderDeInit();
+	if (band_height == 0 || band_height > ILI9341_HEIGHT){
+		band_height = ILI9341_HEIGHT;
+	}
+	/* Sized for the widest orientation, so rotation doesn't need a new allocation */
+	render_buf[0] = heap_caps_malloc(ILI9341_HEIGHT * band_height * 2, MALLOC_CAP_DMA);
+	render_buf[1] = heap_caps_malloc(ILI9341_HEIGHT * band_height * 2, MALLOC_CAP_DMA);
+	if (render_buf[0] == NULL || render_buf[1] == NULL){
+		ILI9341RenderDeInit();
+		return false;
+	}
+	render_rows = band_height;
+	return true;
+}
+
+bool ILI9341Render(const ili9341_dl_item_t *list, uint16_t len){
+	uint16_t pending = 0;
+	uint8_t band = 0;
+	int64_t start, draw;
+
+	/* Framebuffer mode uses the same drawing path */
+	if (render_buf[0] == NULL || fb != NULL){
+		return false;
+	}
+	start = esp_timer_get_time();
+	render_cpu_us = 0;
+	fb_width = lcd_orientation.width;
+	for (uint16_t y = 0; y < lcd_orientation.height; y += render_rows){
+		/* This buffer was sent two bands ago: wait until only the previous band transfers are pending */
+		SpiQueueWaitPending(ili9341_spi, (pending > UINT8_MAX) ? UINT8_MAX : pending);
+		fb = render_buf[band];
+		fb_y = y;
+		fb_height = (lcd_orientation.height - y < render_rows) ? lcd_orientation.height - y : render_rows;
+		fb_dirty_num = 0;
+		/* Every item is clipped to the band */
+		draw = esp_timer_get_time();
+		for (uint16_t i = 0; i < len; i++){
+			RenderItem(&list[i]);
+		}
+		render_cpu_us += esp_timer_get_time() - draw;
+		/* The band is sent while the next one is drawn on the other buffer */
+		pending = FbQueueFlush();
+		band ^= 1;
+	}
+	SpiQueueWait(ili9341_spi);
+	fb = NULL;
+	render_frame_us = esp_timer_get_time() - start;
+	return true;
+}
+
+void ILI9341RenderGetTime(uint32_t *draw_us, uint32_t *frame_us){
+	*draw_us = render_cpu_us;
+	*frame_us = render_frame_us;
+}
+
+void ILI9341RenderDeInit(void){
+	for (uint8_t i = 0; i < 2; i++){
+		if (render_buf[i] != NULL){
+			heap_caps_free(render_buf[i]);
+			render_buf[i] = NULL;
 		}
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
 	}
-	for (i = 0; i < bytes_count; i++){
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+}
+
+void ILI9341GlyphCacheInit(uint32_t budget){
+	for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++){
+		if (glyph_cache[i].pixels != NULL){
+			heap_caps_free(glyph_cache[i].pixels);
+			glyph_cache[i].pixels = NULL;
+		}
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	glyph_used = 0;
+	glyph_hits = 0;
+	glyph_misses = 0;
+	glyph_budget = budget;
+}
+
+void ILI9341GlyphCacheGetStats(uint32_t *hits, uint32_t *misses, uint32_t *bytes){
+	*hits = glyph_hits;
+	*misses = glyph_misses;
+	*bytes = glyph_used;
+}
+
+void ILI9341DrawPictureRle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
+	WindowBegin(x, y, x + width - 1, y + height - 1);
+	WindowWriteRle(pic, width * height, false, 0, 0);
+}
+
+bool ILI9341ChartInit(const ili9341_chart_config_t *config){
+	uint16_t scroll_width;
+	uint8_t *p;
+
+	if (fb != NULL || config->num_traces > ILI9341_CHART_TRACES || config->max <= config->min ||
+		config->fixed_left + config->fixed_right >= ILI9341_HEIGHT){
+		return false;
+	}
+	/* Every buffer or none: ILI9341ChartAdd() only checks chart_col[0] */
+	for (uint8_t i = 0; i < 2; i++){
+		if (chart_grid[i] == NULL){
+			chart_grid[i] = heap_caps_malloc(ILI9341_WIDTH * 2, MALLOC_CAP_DMA);
+		}
+		if (chart_col[i] == NULL){
+			chart_col[i] = heap_caps_malloc(ILI9341_WIDTH * 2, MALLOC_CAP_DMA);
+		}
+		if (chart_grid[i] == NULL || chart_col[i] == NULL){
+			ChartFree();
+			return false;
+		}
+	}
+	chart = *config;
+	/* Hardware scrolling moves frame memory lines, that are LCD columns in landscape */
+	ILI9341Rotate(ILI9341_Landscape_1);
+	Fill(chart.fixed_left, 0, ILI9341_HEIGHT - chart.fixed_right - 1, ILI9341_WIDTH - 1, chart.background);
+	scroll_width = ILI9341_HEIGHT - chart.fixed_left - chart.fixed_right;
+	uint8_t scroll_def[] = {HighByte(chart.fixed_left), LowByte(chart.fixed_left), HighByte(scroll_width), 
+		LowByte(scroll_width), HighByte(chart.fixed_right), LowByte(chart.fixed_right)};
+	lcd_cmd_t lcd_scroll_def = {VERT_SCROLL_DEF, 6, scroll_def};
+	WriteLCD(&lcd_scroll_def);
+	ChartScroll(chart.fixed_left);
+
+	/* Grid cache: each new column starts as a copy of one of these */
+	for (uint16_t y = 0; y < ILI9341_WIDTH; y++){
+		p = chart_grid[0] + y * 2;
+		if (chart.grid_y != 0 && (ILI9341_WIDTH - 1 - y) % chart.grid_y == 0){
+			p[0] = HighByte(chart.grid_color);
+			p[1] = LowByte(chart.grid_color);
+		}
+		else{
+			p[0] = HighByte(chart.background);
+			p[1] = LowByte(chart.background);
+		}
+		p = chart_grid[1] + y * 2;
+		p[0] = HighByte(chart.grid_color);
+		p[1] = LowByte(chart.grid_color);
+	}
+	for (uint8_t i = 0; i < ILI9341_CHART_TRACES; i++){
+		chart_last[i] = -1;
+	}
+	chart_x = chart.fixed_left;
+	chart_samples = 0;
+	chart_queued = 0;
+	SpiQueueWait(ili9341_spi);
+	return true;
+}
+
+void ILI9341ChartAdd(const int32_t *samples){
+	uint8_t *col = chart_col[chart_samples & 1];
+	int64_t range, margin;
+	int16_t y, from, to;
+
+	if (chart_col[0] == NULL){
+		return;
+	}
+	/* Autoscale only widens the range (columns already drawn keep their scale) */
+	if (chart.autoscale){
+		for (uint8_t i = 0; i < chart.num_traces; i++){
+			/* In 64 bit, then saturated: samples near the int32_t limits must not wrap */
+			margin = ((int64_t)chart.max - chart.min) / 8;
+			if (samples[i] > chart.max){
+				chart.max = (samples[i] + margin > INT32_MAX) ? INT32_MAX : samples[i] + margin;
+			}
+			if (samples[i] < chart.min){
+				chart.min = (samples[i] - margin < INT32_MIN) ? INT32_MIN : samples[i] - margin;
+			}
+		}
+	}
+	range = (int64_t)chart.max - chart.min;
+
+	/* This buffer was sent two columns ago: only the last column may be pending */
+	SpiQueueWaitPending(ili9341_spi, chart_queued);
+	memcpy(col, chart_grid[(chart.grid_x != 0 && chart_samples % chart.grid_x == 0) ? 1 : 0], ILI9341_WIDTH * 2);
+	for (uint8_t i = 0; i < chart.num_traces; i++){
+		if (samples[i] <= chart.min){
+			y = ILI9341_WIDTH - 1;
+		}
+		else if (samples[i] >= chart.max){
+			y = 0;
+		}
+		else{
+			y = ILI9341_WIDTH - 1 - ((int64_t)samples[i] - chart.min) * (ILI9341_WIDTH - 1) / range;
+		}
+		/* Vertical segment from the previous point, so fast changes are connected */
+		from = (chart_last[i] < 0) ? y : chart_last[i];
+		to = y;
+		if (from > to){
+			from = y;
+			to = chart_last[i];
+		}
+		for (int16_t j = from; j <= to; j++){
+			col[j * 2] = HighByte(chart.colors[i]);
+			col[j * 2 + 1] = LowByte(chart.colors[i]);
+		}
+		chart_last[i] = y;
+	}
+	/* Column and scroll are queued: the next sample is prepared while they are sent */
+	chart_queued = SetCursorPosition(chart_x, 0, chart_x, ILI9341_WIDTH - 1);
+	lcd_cmd_t lcd_col = {MEM_WRITE, ILI9341_WIDTH * 2, col};
+	chart_queued += QueueLCD(&lcd_col);
+	chart_x++;
+	if (chart_x == ILI9341_HEIGHT - chart.fixed_right){
+		chart_x = chart.fixed_left;
+	}
+	/* The newest column is shown at the right of the scrolling area */
+	chart_queued += ChartScroll(chart_x);
+	chart_samples++;
+}
+
+void ILI9341ChartGetRange(int32_t *min, int32_t *max){
+	*min = chart.min;
+	*max = chart.max;
+}
+
+void ILI9341ChartDeInit(void){
+	uint8_t scroll_def[] = {0, 0, HighByte(ILI9341_HEIGHT), LowByte(ILI9341_HEIGHT), 0, 0};
+	lcd_cmd_t lcd_scroll_def = {VERT_SCROLL_DEF, 6, scroll_def};
+
+	SpiQueueWait(ili9341_spi);
+	WriteLCD(&lcd_scroll_def);
+	ChartScroll(0);
+	SpiQueueWait(ili9341_spi);
+	ChartFree();
 }
 
 uint8_t ILI9341DeInit(void){
+	lcd_window_valid = false;
 	return 0;
 }
 
@@ -10,8 +10,12 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
 #include "neopixel_stripe.h"
 #include "ws2812b.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 /*==================[macros and definitions]=================================*/
 #define RED_MSK         0x00FF0000
 #define GREEN_MSK       0x0000FF00
@@ -21,101 +25,428 @@
 #define BLUE_OFFSET     0
 #define MAX_BRIGHT  	255
 #define BRIGHT_OFFSET   8
+#define ANIM_TASK_STACK	2048
+#define ANIM_TASK_PRIORITY	5
+#define HUE_STEPS		1530	/*!< Different hues of NeoPixelHSV2Color() */
 /*==================[internal data declaration]==============================*/
 uint16_t stripe_length;
 uint8_t stripe_bright = MAX_BRIGHT;
 neopixel_color_t *stripe_colors; 
+static uint8_t stripe_lut[256];		/*!< Color level -> sent level (brightness and gamma) */
+static uint16_t stripe_offset = 0;	/*!< LED i shows stripe_colors[(i + stripe_offset) % stripe_length] */
+static bool stripe_dirty = false;	/*!< Colors changed since the last frame sent by the animation task */
+static neopixel_anim_t anims[NEOPIXEL_ANIM_MAX];	/*!< Running effects */
+static bool anim_used[NEOPIXEL_ANIM_MAX] = {false};	/*!< Effect slot in use */
+static uint32_t anim_start[NEOPIXEL_ANIM_MAX];		/*!< Animation time when each effect was added (ms) */
+static uint32_t anim_last[NEOPIXEL_ANIM_MAX];		/*!< Last step computed by each effect */
+static uint32_t anim_time = 0;		/*!< Animation time (ms) */
+static uint32_t anim_period = 0;	/*!< Frame period of the animation task (us), 0: stopped */
+static uint64_t anim_time_us = 0;	/*!< Animation time of the task (us), 64 bits: it doesn't wrap */
+static TaskHandle_t anim_task = NULL;
+static SemaphoreHandle_t anim_mutex = NULL;
+static timer_mcu_t anim_timer;
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Take the animation mutex (if the animation task was started).
+ * @note Colors, offset, brightness and the frame being staged are shared with the task.
+ */
+static void NeoPixelLock(void);
+
+/**
+ * @brief Give the animation mutex (if the animation task was started).
+ */
+static void NeoPixelUnlock(void);
+
+/**
+ * @brief Rebuild the table of levels sent to the NeoPixels for stripe_bright.
+ */
+static void NeoPixelBuildLut(void);
+
+/**
+ * @brief Send the colors of the stripe, or leave them to the animation task if it's running.
+ * @note Called holding the animation mutex.
+ */
+static void NeoPixelPush(void);
+
+/**
+ * @brief Encode a frame (in wire order) and send it.
+ * @param color_array Colors
+ * @param offset LED i shows color_array[(i + offset) % stripe_length]
+ */
+static void NeoPixelSend(neopixel_color_t *color_array, uint16_t offset);
+
+/**
+ * @brief Set the color of a LED if it changed (marking the stripe to be sent).
+ * @param pixel LED number
+ * @param color 24 bits color
+ */
+static void NeoPixelPut(uint16_t pixel, neopixel_color_t color);
+
+/**
+ * @brief Linear interpolation between two colors.
+ * @param from Color at pos = 0
+ * @param to Color at pos = len
+ * @param pos Position
+ * @param len Length of the interpolation
+ * @return neopixel_color_t Interpolated color
+ */
+static neopixel_color_t NeoPixelLerp(neopixel_color_t from, neopixel_color_t to, uint32_t pos, uint32_t len);
+
+/**
+ * @brief Compute an effect at time ms from its start.
+ * @param slot Effect slot
+ * @param time Time since the effect was added (ms)
+ */
+static void NeoPixelAnimEffect(uint8_t slot, uint32_t time);
+
+/**
+ * @brief Timer callback (ISR): wakes up the animation task every frame.
+ * @param param Not used
+ */
+static void NeoPixelAnimTick(void *param);
+
+/**
+ * @brief Animation task: updates the effects and sends the frames that changed.
+ * @param param Not used
+ */
+static void NeoPixelAnimTask(void *param);
 
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void NeoPixelLock(void){
+	if (anim_mutex != NULL){
+		xSemaphoreTake(anim_mutex, portMAX_DELAY);
+	}
+}
+
+static void NeoPixelUnlock(void){
+	if (anim_mutex != NULL){
+		xSemaphoreGive(anim_mutex);
+	}
+}
+
+static void NeoPixelBuildLut(void){
+	for (uint16_t i = 0; i < 256; i++){
+		stripe_lut[i] = ws2812bGammaCorrection((i * stripe_bright) >> BRIGHT_OFFSET);
+	}
+}
+
+static void NeoPixelPush(void){
+	if (anim_period != 0){
+		stripe_dirty = true;
+	}else{
+		NeoPixelSend(stripe_colors, stripe_offset);
+	}
+}
+
+static void NeoPixelSend(neopixel_color_t *color_array, uint16_t offset){
+	uint8_t *frame = ws2812bFrame(stripe_length);
+	neopixel_color_t color;
+	uint16_t j = offset;
+
+	if (frame == NULL){
+		return;
+	}
+	/* Brightness and gamma come from one table: the frame is encoded in wire order (GRB) */
+	for (uint16_t i = 0; i < stripe_length; i++){
+		color = color_array[j];
+		frame[0] = stripe_lut[(uint8_t)(color >> GREEN_OFFSET)];
+		frame[1] = stripe_lut[(uint8_t)(color >> RED_OFFSET)];
+		frame[2] = stripe_lut[(uint8_t)(color >> BLUE_OFFSET)];
+		frame += 3;
+		if (++j == stripe_length){
+			j = 0;
+		}
+	}
+	ws2812bSendRet();
+}
+
+static void NeoPixelPut(uint16_t pixel, neopixel_color_t color){
+	uint32_t i = pixel + stripe_offset;
+
+	if (i >= stripe_length){
+		i -= stripe_length;
+	}
+	if (stripe_colors[i] != color){
+		stripe_colors[i] = color;
+		stripe_dirty = true;
+	}
+}
+
+static neopixel_color_t NeoPixelLerp(neopixel_color_t from, neopixel_color_t to, uint32_t pos, uint32_t len){
+	neopixel_color_t color = 0;
+	int32_t a, b;
+
+	if (len == 0 || pos >= len){
+		return to;
+	}
+	for (uint8_t shift = 0; shift <= RED_OFFSET; shift += 8){
+		a = (from >> shift) & 0xFF;
+		b = (to >> shift) & 0xFF;
+		color |= (uint32_t)(a + (b - a) * (int32_t)pos / (int32_t)len) << shift;
+	}
+	return color;
+}
+
+static void NeoPixelAnimEffect(uint8_t slot, uint32_t time){
+	neopixel_anim_t *anim = &anims[slot];
+	neopixel_color_t color;
+	uint32_t step, end;
+	uint16_t pixel;
+	uint8_t k;
+
+	switch(anim->type){
+	case NEOPIXEL_ANIM_FADE:
+	case NEOPIXEL_ANIM_KEYFRAMES:
+		if (anim->type == NEOPIXEL_ANIM_FADE){
+			if (anim->loop && anim->period_ms != 0){
+				time %= anim->period_ms;
+			}
+			color = NeoPixelLerp(anim->color, anim->color2, time, anim->period_ms);
+		}else{
+			if (anim->num_keyframes == 0){
+				return;
+			}
+			end = anim->keyframes[anim->num_keyframes - 1].time_ms;
+			if (anim->loop && end != 0){
+				time %= end;
+			}
+			k = 0;
+			while (k + 1 < anim->num_keyframes && anim->keyframes[k + 1].time_ms <= time){
+				k++;
+			}
+			if (k + 1 == anim->num_keyframes || time < anim->keyframes[0].time_ms){
+				color = anim->keyframes[(time < anim->keyframes[0].time_ms) ? 0 : k].color;
+			}else{
+				color = NeoPixelLerp(anim->keyframes[k].color, anim->keyframes[k + 1].color, 
+					time - anim->keyframes[k].time_ms, anim->keyframes[k + 1].time_ms - anim->keyframes[k].time_ms);
+			}
+		}
+		/* The whole range has one color: nothing to do while it doesn't change */
+		if (color == anim_last[slot]){
+			return;
+		}
+		anim_last[slot] = color;
+		for (uint16_t i = 0; i < anim->count; i++){
+			NeoPixelPut(anim->first + i, color);
+		}
+		break;
+
+	case NEOPIXEL_ANIM_CHASE:
+		step = (anim->period_ms == 0) ? 0 : (time / anim->period_ms) % anim->count;
+		if (step == anim_last[slot]){
+			return;
+		}
+		anim_last[slot] = step;
+		for (uint16_t i = 0; i < anim->count; i++){
+			/* Block of size LEDs starting at step, wrapping inside the range */
+			pixel = (i >= step) ? i - step : i + anim->count - step;
+			NeoPixelPut(anim->first + i, (pixel < anim->size) ? anim->color : anim->color2);
+		}
+		break;
+
+	case NEOPIXEL_ANIM_RAINBOW:
+		step = (anim->period_ms == 0) ? 0 : (uint32_t)(((uint64_t)(time % anim->period_ms) << 16) / anim->period_ms);
+		/* Hues closer than one NeoPixelHSV2Color() step give the same colors */
+		if ((step * HUE_STEPS + 32768) >> 16 == anim_last[slot]){
+			return;
+		}
+		anim_last[slot] = (step * HUE_STEPS + 32768) >> 16;
+		for (uint16_t i = 0; i < anim->count; i++){
+			NeoPixelPut(anim->first + i, NeoPixelHSV2Color(step + (i * anim->size * 65536) / anim->count, 255, 255));
+		}
+		break;
+
+	case NEOPIXEL_ANIM_PIXEL:
+		for (uint16_t i = 0; i < anim->count; i++){
+			NeoPixelPut(anim->first + i, anim->pixel_func(i, time, anim->param));
+		}
+		break;
+	}
+}
+
+static void NeoPixelAnimTick(void *param){
+	vTaskNotifyGiveFromISR(anim_task, NULL);
+}
+
+static void NeoPixelAnimTask(void *param){
+	bool changed;
+
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		anim_time_us += anim_period;
+		/* Frames are staged holding the mutex: callers may be sending or changing colors */
+		xSemaphoreTake(anim_mutex, portMAX_DELAY);
+		changed = NeoPixelAnimUpdate(anim_time_us / 1000);
+		/* Frames without changes are not sent */
+		if (changed){
+			NeoPixelSend(stripe_colors, stripe_offset);
+		}
+		xSemaphoreGive(anim_mutex);
+	}
+}
 
 /*==================[external functions definition]==========================*/
 
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array){
     stripe_length = len;
 	stripe_colors = color_array;
+	NeoPixelBuildLut();
     ws2812bInit(pin);
 }
 
 void NeoPixelAllOff(void){
-    rgb_led_t led;
-	ws2812bSendRet();
-	ws2812bSendRet();
-	ws2812bSendRet();
-	for (uint16_t i = 0; i < stripe_length; i++){
-		led.red = 0;
-		led.green = 0;
-		led.blue = 0;
-		ws2812bSend(led);
+	uint8_t *frame;
+
+	NeoPixelLock();
+	frame = ws2812bFrame(stripe_length);
+	if (frame != NULL){
+		memset(frame, 0, stripe_length * 3);
+		ws2812bSendRet();
 	}
-	ws2812bSendRet();
+	NeoPixelUnlock();
 }
 
 void NeoPixelAllColor(neopixel_color_t color){
+	NeoPixelLock();
 	for (uint16_t i = 0; i < stripe_length; i++){
 		stripe_colors[i] = color;
 	}
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelPush();
+	NeoPixelUnlock();
 }
 
 void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color){
-	stripe_colors[pixel] = color;
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelLock();
+	NeoPixelPut(pixel, color);
+	NeoPixelPush();
+	NeoPixelUnlock();
 }
 
 void NeoPixelSetArray(neopixel_color_t *color_array){
-    rgb_led_t led;
-	uint16_t red, green, blue;
-	ws2812bSendRet();
-	ws2812bSendRet();
-	ws2812bSendRet();
-	for (uint16_t i = 0; i < stripe_length; i++){
-		red = ((color_array[i] & RED_MSK) >> RED_OFFSET) * stripe_bright;
-		green = ((color_array[i] & GREEN_MSK) >> GREEN_OFFSET) * stripe_bright;
-		blue = ((color_array[i] & BLUE_MSK) >> BLUE_OFFSET) * stripe_bright;
-		led.red = red >> BRIGHT_OFFSET;
-		led.green = green >> BRIGHT_OFFSET;
-		led.blue = blue >> BRIGHT_OFFSET;
-		ws2812bSend(led);
+	NeoPixelLock();
+	if (color_array == stripe_colors){
+		NeoPixelPush();
+	}else{
+		NeoPixelSend(color_array, 0);
 	}
-	ws2812bSendRet();
+	NeoPixelUnlock();
 }
 
 void NeoPixelShift(bool upwards){
-	neopixel_color_t carry;
-
+	NeoPixelLock();
+	/* Colors are not moved: the LED -> color mapping is rotated */
 	if(upwards){
-		carry = stripe_colors[stripe_length-1];
-		for (uint16_t i = 0; i < stripe_length-1; i++){
-			stripe_colors[stripe_length-1-i] = stripe_colors[stripe_length-2-i]; 
-		}
-		stripe_colors[0] = carry;
+		stripe_offset = (stripe_offset == 0) ? stripe_length - 1 : stripe_offset - 1;
 	}else{
-		carry = stripe_colors[0];
-		for (uint16_t i = 0; i < stripe_length-1; i++){
-			stripe_colors[i] = stripe_colors[i+1]; 
-		}
-		stripe_colors[stripe_length-1] = carry;
+		stripe_offset = (stripe_offset + 1 == stripe_length) ? 0 : stripe_offset + 1;
 	}
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelPush();
+	NeoPixelUnlock();
 }
 
 void NeoPixelBrightness(uint8_t bright){
+	NeoPixelLock();
 	stripe_bright = bright;
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelBuildLut();
+	NeoPixelPush();
+	NeoPixelUnlock();
 }
 
 void NeoPixelRainbow(uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps){
+	NeoPixelLock();
 	for (uint16_t i=0; i<stripe_length; i++) {
 		uint16_t hue = first_hue + (i * reps * 65536) / stripe_length;
 		neopixel_color_t color = NeoPixelHSV2Color(hue, sat, val);
-		stripe_colors[i] = color;
+		NeoPixelPut(i, color);
   	}
-	NeoPixelSetArray(stripe_colors);
+	NeoPixelPush();
+	NeoPixelUnlock();
+}
+
+uint16_t NeoPixelOffset(void){
+	return stripe_offset;
+}
+
+int8_t NeoPixelAnimAdd(const neopixel_anim_t *anim){
+	int8_t slot = -1;
+
+	if (anim->first + anim->count > stripe_length || anim->count == 0 ||
+		(anim->type == NEOPIXEL_ANIM_PIXEL && anim->pixel_func == NULL)){
+		return -1;
+	}
+	NeoPixelLock();
+	for (uint8_t i = 0; i < NEOPIXEL_ANIM_MAX; i++){
+		if (!anim_used[i]){
+			anims[i] = *anim;
+			anim_start[i] = anim_time;
+			/* No step computed yet: the first update draws the whole range */
+			anim_last[i] = UINT32_MAX;
+			anim_used[i] = true;
+			slot = i;
+			break;
+		}
+	}
+	NeoPixelUnlock();
+	return slot;
+}
+
+void NeoPixelAnimRemove(int8_t id){
+	if (id < 0 || id >= NEOPIXEL_ANIM_MAX){
+		return;
+	}
+	NeoPixelLock();
+	anim_used[id] = false;
+	NeoPixelUnlock();
+}
+
+bool NeoPixelAnimUpdate(uint32_t time_ms){
+	bool changed;
+
+	anim_time = time_ms;
+	/* Effects added later are drawn over the previous ones */
+	for (uint8_t i = 0; i < NEOPIXEL_ANIM_MAX; i++){
+		if (anim_used[i]){
+			NeoPixelAnimEffect(i, time_ms - anim_start[i]);
+		}
+	}
+	changed = stripe_dirty;
+	stripe_dirty = false;
+	return changed;
+}
+
+void NeoPixelAnimStart(timer_mcu_t timer, uint16_t fps){
+	if (anim_period != 0 || fps == 0){
+		return;
+	}
+	if (anim_task == NULL){
+		anim_mutex = xSemaphoreCreateMutex();
+		xTaskCreate(NeoPixelAnimTask, "neopixel_anim", ANIM_TASK_STACK, NULL, ANIM_TASK_PRIORITY, &anim_task);
+	}
+	anim_timer = timer;
+	anim_time_us = (uint64_t)anim_time * 1000;
+	anim_period = 1000000 / fps;
+	/* The first frame sends the current colors */
+	stripe_dirty = true;
+	timer_config_t timer_config = {
+		.timer = timer,
+		.period = anim_period,
+		.func_p = NeoPixelAnimTick,
+		.param_p = NULL
+	};
+	TimerInit(&timer_config);
+	TimerStart(timer);
+}
+
+void NeoPixelAnimStop(void){
+	if (anim_period == 0){
+		return;
+	}
+	TimerStop(anim_timer);
+	anim_period = 0;
 }
 
 neopixel_color_t NeoPixelRgb2Color(uint8_t red, uint8_t green, uint8_t blue){
@@ -10,19 +10,55 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <stdlib.h>
 #include "ws2812b.h"
 #include "gpio_mcu.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-#include "gpio_fast_out_mcu.h"
-#include "delay_mcu.h"
+#include "freertos/semphr.h"
+#include "driver/rmt_tx.h"
+#include "driver/rmt_encoder.h"
 /*==================[macros and definitions]=================================*/
-#define RET_CMD (50)    // ret command 50us low
-#define BIT_0   (1)     // bit 0
-#define BIT_7   (1<<7)  // bit 0
+#define RET_CMD (50)    	// ret command 50us low
+#define RMT_RESOLUTION_HZ	20000000	/*!< RMT tick: 50ns */
+#define RMT_MEM_SYMBOLS		48			/*!< RMT memory of the channel (refilled by the driver ISR) */
+#define RMT_QUEUE_DEPTH		2			/*!< Frames queued on the RMT channel */
+#define STAGE_BUFFERS		2			/*!< Frames being filled/sent */
+#define STAGE_MIN_SIZE		48			/*!< Initial bytes of each stage buffer (16 LEDs) */
+#define NS_TO_TICKS(ns)		((ns) * (RMT_RESOLUTION_HZ / 1000000) / 1000)
+
+/* Datasheet timing (ns) */
+#define T0H_NS  400     // bit 0: high time
+#define T0L_NS  850     // bit 0: low time
+#define T1H_NS  800     // bit 1: high time
+#define T1L_NS  450     // bit 1: low time
 /*==================[internal data declaration]==============================*/
-gpio_t pin_number;
+/**
+ * @brief RMT encoder of a frame: bytes of the LEDs followed by the ret command
+ */
+typedef struct {
+	rmt_encoder_t base;				/*!< Encoder interface (called by the RMT driver) */
+	rmt_encoder_t *bytes_encoder;	/*!< Converts each bit to a bit 0/bit 1 symbol */
+	rmt_encoder_t *copy_encoder;	/*!< Sends the ret symbol */
+	uint8_t state;					/*!< 0: sending bytes, 1: sending ret */
+	rmt_symbol_word_t ret;			/*!< Ret command symbol */
+} ws2812b_encoder_t;
+
+static rmt_channel_handle_t ws2812b_channel = NULL;	/*!< RMT TX channel */
+static ws2812b_encoder_t ws2812b_encoder;			/*!< Frame encoder */
+static SemaphoreHandle_t stage_free;				/*!< Stage buffers not being sent */
+static uint8_t *stage_buf[STAGE_BUFFERS] = {NULL};	/*!< Frames: green, red, blue bytes of each LED */
+static uint32_t stage_size[STAGE_BUFFERS] = {0};	/*!< Allocated bytes of each stage buffer */
+static uint32_t stage_len;							/*!< Bytes staged in the current buffer */
+static uint8_t stage = 0;							/*!< Buffer being filled */
+static bool staging = false;						/*!< A frame is being filled */
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Start a frame (if needed) and make room for bytes more
+ * 
+ * @param bytes Bytes to add to the frame
+ * @return Pointer to the added bytes, NULL if there is not enough memory
+ */
+static uint8_t *ws2812bStage(uint32_t bytes);
 
 /*==================[internal data definition]===============================*/
 static const uint8_t gamma_table[256] = {
@@ -47,330 +83,163 @@ static const uint8_t gamma_table[256] = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-void IRAM_ATTR ws2812bSendHigh(gpio_t pin){
-    GPIOFastWrite(1);
-    //delay 0.8us
-    __asm__ __volatile__ ("nop");   // 1
-    __asm__ __volatile__ ("nop");   // 2
-    __asm__ __volatile__ ("nop");   // 3
-    __asm__ __volatile__ ("nop");   // 4
-    __asm__ __volatile__ ("nop");   // 5
-    __asm__ __volatile__ ("nop");   // 6
-    __asm__ __volatile__ ("nop");   // 7
-    __asm__ __volatile__ ("nop");   // 8
-    __asm__ __volatile__ ("nop");   // 9
-    __asm__ __volatile__ ("nop");   // 10
-    __asm__ __volatile__ ("nop");   // 11
-    __asm__ __volatile__ ("nop");   // 12
-    __asm__ __volatile__ ("nop");   // 13
-    __asm__ __volatile__ ("nop");   // 14
-    __asm__ __volatile__ ("nop");   // 15
-    __asm__ __volatile__ ("nop");   // 16
-    __asm__ __volatile__ ("nop");   // 17
-    __asm__ __volatile__ ("nop");   // 18
-    __asm__ __volatile__ ("nop");   // 19
-    __asm__ __volatile__ ("nop");   // 20
-    __asm__ __volatile__ ("nop");   // 21
-    __asm__ __volatile__ ("nop");   // 22
-    __asm__ __volatile__ ("nop");   // 23
-    __asm__ __volatile__ ("nop");   // 24  
-    __asm__ __volatile__ ("nop");   // 25
-    __asm__ __volatile__ ("nop");   // 26
-    __asm__ __volatile__ ("nop");   // 27
-    __asm__ __volatile__ ("nop");   // 28
-    __asm__ __volatile__ ("nop");   // 29
-    __asm__ __volatile__ ("nop");   // 30
-    __asm__ __volatile__ ("nop");   // 31
-    __asm__ __volatile__ ("nop");   // 32
-    __asm__ __volatile__ ("nop");   // 33
-    __asm__ __volatile__ ("nop");   // 34
-    __asm__ __volatile__ ("nop");   // 35
-    __asm__ __volatile__ ("nop");   // 36
-    __asm__ __volatile__ ("nop");   // 37
-    __asm__ __volatile__ ("nop");   // 38
-    __asm__ __volatile__ ("nop");   // 39
-    __asm__ __volatile__ ("nop");   // 40
-    __asm__ __volatile__ ("nop");   // 41
-    __asm__ __volatile__ ("nop");   // 42
-    __asm__ __volatile__ ("nop");   // 43
-    __asm__ __volatile__ ("nop");   // 44
-    __asm__ __volatile__ ("nop");   // 45
-    __asm__ __volatile__ ("nop");   // 46
-    __asm__ __volatile__ ("nop");   // 47
-    __asm__ __volatile__ ("nop");   // 48
-    __asm__ __volatile__ ("nop");   // 49
-    __asm__ __volatile__ ("nop");   // 50
-    __asm__ __volatile__ ("nop");   // 51
-    __asm__ __volatile__ ("nop");   // 52
-    __asm__ __volatile__ ("nop");   // 53
-    __asm__ __volatile__ ("nop");   // 54
-    __asm__ __volatile__ ("nop");   // 55
-    __asm__ __volatile__ ("nop");   // 56
-    __asm__ __volatile__ ("nop");   // 57
-    __asm__ __volatile__ ("nop");   // 58
-    __asm__ __volatile__ ("nop");   // 59
-    __asm__ __volatile__ ("nop");   // 47
-    __asm__ __volatile__ ("nop");   // 50
-    __asm__ __volatile__ ("nop");   // 51
-    __asm__ __volatile__ ("nop");   // 52
-    __asm__ __volatile__ ("nop");   // 53
-    __asm__ __volatile__ ("nop");   // 54
-    __asm__ __volatile__ ("nop");   // 55
-    __asm__ __volatile__ ("nop");   // 56
-    __asm__ __volatile__ ("nop");   // 57
-    __asm__ __volatile__ ("nop");   // 58
-    __asm__ __volatile__ ("nop");   // 59
-    __asm__ __volatile__ ("nop");   // 60
-    __asm__ __volatile__ ("nop");   // 61
-    __asm__ __volatile__ ("nop");   // 62
-    __asm__ __volatile__ ("nop");   // 63
-    __asm__ __volatile__ ("nop");   // 64
-    __asm__ __volatile__ ("nop");   // 65
-    __asm__ __volatile__ ("nop");   // 66
-    __asm__ __volatile__ ("nop");   // 67
-    __asm__ __volatile__ ("nop");   // 68
-    __asm__ __volatile__ ("nop");   // 69
-    __asm__ __volatile__ ("nop");   // 70
-    __asm__ __volatile__ ("nop");   // 71
-    __asm__ __volatile__ ("nop");   // 72
-    __asm__ __volatile__ ("nop");   // 73
-    __asm__ __volatile__ ("nop");   // 74
-    __asm__ __volatile__ ("nop");   // 75
-    __asm__ __volatile__ ("nop");   // 76
-    __asm__ __volatile__ ("nop");   // 77
-    __asm__ __volatile__ ("nop");   // 78
-    __asm__ __volatile__ ("nop");   // 79
-    __asm__ __volatile__ ("nop");   // 80
-    __asm__ __volatile__ ("nop");   // 81
-    __asm__ __volatile__ ("nop");   // 82
-    __asm__ __volatile__ ("nop");   // 83
-    __asm__ __volatile__ ("nop");   // 84
-    __asm__ __volatile__ ("nop");   // 85
-    __asm__ __volatile__ ("nop");   // 86
-    __asm__ __volatile__ ("nop");   // 87
-    __asm__ __volatile__ ("nop");   // 88
-    __asm__ __volatile__ ("nop");   // 89
-    __asm__ __volatile__ ("nop");   // 90
-    __asm__ __volatile__ ("nop");   // 91
-    
-    GPIOFastWrite(0);
-	//delay 0.45us
-    __asm__ __volatile__ ("nop");   // 1
-    __asm__ __volatile__ ("nop");   // 2
-    __asm__ __volatile__ ("nop");   // 3
-    __asm__ __volatile__ ("nop");   // 4
-    __asm__ __volatile__ ("nop");   // 5
-    __asm__ __volatile__ ("nop");   // 6
-    __asm__ __volatile__ ("nop");   // 7
-    __asm__ __volatile__ ("nop");   // 8
-    __asm__ __volatile__ ("nop");   // 9
-    __asm__ __volatile__ ("nop");   // 10
-    __asm__ __volatile__ ("nop");   // 11
-    __asm__ __volatile__ ("nop");   // 12
-    __asm__ __volatile__ ("nop");   // 13
-    __asm__ __volatile__ ("nop");   // 14
-    __asm__ __volatile__ ("nop");   // 15
-    __asm__ __volatile__ ("nop");   // 16
-    __asm__ __volatile__ ("nop");   // 17
-    __asm__ __volatile__ ("nop");   // 18
-    __asm__ __volatile__ ("nop");   // 19
-    __asm__ __volatile__ ("nop");   // 20
-    __asm__ __volatile__ ("nop");   // 21
-    __asm__ __volatile__ ("nop");   // 22
-    __asm__ __volatile__ ("nop");   // 23
-    __asm__ __volatile__ ("nop");   // 24  
-    __asm__ __volatile__ ("nop");   // 25
-    __asm__ __volatile__ ("nop");   // 26
-    __asm__ __volatile__ ("nop");   // 27
-    __asm__ __volatile__ ("nop");   // 28
-    __asm__ __volatile__ ("nop");   // 29
+uint8_t ws2812bGammaCorrection(uint8_t component){
+    return gamma_table[component];
 }
 
-void IRAM_ATTR ws2812bSendLow(gpio_t pin){
-    GPIOFastWrite(1);
-    //delay 0.4us
-    __asm__ __volatile__ ("nop");   // 1
-    __asm__ __volatile__ ("nop");   // 2
-    __asm__ __volatile__ ("nop");   // 3
-    __asm__ __volatile__ ("nop");   // 4
-    __asm__ __volatile__ ("nop");   // 5
-    __asm__ __volatile__ ("nop");   // 6
-    __asm__ __volatile__ ("nop");   // 7
-    __asm__ __volatile__ ("nop");   // 8
-    __asm__ __volatile__ ("nop");   // 9
-    __asm__ __volatile__ ("nop");   // 10
-    __asm__ __volatile__ ("nop");   // 11
-    __asm__ __volatile__ ("nop");   // 12
-    __asm__ __volatile__ ("nop");   // 13
-    __asm__ __volatile__ ("nop");   // 14
-    __asm__ __volatile__ ("nop");   // 15
-    __asm__ __volatile__ ("nop");   // 16
-    __asm__ __volatile__ ("nop");   // 17
-    __asm__ __volatile__ ("nop");   // 18
-    __asm__ __volatile__ ("nop");   // 19
-    __asm__ __volatile__ ("nop");   // 20
-    __asm__ __volatile__ ("nop");   // 21
-    __asm__ __volatile__ ("nop");   // 22
-    __asm__ __volatile__ ("nop");   // 23
-    __asm__ __volatile__ ("nop");   // 24  
-    __asm__ __volatile__ ("nop");   // 25
-    __asm__ __volatile__ ("nop");   // 26
-    __asm__ __volatile__ ("nop");   // 27
+static size_t IRAM_ATTR ws2812bEncode(rmt_encoder_t *encoder, rmt_channel_handle_t channel, 
+		const void *data, size_t data_size, rmt_encode_state_t *ret_state){
+	ws2812b_encoder_t *ws2812b = (ws2812b_encoder_t *)encoder;
+	rmt_encode_state_t session_state = RMT_ENCODING_RESET;
+	size_t symbols = 0;
 
-    GPIOFastWrite(0);
-	//delay 0.85us
-    __asm__ __volatile__ ("nop");   // 1
-    __asm__ __volatile__ ("nop");   // 2
-    __asm__ __volatile__ ("nop");   // 3
-    __asm__ __volatile__ ("nop");   // 4
-    __asm__ __volatile__ ("nop");   // 5
-    __asm__ __volatile__ ("nop");   // 6
-    __asm__ __volatile__ ("nop");   // 7
-    __asm__ __volatile__ ("nop");   // 8
-    __asm__ __volatile__ ("nop");   // 9
-    __asm__ __volatile__ ("nop");   // 10
-    __asm__ __volatile__ ("nop");   // 11
-    __asm__ __volatile__ ("nop");   // 12
-    __asm__ __volatile__ ("nop");   // 13
-    __asm__ __volatile__ ("nop");   // 14
-    __asm__ __volatile__ ("nop");   // 15
-    __asm__ __volatile__ ("nop");   // 16
-    __asm__ __volatile__ ("nop");   // 17
-    __asm__ __volatile__ ("nop");   // 18
-    __asm__ __volatile__ ("nop");   // 19
-    __asm__ __volatile__ ("nop");   // 20
-    __asm__ __volatile__ ("nop");   // 21
-    __asm__ __volatile__ ("nop");   // 22
-    __asm__ __volatile__ ("nop");   // 23
-    __asm__ __volatile__ ("nop");   // 24  
-    __asm__ __volatile__ ("nop");   // 25
-    __asm__ __volatile__ ("nop");   // 26
-    __asm__ __volatile__ ("nop");   // 27
-    __asm__ __volatile__ ("nop");   // 28
-    __asm__ __volatile__ ("nop");   // 29
-    __asm__ __volatile__ ("nop");   // 30
-    __asm__ __volatile__ ("nop");   // 31
-    __asm__ __volatile__ ("nop");   // 32
-    __asm__ __volatile__ ("nop");   // 33
-    __asm__ __volatile__ ("nop");   // 34
-    __asm__ __volatile__ ("nop");   // 35
-    __asm__ __volatile__ ("nop");   // 36
-    __asm__ __volatile__ ("nop");   // 37
-    __asm__ __volatile__ ("nop");   // 38
-    __asm__ __volatile__ ("nop");   // 39
-    __asm__ __volatile__ ("nop");   // 40
-    __asm__ __volatile__ ("nop");   // 41
-    __asm__ __volatile__ ("nop");   // 42
-    __asm__ __volatile__ ("nop");   // 43
-    __asm__ __volatile__ ("nop");   // 44
-    __asm__ __volatile__ ("nop");   // 45
-    __asm__ __volatile__ ("nop");   // 46
-    __asm__ __volatile__ ("nop");   // 47
-    __asm__ __volatile__ ("nop");   // 48
-    __asm__ __volatile__ ("nop");   // 49
-    __asm__ __volatile__ ("nop");   // 50
-    __asm__ __volatile__ ("nop");   // 51
-    __asm__ __volatile__ ("nop");   // 52
-    __asm__ __volatile__ ("nop");   // 53
-    __asm__ __volatile__ ("nop");   // 54
-    __asm__ __volatile__ ("nop");   // 55
-    __asm__ __volatile__ ("nop");   // 56
-    __asm__ __volatile__ ("nop");   // 57
-    __asm__ __volatile__ ("nop");   // 58
-    __asm__ __volatile__ ("nop");   // 59
-    __asm__ __volatile__ ("nop");   // 47
-    __asm__ __volatile__ ("nop");   // 50
-    __asm__ __volatile__ ("nop");   // 51
-    __asm__ __volatile__ ("nop");   // 52
-    __asm__ __volatile__ ("nop");   // 53
-    __asm__ __volatile__ ("nop");   // 54
-    __asm__ __volatile__ ("nop");   // 55
-    __asm__ __volatile__ ("nop");   // 56
-    __asm__ __volatile__ ("nop");   // 57
-    __asm__ __volatile__ ("nop");   // 58
-    __asm__ __volatile__ ("nop");   // 59
-    __asm__ __volatile__ ("nop");   // 60
-    __asm__ __volatile__ ("nop");   // 61
-    __asm__ __volatile__ ("nop");   // 62
-    __asm__ __volatile__ ("nop");   // 63
-    __asm__ __volatile__ ("nop");   // 64
-    __asm__ __volatile__ ("nop");   // 65
-    __asm__ __volatile__ ("nop");   // 66
-    __asm__ __volatile__ ("nop");   // 67
-    __asm__ __volatile__ ("nop");   // 68
-    __asm__ __volatile__ ("nop");   // 69
-    __asm__ __volatile__ ("nop");   // 70
-    __asm__ __volatile__ ("nop");   // 71
-    __asm__ __volatile__ ("nop");   // 72
-    __asm__ __volatile__ ("nop");   // 73
-    __asm__ __volatile__ ("nop");   // 74
-    __asm__ __volatile__ ("nop");   // 75
-    __asm__ __volatile__ ("nop");   // 76
-    __asm__ __volatile__ ("nop");   // 77
-    __asm__ __volatile__ ("nop");   // 78
-    __asm__ __volatile__ ("nop");   // 79
-    __asm__ __volatile__ ("nop");   // 80
-    __asm__ __volatile__ ("nop");   // 81
-    __asm__ __volatile__ ("nop");   // 82
-    __asm__ __volatile__ ("nop");   // 83
-    __asm__ __volatile__ ("nop");   // 84
-    __asm__ __volatile__ ("nop");   // 85
-    __asm__ __volatile__ ("nop");   // 86
-    __asm__ __volatile__ ("nop");   // 87
-    __asm__ __volatile__ ("nop");   // 88
-    __asm__ __volatile__ ("nop");   // 89
-    __asm__ __volatile__ ("nop");   // 90
-    __asm__ __volatile__ ("nop");   // 91
-    __asm__ __volatile__ ("nop");   // 92
-    __asm__ __volatile__ ("nop");   // 93
-    __asm__ __volatile__ ("nop");   // 94
+	/* Called again by the RMT ISR each time its memory has room for more symbols */
+	*ret_state = RMT_ENCODING_RESET;
+	if (ws2812b->state == 0){
+		symbols += ws2812b->bytes_encoder->encode(ws2812b->bytes_encoder, channel, data, data_size, &session_state);
+		if (session_state & RMT_ENCODING_COMPLETE){
+			ws2812b->state = 1;
+		}
+		if (session_state & RMT_ENCODING_MEM_FULL){
+			*ret_state = RMT_ENCODING_MEM_FULL;
+			return symbols;
+		}
+	}
+	symbols += ws2812b->copy_encoder->encode(ws2812b->copy_encoder, channel, &ws2812b->ret, 
+		sizeof(ws2812b->ret), &session_state);
+	if (session_state & RMT_ENCODING_COMPLETE){
+		ws2812b->state = 0;
+		*ret_state = RMT_ENCODING_COMPLETE;
+	}
+	if (session_state & RMT_ENCODING_MEM_FULL){
+		*ret_state |= RMT_ENCODING_MEM_FULL;
+	}
+	return symbols;
 }
 
-uint8_t ws2812bGammaCorrection(uint8_t component){
-    return gamma_table[component];
+static esp_err_t ws2812bEncoderReset(rmt_encoder_t *encoder){
+	ws2812b_encoder_t *ws2812b = (ws2812b_encoder_t *)encoder;
+
+	rmt_encoder_reset(ws2812b->bytes_encoder);
+	rmt_encoder_reset(ws2812b->copy_encoder);
+	ws2812b->state = 0;
+	return ESP_OK;
+}
+
+static esp_err_t ws2812bEncoderDelete(rmt_encoder_t *encoder){
+	ws2812b_encoder_t *ws2812b = (ws2812b_encoder_t *)encoder;
+
+	rmt_del_encoder(ws2812b->bytes_encoder);
+	rmt_del_encoder(ws2812b->copy_encoder);
+	return ESP_OK;
+}
+
+static uint8_t *ws2812bStage(uint32_t bytes){
+	uint8_t *buf;
+	uint32_t size;
+
+	if (!staging){
+		/* Wait until the frame sent from this buffer two frames ago is finished */
+		xSemaphoreTake(stage_free, portMAX_DELAY);
+		staging = true;
+		stage_len = 0;
+	}
+	if (stage_len + bytes > stage_size[stage]){
+		size = (stage_size[stage] == 0) ? STAGE_MIN_SIZE : stage_size[stage];
+		while (size < stage_len + bytes){
+			size *= 2;
+		}
+		buf = realloc(stage_buf[stage], size);
+		if (buf == NULL){
+			return NULL;
+		}
+		stage_buf[stage] = buf;
+		stage_size[stage] = size;
+	}
+	buf = stage_buf[stage] + stage_len;
+	stage_len += bytes;
+	return buf;
+}
+
+static bool IRAM_ATTR ws2812bSent(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *event, void *user){
+	BaseType_t task_woken = pdFALSE;
+
+	xSemaphoreGiveFromISR(stage_free, &task_woken);
+	return task_woken == pdTRUE;
 }
 
 /*==================[external functions definition]==========================*/
 
 void ws2812bInit(gpio_t pin){
-    pin_number = pin;
-    GPIOFastInit(&pin, 1);
+	if (ws2812b_channel != NULL){
+		return;
+	}
+	rmt_tx_channel_config_t channel_config = {
+		.gpio_num = pin,
+		.clk_src = RMT_CLK_SRC_DEFAULT,
+		.resolution_hz = RMT_RESOLUTION_HZ,
+		.mem_block_symbols = RMT_MEM_SYMBOLS,
+		.trans_queue_depth = RMT_QUEUE_DEPTH,
+	};
+	ESP_ERROR_CHECK(rmt_new_tx_channel(&channel_config, &ws2812b_channel));
+
+	/* Bits are sent MSB first, as symbols of the datasheet timing */
+	rmt_bytes_encoder_config_t bytes_config = {
+		.bit0 = {.level0 = 1, .duration0 = NS_TO_TICKS(T0H_NS), .level1 = 0, .duration1 = NS_TO_TICKS(T0L_NS)},
+		.bit1 = {.level0 = 1, .duration0 = NS_TO_TICKS(T1H_NS), .level1 = 0, .duration1 = NS_TO_TICKS(T1L_NS)},
+		.flags.msb_first = 1,
+	};
+	rmt_copy_encoder_config_t copy_config = {};
+	ESP_ERROR_CHECK(rmt_new_bytes_encoder(&bytes_config, &ws2812b_encoder.bytes_encoder));
+	ESP_ERROR_CHECK(rmt_new_copy_encoder(&copy_config, &ws2812b_encoder.copy_encoder));
+	ws2812b_encoder.base.encode = ws2812bEncode;
+	ws2812b_encoder.base.reset = ws2812bEncoderReset;
+	ws2812b_encoder.base.del = ws2812bEncoderDelete;
+	ws2812b_encoder.state = 0;
+	/* Ret command: line low, split between both halves of the symbol */
+	ws2812b_encoder.ret.level0 = 0;
+	ws2812b_encoder.ret.duration0 = NS_TO_TICKS(RET_CMD * 1000) / 2;
+	ws2812b_encoder.ret.level1 = 0;
+	ws2812b_encoder.ret.duration1 = NS_TO_TICKS(RET_CMD * 1000) / 2;
+
+	stage_free = xSemaphoreCreateCounting(STAGE_BUFFERS, STAGE_BUFFERS);
+	rmt_tx_event_callbacks_t callbacks = {.on_trans_done = ws2812bSent};
+	ESP_ERROR_CHECK(rmt_tx_register_event_callbacks(ws2812b_channel, &callbacks, NULL));
+	ESP_ERROR_CHECK(rmt_enable(ws2812b_channel));
 }
 
 void ws2812bSend(rgb_led_t led_color){
-    uint8_t i;
-	// Blue
-	for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.green) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
-    }
-	// Red
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.red) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
-    }
-	// Green
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.blue) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
-    }
+	uint8_t *buf = ws2812bStage(3);
+
+	if (buf == NULL){
+		return;
+	}
+	buf[0] = ws2812bGammaCorrection(led_color.green);
+	buf[1] = ws2812bGammaCorrection(led_color.red);
+	buf[2] = ws2812bGammaCorrection(led_color.blue);
+}
+
+uint8_t *ws2812bFrame(uint16_t leds){
+	return ws2812bStage(leds * 3);
 }
 
 void ws2812bSendRet(void){
-    GPIOFastWrite(0);
-    DelayUs(RET_CMD);
+	rmt_transmit_config_t transmit_config = {.loop_count = 0};
+
+	/* Every frame ends with a ret command: without a staged frame there is nothing to do */
+	if (!staging){
+		return;
+	}
+	/* The frame is sent by the RMT while the CPU keeps running */
+	if (rmt_transmit(ws2812b_channel, &ws2812b_encoder.base, stage_buf[stage], stage_len, &transmit_config) != ESP_OK){
+		xSemaphoreGive(stage_free);
+	}
+	stage = (stage + 1) % STAGE_BUFFERS;
+	staging = false;
+}
+
+void ws2812bWait(void){
+	rmt_tx_wait_all_done(ws2812b_channel, -1);
 }
 
 /*==================[end of file]============================================*/
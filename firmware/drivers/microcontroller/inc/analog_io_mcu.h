@@ -21,11 +21,17 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 17/10/2026 | Continuous mode (DMA) implemented                 					|
+ * | 17/10/2026 | Multi-channel scan groups                          					|
+ * | 17/10/2026 | Calibration lookup tables (raw to mV)              					|
+ * | 17/10/2026 | Oversampling and decimation                        					|
+ * | 17/10/2026 | Waveform player for the analog output              					|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include <stdbool.h>
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -39,7 +45,26 @@ typedef enum adc_mode {
 	ADC_CONTINUOUS,			/*!< Continuous read */
 } adc_mode_t;
 
+/**
+ * @brief Decimation filters for oversampled channels
+ */
+typedef enum adc_decim {
+	ADC_DECIM_BOXCAR,		/*!< Average of OSR samples */
+	ADC_DECIM_CIC,			/*!< 3rd order CIC (sinc^3) filter, better alias rejection (OSR up to 64) */
+} adc_decim_t;
+
+/**
+ * @brief Waveform player modes
+ */
+typedef enum dac_play_mode {
+	DAC_ONE_SHOT,			/*!< Play the buffer once */
+	DAC_LOOP,				/*!< Play the buffer repeatedly */
+	DAC_STREAM,				/*!< Play the buffers queued with AnalogOutputWaveQueue() one after the other */
+} dac_play_mode_t;
+
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+
+#define ADC_CONT_FRAME_LEN	256		/*!< Samples per DMA frame (shared by all channels in continuous mode) */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -48,11 +73,66 @@ typedef enum adc_mode {
 typedef struct {			
 	adc_ch_t input;			/*!< Inputs: CH0, CH1, CH2, CH3 */
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
-	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
+	void *func_p;			/*!< Pointer to callback function called (from ISR) on every DMA frame end (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint32_t sample_frec;	/*!< Sample frequency per channel in Hz (only for continuous mode). Total rate (sample_frec * channels) min: 611Hz - max: 83.3kHz */
 } analog_input_config_t;	
 
+/**
+ * @brief Continuous mode statistics
+ */
+typedef struct {
+	uint32_t frames;		/*!< DMA frames completed by the ADC */
+	uint32_t overruns;		/*!< Frames lost because the frame pool was full (not read on time) */
+	uint32_t discarded[CH3 + 1];	/*!< Samples of each channel overwritten before being read (its buffer was full) */
+} analog_cont_stats_t;
+
+/**
+ * @brief Scan group config structure
+ * 
+ * All the channels in the group are converted one after the other in a single
+ * hardware pattern table, so the samples of a scan are taken at the same instant
+ * (the inter-channel skew is one ADC conversion).
+ */
+typedef struct {
+	adc_ch_t *channels;		/*!< Channels to scan, in the order they will be interleaved */
+	uint8_t num_channels;	/*!< Number of channels in the group (1 to 4) */
+	uint32_t scan_frec;		/*!< Scan frequency in Hz (every channel is sampled once per scan) */
+	void *func_p;			/*!< Pointer to callback function called (from ISR) on every DMA frame end */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_scan_config_t;
+
+/**
+ * @brief Scan group frame
+ */
+typedef struct {
+	uint16_t *samples;		/*!< Interleaved samples (raw ADC counts): samples[scan * num_channels + channel index]. Must hold ADC_CONT_FRAME_LEN elements */
+	uint16_t scans;			/*!< Number of complete scans in the frame */
+	uint8_t num_channels;	/*!< Channels per scan */
+	int64_t timestamp;		/*!< Time of the first scan (in us, esp_timer time base) */
+	uint32_t scan_period_ns;	/*!< Time between scans (in ns, not rounded to whole us) */
+} analog_scan_frame_t;
+
+/**
+ * @brief Waveform player config structure
+ */
+typedef struct {
+	const uint8_t *samples;	/*!< Samples to play (from 0 to 255, as in AnalogOutputWrite()) */
+	uint32_t len;			/*!< Number of samples */
+	uint32_t sample_frec;	/*!< Output sample frequency in Hz */
+	dac_play_mode_t mode;	/*!< Play mode */
+	void *func_p;			/*!< Pointer to callback function called (from ISR) when a buffer ends. In stream mode the buffer can be refilled and queued again */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_output_wave_t;
+
+/**
+ * @brief Waveform player statistics
+ */
+typedef struct {
+	uint32_t samples;		/*!< Samples written to the DAC */
+	uint32_t buffers;		/*!< Buffers completed */
+	uint32_t underruns;		/*!< Sample periods without data to play (stream mode) */
+} analog_wave_stats_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -83,6 +163,11 @@ void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 /**
  * @brief Start convertion for ADC module in continuous mode
  * 
+ * All the channels started in continuous mode share the same pattern table and DMA
+ * frames, so starting a new channel restarts the conversion with the updated pattern.
+ * 
+ * @note While continuous mode is running single reads are not available.
+ * 
  * @param channel Channel selected
  */
 void AnalogStartContinuous(adc_ch_t channel);
@@ -90,17 +175,170 @@ void AnalogStartContinuous(adc_ch_t channel);
 /**
  * @brief Stop convertion for ADC module
  * 
+ * The conversion keeps running for the remaining channels in continuous mode (if any).
+ * 
  * @param channel Channel selected
  */
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the unread samples of one channel.
+ * 
+ * Frames are taken from the frame pool only when the channel has no unread samples. 
+ * The samples of the other channels in those frames are kept in their own buffers 
+ * (2 * ADC_CONT_FRAME_LEN samples each), so every channel can be read in turn. When a 
+ * channel is not read on time its oldest samples are overwritten and counted (see 
+ * AnalogContinuousGetStats()).
+ * This function never blocks: call it from the task notified by the frame callback.
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (raw ADC counts, at least ADC_CONT_FRAME_LEN elements)
+ * @return Number of samples written in values, up to ADC_CONT_FRAME_LEN (0 if there are no samples available)
+ */
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+
+/**
+ * @brief Get continuous mode frame counters.
+ * 
+ * @param stats Pointer to struct where counters will be stored
+ */
+void AnalogContinuousGetStats(analog_cont_stats_t *stats);
+
+/**
+ * @brief Scan group initialization.
+ * 
+ * @note Scan groups and single channel continuous mode share the ADC DMA, 
+ * starting one of them stops the other.
+ * 
+ * @param config Scan group config structure
+ * @return false if there are no channels, more than 4, or a channel is invalid or repeated (the group is not changed)
+ */
+bool AnalogScanGroupInit(analog_scan_config_t *config);
+
+/**
+ * @brief Start convertion of the scan group.
+ */
+void AnalogScanGroupStart(void);
+
+/**
+ * @brief Stop convertion of the scan group.
+ */
+void AnalogScanGroupStop(void);
+
+/**
+ * @brief Read the oldest scan group frame available.
+ * 
+ * This function never blocks: call it from the task notified by the frame callback.
+ * 
+ * @param frame Frame where interleaved samples and timestamps will be stored (samples must be set by the caller)
+ * @return Number of complete scans read (0 if there is no frame available)
+ */
+uint16_t AnalogScanGroupRead(analog_scan_frame_t *frame);
+
+/**
+ * @brief Copy the samples of one channel of an interleaved frame to a contiguous array.
+ * 
+ * @param frame Frame read with AnalogScanGroupRead()
+ * @param index Channel position in the scan group (not the channel number)
+ * @param values Destination array (at least frame->scans elements)
+ */
+void AnalogScanGroupDeinterleave(const analog_scan_frame_t *frame, uint8_t index, uint16_t *values);
+
+/**
+ * @brief Configure oversampling of a channel in continuous mode.
+ * 
+ * The channel is converted at sample_frec and AnalogInputReadContinuous() delivers
+ * samples at sample_frec / OSR. The decimation runs on the DMA frames, so no task is
+ * blocked while the samples are acquired. Every 4x of oversampling adds 1 bit of 
+ * resolution (e.g. OSR = 64: 15 bits samples).
+ * 
+ * @note Decimated samples are scaled to the returned resolution, shift them right 
+ * (resolution - 12) bits before using AnalogRawToMilliVolts().
+ * 
+ * @param channel Channel selected
+ * @param osr Oversampling ratio, power of 2 (0 or 1: disable oversampling)
+ * @param type Decimation filter
+ * @return Resolution (in bits) of the decimated samples
+ */
+uint8_t AnalogOversamplingConfig(adc_ch_t channel, uint16_t osr, adc_decim_t type);
+
+/**
+ * @brief Build the raw to mV lookup table of a channel from its calibration curve.
+ * 
+ * The curve fitting scheme is evaluated once for each of the 4096 raw values, so 
+ * later conversions cost one table load per sample. Each table uses 8kB of RAM.
+ * 
+ * @param channel Channel selected
+ * @return true if the table is ready, false if there was no memory for it (conversions 
+ * of the channel keep using the calibration curve)
+ */
+bool AnalogCalibrationInit(adc_ch_t channel);
+
+/**
+ * @brief Convert an array of raw ADC counts to mV.
+ * 
+ * Uses the channel lookup table (see AnalogCalibrationInit()) or, if it was not built,
+ * the calibration curve. raw and mv can point to the same array.
+ * 
+ * @param channel Channel the samples were taken from
+ * @param raw Raw ADC counts
+ * @param mv Converted values (in mV)
+ * @param len Number of samples
+ */
+void AnalogRawToMilliVolts(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint32_t len);
+
+/**
+ * @brief Convert (in place) the samples of a scan group frame from raw ADC counts to mV.
+ * 
+ * The lookup table of each channel is built on the first call (see AnalogCalibrationInit()).
+ * 
+ * @param frame Frame read with AnalogScanGroupRead()
+ */
+void AnalogScanGroupToMilliVolts(analog_scan_frame_t *frame);
+
+/**
+ * @brief Waveform player initialization.
+ * 
+ * The samples are written to the DAC from a hardware timer ISR, with no task involved.
+ * 
+ * @note AnalogOutputInit() must be called first.
+ * 
+ * @param wave Waveform player config structure
+ * @return false if sample_frec is 0 or above the timer resolution (the player is not changed)
+ */
+bool AnalogOutputWaveInit(analog_output_wave_t *wave);
+
+/**
+ * @brief Start (or resume) the waveform player.
+ * 
+ * In DAC_ONE_SHOT mode, once the buffer was played to the end, the next start plays it 
+ * again from the first sample.
+ */
+void AnalogOutputWaveStart(void);
+
+/**
+ * @brief Stop the waveform player. The output keeps the last value.
+ */
+void AnalogOutputWaveStop(void);
+
+/**
+ * @brief Queue the next buffer to play (stream mode).
+ * 
+ * Up to two buffers (the one being played and the next one) are handled, so a signal 
+ * of any length can be streamed refilling each buffer from the buffer end callback.
+ * 
+ * @param samples Samples to play
+ * @param len Number of samples
+ * @return true if the buffer was queued, false if there are already two buffers queued
+ */
+bool AnalogOutputWaveQueue(const uint8_t *samples, uint32_t len);
+
+/**
+ * @brief Get waveform player counters.
+ * 
+ * @param stats Pointer to struct where counters will be stored
  */
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+void AnalogOutputWaveGetStats(analog_wave_stats_t *stats);
 
 /**
  * @brief Digital-to-Analog convert.
@@ -21,12 +21,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 17/10/2026 | Devices registered once, queued transactions		                    |
  * 
  **/
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define SPI_QUEUE_SIZE	8	/*!< Transactions that can be queued per device */
 
 /*==================[typedef]================================================*/
 
@@ -68,6 +70,7 @@ typedef struct{
 	transfer_mode_t transfer_mode;	/*!< Transfer mode */
 	void *func_p;					/*!< Pointer to callback function for transaction end */
 	void *param_p;					/*!< Pointer to callback parameter */
+	void *pre_func_p;				/*!< Pointer to function called (from ISR, so it must be IRAM_ATTR) before each queued transaction, with its user value as parameter. E.g. to drive a D/C line (NULL if not required) */
 } spi_mcu_config_t;
 /*==================[external data declaration]==============================*/
 
@@ -75,6 +78,9 @@ typedef struct{
 /**
  * @brief Initialize SPI module with the corresponding configuration
  * 
+ * @note Each device is registered in the bus only once: following calls for 
+ * the same device have no effect.
+ * 
  * @param spi Structure with the module configuration
  * @return uint8_t 
  */
@@ -108,6 +114,43 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
  */
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size);
 
+/**
+ * @brief Queue a write transaction and return without waiting for it.
+ * 
+ * Transactions use pre-allocated descriptors and are sent in order, with DMA.
+ * Buffers larger than 4 bytes are not copied: they must not be modified until 
+ * SpiQueueWait() returns. When SPI_QUEUE_SIZE transactions are pending, it 
+ * waits for the oldest one.
+ * 
+ * @note The SPI driver rejects transactions longer than the bus maximum transfer 
+ * size (4092 bytes): longer buffers must be split by the caller.
+ * 
+ * @param device SPI device to write to
+ * @param tx_buffer pointer to buffer where data is stored
+ * @param tx_buffer_size numbers of bytes to write
+ * @param user value passed to the pre-transaction callback
+ * @return true if the transaction was queued, false if it was rejected (nothing is sent)
+ */
+bool SpiQueueWrite(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size, void *user);
+
+/**
+ * @brief Wait until all queued transactions of a device are finished.
+ * 
+ * @param device SPI device
+ */
+void SpiQueueWait(spi_dev_t device);
+
+/**
+ * @brief Wait until at most max_pending queued transactions of a device are left.
+ * 
+ * As transactions end in order, all but the last max_pending queued buffers 
+ * can be reused after it returns (e.g. for ping-pong buffers).
+ * 
+ * @param device SPI device
+ * @param max_pending Number of transactions that can remain queued
+ */
+void SpiQueueWaitPending(spi_dev_t device, uint8_t max_pending);
+
 /**
  * @brief De-Initialize SPI module with the corresponding configuration
  * 
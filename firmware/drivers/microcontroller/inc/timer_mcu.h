@@ -17,12 +17,20 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 17/10/2026 | Software timer wheel		                         						|
+ * | 17/10/2026 | Jitter and latency statistics                         				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include <stdbool.h>
+#include "uart_mcu.h"
 /*==================[macros]=================================================*/
+#define TIMER_WHEEL_L0_BITS		8		/*!< Slots of the first wheel level (2^8 ticks) */
+#define TIMER_WHEEL_LN_BITS		6		/*!< Slots of the upper wheel levels */
+#define TIMER_NUM				3		/*!< Number of hardware timers */
+#define TIMER_STATS_BINS		16		/*!< Histogram bins: 0us, [1,2)us, [2,4)us ... [2^14,inf)us */
 
 /*==================[typedef]================================================*/
 /**
@@ -42,6 +50,41 @@ typedef struct {
 	void *func_p;			/*!< Pointer to callback function to call periodically */
 	void *param_p;			/*!< Pointer to callback function parameter */
 } timer_config_t;
+
+/**
+ * @brief Timer statistics (in us)
+ */
+typedef struct {
+	uint32_t count;						/*!< Number of samples */
+	uint32_t min;						/*!< Minimum value */
+	uint32_t max;						/*!< Maximum value */
+	uint64_t sum;						/*!< Sum of values (mean = sum / count) */
+	uint32_t hist[TIMER_STATS_BINS];	/*!< log2 histogram (see TimerStatsBin()) */
+} timer_stats_t;
+
+/**
+ * @brief Software timer configuration struct
+ */
+typedef struct {
+	uint32_t period;		/*!< Period (in us), rounded up to the wheel tick */
+	bool one_shot;			/*!< true: fire once, false: fire periodically */
+	void *func_p;			/*!< Pointer to callback function (called from ISR), can be NULL */
+	void *param_p;			/*!< Pointer to callback function parameter */
+	void *task_h;			/*!< Handle (TaskHandle_t) of a task to notify from ISR, can be NULL */
+} soft_timer_config_t;
+
+/**
+ * @brief Software timer
+ * 
+ * @note Memory is provided by the user (static or global), the wheel only links it.
+ */
+typedef struct soft_timer {
+	soft_timer_config_t config;	/*!< Timer configuration */
+	uint32_t ticks;				/*!< Period in wheel ticks */
+	uint32_t expiry;			/*!< Wheel tick of the next expiration */
+	struct soft_timer *next;	/*!< Next timer in the same slot */
+	struct soft_timer **pprev;	/*!< Link pointing to this timer, NULL when stopped */
+} soft_timer_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -98,6 +141,118 @@ void TimerReset(timer_mcu_t timer);
  */
 void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period);
 
+/**
+ * @brief Enable or disable jitter and latency statistics for a timer.
+ * 
+ * When enabled, each alarm is timestamped in the ISR and the period jitter 
+ * (deviation from the configured period) is recorded. Calling TimerStatsTaskWoken() 
+ * from the task notified by the timer records the wake-up latency.
+ * 
+ * @param timer Timer number
+ * @param enable true to enable statistics (they are reset)
+ */
+void TimerStatsEnable(timer_mcu_t timer, bool enable);
+
+/**
+ * @brief Record the wake-up latency of the task notified by a timer.
+ * 
+ * Call it right after ulTaskNotifyTake() returns.
+ * 
+ * @param timer Timer number
+ */
+void TimerStatsTaskWoken(timer_mcu_t timer);
+
+/**
+ * @brief Get a snapshot of the timer statistics.
+ * 
+ * @param timer Timer number
+ * @param jitter Pointer to struct where period jitter statistics will be stored (can be NULL)
+ * @param latency Pointer to struct where task wake-up latency statistics will be stored (can be NULL)
+ */
+void TimerStatsGet(timer_mcu_t timer, timer_stats_t *jitter, timer_stats_t *latency);
+
+/**
+ * @brief Reset the timer statistics.
+ * 
+ * @param timer Timer number
+ */
+void TimerStatsReset(timer_mcu_t timer);
+
+/**
+ * @brief Histogram bin of a value: 0 for 0us, n for [2^(n-1), 2^n)us.
+ * 
+ * @param value Value (in us)
+ * @return Histogram bin
+ */
+uint8_t TimerStatsBin(uint32_t value);
+
+/**
+ * @brief Send the timer statistics through the selected UART.
+ * 
+ * @note UartInit() must be called first.
+ * 
+ * @param timer Timer number
+ * @param port UART port
+ */
+void TimerStatsPrint(timer_mcu_t timer, uart_mcu_port_t port);
+
+/**
+ * @brief Software timer wheel initialization
+ * 
+ * Any number of software timers are multiplexed onto one hardware timer, 
+ * which interrupts every tick. Start and stop are O(1), and each tick only 
+ * visits the timers that expire in it (plus a cascade every 256 ticks).
+ * 
+ * @param timer Hardware timer used by the wheel
+ * @param tick Wheel tick (in us)
+ */
+void TimerWheelInit(timer_mcu_t timer, uint32_t tick);
+
+/**
+ * @brief Start the software timer wheel
+ */
+void TimerWheelStart(void);
+
+/**
+ * @brief Read the number of ticks elapsed since the wheel was started
+ * 
+ * @return Wheel ticks
+ */
+uint32_t TimerWheelTicks(void);
+
+/**
+ * @brief Software timer initialization
+ * 
+ * @note Timer is stopped after init
+ * 
+ * @param soft_timer Software timer
+ * @param config Pointer to software timer configuration
+ */
+void TimerSoftInit(soft_timer_t *soft_timer, soft_timer_config_t *config);
+
+/**
+ * @brief Start (or restart) a software timer. It can be called from a callback.
+ * 
+ * @param soft_timer Software timer
+ */
+void TimerSoftStart(soft_timer_t *soft_timer);
+
+/**
+ * @brief Stop a software timer. It can be called from a callback.
+ * 
+ * @param soft_timer Software timer
+ */
+void TimerSoftStop(soft_timer_t *soft_timer);
+
+/**
+ * @brief Update software timer period. It takes effect from the next expiration.
+ * It can be called from a callback.
+ * 
+ * @param soft_timer Software timer
+ * @param period Period (in us)
+ */
+void TimerSoftUpdatePeriod(soft_timer_t *soft_timer, uint32_t period);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -17,13 +17,20 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 02/07/2024 | Document creation		                         						|
+ * | 17/10/2026 | Bulk and non-blocking transmission	                 					|
+ * | 17/10/2026 | UartItoa() decimal conversion through format.h                 		|
+ * | 17/10/2026 | Receive ring buffer with line and packet assembly               		|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include <stdbool.h>
 /*==================[macros]=================================================*/
 #define UART_NO_INT	0		/*!< Flag used when no reading interruption is required */
+#define UART_TX_QUEUE_LEN	8	/*!< Buffers that can be pending in UartSendBufferAsync() */
+#define UART_RX_RING_SIZE	512	/*!< Receive ring size (power of 2) */
+#define UART_RX_MSG_MAX		256	/*!< Maximum line/packet length */
 /*==================[typedef]================================================*/
 /**
  * @brief List of UART ports available in ESP-EDU
@@ -32,6 +39,28 @@ typedef enum uart_ports{
 	UART_PC,				/*!< UART connected PC through USB port (indicated with UART) (also maped to TX: GPIO16, RX: GPIO17) */
 	UART_CONNECTOR,			/*!< UART connected to J2 connector (TX: GPIO18, RX: GPIO19) */
 } uart_mcu_port_t;
+/**
+ * @brief Receive assembler modes
+ */
+typedef enum uart_rx_modes{
+	UART_RX_RAW,			/*!< No assembly: bytes are read with UartRxRead() */
+	UART_RX_LINE,			/*!< Lines ended with a delimiter */
+	UART_RX_PACKET,			/*!< Packets prefixed with their length (1 byte) */
+} uart_rx_mode_t;
+/**
+ * @brief Receive assembler configuration struct
+ * 
+ * The handler prototype is void handler(void *param, const uint8_t *msg, uint16_t len). 
+ * It is called from the UART event task with each complete line (without the delimiter 
+ * nor a '\r' before it, and ended with '\0') or packet (without the length byte). 
+ * In UART_RX_RAW mode it is called with msg = NULL and len = bytes available in the ring.
+ */
+typedef struct {
+	uart_rx_mode_t mode;	/*!< Assembler mode */
+	char delimiter;			/*!< Line delimiter (UART_RX_LINE), usually '\n' */
+	void *func_p;			/*!< Pointer to handler function (can be NULL) */
+	void *param_p;			/*!< Pointer to handler function parameters */
+} uart_rx_config_t;
 /**
  * @brief Serial port configuration struct
  */
@@ -40,7 +69,28 @@ typedef struct {
 	uint32_t baud_rate;		/*!< baudrate (bits per second) */
 	void *func_p;			/*!< Pointer to callback function to call when receiving data (= UART_NO_INT if not requiered)*/
 	void *param_p;			/*!< Pointer to callback function parameters */
+	uart_rx_config_t *rx_p;	/*!< Pointer to receive assembler configuration (NULL if not requiered). When used, received data is only available through it */
 } serial_config_t;
+/**
+ * @brief Receive counters
+ */
+typedef struct {
+	uint32_t bytes;			/*!< Bytes moved to the receive ring */
+	uint32_t messages;		/*!< Lines/packets delivered */
+	uint32_t fifo_overruns;	/*!< Hardware FIFO overflows (data lost) */
+	uint32_t buffer_full;	/*!< UART driver buffer full events */
+	uint32_t ring_overruns;	/*!< Bytes dropped because the receive ring was full */
+	uint32_t msg_overruns;	/*!< Lines/packets dropped (too long or broken by an overflow) */
+} uart_rx_stats_t;
+/**
+ * @brief Non-blocking transmission counters
+ */
+typedef struct {
+	uint32_t bytes_in_flight;	/*!< Bytes queued and not yet handed to the UART driver */
+	uint32_t bytes_sent;		/*!< Bytes handed to the UART driver */
+	uint32_t buffers_sent;		/*!< Buffers completed */
+	uint32_t drops;				/*!< Buffers rejected because the queue was full */
+} uart_tx_stats_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -95,11 +145,65 @@ void UartSendString(uart_mcu_port_t port, const char *msg);
  * @param data Pointer to array of data to be transmitted
  * @param nbytes Number of bytes to be sended
  */
-void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes);
+void UartSendBuffer(uart_mcu_port_t port, const char *data, uint16_t nbytes);
+
+/**
+ * @brief Queue a buffer for transmission and return immediately
+ * 
+ * The buffer is not copied when queued: it must not be modified until the completion 
+ * callback is called. Buffers are sent in order by a transmission task, which is 
+ * created on the first call. The task copies each buffer to the UART driver ring 
+ * buffer (TX FIFO fed by the UART ISR, not by DMA), so the callback is called when the 
+ * last byte was copied there, not when it was sent on the line.
+ * 
+ * @note Each buffer is sent without being split, but the blocking functions 
+ * (UartSendString(), UartSendBuffer(), ...) are not ordered with the buffers pending 
+ * here: their data can be sent between or before them. To keep the order on a port, 
+ * send everything with this function.
+ * 
+ * @param port Port for sending data
+ * @param data Pointer to array of data to be transmitted
+ * @param nbytes Number of bytes to be sended (any length)
+ * @param func_p Pointer to callback function called (from the transmission task) when the buffer can be reused (can be NULL)
+ * @param param_p Pointer to callback function parameters
+ * @return true if the buffer was queued, false if the queue was full (buffer dropped) or 
+ * there was no memory for the queue or the transmission task (the next call tries again)
+ */
+bool UartSendBufferAsync(uart_mcu_port_t port, const uint8_t *data, uint32_t nbytes, void *func_p, void *param_p);
+
+/**
+ * @brief Get the non-blocking transmission counters
+ * 
+ * @param port Port
+ * @param stats Pointer to struct where counters will be stored
+ */
+void UartTxGetStats(uart_mcu_port_t port, uart_tx_stats_t *stats);
+
+/**
+ * @brief Read bytes from the receive ring (UART_RX_RAW mode), without blocking
+ * 
+ * @param port Port to read from
+ * @param data Pointer to array where data will be stored
+ * @param nbytes Maximum number of bytes to read
+ * @return Number of bytes read
+ */
+uint16_t UartRxRead(uart_mcu_port_t port, uint8_t *data, uint16_t nbytes);
+
+/**
+ * @brief Get the receive counters
+ * 
+ * @param port Port
+ * @param stats Pointer to struct where counters will be stored
+ */
+void UartRxGetStats(uart_mcu_port_t port, uart_rx_stats_t *stats);
 
 /**
  * @brief Convert a number to a String (char array ended with '\0')
  * 
+ * @note The returned string is overwritten by the next call, so it must not be 
+ * used from several tasks at once. FormatU32() and FormatPrint() (format.h) 
+ * write to a buffer supplied by the caller.
+ * 
  * @param val Number to be converted
  * @param base Base of the converted number (2: binary, 10: decimal, 16: hexadecimal)
  * @return uint8_t* 
@@ -11,23 +11,147 @@
 
 /*==================[inclusions]=============================================*/
 #include "analog_io_mcu.h"
+#include <string.h>
+#include <stdlib.h>
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
 #include "esp_adc/adc_cali_scheme.h"
 #include "esp_adc/adc_oneshot.h"
 #include "esp_adc/adc_continuous.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_CH_NUM			4							// Analog inputs available in ESP-EDU
+#define ADC_CONT_FRAME_BYTES	(ADC_CONT_FRAME_LEN * SOC_ADC_DIGI_RESULT_BYTES)	// DMA frame size in bytes
+#define ADC_CONT_POOL_FRAMES	4						// DMA frames stored in the driver ring buffer
+#define ADC_CONT_TS_LEN		8							// Frame timestamps ring length (power of 2, > ADC_CONT_POOL_FRAMES)
+#define ADC_CONT_RING_LEN	(2 * ADC_CONT_FRAME_LEN)	// Unread samples kept per channel (power of 2)
+#define US_PER_SEC			1000000
+#define NS_PER_SEC			1000000000ULL
+#define ADC_LUT_LEN			(1 << ADC_BITWIDTH)			// One entry for every raw value
+#define ADC_OSR_MAX			256							// Max oversampling ratio (boxcar)
+#define ADC_OSR_CIC_MAX		64							// Max oversampling ratio (CIC): 12 + 3 * log2(OSR) bits must fit in 32 bits
+#define ADC_CIC_ORDER		3							// CIC filter order (sinc^3)
+#define DAC_TIMER_RES_HZ	10000000					// Waveform player timer resolution (0.1us)
+#define DAC_MIDSCALE		128							// AnalogOutputWrite() value for 0 pulse density
+/*==================[typedef]================================================*/
+/**
+ * @brief Oversampling state of a channel
+ */
+typedef struct {
+	adc_decim_t type;					/*!< Decimation filter */
+	uint16_t osr;						/*!< Oversampling ratio (0: oversampling disabled) */
+	uint8_t shift;						/*!< Right shift to apply to the filter output */
+	uint16_t phase;						/*!< Input samples since the last output */
+	uint32_t acc[ADC_CIC_ORDER];		/*!< Boxcar sum (acc[0]) or CIC integrators */
+	uint32_t delay[ADC_CIC_ORDER];		/*!< CIC comb delays */
+} adc_oversampling_t;
 /*==================[internal data declaration]==============================*/
 adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
 adc_oneshot_unit_handle_t adc1_single; 
-adc_continuous_handle_t adc2_cont;
+adc_continuous_handle_t adc2_cont = NULL;
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
+uint8_t adc_cont_channels = 0;						/*!< Channels configured in continuous mode (bit mask) */
+uint8_t adc_cont_running = 0;						/*!< Channels converting in continuous mode (bit mask) */
+uint32_t adc_cont_sample_frec = SOC_ADC_SAMPLE_FREQ_THRES_LOW;	/*!< Sample frequency per channel */
+void (*adc_cont_isr_p)(void*) = NULL;				/*!< Pointer to the frame end callback */
+void *adc_cont_user_data;							/*!< Frame end callback parameter */
+static volatile uint32_t adc_cont_frames = 0;		/*!< DMA frames completed */
+static volatile uint32_t adc_cont_overruns = 0;		/*!< DMA frames lost (pool full) */
+static volatile int64_t adc_cont_ts[ADC_CONT_TS_LEN];	/*!< Frame end timestamps (us), one per frame in the pool */
+static volatile uint8_t adc_cont_ts_head = 0;		/*!< Next timestamp to write (ISR) */
+static volatile uint8_t adc_cont_ts_tail = 0;		/*!< Next timestamp to read */
+static uint32_t adc_cont_frame_len = 0;				/*!< Samples per frame of the current handle */
+static uint32_t adc_cont_rate = 0;					/*!< Conversions per second (all channels) */
+static adc_ch_t adc_scan_channels[ADC_CH_NUM];		/*!< Scan group channels, in pattern order */
+static uint8_t adc_scan_num = 0;					/*!< Scan group channels count */
+static uint8_t adc_scan_index[ADC_CH_NUM];			/*!< Position of each channel in the scan */
+static uint32_t adc_scan_frec;						/*!< Scan group frequency (scans per second) */
+static bool adc_scan_running = false;				/*!< Scan group converting */
+static uint16_t *adc_cali_lut[ADC_CH_NUM] = {NULL};	/*!< Raw to mV lookup tables, by channel */
+static adc_oversampling_t adc_ovs[ADC_CH_NUM];		/*!< Oversampling state, by channel */
+gptimer_handle_t dac_timer = NULL;					/*!< Waveform player sample timer */
+static portMUX_TYPE dac_wave_lock = portMUX_INITIALIZER_UNLOCKED;
+static dac_play_mode_t dac_wave_mode;				/*!< Waveform player mode */
+static const uint8_t *dac_wave_buf = NULL;			/*!< Buffer being played */
+static uint32_t dac_wave_len;						/*!< Length of the buffer being played */
+static const uint8_t *dac_wave_init_buf = NULL;	/*!< Buffer set by AnalogOutputWaveInit() (one shot replay) */
+static uint32_t dac_wave_init_len;					/*!< Length of the buffer set by AnalogOutputWaveInit() */
+static uint32_t dac_wave_idx;						/*!< Next sample to play */
+static const uint8_t *dac_wave_next = NULL;			/*!< Buffer queued (stream mode) */
+static uint32_t dac_wave_next_len;					/*!< Length of the buffer queued */
+void (*dac_wave_isr_p)(void*) = NULL;				/*!< Pointer to the buffer end callback */
+void *dac_wave_user_data;							/*!< Buffer end callback parameter */
+static volatile uint32_t dac_wave_samples = 0;		/*!< Samples written to the DAC */
+static volatile uint32_t dac_wave_buffers = 0;		/*!< Buffers completed */
+static volatile uint32_t dac_wave_underruns = 0;	/*!< Sample periods with no buffer to play */
+static uint8_t adc_cont_frame[ADC_CONT_FRAME_BYTES];					/*!< Last frame taken from the pool */
+static uint16_t adc_cont_samples[ADC_CH_NUM][ADC_CONT_FRAME_LEN];		/*!< Last frame samples, by channel */
+static uint16_t adc_cont_count[ADC_CH_NUM];								/*!< Last frame samples count, by channel */
+static uint16_t adc_cont_ring[ADC_CH_NUM][ADC_CONT_RING_LEN];			/*!< Unread samples, by channel */
+static uint16_t adc_cont_head[ADC_CH_NUM];								/*!< Next sample to write in each ring (free running) */
+static uint16_t adc_cont_tail[ADC_CH_NUM];								/*!< Next sample to read from each ring (free running) */
+static uint32_t adc_cont_discarded[ADC_CH_NUM];							/*!< Unread samples overwritten, by channel */
 /*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR adc_cont_conv_done(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	adc_cont_frames++;
+	adc_cont_ts[adc_cont_ts_head & (ADC_CONT_TS_LEN - 1)] = esp_timer_get_time();
+	adc_cont_ts_head++;
+	if(adc_cont_isr_p != NULL){
+		adc_cont_isr_p(adc_cont_user_data);
+	}
+	return true;
+}
+static bool IRAM_ATTR adc_cont_pool_ovf(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	/* The frame just timestamped by adc_cont_conv_done() was discarded */
+	adc_cont_ts_head--;
+	adc_cont_overruns++;
+	return false;
+}
+static bool IRAM_ATTR dac_timer_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	bool buffer_end = false;
 
+	portENTER_CRITICAL_ISR(&dac_wave_lock);
+	if(dac_wave_buf == NULL){
+		/* Stream mode without data: hold the last value */
+		dac_wave_underruns++;
+		portEXIT_CRITICAL_ISR(&dac_wave_lock);
+		return false;
+	}
+	sdm_channel_set_pulse_density(dac, (int8_t)(dac_wave_buf[dac_wave_idx] - DAC_MIDSCALE));
+	dac_wave_samples++;
+	if(++dac_wave_idx >= dac_wave_len){
+		dac_wave_idx = 0;
+		dac_wave_buffers++;
+		buffer_end = true;
+		switch(dac_wave_mode){
+			case DAC_ONE_SHOT:
+				dac_wave_buf = NULL;
+				gptimer_stop(timer);
+			break;
+			case DAC_LOOP:
+			break;
+			case DAC_STREAM:
+				dac_wave_buf = dac_wave_next;
+				dac_wave_len = dac_wave_next_len;
+				dac_wave_next = NULL;
+			break;
+		}
+	}
+	portEXIT_CRITICAL_ISR(&dac_wave_lock);
+	if(buffer_end && dac_wave_isr_p != NULL){
+		dac_wave_isr_p(dac_wave_user_data);
+	}
+	return true;
+}
 /*==================[internal data definition]===============================*/
+adc_continuous_evt_cbs_t adc_cont_cbs = {
+	.on_conv_done = adc_cont_conv_done,
+	.on_pool_ovf = adc_cont_pool_ovf,
+};
 adc_oneshot_unit_init_cfg_t init_config_single = {
 	.unit_id = ADC_UNIT_1,
 	.ulp_mode = ADC_ULP_MODE_DISABLE,
@@ -39,7 +163,218 @@ adc_oneshot_chan_cfg_t adc_config_single = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Configure the pattern table and (re)start the conversion.
+ * 
+ * The handle is created again when the frame size changes, so that scan group
+ * frames always hold a whole number of scans.
+ * 
+ * @param channels Channels in pattern order
+ * @param num Number of channels
+ * @param sample_frec Sample frequency per channel
+ * @param frame_len Samples per DMA frame
+ */
+static void AnalogContinuousConfig(const adc_ch_t *channels, uint8_t num, uint32_t sample_frec, uint32_t frame_len){
+	static adc_digi_pattern_config_t adc_pattern[ADC_CH_NUM];
+
+	if(adc2_cont != NULL && adc_cont_frame_len != frame_len){
+		adc_continuous_deinit(adc2_cont);
+		adc2_cont = NULL;
+	}
+	if(adc2_cont == NULL){
+		adc_continuous_handle_cfg_t init_config_cont = {
+			.max_store_buf_size = ADC_CONT_POOL_FRAMES * frame_len * SOC_ADC_DIGI_RESULT_BYTES,
+			.conv_frame_size = frame_len * SOC_ADC_DIGI_RESULT_BYTES,
+		};
+		ESP_ERROR_CHECK(adc_continuous_new_handle(&init_config_cont, &adc2_cont));
+		ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc2_cont, &adc_cont_cbs, NULL));
+		adc_cont_frame_len = frame_len;
+	}
+	for(uint8_t i = 0; i < num; i++){
+		adc_pattern[i].atten = ADC_ATTENUATION;
+		adc_pattern[i].channel = channels[i];		// CHx is connected to ADC_CHANNEL_x
+		adc_pattern[i].unit = ADC_UNIT_1;
+		adc_pattern[i].bit_width = ADC_BITWIDTH;
+	}
+	/* Every channel in the pattern is converted at the requested frequency */
+	adc_cont_rate = sample_frec * num;
+	if(adc_cont_rate < SOC_ADC_SAMPLE_FREQ_THRES_LOW){
+		adc_cont_rate = SOC_ADC_SAMPLE_FREQ_THRES_LOW;
+	}else if(adc_cont_rate > SOC_ADC_SAMPLE_FREQ_THRES_HIGH){
+		adc_cont_rate = SOC_ADC_SAMPLE_FREQ_THRES_HIGH;
+	}
+	adc_continuous_config_t dig_cfg = {
+		.pattern_num = num,
+		.adc_pattern = adc_pattern,
+		.sample_freq_hz = adc_cont_rate,
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+	};
+	ESP_ERROR_CHECK(adc_continuous_config(adc2_cont, &dig_cfg));
+	memset(adc_cont_head, 0, sizeof(adc_cont_head));
+	memset(adc_cont_tail, 0, sizeof(adc_cont_tail));
+	adc_cont_ts_tail = adc_cont_ts_head;
+	ESP_ERROR_CHECK(adc_continuous_start(adc2_cont));
+}
+
+/**
+ * @brief Configure the pattern table with the running channels (ascending order) and start.
+ */
+static void AnalogContinuousStart(void){
+	adc_ch_t channels[ADC_CH_NUM];
+	uint8_t num = 0;
+
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		if(adc_cont_running & (1 << ch)){
+			channels[num++] = ch;
+		}
+	}
+	AnalogContinuousConfig(channels, num, adc_cont_sample_frec, ADC_CONT_FRAME_LEN);
+}
+
+/**
+ * @brief Take the oldest frame from the pool.
+ * 
+ * @param timestamp Time (in us) when the frame conversion ended
+ * @return Number of samples in adc_cont_frame (0 if there is no frame available)
+ */
+static uint32_t AnalogContinuousReadFrame(int64_t *timestamp){
+	uint32_t length = 0;
+
+	if(adc_continuous_read(adc2_cont, adc_cont_frame, adc_cont_frame_len * SOC_ADC_DIGI_RESULT_BYTES, &length, 0) != ESP_OK){
+		return 0;
+	}
+	if(adc_cont_ts_tail != adc_cont_ts_head){
+		*timestamp = adc_cont_ts[adc_cont_ts_tail & (ADC_CONT_TS_LEN - 1)];
+		adc_cont_ts_tail++;
+	}else{
+		*timestamp = esp_timer_get_time();
+	}
+	return length / SOC_ADC_DIGI_RESULT_BYTES;
+}
+
+/**
+ * @brief Decimate (in place) a block of samples of an oversampled channel.
+ * 
+ * The filter state is kept between calls, so an output sample can be built from 
+ * input samples of consecutive frames.
+ * 
+ * @param ovs Channel oversampling state
+ * @param samples Input raw samples, replaced by the decimated samples
+ * @param len Number of input samples
+ * @return Number of decimated samples
+ */
+static uint16_t AnalogDecimate(adc_oversampling_t *ovs, uint16_t *samples, uint16_t len){
+	uint16_t out = 0;
+	uint32_t comb, aux;
+
+	for(uint16_t i = 0; i < len; i++){
+		switch(ovs->type){
+			case ADC_DECIM_BOXCAR:
+				ovs->acc[0] += samples[i];
+			break;
+			case ADC_DECIM_CIC:
+				/* Integrators (modular arithmetic, overflow is cancelled by the combs) */
+				ovs->acc[0] += samples[i];
+				ovs->acc[1] += ovs->acc[0];
+				ovs->acc[2] += ovs->acc[1];
+			break;
+		}
+		if(++ovs->phase < ovs->osr){
+			continue;
+		}
+		ovs->phase = 0;
+		switch(ovs->type){
+			case ADC_DECIM_BOXCAR:
+				samples[out++] = ovs->acc[0] >> ovs->shift;
+				ovs->acc[0] = 0;
+			break;
+			case ADC_DECIM_CIC:
+				/* Combs, at the output rate */
+				comb = ovs->acc[2];
+				for(uint8_t k = 0; k < ADC_CIC_ORDER; k++){
+					aux = comb;
+					comb -= ovs->delay[k];
+					ovs->delay[k] = aux;
+				}
+				samples[out++] = comb >> ovs->shift;
+			break;
+		}
+	}
+	return out;
+}
+
+/**
+ * @brief Take the oldest frame from the pool and add its samples to the channel rings.
+ * 
+ * When a ring is full its oldest samples are overwritten (and counted as discarded).
+ * 
+ * @return true if a frame was available
+ */
+static bool AnalogContinuousFetch(void){
+	uint32_t length;
+	int64_t timestamp;
+	adc_digi_output_data_t *p;
+
+	length = AnalogContinuousReadFrame(&timestamp);
+	if(length == 0){
+		return false;
+	}
+	memset(adc_cont_count, 0, sizeof(adc_cont_count));
+	for(uint32_t i = 0; i < length; i++){
+		p = (adc_digi_output_data_t*)&adc_cont_frame[i * SOC_ADC_DIGI_RESULT_BYTES];
+		if(p->type2.channel < ADC_CH_NUM){
+			adc_cont_samples[p->type2.channel][adc_cont_count[p->type2.channel]++] = p->type2.data;
+		}
+	}
+	for(uint8_t ch = 0; ch < ADC_CH_NUM; ch++){
+		if(adc_ovs[ch].osr > 1){
+			adc_cont_count[ch] = AnalogDecimate(&adc_ovs[ch], adc_cont_samples[ch], adc_cont_count[ch]);
+		}
+		for(uint16_t i = 0; i < adc_cont_count[ch]; i++){
+			if((uint16_t)(adc_cont_head[ch] - adc_cont_tail[ch]) == ADC_CONT_RING_LEN){
+				adc_cont_tail[ch]++;
+				adc_cont_discarded[ch]++;
+			}
+			adc_cont_ring[ch][adc_cont_head[ch]++ & (ADC_CONT_RING_LEN - 1)] = adc_cont_samples[ch][i];
+		}
+	}
+	return true;
+}
+/**
+ * @brief Get the calibration curve of a channel, creating it if needed.
+ * 
+ * @param channel Channel selected
+ * @return Pointer to the channel calibration handle
+ */
+static adc_cali_handle_t* AnalogCalibrationScheme(adc_ch_t channel){
+	adc_cali_handle_t *handle = &adc_calibration_single_0;
 
+	switch(channel){
+		case CH0:
+			handle = &adc_calibration_single_0;
+		break;
+		case CH1:
+			handle = &adc_calibration_single_1;
+		break;
+		case CH2:
+			handle = &adc_calibration_single_2;
+		break;
+		case CH3:
+			handle = &adc_calibration_single_3;
+		break;
+	}
+	if(*handle == NULL){
+		adc_cali_curve_fitting_config_t cali_config = {
+			.unit_id = ADC_UNIT_1,
+			.chan = channel,
+			.atten = ADC_ATTENUATION,
+			.bitwidth = ADC_BITWIDTH,
+		};
+		ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config, handle));
+	}
+	return handle;
+}
 /*==================[external functions definition]==========================*/
 
 void AnalogInputInit(analog_input_config_t *config){
@@ -99,19 +434,14 @@ void AnalogInputInit(analog_input_config_t *config){
 			}
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
-
-				break;
-				case CH1:
-
-				break;
-				case CH2:
-
-				break;
-				case CH3:
-
-				break;
+			adc_cont_channels |= (1 << config->input);
+			/* All channels share the DMA frames, so the fastest channel sets the sample frequency */
+			if(config->sample_frec > adc_cont_sample_frec){
+				adc_cont_sample_frec = config->sample_frec;
+			}
+			if(config->func_p != NULL){
+				adc_cont_isr_p = config->func_p;
+				adc_cont_user_data = config->param_p;
 			}
 		break;
 	}
@@ -145,19 +475,320 @@ void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
 }
 
 void AnalogStartContinuous(adc_ch_t channel){
-
+	if(!(adc_cont_channels & (1 << channel))){
+		return;		// channel not initialized in continuous mode
+	}
+	if(adc_scan_running){
+		AnalogScanGroupStop();
+	}
+	if(adc_cont_running){
+		adc_continuous_stop(adc2_cont);
+	}
+	adc_cont_running |= (1 << channel);
+	AnalogContinuousStart();
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
+	if(!(adc_cont_running & (1 << channel))){
+		return;
+	}
+	adc_continuous_stop(adc2_cont);
+	adc_cont_running &= ~(1 << channel);
+	if(adc_cont_running){
+		AnalogContinuousStart();
+	}
+}
+
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	uint16_t count;
+
+	if(!(adc_cont_running & (1 << channel))){
+		return 0;
+	}
+	/* Other channels keep their samples in their rings. An oversampled channel may 
+	 * get no output from a frame: keep taking frames while there are any */
+	while(adc_cont_head[channel] == adc_cont_tail[channel]){
+		if(!AnalogContinuousFetch()){
+			return 0;
+		}
+	}
+	count = adc_cont_head[channel] - adc_cont_tail[channel];
+	if(count > ADC_CONT_FRAME_LEN){
+		count = ADC_CONT_FRAME_LEN;
+	}
+	for(uint16_t i = 0; i < count; i++){
+		values[i] = adc_cont_ring[channel][adc_cont_tail[channel]++ & (ADC_CONT_RING_LEN - 1)];
+	}
+	return count;
+}
+
+void AnalogContinuousGetStats(analog_cont_stats_t *stats){
+	stats->frames = adc_cont_frames;
+	stats->overruns = adc_cont_overruns;
+	memcpy(stats->discarded, adc_cont_discarded, sizeof(stats->discarded));
+}
+
+bool AnalogScanGroupInit(analog_scan_config_t *config){
+	uint8_t used = 0;
+
+	if(config->num_channels == 0 || config->num_channels > ADC_CH_NUM){
+		return false;
+	}
+	/* Each channel once: samples are placed by the channel position in the scan */
+	for(uint8_t i = 0; i < config->num_channels; i++){
+		if(config->channels[i] >= ADC_CH_NUM || (used & (1 << config->channels[i]))){
+			return false;
+		}
+		used |= (1 << config->channels[i]);
+	}
+	adc_scan_num = config->num_channels;
+	for(uint8_t i = 0; i < adc_scan_num; i++){
+		adc_scan_channels[i] = config->channels[i];
+		adc_scan_index[config->channels[i]] = i;
+	}
+	adc_scan_frec = config->scan_frec;
+	adc_cont_isr_p = config->func_p;
+	adc_cont_user_data = config->param_p;
+	return true;
+}
+
+void AnalogScanGroupStart(void){
+	if(adc_scan_num == 0){
+		return;
+	}
+	if(adc_cont_running){
+		adc_continuous_stop(adc2_cont);
+		adc_cont_running = 0;
+	}
+	if(adc_scan_running){
+		adc_continuous_stop(adc2_cont);
+	}
+	/* Frames hold a whole number of scans, so every frame starts with the first channel */
+	AnalogContinuousConfig(adc_scan_channels, adc_scan_num, adc_scan_frec, (ADC_CONT_FRAME_LEN / adc_scan_num) * adc_scan_num);
+	adc_scan_running = true;
+}
+
+void AnalogScanGroupStop(void){
+	if(adc_scan_running){
+		adc_continuous_stop(adc2_cont);
+		adc_scan_running = false;
+	}
+}
+
+uint16_t AnalogScanGroupRead(analog_scan_frame_t *frame){
+	uint32_t length, i;
+	uint16_t scans = 0;
+	uint8_t next = 0;
+	int64_t timestamp;
+	adc_digi_output_data_t *p;
+
+	frame->scans = 0;
+	frame->num_channels = adc_scan_num;
+	if(!adc_scan_running){
+		return 0;
+	}
+	length = AnalogContinuousReadFrame(&timestamp);
+	if(length == 0){
+		return 0;
+	}
+	for(i = 0; i < length; i++){
+		p = (adc_digi_output_data_t*)&adc_cont_frame[i * SOC_ADC_DIGI_RESULT_BYTES];
+		if(p->type2.channel >= ADC_CH_NUM || adc_scan_index[p->type2.channel] != next){
+			next = 0;		// out of sequence: drop the partial scan and resync
+			continue;
+		}
+		frame->samples[scans * adc_scan_num + next] = p->type2.data;
+		if(++next == adc_scan_num){
+			next = 0;
+			scans++;
+		}
+	}
+	frame->scans = scans;
+	frame->scan_period_ns = NS_PER_SEC * adc_scan_num / adc_cont_rate;
+	/* The frame timestamp is taken when its last conversion ends */
+	frame->timestamp = timestamp - (int64_t)((length - 1) * NS_PER_SEC / adc_cont_rate) / 1000;
+	return scans;
+}
+
+void AnalogScanGroupDeinterleave(const analog_scan_frame_t *frame, uint8_t index, uint16_t *values){
+	const uint16_t *src = &frame->samples[index];
+
+	for(uint16_t i = 0; i < frame->scans; i++){
+		values[i] = *src;
+		src += frame->num_channels;
+	}
+}
+
+uint8_t AnalogOversamplingConfig(adc_ch_t channel, uint16_t osr, adc_decim_t type){
+	adc_oversampling_t *ovs = &adc_ovs[channel];
+	uint8_t log2_osr = 0;
+
+	memset(ovs, 0, sizeof(adc_oversampling_t));
+	if(osr <= 1){
+		return ADC_BITWIDTH;		// oversampling disabled
+	}
+	if(osr > ((type == ADC_DECIM_CIC) ? ADC_OSR_CIC_MAX : ADC_OSR_MAX)){
+		osr = (type == ADC_DECIM_CIC) ? ADC_OSR_CIC_MAX : ADC_OSR_MAX;
+	}
+	while((2 << log2_osr) <= osr){
+		log2_osr++;
+	}
+	ovs->osr = 1 << log2_osr;		// rounded down to a power of 2
+	ovs->type = type;
+	/* Filter gain is OSR (boxcar) or OSR^3 (CIC): keep log2(OSR)/2 extra bits */
+	ovs->shift = ((type == ADC_DECIM_CIC) ? ADC_CIC_ORDER * log2_osr : log2_osr) - log2_osr / 2;
+	return ADC_BITWIDTH + log2_osr / 2;
+}
+
+bool AnalogCalibrationInit(adc_ch_t channel){
+	adc_cali_handle_t *handle;
+	int voltage;
+
+	if(adc_cali_lut[channel] != NULL){
+		return true;
+	}
+	adc_cali_lut[channel] = malloc(ADC_LUT_LEN * sizeof(uint16_t));
+	if(adc_cali_lut[channel] == NULL){
+		return false;
+	}
+	/* Evaluate the curve fitting polynomial once for every raw value */
+	handle = AnalogCalibrationScheme(channel);
+	for(uint32_t raw = 0; raw < ADC_LUT_LEN; raw++){
+		adc_cali_raw_to_voltage(*handle, raw, &voltage);
+		adc_cali_lut[channel][raw] = voltage;
+	}
+	return true;
+}
+
+void AnalogRawToMilliVolts(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint32_t len){
+	const uint16_t *lut = adc_cali_lut[channel];
+	adc_cali_handle_t *handle;
+	int voltage;
 
+	if(lut != NULL){
+		for(uint32_t i = 0; i < len; i++){
+			mv[i] = lut[raw[i] & (ADC_LUT_LEN - 1)];
+		}
+	}else{
+		/* No lookup table for this channel: evaluate the calibration curve */
+		handle = AnalogCalibrationScheme(channel);
+		for(uint32_t i = 0; i < len; i++){
+			adc_cali_raw_to_voltage(*handle, raw[i], &voltage);
+			mv[i] = voltage;
+		}
+	}
 }
 
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+void AnalogScanGroupToMilliVolts(analog_scan_frame_t *frame){
+	const uint16_t *lut[ADC_CH_NUM];
+	uint32_t len = frame->scans * frame->num_channels;
+	uint8_t i;
+
+	for(i = 0; i < frame->num_channels; i++){
+		if(adc_cali_lut[adc_scan_channels[i]] == NULL && !AnalogCalibrationInit(adc_scan_channels[i])){
+			/* No memory for the tables: convert channel by channel (curve where there is no table) */
+			for(i = 0; i < frame->num_channels; i++){
+				for(uint32_t n = i; n < len; n += frame->num_channels){
+					AnalogRawToMilliVolts(adc_scan_channels[i], &frame->samples[n], &frame->samples[n], 1);
+				}
+			}
+			return;
+		}
+		lut[i] = adc_cali_lut[adc_scan_channels[i]];
+	}
+	i = 0;
+	for(uint32_t n = 0; n < len; n++){
+		frame->samples[n] = lut[i][frame->samples[n] & (ADC_LUT_LEN - 1)];
+		if(++i == frame->num_channels){
+			i = 0;
+		}
+	}
+}
+
+bool AnalogOutputWaveInit(analog_output_wave_t *wave){
+	if(wave->sample_frec == 0 || wave->sample_frec > DAC_TIMER_RES_HZ){
+		return false;
+	}
+	if(dac_timer == NULL){
+		gptimer_config_t timer_config = {
+			.clk_src = GPTIMER_CLK_SRC_DEFAULT,
+			.direction = GPTIMER_COUNT_UP,
+			.resolution_hz = DAC_TIMER_RES_HZ,
+		};
+		ESP_ERROR_CHECK(gptimer_new_timer(&timer_config, &dac_timer));
+		gptimer_event_callbacks_t dac_cbs = {
+			.on_alarm = dac_timer_isr,
+		};
+		ESP_ERROR_CHECK(gptimer_register_event_callbacks(dac_timer, &dac_cbs, NULL));
+		ESP_ERROR_CHECK(gptimer_enable(dac_timer));
+	}else{
+		AnalogOutputWaveStop();
+	}
+	gptimer_alarm_config_t alarm_config = {
+		.alarm_count = DAC_TIMER_RES_HZ / wave->sample_frec,
+		.reload_count = 0,
+		.flags.auto_reload_on_alarm = true,
+	};
+	gptimer_set_alarm_action(dac_timer, &alarm_config);
+
+	portENTER_CRITICAL(&dac_wave_lock);
+	dac_wave_mode = wave->mode;
+	dac_wave_buf = wave->samples;
+	dac_wave_len = wave->len;
+	dac_wave_init_buf = wave->samples;
+	dac_wave_init_len = wave->len;
+	dac_wave_idx = 0;
+	dac_wave_next = NULL;
+	dac_wave_isr_p = wave->func_p;
+	dac_wave_user_data = wave->param_p;
+	portEXIT_CRITICAL(&dac_wave_lock);
+	return true;
+}
+
+void AnalogOutputWaveStart(void){
+	portENTER_CRITICAL(&dac_wave_lock);
+	if(dac_wave_mode == DAC_ONE_SHOT && dac_wave_buf == NULL){
+		/* The buffer was played to the end: re-arm it */
+		dac_wave_buf = dac_wave_init_buf;
+		dac_wave_len = dac_wave_init_len;
+		dac_wave_idx = 0;
+	}
+	portEXIT_CRITICAL(&dac_wave_lock);
+	gptimer_set_raw_count(dac_timer, 0);
+	gptimer_start(dac_timer);
+}
+
+void AnalogOutputWaveStop(void){
+	gptimer_stop(dac_timer);
+}
+
+bool AnalogOutputWaveQueue(const uint8_t *samples, uint32_t len){
+	bool queued = true;
+
+	portENTER_CRITICAL(&dac_wave_lock);
+	if(dac_wave_buf == NULL){
+		/* Player starved (or one shot ended): play it right away */
+		dac_wave_buf = samples;
+		dac_wave_len = len;
+		dac_wave_idx = 0;
+	}else if(dac_wave_next == NULL){
+		dac_wave_next = samples;
+		dac_wave_next_len = len;
+	}else{
+		queued = false;
+	}
+	portEXIT_CRITICAL(&dac_wave_lock);
+	return queued;
+}
 
+void AnalogOutputWaveGetStats(analog_wave_stats_t *stats){
+	stats->samples = dac_wave_samples;
+	stats->buffers = dac_wave_buffers;
+	stats->underruns = dac_wave_underruns;
 }
 
 void AnalogOutputWrite(uint8_t value){
-	int8_t density = value - 128;
+	int8_t density = value - DAC_MIDSCALE;
 	sdm_channel_set_pulse_density(dac, density);
 }
 
@@ -22,8 +22,10 @@
 #define PIN_NUM_CS1		GPIO_19	/*!<  */
 #define PIN_NUM_CS2		GPIO_18	/*!<  */
 #define PIN_NUM_CS3		GPIO_9	/*!<  */
+#define SPI_DEVICES		3		/*!< Number of devices (chip selects) */
+#define TXDATA_MAX		4		/*!< Transfers up to this size are copied into the descriptor */
 /*==================[internal data declaration]==============================*/
-spi_device_handle_t spi_1, spi_2, spi_3;
+spi_device_handle_t spi_1 = NULL, spi_2 = NULL, spi_3 = NULL;
 const spi_bus_config_t bus_cfg = {
     .miso_io_num = PIN_NUM_MISO,
     .mosi_io_num = PIN_NUM_MOSI,
@@ -39,6 +41,12 @@ void (*spi_3_isr_p)(void*);	/*!<  */
 void *spi_1_user_data;	    /*!<  */
 void *spi_2_user_data;	    /*!<  */
 void *spi_3_user_data;	    /*!<  */
+void (*spi_1_pre_p)(void*);	/*!< Pre-transaction callback for device 1 */
+void (*spi_2_pre_p)(void*);	/*!< Pre-transaction callback for device 2 */
+void (*spi_3_pre_p)(void*);	/*!< Pre-transaction callback for device 3 */
+static spi_transaction_t spi_queue[SPI_DEVICES][SPI_QUEUE_SIZE];	/*!< Pre-allocated queued transactions, by device */
+static uint8_t spi_queue_head[SPI_DEVICES];		/*!< Next free descriptor (descriptors are used in order) */
+static uint8_t spi_queue_pending[SPI_DEVICES];	/*!< Queued transactions not yet reclaimed */
 /*==================[internal functions declaration]=========================*/
 static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
 	spi_1_isr_p(spi_1_user_data);
@@ -49,11 +57,38 @@ static void IRAM_ATTR spi_2_isr(spi_transaction_t *t){
 static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
 	spi_3_isr_p(spi_3_user_data);
 }
+static void IRAM_ATTR spi_1_pre(spi_transaction_t *t){
+	spi_1_pre_p(t->user);
+}
+static void IRAM_ATTR spi_2_pre(spi_transaction_t *t){
+	spi_2_pre_p(t->user);
+}
+static void IRAM_ATTR spi_3_pre(spi_transaction_t *t){
+	spi_3_pre_p(t->user);
+}
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static spi_device_handle_t SpiHandle(spi_dev_t device){
+    switch(device){
+        case SPI_1:
+            return spi_1;
+        case SPI_2:
+            return spi_2;
+        case SPI_3:
+            return spi_3;
+    }
+    return NULL;
+}
+
+/* Reclaims the oldest queued transaction (blocking until it ends) */
+static void SpiQueueReclaim(spi_dev_t device){
+    spi_transaction_t *t;
+    spi_device_get_trans_result(SpiHandle(device), &t, portMAX_DELAY);
+    spi_queue_pending[device]--;
+}
 
 /*==================[external functions definition]==========================*/
 uint8_t SpiInit(spi_mcu_config_t* spi){
@@ -65,35 +100,59 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 	spi_device_interface_config_t dev_cfg = {
         .clock_speed_hz = spi->bitrate,     	
         .mode = spi->clk_mode,                  
-        .queue_size = 8,                        
+        .queue_size = SPI_QUEUE_SIZE,
     };
     switch(spi->device){
         case SPI_1:
+            if(spi_1 != NULL){
+                /* Already registered */
+                break;
+            }
             dev_cfg.spics_io_num = PIN_NUM_CS1;
             transfer_mode_1 = spi->transfer_mode;
             if(transfer_mode_1 == SPI_INTERRUPT){
                 dev_cfg.post_cb = spi_1_isr;
             } 
+            if(spi->pre_func_p != NULL){
+                spi_1_pre_p = spi->pre_func_p;
+                dev_cfg.pre_cb = spi_1_pre;
+            }
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_1);
             spi_1_isr_p = spi->func_p;
             spi_1_user_data = spi->param_p;
             break;
         case SPI_2:
+            if(spi_2 != NULL){
+                /* Already registered */
+                break;
+            }
             dev_cfg.spics_io_num = PIN_NUM_CS2;
+            transfer_mode_2 = spi->transfer_mode;
             if(transfer_mode_2 == SPI_INTERRUPT){
                 dev_cfg.post_cb = spi_2_isr;
             } 
-            transfer_mode_1 = spi->transfer_mode;
+            if(spi->pre_func_p != NULL){
+                spi_2_pre_p = spi->pre_func_p;
+                dev_cfg.pre_cb = spi_2_pre;
+            }
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_2);
             spi_2_isr_p = spi->func_p;
             spi_2_user_data = spi->param_p;
             break;
         case SPI_3:
+            if(spi_3 != NULL){
+                /* Already registered */
+                break;
+            }
             dev_cfg.spics_io_num = PIN_NUM_CS3;
+            transfer_mode_3 = spi->transfer_mode;
             if(transfer_mode_3 == SPI_INTERRUPT){
                 dev_cfg.post_cb = spi_3_isr;
             } 
-            transfer_mode_1 = spi->transfer_mode;
+            if(spi->pre_func_p != NULL){
+                spi_3_pre_p = spi->pre_func_p;
+                dev_cfg.pre_cb = spi_3_pre;
+            }
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_3);
             spi_3_isr_p = spi->func_p;
             spi_3_user_data = spi->param_p;
@@ -104,6 +163,7 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 
 void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
     spi_transaction_t t;
+    SpiQueueWait(device);           // Polling transfers can't be mixed with queued ones
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = rx_buffer_size * 8;
@@ -144,6 +204,7 @@ void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     spi_transaction_t t;
+    SpiQueueWait(device);           // Polling transfers can't be mixed with queued ones
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.tx_buffer = tx_buffer;        // Data
@@ -183,6 +244,7 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
     spi_transaction_t t;
+    SpiQueueWait(device);           // Polling transfers can't be mixed with queued ones
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = buffer_size * 8;     // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = buffer_size * 8;
@@ -222,6 +284,42 @@ void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, ui
     }
 }
 
+bool SpiQueueWrite(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size, void *user){
+    spi_transaction_t *t;
+    if(spi_queue_pending[device] == SPI_QUEUE_SIZE){
+        SpiQueueReclaim(device);
+    }
+    t = &spi_queue[device][spi_queue_head[device]];
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = tx_buffer_size * 8;
+    t->user = user;
+    if(tx_buffer_size <= TXDATA_MAX){
+        /* Small transfers are copied, so the buffer can be reused right away */
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, tx_buffer, tx_buffer_size);
+    }else{
+        t->tx_buffer = tx_buffer;
+    }
+    /* A rejected transaction (too long, device not registered) will never have a 
+     * result to reclaim: don't count it, or SpiQueueWait() would block forever */
+    if(spi_device_queue_trans(SpiHandle(device), t, portMAX_DELAY) != ESP_OK){
+        return false;
+    }
+    spi_queue_head[device] = (spi_queue_head[device] + 1) % SPI_QUEUE_SIZE;
+    spi_queue_pending[device]++;
+    return true;
+}
+
+void SpiQueueWait(spi_dev_t device){
+    SpiQueueWaitPending(device, 0);
+}
+
+void SpiQueueWaitPending(spi_dev_t device, uint8_t max_pending){
+    while(spi_queue_pending[device] > max_pending){
+        SpiQueueReclaim(device);
+    }
+}
+
 uint8_t SpiDeInit(spi_dev_t device){
     return 0;
 }
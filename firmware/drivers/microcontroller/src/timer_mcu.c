@@ -14,9 +14,19 @@
 #include "driver/gptimer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
+#include "format.h"
+#include <string.h>
 /*==================[macros and definitions]=================================*/
 #define US_RESOLUTION_HZ	1000000	/*!< 1usec */
 #define RESET_COUNT_VALUE	0		/*!< Reset timer count to 0 */
+#define WHEEL_L0_SIZE		(1 << TIMER_WHEEL_L0_BITS)
+#define WHEEL_L0_MASK		(WHEEL_L0_SIZE - 1)
+#define WHEEL_LN_SIZE		(1 << TIMER_WHEEL_LN_BITS)
+#define WHEEL_LN_MASK		(WHEEL_LN_SIZE - 1)
+#define WHEEL_LEVELS		3		/*!< Levels: 256 ticks, 64 x 256 ticks, 64 x 16384 ticks */
+#define WHEEL_SHIFT(n)		(TIMER_WHEEL_L0_BITS + (n) * TIMER_WHEEL_LN_BITS)
+#define WHEEL_MAX_TICKS		((1UL << WHEEL_SHIFT(WHEEL_LEVELS - 1)) - 1)
 /*==================[internal data declaration]==============================*/
 gptimer_handle_t timer_a = NULL;	/*!< Handle for timer A */	
 gptimer_handle_t timer_b = NULL;	/*!< Handle for timer B */			
@@ -44,19 +54,186 @@ void *timer_c_user_data;	            /*!< User data for timer C */
 gptimer_alarm_config_t alarm_config_a;  /*!< Configuration for alarm A */
 gptimer_alarm_config_t alarm_config_b;	/*!< Configuration for alarm B */
 gptimer_alarm_config_t alarm_config_c;	/*!< Configuration for alarm C */
+
+/**
+ * @brief Statistics state of each timer
+ * 
+ * The jitter fields and last_alarm are written by the timer ISR and the latency 
+ * fields by the notified task. The 64 bit values can't be read in one access, so 
+ * every access to the statistics is done with stats_lock taken. The ISR also reads 
+ * enable without the lock, only to skip the statistics when they are off.
+ */
+typedef struct {
+	volatile bool enable;			/*!< Statistics enabled */
+	uint32_t period;				/*!< Configured period (in us) */
+	int64_t last_alarm;				/*!< Timestamp of the last alarm (0: none yet) */
+	timer_stats_t jitter;			/*!< Period jitter */
+	timer_stats_t latency;			/*!< Task wake-up latency */
+} timer_stats_state_t;
+static timer_stats_state_t timer_stats[TIMER_NUM];	/*!< Statistics, by timer */
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static timer_mcu_t wheel_timer;							/*!< Hardware timer used by the wheel */
+static uint32_t wheel_tick_us = 1;						/*!< Wheel tick (in us) */
+static volatile uint32_t wheel_now = 0;					/*!< Next wheel tick to process */
+static soft_timer_t *wheel_l0[WHEEL_L0_SIZE];			/*!< First level: one slot per tick */
+static soft_timer_t *wheel_ln[WHEEL_LEVELS - 1][WHEEL_LN_SIZE];	/*!< Upper levels */
+static soft_timer_t *wheel_expired = NULL;				/*!< Timers expired in the current tick */
+static portMUX_TYPE wheel_lock = portMUX_INITIALIZER_UNLOCKED;
 /*==================[internal functions declaration]=========================*/
+static void IRAM_ATTR StatsAdd(timer_stats_t *stats, uint32_t value){
+	if(stats->count == 0 || value < stats->min){
+		stats->min = value;
+	}
+	if(value > stats->max){
+		stats->max = value;
+	}
+	stats->sum += value;
+	stats->hist[TimerStatsBin(value)]++;
+	stats->count++;
+}
+
+static void IRAM_ATTR StatsAlarm(timer_mcu_t timer){
+	timer_stats_state_t *state = &timer_stats[timer];
+	int64_t now = esp_timer_get_time();
+
+	portENTER_CRITICAL_ISR(&stats_lock);
+	/* Disabled after the ISR checked it */
+	if(state->enable){
+		if(state->last_alarm != 0){
+			int64_t jitter = (now - state->last_alarm) - state->period;
+			StatsAdd(&state->jitter, (jitter < 0) ? -jitter : jitter);
+		}
+		state->last_alarm = now;
+	}
+	portEXIT_CRITICAL_ISR(&stats_lock);
+}
+
+/* Must be called with stats_lock taken */
+static void StatsClear(timer_stats_state_t *state){
+	state->last_alarm = 0;
+	memset(&state->jitter, 0, sizeof(timer_stats_t));
+	memset(&state->latency, 0, sizeof(timer_stats_t));
+}
+
 static bool IRAM_ATTR timer_a_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	if(timer_stats[TIMER_A].enable){
+		StatsAlarm(TIMER_A);
+	}
 	timer_a_isr_p(timer_a_user_data);
 	return true;
 }
 static bool IRAM_ATTR timer_b_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	if(timer_stats[TIMER_B].enable){
+		StatsAlarm(TIMER_B);
+	}
 	timer_b_isr_p(timer_b_user_data);
 	return true;
 }
 static bool IRAM_ATTR timer_c_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	if(timer_stats[TIMER_C].enable){
+		StatsAlarm(TIMER_C);
+	}
 	timer_c_isr_p(timer_c_user_data);
 	return true;
 }
+/* The wheel helpers run from the timer ISR: keep them in IRAM */
+static void IRAM_ATTR WheelLink(soft_timer_t **head, soft_timer_t *soft_timer){
+	soft_timer->next = *head;
+	if(*head != NULL){
+		(*head)->pprev = &soft_timer->next;
+	}
+	*head = soft_timer;
+	soft_timer->pprev = head;
+}
+
+static void IRAM_ATTR WheelUnlink(soft_timer_t *soft_timer){
+	*soft_timer->pprev = soft_timer->next;
+	if(soft_timer->next != NULL){
+		soft_timer->next->pprev = soft_timer->pprev;
+	}
+	soft_timer->pprev = NULL;
+}
+
+/* Must be called with wheel_lock taken */
+static void IRAM_ATTR WheelInsert(soft_timer_t *soft_timer){
+	int32_t delta = soft_timer->expiry - wheel_now;
+	uint32_t expiry = soft_timer->expiry;
+	soft_timer_t **slot;
+
+	if(delta < 0){
+		/* Already expired: process in the next tick */
+		slot = &wheel_l0[wheel_now & WHEEL_L0_MASK];
+	}else if(delta < WHEEL_L0_SIZE){
+		slot = &wheel_l0[expiry & WHEEL_L0_MASK];
+	}else{
+		if(delta > WHEEL_MAX_TICKS){
+			/* Beyond the wheel range: park it in the last slot, it will be reinserted when cascaded */
+			expiry = wheel_now + WHEEL_MAX_TICKS;
+			delta = WHEEL_MAX_TICKS;
+		}
+		uint8_t level = 0;
+		while((uint32_t)delta >= (1UL << WHEEL_SHIFT(level + 1))){
+			level++;
+		}
+		slot = &wheel_ln[level][(expiry >> WHEEL_SHIFT(level)) & WHEEL_LN_MASK];
+	}
+	WheelLink(slot, soft_timer);
+}
+
+/* Must be called with wheel_lock taken. Moves timers of an upper level slot to the lower levels */
+static void IRAM_ATTR WheelCascade(soft_timer_t **slot){
+	soft_timer_t *soft_timer = *slot;
+	*slot = NULL;
+	while(soft_timer != NULL){
+		soft_timer_t *next = soft_timer->next;
+		WheelInsert(soft_timer);
+		soft_timer = next;
+	}
+}
+
+static void IRAM_ATTR WheelTick(void *param){
+	soft_timer_t *soft_timer;
+	uint32_t idx;
+
+	portENTER_CRITICAL_ISR(&wheel_lock);
+	idx = wheel_now & WHEEL_L0_MASK;
+	for(uint8_t level = 0; (idx == 0) && (level < WHEEL_LEVELS - 1); level++){
+		idx = (wheel_now >> WHEEL_SHIFT(level)) & WHEEL_LN_MASK;
+		WheelCascade(&wheel_ln[level][idx]);
+	}
+	/* Move the current slot to the expired list, so timers can still be stopped from callbacks */
+	wheel_expired = wheel_l0[wheel_now & WHEEL_L0_MASK];
+	if(wheel_expired != NULL){
+		wheel_expired->pprev = &wheel_expired;
+	}
+	wheel_l0[wheel_now & WHEEL_L0_MASK] = NULL;
+	wheel_now++;
+	portEXIT_CRITICAL_ISR(&wheel_lock);
+
+	while(1){
+		portENTER_CRITICAL_ISR(&wheel_lock);
+		soft_timer = wheel_expired;
+		if(soft_timer == NULL){
+			portEXIT_CRITICAL_ISR(&wheel_lock);
+			break;
+		}
+		WheelUnlink(soft_timer);
+		if(!soft_timer->config.one_shot){
+			soft_timer->expiry += soft_timer->ticks;
+			WheelInsert(soft_timer);
+		}
+		portEXIT_CRITICAL_ISR(&wheel_lock);
+
+		if(soft_timer->config.func_p != NULL){
+			((void (*)(void*))soft_timer->config.func_p)(soft_timer->config.param_p);
+		}
+		if(soft_timer->config.task_h != NULL){
+			/* The timer ISR wrapper always requests a context switch on exit */
+			vTaskNotifyGiveFromISR(soft_timer->config.task_h, NULL);
+		}
+	}
+}
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
@@ -65,6 +242,9 @@ static bool IRAM_ATTR timer_c_isr(gptimer_handle_t timer, const gptimer_alarm_ev
 
 /*==================[external functions definition]==========================*/
 void TimerInit(timer_config_t *timer_ini){
+	portENTER_CRITICAL(&stats_lock);
+	timer_stats[timer_ini->timer].period = timer_ini->period;
+	portEXIT_CRITICAL(&stats_lock);
 	switch(timer_ini->timer){
 	 	case TIMER_A:
 			timer_a_isr_p = timer_ini->func_p;
@@ -172,6 +352,9 @@ void TimerReset(timer_mcu_t timer){
 }
 
 void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
+	portENTER_CRITICAL(&stats_lock);
+	timer_stats[timer].period = period;
+	portEXIT_CRITICAL(&stats_lock);
 	switch(timer){
 	 	case TIMER_A:
 			alarm_config_a.alarm_count = period;
@@ -188,4 +371,132 @@ void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
 	}
 }
 
+void TimerStatsEnable(timer_mcu_t timer, bool enable){
+	portENTER_CRITICAL(&stats_lock);
+	StatsClear(&timer_stats[timer]);
+	timer_stats[timer].enable = enable;
+	portEXIT_CRITICAL(&stats_lock);
+}
+
+void TimerStatsTaskWoken(timer_mcu_t timer){
+	timer_stats_state_t *state = &timer_stats[timer];
+
+	/* Time taken with the lock, so an alarm can't come after it */
+	portENTER_CRITICAL(&stats_lock);
+	if(state->enable && state->last_alarm != 0){
+		StatsAdd(&state->latency, (uint32_t)(esp_timer_get_time() - state->last_alarm));
+	}
+	portEXIT_CRITICAL(&stats_lock);
+}
+
+void TimerStatsGet(timer_mcu_t timer, timer_stats_t *jitter, timer_stats_t *latency){
+	portENTER_CRITICAL(&stats_lock);
+	if(jitter != NULL){
+		*jitter = timer_stats[timer].jitter;
+	}
+	if(latency != NULL){
+		*latency = timer_stats[timer].latency;
+	}
+	portEXIT_CRITICAL(&stats_lock);
+}
+
+void TimerStatsReset(timer_mcu_t timer){
+	portENTER_CRITICAL(&stats_lock);
+	StatsClear(&timer_stats[timer]);
+	portEXIT_CRITICAL(&stats_lock);
+}
+
+uint8_t IRAM_ATTR TimerStatsBin(uint32_t value){
+	uint8_t bin = 0;
+
+	if(value != 0){
+		bin = 32 - __builtin_clz(value);
+	}
+	return (bin < TIMER_STATS_BINS) ? bin : TIMER_STATS_BINS - 1;
+}
+
+static void StatsPrint(uart_mcu_port_t port, const char *name, timer_stats_t *stats){
+	char line[FORMAT_U32_LEN * (TIMER_STATS_BINS + 4) + 48];
+	uint16_t len;
+
+	len = FormatPrint(line, sizeof(line), "%s n:%u min:%u max:%u mean:%u hist:", name, stats->count, 
+		stats->min, stats->max, (uint32_t)((stats->count != 0) ? stats->sum / stats->count : 0));
+	for(uint8_t i = 0; i < TIMER_STATS_BINS; i++){
+		len += FormatPrint(line + len, sizeof(line) - len, " %u", stats->hist[i]);
+	}
+	FormatPrint(line + len, sizeof(line) - len, "\r\n");
+	UartSendString(port, line);
+}
+
+void TimerStatsPrint(timer_mcu_t timer, uart_mcu_port_t port){
+	timer_stats_t jitter, latency;
+	char title[16];
+
+	TimerStatsGet(timer, &jitter, &latency);
+	FormatPrint(title, sizeof(title), "Timer %c (us)\r\n", 'A' + timer);
+	UartSendString(port, title);
+	StatsPrint(port, " jitter ", &jitter);
+	StatsPrint(port, " latency", &latency);
+}
+
+void TimerWheelInit(timer_mcu_t timer, uint32_t tick){
+	wheel_timer = timer;
+	wheel_tick_us = tick;
+	wheel_now = 0;
+	timer_config_t wheel_config = {
+		.timer = timer,
+		.period = tick,
+		.func_p = WheelTick,
+		.param_p = NULL
+	};
+	TimerInit(&wheel_config);
+}
+
+void TimerWheelStart(void){
+	TimerStart(wheel_timer);
+}
+
+uint32_t TimerWheelTicks(void){
+	return wheel_now;
+}
+
+void TimerSoftInit(soft_timer_t *soft_timer, soft_timer_config_t *config){
+	soft_timer->config = *config;
+	soft_timer->ticks = (config->period + wheel_tick_us - 1) / wheel_tick_us;
+	if(soft_timer->ticks == 0){
+		soft_timer->ticks = 1;
+	}
+	soft_timer->next = NULL;
+	soft_timer->pprev = NULL;
+}
+
+void IRAM_ATTR TimerSoftStart(soft_timer_t *soft_timer){
+	portENTER_CRITICAL_SAFE(&wheel_lock);
+	if(soft_timer->pprev != NULL){
+		WheelUnlink(soft_timer);
+	}
+	/* wheel_now is the tick being counted, so a full period is ticks from the next one */
+	soft_timer->expiry = wheel_now + soft_timer->ticks - 1;
+	WheelInsert(soft_timer);
+	portEXIT_CRITICAL_SAFE(&wheel_lock);
+}
+
+void IRAM_ATTR TimerSoftStop(soft_timer_t *soft_timer){
+	portENTER_CRITICAL_SAFE(&wheel_lock);
+	if(soft_timer->pprev != NULL){
+		WheelUnlink(soft_timer);
+	}
+	portEXIT_CRITICAL_SAFE(&wheel_lock);
+}
+
+void IRAM_ATTR TimerSoftUpdatePeriod(soft_timer_t *soft_timer, uint32_t period){
+	uint32_t ticks = (period + wheel_tick_us - 1) / wheel_tick_us;
+
+	/* The ISR reads ticks to rearm periodic timers */
+	portENTER_CRITICAL_SAFE(&wheel_lock);
+	soft_timer->config.period = period;
+	soft_timer->ticks = (ticks == 0) ? 1 : ticks;
+	portEXIT_CRITICAL_SAFE(&wheel_lock);
+}
+
 /*==================[end of file]============================================*/
@@ -12,9 +12,12 @@
 /*==================[inclusions]=============================================*/
 #include "uart_mcu.h"
 #include "gpio_mcu.h"
+#include "format.h"
 #include "driver/uart.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/task.h"
+#include <string.h>
 #include "esp_log.h"
 /*==================[macros and definitions]=================================*/
 #define UART_CONN_TX        GPIO_18         /*!<  */
@@ -23,6 +26,10 @@
 #define RX_BUFFER_SIZE      256             /*!<  */
 #define EVENT_QUEUE_SIZE    16              /*!<  */
 #define READ_TIMEOUT        100             /*!<  */
+#define UART_PORTS          2               /*!< Number of ports in ESP-EDU */
+#define TX_TASK_STACK       2048            /*!< Transmission task stack size */
+#define RX_RING_MASK        (UART_RX_RING_SIZE - 1)
+#define RX_PKT_WAIT_LEN     0xFFFF          /*!< Packet assembler waiting for the length byte */
 /*==================[internal data declaration]==============================*/
 void (*uart_pc_isr_p)(void*);	            /*!<  */
 void (*uart_conn_isr_p)(void*);	            /*!<  */
@@ -30,6 +37,39 @@ void *uart_pc_user_data;	                /*!<  */
 void *uart_conn_user_data;	                /*!<  */
 static QueueHandle_t uart_pc_queue;         /*!<  */
 static QueueHandle_t uart_conn_queue;       /*!<  */
+/**
+ * @brief Buffer pending in the non-blocking transmission queue
+ */
+typedef struct {
+    const uint8_t *data;                    /*!< Data to send (not copied) */
+    uint32_t nbytes;                        /*!< Number of bytes */
+    void (*func_p)(void*);                  /*!< Completion callback */
+    void *param_p;                          /*!< Completion callback parameter */
+} uart_tx_desc_t;
+static const uart_port_t uart_num_map[UART_PORTS] = {UART_NUM_0, UART_NUM_1};  /*!< UART number of each port */
+static QueueHandle_t uart_tx_queue[UART_PORTS] = {NULL};    /*!< Non-blocking transmission queues */
+static bool uart_tx_creating[UART_PORTS] = {false};         /*!< Queue and task being created by a caller */
+static uart_tx_stats_t uart_tx_stats[UART_PORTS];           /*!< Non-blocking transmission counters */
+static portMUX_TYPE uart_tx_lock = portMUX_INITIALIZER_UNLOCKED;
+/**
+ * @brief Receive state of a port
+ * 
+ * The ring is single producer (UART event task) single consumer (assembler or 
+ * UartRxRead()), so head is only written by the producer and tail by the consumer.
+ */
+typedef struct {
+    bool enable;                            /*!< Receive assembler in use */
+    uart_rx_config_t config;                /*!< Assembler configuration */
+    uint8_t ring[UART_RX_RING_SIZE];        /*!< Receive ring */
+    volatile uint16_t head;                 /*!< Write index (free running) */
+    volatile uint16_t tail;                 /*!< Read index (free running) */
+    uint8_t msg[UART_RX_MSG_MAX + 1];       /*!< Message being assembled */
+    uint16_t msg_len;                       /*!< Bytes in msg */
+    uint16_t pkt_len;                       /*!< Expected packet length */
+    bool discard;                           /*!< Dropping bytes until the next message */
+    uart_rx_stats_t stats;                  /*!< Receive counters */
+} uart_rx_t;
+static uart_rx_t uart_rx[UART_PORTS];       /*!< Receive state, by port */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -37,6 +77,125 @@ static QueueHandle_t uart_conn_queue;       /*!<  */
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void UartRxDeliver(uart_rx_t *rx){
+    void (*handler)(void*, const uint8_t*, uint16_t) = rx->config.func_p;
+    if(!rx->discard){
+        rx->stats.messages++;
+        if(handler != NULL){
+            handler(rx->config.param_p, rx->msg, rx->msg_len);
+        }
+    }
+    rx->discard = false;
+    rx->msg_len = 0;
+}
+
+static void UartRxAssemble(uart_rx_t *rx, uint8_t byte){
+    switch(rx->config.mode){
+        case UART_RX_LINE:
+            if(byte == rx->config.delimiter){
+                if(rx->msg_len > 0 && rx->msg[rx->msg_len - 1] == '\r'){
+                    rx->msg_len--;
+                }
+                rx->msg[rx->msg_len] = '\0';
+                UartRxDeliver(rx);
+            }else if(rx->msg_len < UART_RX_MSG_MAX){
+                rx->msg[rx->msg_len++] = byte;
+            }else if(!rx->discard){
+                /* Line too long: drop it up to the next delimiter */
+                rx->discard = true;
+                rx->stats.msg_overruns++;
+            }
+            break;
+        case UART_RX_PACKET:
+            if(rx->pkt_len == RX_PKT_WAIT_LEN){
+                rx->pkt_len = byte;
+            }else{
+                rx->msg[rx->msg_len++] = byte;
+            }
+            if(rx->msg_len == rx->pkt_len){
+                UartRxDeliver(rx);
+                rx->pkt_len = RX_PKT_WAIT_LEN;
+            }
+            break;
+        case UART_RX_RAW:
+            break;
+    }
+}
+
+static void UartRxConsume(uart_rx_t *rx){
+    while(rx->tail != rx->head){
+        UartRxAssemble(rx, rx->ring[rx->tail & RX_RING_MASK]);
+        rx->tail++;
+    }
+}
+
+static void UartRxDrain(uart_mcu_port_t port, size_t available){
+    uart_rx_t *rx = &uart_rx[port];
+    uint8_t scratch[32];
+
+    while(available > 0){
+        uint16_t head = rx->head;
+        uint16_t free = UART_RX_RING_SIZE - (uint16_t)(head - rx->tail);
+        uint16_t contiguous = UART_RX_RING_SIZE - (head & RX_RING_MASK);
+        int len;
+        if(free == 0){
+            /* Ring full: drop the data so the driver buffer does not fill up */
+            len = uart_read_bytes(uart_num_map[port], scratch, (available < sizeof(scratch)) ? available : sizeof(scratch), 0);
+            if(len <= 0){
+                break;
+            }
+            rx->stats.ring_overruns += len;
+        }else{
+            if(contiguous > free){
+                contiguous = free;
+            }
+            len = uart_read_bytes(uart_num_map[port], &rx->ring[head & RX_RING_MASK], (available < contiguous) ? available : contiguous, 0);
+            if(len <= 0){
+                break;
+            }
+            rx->stats.bytes += len;
+            rx->head = head + len;
+            if(rx->config.mode != UART_RX_RAW){
+                /* The assembler is the consumer: empty the ring before reading more */
+                UartRxConsume(rx);
+            }
+        }
+        available -= len;
+    }
+}
+
+static void UartRxEvent(uart_mcu_port_t port, uart_event_t *event){
+    uart_rx_t *rx = &uart_rx[port];
+    void (*handler)(void*, const uint8_t*, uint16_t) = rx->config.func_p;
+    size_t available = event->size;
+
+    switch(event->type){
+        case UART_FIFO_OVF:
+            /* Bytes were lost in hardware: the message being assembled is broken */
+            rx->stats.fifo_overruns++;
+            if(rx->msg_len > 0 || rx->pkt_len != RX_PKT_WAIT_LEN){
+                rx->stats.msg_overruns++;
+            }
+            rx->discard = (rx->config.mode == UART_RX_LINE);
+            rx->msg_len = 0;
+            rx->pkt_len = RX_PKT_WAIT_LEN;
+            uart_get_buffered_data_len(uart_num_map[port], &available);
+            break;
+        case UART_BUFFER_FULL:
+            /* Data in the driver buffer is still valid, move it to the ring */
+            rx->stats.buffer_full++;
+            uart_get_buffered_data_len(uart_num_map[port], &available);
+            break;
+        default:
+            break;
+    }
+    UartRxDrain(port, available);
+
+    if(rx->config.mode == UART_RX_RAW && handler != NULL && rx->head != rx->tail){
+        handler(rx->config.param_p, NULL, (uint16_t)(rx->head - rx->tail));
+    }
+}
+
 static void uart_pc_event_task(void *pvParameters){
     uart_event_t event;
     uart_driver_install(UART_NUM_0, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 16, &uart_pc_queue, 0);
@@ -45,13 +204,27 @@ static void uart_pc_event_task(void *pvParameters){
         if (xQueueReceive(uart_pc_queue, (void *)&event, (TickType_t)portMAX_DELAY)){
             switch(event.type) {
                 case UART_DATA:
-                    uart_pc_isr_p(uart_pc_user_data);
+                    if(uart_rx[UART_PC].enable){
+                        UartRxEvent(UART_PC, &event);
+                    }
+                    if(uart_pc_isr_p != NULL){
+                        uart_pc_isr_p(uart_pc_user_data);
+                    }
                     break;
                 case UART_BREAK:
                     break;
                 case UART_BUFFER_FULL:
+                    if(uart_rx[UART_PC].enable){
+                        UartRxEvent(UART_PC, &event);
+                    }
                     break;
                 case UART_FIFO_OVF:
+                    if(uart_rx[UART_PC].enable){
+                        UartRxEvent(UART_PC, &event);
+                    }else{
+                        uart_flush_input(UART_NUM_0);
+                        xQueueReset(uart_pc_queue);
+                    }
                     break;
                 case UART_FRAME_ERR:
                     break;
@@ -78,13 +251,27 @@ static void uart_conn_event_task(void *pvParameters){
         if(xQueueReceive(uart_conn_queue, (void *)&event, (TickType_t)portMAX_DELAY)){
             switch(event.type) {
                 case UART_DATA:
-                    uart_conn_isr_p(uart_conn_user_data);
+                    if(uart_rx[UART_CONNECTOR].enable){
+                        UartRxEvent(UART_CONNECTOR, &event);
+                    }
+                    if(uart_conn_isr_p != NULL){
+                        uart_conn_isr_p(uart_conn_user_data);
+                    }
                     break;
                 case UART_BREAK:
                     break;
                 case UART_BUFFER_FULL:
+                    if(uart_rx[UART_CONNECTOR].enable){
+                        UartRxEvent(UART_CONNECTOR, &event);
+                    }
                     break;
                 case UART_FIFO_OVF:
+                    if(uart_rx[UART_CONNECTOR].enable){
+                        UartRxEvent(UART_CONNECTOR, &event);
+                    }else{
+                        uart_flush_input(UART_NUM_1);
+                        xQueueReset(uart_conn_queue);
+                    }
                     break;
                 case UART_FRAME_ERR:
                     break;
@@ -102,6 +289,59 @@ static void uart_conn_event_task(void *pvParameters){
         }
     }
 }
+
+static void uart_tx_task(void *pvParameters){
+    uart_mcu_port_t port = (uart_mcu_port_t)pvParameters;
+    uart_tx_desc_t desc;
+    while(1){
+        if(xQueueReceive(uart_tx_queue[port], &desc, portMAX_DELAY)){
+            /* Copies the buffer to the driver ring buffer (the UART ISR drains it to the FIFO),
+             * blocking only while it is full. The driver sends a whole call without interleaving */
+            uart_write_bytes(uart_num_map[port], desc.data, desc.nbytes);
+            portENTER_CRITICAL(&uart_tx_lock);
+            uart_tx_stats[port].bytes_in_flight -= desc.nbytes;
+            uart_tx_stats[port].bytes_sent += desc.nbytes;
+            uart_tx_stats[port].buffers_sent++;
+            portEXIT_CRITICAL(&uart_tx_lock);
+            if(desc.func_p != NULL){
+                desc.func_p(desc.param_p);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Create the transmission queue and task of a port.
+ * 
+ * The queue is published before the task is created (the task reads it), but 
+ * callers only use it once uart_tx_creating is cleared.
+ * 
+ * @param port Port
+ * @return false if there was no memory for the queue or the task (nothing is kept)
+ */
+static bool UartTxCreate(uart_mcu_port_t port){
+    QueueHandle_t queue = xQueueCreate(UART_TX_QUEUE_LEN, sizeof(uart_tx_desc_t));
+    bool created = false;
+
+    if(queue != NULL){
+        portENTER_CRITICAL(&uart_tx_lock);
+        uart_tx_queue[port] = queue;
+        portEXIT_CRITICAL(&uart_tx_lock);
+        if(xTaskCreate(uart_tx_task, "uart_tx_task", TX_TASK_STACK, (void*)port, 12, NULL) == pdPASS){
+            created = true;
+        }else{
+            portENTER_CRITICAL(&uart_tx_lock);
+            uart_tx_queue[port] = NULL;
+            portEXIT_CRITICAL(&uart_tx_lock);
+            vQueueDelete(queue);
+        }
+    }
+    /* On failure the next call tries again */
+    portENTER_CRITICAL(&uart_tx_lock);
+    uart_tx_creating[port] = false;
+    portEXIT_CRITICAL(&uart_tx_lock);
+    return created;
+}
 /*==================[external functions definition]==========================*/
 
 void UartInit(serial_config_t *port_config){
@@ -113,11 +353,20 @@ void UartInit(serial_config_t *port_config){
         .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
         .source_clk = UART_SCLK_DEFAULT,
     };
+    if(port_config->rx_p != NULL){
+        uart_rx[port_config->port].config = *port_config->rx_p;
+        uart_rx[port_config->port].head = 0;
+        uart_rx[port_config->port].tail = 0;
+        uart_rx[port_config->port].msg_len = 0;
+        uart_rx[port_config->port].pkt_len = RX_PKT_WAIT_LEN;
+        uart_rx[port_config->port].discard = false;
+        uart_rx[port_config->port].enable = true;
+    }
     switch(port_config->port){
         case UART_PC:
             uart_param_config(UART_NUM_0, &uart_config);
             uart_set_pin(UART_NUM_0, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-            if(port_config->func_p != UART_NO_INT){
+            if(port_config->func_p != UART_NO_INT || port_config->rx_p != NULL){
                 uart_pc_isr_p = port_config->func_p;
                 uart_pc_queue = port_config->param_p;
                 xTaskCreate(uart_pc_event_task, "uart_pc_event_task", 2048, NULL, 12, 0);
@@ -128,7 +377,7 @@ void UartInit(serial_config_t *port_config){
         case UART_CONNECTOR:
             uart_param_config(UART_NUM_1, &uart_config);
             uart_set_pin(UART_NUM_1, UART_CONN_TX, UART_CONN_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-            if(port_config->func_p != UART_NO_INT){
+            if(port_config->func_p != UART_NO_INT || port_config->rx_p != NULL){
                 uart_conn_isr_p = port_config->func_p;
                 uart_conn_queue = port_config->param_p;
                 xTaskCreate(uart_conn_event_task, "uart_conn_event_task", 2048, NULL, 12, NULL);
@@ -187,7 +436,7 @@ void UartSendByte(uart_mcu_port_t port, const char *data){
                 uart_num = UART_NUM_1;
             break;
     }
-    uart_tx_chars(uart_num, data, 1);
+    uart_write_bytes(uart_num, data, 1);
 }
 
 void UartSendString(uart_mcu_port_t port, const char *msg){
@@ -200,13 +449,10 @@ void UartSendString(uart_mcu_port_t port, const char *msg){
                 uart_num = UART_NUM_1;
             break;
     }
-	while(*msg != 0){
-        uart_tx_chars(uart_num, msg, 1);
-		msg++;
-	}
+    uart_write_bytes(uart_num, msg, strlen(msg));
 }
 
-void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
+void UartSendBuffer(uart_mcu_port_t port, const char *data, uint16_t nbytes){
     uart_port_t uart_num = UART_NUM_0;
     switch(port){
         case UART_PC:
@@ -216,12 +462,85 @@ void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
                 uart_num = UART_NUM_1;
             break;
     }
-    uart_tx_chars(uart_num, data, nbytes);
+    uart_write_bytes(uart_num, data, nbytes);
+}
+
+bool UartSendBufferAsync(uart_mcu_port_t port, const uint8_t *data, uint32_t nbytes, void *func_p, void *param_p){
+    uart_tx_desc_t desc = {
+        .data = data,
+        .nbytes = nbytes,
+        .func_p = func_p,
+        .param_p = param_p,
+    };
+    QueueHandle_t queue;
+    bool create = false, creating;
+
+    /* The first caller creates the queue and the task (they can't be created with the 
+     * lock taken), concurrent first callers wait for it */
+    portENTER_CRITICAL(&uart_tx_lock);
+    if(uart_tx_queue[port] == NULL && !uart_tx_creating[port]){
+        uart_tx_creating[port] = true;
+        create = true;
+    }
+    portEXIT_CRITICAL(&uart_tx_lock);
+    if(create && !UartTxCreate(port)){
+        return false;
+    }
+    while(1){
+        portENTER_CRITICAL(&uart_tx_lock);
+        queue = uart_tx_queue[port];
+        creating = uart_tx_creating[port];
+        portEXIT_CRITICAL(&uart_tx_lock);
+        if(!creating){
+            break;
+        }
+        vTaskDelay(1);
+    }
+    if(queue == NULL){
+        return false;       // the caller creating it ran out of memory
+    }
+    portENTER_CRITICAL(&uart_tx_lock);
+    uart_tx_stats[port].bytes_in_flight += nbytes;
+    portEXIT_CRITICAL(&uart_tx_lock);
+    if(xQueueSend(queue, &desc, 0) != pdTRUE){
+        portENTER_CRITICAL(&uart_tx_lock);
+        uart_tx_stats[port].bytes_in_flight -= nbytes;
+        uart_tx_stats[port].drops++;
+        portEXIT_CRITICAL(&uart_tx_lock);
+        return false;
+    }
+    return true;
+}
+
+void UartTxGetStats(uart_mcu_port_t port, uart_tx_stats_t *stats){
+    portENTER_CRITICAL(&uart_tx_lock);
+    *stats = uart_tx_stats[port];
+    portEXIT_CRITICAL(&uart_tx_lock);
+}
+
+uint16_t UartRxRead(uart_mcu_port_t port, uint8_t *data, uint16_t nbytes){
+    uart_rx_t *rx = &uart_rx[port];
+    uint16_t tail = rx->tail;
+    uint16_t len = 0;
+    while(len < nbytes && tail != rx->head){
+        data[len++] = rx->ring[tail & RX_RING_MASK];
+        tail++;
+    }
+    rx->tail = tail;
+    return len;
+}
+
+void UartRxGetStats(uart_mcu_port_t port, uart_rx_stats_t *stats){
+    *stats = uart_rx[port].stats;
 }
 
 uint8_t* UartItoa(uint32_t val, uint8_t base){
 	static uint8_t buf[32] = {0};
 	uint32_t i = 30;
+    if(base == 10){
+        FormatU32((char*)buf, val);
+        return buf;
+    }
     if(val == 0){
         return (uint8_t*)"0";
     }else{
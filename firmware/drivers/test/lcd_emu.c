@@ -0,0 +1,175 @@
+/**
+ * @file lcd_emu.c
+ * @brief Host ILI9341 emulator, fed by the SPI mock.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd_emu.h"
+#include "mock_idf.h"
+
+#define CMD_COLUMN_ADDR_SET		0x2A
+#define CMD_PAGE_ADDR_SET		0x2B
+#define CMD_MEM_WRITE			0x2C
+#define CMD_VERT_SCROLL_DEF		0x33
+#define CMD_VERT_SCROLL_START	0x37
+#define PARAMS_MAX				6
+
+static uint16_t screen[LCD_EMU_SIZE][LCD_EMU_SIZE];
+static uint8_t dc_gpio;
+static uint8_t cmd;
+static uint8_t params[PARAMS_MAX];
+static uint8_t params_num;
+static uint16_t col_start, col_end, page_start, page_end;
+static uint16_t col, page;
+static int16_t high_byte = -1;		/* First byte of a pixel, -1: none */
+static uint16_t scroll_start, scroll_area[3];
+static lcd_emu_stats_t stats;
+
+static void LcdEmuCommand(uint8_t byte){
+	cmd = byte;
+	params_num = 0;
+	high_byte = -1;
+	stats.commands++;
+	if(cmd == CMD_COLUMN_ADDR_SET || cmd == CMD_PAGE_ADDR_SET){
+		stats.address_sets++;
+	}else if(cmd == CMD_MEM_WRITE){
+		/* Writing starts on the top left corner of the window */
+		col = col_start;
+		page = page_start;
+		stats.mem_writes++;
+	}
+}
+
+static void LcdEmuPixelData(uint8_t byte){
+	if(high_byte < 0){
+		high_byte = byte;
+		return;
+	}
+	if(page > page_end){
+		stats.overruns++;
+	}else{
+		if(col < LCD_EMU_SIZE && page < LCD_EMU_SIZE){
+			screen[page][col] = (high_byte << 8) | byte;
+		}
+		if(++col > col_end){
+			col = col_start;
+			page++;
+		}
+	}
+	high_byte = -1;
+	stats.pixels++;
+}
+
+static void LcdEmuParameter(uint8_t byte){
+	if(cmd == CMD_MEM_WRITE){
+		LcdEmuPixelData(byte);
+		return;
+	}
+	if(params_num < PARAMS_MAX){
+		params[params_num++] = byte;
+	}
+	switch(cmd){
+	case CMD_COLUMN_ADDR_SET:
+		if(params_num == 4){
+			col_start = (params[0] << 8) | params[1];
+			col_end = (params[2] << 8) | params[3];
+		}
+		break;
+	case CMD_PAGE_ADDR_SET:
+		if(params_num == 4){
+			page_start = (params[0] << 8) | params[1];
+			page_end = (params[2] << 8) | params[3];
+		}
+		break;
+	case CMD_VERT_SCROLL_DEF:
+		if(params_num == 6){
+			for(uint8_t i = 0; i < 3; i++){
+				scroll_area[i] = (params[2 * i] << 8) | params[2 * i + 1];
+			}
+		}
+		break;
+	case CMD_VERT_SCROLL_START:
+		if(params_num == 2){
+			scroll_start = (params[0] << 8) | params[1];
+		}
+		break;
+	}
+}
+
+static void LcdEmuSink(const uint8_t *data, uint32_t len){
+	/* D/C was set by the pre-transaction callback and holds for the whole transaction */
+	bool is_data = MockGpioLevel(dc_gpio);
+
+	for(uint32_t i = 0; i < len; i++){
+		if(is_data){
+			LcdEmuParameter(data[i]);
+		}else{
+			LcdEmuCommand(data[i]);
+		}
+	}
+}
+
+void LcdEmuInit(uint8_t device, uint8_t gpio_dc){
+	dc_gpio = gpio_dc;
+	memset(screen, 0, sizeof(screen));
+	memset(&stats, 0, sizeof(stats));
+	cmd = 0;
+	params_num = 0;
+	high_byte = -1;
+	col_start = page_start = 0;
+	col_end = page_end = LCD_EMU_SIZE - 1;
+	scroll_start = 0;
+	scroll_area[0] = scroll_area[2] = 0;
+	scroll_area[1] = LCD_EMU_SIZE;
+	MockSpiSink(device, LcdEmuSink);
+}
+
+const uint16_t* LcdEmuScreen(void){
+	return &screen[0][0];
+}
+
+uint16_t LcdEmuPixel(uint16_t column, uint16_t page){
+	return screen[page][column];
+}
+
+uint32_t LcdEmuHash(uint16_t width, uint16_t height){
+	uint32_t hash = 2166136261u;
+
+	for(uint16_t y = 0; y < height; y++){
+		for(uint16_t x = 0; x < width; x++){
+			hash = (hash ^ (screen[y][x] >> 8)) * 16777619u;
+			hash = (hash ^ (screen[y][x] & 0xFF)) * 16777619u;
+		}
+	}
+	return hash;
+}
+
+bool LcdEmuSavePpm(const char *path, uint16_t width, uint16_t height){
+	FILE *f = fopen(path, "wb");
+
+	if(f == NULL){
+		return false;
+	}
+	fprintf(f, "P6\n%u %u\n255\n", width, height);
+	for(uint16_t y = 0; y < height; y++){
+		for(uint16_t x = 0; x < width; x++){
+			uint16_t c = screen[y][x];
+			uint8_t rgb[3] = {(c >> 11) << 3, ((c >> 5) & 0x3F) << 2, (c & 0x1F) << 3};
+			fwrite(rgb, 1, 3, f);
+		}
+	}
+	fclose(f);
+	return true;
+}
+
+void LcdEmuScroll(uint16_t *start, uint16_t area[3]){
+	*start = scroll_start;
+	memcpy(area, scroll_area, sizeof(scroll_area));
+}
+
+void LcdEmuStats(lcd_emu_stats_t *s, bool reset){
+	*s = stats;
+	if(reset){
+		memset(&stats, 0, sizeof(stats));
+	}
+}
@@ -0,0 +1,73 @@
+/**
+ * @file lcd_emu.h
+ * @brief Host ILI9341 emulator, fed by the SPI mock.
+ *
+ * Each byte sent to the SPI device is a command or a parameter depending on the
+ * D/C GPIO level when its transaction starts (driven by the pre-transaction
+ * callback). Column/page address set, memory write and vertical scrolling
+ * commands are decoded, the rest are only counted. Pixels are stored at the
+ * addressed column and page: memory access control is not applied, so landscape
+ * drawings use columns 0 to 319.
+ */
+#ifndef LCD_EMU_H
+#define LCD_EMU_H
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LCD_EMU_SIZE	320		/*!< Columns and pages of the emulated frame memory */
+
+/**
+ * @brief Emulator counters
+ */
+typedef struct {
+	uint32_t commands;		/*!< Command bytes */
+	uint32_t address_sets;	/*!< Column and page address set commands */
+	uint32_t mem_writes;	/*!< Memory write commands */
+	uint32_t pixels;		/*!< Pixels written */
+	uint32_t overruns;		/*!< Pixels written past the end of the window (discarded) */
+} lcd_emu_stats_t;
+
+/**
+ * @brief Attach the emulator to an SPI device and clear the frame memory.
+ *
+ * @param device SPI device index, in spi_bus_add_device() order (see MockSpiSink())
+ * @param gpio_dc D/C GPIO
+ */
+void LcdEmuInit(uint8_t device, uint8_t gpio_dc);
+
+/**
+ * @brief Frame memory, LCD_EMU_SIZE x LCD_EMU_SIZE pixels (RGB565), row (page) by row.
+ */
+const uint16_t* LcdEmuScreen(void);
+
+/**
+ * @brief Pixel of the frame memory.
+ */
+uint16_t LcdEmuPixel(uint16_t column, uint16_t page);
+
+/**
+ * @brief Hash (32 bits FNV-1a) of the top left area of the frame memory, to compare with golden images.
+ */
+uint32_t LcdEmuHash(uint16_t width, uint16_t height);
+
+/**
+ * @brief Save the top left area of the frame memory as a PPM image.
+ *
+ * @return false if the file can't be written
+ */
+bool LcdEmuSavePpm(const char *path, uint16_t width, uint16_t height);
+
+/**
+ * @brief Get the vertical scrolling state.
+ *
+ * @param start Last vertical scrolling start address
+ * @param area Last vertical scrolling definition: top fixed, scrolling and bottom fixed lines
+ */
+void LcdEmuScroll(uint16_t *start, uint16_t area[3]);
+
+/**
+ * @brief Get (and optionally clear) the emulator counters.
+ */
+void LcdEmuStats(lcd_emu_stats_t *stats, bool reset);
+
+#endif /* LCD_EMU_H */
@@ -0,0 +1,208 @@
+/**
+ * @file idf_mock.c
+ * @brief Default host implementations of the ESP-IDF functions used by the drivers.
+ * 
+ * The peripherals whose use is checked by the tests have their own mock (mock_*.c). 
+ * These are weak, so a test can replace any of them.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include "mock_idf.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_rom_sys.h"
+#include "driver/sdm.h"
+#include "esp_adc/adc_oneshot.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define WEAK __attribute__((weak))
+#define MOCK_TASKS	8
+
+int64_t mock_time_us = 0;
+bool mock_dma_capable = true;
+bool mock_queue_no_mem = false;
+bool mock_task_no_mem = false;
+int32_t mock_heap_allocs_left = -1;
+static int mock_handle;		/* Address used as handle of every mocked object */
+
+/* Memory */
+WEAK void *heap_caps_malloc(size_t size, uint32_t caps){
+	if(mock_heap_allocs_left == 0){
+		return NULL;
+	}
+	if(mock_heap_allocs_left > 0){
+		mock_heap_allocs_left--;
+	}
+	return malloc(size);
+}
+WEAK void *heap_caps_calloc(size_t n, size_t size, uint32_t caps){ return calloc(n, size); }
+WEAK void heap_caps_free(void *ptr){ free(ptr); }
+WEAK size_t heap_caps_get_free_size(uint32_t caps){ return 0; }
+WEAK size_t heap_caps_get_minimum_free_size(uint32_t caps){ return 0; }
+WEAK size_t heap_caps_get_largest_free_block(uint32_t caps){ return 0; }
+WEAK uint32_t esp_get_free_heap_size(void){ return 0; }
+WEAK uint32_t esp_get_minimum_free_heap_size(void){ return 0; }
+WEAK bool esp_ptr_dma_capable(const void *p){ return mock_dma_capable; }
+
+/* Time */
+WEAK int64_t esp_timer_get_time(void){ return mock_time_us; }
+WEAK void esp_rom_delay_us(uint32_t us){ mock_time_us += us; }
+
+/* Sigma-delta */
+WEAK esp_err_t sdm_new_channel(const sdm_config_t *c, sdm_channel_handle_t *r){ *r = (sdm_channel_handle_t)&mock_handle; return ESP_OK; }
+WEAK esp_err_t sdm_channel_enable(sdm_channel_handle_t c){ return ESP_OK; }
+WEAK esp_err_t sdm_channel_set_pulse_density(sdm_channel_handle_t c, int8_t d){ return ESP_OK; }
+
+/* ADC */
+WEAK esp_err_t adc_oneshot_new_unit(const adc_oneshot_unit_init_cfg_t *c, adc_oneshot_unit_handle_t *r){ *r = (adc_oneshot_unit_handle_t)&mock_handle; return ESP_OK; }
+WEAK esp_err_t adc_oneshot_config_channel(adc_oneshot_unit_handle_t h, adc_channel_t c, const adc_oneshot_chan_cfg_t *cfg){ return ESP_OK; }
+WEAK esp_err_t adc_oneshot_read(adc_oneshot_unit_handle_t h, adc_channel_t c, int *out){ *out = 0; return ESP_OK; }
+
+/* FreeRTOS: a single thread, so locks are always free. Tasks only run inside 
+ * MockTaskRun(), until they block on an empty queue or wait for a notification */
+typedef struct {
+	uint8_t *items;
+	UBaseType_t len;
+	UBaseType_t size;
+	UBaseType_t head;
+	UBaseType_t count;
+} mock_queue_t;
+
+typedef struct {
+	TaskFunction_t func;
+	void *param;
+	const char *name;
+	uint32_t notified;		/* Notification value (xTaskNotifyGive() count) */
+} mock_task_t;
+
+static mock_task_t mock_tasks[MOCK_TASKS];
+static uint8_t mock_tasks_num = 0;
+static jmp_buf mock_task_env;
+static bool mock_task_running = false;
+static mock_task_t *mock_task_current;
+
+/* A running task that would block goes back to MockTaskRun() */
+static void MockTaskBlock(void){
+	if(mock_task_running){
+		longjmp(mock_task_env, 1);
+	}
+}
+
+bool MockTaskRun(const char *name){
+	mock_task_t *task = NULL;
+
+	for(uint8_t i = 0; i < mock_tasks_num; i++){
+		if(strcmp(mock_tasks[i].name, name) == 0){
+			task = &mock_tasks[i];
+		}
+	}
+	if(task == NULL || mock_task_running){
+		return false;
+	}
+	if(setjmp(mock_task_env) == 0){
+		mock_task_running = true;
+		mock_task_current = task;
+		task->func(task->param);
+	}
+	mock_task_running = false;
+	return true;
+}
+
+WEAK QueueHandle_t xQueueCreate(UBaseType_t l, UBaseType_t s){
+	mock_queue_t *q;
+
+	if(mock_queue_no_mem){
+		return NULL;
+	}
+	q = calloc(1, sizeof(mock_queue_t));
+
+	q->items = calloc(l, s);
+	q->len = l;
+	q->size = s;
+	return q;
+}
+WEAK void vQueueDelete(QueueHandle_t q){
+	free(((mock_queue_t*)q)->items);
+	free(q);
+}
+WEAK BaseType_t xQueueSend(QueueHandle_t q, const void *i, TickType_t t){
+	mock_queue_t *mq = q;
+
+	if(mq->count == mq->len){
+		return pdFALSE;
+	}
+	memcpy(&mq->items[((mq->head + mq->count) % mq->len) * mq->size], i, mq->size);
+	mq->count++;
+	return pdTRUE;
+}
+WEAK BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *i, BaseType_t *w){ return xQueueSend(q, i, 0); }
+WEAK BaseType_t xQueueReceive(QueueHandle_t q, void *i, TickType_t t){
+	mock_queue_t *mq = q;
+
+	if(mq->count == 0){
+		if(t != 0){
+			MockTaskBlock();
+		}
+		return pdFALSE;
+	}
+	memcpy(i, &mq->items[mq->head * mq->size], mq->size);
+	mq->head = (mq->head + 1) % mq->len;
+	mq->count--;
+	return pdTRUE;
+}
+WEAK BaseType_t xQueueReset(QueueHandle_t q){ ((mock_queue_t*)q)->count = 0; return pdTRUE; }
+WEAK UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q){ return ((mock_queue_t*)q)->count; }
+WEAK SemaphoreHandle_t xSemaphoreCreateBinary(void){ return &mock_handle; }
+WEAK SemaphoreHandle_t xSemaphoreCreateMutex(void){ return &mock_handle; }
+WEAK SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t init){ return &mock_handle; }
+WEAK BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t t){ return pdTRUE; }
+WEAK BaseType_t xSemaphoreGive(SemaphoreHandle_t s){ return pdTRUE; }
+WEAK BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *w){ return pdTRUE; }
+WEAK void vSemaphoreDelete(SemaphoreHandle_t s){ }
+WEAK BaseType_t xTaskCreate(TaskFunction_t f, const char *n, uint32_t s, void *p, UBaseType_t pr, TaskHandle_t *h){
+	if(mock_tasks_num == MOCK_TASKS || mock_task_no_mem){
+		return pdFALSE;
+	}
+	mock_tasks[mock_tasks_num] = (mock_task_t){.func = f, .param = p, .name = n, .notified = 0};
+	if(h != NULL){
+		*h = &mock_tasks[mock_tasks_num];
+	}
+	mock_tasks_num++;
+	return pdPASS;
+}
+WEAK void vTaskDelete(TaskHandle_t t){ }
+/* Only tasks created with xTaskCreate() count notifications (other handles are ignored) */
+static void MockTaskNotify(TaskHandle_t t){
+	mock_task_t *task = t;
+
+	if(task >= mock_tasks && task < mock_tasks + mock_tasks_num){
+		task->notified++;
+	}
+}
+WEAK void vTaskNotifyGiveFromISR(TaskHandle_t t, BaseType_t *w){ MockTaskNotify(t); }
+WEAK BaseType_t xTaskNotifyGive(TaskHandle_t t){ MockTaskNotify(t); return pdPASS; }
+WEAK uint32_t ulTaskNotifyTake(BaseType_t c, TickType_t t){
+	uint32_t value;
+
+	/* Outside a task there is nothing to wait for */
+	if(!mock_task_running){
+		return 1;
+	}
+	if(mock_task_current->notified == 0){
+		MockTaskBlock();
+	}
+	value = mock_task_current->notified;
+	mock_task_current->notified = c ? 0 : value - 1;
+	return value;
+}
+WEAK void vTaskDelay(TickType_t t){ mock_time_us += (int64_t)t * 1000; }
+WEAK TickType_t xTaskGetTickCount(void){ return mock_time_us / 1000; }
+WEAK UBaseType_t uxTaskGetNumberOfTasks(void){ return mock_tasks_num + 1; }
+WEAK UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t t){ return 0; }
+WEAK TaskHandle_t xTaskGetCurrentTaskHandle(void){ return &mock_handle; }
+WEAK char *pcTaskGetName(TaskHandle_t t){ return "test"; }
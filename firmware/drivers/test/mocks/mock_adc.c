@@ -0,0 +1,180 @@
+/**
+ * @file mock_adc.c
+ * @brief Host mock of the ADC continuous (DMA) driver and of the curve fitting calibration.
+ *
+ * MockAdcFrame() fills one DMA frame following the pattern table, with the values
+ * given by the test source, as the ADC DMA ISR does: the frame end callback is
+ * called, then the frame is stored in the pool or, when the pool is full, lost and
+ * reported with the pool overflow callback.
+ *
+ * The calibration curve is a cubic polynomial evaluated in floating point, with an
+ * offset that depends on the channel (see MockAdcCurve()).
+ */
+#include <string.h>
+#include "mock_idf.h"
+#include "esp_adc/adc_continuous.h"
+#include "esp_adc/adc_cali_scheme.h"
+
+#define MOCK_ADC_POOL_FRAMES	16
+#define MOCK_ADC_FRAME_BYTES	4096
+
+struct adc_continuous_ctx_t {
+	adc_continuous_handle_cfg_t config;
+	adc_digi_pattern_config_t pattern[SOC_ADC_PATT_LEN_MAX];
+	uint32_t pattern_num;
+	uint32_t sample_freq_hz;
+	adc_continuous_evt_cbs_t cbs;
+	void *user_data;
+	bool running;
+};
+struct adc_cali_scheme_t {
+	adc_channel_t chan;
+};
+static struct adc_continuous_ctx_t adc;
+static struct adc_cali_scheme_t schemes[16];
+static uint8_t pool[MOCK_ADC_POOL_FRAMES][MOCK_ADC_FRAME_BYTES];
+static uint32_t pool_head, pool_count;		/* Oldest frame and frames in the pool */
+static uint32_t pattern_pos;				/* Next pattern entry to convert */
+static uint32_t conversions[16];			/* Conversions of each channel since the pattern was configured */
+static mock_adc_source_t source;
+
+/* Frames the pool holds: max_store_buf_size, in whole frames */
+static uint32_t PoolFrames(void){
+	uint32_t frames = adc.config.max_store_buf_size / adc.config.conv_frame_size;
+
+	return (frames > MOCK_ADC_POOL_FRAMES) ? MOCK_ADC_POOL_FRAMES : frames;
+}
+
+esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *c, adc_continuous_handle_t *r){
+	if(c->conv_frame_size == 0 || c->conv_frame_size > MOCK_ADC_FRAME_BYTES || c->max_store_buf_size < c->conv_frame_size){
+		return ESP_ERR_INVALID_ARG;
+	}
+	memset(&adc, 0, sizeof(adc));
+	adc.config = *c;
+	pool_head = pool_count = 0;
+	*r = &adc;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_config(adc_continuous_handle_t h, const adc_continuous_config_t *c){
+	if(h->running || c->pattern_num == 0 || c->pattern_num > SOC_ADC_PATT_LEN_MAX){
+		return ESP_ERR_INVALID_STATE;
+	}
+	memcpy(h->pattern, c->adc_pattern, c->pattern_num * sizeof(adc_digi_pattern_config_t));
+	h->pattern_num = c->pattern_num;
+	h->sample_freq_hz = c->sample_freq_hz;
+	pattern_pos = 0;
+	memset(conversions, 0, sizeof(conversions));
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_register_event_callbacks(adc_continuous_handle_t h, const adc_continuous_evt_cbs_t *c, void *u){
+	h->cbs = *c;
+	h->user_data = u;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_start(adc_continuous_handle_t h){
+	if(h->running || h->pattern_num == 0){
+		return ESP_ERR_INVALID_STATE;
+	}
+	h->running = true;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_stop(adc_continuous_handle_t h){
+	if(!h->running){
+		return ESP_ERR_INVALID_STATE;
+	}
+	h->running = false;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_read(adc_continuous_handle_t h, uint8_t *buf, uint32_t len, uint32_t *out, uint32_t timeout_ms){
+	uint32_t size = h->config.conv_frame_size;
+
+	*out = 0;
+	if(pool_count == 0){
+		return ESP_ERR_TIMEOUT;
+	}
+	if(len < size){
+		return ESP_ERR_INVALID_SIZE;
+	}
+	memcpy(buf, pool[pool_head], size);
+	pool_head = (pool_head + 1) % MOCK_ADC_POOL_FRAMES;
+	pool_count--;
+	*out = size;
+	return ESP_OK;
+}
+
+esp_err_t adc_continuous_deinit(adc_continuous_handle_t h){
+	if(h->running){
+		return ESP_ERR_INVALID_STATE;
+	}
+	memset(h, 0, sizeof(struct adc_continuous_ctx_t));
+	return ESP_OK;
+}
+
+esp_err_t adc_cali_create_scheme_curve_fitting(const adc_cali_curve_fitting_config_t *c, adc_cali_handle_t *r){
+	if(c->unit_id != ADC_UNIT_1 || c->chan >= 16){
+		return ESP_ERR_INVALID_ARG;
+	}
+	schemes[c->chan].chan = c->chan;
+	*r = &schemes[c->chan];
+	return ESP_OK;
+}
+
+esp_err_t adc_cali_raw_to_voltage(adc_cali_handle_t h, int raw, int *v){
+	if(h == NULL || raw < 0 || raw > 4095){
+		return ESP_ERR_INVALID_ARG;
+	}
+	*v = (int)(MockAdcCurve(h->chan, raw) + 0.5);
+	return ESP_OK;
+}
+
+double MockAdcCurve(uint8_t channel, int raw){
+	double x = raw;
+
+	return 5.0 + 2.0 * channel + x * (0.78 + x * (2.5e-5 - x * 4e-9));
+}
+
+void MockAdcSource(mock_adc_source_t s){
+	source = s;
+}
+
+bool MockAdcFrame(void){
+	uint8_t frame[MOCK_ADC_FRAME_BYTES];
+	adc_continuous_evt_data_t edata = {.conv_frame_buffer = frame, .size = adc.config.conv_frame_size};
+	adc_digi_output_data_t *p;
+	uint8_t channel;
+
+	if(!adc.running){
+		return false;
+	}
+	for(uint32_t i = 0; i < edata.size / SOC_ADC_DIGI_RESULT_BYTES; i++){
+		channel = adc.pattern[pattern_pos].channel;
+		p = (adc_digi_output_data_t*)&frame[i * SOC_ADC_DIGI_RESULT_BYTES];
+		p->val = 0;
+		p->type2.channel = channel;
+		p->type2.unit = adc.pattern[pattern_pos].unit;
+		p->type2.data = (source != NULL) ? source(channel, conversions[channel & 0x0F]) & 0xFFF : 0;
+		conversions[channel & 0x0F]++;
+		pattern_pos = (pattern_pos + 1) % adc.pattern_num;
+	}
+	if(adc.cbs.on_conv_done != NULL){
+		adc.cbs.on_conv_done(&adc, &edata, adc.user_data);
+	}
+	if(pool_count == PoolFrames()){
+		if(adc.cbs.on_pool_ovf != NULL){
+			adc.cbs.on_pool_ovf(&adc, &edata, adc.user_data);
+		}
+		return true;
+	}
+	memcpy(pool[(pool_head + pool_count) % MOCK_ADC_POOL_FRAMES], frame, edata.size);
+	pool_count++;
+	return true;
+}
+
+uint32_t MockAdcSampleFreq(void){
+	return adc.sample_freq_hz;
+}
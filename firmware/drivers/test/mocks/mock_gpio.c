@@ -0,0 +1,43 @@
+/**
+ * @file mock_gpio.c
+ * @brief Host mock of the GPIO driver and HAL: output levels are recorded.
+ */
+#include "mock_idf.h"
+#include "driver/gpio.h"
+#include "driver/gpio_filter.h"
+#include "hal/gpio_ll.h"
+
+#define MOCK_GPIOS	32
+
+struct gpio_dev_t {
+	uint8_t level[MOCK_GPIOS];
+};
+gpio_dev_t GPIO;
+static int mock_filter;
+
+esp_err_t gpio_config(const gpio_config_t *c){ return ESP_OK; }
+esp_err_t gpio_reset_pin(gpio_num_t g){ return ESP_OK; }
+esp_err_t gpio_set_direction(gpio_num_t g, gpio_mode_t m){ return ESP_OK; }
+esp_err_t gpio_set_pull_mode(gpio_num_t g, gpio_pull_mode_t p){ return ESP_OK; }
+esp_err_t gpio_set_intr_type(gpio_num_t g, gpio_int_type_t t){ return ESP_OK; }
+esp_err_t gpio_install_isr_service(int f){ return ESP_OK; }
+esp_err_t gpio_isr_handler_add(gpio_num_t g, gpio_isr_t h, void *a){ return ESP_OK; }
+esp_err_t gpio_new_flex_glitch_filter(const gpio_flex_glitch_filter_config_t *c, gpio_glitch_filter_handle_t *r){ *r = (gpio_glitch_filter_handle_t)&mock_filter; return ESP_OK; }
+esp_err_t gpio_glitch_filter_enable(gpio_glitch_filter_handle_t f){ return ESP_OK; }
+
+esp_err_t gpio_set_level(gpio_num_t g, uint32_t l){
+	GPIO.level[g] = (l != 0);
+	return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t g){
+	return GPIO.level[g];
+}
+
+void gpio_ll_set_level(gpio_dev_t *hw, uint32_t gpio_num, uint32_t level){
+	hw->level[gpio_num] = (level != 0);
+}
+
+uint8_t MockGpioLevel(uint8_t gpio){
+	return GPIO.level[gpio];
+}
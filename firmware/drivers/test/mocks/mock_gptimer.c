@@ -0,0 +1,69 @@
+/**
+ * @file mock_gptimer.c
+ * @brief Host mock of the general purpose timers: alarms are fired by the test.
+ */
+#include <string.h>
+#include "mock_idf.h"
+
+#define MOCK_GPTIMERS	4
+
+struct gptimer_t {
+	gptimer_alarm_cb_t on_alarm;
+	void *user_data;
+	gptimer_alarm_config_t alarm;
+	uint64_t count;
+	bool running;
+	bool deleted;
+};
+static struct gptimer_t timers[MOCK_GPTIMERS];
+static uint8_t timers_num = 0;
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *c, gptimer_handle_t *r){
+	/* Deleted timers are reused (i.e. by the delays, that create one on each call) */
+	for(uint8_t i = 0; i < timers_num; i++){
+		if(timers[i].deleted){
+			memset(&timers[i], 0, sizeof(struct gptimer_t));
+			*r = &timers[i];
+			return ESP_OK;
+		}
+	}
+	if(timers_num == MOCK_GPTIMERS){
+		return ESP_ERR_NO_MEM;
+	}
+	*r = &timers[timers_num++];
+	return ESP_OK;
+}
+esp_err_t gptimer_del_timer(gptimer_handle_t t){ t->deleted = true; return ESP_OK; }
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t t, const gptimer_alarm_config_t *c){ t->alarm = *c; return ESP_OK; }
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t t, const gptimer_event_callbacks_t *c, void *u){
+	t->on_alarm = c->on_alarm;
+	t->user_data = u;
+	return ESP_OK;
+}
+esp_err_t gptimer_enable(gptimer_handle_t t){ return ESP_OK; }
+esp_err_t gptimer_disable(gptimer_handle_t t){ return ESP_OK; }
+esp_err_t gptimer_start(gptimer_handle_t t){ t->running = true; return ESP_OK; }
+esp_err_t gptimer_stop(gptimer_handle_t t){ t->running = false; return ESP_OK; }
+esp_err_t gptimer_get_raw_count(gptimer_handle_t t, uint64_t *v){ *v = t->count; return ESP_OK; }
+esp_err_t gptimer_set_raw_count(gptimer_handle_t t, uint64_t v){ t->count = v; return ESP_OK; }
+
+bool MockGptimerAlarm(uint8_t index){
+	struct gptimer_t *t = &timers[index];
+	gptimer_alarm_event_data_t edata;
+
+	if(index >= timers_num || t->deleted || t->on_alarm == NULL || !t->running){
+		return false;
+	}
+	edata.count_value = t->alarm.alarm_count;
+	edata.alarm_value = t->alarm.alarm_count;
+	t->on_alarm(t, &edata, t->user_data);
+	return true;
+}
+
+bool MockGptimerAlarmConfig(uint8_t index, gptimer_alarm_config_t *config){
+	if(index >= timers_num || timers[index].deleted){
+		return false;
+	}
+	*config = timers[index].alarm;
+	return true;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file mock_idf.h
+ * @brief Controls of the host ESP-IDF mocks used by the driver tests.
+ * 
+ * Every ESP-IDF function used by the drivers has a default (weak) implementation 
+ * in idf_mock.c that does nothing and succeeds. The mocks of each peripheral 
+ * replace them and record what the driver did.
+ */
+#ifndef MOCK_IDF_H
+#define MOCK_IDF_H
+#include <stdint.h>
+#include <stdbool.h>
+#include "driver/gptimer.h"
+#include "driver/uart.h"
+#include "driver/rmt_types.h"
+
+/**
+ * @brief SPI device counters
+ */
+typedef struct {
+	uint32_t transactions;	/*!< Transactions sent */
+	uint32_t bytes;			/*!< Bytes sent */
+	uint32_t rejected;		/*!< Transactions rejected (longer than max_transfer_sz) */
+	uint32_t overflows;		/*!< Transactions queued with queue_size results not taken */
+	uint32_t hangs;			/*!< Results waited for with no transaction queued (blocks forever on target) */
+} mock_spi_stats_t;
+
+/**
+ * @brief RMT TX counters
+ */
+typedef struct {
+	uint32_t transmissions;	/*!< rmt_transmit() calls */
+	uint32_t symbols;		/*!< Symbols generated by the encoders */
+	uint32_t refills;		/*!< Encoder calls (one each time the channel memory has room) */
+} mock_rmt_stats_t;
+
+/** Value converted by the ADC for the n-th conversion of a channel since adc_continuous_config() (raw counts, 12 bits) */
+typedef uint16_t (*mock_adc_source_t)(uint8_t channel, uint32_t n);
+
+/** Receives the bytes of each SPI transaction */
+typedef void (*mock_spi_sink_t)(const uint8_t *data, uint32_t len);
+
+/** Time returned by esp_timer_get_time() (in us) */
+extern int64_t mock_time_us;
+
+/** Value returned by esp_ptr_dma_capable() (false: buffers are treated as flash) */
+extern bool mock_dma_capable;
+
+/** xQueueCreate() fails (out of memory) */
+extern bool mock_queue_no_mem;
+
+/** xTaskCreate() fails (out of memory) */
+extern bool mock_task_no_mem;
+
+/** heap_caps_malloc() calls that succeed before every following one fails (-1: no limit) */
+extern int32_t mock_heap_allocs_left;
+
+/** RMT transmissions run the encoder (false: only the payload is kept) */
+extern bool mock_rmt_encode;
+
+/**
+ * @brief Call the alarm callback registered for a hardware timer, as its ISR would.
+ * 
+ * @param index Timer index, in creation order (first gptimer_new_timer() call is 0, deleted timers are reused)
+ * @return false if the timer has no callback or is not started
+ */
+bool MockGptimerAlarm(uint8_t index);
+
+/**
+ * @brief Alarm set for a hardware timer with gptimer_set_alarm_action().
+ * 
+ * @param index Timer index, as in MockGptimerAlarm()
+ * @param config Alarm configuration
+ * @return false if there is no such timer
+ */
+bool MockGptimerAlarmConfig(uint8_t index, gptimer_alarm_config_t *config);
+
+/**
+ * @brief Run a task created with xTaskCreate() until it blocks on an empty queue 
+ * or waits for a notification (given with xTaskNotifyGive() or vTaskNotifyGiveFromISR()).
+ * 
+ * The task function starts again from its beginning on every run.
+ * 
+ * @param name Task name (the last task created with it is run)
+ * @return false if there is no such task
+ */
+bool MockTaskRun(const char *name);
+
+/**
+ * @brief Bytes received by a UART: stored in the driver buffer and announced with an event.
+ * 
+ * @param uart UART number
+ * @param data Bytes received (not stored with UART_FIFO_OVF, they were lost)
+ * @param len Number of bytes
+ * @param type Event type sent to the driver queue (UART_DATA, UART_FIFO_OVF, ...)
+ */
+void MockUartReceive(uint8_t uart, const uint8_t *data, uint16_t len, uart_event_type_t type);
+
+/**
+ * @brief Bytes written to a UART with uart_write_bytes() since the last call.
+ * 
+ * @param uart UART number
+ * @param data Where the bytes are copied
+ * @param size Size of data
+ * @return Number of bytes copied
+ */
+uint32_t MockUartSent(uint8_t uart, uint8_t *data, uint32_t size);
+
+/**
+ * @brief Number of uart_write_bytes() calls on a UART since the last call.
+ */
+uint32_t MockUartWrites(uint8_t uart);
+
+/**
+ * @brief Output level of a GPIO (written with gpio_set_level() or gpio_ll_set_level()).
+ */
+uint8_t MockGpioLevel(uint8_t gpio);
+
+/**
+ * @brief Set the function that receives the bytes sent to an SPI device.
+ * 
+ * @param device Device index, in spi_bus_add_device() order
+ * @param sink Function called with the data of each transaction, after the pre-transaction callback
+ */
+void MockSpiSink(uint8_t device, mock_spi_sink_t sink);
+
+/**
+ * @brief Get (and optionally clear) the counters of an SPI device.
+ * 
+ * @param device Device index, in spi_bus_add_device() order
+ * @param stats Counters
+ * @param reset Clear the counters
+ */
+void MockSpiStats(uint8_t device, mock_spi_stats_t *stats, bool reset);
+
+/**
+ * @brief Symbols generated by the last RMT transmission.
+ * 
+ * @param symbols Set to the symbols
+ * @return Number of symbols
+ */
+uint32_t MockRmtSymbols(const rmt_symbol_word_t **symbols);
+
+/**
+ * @brief Payload of the last RMT transmission.
+ * 
+ * @param payload Set to the payload bytes
+ * @return Number of bytes
+ */
+uint32_t MockRmtPayload(const uint8_t **payload);
+
+/**
+ * @brief Get (and optionally clear) the RMT counters.
+ */
+void MockRmtStats(mock_rmt_stats_t *stats, bool reset);
+
+/**
+ * @brief Set the values converted by the ADC in continuous mode (0 if no source is set).
+ */
+void MockAdcSource(mock_adc_source_t source);
+
+/**
+ * @brief Convert one DMA frame following the pattern table, as the ADC DMA ISR does.
+ * 
+ * The frame end callback is called, then the frame is stored in the pool. When the 
+ * pool (max_store_buf_size) is full the frame is lost and the pool overflow callback is called.
+ * 
+ * @return false if the conversion is not started
+ */
+bool MockAdcFrame(void);
+
+/**
+ * @brief Conversion frequency (all channels) set with adc_continuous_config().
+ */
+uint32_t MockAdcSampleFreq(void);
+
+/**
+ * @brief Calibration curve of a channel, as adc_cali_raw_to_voltage() evaluates it (before rounding).
+ * 
+ * @param channel ADC channel
+ * @param raw Raw ADC counts
+ * @return Voltage (in mV)
+ */
+double MockAdcCurve(uint8_t channel, int raw);
+
+#endif /* MOCK_IDF_H */
@@ -0,0 +1,207 @@
+/**
+ * @file mock_rmt.c
+ * @brief Host mock of the RMT TX driver and its bytes and copy encoders.
+ *
+ * rmt_transmit() runs the encoder at once, as the RMT driver ISR does: the channel
+ * memory (mem_block_symbols) is refilled until the encoder reports the transmission
+ * complete. The symbols and the payload of the last transmission are kept, then the
+ * done callback is called.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "mock_idf.h"
+#include "driver/rmt_tx.h"
+
+#define MOCK_RMT_SYMBOLS	32768
+#define MOCK_RMT_PAYLOAD	8192
+
+typedef struct {
+	rmt_encoder_t base;
+	rmt_bytes_encoder_config_t config;
+	size_t byte;
+	uint8_t bit;
+} mock_bytes_encoder_t;
+
+typedef struct {
+	rmt_encoder_t base;
+	size_t symbol;
+} mock_copy_encoder_t;
+
+struct rmt_channel_t {
+	rmt_tx_channel_config_t config;
+	rmt_tx_done_callback_t on_trans_done;
+	void *user_data;
+};
+static struct rmt_channel_t channel;
+static rmt_symbol_word_t symbols[MOCK_RMT_SYMBOLS];
+static uint32_t symbols_num;
+static uint8_t payload[MOCK_RMT_PAYLOAD];
+static uint32_t payload_len;
+static size_t room;			/* Free symbols of the channel memory until the next refill */
+static mock_rmt_stats_t stats;
+bool mock_rmt_encode = true;
+
+/* Symbols are kept while there is room in the channel memory */
+static bool RmtPut(rmt_symbol_word_t symbol){
+	if(room == 0){
+		return false;
+	}
+	if(symbols_num < MOCK_RMT_SYMBOLS){
+		symbols[symbols_num++] = symbol;
+	}
+	room--;
+	return true;
+}
+
+static size_t BytesEncode(rmt_encoder_t *encoder, rmt_channel_handle_t c, const void *data, size_t size, rmt_encode_state_t *state){
+	mock_bytes_encoder_t *bytes = (mock_bytes_encoder_t *)encoder;
+	const uint8_t *p = data;
+	size_t encoded = 0;
+	uint8_t bit;
+
+	*state = RMT_ENCODING_RESET;
+	while(bytes->byte < size){
+		bit = bytes->config.flags.msb_first ? 7 - bytes->bit : bytes->bit;
+		if(!RmtPut(((p[bytes->byte] >> bit) & 1) ? bytes->config.bit1 : bytes->config.bit0)){
+			*state = RMT_ENCODING_MEM_FULL;
+			return encoded;
+		}
+		encoded++;
+		if(++bytes->bit == 8){
+			bytes->bit = 0;
+			bytes->byte++;
+		}
+	}
+	bytes->byte = 0;
+	*state = RMT_ENCODING_COMPLETE;
+	if(room == 0){
+		*state |= RMT_ENCODING_MEM_FULL;
+	}
+	return encoded;
+}
+
+static size_t CopyEncode(rmt_encoder_t *encoder, rmt_channel_handle_t c, const void *data, size_t size, rmt_encode_state_t *state){
+	mock_copy_encoder_t *copy = (mock_copy_encoder_t *)encoder;
+	const rmt_symbol_word_t *p = data;
+	size_t encoded = 0;
+
+	*state = RMT_ENCODING_RESET;
+	while(copy->symbol < size / sizeof(rmt_symbol_word_t)){
+		if(!RmtPut(p[copy->symbol])){
+			*state = RMT_ENCODING_MEM_FULL;
+			return encoded;
+		}
+		encoded++;
+		copy->symbol++;
+	}
+	copy->symbol = 0;
+	*state = RMT_ENCODING_COMPLETE;
+	if(room == 0){
+		*state |= RMT_ENCODING_MEM_FULL;
+	}
+	return encoded;
+}
+
+static esp_err_t BytesReset(rmt_encoder_t *encoder){
+	((mock_bytes_encoder_t *)encoder)->byte = 0;
+	((mock_bytes_encoder_t *)encoder)->bit = 0;
+	return ESP_OK;
+}
+
+static esp_err_t CopyReset(rmt_encoder_t *encoder){
+	((mock_copy_encoder_t *)encoder)->symbol = 0;
+	return ESP_OK;
+}
+
+esp_err_t rmt_new_bytes_encoder(const rmt_bytes_encoder_config_t *config, rmt_encoder_t **ret_encoder){
+	mock_bytes_encoder_t *bytes = calloc(1, sizeof(mock_bytes_encoder_t));
+
+	if(bytes == NULL){
+		return ESP_ERR_NO_MEM;
+	}
+	bytes->config = *config;
+	bytes->base.encode = BytesEncode;
+	bytes->base.reset = BytesReset;
+	*ret_encoder = &bytes->base;
+	return ESP_OK;
+}
+
+esp_err_t rmt_new_copy_encoder(const rmt_copy_encoder_config_t *config, rmt_encoder_t **ret_encoder){
+	mock_copy_encoder_t *copy = calloc(1, sizeof(mock_copy_encoder_t));
+
+	if(copy == NULL){
+		return ESP_ERR_NO_MEM;
+	}
+	copy->base.encode = CopyEncode;
+	copy->base.reset = CopyReset;
+	*ret_encoder = &copy->base;
+	return ESP_OK;
+}
+
+esp_err_t rmt_del_encoder(rmt_encoder_t *encoder){
+	free(encoder);
+	return ESP_OK;
+}
+
+esp_err_t rmt_encoder_reset(rmt_encoder_t *encoder){ return encoder->reset(encoder); }
+
+esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_handle_t *ret_chan){
+	if(config->mem_block_symbols == 0){
+		return ESP_ERR_INVALID_ARG;
+	}
+	channel.config = *config;
+	*ret_chan = &channel;
+	return ESP_OK;
+}
+
+esp_err_t rmt_tx_register_event_callbacks(rmt_channel_handle_t tx_channel, const rmt_tx_event_callbacks_t *cbs, void *user_data){
+	tx_channel->on_trans_done = cbs->on_trans_done;
+	tx_channel->user_data = user_data;
+	return ESP_OK;
+}
+
+esp_err_t rmt_enable(rmt_channel_handle_t tx_channel){ return ESP_OK; }
+
+esp_err_t rmt_transmit(rmt_channel_handle_t tx_channel, rmt_encoder_handle_t encoder, const void *data, size_t size, const rmt_transmit_config_t *config){
+	rmt_encode_state_t state = RMT_ENCODING_RESET;
+	rmt_tx_done_event_data_t event;
+
+	if(tx_channel == NULL || encoder == NULL || size > MOCK_RMT_PAYLOAD){
+		return ESP_ERR_INVALID_ARG;
+	}
+	memcpy(payload, data, size);
+	payload_len = size;
+	symbols_num = 0;
+	/* Without encoding only the payload is kept (encoder benchmarks) */
+	while(mock_rmt_encode && !(state & RMT_ENCODING_COMPLETE)){
+		room = tx_channel->config.mem_block_symbols;
+		stats.refills++;
+		encoder->encode(encoder, tx_channel, data, size, &state);
+	}
+	stats.transmissions++;
+	stats.symbols += symbols_num;
+	event.num_symbols = symbols_num;
+	if(tx_channel->on_trans_done != NULL){
+		tx_channel->on_trans_done(tx_channel, &event, tx_channel->user_data);
+	}
+	return ESP_OK;
+}
+
+esp_err_t rmt_tx_wait_all_done(rmt_channel_handle_t tx_channel, int timeout_ms){ return ESP_OK; }
+
+uint32_t MockRmtSymbols(const rmt_symbol_word_t **ret_symbols){
+	*ret_symbols = symbols;
+	return symbols_num;
+}
+
+uint32_t MockRmtPayload(const uint8_t **ret_payload){
+	*ret_payload = payload;
+	return payload_len;
+}
+
+void MockRmtStats(mock_rmt_stats_t *s, bool reset){
+	*s = stats;
+	if(reset){
+		memset(&stats, 0, sizeof(stats));
+	}
+}
@@ -0,0 +1,117 @@
+/**
+ * @file mock_spi.c
+ * @brief Host mock of the SPI master driver.
+ * 
+ * Transactions are checked like the ESP-IDF driver does (device registered, length 
+ * up to the bus max_transfer_sz) and run at once: pre-transaction callback, data 
+ * to the device sink, post-transaction callback. Results wait in a queue of the 
+ * device queue_size until spi_device_get_trans_result() takes them.
+ */
+#include <string.h>
+#include "mock_idf.h"
+#include "driver/spi_master.h"
+
+#define MOCK_SPI_DEVICES	3
+#define MOCK_SPI_MAX_QUEUE	32
+
+struct spi_device_t {
+	spi_device_interface_config_t config;
+	mock_spi_sink_t sink;
+	mock_spi_stats_t stats;
+	spi_transaction_t *results[MOCK_SPI_MAX_QUEUE];
+	uint8_t results_head;
+	uint8_t results_num;
+};
+static struct spi_device_t devices[MOCK_SPI_DEVICES];
+static uint8_t devices_num = 0;
+static int max_transfer_sz = 4092;
+
+esp_err_t spi_bus_initialize(spi_host_device_t h, const spi_bus_config_t *c, int dma){
+	if(c->max_transfer_sz != 0){
+		max_transfer_sz = c->max_transfer_sz;
+	}
+	return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t h, const spi_device_interface_config_t *c, spi_device_handle_t *d){
+	if(devices_num == MOCK_SPI_DEVICES || c->queue_size > MOCK_SPI_MAX_QUEUE){
+		return ESP_ERR_NO_MEM;
+	}
+	devices[devices_num].config = *c;
+	*d = &devices[devices_num++];
+	return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t d){ return ESP_OK; }
+
+static esp_err_t SpiRun(spi_device_handle_t d, spi_transaction_t *t){
+	uint32_t len = (t->length + 7) / 8;
+	const uint8_t *data = (t->flags & SPI_TRANS_USE_TXDATA) ? t->tx_data : t->tx_buffer;
+
+	if(d == NULL){
+		return ESP_ERR_INVALID_ARG;
+	}
+	if(len > max_transfer_sz){
+		d->stats.rejected++;
+		return ESP_ERR_INVALID_ARG;
+	}
+	if(d->config.pre_cb != NULL){
+		d->config.pre_cb(t);
+	}
+	if(d->sink != NULL && data != NULL){
+		d->sink(data, len);
+	}
+	d->stats.transactions++;
+	d->stats.bytes += len;
+	if(d->config.post_cb != NULL){
+		d->config.post_cb(t);
+	}
+	return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t d, spi_transaction_t *t){ return SpiRun(d, t); }
+esp_err_t spi_device_transmit(spi_device_handle_t d, spi_transaction_t *t){ return SpiRun(d, t); }
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t d, spi_transaction_t *t, TickType_t w){
+	esp_err_t err;
+
+	if(d != NULL && d->results_num == d->config.queue_size){
+		/* The driver would block: the caller must take results first */
+		d->stats.overflows++;
+		return ESP_ERR_TIMEOUT;
+	}
+	err = SpiRun(d, t);
+	if(err == ESP_OK){
+		d->results[(d->results_head + d->results_num++) % MOCK_SPI_MAX_QUEUE] = t;
+	}
+	return err;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t d, spi_transaction_t **t, TickType_t w){
+	if(d == NULL){
+		return ESP_ERR_INVALID_ARG;
+	}
+	if(d->results_num == 0){
+		/* Nothing queued: with portMAX_DELAY the driver would wait forever */
+		d->stats.hangs++;
+		return ESP_ERR_TIMEOUT;
+	}
+	*t = d->results[d->results_head];
+	d->results_head = (d->results_head + 1) % MOCK_SPI_MAX_QUEUE;
+	d->results_num--;
+	return ESP_OK;
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t d, TickType_t w){ return ESP_OK; }
+void spi_device_release_bus(spi_device_handle_t d){ }
+
+void MockSpiSink(uint8_t device, mock_spi_sink_t sink){
+	devices[device].sink = sink;
+}
+
+void MockSpiStats(uint8_t device, mock_spi_stats_t *stats, bool reset){
+	*stats = devices[device].stats;
+	if(reset){
+		memset(&devices[device].stats, 0, sizeof(mock_spi_stats_t));
+	}
+}
@@ -0,0 +1,99 @@
+/**
+ * @file mock_uart.c
+ * @brief Host mock of the UART driver: received bytes are fed by the test, sent 
+ * bytes are captured.
+ */
+#include <string.h>
+#include "mock_idf.h"
+#include "freertos/queue.h"
+
+#define MOCK_UARTS			2
+#define MOCK_UART_BUF_SIZE	4096
+
+typedef struct {
+	QueueHandle_t queue;
+	uint8_t rx[MOCK_UART_BUF_SIZE];
+	uint32_t rx_head;
+	uint32_t rx_tail;
+	uint8_t tx[MOCK_UART_BUF_SIZE];
+	uint32_t tx_len;
+	uint32_t writes;
+} mock_uart_t;
+static mock_uart_t uarts[MOCK_UARTS];
+
+esp_err_t uart_param_config(uart_port_t p, const uart_config_t *c){ return ESP_OK; }
+esp_err_t uart_set_pin(uart_port_t p, int tx, int rx, int rts, int cts){ return ESP_OK; }
+esp_err_t uart_wait_tx_done(uart_port_t p, TickType_t t){ return ESP_OK; }
+
+esp_err_t uart_driver_install(uart_port_t p, int rx, int tx, int qs, QueueHandle_t *q, int f){
+	/* Installed again each time the event task is run by MockTaskRun() */
+	if(q != NULL){
+		if(uarts[p].queue == NULL){
+			uarts[p].queue = xQueueCreate(qs, sizeof(uart_event_t));
+		}
+		*q = uarts[p].queue;
+	}
+	return ESP_OK;
+}
+
+int uart_read_bytes(uart_port_t p, void *b, uint32_t l, TickType_t t){
+	uint32_t n = uarts[p].rx_head - uarts[p].rx_tail;
+
+	if(n > l){
+		n = l;
+	}
+	for(uint32_t i = 0; i < n; i++){
+		((uint8_t*)b)[i] = uarts[p].rx[uarts[p].rx_tail++ % MOCK_UART_BUF_SIZE];
+	}
+	return n;
+}
+
+esp_err_t uart_get_buffered_data_len(uart_port_t p, size_t *s){
+	*s = uarts[p].rx_head - uarts[p].rx_tail;
+	return ESP_OK;
+}
+
+esp_err_t uart_flush_input(uart_port_t p){
+	uarts[p].rx_tail = uarts[p].rx_head;
+	return ESP_OK;
+}
+
+int uart_write_bytes(uart_port_t p, const void *b, size_t l){
+	uarts[p].writes++;
+	for(size_t i = 0; i < l && uarts[p].tx_len < MOCK_UART_BUF_SIZE; i++){
+		uarts[p].tx[uarts[p].tx_len++] = ((const uint8_t*)b)[i];
+	}
+	return l;
+}
+
+void MockUartReceive(uint8_t uart, const uint8_t *data, uint16_t len, uart_event_type_t type){
+	uart_event_t event = {
+		.type = type,
+		.size = len,
+		.timeout_flag = false,
+	};
+
+	if(type != UART_FIFO_OVF){
+		for(uint16_t i = 0; i < len; i++){
+			uarts[uart].rx[uarts[uart].rx_head++ % MOCK_UART_BUF_SIZE] = data[i];
+		}
+	}else{
+		event.size = 0;
+	}
+	xQueueSend(uarts[uart].queue, &event, 0);
+}
+
+uint32_t MockUartSent(uint8_t uart, uint8_t *data, uint32_t size){
+	uint32_t n = (uarts[uart].tx_len < size) ? uarts[uart].tx_len : size;
+
+	memcpy(data, uarts[uart].tx, n);
+	uarts[uart].tx_len = 0;
+	return n;
+}
+
+uint32_t MockUartWrites(uint8_t uart){
+	uint32_t writes = uarts[uart].writes;
+
+	uarts[uart].writes = 0;
+	return writes;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "common_stub.h"
+typedef int gpio_num_t;
+enum { GPIO_NUM_0, GPIO_NUM_1, GPIO_NUM_2, GPIO_NUM_3, GPIO_NUM_4, GPIO_NUM_5, GPIO_NUM_6, GPIO_NUM_7, 
+	GPIO_NUM_8, GPIO_NUM_9, GPIO_NUM_10, GPIO_NUM_11, GPIO_NUM_12, GPIO_NUM_13, GPIO_NUM_14, GPIO_NUM_15, 
+	GPIO_NUM_16, GPIO_NUM_17, GPIO_NUM_18, GPIO_NUM_19, GPIO_NUM_20, GPIO_NUM_21, GPIO_NUM_22, GPIO_NUM_23 };
+typedef enum { GPIO_MODE_DISABLE, GPIO_MODE_INPUT, GPIO_MODE_OUTPUT } gpio_mode_t;
+typedef enum { GPIO_PULLUP_ONLY, GPIO_PULLDOWN_ONLY, GPIO_PULLUP_PULLDOWN, GPIO_FLOATING } gpio_pull_mode_t;
+typedef enum { GPIO_INTR_DISABLE, GPIO_INTR_POSEDGE, GPIO_INTR_NEGEDGE, GPIO_INTR_ANYEDGE } gpio_int_type_t;
+typedef void (*gpio_isr_t)(void *arg);
+typedef struct { uint64_t pin_bit_mask; gpio_mode_t mode; int pull_up_en; int pull_down_en; gpio_int_type_t intr_type; } gpio_config_t;
+esp_err_t gpio_config(const gpio_config_t *c);
+esp_err_t gpio_reset_pin(gpio_num_t g);
+esp_err_t gpio_set_direction(gpio_num_t g, gpio_mode_t m);
+esp_err_t gpio_set_pull_mode(gpio_num_t g, gpio_pull_mode_t p);
+esp_err_t gpio_set_level(gpio_num_t g, uint32_t l);
+int gpio_get_level(gpio_num_t g);
+esp_err_t gpio_set_intr_type(gpio_num_t g, gpio_int_type_t t);
+esp_err_t gpio_install_isr_service(int f);
+esp_err_t gpio_isr_handler_add(gpio_num_t g, gpio_isr_t h, void *a);
@@ -0,0 +1,7 @@
+#pragma once
+#include "driver/gpio.h"
+typedef struct gpio_glitch_filter_t *gpio_glitch_filter_handle_t;
+typedef enum { GLITCH_FILTER_CLK_SRC_DEFAULT } glitch_filter_clock_source_t;
+typedef struct { glitch_filter_clock_source_t clk_src; gpio_num_t gpio_num; uint32_t window_width_ns; uint32_t window_thres_ns; } gpio_flex_glitch_filter_config_t;
+esp_err_t gpio_new_flex_glitch_filter(const gpio_flex_glitch_filter_config_t *c, gpio_glitch_filter_handle_t *r);
+esp_err_t gpio_glitch_filter_enable(gpio_glitch_filter_handle_t f);
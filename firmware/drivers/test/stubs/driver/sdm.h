@@ -0,0 +1,8 @@
+#pragma once
+#include "common_stub.h"
+typedef struct sdm_channel_t *sdm_channel_handle_t;
+typedef enum { SDM_CLK_SRC_DEFAULT } sdm_clock_source_t;
+typedef struct { int gpio_num; sdm_clock_source_t clk_src; uint32_t sample_rate_hz; struct { uint32_t invert_out:1; } flags; } sdm_config_t;
+esp_err_t sdm_new_channel(const sdm_config_t *c, sdm_channel_handle_t *r);
+esp_err_t sdm_channel_enable(sdm_channel_handle_t c);
+esp_err_t sdm_channel_set_pulse_density(sdm_channel_handle_t c, int8_t d);
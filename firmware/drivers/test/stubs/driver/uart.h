@@ -0,0 +1,25 @@
+#pragma once
+#include "common_stub.h"
+#include "freertos/queue.h"
+typedef int uart_port_t;
+#define UART_NUM_0 0
+#define UART_NUM_1 1
+#define UART_PIN_NO_CHANGE (-1)
+typedef enum {UART_DATA, UART_BREAK, UART_BUFFER_FULL, UART_FIFO_OVF, UART_FRAME_ERR, UART_PARITY_ERR, UART_DATA_BREAK, UART_PATTERN_DET, UART_WAKEUP, UART_EVENT_MAX} uart_event_type_t;
+typedef struct { uart_event_type_t type; size_t size; bool timeout_flag; } uart_event_t;
+typedef enum {UART_DATA_8_BITS=3} uart_word_length_t;
+#define UART_PARITY_DISABLE 0
+#define UART_STOP_BITS_1 1
+#define UART_HW_FLOWCTRL_DISABLE 0
+#define UART_SCLK_DEFAULT 0
+typedef struct { int baud_rate; int data_bits; int parity; int stop_bits; int flow_ctrl; int source_clk; int rx_flow_ctrl_thresh; } uart_config_t;
+esp_err_t uart_param_config(uart_port_t p, const uart_config_t *c);
+esp_err_t uart_set_pin(uart_port_t p, int tx, int rx, int rts, int cts);
+esp_err_t uart_driver_install(uart_port_t p, int rx, int tx, int qs, QueueHandle_t *q, int f);
+int uart_read_bytes(uart_port_t p, void *b, uint32_t l, TickType_t t);
+int uart_tx_chars(uart_port_t p, const char *b, uint32_t l);
+int uart_write_bytes(uart_port_t p, const void *b, size_t l);
+esp_err_t uart_wait_tx_done(uart_port_t p, TickType_t t);
+esp_err_t uart_flush_input(uart_port_t p);
+esp_err_t uart_get_buffered_data_len(uart_port_t p, size_t *s);
+esp_err_t uart_enable_pattern_det_baud_intr(uart_port_t p, char c, uint8_t n, int a, int b, int d);
@@ -0,0 +1,4 @@
+#pragma once
+#define ESP_LOGI(t, ...) 
+#define ESP_LOGW(t, ...)
+#define ESP_LOGE(t, ...)
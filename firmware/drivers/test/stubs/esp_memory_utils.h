@@ -0,0 +1,3 @@
+#pragma once
+#include <stdbool.h>
+bool esp_ptr_dma_capable(const void *p);
@@ -0,0 +1,10 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+typedef void * QueueHandle_t;
+QueueHandle_t xQueueCreate(UBaseType_t l, UBaseType_t s);
+BaseType_t xQueueSend(QueueHandle_t q, const void *i, TickType_t t);
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *i, BaseType_t *w);
+BaseType_t xQueueReceive(QueueHandle_t q, void *i, TickType_t t);
+BaseType_t xQueueReset(QueueHandle_t q);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q);
+void vQueueDelete(QueueHandle_t q);
@@ -0,0 +1,15 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+typedef void * TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+BaseType_t xTaskCreate(TaskFunction_t f, const char *n, uint32_t s, void *p, UBaseType_t pr, TaskHandle_t *h);
+void vTaskDelete(TaskHandle_t t);
+void vTaskNotifyGiveFromISR(TaskHandle_t t, BaseType_t *w);
+BaseType_t xTaskNotifyGive(TaskHandle_t t);
+uint32_t ulTaskNotifyTake(BaseType_t c, TickType_t t);
+void vTaskDelay(TickType_t t);
+TickType_t xTaskGetTickCount(void);
+UBaseType_t uxTaskGetNumberOfTasks(void);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t t);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+char *pcTaskGetName(TaskHandle_t t);
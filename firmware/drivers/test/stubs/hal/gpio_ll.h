@@ -0,0 +1,5 @@
+#pragma once
+#include "common_stub.h"
+typedef struct gpio_dev_t gpio_dev_t;
+extern gpio_dev_t GPIO;
+void gpio_ll_set_level(gpio_dev_t *hw, uint32_t gpio_num, uint32_t level);
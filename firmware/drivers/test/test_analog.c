@@ -0,0 +1,467 @@
+/**
+ * @file test_analog.c
+ * @brief Analog inputs in continuous mode and scan groups, fed with DMA frames by the ADC 
+ * mock, and conversion to mV.
+ *
+ * Each conversion of a channel gets a value that tells its channel and its number
+ * (Sample()), so the samples read can be checked one by one. The calibration curve of 
+ * the mock is a floating point polynomial, the one the lookup tables replace. Oversampled
+ * channels are fed with a noisy DC level (Noisy()) to measure the gain in effective bits.
+ * The waveform player runs on the alarms of the timer mock, the DAC values are recorded
+ * by sdm_channel_set_pulse_density().
+ */
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "esp_adc/adc_cali_scheme.h"
+#include "driver/sdm.h"
+#include "test_check.h"
+#include "mock_idf.h"
+#include "analog_io_mcu.h"
+
+#define FRAME_LEN		ADC_CONT_FRAME_LEN
+#define POOL_FRAMES		4						/* analog_io_mcu.c ADC_CONT_POOL_FRAMES */
+#define RING_LEN		(2 * ADC_CONT_FRAME_LEN)	/* analog_io_mcu.c ADC_CONT_RING_LEN */
+#define RAW_VALUES		4096
+#define BENCH_BLOCK		2048
+#define BENCH_RUNS		500
+#define NOISE_LEVEL		1000.3		/* Noisy() DC level (raw counts) */
+#define NOISE_RMS		1.5			/* Noisy() noise (raw counts) */
+#define OVS_OUTPUTS		1024		/* Decimated samples measured */
+#define OVS_SETTLE		4			/* Decimated samples skipped (CIC delay line) */
+#define DAC_TIMER		0			/* Waveform player timer (the only one created) */
+#define DAC_TIMER_HZ	10000000	/* analog_io_mcu.c DAC_TIMER_RES_HZ */
+#define DAC_LOG_LEN		64
+
+static uint16_t values[FRAME_LEN];
+static uint16_t scan_samples[FRAME_LEN];
+static uint16_t raw[RAW_VALUES], mv[RAW_VALUES], expected_mv[RAW_VALUES];
+
+static int8_t dac_log[DAC_LOG_LEN];		/* Pulse densities written to the DAC */
+static uint8_t dac_log_num;
+static uint8_t wave_ends;					/* Buffer end callbacks */
+static const uint8_t *wave_refill = NULL;	/* Buffer queued by the next buffer end callback */
+static uint32_t noise_seed = 1;
+static double noise_sum, noise_sum2;		/* Noisy() values sum and sum of squares */
+static uint32_t noise_num;
+
+/* DC level plus gaussian noise (sum of 12 uniform values), rounded to raw counts */
+static uint16_t Noisy(uint8_t channel, uint32_t n){
+	double g = -6.0;
+	uint16_t value;
+
+	for(uint8_t k = 0; k < 12; k++){
+		noise_seed = noise_seed * 1664525 + 1013904223;
+		g += (noise_seed >> 8) / 16777216.0;
+	}
+	value = (uint16_t)(NOISE_LEVEL + NOISE_RMS * g + 0.5);
+	noise_sum += value;
+	noise_sum2 += (double)value * value;
+	noise_num++;
+	return value;
+}
+
+static int64_t NowNs(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* n-th conversion of a channel */
+static uint16_t Sample(uint8_t channel, uint32_t n){
+	return (n * 5 + channel * 1000) & 0xFFF;
+}
+
+/* The samples read are the conversions first to first + count of the channel */
+static bool SameSamples(adc_ch_t channel, const uint16_t *samples, uint16_t count, uint32_t first){
+	for(uint16_t i = 0; i < count; i++){
+		if(samples[i] != Sample(channel, first + i)){
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Take every frame left in the pool */
+static void Drain(adc_ch_t channel){
+	while(AnalogInputReadContinuous(channel, values) > 0){
+	}
+}
+
+static void StartChannels(uint32_t sample_frec){
+	analog_input_config_t config = {.mode = ADC_CONTINUOUS, .func_p = NULL, .sample_frec = sample_frec};
+
+	config.input = CH1;
+	AnalogInputInit(&config);
+	config.input = CH2;
+	AnalogInputInit(&config);
+	AnalogStartContinuous(CH1);
+	AnalogStartContinuous(CH2);
+}
+
+/* Frames of two channels: each channel gets half of every frame, in order */
+static void TestFrames(void){
+	analog_cont_stats_t stats;
+	uint16_t count;
+
+	CHECK(MockAdcSampleFreq() == 2 * 1000);
+	CHECK(MockAdcFrame() && MockAdcFrame());
+	count = AnalogInputReadContinuous(CH1, values);
+	CHECK(count == FRAME_LEN / 2 && SameSamples(CH1, values, count, 0));
+	count = AnalogInputReadContinuous(CH1, values);
+	CHECK(count == FRAME_LEN / 2 && SameSamples(CH1, values, count, FRAME_LEN / 2));
+	/* The other channel samples of both frames were kept */
+	count = AnalogInputReadContinuous(CH2, values);
+	CHECK(count == FRAME_LEN && SameSamples(CH2, values, count, 0));
+	CHECK(AnalogInputReadContinuous(CH2, values) == 0);
+	CHECK(AnalogInputReadContinuous(CH0, values) == 0);
+	AnalogContinuousGetStats(&stats);
+	CHECK(stats.frames == 2 && stats.overruns == 0);
+	CHECK(stats.discarded[CH1] == 0 && stats.discarded[CH2] == 0);
+}
+
+/* Frames not read on time: the pool keeps the oldest ones, the others are lost */
+static void TestOverruns(void){
+	analog_cont_stats_t before, after;
+	uint32_t first = FRAME_LEN;		/* CH1 conversions read by TestFrames() */
+	uint16_t count, frames = 0;
+
+	AnalogContinuousGetStats(&before);
+	for(uint8_t i = 0; i < POOL_FRAMES + 2; i++){
+		MockAdcFrame();
+	}
+	AnalogContinuousGetStats(&after);
+	CHECK(after.frames - before.frames == POOL_FRAMES + 2);
+	CHECK(after.overruns - before.overruns == 2);
+	while((count = AnalogInputReadContinuous(CH1, values)) > 0){
+		CHECK(count == FRAME_LEN / 2 && SameSamples(CH1, values, count, first));
+		first += count;
+		frames++;
+	}
+	CHECK(frames == POOL_FRAMES);
+	/* Conversion goes on after the lost frames */
+	MockAdcFrame();
+	count = AnalogInputReadContinuous(CH1, values);
+	CHECK(count == FRAME_LEN / 2 && SameSamples(CH1, values, count, first + FRAME_LEN));
+	Drain(CH2);
+}
+
+/* A channel not read: its ring keeps the newest RING_LEN samples and counts the overwritten ones */
+static void TestDiscarded(void){
+	analog_cont_stats_t before, after;
+	uint32_t ch2_first, frames = 8;
+	uint16_t count;
+
+	AnalogStopContinuous(CH2);
+	AnalogStartContinuous(CH2);
+	AnalogContinuousGetStats(&before);
+	for(uint32_t i = 0; i < frames; i++){
+		MockAdcFrame();
+		CHECK(AnalogInputReadContinuous(CH1, values) == FRAME_LEN / 2);
+	}
+	AnalogContinuousGetStats(&after);
+	CHECK(after.overruns == before.overruns);
+	CHECK(after.discarded[CH1] == before.discarded[CH1]);
+	CHECK(after.discarded[CH2] - before.discarded[CH2] == frames * FRAME_LEN / 2 - RING_LEN);
+	/* The pattern was configured again: conversions are counted from the restart */
+	ch2_first = frames * FRAME_LEN / 2 - RING_LEN;
+	count = AnalogInputReadContinuous(CH2, values);
+	CHECK(count == FRAME_LEN && SameSamples(CH2, values, count, ch2_first));
+	count = AnalogInputReadContinuous(CH2, values);
+	CHECK(count == FRAME_LEN && SameSamples(CH2, values, count, ch2_first + FRAME_LEN));
+	CHECK(AnalogInputReadContinuous(CH2, values) == 0);
+}
+
+/* Scan group: interleaved samples of whole scans, in the group order */
+static void TestScanGroup(void){
+	adc_ch_t channels[] = {CH3, CH0, CH2};
+	adc_ch_t invalid[] = {CH1, 7};
+	adc_ch_t repeated[] = {CH1, CH1};
+	analog_scan_config_t config = {.channels = channels, .num_channels = 3, .scan_frec = 1000};
+	analog_scan_frame_t frame = {.samples = scan_samples};
+	uint16_t scans = FRAME_LEN / 3;
+	bool same = true;
+
+	CHECK(AnalogScanGroupInit(&config));
+	/* Invalid groups are rejected and keep the group */
+	CHECK(!AnalogScanGroupInit(&(analog_scan_config_t){.channels = invalid, .num_channels = 2, .scan_frec = 1000}));
+	CHECK(!AnalogScanGroupInit(&(analog_scan_config_t){.channels = repeated, .num_channels = 2, .scan_frec = 1000}));
+	CHECK(!AnalogScanGroupInit(&(analog_scan_config_t){.channels = channels, .num_channels = 0, .scan_frec = 1000}));
+	CHECK(!AnalogScanGroupInit(&(analog_scan_config_t){.channels = channels, .num_channels = 5, .scan_frec = 1000}));
+	AnalogScanGroupStart();
+	CHECK(MockAdcSampleFreq() == 3 * 1000);
+	CHECK(AnalogScanGroupRead(&frame) == 0);
+
+	for(uint8_t k = 0; k < 2; k++){
+		mock_time_us = 1000000 * (k + 1);
+		MockAdcFrame();
+		CHECK(AnalogScanGroupRead(&frame) == scans);
+		CHECK(frame.num_channels == 3 && frame.scans == scans);
+		for(uint16_t n = 0; n < scans * 3; n++){
+			same &= (scan_samples[n] == Sample(channels[n % 3], k * scans + n / 3));
+		}
+		/* Conversions are 1 / 3000 s apart, the frame ends with the last one */
+		CHECK(frame.scan_period_ns == 1000000);
+		CHECK(frame.timestamp == mock_time_us - (scans * 3 - 1) * 1000000 / 3000);
+		for(uint8_t index = 0; index < 3; index++){
+			AnalogScanGroupDeinterleave(&frame, index, values);
+			CHECK(SameSamples(channels[index], values, scans, k * scans));
+		}
+	}
+	CHECK(same);
+	AnalogScanGroupStop();
+	CHECK(AnalogScanGroupRead(&frame) == 0);
+}
+
+/* Every raw value converted with the calibration curve of the channel */
+static void CurveMilliVolts(adc_ch_t channel, const uint16_t *samples, uint16_t *out, uint32_t len){
+	adc_cali_curve_fitting_config_t config = {.unit_id = ADC_UNIT_1, .chan = channel, .atten = ADC_ATTEN_DB_12, .bitwidth = ADC_BITWIDTH_12};
+	adc_cali_handle_t handle;
+	int voltage;
+
+	adc_cali_create_scheme_curve_fitting(&config, &handle);
+	for(uint32_t i = 0; i < len; i++){
+		adc_cali_raw_to_voltage(handle, samples[i], &voltage);
+		out[i] = voltage;
+	}
+}
+
+/* Time to convert a block of samples (ns) */
+static int64_t BenchBlock(adc_ch_t channel){
+	int64_t start = NowNs();
+
+	for(uint16_t k = 0; k < BENCH_RUNS; k++){
+		AnalogRawToMilliVolts(channel, raw, mv, BENCH_BLOCK);
+	}
+	return (NowNs() - start) / BENCH_RUNS;
+}
+
+/* Lookup tables give the curve values, for every raw value and channel */
+static void TestCalibration(void){
+	adc_ch_t channels[] = {CH3, CH0, CH2};
+	analog_scan_config_t config = {.channels = channels, .num_channels = 3, .scan_frec = 1000};
+	analog_scan_frame_t frame = {.samples = scan_samples};
+	int64_t curve_ns, lut_ns;
+	bool same = true;
+
+	/* Every raw value, scattered so the table is not read in order */
+	for(uint32_t i = 0; i < RAW_VALUES; i++){
+		raw[i] = (i * 2053) % RAW_VALUES;
+	}
+	curve_ns = BenchBlock(CH0);
+	CHECK(AnalogCalibrationInit(CH0));
+	lut_ns = BenchBlock(CH0);
+	CHECK(lut_ns < curve_ns);
+	printf("%u samples: %.1f us with the lookup table, %.1f us with the calibration curve\n", BENCH_BLOCK, 
+		lut_ns / 1000.0, curve_ns / 1000.0);
+
+	for(adc_ch_t ch = CH0; ch <= CH3; ch++){
+		CurveMilliVolts(ch, raw, expected_mv, RAW_VALUES);
+		if(ch != CH0){
+			/* No table yet: the curve is used */
+			AnalogRawToMilliVolts(ch, raw, mv, RAW_VALUES);
+			CHECK(memcmp(mv, expected_mv, sizeof(mv)) == 0);
+			CHECK(AnalogCalibrationInit(ch));
+		}
+		AnalogRawToMilliVolts(ch, raw, mv, RAW_VALUES);
+		CHECK(memcmp(mv, expected_mv, sizeof(mv)) == 0);
+		/* In place */
+		memcpy(mv, raw, sizeof(mv));
+		AnalogRawToMilliVolts(ch, mv, mv, RAW_VALUES);
+		CHECK(memcmp(mv, expected_mv, sizeof(mv)) == 0);
+	}
+	/* Within half a mV of the curve (rounding) */
+	for(uint32_t i = 0; i < RAW_VALUES; i++){
+		AnalogRawToMilliVolts(CH1, &(uint16_t){i}, mv, 1);
+		same &= (mv[0] - MockAdcCurve(CH1, i) <= 0.5 && MockAdcCurve(CH1, i) - mv[0] < 0.5);
+	}
+	CHECK(same);
+
+	/* Scan frames: each sample with the table of its channel */
+	CHECK(AnalogScanGroupInit(&config));
+	AnalogScanGroupStart();
+	MockAdcFrame();
+	CHECK(AnalogScanGroupRead(&frame) == FRAME_LEN / 3);
+	memcpy(raw, scan_samples, sizeof(scan_samples));
+	AnalogScanGroupToMilliVolts(&frame);
+	for(uint8_t index = 0; index < 3; index++){
+		for(uint16_t n = index; n < frame.scans * 3; n += 3){
+			CurveMilliVolts(channels[index], &raw[n], &expected_mv[0], 1);
+			CHECK(scan_samples[n] == expected_mv[0]);
+		}
+	}
+	AnalogScanGroupStop();
+}
+
+/* Noise of the decimated samples against the raw samples: each 4x of oversampling halves it (1 bit) */
+static void TestOversampling(void){
+	const adc_decim_t types[] = {ADC_DECIM_BOXCAR, ADC_DECIM_CIC};
+	const char *names[] = {"boxcar", "CIC"};
+	const uint16_t osrs[] = {4, 16, 64};
+	double sum, sum2, mean_in, rms_in, mean_out, rms_out, gain, sample;
+	uint16_t count, got;
+	uint8_t bits, log2_osr;
+
+	MockAdcSource(Noisy);
+	AnalogStartContinuous(CH1);
+	for(uint8_t t = 0; t < 2; t++){
+		for(uint8_t o = 0; o < 3; o++){
+			log2_osr = (o + 1) * 2;
+			Drain(CH1);
+			bits = AnalogOversamplingConfig(CH1, osrs[o], types[t]);
+			CHECK(bits == 12 + log2_osr / 2);
+			noise_sum = noise_sum2 = 0;
+			noise_num = 0;
+			sum = sum2 = 0;
+			got = 0;
+			while(got < OVS_SETTLE + OVS_OUTPUTS){
+				MockAdcFrame();
+				while((count = AnalogInputReadContinuous(CH1, values)) > 0){
+					for(uint16_t i = 0; i < count && got < OVS_SETTLE + OVS_OUTPUTS; i++, got++){
+						/* In raw counts */
+						sample = values[i] / (double)(1 << (bits - 12));
+						if(got >= OVS_SETTLE){
+							sum += sample;
+							sum2 += sample * sample;
+						}
+					}
+				}
+			}
+			mean_in = noise_sum / noise_num;
+			rms_in = sqrt(noise_sum2 / noise_num - mean_in * mean_in);
+			mean_out = sum / OVS_OUTPUTS;
+			rms_out = sqrt(sum2 / OVS_OUTPUTS - mean_out * mean_out);
+			gain = log2(rms_in / rms_out);
+			printf("%s OSR %2u: %u bits, noise %.3f -> %.3f counts, +%.2f effective bits\n", names[t], osrs[o], 
+				bits, rms_in, rms_out, gain);
+			CHECK(gain > log2_osr / 2.0 - 0.25);
+			/* The level is kept (output truncation: less than one output step) */
+			CHECK(fabs(mean_out - mean_in) < 1.0 / (1 << (bits - 12)) + 0.05);
+		}
+	}
+	AnalogOversamplingConfig(CH1, 1, ADC_DECIM_BOXCAR);
+	AnalogStopContinuous(CH1);
+	MockAdcSource(Sample);
+}
+
+esp_err_t sdm_channel_set_pulse_density(sdm_channel_handle_t c, int8_t d){
+	if(dac_log_num < DAC_LOG_LEN){
+		dac_log[dac_log_num++] = d;
+	}
+	return ESP_OK;
+}
+
+/* Called from the timer ISR */
+static void WaveEnd(void *param){
+	wave_ends++;
+	if(wave_refill != NULL){
+		CHECK(AnalogOutputWaveQueue(wave_refill, *(uint8_t*)param));
+		wave_refill = NULL;
+	}
+}
+
+/* Sample periods: returns the alarms taken by the player (its timer is running) */
+static uint8_t Play(uint8_t periods){
+	uint8_t played = 0;
+
+	dac_log_num = 0;
+	for(uint8_t i = 0; i < periods; i++){
+		played += MockGptimerAlarm(DAC_TIMER);
+	}
+	return played;
+}
+
+/* The DAC got these samples, starting at position first of the log */
+static bool SameOutput(uint8_t first, const uint8_t *samples, uint8_t len){
+	for(uint8_t i = 0; i < len; i++){
+		if(first + i >= dac_log_num || dac_log[first + i] != (int8_t)(samples[i] - 128)){
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Waveform player: one sample per timer alarm, buffer ends and underruns */
+static void TestWave(void){
+	static const uint8_t loop[] = {0, 64, 128, 192, 255};
+	static const uint8_t wave_a[] = {10, 20, 30, 40}, wave_b[] = {50, 60, 70}, wave_c[] = {80, 90};
+	uint8_t wave_c_len = sizeof(wave_c);
+	analog_output_wave_t wave = {.samples = loop, .len = sizeof(loop), .sample_frec = 8000, .mode = DAC_LOOP, 
+		.func_p = WaveEnd, .param_p = &wave_c_len};
+	analog_wave_stats_t before, after;
+	gptimer_alarm_config_t alarm;
+
+	AnalogOutputInit();
+	wave.sample_frec = 0;
+	CHECK(!AnalogOutputWaveInit(&wave));
+	wave.sample_frec = DAC_TIMER_HZ + 1;
+	CHECK(!AnalogOutputWaveInit(&wave));
+
+	/* Loop: the buffer again and again, at the sample frequency */
+	wave.sample_frec = 8000;
+	CHECK(AnalogOutputWaveInit(&wave));
+	CHECK(MockGptimerAlarmConfig(DAC_TIMER, &alarm));
+	CHECK(alarm.alarm_count == DAC_TIMER_HZ / 8000 && alarm.flags.auto_reload_on_alarm);
+	CHECK(Play(1) == 0);
+	AnalogOutputWaveGetStats(&before);
+	AnalogOutputWaveStart();
+	CHECK(Play(12) == 12);
+	CHECK(SameOutput(0, loop, 5) && SameOutput(5, loop, 5) && SameOutput(10, loop, 2));
+	AnalogOutputWaveGetStats(&after);
+	CHECK(after.samples - before.samples == 12 && after.buffers - before.buffers == 2);
+	CHECK(after.underruns == before.underruns && wave_ends == 2);
+	AnalogOutputWaveStop();
+	CHECK(Play(1) == 0);
+
+	/* One shot: the timer stops at the end of the buffer, a new start plays it again */
+	wave = (analog_output_wave_t){.samples = wave_a, .len = sizeof(wave_a), .sample_frec = 44100, .mode = DAC_ONE_SHOT, 
+		.func_p = WaveEnd, .param_p = &wave_c_len};
+	CHECK(AnalogOutputWaveInit(&wave));
+	CHECK(MockGptimerAlarmConfig(DAC_TIMER, &alarm) && alarm.alarm_count == DAC_TIMER_HZ / 44100);
+	AnalogOutputWaveStart();
+	CHECK(Play(6) == 4 && SameOutput(0, wave_a, 4));
+	CHECK(wave_ends == 3);
+	AnalogOutputWaveStart();
+	CHECK(Play(2) == 2 && SameOutput(0, wave_a, 2));
+	AnalogOutputWaveStop();
+
+	/* Stream: two buffers queued, the third one queued from the buffer end callback */
+	wave = (analog_output_wave_t){.samples = wave_a, .len = sizeof(wave_a), .sample_frec = 1000, .mode = DAC_STREAM, 
+		.func_p = WaveEnd, .param_p = &wave_c_len};
+	CHECK(AnalogOutputWaveInit(&wave));
+	CHECK(AnalogOutputWaveQueue(wave_b, sizeof(wave_b)));
+	CHECK(!AnalogOutputWaveQueue(wave_c, sizeof(wave_c)));
+	wave_refill = wave_c;
+	wave_ends = 0;
+	AnalogOutputWaveGetStats(&before);
+	AnalogOutputWaveStart();
+	CHECK(Play(9) == 9);
+	CHECK(SameOutput(0, wave_a, 4) && SameOutput(4, wave_b, 3) && SameOutput(7, wave_c, 2));
+	CHECK(wave_ends == 3 && wave_refill == NULL);
+	/* Nothing queued: the output keeps the last sample and each period is an underrun */
+	CHECK(Play(3) == 3 && dac_log_num == 0);
+	AnalogOutputWaveGetStats(&after);
+	CHECK(after.samples - before.samples == 9 && after.buffers - before.buffers == 3);
+	CHECK(after.underruns - before.underruns == 3);
+	/* A buffer queued while starved is played at once */
+	CHECK(AnalogOutputWaveQueue(wave_b, sizeof(wave_b)));
+	CHECK(Play(1) == 1 && SameOutput(0, wave_b, 1));
+	AnalogOutputWaveStop();
+}
+
+int main(void){
+	MockAdcSource(Sample);
+	StartChannels(1000);
+	TestFrames();
+	TestOverruns();
+	TestDiscarded();
+	AnalogStopContinuous(CH1);
+	AnalogStopContinuous(CH2);
+	CHECK(!MockAdcFrame());
+	TestScanGroup();
+	TestCalibration();
+	TestOversampling();
+	TestWave();
+	TEST_END();
+}
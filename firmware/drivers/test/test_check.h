@@ -0,0 +1,26 @@
+/**
+ * @file test_check.h
+ * @brief Minimal checks for the driver host tests.
+ * 
+ * A failed CHECK() prints its location and the test keeps going; TEST_END() 
+ * returns the exit status read by ctest.
+ */
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+#include <stdio.h>
+
+static int test_failures = 0;
+
+#define CHECK(cond) do{ \
+		if(!(cond)){ \
+			printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+			test_failures++; \
+		} \
+	}while(0)
+
+#define TEST_END() do{ \
+		printf("%s: %s\n", __FILE__, (test_failures == 0) ? "PASS" : "FAIL"); \
+		return (test_failures == 0) ? 0 : 1; \
+	}while(0)
+
+#endif /* TEST_CHECK_H */
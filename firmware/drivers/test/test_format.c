@@ -0,0 +1,160 @@
+/**
+ * @file test_format.c
+ * @brief format.h conversions checked against the C library printf family, and timed
+ * against it and UartItoa().
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "test_check.h"
+#include "format.h"
+#include "uart_mcu.h"
+
+#define CHECK_STR(a, b) do{ \
+		if(strcmp(a, b) != 0){ \
+			printf("  got \"%s\", expected \"%s\"\n", a, b); \
+		} \
+		CHECK(strcmp(a, b) == 0); \
+	}while(0)
+
+#define BENCH_VALUES	50000
+
+static void TestIntegers(void){
+	const uint32_t u[] = {0, 1, 9, 10, 99, 100, 101, 999, 1000, 65535, 123456789, 4294967295u};
+	const int32_t i[] = {0, -1, INT_MIN, INT_MAX, -99, -100, 12345};
+	char a[FORMAT_U32_LEN + 1], b[16];
+
+	for(uint8_t n = 0; n < sizeof(u) / sizeof(u[0]); n++){
+		CHECK(FormatU32(a, u[n]) == sprintf(b, "%u", u[n]));
+		CHECK_STR(a, b);
+		FormatHex(a, u[n], 4);
+		sprintf(b, "%04X", u[n]);
+		CHECK_STR(a, b);
+	}
+	for(uint8_t n = 0; n < sizeof(i) / sizeof(i[0]); n++){
+		CHECK(FormatI32(a, i[n]) == sprintf(b, "%d", i[n]));
+		CHECK_STR(a, b);
+	}
+	/* Pseudo random values over the whole range */
+	srand(1);
+	for(uint16_t n = 0; n < 10000; n++){
+		uint32_t v = ((uint32_t)rand() << 16) ^ rand();
+		FormatU32(a, v >> (n % 32));
+		sprintf(b, "%u", v >> (n % 32));
+		CHECK_STR(a, b);
+		FormatI32(a, (int32_t)v);
+		sprintf(b, "%d", (int32_t)v);
+		CHECK_STR(a, b);
+	}
+}
+
+static void TestFixedFloat(void){
+	const float f[] = {0, 1.5f, -2.25f, 3.14159f, 0.0049f, 99.995f, 1234.5678f, -0.0051f};
+	char a[FORMAT_FLOAT_LEN], b[32];
+
+	FormatFixed(a, -1234, 2);
+	CHECK_STR(a, "-12.34");
+	FormatFixed(a, 5, 3);
+	CHECK_STR(a, "0.005");
+	FormatFixed(a, -5, 3);
+	CHECK_STR(a, "-0.005");
+	for(uint8_t n = 0; n < sizeof(f) / sizeof(f[0]); n++){
+		FormatFloat(a, f[n], 2);
+		sprintf(b, "%.2f", f[n]);
+		CHECK_STR(a, b);
+	}
+	/* Unlike printf ("-0.00"), negative values rounded to 0 have no sign */
+	FormatFloat(a, -0.004f, 2);
+	CHECK_STR(a, "0.00");
+}
+
+static void TestPrint(void){
+	char a[64], b[64];
+
+	FormatPrint(a, sizeof(a), "v=%5d|%-4u|%06.2f|%x|%s|%c|%%|%08X", -42, 7u, -1.5, 255u, "hi", 'z', 0xBEEFu);
+	snprintf(b, sizeof(b), "v=%5d|%-4u|%06.2f|%x|%s|%c|%%|%08X", -42, 7u, -1.5, 255u, "hi", 'z', 0xBEEFu);
+	CHECK_STR(a, b);
+	/* 'l' reads a long, 'h' a promoted int */
+	FormatPrint(a, sizeof(a), "%ld %lu %lx %hu %-6s|%6s|", -123456l, 4000000000ul, 0xBEEFul, 42, "ab", "cd");
+	snprintf(b, sizeof(b), "%ld %lu %lx %hu %-6s|%6s|", -123456l, 4000000000ul, 0xBEEFul, 42, "ab", "cd");
+	CHECK_STR(a, b);
+	FormatPrint(a, sizeof(a), "%d %u %d", (int32_t)-7, (uint32_t)8, (int32_t)INT32_MIN);
+	snprintf(b, sizeof(b), "%d %u %d", -7, 8u, INT_MIN);
+	CHECK_STR(a, b);
+	/* Truncated to size - 1, like snprintf, but the length returned is the one written */
+	CHECK(FormatPrint(a, 8, "%s", "0123456789") == 7);
+	CHECK_STR(a, "0123456");
+	CHECK(FormatPrint(a, 1, "%d", 5) == 0);
+	CHECK_STR(a, "");
+	FormatPrint(a, sizeof(a), "[%s]", (const char*)NULL);
+	CHECK_STR(a, "[(null)]");
+}
+
+static int64_t NowNs(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Conversion time against the C library and UartItoa(), over the same pseudo random values */
+static void Bench(void){
+	static uint32_t values[BENCH_VALUES];
+	char a[64];
+	int64_t start, format_ns, sprintf_ns, itoa_ns, itoa16_ns, hex_ns, print_ns, snprintf_ns;
+	volatile uint32_t sink = 0;
+
+	srand(2);
+	for(uint16_t n = 0; n < BENCH_VALUES; n++){
+		values[n] = (((uint32_t)rand() << 16) ^ rand()) >> (n % 32);
+	}
+	start = NowNs();
+	for(uint16_t n = 0; n < BENCH_VALUES; n++){
+		sink += FormatU32(a, values[n]);
+	}
+	format_ns = NowNs() - start;
+	start = NowNs();
+	for(uint16_t n = 0; n < BENCH_VALUES; n++){
+		sink += sprintf(a, "%u", values[n]);
+	}
+	sprintf_ns = NowNs() - start;
+	start = NowNs();
+	for(uint16_t n = 0; n < BENCH_VALUES; n++){
+		sink += UartItoa(values[n], 10)[0];
+	}
+	itoa_ns = NowNs() - start;
+	start = NowNs();
+	for(uint16_t n = 0; n < BENCH_VALUES; n++){
+		sink += UartItoa(values[n], 16)[0];
+	}
+	itoa16_ns = NowNs() - start;
+	start = NowNs();
+	for(uint16_t n = 0; n < BENCH_VALUES; n++){
+		sink += FormatHex(a, values[n], 0);
+	}
+	hex_ns = NowNs() - start;
+	start = NowNs();
+	for(uint16_t n = 0; n < BENCH_VALUES; n++){
+		sink += FormatPrint(a, sizeof(a), "t=%u ch%d: %5d mV %.2f", values[n], n % 4, (int32_t)(n % 3300), n / 7.0f);
+	}
+	print_ns = NowNs() - start;
+	start = NowNs();
+	for(uint16_t n = 0; n < BENCH_VALUES; n++){
+		sink += snprintf(a, sizeof(a), "t=%u ch%d: %5d mV %.2f", values[n], n % 4, (int)(n % 3300), n / 7.0f);
+	}
+	snprintf_ns = NowNs() - start;
+	printf("ns/conversion: FormatU32 %.1f, sprintf %%u %.1f, UartItoa %.1f | FormatHex %.1f, UartItoa base 16 %.1f"
+		" | FormatPrint %.1f, snprintf %.1f\n", (double)format_ns / BENCH_VALUES, (double)sprintf_ns / BENCH_VALUES,
+		(double)itoa_ns / BENCH_VALUES, (double)hex_ns / BENCH_VALUES, (double)itoa16_ns / BENCH_VALUES,
+		(double)print_ns / BENCH_VALUES, (double)snprintf_ns / BENCH_VALUES);
+}
+
+int main(void){
+	TestIntegers();
+	TestFixedFloat();
+	TestPrint();
+	Bench();
+	TEST_END();
+}
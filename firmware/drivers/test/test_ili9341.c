@@ -0,0 +1,673 @@
+/**
+ * @file test_ili9341.c
+ * @brief ILI9341 drawing on the host LCD emulator: golden images, SPI transactions and frame rates.
+ *
+ * Golden hashes were taken drawing the same scenes with the original driver
+ * (pixel by pixel through SpiWrite()). On a mismatch the image is saved as
+ * <scene>.ppm in the working directory. Frame rates are the SPI limit at the
+ * driver bit rate (20 MHz) for the bytes sent; host times include the emulator.
+ */
+#include <string.h>
+#include <time.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "lcd_emu.h"
+#include "gpio_mcu.h"
+#include "ili9341.h"
+
+#define LCD_DC		GPIO_9
+#define LCD_RST		GPIO_18
+#define SPI_BITRATE	20000000
+#define PIC_WIDTH	100
+#define PIC_HEIGHT	80
+#define BENCH_FRAMES	20
+#define BENCH_STRINGS	200
+#define GOLDEN_PICTURES	0xdb046a0f
+#define GOLDEN_SHAPES	0x3b2a2093
+#define GOLDEN_LINES	0x62d7c1ae
+#define GOLDEN_TEXT	0x39e49903
+#define GOLDEN_LIST		0x2938118b
+
+static uint8_t picture[PIC_WIDTH * PIC_HEIGHT * 2];
+static uint16_t reference[LCD_EMU_SIZE][LCD_EMU_SIZE];	/* Screen drawn directly, to compare with other paths */
+
+static int64_t NowUs(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* Render times are measured with the host clock */
+int64_t esp_timer_get_time(void){
+	return NowUs();
+}
+
+/* Every transaction was accepted and every wait had something to wait for */
+static void CheckSpi(mock_spi_stats_t *stats){
+	lcd_emu_stats_t emu;
+
+	MockSpiStats(0, stats, true);
+	LcdEmuStats(&emu, true);
+	CHECK(stats->rejected == 0);
+	CHECK(stats->overflows == 0);
+	CHECK(stats->hangs == 0);
+	CHECK(emu.overruns == 0);
+}
+
+static bool SameAsReference(void){
+	return memcmp(reference, LcdEmuScreen(), sizeof(reference)) == 0;
+}
+
+static void CheckGolden(const char *scene, uint32_t golden){
+	char path[64];
+	uint32_t hash = LcdEmuHash(ILI9341_WIDTH, ILI9341_HEIGHT);
+
+	if(hash != golden){
+		snprintf(path, sizeof(path), "%s.ppm", scene);
+		LcdEmuSavePpm(path, ILI9341_WIDTH, ILI9341_HEIGHT);
+		printf("%s: hash 0x%08x, golden 0x%08x (saved %s)\n", scene, hash, golden, path);
+	}
+	CHECK(hash == golden);
+}
+
+/* Fills and pictures (RAM, or flash through the bounce buffers) */
+static void ScenePictures(void){
+	ILI9341Fill(ILI9341_NAVY);
+	ILI9341DrawFilledRectangle(10, 10, 229, 59, ILI9341_ORANGE);
+	ILI9341DrawFilledRectangle(200, 300, 30, 250, ILI9341_GREEN);
+	ILI9341DrawPicture(5, 70, PIC_WIDTH, PIC_HEIGHT, picture);
+	ILI9341DrawPicture(150, 200, 20, 10, picture);
+}
+
+/* Every primitive, all inside the LCD */
+static void SceneShapes(void){
+	ILI9341Fill(ILI9341_WHITE);
+	ILI9341DrawFilledRectangle(10, 10, 100, 50, ILI9341_RED);
+	ILI9341DrawLine(0, 0, 239, 319, ILI9341_BLUE);
+	ILI9341DrawLine(200, 20, 20, 60, ILI9341_MAROON);
+	ILI9341DrawRectangle(150, 130, 230, 180, ILI9341_PURPLE);
+	ILI9341DrawCircle(120, 160, 40, ILI9341_GREEN);
+	ILI9341DrawFilledCircle(60, 250, 20, ILI9341_YELLOW);
+	ILI9341DrawString(5, 100, "Hola 123\nESP-EDU", &font_11, ILI9341_BLACK, ILI9341_WHITE);
+	ILI9341DrawInt(150, 250, 2024, 5, &font_22, ILI9341_DARKGREEN, ILI9341_WHITE);
+	ILI9341DrawFilledTriangle(150, 20, 230, 90, 170, 120, ILI9341_NAVY);
+	ILI9341DrawTriangle(10, 300, 50, 260, 90, 310, ILI9341_MAROON);
+	ILI9341DrawPicture(200, 280, 20, 10, picture);
+	ILI9341DrawPixel(239, 319, ILI9341_PINK);
+}
+
+/* Random lines, circles and triangles inside the LCD (same sequence on any host) */
+static uint32_t lines_seed;
+
+static void LinesRandom(int16_t *p, uint8_t n){
+	for(uint8_t k = 0; k < n; k++){
+		lines_seed = lines_seed * 1103515245u + 12345u;
+		p[k] = (lines_seed >> 16) % ((k % 2) ? ILI9341_HEIGHT : ILI9341_WIDTH);
+	}
+}
+
+/* Transactions of each primitive are added to transactions[] when not NULL */
+static void SceneLines(uint32_t transactions[5]){
+	mock_spi_stats_t stats;
+	int16_t p[6];
+
+	lines_seed = 20;
+	ILI9341Fill(ILI9341_BLACK);
+	MockSpiStats(0, &stats, true);
+	for(uint8_t i = 0; i < 20; i++){
+		LinesRandom(p, 4);
+		ILI9341DrawLine(p[0], p[1], p[2], p[3], ILI9341_RED + i);
+		MockSpiStats(0, &stats, true);
+		transactions[0] += stats.transactions;
+		LinesRandom(p, 3);
+		ILI9341DrawCircle(40 + p[0] % (ILI9341_WIDTH - 80), 40 + p[1] % (ILI9341_HEIGHT - 80), p[2] % 40, ILI9341_GREEN);
+		MockSpiStats(0, &stats, true);
+		transactions[1] += stats.transactions;
+		LinesRandom(p, 3);
+		ILI9341DrawFilledCircle(30 + p[0] % (ILI9341_WIDTH - 60), 30 + p[1] % (ILI9341_HEIGHT - 60), p[2] % 30, ILI9341_BLUE + i);
+		MockSpiStats(0, &stats, true);
+		transactions[2] += stats.transactions;
+		LinesRandom(p, 6);
+		ILI9341DrawFilledTriangle(p[0], p[1], p[2], p[3], p[4], p[5], ILI9341_YELLOW);
+		MockSpiStats(0, &stats, true);
+		transactions[3] += stats.transactions;
+		LinesRandom(p, 6);
+		ILI9341DrawTriangle(p[0], p[1], p[2], p[3], p[4], p[5], ILI9341_WHITE);
+		MockSpiStats(0, &stats, true);
+		transactions[4] += stats.transactions;
+	}
+}
+
+/* Text heavy screen, characters don't overlap */
+static void SceneText(void){
+	char number[8];
+
+	ILI9341Fill(ILI9341_BLACK);
+	for(uint8_t i = 0; i < 3; i++){
+		ILI9341DrawString(0, i * 50, "Temp: 23.5 C\nHumidity 45%", &font_22, ILI9341_WHITE, ILI9341_BLACK);
+	}
+	for(uint8_t i = 0; i < 24; i++){
+		snprintf(number, sizeof(number), "%u", i * 37);
+		ILI9341DrawString((i % 4) * 60, 155 + (i / 4) * 22, number, &font_19, ILI9341_GREEN, ILI9341_BLACK);
+	}
+	for(uint8_t i = 0; i < 20; i++){
+		ILI9341DrawChar(i * 12, 300, 'A' + i, &font_11, ILI9341_RED, ILI9341_BLACK);
+	}
+}
+
+static void TestFill(void){
+	mock_spi_stats_t stats;
+	lcd_emu_stats_t emu;
+	bool same = true;
+
+	ILI9341Fill(ILI9341_RED);
+	MockSpiStats(0, &stats, false);
+	LcdEmuStats(&emu, false);
+	CheckSpi(&stats);
+	/* The fill area is one pixel larger than the LCD, as it always was */
+	CHECK(emu.pixels == (ILI9341_WIDTH + 1) * (ILI9341_HEIGHT + 1));
+	/* Addresses and memory write, then whole DMA buffers (not 256 byte pieces) */
+	CHECK(stats.transactions <= 5 + (emu.pixels * 2 + 4091) / 4092);
+	for(uint16_t y = 0; y < ILI9341_HEIGHT; y++){
+		for(uint16_t x = 0; x < ILI9341_WIDTH; x++){
+			same &= (LcdEmuPixel(x, y) == ILI9341_RED);
+		}
+	}
+	CHECK(same);
+}
+
+static void TestPictures(void){
+	mock_spi_stats_t stats;
+
+	ScenePictures();
+	CheckSpi(&stats);
+	CheckGolden("pictures", GOLDEN_PICTURES);
+	/* Pictures in flash go through the bounce buffers: same image */
+	mock_dma_capable = false;
+	ILI9341Fill(ILI9341_BLACK);
+	ScenePictures();
+	mock_dma_capable = true;
+	CheckSpi(&stats);
+	CheckGolden("pictures_flash", GOLDEN_PICTURES);
+}
+
+/* The framebuffer (whole or in bands) ends up with the same image as direct drawing */
+static void TestFramebuffer(void){
+	mock_spi_stats_t stats;
+	bool same = true;
+
+	SceneShapes();
+	CheckSpi(&stats);
+	CheckGolden("shapes", GOLDEN_SHAPES);
+	memcpy(reference, LcdEmuScreen(), sizeof(reference));
+
+	CHECK(ILI9341FramebufferInit(0));
+	ILI9341Fill(ILI9341_BLACK);
+	ILI9341Flush();
+	CheckSpi(&stats);
+	/* Nothing is sent until the flush */
+	SceneShapes();
+	MockSpiStats(0, &stats, false);
+	CHECK(stats.transactions == 0);
+	for(uint16_t y = 0; y < ILI9341_HEIGHT; y++){
+		for(uint16_t x = 0; x < ILI9341_WIDTH; x++){
+			same &= (ILI9341FramebufferGetPixel(x, y) == reference[y][x]);
+		}
+	}
+	CHECK(same);
+	ILI9341Flush();
+	CheckSpi(&stats);
+	/* The full screen fill made the whole LCD dirty: one window, whole DMA chunks */
+	CHECK(stats.transactions <= 5 + (ILI9341_WIDTH * ILI9341_HEIGHT * 2 + 4091) / 4092);
+	CheckGolden("shapes_fb", GOLDEN_SHAPES);
+
+	/* Two pixels far apart: two small windows, not the area between them */
+	ILI9341DrawPixel(5, 5, ILI9341_RED);
+	ILI9341DrawPixel(200, 300, ILI9341_RED);
+	ILI9341Flush();
+	CheckSpi(&stats);
+	CHECK(stats.bytes <= 2 * (2 * 5 + 1 + 2));
+	CHECK(LcdEmuPixel(5, 5) == ILI9341_RED && LcdEmuPixel(200, 300) == ILI9341_RED);
+
+	/* Bands of 40 rows: the scene is drawn once per band, clipped */
+	CHECK(ILI9341FramebufferInit(40));
+	ILI9341Rotate(ILI9341_Portrait_1);
+	for(uint16_t y = 0; y < ILI9341_HEIGHT; y += 40){
+		ILI9341FramebufferBand(y);
+		SceneShapes();
+		ILI9341Flush();
+	}
+	CheckSpi(&stats);
+	CheckGolden("shapes_bands", GOLDEN_SHAPES);
+	ILI9341FramebufferDeInit();
+}
+
+/* Span rasterizers: same image as drawn pixel by pixel by the original driver */
+static void TestLines(void){
+	static const char *names[] = {"line", "circle", "filled circle", "filled triangle", "triangle"};
+	static const int16_t aa[][4] = {{200, 60, 10, 10}, {5, 300, 30, 100}, {230, 100, 100, 200}, 
+		{60, 310, 80, 220}, {10, 10, 10, 100}, {-20, -5, 400, 500}};
+	uint32_t transactions[5] = {0};
+	mock_spi_stats_t stats;
+	bool same = true;
+
+	SceneLines(transactions);
+	CheckSpi(&stats);
+	CheckGolden("lines", GOLDEN_LINES);
+	for(uint8_t i = 0; i < 5; i++){
+		printf("%-16s %5.1f transactions\n", names[i], transactions[i] / 20.0);
+	}
+	/* One window per span: a pixel by pixel line costs 5 transactions per pixel */
+	CHECK(transactions[0] < 20 * 5 * 100);
+	/* Filled shapes: at most one span per row */
+	CHECK(transactions[2] <= 20 * 6 * (2 * 30 + 1));
+	CHECK(transactions[3] <= 20 * 6 * ILI9341_HEIGHT);
+
+	CHECK(ILI9341FramebufferInit(0));
+	SceneLines(transactions);
+	ILI9341Flush();
+	CheckSpi(&stats);
+	CheckGolden("lines_fb", GOLDEN_LINES);
+
+	/* Antialiased lines in every direction, flushed one by one: the flush sends every blended pixel */
+	for(uint8_t i = 0; i < sizeof(aa) / sizeof(aa[0]); i++){
+		ILI9341Fill(ILI9341_BLACK);
+		ILI9341Flush();
+		ILI9341DrawLineAA(aa[i][0], aa[i][1], aa[i][2], aa[i][3], ILI9341_WHITE);
+		ILI9341Flush();
+		CheckSpi(&stats);
+		for(uint16_t y = 0; y < ILI9341_HEIGHT; y++){
+			for(uint16_t x = 0; x < ILI9341_WIDTH; x++){
+				same &= (ILI9341FramebufferGetPixel(x, y) == LcdEmuPixel(x, y));
+			}
+		}
+	}
+	CHECK(same);
+	ILI9341Fill(ILI9341_BLACK);
+	ILI9341DrawLineAA(200, 60, 10, 10, ILI9341_WHITE);
+	ILI9341Flush();
+	/* Blended: the pixels next to the line are neither black nor white */
+	CHECK(LcdEmuPixel(105, 35) != ILI9341_BLACK && LcdEmuPixel(105, 35) != ILI9341_WHITE);
+	ILI9341FramebufferDeInit();
+}
+
+/* Display list rendered in bands of any height: same image as drawn by the original driver */
+static void TestRender(void){
+	static const uint16_t bands[] = {0, 16, 30, 7, ILI9341_HEIGHT};
+	const ili9341_dl_item_t list[] = {
+		{.type = ILI9341_DL_FILL, .color = ILI9341_WHITE},
+		{.type = ILI9341_DL_FILLED_RECTANGLE, .x0 = 10, .y0 = 10, .x1 = 100, .y1 = 50, .color = ILI9341_RED},
+		{.type = ILI9341_DL_LINE, .x0 = 0, .y0 = 0, .x1 = 239, .y1 = 319, .color = ILI9341_BLUE},
+		{.type = ILI9341_DL_RECTANGLE, .x0 = 150, .y0 = 130, .x1 = 230, .y1 = 180, .color = ILI9341_PURPLE},
+		{.type = ILI9341_DL_CIRCLE, .x0 = 120, .y0 = 160, .x1 = 40, .color = ILI9341_GREEN},
+		{.type = ILI9341_DL_FILLED_CIRCLE, .x0 = 60, .y0 = 250, .x1 = 20, .color = ILI9341_YELLOW},
+		{.type = ILI9341_DL_STRING, .x0 = 5, .y0 = 100, .data = "Hola 123\nESP-EDU", .font = &font_11, 
+			.color = ILI9341_BLACK, .background = ILI9341_WHITE},
+		{.type = ILI9341_DL_FILLED_TRIANGLE, .x0 = 150, .y0 = 20, .x1 = 230, .y1 = 90, .x2 = 170, .y2 = 120, .color = ILI9341_NAVY},
+		{.type = ILI9341_DL_TRIANGLE, .x0 = 10, .y0 = 300, .x1 = 50, .y1 = 260, .x2 = 90, .y2 = 310, .color = ILI9341_MAROON},
+		{.type = ILI9341_DL_PICTURE, .x0 = 200, .y0 = 280, .x1 = 20, .y1 = 10, .data = picture},
+		{.type = ILI9341_DL_PIXEL, .x0 = 239, .y0 = 319, .color = ILI9341_PINK},
+	};
+	const uint16_t len = sizeof(list) / sizeof(ili9341_dl_item_t);
+	mock_spi_stats_t stats;
+	uint32_t draw_us, frame_us;
+	char name[32];
+
+	CHECK(!ILI9341Render(list, len));
+	for(uint8_t i = 0; i < sizeof(bands) / sizeof(bands[0]); i++){
+		ILI9341Fill(ILI9341_BLACK);
+		CheckSpi(&stats);
+		CHECK(ILI9341RenderInit(bands[i]));
+		CHECK(ILI9341Render(list, len));
+		CheckSpi(&stats);
+		snprintf(name, sizeof(name), "render_%u", bands[i]);
+		CheckGolden(name, GOLDEN_LIST);
+		ILI9341RenderGetTime(&draw_us, &frame_us);
+		printf("render %3u rows: %6u bytes %4u transactions/frame, %5u us drawing, %5u us/frame on host\n", 
+			bands[i], stats.bytes, stats.transactions, draw_us, frame_us);
+	}
+	/* Not available while the framebuffer is in use */
+	CHECK(ILI9341FramebufferInit(40));
+	CHECK(!ILI9341Render(list, len));
+	ILI9341FramebufferDeInit();
+	ILI9341RenderDeInit();
+}
+
+/* Cached glyphs: same image, no transaction over the SPI limit (font_89 glyphs are up to 7.6 kB). 
+ * Characters don't overlap: cached lines also draw the background between characters */
+static void TestGlyphCache(void){
+	Font_t *fonts[] = {&font_11, &font_19, &font_22, &font_30, &font_59, &font_89};
+	const char *text = "Temp: 23.5C ~{}|";
+	mock_spi_stats_t stats;
+	uint32_t hits, misses, bytes;
+	uint32_t transactions[2];
+	int64_t us[2];
+
+	for(uint8_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++){
+		ILI9341GlyphCacheInit(0);
+		ILI9341Fill(ILI9341_WHITE);
+		ILI9341DrawString(0, 0, "Ag1\nx.y", fonts[f], ILI9341_BLACK, ILI9341_WHITE);
+		ILI9341DrawChar(0, 200, '0', fonts[f], ILI9341_RED, ILI9341_WHITE);
+		CheckSpi(&stats);
+		memcpy(reference, LcdEmuScreen(), sizeof(reference));
+		/* Misses and then hits */
+		ILI9341GlyphCacheInit(16384);
+		for(uint8_t i = 0; i < 2; i++){
+			ILI9341Fill(ILI9341_WHITE);
+			ILI9341DrawString(0, 0, "Ag1\nx.y", fonts[f], ILI9341_BLACK, ILI9341_WHITE);
+			ILI9341DrawChar(0, 200, '0', fonts[f], ILI9341_RED, ILI9341_WHITE);
+			CheckSpi(&stats);
+			CHECK(SameAsReference());
+		}
+		/* Throughput, without and with cache */
+		for(uint8_t cached = 0; cached < 2; cached++){
+			ILI9341GlyphCacheInit(cached ? 32768 : 0);
+			us[cached] = NowUs();
+			for(uint8_t i = 0; i < BENCH_STRINGS; i++){
+				ILI9341DrawString(0, 100, (char*)text, fonts[f], ILI9341_BLACK, ILI9341_WHITE);
+			}
+			us[cached] = NowUs() - us[cached];
+			CheckSpi(&stats);
+			transactions[cached] = stats.transactions / BENCH_STRINGS;
+		}
+		ILI9341GlyphCacheGetStats(&hits, &misses, &bytes);
+		CHECK(transactions[1] <= transactions[0]);
+		printf("font_%-2u %7.1f us %4u transactions/string, cached %7.1f us %4u transactions/string (%u hits %u misses %u bytes)\n",
+			fonts[f]->font_height, (double)us[0] / BENCH_STRINGS, transactions[0], 
+			(double)us[1] / BENCH_STRINGS, transactions[1], hits, misses, bytes);
+	}
+	ILI9341GlyphCacheInit(0);
+}
+
+/* Run length encoded fonts: same image as the uncompressed ones, drawn directly and to the framebuffer */
+static void TestCompressed(void){
+	Font_t *raw[] = {&font_22, &font_30, &font_59, &font_89};
+	Font_t *rle[] = {&font_22_rle, &font_30_rle, &font_59_rle, &font_89_rle};
+	mock_spi_stats_t stats;
+
+	for(uint8_t f = 0; f < sizeof(raw) / sizeof(raw[0]); f++){
+		ILI9341Fill(ILI9341_WHITE);
+		ILI9341DrawString(0, 0, "Ag1\nx.y", raw[f], ILI9341_BLACK, ILI9341_WHITE);
+		CheckSpi(&stats);
+		memcpy(reference, LcdEmuScreen(), sizeof(reference));
+		ILI9341Fill(ILI9341_WHITE);
+		ILI9341DrawString(0, 0, "Ag1\nx.y", rle[f], ILI9341_BLACK, ILI9341_WHITE);
+		CheckSpi(&stats);
+		CHECK(SameAsReference());
+
+		/* Nothing is sent (or waited for) until the flush */
+		CHECK(ILI9341FramebufferInit(0));
+		ILI9341Fill(ILI9341_BLACK);
+		ILI9341DrawString(0, 0, "Ag1\nx.y", rle[f], ILI9341_BLACK, ILI9341_WHITE);
+		MockSpiStats(0, &stats, false);
+		CHECK(stats.transactions == 0 && stats.hangs == 0);
+		ILI9341Fill(ILI9341_WHITE);
+		ILI9341DrawString(0, 0, "Ag1\nx.y", rle[f], ILI9341_BLACK, ILI9341_WHITE);
+		ILI9341Flush();
+		CheckSpi(&stats);
+		CHECK(SameAsReference());
+		ILI9341FramebufferDeInit();
+	}
+}
+
+/* Uncompressed icon expanded into the reference screen */
+static void ExpectIcon(const ili9341_sprite_t *sprite, icon_font_t *raw){
+	const uint8_t *src = raw->data + sprite->icon * raw->offset;
+	uint16_t row_bytes = (raw->width + 7) / 8;
+
+	for(uint16_t i = 0; i < raw->height; i++){
+		for(uint16_t j = 0; j < raw->width; j++){
+			if(src[i * row_bytes + j / 8] & (0x80 >> (j % 8))){
+				reference[sprite->y + i][sprite->x + j] = sprite->foreground;
+			}else if(!sprite->transparent){
+				reference[sprite->y + i][sprite->x + j] = sprite->background;
+			}
+		}
+	}
+}
+
+/* Uncompressed font of the same size as a compressed one */
+static icon_font_t* RawIconFont(icon_font_t *font){
+	return (font == &icon_30_rle) ? &icon_30 : (font == &icon_59_rle) ? &icon_59 : (font == &icon_89_rle) ? &icon_89 : font;
+}
+
+/* Icons in a single window, sprite batches and transparent sprites */
+static void TestIcons(void){
+	icon_font_t *fonts[] = {&icon_22, &icon_30, &icon_59, &icon_89, &icon_30_rle, &icon_59_rle, &icon_89_rle};
+	ili9341_sprite_t sprites[8];
+	mock_spi_stats_t stats;
+	bool same = true;
+	uint8_t n = 0;
+
+	for(uint8_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++){
+		for(uint8_t i = 0; i <= ICON_RAIN; i++){
+			ili9341_sprite_t sprite = {7, 9, i, fonts[f], ILI9341_RED, ILI9341_GREEN, false};
+			ILI9341Fill(ILI9341_BLACK);
+			memcpy(reference, LcdEmuScreen(), sizeof(reference));
+			ExpectIcon(&sprite, RawIconFont(fonts[f]));
+			ILI9341DrawIcon(sprite.x, sprite.y, sprite.icon, sprite.icon_font, sprite.foreground, sprite.background);
+			same &= SameAsReference();
+		}
+	}
+	CHECK(same);
+	CheckSpi(&stats);
+
+	/* Unsorted batch: a row of 5 adjacent icons (one window) and 2 others */
+	for(int8_t i = 4; i >= 0; i--){
+		sprites[n++] = (ili9341_sprite_t){10 + 30 * i, 50, i, &icon_30_rle, ILI9341_BLUE, ILI9341_WHITE, false};
+	}
+	sprites[n++] = (ili9341_sprite_t){100, 200, ICON_HEART, &icon_59, ILI9341_RED, ILI9341_BLACK, false};
+	sprites[n++] = (ili9341_sprite_t){0, 0, ICON_SUN, &icon_22, ILI9341_YELLOW, ILI9341_BLACK, false};
+	ILI9341Fill(ILI9341_NAVY);
+	CheckSpi(&stats);
+	memcpy(reference, LcdEmuScreen(), sizeof(reference));
+	for(uint8_t i = 0; i < n; i++){
+		ExpectIcon(&sprites[i], RawIconFont(sprites[i].icon_font));
+	}
+	ILI9341DrawSprites(sprites, n);
+	CheckSpi(&stats);
+	CHECK(SameAsReference());
+	CHECK(sprites[0].x == 0 && sprites[0].y == 0);
+	/* 3 windows: commands and chunks of 2 to 4 bounce buffers each */
+	CHECK(stats.transactions <= 3 * 5 + 8);
+	printf("sprites: %u transactions for %u icons\n", stats.transactions, n);
+
+	/* Transparent sprites in the framebuffer: background pixels are kept */
+	CHECK(ILI9341FramebufferInit(0));
+	ILI9341Fill(ILI9341_NAVY);
+	ILI9341Flush();
+	CheckSpi(&stats);
+	memcpy(reference, LcdEmuScreen(), sizeof(reference));
+	sprites[0] = (ili9341_sprite_t){40, 40, ICON_CLOUD, &icon_89_rle, ILI9341_RED, ILI9341_BLACK, true};
+	sprites[1] = (ili9341_sprite_t){60, 60, ICON_SUN, &icon_59, ILI9341_GREEN, ILI9341_BLACK, true};
+	sprites[2] = (ili9341_sprite_t){150, 40, ICON_HEART, &icon_30_rle, ILI9341_RED, ILI9341_WHITE, false};
+	for(uint8_t i = 0; i < 3; i++){
+		ExpectIcon(&sprites[i], RawIconFont(sprites[i].icon_font));
+	}
+	ILI9341DrawSprites(sprites, 3);
+	MockSpiStats(0, &stats, false);
+	CHECK(stats.transactions == 0);
+	ILI9341Flush();
+	CheckSpi(&stats);
+	CHECK(SameAsReference());
+	ILI9341FramebufferDeInit();
+}
+
+/* Strip chart: one column and a scroll per sample, fixed columns kept */
+static void TestChart(void){
+	ili9341_chart_config_t config = {.fixed_left = 20, .fixed_right = 0, .num_traces = 2, 
+		.colors = {ILI9341_RED, ILI9341_GREEN}, .background = ILI9341_BLACK, .grid_color = ILI9341_DARKGREY, 
+		.grid_x = 50, .grid_y = 40, .min = 0, .max = 100, .autoscale = true};
+	mock_spi_stats_t stats;
+	uint16_t start, area[3];
+	int32_t samples[2], min, max;
+
+	CHECK(ILI9341ChartInit(&config));
+	LcdEmuScroll(&start, area);
+	CHECK(area[0] == 20 && area[1] == 300 && area[2] == 0 && start == 20);
+	ILI9341DrawFilledRectangle(0, 0, 19, ILI9341_WIDTH - 1, ILI9341_ORANGE);
+	CheckSpi(&stats);
+
+	/* Square wave and a ramp that jumps out of range at sample 900 */
+	for(uint16_t i = 0; i < 1000; i++){
+		samples[0] = (i % 100 < 50) ? 90 : 10;
+		samples[1] = (i < 900) ? i % 100 : 150;
+		ILI9341ChartAdd(samples);
+	}
+	CheckSpi(&stats);
+	printf("chart: %.1f transactions %.1f bytes/sample, %.0f samples/s at 20 MHz\n", stats.transactions / 1000.0, 
+		stats.bytes / 1000.0, (double)SPI_BITRATE / 8 / (stats.bytes / 1000.0));
+	CHECK(stats.transactions <= 1000 * 6);
+	CHECK((double)SPI_BITRATE / 8 / (stats.bytes / 1000.0) >= 1000);
+	/* Sample 999 is on column 20 + 999 % 300, the newest column is shown on the right */
+	LcdEmuScroll(&start, area);
+	CHECK(start == 20 + 1000 % 300);
+	ILI9341ChartGetRange(&min, &max);
+	CHECK(min == 0 && max == 150 + 100 / 8);
+	CHECK(LcdEmuPixel(119, ILI9341_WIDTH - 1 - 10 * (ILI9341_WIDTH - 1) / max) == ILI9341_RED);
+	CHECK(LcdEmuPixel(119, ILI9341_WIDTH - 1 - 150 * (ILI9341_WIDTH - 1) / max) == ILI9341_GREEN);
+	/* Sample 950 starts from the vertical grid column, 951 from the horizontal lines one */
+	CHECK(LcdEmuPixel(20 + 950 % 300, 100) == ILI9341_DARKGREY);
+	CHECK(LcdEmuPixel(20 + 951 % 300, 100) == ILI9341_BLACK);
+	CHECK(LcdEmuPixel(20 + 951 % 300, ILI9341_WIDTH - 1 - 40) == ILI9341_DARKGREY);
+	CHECK(LcdEmuPixel(5, 100) == ILI9341_ORANGE);
+
+	ILI9341ChartDeInit();
+	LcdEmuScroll(&start, area);
+	CHECK(area[0] == 0 && area[1] == 320 && area[2] == 0 && start == 0);
+	CheckSpi(&stats);
+
+	/* Out of memory for the second column: nothing is kept, the next init allocates every buffer */
+	mock_heap_allocs_left = 3;
+	CHECK(!ILI9341ChartInit(&config));
+	mock_heap_allocs_left = -1;
+	ILI9341ChartAdd(samples);
+	CheckSpi(&stats);
+	CHECK(stats.transactions == 0);
+
+	/* Full int32_t range: the scale is computed without wrapping */
+	config.min = -2000000000;
+	config.max = 2000000000;
+	config.autoscale = false;
+	CHECK(ILI9341ChartInit(&config));
+	samples[0] = 1500000000;
+	samples[1] = -1500000000;
+	ILI9341ChartAdd(samples);
+	ILI9341ChartAdd(samples);
+	CheckSpi(&stats);
+	CHECK(LcdEmuPixel(21, ILI9341_WIDTH - 1 - (int64_t)3500000000 * (ILI9341_WIDTH - 1) / 4000000000) == ILI9341_RED);
+	CHECK(LcdEmuPixel(21, ILI9341_WIDTH - 1 - (int64_t)500000000 * (ILI9341_WIDTH - 1) / 4000000000) == ILI9341_GREEN);
+	/* Autoscale near the limits saturates */
+	config.autoscale = true;
+	CHECK(ILI9341ChartInit(&config));
+	samples[0] = INT32_MAX;
+	samples[1] = INT32_MIN;
+	ILI9341ChartAdd(samples);
+	ILI9341ChartGetRange(&min, &max);
+	CHECK(min == INT32_MIN && max == INT32_MAX);
+	ILI9341ChartDeInit();
+	CheckSpi(&stats);
+	ILI9341Rotate(ILI9341_Portrait_1);
+}
+
+/* Window cache: address set commands are only sent when the window changes */
+static void TestWindowCache(void){
+	mock_spi_stats_t stats;
+	lcd_emu_stats_t emu;
+	bool lit = false;
+
+	for(uint8_t cached = 0; cached < 2; cached++){
+		ILI9341GlyphCacheInit(cached ? 16384 : 0);
+		SceneText();
+		MockSpiStats(0, &stats, false);
+		LcdEmuStats(&emu, false);
+		CheckSpi(&stats);
+		CheckGolden(cached ? "text_cached" : "text", GOLDEN_TEXT);
+		printf("text screen%s: %5u transactions, %4u address sets\n", cached ? " (glyph cache)" : "", 
+			stats.transactions, emu.address_sets);
+	}
+	ILI9341GlyphCacheInit(0);
+
+	/* Characters on the same line share the pages: one page address set */
+	ILI9341DrawString(0, 0, "ABCDEFGH", &font_22, ILI9341_WHITE, ILI9341_BLACK);
+	LcdEmuStats(&emu, false);
+	CheckSpi(&stats);
+	CHECK(emu.address_sets <= 8 + 1);
+	/* Same window: none */
+	ILI9341DrawPixel(5, 5, ILI9341_RED);
+	CheckSpi(&stats);
+	ILI9341DrawPixel(5, 5, ILI9341_BLUE);
+	LcdEmuStats(&emu, false);
+	CheckSpi(&stats);
+	CHECK(emu.address_sets == 0 && LcdEmuPixel(5, 5) == ILI9341_BLUE);
+	/* Rotation invalidates the window */
+	ILI9341Rotate(ILI9341_Landscape_1);
+	CheckSpi(&stats);
+	ILI9341DrawPixel(5, 5, ILI9341_GREEN);
+	LcdEmuStats(&emu, false);
+	CheckSpi(&stats);
+	CHECK(emu.address_sets == 2);
+	/* Landscape text reaches the columns past the portrait width */
+	ILI9341Fill(ILI9341_BLACK);
+	ILI9341DrawString(200, 0, "Landscape", &font_22, ILI9341_WHITE, ILI9341_BLACK);
+	CheckSpi(&stats);
+	for(uint16_t x = ILI9341_WIDTH; x < ILI9341_HEIGHT; x++){
+		for(uint16_t y = 0; y < 22; y++){
+			lit |= (LcdEmuPixel(x, y) == ILI9341_WHITE);
+		}
+	}
+	CHECK(lit);
+	ILI9341Rotate(ILI9341_Portrait_1);
+}
+
+/* Frames per second of full screen fills and pictures */
+static void BenchFrames(const char *name, bool picture_frame){
+	static uint8_t frame[ILI9341_WIDTH * ILI9341_HEIGHT * 2];
+	mock_spi_stats_t stats;
+	int64_t start;
+
+	memcpy(frame, picture, sizeof(picture));
+	MockSpiStats(0, &stats, true);
+	start = NowUs();
+	for(uint8_t i = 0; i < BENCH_FRAMES; i++){
+		if(picture_frame){
+			ILI9341DrawPicture(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, frame);
+		}else{
+			ILI9341Fill((i & 1) ? ILI9341_WHITE : ILI9341_BLACK);
+		}
+	}
+	start = NowUs() - start;
+	CheckSpi(&stats);
+	printf("%-16s %6u bytes %3u transactions/frame, %5.1f fps at 20 MHz, %6.1f us/frame on host\n", name,
+		stats.bytes / BENCH_FRAMES, stats.transactions / BENCH_FRAMES,
+		(double)SPI_BITRATE / 8 / (stats.bytes / BENCH_FRAMES), (double)start / BENCH_FRAMES);
+}
+
+int main(void){
+	mock_spi_stats_t stats;
+
+	for(uint32_t i = 0; i < sizeof(picture); i++){
+		picture[i] = i * 7 + i / 200;
+	}
+	LcdEmuInit(0, LCD_DC);
+	CHECK(ILI9341Init(SPI_1, LCD_DC, LCD_RST));
+	CheckSpi(&stats);
+
+	TestFill();
+	TestPictures();
+	TestFramebuffer();
+	TestLines();
+	TestRender();
+	TestGlyphCache();
+	TestCompressed();
+	TestIcons();
+	TestChart();
+	TestWindowCache();
+	BenchFrames("fill", false);
+	mock_dma_capable = false;
+	BenchFrames("picture (flash)", true);
+	mock_dma_capable = true;
+	BenchFrames("picture (RAM)", true);
+	TEST_END();
+}
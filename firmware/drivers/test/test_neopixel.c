@@ -0,0 +1,216 @@
+/**
+ * @file test_neopixel.c
+ * @brief NeoPixel stripe frames (brightness, gamma, wire order), encoding time and animation effects.
+ *
+ * Frames are taken from the RMT mock payload. Encoding is measured without running
+ * the RMT encoder (mock_rmt_encode = false). Effects are computed at given times with
+ * NeoPixelAnimUpdate(), and by the animation task woken up by the timer alarms.
+ */
+#include <string.h>
+#include <time.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "neopixel_stripe.h"
+#include "ws2812b.h"
+
+#define LEDS			1000
+#define BENCH_FRAMES	2000
+#define LED_BIT_NS		1250	/* WS2812B bit period */
+#define ANIM_LEDS		30
+#define ANIM_FPS		50
+#define LED(i)			anim_colors[((i) + NeoPixelOffset()) % ANIM_LEDS]
+
+static neopixel_color_t colors[LEDS];
+static neopixel_color_t other[LEDS];
+static neopixel_color_t anim_colors[ANIM_LEDS];
+
+static neopixel_color_t PixelFunc(uint16_t pixel, uint32_t time, void *param){
+	return (pixel * 10 + time / 100) & 0xFF;
+}
+
+static int64_t NowNs(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Last frame equals the colors (LED i shows color_array[(i + offset) % LEDS]), scaled and gamma corrected */
+static bool SameFrame(const neopixel_color_t *color_array, uint16_t offset, uint8_t bright){
+	const uint8_t *frame;
+	neopixel_color_t color;
+
+	if(MockRmtPayload(&frame) != LEDS * 3){
+		return false;
+	}
+	for(uint16_t i = 0; i < LEDS; i++){
+		color = color_array[(i + offset) % LEDS];
+		if(frame[i * 3] != ws2812bGammaCorrection((((color >> 8) & 0xFF) * bright) >> 8) ||
+			frame[i * 3 + 1] != ws2812bGammaCorrection((((color >> 16) & 0xFF) * bright) >> 8) ||
+			frame[i * 3 + 2] != ws2812bGammaCorrection(((color & 0xFF) * bright) >> 8)){
+			return false;
+		}
+	}
+	return true;
+}
+
+static void TestFrames(void){
+	const uint8_t *frame;
+	bool off = true;
+
+	for(uint16_t i = 0; i < LEDS; i++){
+		colors[i] = NeoPixelHSV2Color(i * 65, 200, 255);
+		other[i] = NeoPixelRgb2Color(i, 255 - i, i * 3);
+	}
+	NeoPixelSetArray(colors);
+	CHECK(SameFrame(colors, 0, 255));
+	NeoPixelBrightness(100);
+	CHECK(SameFrame(colors, 0, 100));
+	NeoPixelSetArray(other);
+	CHECK(SameFrame(other, 0, 100));
+	NeoPixelBrightness(0);
+	CHECK(SameFrame(colors, 0, 0));
+	NeoPixelBrightness(255);
+	NeoPixelShift(true);
+	NeoPixelShift(true);
+	NeoPixelShift(false);
+	CHECK(SameFrame(colors, LEDS - 1, 255));
+	NeoPixelShift(false);
+	NeoPixelAllOff();
+	CHECK(MockRmtPayload(&frame) == LEDS * 3);
+	for(uint16_t i = 0; i < LEDS * 3; i++){
+		off &= (frame[i] == 0);
+	}
+	CHECK(off);
+}
+
+/* Encoding time of a frame, with the lookup table and LED by LED as ws2812bSend() does */
+static void Bench(void){
+	int64_t start, table_ns, send_ns;
+
+	mock_rmt_encode = false;
+	NeoPixelBrightness(100);
+	start = NowNs();
+	for(uint16_t k = 0; k < BENCH_FRAMES; k++){
+		NeoPixelSetArray(colors);
+	}
+	table_ns = (NowNs() - start) / BENCH_FRAMES;
+	start = NowNs();
+	for(uint16_t k = 0; k < BENCH_FRAMES; k++){
+		for(uint16_t i = 0; i < LEDS; i++){
+			rgb_led_t led = {.green = (((colors[i] >> 8) & 0xFF) * 100) >> 8,
+				.red = (((colors[i] >> 16) & 0xFF) * 100) >> 8, .blue = ((colors[i] & 0xFF) * 100) >> 8};
+			ws2812bSend(led);
+		}
+		ws2812bSendRet();
+	}
+	send_ns = (NowNs() - start) / BENCH_FRAMES;
+	mock_rmt_encode = true;
+	printf("%u LEDs: %.1f us/frame encoded, %.1f us/frame LED by LED, %.1f ms on the wire\n", LEDS,
+		table_ns / 1000.0, send_ns / 1000.0, LEDS * 24.0 * LED_BIT_NS / 1000000);
+	NeoPixelBrightness(255);
+}
+
+/* Effects at given times: colors only depend on the time */
+static void TestEffects(void){
+	const neopixel_keyframe_t keyframes[] = {{0, 0x0000FF}, {500, 0xFFFFFF}, {1000, 0x000000}};
+	neopixel_anim_t fade = {.type = NEOPIXEL_ANIM_FADE, .first = 0, .count = 5, .period_ms = 1000, 
+		.color = 0x000000, .color2 = 0xFF0000};
+	neopixel_anim_t chase = {.type = NEOPIXEL_ANIM_CHASE, .first = 5, .count = 10, .period_ms = 100, 
+		.color = 0x00FF00, .color2 = 0x000010, .size = 3};
+	neopixel_anim_t key = {.type = NEOPIXEL_ANIM_KEYFRAMES, .first = 15, .count = 5, .keyframes = keyframes, 
+		.num_keyframes = 3, .loop = true};
+	neopixel_anim_t rainbow = {.type = NEOPIXEL_ANIM_RAINBOW, .first = 20, .count = 6, .period_ms = 3000, .size = 1};
+	neopixel_anim_t pixel = {.type = NEOPIXEL_ANIM_PIXEL, .first = 26, .count = 4, .pixel_func = PixelFunc};
+	bool chased = true;
+
+	NeoPixelAllColor(0);
+	NeoPixelAnimUpdate(0);
+	CHECK(NeoPixelAnimAdd(&fade) == 0);
+	CHECK(NeoPixelAnimAdd(&chase) == 1);
+	CHECK(NeoPixelAnimAdd(&key) == 2);
+	CHECK(NeoPixelAnimAdd(&rainbow) == 3);
+	CHECK(NeoPixelAnimAdd(&pixel) == -1);
+
+	CHECK(NeoPixelAnimUpdate(0));
+	CHECK(LED(0) == 0x000000 && LED(15) == 0x0000FF && LED(5) == 0x00FF00 && LED(8) == 0x000010);
+	CHECK(LED(20) == NeoPixelHSV2Color(0, 255, 255));
+	/* Nothing changes within one step */
+	CHECK(!NeoPixelAnimUpdate(1));
+	NeoPixelAnimUpdate(500);
+	CHECK(LED(4) == 0x7F0000 && LED(15) == 0xFFFFFF);
+	/* Chase step 5: block of 3 LEDs from the sixth one of the range */
+	for(uint8_t i = 0; i < 10; i++){
+		chased &= (LED(5 + i) == ((i >= 5 && i < 8) ? 0x00FF00 : 0x000010));
+	}
+	CHECK(chased);
+	/* Fade ends on color2, keyframes loop */
+	NeoPixelAnimUpdate(1250);
+	CHECK(LED(0) == 0xFF0000 && LED(15) == 0x7F7FFF);
+	for(uint8_t i = 0; i < 4; i++){
+		NeoPixelAnimRemove(i);
+	}
+	CHECK(!NeoPixelAnimUpdate(3000));
+
+	/* Effects start when they are added */
+	CHECK(NeoPixelAnimAdd(&pixel) == 0);
+	NeoPixelAnimUpdate(3000);
+	CHECK(LED(27) == 10);
+	NeoPixelAnimUpdate(3500);
+	CHECK(LED(27) == 15);
+	NeoPixelAnimRemove(0);
+}
+
+/* Effects sent by the animation task: a frame only when something changed, a time that doesn't wrap */
+static void TestTask(void){
+	neopixel_anim_t fade = {.type = NEOPIXEL_ANIM_FADE, .first = 0, .count = ANIM_LEDS, .period_ms = 4400000, 
+		.color = 0x000000, .color2 = 0x0000FF};
+	mock_rmt_stats_t stats;
+	const uint8_t *frame;
+	uint32_t ticks = 0, frames = 0;
+
+	CHECK(NeoPixelAnimAdd(&fade) == 0);
+	NeoPixelAnimStart(TIMER_A, ANIM_FPS);
+	MockRmtStats(&stats, true);
+	/* The first frame sends the current colors, the next one has no changes */
+	for(uint8_t i = 0; i < 2; i++){
+		CHECK(MockGptimerAlarm(0) && MockTaskRun("neopixel_anim"));
+		ticks++;
+		MockRmtStats(&stats, true);
+		CHECK(stats.transmissions == (i == 0));
+	}
+	/* Colors set while the task runs are sent on the next frame */
+	NeoPixelSetPixel(0, 0xFF0000);
+	MockRmtStats(&stats, true);
+	CHECK(stats.transmissions == 0);
+	MockGptimerAlarm(0);
+	MockTaskRun("neopixel_anim");
+	ticks++;
+	MockRmtStats(&stats, true);
+	CHECK(stats.transmissions == 1);
+	CHECK(MockRmtPayload(&frame) == ANIM_LEDS * 3 && frame[1] == ws2812bGammaCorrection((0xFF * 255) >> 8));
+
+	/* Past 2^32 us of animation (71.6 minutes) */
+	while(ticks < 4300000 / (1000 / ANIM_FPS)){
+		MockGptimerAlarm(0);
+		MockTaskRun("neopixel_anim");
+		ticks++;
+	}
+	MockRmtStats(&stats, true);
+	frames = stats.transmissions;
+	CHECK(frames > 0 && frames < 256);
+	CHECK((LED(5) & 0xFF) == 255 * ticks * (1000 / ANIM_FPS) / 4400000);
+	printf("animation: %u frames sent in %u ticks\n", frames, ticks);
+	NeoPixelAnimStop();
+	NeoPixelAnimRemove(0);
+}
+
+int main(void){
+	NeoPixelInit(GPIO_8, LEDS, colors);
+	TestFrames();
+	Bench();
+	NeoPixelInit(GPIO_8, ANIM_LEDS, anim_colors);
+	TestEffects();
+	TestTask();
+	TEST_END();
+}
@@ -0,0 +1,154 @@
+/**
+ * @file test_rle.c
+ * @brief Run length decoders of the ILI9341 driver against the output of tools/bitmap_rle.py.
+ *
+ * fonts_rle.c and icons_rle.c are the converter output committed with the driver,
+ * pic_rle.c is generated from esp_edu_pic.c when the test is built. Every bitmap is
+ * decoded in chunks of random length (as the driver streams them to the LCD) and
+ * compared with the uncompressed data. Decoding throughput is printed.
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test_check.h"
+#include "fonts.h"
+#include "icons.h"
+
+#define MAX_PIXELS		(240 * 320)
+#define CHUNK_MAX		300
+#define FOREGROUND		0xF81F
+#define BACKGROUND		0x07E0
+
+/* Decoder state and decoders of ili9341.c (internal functions, same layout as the driver) */
+typedef struct {
+	const uint8_t *src;
+	uint32_t run;
+	bool flag;
+} rle_state_t;
+void RleExpandBits(rle_state_t *rle, uint8_t *dst, uint32_t pixels, uint16_t foreground, uint16_t background);
+void RleExpandPixels(rle_state_t *rle, uint8_t *dst, uint32_t pixels);
+
+extern const uint8_t picture[];
+extern const uint8_t picture_rle[];
+
+static uint8_t expected[MAX_PIXELS * 2];
+static uint8_t decoded[MAX_PIXELS * 2];
+
+static int64_t NowNs(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Uncompressed 1 bit/pixel bitmap (rows start on a new byte) to RGB565 */
+static void ExpandRaw(const uint8_t *src, uint16_t width, uint16_t height){
+	uint8_t *dst = expected;
+
+	for(uint16_t i = 0; i < height; i++){
+		for(uint16_t j = 0; j < width; j++){
+			uint16_t color = (src[j / 8] & (0x80 >> (j % 8))) ? FOREGROUND : BACKGROUND;
+			*dst++ = color >> 8;
+			*dst++ = color & 0xFF;
+		}
+		src += (width + 7) / 8;
+	}
+}
+
+/* Decode in random chunks: runs continue from one call to the next */
+static bool DecodeBits(const uint8_t *src, uint32_t pixels){
+	rle_state_t rle = {src, 0, true};
+	uint32_t done = 0, chunk;
+
+	while(done < pixels){
+		chunk = 1 + rand() % CHUNK_MAX;
+		chunk = (chunk > pixels - done) ? pixels - done : chunk;
+		RleExpandBits(&rle, decoded + done * 2, chunk, FOREGROUND, BACKGROUND);
+		done += chunk;
+	}
+	return memcmp(decoded, expected, pixels * 2) == 0;
+}
+
+static void TestFonts(void){
+	Font_t *raw[] = {&font_22, &font_30, &font_59, &font_89};
+	Font_t *rle[] = {&font_22_rle, &font_30_rle, &font_59_rle, &font_89_rle};
+
+	for(uint8_t f = 0; f < sizeof(raw) / sizeof(raw[0]); f++){
+		bool same = true;
+		CHECK(rle[f]->compressed && !raw[f]->compressed);
+		for(char c = ' '; c <= '~'; c++){
+			const char_info_t *info = &raw[f]->info[c - ' '];
+			CHECK(rle[f]->info[c - ' '].width == info->width);
+			ExpandRaw(raw[f]->data + info->offset, info->width, raw[f]->font_height);
+			same &= DecodeBits(rle[f]->data + rle[f]->info[c - ' '].offset, info->width * raw[f]->font_height);
+		}
+		CHECK(same);
+	}
+}
+
+static void TestIcons(void){
+	icon_font_t *raw[] = {&icon_30, &icon_59, &icon_89};
+	icon_font_t *rle[] = {&icon_30_rle, &icon_59_rle, &icon_89_rle};
+
+	for(uint8_t f = 0; f < sizeof(raw) / sizeof(raw[0]); f++){
+		bool same = true;
+		CHECK(rle[f]->width == raw[f]->width && rle[f]->height == raw[f]->height);
+		for(uint8_t i = 0; i <= ICON_RAIN; i++){
+			ExpandRaw(raw[f]->data + i * raw[f]->offset, raw[f]->width, raw[f]->height);
+			same &= DecodeBits(rle[f]->data + rle[f]->rle_offset[i], raw[f]->width * raw[f]->height);
+		}
+		CHECK(same);
+	}
+}
+
+static void TestPicture(void){
+	rle_state_t rle = {picture_rle, 0, false};
+	uint32_t done = 0, chunk;
+
+	while(done < MAX_PIXELS){
+		chunk = 1 + rand() % CHUNK_MAX;
+		chunk = (chunk > MAX_PIXELS - done) ? MAX_PIXELS - done : chunk;
+		RleExpandPixels(&rle, decoded + done * 2, chunk);
+		done += chunk;
+	}
+	CHECK(memcmp(decoded, picture, MAX_PIXELS * 2) == 0);
+}
+
+/* Mpixel/s decoding whole bitmaps in DMA chunk sized pieces (2046 pixels) */
+static void Bench(void){
+	const uint16_t chunk = 2046;
+	const uint8_t frames = 20;
+	rle_state_t rle;
+	uint32_t pixels = 0;
+	int64_t start;
+
+	start = NowNs();
+	for(uint8_t k = 0; k < frames; k++){
+		rle = (rle_state_t){picture_rle, 0, false};
+		for(uint32_t done = 0; done < MAX_PIXELS; done += chunk){
+			RleExpandPixels(&rle, decoded, (MAX_PIXELS - done < chunk) ? MAX_PIXELS - done : chunk);
+		}
+	}
+	printf("picture: %.1f Mpixel/s\n", (double)frames * MAX_PIXELS * 1000 / (NowNs() - start));
+
+	start = NowNs();
+	for(uint8_t k = 0; k < frames; k++){
+		for(char c = ' '; c <= '~'; c++){
+			uint32_t n = font_89.info[c - ' '].width * font_89.font_height;
+			rle = (rle_state_t){font_89_rle.data + font_89_rle.info[c - ' '].offset, 0, true};
+			RleExpandBits(&rle, decoded, n, FOREGROUND, BACKGROUND);
+			pixels += n;
+		}
+	}
+	printf("font_89: %.1f Mpixel/s\n", (double)pixels * 1000 / (NowNs() - start));
+}
+
+int main(void){
+	srand(18);
+	TestFonts();
+	TestIcons();
+	TestPicture();
+	Bench();
+	TEST_END();
+}
@@ -0,0 +1,299 @@
+/**
+ * @file test_shell.c
+ * @brief Shell perfect hash with a full command table, dispatch, argument parsing,
+ * and a script driven harness.
+ *
+ * With a script argument ("-" for stdin) the script lines are sent to the shell
+ * through the UART line receiver, and its output is checked:
+ *   > line		command line sent to the shell
+ *   text		next output line expected (without "\r\n")
+ *   # text		comment
+ * Every output line must be expected. The lines are also printed as they run.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "shell.h"
+
+#define USER_CMDS	(SHELL_MAX_CMDS - 5)	/* 5 built-in commands */
+#define TABLES		1000
+#define BENCH_LINES	200000
+
+static shell_cmd_t commands[USER_CMDS];
+static char names[USER_CMDS][12];
+static int called;
+
+static void Cmd(uint8_t argc, char *argv[], void *param){
+	called = (int)(intptr_t)param;
+}
+
+/* Builds a table of USER_CMDS distinct random names, 1 to 10 letters */
+static void RandomTable(void){
+	for(uint8_t i = 0; i < USER_CMDS; i++){
+		bool unique;
+		do{
+			uint8_t len = 1 + rand() % 10;
+			for(uint8_t j = 0; j < len; j++){
+				names[i][j] = 'a' + rand() % 26;
+			}
+			names[i][len] = '\0';
+			unique = strcmp(names[i], "help") && strcmp(names[i], "tasks") && strcmp(names[i], "jitter") 
+				&& strcmp(names[i], "adc") && strcmp(names[i], "heap");
+			for(uint8_t j = 0; j < i; j++){
+				unique &= (strcmp(names[i], names[j]) != 0);
+			}
+		}while(!unique);
+		commands[i] = (shell_cmd_t){names[i], names[i], Cmd, (void*)(intptr_t)i};
+	}
+}
+
+static bool Dispatch(void){
+	char line[32];
+	bool ok = true;
+
+	for(uint8_t i = 0; i < USER_CMDS; i++){
+		called = -1;
+		strcpy(line, names[i]);
+		strcat(line, " 1 2");
+		ShellExecute(line);
+		ok &= (called == i);
+	}
+	return ok;
+}
+
+static int64_t NowNs(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void TestParseInt(void){
+	static const struct {
+		const char *arg;
+		bool ok;
+		int32_t value;
+	} cases[] = {
+		{"0", true, 0}, {"-0", true, 0}, {"+17", true, 17}, {"-17", true, -17},
+		{"2147483647", true, INT32_MAX}, {"-2147483648", true, INT32_MIN},
+		{"2147483648", false, 0}, {"-2147483649", false, 0}, {"99999999999", false, 0},
+		{"0x1f", true, 31}, {"0XAbC", true, 0xABC}, {"-0x10", true, -16},
+		{"0x7FFFFFFF", true, INT32_MAX}, {"0xFFFFFFFF", true, -1}, {"0x000000001", true, 1},
+		{"0x100000000", false, 0}, {"0x1FFFFFFFF", false, 0},
+		{"", false, 0}, {"-", false, 0}, {"0x", false, 0}, {"12a", false, 0}, {"0xg", false, 0},
+		{" 1", false, 0}, {"1.5", false, 0},
+	};
+
+	for(uint8_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++){
+		int32_t value = 12345;
+		bool ok = ShellParseInt(cases[i].arg, &value);
+		if(ok != cases[i].ok || (ok && value != cases[i].value) || (!ok && value != 12345)){
+			printf("  ShellParseInt(\"%s\"): %d %d\n", cases[i].arg, ok, (int)value);
+			CHECK(false);
+		}
+	}
+}
+
+static void TestParseFloat(void){
+	static const struct {
+		const char *arg;
+		bool ok;
+		float value;
+	} cases[] = {
+		{"0", true, 0}, {"12.5", true, 12.5f}, {"-12.5", true, -12.5f}, {"+.25", true, 0.25f},
+		{"3.", true, 3}, {"-0.001", true, -0.001f}, {"1000000", true, 1e6f},
+		{"", false, 0}, {".", false, 0}, {"-", false, 0}, {"1e3", false, 0}, {"1.2.3", false, 0}, {"0x10", false, 0},
+	};
+
+	for(uint8_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++){
+		float value = 12345;
+		bool ok = ShellParseFloat(cases[i].arg, &value);
+		if(ok != cases[i].ok || (ok && fabsf(value - cases[i].value) > 1e-6f * (1 + fabsf(cases[i].value)))
+			|| (!ok && value != 12345)){
+			printf("  ShellParseFloat(\"%s\"): %d %f\n", cases[i].arg, ok, value);
+			CHECK(false);
+		}
+	}
+}
+
+/* Time of ShellExecute() with the full table, and of a linear strcmp() search of the command name */
+static void BenchDispatch(void){
+	char line[32];
+	int64_t start, execute_ns, linear_ns;
+	volatile int found = 0;
+
+	start = NowNs();
+	for(uint32_t n = 0; n < BENCH_LINES; n++){
+		strcpy(line, names[n % USER_CMDS]);
+		strcat(line, " 1 2");
+		ShellExecute(line);
+	}
+	execute_ns = NowNs() - start;
+	start = NowNs();
+	for(uint32_t n = 0; n < BENCH_LINES; n++){
+		strcpy(line, names[n % USER_CMDS]);
+		strcat(line, " 1 2");
+		line[strcspn(line, " ")] = '\0';
+		for(uint8_t i = 0; i < USER_CMDS; i++){
+			if(strcmp(commands[i].name, line) == 0){
+				found += i;
+				break;
+			}
+		}
+	}
+	linear_ns = NowNs() - start;
+	printf("%u commands: %.1f ns/line ShellExecute (tokenize + hash), %.1f ns/line linear search of the %u user names\n",
+		SHELL_MAX_CMDS, (double)execute_ns / BENCH_LINES, (double)linear_ns / BENCH_LINES, USER_CMDS);
+}
+
+/* Script commands: argument echo and typed parsing */
+static void CmdEcho(uint8_t argc, char *argv[], void *param){
+	ShellPrint("%u", argc);
+	for(uint8_t i = 0; i < argc; i++){
+		ShellPrint(" [%s]", argv[i]);
+	}
+	ShellPrint("\r\n");
+}
+
+static void CmdInt(uint8_t argc, char *argv[], void *param){
+	int32_t value;
+
+	ShellPrint("%u", argc - 1);
+	for(uint8_t i = 1; i < argc; i++){
+		if(ShellParseInt(argv[i], &value)){
+			ShellPrint(" %d", value);
+		}else{
+			ShellPrint(" err");
+		}
+	}
+	ShellPrint("\r\n");
+}
+
+static void CmdFloat(uint8_t argc, char *argv[], void *param){
+	float value;
+
+	ShellPrint("%u", argc - 1);
+	for(uint8_t i = 1; i < argc; i++){
+		if(ShellParseFloat(argv[i], &value)){
+			ShellPrint(" %.3f", value);
+		}else{
+			ShellPrint(" err");
+		}
+	}
+	ShellPrint("\r\n");
+}
+
+/* Runs a script (see the file header), returns the number of lines that failed */
+static uint32_t RunScript(FILE *script){
+	static const shell_cmd_t script_cmds[] = {
+		{"echo", "echo <args>: arguments, one per bracket", CmdEcho, NULL},
+		{"int", "int <args>: ShellParseInt() of each argument", CmdInt, NULL},
+		{"float", "float <args>: ShellParseFloat() of each argument", CmdFloat, NULL},
+	};
+	shell_config_t config = {UART_PC, 115200, script_cmds, sizeof(script_cmds) / sizeof(shell_cmd_t)};
+	static char out[4096];
+	char line[UART_RX_MSG_MAX + 8];
+	char *next = out;
+	uint32_t failed = 0, number = 0;
+
+	if(!ShellInit(&config)){
+		return 1;
+	}
+	/* The event task installs the UART driver */
+	MockTaskRun("uart_pc_event_task");
+	MockUartSent(0, (uint8_t*)out, sizeof(out));
+	out[0] = '\0';
+	while(fgets(line, sizeof(line), script) != NULL){
+		number++;
+		line[strcspn(line, "\r\n")] = '\0';
+		if(line[0] == '#' || line[0] == '\0'){
+			continue;
+		}
+		printf("%s\n", line);
+		if(line[0] == '>'){
+			if(*next != '\0'){
+				printf("  line %u: unexpected output \"%s\"\n", number, next);
+				failed++;
+			}
+			strcat(line, "\n");
+			MockUartReceive(0, (const uint8_t*)line + 2, strlen(line + 2), UART_DATA);
+			MockTaskRun("uart_pc_event_task");
+			out[MockUartSent(0, (uint8_t*)out, sizeof(out) - 1)] = '\0';
+			next = out;
+		}else{
+			char *end = strstr(next, "\r\n");
+			size_t len = (end != NULL) ? (size_t)(end - next) : strlen(next);
+			if(len != strlen(line) || strncmp(next, line, len) != 0){
+				printf("  line %u: got \"%.*s\"\n", number, (int)len, next);
+				failed++;
+			}
+			next += (end != NULL) ? len + 2 : len;
+		}
+	}
+	if(*next != '\0'){
+		printf("  end: unexpected output \"%s\"\n", next);
+		failed++;
+	}
+	return failed;
+}
+
+int main(int argc, char *argv[]){
+	shell_config_t config = {UART_PC, 115200, commands, USER_CMDS};
+	uint8_t out[256];
+	uint16_t built = 0, dispatched = 0;
+
+	/* Similar names: cmd0 ... cmd26 */
+	for(uint8_t i = 0; i < USER_CMDS; i++){
+		sprintf(names[i], "cmd%u", i);
+		commands[i] = (shell_cmd_t){names[i], names[i], Cmd, (void*)(intptr_t)i};
+	}
+	CHECK(ShellInit(&config));
+	CHECK(Dispatch());
+
+	srand(12);
+	for(uint16_t t = 0; t < TABLES; t++){
+		RandomTable();
+		if(ShellInit(&config)){
+			built++;
+			dispatched += Dispatch();
+		}
+	}
+	printf("%u of %u full random tables hashed\n", built, TABLES);
+	CHECK(built == TABLES);
+	CHECK(dispatched == TABLES);
+
+	/* Duplicated names can't be hashed */
+	commands[1].name = commands[0].name;
+	CHECK(!ShellInit(&config));
+	commands[1].name = names[1];
+	CHECK(ShellInit(&config));
+
+	MockUartSent(0, out, sizeof(out));
+	strcpy((char*)out, "nosuchcommand");
+	called = -1;
+	ShellExecute((char*)out);
+	CHECK(called == -1);
+	memset(out, 0, sizeof(out));
+	MockUartSent(0, out, sizeof(out) - 1);
+	CHECK(strcmp((char*)out, "nosuchcommand: unknown command (try help)\r\n") == 0);
+	BenchDispatch();
+
+	/* More commands than the table holds */
+	config.num_commands = USER_CMDS + 1;
+	CHECK(!ShellInit(&config));
+
+	TestParseInt();
+	TestParseFloat();
+	if(argc == 2){
+		FILE *script = (strcmp(argv[1], "-") == 0) ? stdin : fopen(argv[1], "r");
+		CHECK(script != NULL);
+		if(script != NULL){
+			CHECK(RunScript(script) == 0);
+		}
+	}
+	TEST_END();
+}
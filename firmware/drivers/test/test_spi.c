@@ -0,0 +1,70 @@
+/**
+ * @file test_spi.c
+ * @brief Queued SPI writes: ordering, pre-transaction values and rejected transactions.
+ */
+#include <string.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "spi_mcu.h"
+
+#define WRITES	20
+
+static uintptr_t users[64];
+static uint8_t users_num = 0;
+static uint32_t sunk = 0;
+
+static void Pre(void *user){
+	users[users_num++] = (uintptr_t)user;
+}
+
+static void Sink(const uint8_t *data, uint32_t len){
+	sunk += len;
+}
+
+int main(void){
+	static uint8_t big[5000];
+	spi_mcu_config_t config = {
+		.device = SPI_1,
+		.clk_mode = MODE0,
+		.bitrate = 40000000,
+		.transfer_mode = SPI_POLLING,
+		.func_p = NULL,
+		.param_p = NULL,
+		.pre_func_p = Pre,
+	};
+	mock_spi_stats_t stats;
+	uint32_t bytes = 0;
+
+	SpiInit(&config);
+	MockSpiSink(0, Sink);
+	/* More writes than SPI_QUEUE_SIZE: the oldest results are taken while queueing */
+	for(uint8_t i = 0; i < WRITES; i++){
+		CHECK(SpiQueueWrite(SPI_1, big, 1 + i * 37, (void*)(uintptr_t)i));
+		bytes += 1 + i * 37;
+	}
+	SpiQueueWait(SPI_1);
+	MockSpiStats(0, &stats, true);
+	CHECK(stats.transactions == WRITES);
+	CHECK(stats.bytes == bytes && sunk == bytes);
+	CHECK(stats.overflows == 0 && stats.hangs == 0);
+	CHECK(users_num == WRITES);
+	for(uint8_t i = 0; i < users_num; i++){
+		CHECK(users[i] == i);
+	}
+
+	/* Longer than the bus max_transfer_sz: rejected, and not waited for */
+	CHECK(SpiQueueWrite(SPI_1, big, 4092, NULL));
+	CHECK(!SpiQueueWrite(SPI_1, big, 4093, NULL));
+	CHECK(!SpiQueueWrite(SPI_1, big, sizeof(big), NULL));
+	SpiQueueWait(SPI_1);
+	MockSpiStats(0, &stats, true);
+	CHECK(stats.transactions == 1 && stats.rejected == 2);
+	CHECK(stats.hangs == 0);
+
+	/* Device not registered */
+	CHECK(!SpiQueueWrite(SPI_3, big, 4, NULL));
+	SpiQueueWait(SPI_3);
+	MockSpiStats(0, &stats, true);
+	CHECK(stats.hangs == 0);
+	TEST_END();
+}
@@ -0,0 +1,251 @@
+/**
+ * @file test_telemetry.c
+ * @brief Telemetry packets: CRC, COBS framing, zigzag/varint deltas and sequence numbers.
+ *
+ * With two arguments, also writes a capture of frames and the CSV the decoder
+ * (tools/telemetry_decoder.py) must print from it: test_telemetry_decoder.py
+ * checks the decoder against them.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "telemetry.h"
+
+#define VECTOR_CHANNELS	2
+#define VECTOR_SCANS	40
+#define VECTOR_PACKETS	12
+#define VECTOR_LOST		7		/* Packet packed but not written: one lost packet */
+#define VECTOR_BAD_CRC	9		/* Packet written with a sample corrupted after the CRC */
+
+static const uint8_t *GetVarint(const uint8_t *p, uint32_t *value){
+	uint8_t shift = 0;
+
+	*value = 0;
+	do{
+		*value |= (uint32_t)(*p & 0x7F) << shift;
+		shift += 7;
+	}while(*p++ & 0x80);
+	return p;
+}
+
+/* Decodes a frame (delimiter included) back to the samples, returns the number of samples or -1 */
+static int Unpack(const uint8_t *frame, uint16_t len, uint8_t *seq, uint32_t *timestamp, uint16_t *samples){
+	uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+	const uint8_t *p = payload;
+	uint32_t period, value;
+	uint8_t num_channels, scans;
+	uint16_t size;
+
+	if(len < 2 || frame[len - 1] != 0 || memchr(frame, 0, len - 1) != NULL){
+		return -1;
+	}
+	size = TelemetryCobsDecode(frame, len - 1, payload);
+	if(size < 3 || TelemetryCrc16(payload, size - 2) != (payload[size - 2] | (payload[size - 1] << 8))){
+		return -1;
+	}
+	if(*p++ != TELEMETRY_PKT_SAMPLES){
+		return -1;
+	}
+	*seq = *p++;
+	p = GetVarint(p, timestamp);
+	p = GetVarint(p, &period);
+	num_channels = *p++;
+	scans = *p++;
+	for(uint16_t i = 0; i < num_channels * scans; i++){
+		p = GetVarint(p, &value);
+		if(i < num_channels){
+			samples[i] = value;
+		}else{
+			/* Zigzag */
+			samples[i] = samples[i - num_channels] + (int32_t)((value >> 1) ^ -(value & 1));
+		}
+	}
+	return (p == payload + size - 2) ? num_channels * scans : -1;
+}
+
+static void TestCrc(void){
+	CHECK(TelemetryCrc16((const uint8_t*)"123456789", 9) == 0x29B1);
+	CHECK(TelemetryCrc16(NULL, 0) == 0xFFFF);
+}
+
+/* Non zero runs around the 254 byte COBS block */
+static void TestCobs(void){
+	static const uint16_t lens[] = {1, 2, 253, 254, 255, 256, 508, 509, 600};
+	uint8_t src[600], enc[610], dec[610];
+	uint16_t len;
+
+	for(uint16_t i = 0; i < sizeof(src); i++){
+		src[i] = 1 + i % 255;
+	}
+	for(uint8_t k = 0; k < sizeof(lens) / sizeof(lens[0]); k++){
+		len = TelemetryCobsEncode(src, lens[k], enc);
+		CHECK(len == lens[k] + lens[k] / 254 + 1);
+		CHECK(memchr(enc, 0, len) == NULL);
+		CHECK(TelemetryCobsDecode(enc, len, dec) == lens[k] && memcmp(dec, src, lens[k]) == 0);
+	}
+	/* Exactly 254 and 255 bytes: one full block, then an empty or a one byte block */
+	len = TelemetryCobsEncode(src, 254, enc);
+	CHECK(enc[0] == 0xFF && enc[255] == 0x01);
+	len = TelemetryCobsEncode(src, 255, enc);
+	CHECK(enc[0] == 0xFF && enc[255] == 0x02 && enc[256] == src[254]);
+
+	/* Zeros at the start, after a full block and at the end */
+	src[0] = 0;
+	src[255] = 0;
+	src[299] = 0;
+	len = TelemetryCobsEncode(src, 300, enc);
+	CHECK(memchr(enc, 0, len) == NULL);
+	CHECK(TelemetryCobsDecode(enc, len, dec) == 300 && memcmp(dec, src, 300) == 0);
+
+	/* Malformed: a block longer than the frame, a zero byte */
+	enc[0] = 5;
+	CHECK(TelemetryCobsDecode(enc, 4, dec) == 0);
+	enc[0] = 0;
+	CHECK(TelemetryCobsDecode(enc, 4, dec) == 0);
+}
+
+/* The packet bytes, for deltas of one and two varint bytes of both signs */
+static void TestPack(void){
+	telemetry_stream_t stream = {.port = UART_PC, .num_channels = 3, .sample_period = 1000, .seq = 0xFE};
+	const uint16_t samples[] = {0, 100, 2048, 4095, 100, 2112, 0, 99, 2048};
+	const uint8_t expected[] = {
+		TELEMETRY_PKT_SAMPLES, 0xFE,
+		0xAC, 0x02,						/* timestamp 300 */
+		0xE8, 0x07,						/* sample period 1000 */
+		3, 3,
+		0x00, 0x64, 0x80, 0x10,			/* 0, 100, 2048 */
+		0xFE, 0x3F, 0x00, 0x80, 0x01,	/* +4095, 0, +64 */
+		0xFD, 0x3F, 0x01, 0x7F,			/* -4095, -1, -64 */
+	};
+	uint8_t frame[TELEMETRY_MAX_FRAME], payload[TELEMETRY_MAX_PAYLOAD];
+	uint16_t decoded[TELEMETRY_MAX_SAMPLES];
+	uint32_t timestamp;
+	uint16_t len, size, crc;
+	uint8_t seq;
+
+	len = TelemetryPackSamples(&stream, samples, 3, 300, frame);
+	CHECK(len > 0 && frame[len - 1] == 0 && memchr(frame, 0, len - 1) == NULL);
+	size = TelemetryCobsDecode(frame, len - 1, payload);
+	CHECK(size == sizeof(expected) + 2 && memcmp(payload, expected, sizeof(expected)) == 0);
+	crc = TelemetryCrc16(expected, sizeof(expected));
+	CHECK(payload[size - 2] == (crc & 0xFF) && payload[size - 1] == (crc >> 8));
+	CHECK(Unpack(frame, len, &seq, &timestamp, decoded) == 9 && memcmp(decoded, samples, sizeof(samples)) == 0);
+
+	/* Sequence numbers wrap */
+	CHECK(stream.seq == 0xFF);
+	len = TelemetryPackSamples(&stream, samples, 1, 0, frame);
+	CHECK(Unpack(frame, len, &seq, &timestamp, decoded) == 3 && seq == 0xFF);
+	len = TelemetryPackSamples(&stream, samples, 1, 0, frame);
+	CHECK(Unpack(frame, len, &seq, &timestamp, decoded) == 3 && seq == 0x00);
+
+	/* Too many samples: nothing packed, the sequence number is not used */
+	CHECK(TelemetryPackSamples(&stream, samples, TELEMETRY_MAX_SAMPLES / 3 + 1, 0, frame) == 0);
+	CHECK(stream.seq == 1);
+
+	/* A corrupted byte fails the CRC */
+	len = TelemetryPackSamples(&stream, samples, 3, 300, frame);
+	frame[len - 4] ^= 0x01;
+	CHECK(Unpack(frame, len, &seq, &timestamp, decoded) == -1);
+}
+
+/* Full packets of random 12 bit samples, with the largest deltas */
+static void TestRoundTrip(void){
+	telemetry_stream_t stream = {.port = UART_PC, .num_channels = 4, .sample_period = 125, .seq = 0};
+	uint16_t samples[TELEMETRY_MAX_SAMPLES], decoded[TELEMETRY_MAX_SAMPLES];
+	uint8_t frame[TELEMETRY_MAX_FRAME];
+	uint32_t timestamp;
+	uint16_t len;
+	uint8_t seq;
+	bool ok = true;
+
+	srand(9);
+	for(uint16_t n = 0; n < 1000; n++){
+		for(uint8_t i = 0; i < TELEMETRY_MAX_SAMPLES; i++){
+			samples[i] = (n % 2) ? ((i / 4) % 2) * 0xFFF : rand() & 0xFFF;
+		}
+		len = TelemetryPackSamples(&stream, samples, TELEMETRY_MAX_SAMPLES / 4, n * 4000000UL, frame);
+		ok &= (len > 0 && len <= TELEMETRY_MAX_FRAME);
+		ok &= (Unpack(frame, len, &seq, &timestamp, decoded) == TELEMETRY_MAX_SAMPLES);
+		ok &= (seq == (n & 0xFF) && timestamp == n * 4000000UL);
+		ok &= (memcmp(decoded, samples, sizeof(samples)) == 0);
+	}
+	CHECK(ok);
+}
+
+static void TestSend(void){
+	telemetry_stream_t stream = {.port = UART_PC, .num_channels = 2, .sample_period = 500, .seq = 0};
+	const uint16_t samples[] = {1, 2, 3, 4};
+	uint8_t frame[TELEMETRY_MAX_FRAME], sent[TELEMETRY_MAX_FRAME];
+	uint16_t len;
+
+	MockUartSent(0, sent, sizeof(sent));
+	len = TelemetryPackSamples(&stream, samples, 2, 7, frame);
+	stream.seq = 0;
+	CHECK(TelemetrySendSamples(&stream, samples, 2, 7));
+	CHECK(MockUartSent(0, sent, sizeof(sent)) == len && memcmp(sent, frame, len) == 0);
+	CHECK(!TelemetrySendSamples(&stream, samples, TELEMETRY_MAX_SAMPLES, 7));
+	CHECK(MockUartSent(0, sent, sizeof(sent)) == 0);
+}
+
+/* Capture for the decoder: sequence numbers wrap, one packet lost, one with a CRC error */
+static void WriteVector(const char *bin_path, const char *csv_path){
+	telemetry_stream_t stream = {.port = UART_PC, .num_channels = VECTOR_CHANNELS, .sample_period = 250, .seq = 250};
+	uint16_t samples[VECTOR_CHANNELS * VECTOR_SCANS] = {0};
+	uint8_t frame[TELEMETRY_MAX_FRAME], payload[TELEMETRY_MAX_PAYLOAD];
+	uint32_t timestamp = 1000;
+	uint16_t len, size;
+	FILE *bin = fopen(bin_path, "wb");
+	FILE *csv = fopen(csv_path, "w");
+
+	CHECK(bin != NULL && csv != NULL);
+	if(bin == NULL || csv == NULL){
+		return;
+	}
+	srand(3);
+	for(uint8_t n = 0; n < VECTOR_PACKETS; n++){
+		/* Random walks, clamped to 12 bits */
+		for(uint16_t i = 0; i < VECTOR_CHANNELS * VECTOR_SCANS; i++){
+			int32_t prev = (i < VECTOR_CHANNELS) ? 2048 : samples[i - VECTOR_CHANNELS];
+			int32_t value = prev + rand() % 301 - 150;
+			samples[i] = (value < 0) ? 0 : (value > 0xFFF) ? 0xFFF : value;
+		}
+		len = TelemetryPackSamples(&stream, samples, VECTOR_SCANS, timestamp, frame);
+		if(n == VECTOR_BAD_CRC){
+			/* Last byte of the last sample, then encoded again with the old CRC */
+			size = TelemetryCobsDecode(frame, len - 1, payload);
+			payload[size - 3] ^= 0x01;
+			len = TelemetryCobsEncode(payload, size, frame);
+			frame[len++] = 0;
+		}else if(n != VECTOR_LOST){
+			for(uint8_t s = 0; s < VECTOR_SCANS; s++){
+				fprintf(csv, "%lu", (unsigned long)(timestamp + s * stream.sample_period));
+				for(uint8_t c = 0; c < VECTOR_CHANNELS; c++){
+					fprintf(csv, ",%u", samples[s * VECTOR_CHANNELS + c]);
+				}
+				fprintf(csv, "\n");
+			}
+		}
+		if(n != VECTOR_LOST){
+			fwrite(frame, 1, len, bin);
+		}
+		timestamp += VECTOR_SCANS * stream.sample_period;
+	}
+	fclose(bin);
+	fclose(csv);
+}
+
+int main(int argc, char *argv[]){
+	serial_config_t serial = {.port = UART_PC, .baud_rate = 115200, .func_p = UART_NO_INT, .param_p = NULL, .rx_p = NULL};
+
+	UartInit(&serial);
+	TestCrc();
+	TestCobs();
+	TestPack();
+	TestRoundTrip();
+	TestSend();
+	if(argc == 3){
+		WriteVector(argv[1], argv[2]);
+	}
+	TEST_END();
+}
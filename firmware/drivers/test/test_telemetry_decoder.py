@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Checks tools/telemetry_decoder.py against a capture written by test_telemetry.
+
+test_telemetry writes the frames and the CSV the decoder must print from them.
+The capture wraps the sequence number, misses one packet and has one packet
+with a CRC error, which the decoder must report on stderr.
+
+    python3 test_telemetry_decoder.py ../../tools/telemetry_decoder.py capture.bin expected.csv
+"""
+
+import importlib.util
+import subprocess
+import sys
+
+
+def check(cond, what):
+    if not cond:
+        print("CHECK failed: %s" % what)
+    return cond
+
+
+def main():
+    decoder_path, bin_path, csv_path = sys.argv[1:4]
+    spec = importlib.util.spec_from_file_location("telemetry_decoder", decoder_path)
+    decoder = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(decoder)
+    ok = True
+
+    ok &= check(decoder.crc16(b"123456789") == 0x29B1, "crc16 check value")
+    ok &= check(decoder.unzigzag(8190) == 4095 and decoder.unzigzag(127) == -64, "unzigzag")
+    # COBS blocks of exactly 254 and 255 bytes
+    block = bytes(range(1, 256))
+    ok &= check(decoder.cobs_decode(b"\xff" + block[:254] + b"\x01") == block[:254], "COBS 254 bytes")
+    ok &= check(decoder.cobs_decode(b"\xff" + block[:254] + b"\x02" + block[254:]) == block, "COBS 255 bytes")
+
+    with open(bin_path, "rb") as f:
+        frames = list(decoder.frames(f))
+    seqs = []
+    for frame in frames:
+        try:
+            seqs.append(decoder.decode_frame(frame)[0])
+        except ValueError as err:
+            ok &= check(str(err) == "CRC error", "only the CRC error frame is dropped (%s)" % err)
+    ok &= check(seqs == [250, 251, 252, 253, 254, 255, 0, 2, 4, 5], "sequence numbers %s" % seqs)
+
+    result = subprocess.run([sys.executable, decoder_path, bin_path], capture_output=True, text=True)
+    with open(csv_path) as f:
+        expected = f.read()
+    ok &= check(result.returncode == 0, "decoder exit status")
+    ok &= check(result.stdout == expected, "decoded samples match the C packer")
+    ok &= check(result.stderr.count("CRC error") == 1, "CRC error reported")
+    # Packet 1 lost, then packet 3 dropped for its CRC
+    ok &= check(result.stderr.count("# 1 packets lost") == 2, "lost packets reported")
+    print("test_telemetry_decoder.py: %s" % ("PASS" if ok else "FAIL"))
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
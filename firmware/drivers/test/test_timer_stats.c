@@ -0,0 +1,118 @@
+/**
+ * @file test_timer_stats.c
+ * @brief Timer jitter and latency statistics: histogram bins, min, max and mean.
+ *
+ * Alarms are fired at chosen esp_timer times, so every jitter value is known.
+ */
+#include <string.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "timer_mcu.h"
+
+#define PERIOD_US	1000
+#define TIMER		0		/* gptimer index of TIMER_B, the only timer created */
+
+/* Absolute deviation of each period, the last ones fall in the overflow bin */
+static const uint32_t jitters[] = {0, 1, 2, 3, 4, 7, 8, 15, 16, 16383, 16384, 40000};
+#define JITTERS		(sizeof(jitters) / sizeof(jitters[0]))
+
+static void Alarm(void *param){
+}
+
+static void TestBins(void){
+	CHECK(TimerStatsBin(0) == 0);
+	CHECK(TimerStatsBin(1) == 1);
+	CHECK(TimerStatsBin(2) == 2 && TimerStatsBin(3) == 2);
+	/* [2^(n-1), 2^n) */
+	for(uint8_t n = 2; n < TIMER_STATS_BINS; n++){
+		CHECK(TimerStatsBin(1UL << (n - 1)) == n && TimerStatsBin((1UL << n) - 1) == n);
+	}
+	/* Everything from 2^14 us on */
+	CHECK(TimerStatsBin(1UL << (TIMER_STATS_BINS - 2)) == TIMER_STATS_BINS - 1);
+	CHECK(TimerStatsBin(UINT32_MAX) == TIMER_STATS_BINS - 1);
+}
+
+/* Alarms late and early by each jitter value */
+static void TestJitter(void){
+	timer_stats_t jitter, latency;
+	uint32_t hist[TIMER_STATS_BINS] = {0};
+	uint64_t sum = 0;
+	char expected[256], line[512] = {0};
+	uint16_t len;
+
+	TimerStatsEnable(TIMER_B, true);
+	mock_time_us = 5000;
+	CHECK(MockGptimerAlarm(TIMER));
+	for(uint8_t i = 0; i < JITTERS; i++){
+		bool early = (i % 2) && jitters[i] < PERIOD_US;
+		mock_time_us += early ? PERIOD_US - jitters[i] : PERIOD_US + jitters[i];
+		MockGptimerAlarm(TIMER);
+		hist[TimerStatsBin(jitters[i])]++;
+		sum += jitters[i];
+	}
+	TimerStatsGet(TIMER_B, &jitter, &latency);
+	CHECK(jitter.count == JITTERS && jitter.min == 0 && jitter.max == 40000 && jitter.sum == sum);
+	CHECK(memcmp(jitter.hist, hist, sizeof(hist)) == 0);
+	CHECK(jitter.hist[TIMER_STATS_BINS - 1] == 2);
+	CHECK(latency.count == 0);
+
+	/* Mean, as printed */
+	MockUartSent(0, (uint8_t*)line, sizeof(line));
+	memset(line, 0, sizeof(line));
+	TimerStatsPrint(TIMER_B, UART_PC);
+	MockUartSent(0, (uint8_t*)line, sizeof(line) - 1);
+	len = snprintf(expected, sizeof(expected), "Timer B (us)\r\n jitter  n:%u min:0 max:40000 mean:%u hist:",
+		(unsigned)JITTERS, (unsigned)(sum / JITTERS));
+	for(uint8_t i = 0; i < TIMER_STATS_BINS; i++){
+		len += snprintf(expected + len, sizeof(expected) - len, " %u", (unsigned)hist[i]);
+	}
+	CHECK(strncmp(line, expected, len) == 0);
+}
+
+/* Task wake-up latency: from the last alarm to TimerStatsTaskWoken() */
+static void TestLatency(void){
+	timer_stats_t jitter, latency;
+
+	TimerStatsReset(TIMER_B);
+	TimerStatsGet(TIMER_B, &jitter, &latency);
+	CHECK(jitter.count == 0 && latency.count == 0);
+	/* No alarm since the reset */
+	TimerStatsTaskWoken(TIMER_B);
+	mock_time_us += PERIOD_US;
+	MockGptimerAlarm(TIMER);
+	mock_time_us += 25;
+	TimerStatsTaskWoken(TIMER_B);
+	mock_time_us += PERIOD_US - 25;
+	MockGptimerAlarm(TIMER);
+	mock_time_us += 3;
+	TimerStatsTaskWoken(TIMER_B);
+	TimerStatsGet(TIMER_B, &jitter, &latency);
+	CHECK(jitter.count == 1 && jitter.max == 0);
+	CHECK(latency.count == 2 && latency.min == 3 && latency.max == 25 && latency.sum == 28);
+	CHECK(latency.hist[TimerStatsBin(3)] == 1 && latency.hist[TimerStatsBin(25)] == 1);
+
+	/* Disabled: nothing is recorded, enabling again starts from zero */
+	TimerStatsEnable(TIMER_B, false);
+	mock_time_us += PERIOD_US;
+	MockGptimerAlarm(TIMER);
+	TimerStatsTaskWoken(TIMER_B);
+	TimerStatsGet(TIMER_B, &jitter, &latency);
+	CHECK(jitter.count == 0 && latency.count == 0);
+	TimerStatsEnable(TIMER_B, true);
+	TimerStatsTaskWoken(TIMER_B);
+	TimerStatsGet(TIMER_B, &jitter, &latency);
+	CHECK(latency.count == 0);
+}
+
+int main(void){
+	timer_config_t timer = {.timer = TIMER_B, .period = PERIOD_US, .func_p = Alarm, .param_p = NULL};
+	serial_config_t serial = {.port = UART_PC, .baud_rate = 115200, .func_p = UART_NO_INT, .param_p = NULL, .rx_p = NULL};
+
+	UartInit(&serial);
+	TimerInit(&timer);
+	TimerStart(TIMER_B);
+	TestBins();
+	TestJitter();
+	TestLatency();
+	TEST_END();
+}
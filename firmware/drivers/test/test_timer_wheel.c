@@ -0,0 +1,223 @@
+/**
+ * @file test_timer_wheel.c
+ * @brief Software timer wheel: expirations (periodic, one shot, beyond the wheel range, 
+ * task notifications) and ISR cost versus the number of timers.
+ * 
+ * The wheel tick ISR is run on the host, so the times are only meaningful relative 
+ * to each other: the cost per tick must not grow with the number of timers, only 
+ * with the number of timers expiring in that tick.
+ */
+#include <stdlib.h>
+#include <time.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "timer_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define TICK_US		100
+#define RUN_TICKS	100000
+#define MAX_TIMERS	4096
+#define WHEEL_TICKS	(1UL << 20)		/* Wheel range: 256 x 64 x 64 ticks */
+
+static soft_timer_t timers[MAX_TIMERS];
+static uint32_t fired[MAX_TIMERS];
+static uint32_t fired_tick[MAX_TIMERS];		/* Wheel ticks at the last expiration */
+static uint32_t wakeups, notifications;		/* Notified task */
+
+static void Expired(void *param){
+	fired[(soft_timer_t*)param - timers]++;
+	fired_tick[(soft_timer_t*)param - timers] = TimerWheelTicks();
+}
+
+static void NotifiedTask(void *param){
+	while(1){
+		notifications += ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		wakeups++;
+	}
+}
+
+static void Ticks(uint32_t ticks){
+	for(uint32_t tick = 0; tick < ticks; tick++){
+		MockGptimerAlarm(0);
+	}
+}
+
+static void InitTimer(uint16_t i, uint32_t ticks, bool one_shot, void *task){
+	soft_timer_config_t config = {
+		.period = ticks * TICK_US,
+		.one_shot = one_shot,
+		.func_p = Expired,
+		.param_p = &timers[i],
+		.task_h = task,
+	};
+
+	TimerSoftInit(&timers[i], &config);
+	fired[i] = 0;
+}
+
+static int64_t NowNs(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Run n periodic timers (periods up to ~2 s, across all wheel levels) for RUN_TICKS ticks */
+static void RunTimers(uint16_t n){
+	int64_t start, t0, t1, worst = 0;
+	uint64_t callbacks = 0;
+	bool exact = true;
+
+	srand(n);
+	for(uint16_t i = 0; i < n; i++){
+		soft_timer_config_t config = {
+			.period = (1 + rand() % 20000) * TICK_US,
+			.one_shot = false,
+			.func_p = Expired,
+			.param_p = &timers[i],
+			.task_h = NULL,
+		};
+		TimerSoftInit(&timers[i], &config);
+		fired[i] = 0;
+		TimerSoftStart(&timers[i]);
+	}
+	start = NowNs();
+	for(uint32_t tick = 0; tick < RUN_TICKS; tick++){
+		t0 = NowNs();
+		MockGptimerAlarm(0);
+		t1 = NowNs();
+		if(t1 - t0 > worst){
+			worst = t1 - t0;
+		}
+	}
+	t1 = NowNs();
+	for(uint16_t i = 0; i < n; i++){
+		exact &= (fired[i] == RUN_TICKS / timers[i].ticks);
+		callbacks += fired[i];
+		TimerSoftStop(&timers[i]);
+	}
+	CHECK(exact);
+	printf("%6u timers: %6.1f ns/tick mean, %7lld ns worst tick, %8llu expirations\n", n, 
+		(double)(t1 - start) / RUN_TICKS, (long long)worst, (unsigned long long)callbacks);
+}
+
+static void TestUpdatePeriod(void){
+	soft_timer_config_t config = {
+		.period = 10 * TICK_US,
+		.one_shot = false,
+		.func_p = Expired,
+		.param_p = &timers[0],
+		.task_h = NULL,
+	};
+
+	TimerSoftInit(&timers[0], &config);
+	fired[0] = 0;
+	TimerSoftStart(&timers[0]);
+	for(uint16_t tick = 0; tick < 100; tick++){
+		MockGptimerAlarm(0);
+	}
+	CHECK(fired[0] == 10);
+	/* The next expiration is already scheduled with the old period */
+	TimerSoftUpdatePeriod(&timers[0], 25 * TICK_US);
+	for(uint16_t tick = 0; tick < 10 + 100; tick++){
+		MockGptimerAlarm(0);
+	}
+	CHECK(fired[0] == 10 + 1 + 4);
+	TimerSoftStop(&timers[0]);
+	for(uint16_t tick = 0; tick < 100; tick++){
+		MockGptimerAlarm(0);
+	}
+	CHECK(fired[0] == 15);
+}
+
+/* One shot timers expire once, a period after they are started, and can be started again */
+static void TestOneShot(void){
+	uint32_t start;
+
+	InitTimer(0, 37, true, NULL);
+	InitTimer(1, 300, true, NULL);
+	InitTimer(2, 5, true, NULL);
+	start = TimerWheelTicks();
+	TimerSoftStart(&timers[0]);
+	TimerSoftStart(&timers[1]);
+	TimerSoftStart(&timers[2]);
+	Ticks(4);
+	TimerSoftStop(&timers[2]);
+	Ticks(400);
+	CHECK(fired[0] == 1 && fired_tick[0] == start + 37);
+	CHECK(fired[1] == 1 && fired_tick[1] == start + 300);
+	CHECK(fired[2] == 0);
+	CHECK(timers[0].pprev == NULL && timers[1].pprev == NULL);
+	start = TimerWheelTicks();
+	TimerSoftStart(&timers[0]);
+	Ticks(100);
+	CHECK(fired[0] == 2 && fired_tick[0] == start + 37);
+}
+
+/* Deadlines beyond the top level are parked in its last slot and cascaded until they are in range */
+static void TestLongDeadlines(void){
+	uint32_t start, one_shot = 2 * WHEEL_TICKS + 12345, period = WHEEL_TICKS + 777;
+
+	InitTimer(0, one_shot, true, NULL);
+	InitTimer(1, period, false, NULL);
+	start = TimerWheelTicks();
+	TimerSoftStart(&timers[0]);
+	TimerSoftStart(&timers[1]);
+	Ticks(period - 1);
+	CHECK(fired[1] == 0);
+	Ticks(1);
+	CHECK(fired[1] == 1 && fired_tick[1] == start + period);
+	Ticks(period);
+	CHECK(fired[1] == 2 && fired_tick[1] == start + 2 * period);
+	Ticks(one_shot - 2 * period - 1);
+	CHECK(fired[0] == 0);
+	Ticks(1);
+	CHECK(fired[0] == 1 && fired_tick[0] == start + one_shot);
+	CHECK(fired[1] == 2);
+	TimerSoftStop(&timers[1]);
+}
+
+/* Timers with a task handle notify it on every expiration, also with no callback */
+static void TestNotify(void){
+	TaskHandle_t task;
+	soft_timer_config_t config = {.period = 10 * TICK_US, .one_shot = false, .func_p = NULL, .param_p = NULL};
+
+	CHECK(xTaskCreate(NotifiedTask, "wheel_task", 2048, NULL, 5, &task) == pdPASS);
+	config.task_h = task;
+	TimerSoftInit(&timers[0], &config);
+	TimerSoftStart(&timers[0]);
+	/* Notifications are counted until the task runs */
+	Ticks(100);
+	CHECK(MockTaskRun("wheel_task"));
+	CHECK(wakeups == 1 && notifications == 10);
+	for(uint8_t i = 0; i < 5; i++){
+		Ticks(10);
+		MockTaskRun("wheel_task");
+	}
+	CHECK(wakeups == 6 && notifications == 15);
+	/* Nothing expired: the task stays blocked */
+	TimerSoftStop(&timers[0]);
+	Ticks(100);
+	MockTaskRun("wheel_task");
+	CHECK(wakeups == 6);
+	/* Both the callback and the task */
+	InitTimer(1, 20, true, task);
+	TimerSoftStart(&timers[1]);
+	Ticks(20);
+	MockTaskRun("wheel_task");
+	CHECK(fired[1] == 1 && wakeups == 7 && notifications == 16);
+}
+
+int main(void){
+	TimerWheelInit(TIMER_A, TICK_US);
+	TimerWheelStart();
+	TestUpdatePeriod();
+	TestOneShot();
+	TestNotify();
+	TestLongDeadlines();
+	for(uint16_t n = 1; n <= MAX_TIMERS; n *= 8){
+		RunTimers(n);
+	}
+	TEST_END();
+}
@@ -0,0 +1,212 @@
+/**
+ * @file test_uart_rx.c
+ * @brief UART receive ring and line/packet assembler, fed through the UART event task, 
+ * and non-blocking transmission.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "uart_mcu.h"
+
+#define LINES		500
+#define PACKETS		300
+#define BENCH_BYTES	65536
+#define BENCH_BUF	1024
+
+static char lines[LINES][UART_RX_MSG_MAX];
+static uint16_t lines_got = 0, lines_bad = 0;
+static uint16_t packets_got = 0, packets_bad = 0;
+static uint8_t stream[LINES * (UART_RX_MSG_MAX + 2)];
+
+static void LineReceived(void *param, const uint8_t *msg, uint16_t len){
+	if(lines_got >= LINES || strcmp((const char*)msg, lines[lines_got]) != 0 || len != strlen(lines[lines_got])){
+		lines_bad++;
+	}
+	lines_got++;
+}
+
+static void PacketReceived(void *param, const uint8_t *msg, uint16_t len){
+	/* Packet n has (n * 7) % 256 bytes and starts with n */
+	if(len != (packets_got * 7) % 256 || (len > 0 && msg[0] != (uint8_t)packets_got)){
+		packets_bad++;
+	}
+	packets_got++;
+}
+
+/* Feed the stream in random sized chunks, letting the event task run after each one */
+static void Feed(uint8_t uart, const char *task, const uint8_t *data, uint32_t len, uint16_t max_chunk){
+	uint32_t pos = 0;
+
+	while(pos < len){
+		uint16_t chunk = 1 + rand() % max_chunk;
+		if(chunk > len - pos){
+			chunk = len - pos;
+		}
+		MockUartReceive(uart, &data[pos], chunk, UART_DATA);
+		MockTaskRun(task);
+		pos += chunk;
+	}
+}
+
+static void TestLines(void){
+	uart_rx_config_t rx = {.mode = UART_RX_LINE, .delimiter = '\n', .func_p = LineReceived, .param_p = NULL};
+	serial_config_t config = {.port = UART_PC, .baud_rate = 115200, .func_p = UART_NO_INT, .param_p = NULL, .rx_p = &rx};
+	uart_rx_stats_t stats;
+	uint8_t overflow[UART_RX_MSG_MAX + 10];
+	uint32_t len = 0;
+
+	UartInit(&config);
+	MockTaskRun("uart_pc_event_task");
+	srand(3);
+	for(uint16_t i = 0; i < LINES; i++){
+		uint16_t n = rand() % (UART_RX_MSG_MAX - 1);
+		for(uint16_t j = 0; j < n; j++){
+			lines[i][j] = 'a' + rand() % 26;
+		}
+		lines[i][n] = '\0';
+		memcpy(&stream[len], lines[i], n);
+		len += n;
+		if(rand() % 2){
+			stream[len++] = '\r';
+		}
+		stream[len++] = '\n';
+	}
+	Feed(0, "uart_pc_event_task", stream, len, 300);
+	CHECK(lines_got == LINES);
+	CHECK(lines_bad == 0);
+
+	/* A line longer than UART_RX_MSG_MAX is dropped up to its delimiter */
+	memset(overflow, 'x', sizeof(overflow));
+	overflow[sizeof(overflow) - 1] = '\n';
+	Feed(0, "uart_pc_event_task", overflow, sizeof(overflow), 64);
+	/* A FIFO overflow breaks the line being received */
+	Feed(0, "uart_pc_event_task", (const uint8_t*)"broken", 6, 64);
+	MockUartReceive(0, NULL, 0, UART_FIFO_OVF);
+	MockTaskRun("uart_pc_event_task");
+	strcpy(lines[0], "ok");
+	lines_got = 0;
+	Feed(0, "uart_pc_event_task", (const uint8_t*)"end\nok\n", 7, 64);
+	CHECK(lines_got == 1);
+	CHECK(lines_bad == 0);
+	UartRxGetStats(UART_PC, &stats);
+	CHECK(stats.messages == LINES + 1);
+	CHECK(stats.msg_overruns == 2);
+	CHECK(stats.fifo_overruns == 1);
+}
+
+static void TestPackets(void){
+	uart_rx_config_t rx = {.mode = UART_RX_PACKET, .func_p = PacketReceived, .param_p = NULL};
+	serial_config_t config = {.port = UART_CONNECTOR, .baud_rate = 115200, .func_p = UART_NO_INT, .param_p = NULL, .rx_p = &rx};
+	uart_rx_stats_t stats;
+	uint32_t len = 0;
+
+	UartInit(&config);
+	MockTaskRun("uart_conn_event_task");
+	for(uint16_t i = 0; i < PACKETS; i++){
+		uint16_t n = (i * 7) % 256;
+		stream[len++] = n;
+		for(uint16_t j = 0; j < n; j++){
+			stream[len++] = (j == 0) ? i : rand();
+		}
+	}
+	Feed(1, "uart_conn_event_task", stream, len, 700);
+	CHECK(packets_got == PACKETS);
+	CHECK(packets_bad == 0);
+	UartRxGetStats(UART_CONNECTOR, &stats);
+	CHECK(stats.bytes == len);
+	CHECK(stats.ring_overruns == 0);
+}
+
+static void TestAsyncSend(void){
+	static const uint8_t msg[] = "0123456789";
+	uint8_t sent[64];
+	uart_tx_stats_t stats;
+
+	for(uint8_t i = 0; i < UART_TX_QUEUE_LEN; i++){
+		CHECK(UartSendBufferAsync(UART_CONNECTOR, &msg[i], 1, NULL, NULL));
+	}
+	/* The queue is full until the transmission task runs */
+	CHECK(!UartSendBufferAsync(UART_CONNECTOR, msg, 1, NULL, NULL));
+	UartTxGetStats(UART_CONNECTOR, &stats);
+	CHECK(stats.bytes_in_flight == UART_TX_QUEUE_LEN);
+	CHECK(stats.drops == 1);
+	MockTaskRun("uart_tx_task");
+	CHECK(MockUartSent(1, sent, sizeof(sent)) == UART_TX_QUEUE_LEN);
+	CHECK(memcmp(sent, msg, UART_TX_QUEUE_LEN) == 0);
+	UartTxGetStats(UART_CONNECTOR, &stats);
+	CHECK(stats.bytes_in_flight == 0);
+	CHECK(stats.buffers_sent == UART_TX_QUEUE_LEN);
+}
+
+static int64_t NowNs(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* No memory for the queue or the task: the buffer is not queued, and the next call tries again */
+static void TestAsyncNoMem(void){
+	static const uint8_t msg[] = "abc";
+	uint8_t sent[8];
+	uart_tx_stats_t stats;
+
+	mock_queue_no_mem = true;
+	CHECK(!UartSendBufferAsync(UART_PC, msg, 3, NULL, NULL));
+	mock_queue_no_mem = false;
+	mock_task_no_mem = true;
+	CHECK(!UartSendBufferAsync(UART_PC, msg, 3, NULL, NULL));
+	mock_task_no_mem = false;
+	UartTxGetStats(UART_PC, &stats);
+	CHECK(stats.bytes_in_flight == 0 && stats.drops == 0);
+	MockUartSent(0, sent, sizeof(sent));
+	CHECK(UartSendBufferAsync(UART_PC, msg, 3, NULL, NULL));
+	CHECK(MockTaskRun("uart_tx_task"));
+	CHECK(MockUartSent(0, sent, sizeof(sent)) == 3 && memcmp(sent, msg, 3) == 0);
+}
+
+/* The same bytes byte by byte and in buffers: UART driver calls and host time */
+static void BenchSend(void){
+	static uint8_t data[BENCH_BYTES];
+	uint8_t sent[BENCH_BUF];
+	int64_t start, byte_ns, async_ns;
+	uint32_t byte_writes, async_writes;
+
+	for(uint32_t i = 0; i < BENCH_BYTES; i++){
+		data[i] = i * 31;
+	}
+	MockUartSent(0, sent, sizeof(sent));
+	MockUartWrites(0);
+	start = NowNs();
+	for(uint32_t i = 0; i < BENCH_BYTES; i++){
+		UartSendByte(UART_PC, (const char*)&data[i]);
+	}
+	byte_ns = NowNs() - start;
+	byte_writes = MockUartWrites(0);
+	MockUartSent(0, sent, sizeof(sent));
+	start = NowNs();
+	for(uint32_t i = 0; i < BENCH_BYTES; i += BENCH_BUF){
+		CHECK(UartSendBufferAsync(UART_PC, &data[i], BENCH_BUF, NULL, NULL));
+		if((i / BENCH_BUF) % UART_TX_QUEUE_LEN == UART_TX_QUEUE_LEN - 1){
+			MockTaskRun("uart_tx_task");
+		}
+	}
+	async_ns = NowNs() - start;
+	async_writes = MockUartWrites(0);
+	CHECK(byte_writes == BENCH_BYTES);
+	CHECK(async_writes == BENCH_BYTES / BENCH_BUF);
+	CHECK(MockUartSent(0, sent, sizeof(sent)) == BENCH_BUF && memcmp(sent, data, BENCH_BUF) == 0);
+	printf("%u bytes: %u driver calls byte by byte (%.1f MB/s), %u calls in %u byte buffers (%.1f MB/s)\n", 
+		BENCH_BYTES, byte_writes, BENCH_BYTES * 1000.0 / byte_ns, async_writes, BENCH_BUF, BENCH_BYTES * 1000.0 / async_ns);
+}
+
+int main(void){
+	TestLines();
+	TestPackets();
+	TestAsyncSend();
+	TestAsyncNoMem();
+	BenchSend();
+	TEST_END();
+}
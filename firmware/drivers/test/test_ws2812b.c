@@ -0,0 +1,109 @@
+/**
+ * @file test_ws2812b.c
+ * @brief WS2812B frames encoded by the RMT against the datasheet timing.
+ *
+ * The RMT mock runs the driver encoder in refills of the channel memory, as the RMT
+ * ISR does, and keeps the symbols of the last frame.
+ */
+#include <string.h>
+#include "test_check.h"
+#include "mock_idf.h"
+#include "ws2812b.h"
+
+#define LEDS			300
+#define RMT_TICK_NS		50		/* ws2812b.c RMT_RESOLUTION_HZ: 20 MHz */
+#define RMT_MEM_SYMBOLS	48		/* ws2812b.c channel memory */
+#define TOLERANCE_NS	150		/* Datasheet: +-150 ns on each level */
+#define PERIOD_NS		1250
+#define PERIOD_TOL_NS	600
+#define RET_NS			50000
+
+/* Datasheet timing: high and low time of bits 0 and 1 */
+static const uint16_t high_ns[2] = {400, 800};
+static const uint16_t low_ns[2] = {850, 450};
+
+static uint32_t Abs(int32_t x){
+	return (x < 0) ? -x : x;
+}
+
+/* Symbols of a frame: one per bit of bytes (MSB first) and the ret command */
+static bool CheckFrame(const uint8_t *bytes, uint32_t len){
+	const rmt_symbol_word_t *symbols;
+	uint32_t num = MockRmtSymbols(&symbols);
+	int32_t high, low;
+	uint8_t bit;
+	bool ok = true;
+
+	if(num != len * 8 + 1){
+		return false;
+	}
+	for(uint32_t k = 0; k < len * 8; k++){
+		bit = (bytes[k / 8] >> (7 - k % 8)) & 1;
+		high = symbols[k].duration0 * RMT_TICK_NS;
+		low = symbols[k].duration1 * RMT_TICK_NS;
+		ok &= (symbols[k].level0 == 1 && symbols[k].level1 == 0);
+		ok &= (Abs(high - high_ns[bit]) <= TOLERANCE_NS && Abs(low - low_ns[bit]) <= TOLERANCE_NS);
+		ok &= (Abs(high + low - PERIOD_NS) <= PERIOD_TOL_NS);
+	}
+	/* Ret command: line low for at least 50 us */
+	ok &= (symbols[num - 1].level0 == 0 && symbols[num - 1].level1 == 0);
+	ok &= ((symbols[num - 1].duration0 + symbols[num - 1].duration1) * RMT_TICK_NS >= RET_NS);
+	return ok;
+}
+
+/* ws2812bSend(): colors sent in GRB order, gamma corrected */
+static void TestSend(void){
+	static uint8_t expected[LEDS * 3];
+	mock_rmt_stats_t stats;
+
+	for(uint8_t frame = 0; frame < 3; frame++){
+		for(uint16_t i = 0; i < LEDS; i++){
+			rgb_led_t color = {.green = i + frame, .red = i * 7, .blue = 255 - i};
+			ws2812bSend(color);
+			expected[i * 3] = ws2812bGammaCorrection(color.green);
+			expected[i * 3 + 1] = ws2812bGammaCorrection(color.red);
+			expected[i * 3 + 2] = ws2812bGammaCorrection(color.blue);
+		}
+		ws2812bSendRet();
+		MockRmtStats(&stats, true);
+		CHECK(stats.transmissions == 1);
+		/* The ISR refills the channel memory while the frame is sent */
+		CHECK(stats.refills == (LEDS * 24 + 1 + RMT_MEM_SYMBOLS - 1) / RMT_MEM_SYMBOLS);
+		CHECK(CheckFrame(expected, LEDS * 3));
+	}
+	/* Nothing staged: no frame */
+	ws2812bSendRet();
+	MockRmtStats(&stats, true);
+	CHECK(stats.transmissions == 0);
+}
+
+/* ws2812bFrame(): bytes sent as they are, the stage buffer grows as needed */
+static void TestFrame(void){
+	static uint8_t expected[LEDS * 3];
+	uint8_t *frame;
+
+	for(uint16_t leds = 1; leds <= LEDS; leds += 99){
+		frame = ws2812bFrame(leds);
+		CHECK(frame != NULL);
+		for(uint16_t i = 0; i < leds * 3; i++){
+			frame[i] = expected[i] = i * 13;
+		}
+		ws2812bSendRet();
+		CHECK(CheckFrame(expected, leds * 3));
+	}
+	/* Two parts of the same frame */
+	memset(ws2812bFrame(1), 0xFF, 3);
+	memset(ws2812bFrame(1), 0x00, 3);
+	ws2812bSendRet();
+	memset(expected, 0xFF, 3);
+	memset(expected + 3, 0x00, 3);
+	CHECK(CheckFrame(expected, 6));
+	ws2812bWait();
+}
+
+int main(void){
+	ws2812bInit(GPIO_8);
+	TestSend();
+	TestFrame();
+	TEST_END();
+}
@@ -0,0 +1,124 @@
+#ifndef FORMAT_H
+#define FORMAT_H
+
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Utils Utils
+ ** @{ */
+/** \addtogroup Format Format
+ ** @{ */
+
+/** \brief Reentrant number to string conversion.
+ * 
+ * All functions write to a buffer supplied by the caller (no static buffers, 
+ * no heap, no newlib printf), so they can be used from several tasks at once.
+ * Decimal conversion writes two digits per step from a digit pair table.
+ * 
+ * Buffer sizes: FORMAT_U32_LEN for FormatU32(), FormatI32() and FormatHex(); 
+ * FORMAT_FLOAT_LEN for FormatFixed() and FormatFloat().
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdarg.h>
+/*==================[macros]=================================================*/
+#define FORMAT_U32_LEN		12		/*!< Buffer size for any 32 bit integer (sign, 10 digits and '\0') */
+#define FORMAT_FLOAT_LEN	20		/*!< Buffer size for fixed point numbers (up to FORMAT_MAX_DECIMALS decimals) */
+#define FORMAT_MAX_DECIMALS	6		/*!< Maximum number of decimals */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Convert an unsigned number to decimal string.
+ * 
+ * @param buf Buffer (FORMAT_U32_LEN bytes)
+ * @param value Number to be converted
+ * @return String length (without '\0')
+ */
+uint8_t FormatU32(char *buf, uint32_t value);
+
+/**
+ * @brief Convert a signed number to decimal string.
+ * 
+ * @param buf Buffer (FORMAT_U32_LEN bytes)
+ * @param value Number to be converted
+ * @return String length (without '\0')
+ */
+uint8_t FormatI32(char *buf, int32_t value);
+
+/**
+ * @brief Convert a number to hexadecimal string (uppercase, without prefix).
+ * 
+ * @param buf Buffer (FORMAT_U32_LEN bytes)
+ * @param value Number to be converted
+ * @param digits Minimum number of digits (padded with '0'), 0 for no padding
+ * @return String length (without '\0')
+ */
+uint8_t FormatHex(char *buf, uint32_t value, uint8_t digits);
+
+/**
+ * @brief Convert a fixed point number to decimal string.
+ * 
+ * Example: FormatFixed(buf, -1234, 2) gives "-12.34"
+ * 
+ * @param buf Buffer (FORMAT_FLOAT_LEN bytes)
+ * @param value Number scaled by 10^decimals
+ * @param decimals Number of decimals (up to FORMAT_MAX_DECIMALS)
+ * @return String length (without '\0')
+ */
+uint8_t FormatFixed(char *buf, int32_t value, uint8_t decimals);
+
+/**
+ * @brief Convert a float to decimal string, rounded to a fixed number of decimals.
+ * 
+ * Numbers whose integer part does not fit in 32 bits give "ovf". Negative numbers 
+ * rounded to 0 are written without sign.
+ * 
+ * @param buf Buffer (FORMAT_FLOAT_LEN bytes)
+ * @param value Number to be converted
+ * @param decimals Number of decimals (up to FORMAT_MAX_DECIMALS)
+ * @return String length (without '\0')
+ */
+uint8_t FormatFloat(char *buf, float value, uint8_t decimals);
+
+/**
+ * @brief Compose a string, snprintf style.
+ * 
+ * Supported conversions: %d %i %u %x %X %c %s %f %%, with '-' and '0' flags, 
+ * width and precision (number of decimals for %f, 6 by default). 
+ * With the 'l' modifier integers are read as long and converted to 32 bit, 'h' is
+ * ignored. A NULL %s prints "(null)".
+ * 
+ * @param buf Buffer
+ * @param size Buffer size (the string is truncated to size - 1 characters)
+ * @param fmt Format string
+ * @return String length (without '\0')
+ */
+uint16_t FormatPrint(char *buf, uint16_t size, const char *fmt, ...);
+
+/**
+ * @brief FormatPrint() with a va_list.
+ * 
+ * @param buf Buffer
+ * @param size Buffer size
+ * @param fmt Format string
+ * @param args Arguments
+ * @return String length (without '\0')
+ */
+uint16_t FormatVPrint(char *buf, uint16_t size, const char *fmt, va_list args);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
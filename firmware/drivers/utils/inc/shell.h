@@ -0,0 +1,128 @@
+#ifndef SHELL_H
+#define SHELL_H
+
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Utils Utils
+ ** @{ */
+/** \addtogroup Shell Shell
+ ** @{ */
+
+/** \brief Command shell over UART.
+ * 
+ * Commands are declared in a constant table and dispatched through a perfect 
+ * hash built at init (one hash and one string compare per command line). 
+ * No heap is used. Lines are received with the UART line assembler and 
+ * executed from the UART event task.
+ * 
+ * Built-in commands: help, tasks, jitter, adc and heap.
+ * 
+ * Example:
+ * @code
+ * static void CmdLed(uint8_t argc, char *argv[], void *param){
+ * 	int32_t led;
+ * 	if(argc != 3 || !ShellParseInt(argv[1], &led)){
+ * 		ShellPrint("usage: led <n> on|off\r\n");
+ * 		return;
+ * 	}
+ * 	...
+ * }
+ * static const shell_cmd_t commands[] = {
+ * 	{"led", "led <n> on|off", CmdLed, NULL},
+ * };
+ * shell_config_t shell = {UART_PC, 115200, commands, sizeof(commands) / sizeof(shell_cmd_t)};
+ * ShellInit(&shell);
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_mcu.h"
+/*==================[macros]=================================================*/
+#define SHELL_MAX_ARGS		8		/*!< Maximum number of arguments (command name included) */
+#define SHELL_MAX_CMDS		32		/*!< Maximum number of commands (built-in included) */
+#define SHELL_HASH_SIZE		256		/*!< Perfect hash table size (power of 2, 8 x SHELL_MAX_CMDS so a seed is always found) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Shell command
+ */
+typedef struct {
+	const char *name;		/*!< Command name */
+	const char *help;		/*!< Usage shown by "help" */
+	void (*func_p)(uint8_t argc, char *argv[], void *param);	/*!< Command function (argv[0] is the command name) */
+	void *param_p;			/*!< Pointer to command function parameter */
+} shell_cmd_t;
+
+/**
+ * @brief Shell configuration struct
+ */
+typedef struct {
+	uart_mcu_port_t port;			/*!< UART port */
+	uint32_t baud_rate;				/*!< baudrate (bits per second) */
+	const shell_cmd_t *commands;	/*!< Command table */
+	uint8_t num_commands;			/*!< Number of commands in the table */
+} shell_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Shell initialization. It initializes the UART port.
+ * 
+ * @param config Pointer to shell configuration
+ * @return true if the command table could be hashed (names must be unique, and 
+ * at most SHELL_MAX_CMDS commands counting the built-in ones)
+ */
+bool ShellInit(shell_config_t *config);
+
+/**
+ * @brief Execute a command line.
+ * 
+ * It is called by the shell for each received line, but it can be called 
+ * from any other source.
+ * 
+ * @param line Command line (modified by the tokenizer)
+ */
+void ShellExecute(char *line);
+
+/**
+ * @brief Send formatted text through the shell port (see FormatPrint()).
+ * 
+ * @param fmt Format string
+ */
+void ShellPrint(const char *fmt, ...);
+
+/**
+ * @brief Parse an integer argument (decimal, or hexadecimal with 0x prefix).
+ * 
+ * Decimal values must fit in an int32_t. Hexadecimal values are taken as 32 bit 
+ * patterns, so "0xFFFFFFFF" is -1.
+ * 
+ * @param arg Argument
+ * @param value Pointer to variable where the value will be stored
+ * @return true if the argument is a valid integer in range
+ */
+bool ShellParseInt(const char *arg, int32_t *value);
+
+/**
+ * @brief Parse a decimal number argument (e.g. "-12.5").
+ * 
+ * @param arg Argument
+ * @param value Pointer to variable where the value will be stored
+ * @return true if the argument is a valid number
+ */
+bool ShellParseFloat(const char *arg, float *value);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,119 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Utils Utils
+ ** @{ */
+/** \addtogroup Telemetry Telemetry
+ ** @{ */
+
+/** \brief Binary framed telemetry over UART.
+ * 
+ * Sample packets are encoded as:
+ * 
+ * | Field         | Size       | Description                                        |
+ * |:-------------:|:----------:|:---------------------------------------------------|
+ * | type          | 1 byte     | TELEMETRY_PKT_SAMPLES                              |
+ * | seq           | 1 byte     | Sequence number (wraps at 255)                     |
+ * | timestamp     | varint     | Timestamp of the first scan (us)                   |
+ * | sample_period | varint     | Time between scans (us)                            |
+ * | num_channels  | 1 byte     | Channels per scan                                  |
+ * | scans         | 1 byte     | Scans in the packet                                |
+ * | samples       | varint     | First scan: values. Next scans: zigzag delta from the previous scan, same channel |
+ * | crc           | 2 bytes    | CRC16-CCITT (0x1021, init 0xFFFF) of all previous bytes, little endian |
+ * 
+ * The packet is COBS encoded and terminated with a 0x00 byte, so a receiver 
+ * can resynchronize at any frame boundary. Slow changing 12 bit signals take 
+ * 1 byte per sample (against 4 to 6 bytes as ASCII).
+ * 
+ * The PC side decoder is firmware/tools/telemetry_decoder.py
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_mcu.h"
+/*==================[macros]=================================================*/
+#define TELEMETRY_PKT_SAMPLES	0x01	/*!< Sample packet type */
+#define TELEMETRY_MAX_SAMPLES	128		/*!< Maximum samples (num_channels * scans) per packet */
+#define TELEMETRY_MAX_PAYLOAD	(14 + 3 * TELEMETRY_MAX_SAMPLES + 2)	/*!< Worst case packet size (header + samples + CRC) */
+#define TELEMETRY_MAX_FRAME		(TELEMETRY_MAX_PAYLOAD + TELEMETRY_MAX_PAYLOAD / 254 + 2)	/*!< Worst case frame size (COBS overhead + delimiter) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Telemetry stream
+ */
+typedef struct {
+	uart_mcu_port_t port;	/*!< UART port (UartInit() must be called first) */
+	uint8_t num_channels;	/*!< Channels per scan */
+	uint32_t sample_period;	/*!< Time between scans (us) */
+	uint8_t seq;			/*!< Sequence number of the next packet */
+} telemetry_stream_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Build a sample packet frame.
+ * 
+ * @param stream Telemetry stream (the sequence number is incremented)
+ * @param samples Interleaved samples (scans * num_channels)
+ * @param scans Number of scans
+ * @param timestamp Timestamp of the first scan (us)
+ * @param frame Buffer where the frame will be stored (TELEMETRY_MAX_FRAME bytes)
+ * @return Frame length in bytes (0 if there are more than TELEMETRY_MAX_SAMPLES samples)
+ */
+uint16_t TelemetryPackSamples(telemetry_stream_t *stream, const uint16_t *samples, uint8_t scans, uint32_t timestamp, uint8_t *frame);
+
+/**
+ * @brief Build a sample packet frame and send it through the stream UART port.
+ * 
+ * @param stream Telemetry stream
+ * @param samples Interleaved samples (scans * num_channels)
+ * @param scans Number of scans
+ * @param timestamp Timestamp of the first scan (us)
+ * @return true if the packet was sent
+ */
+bool TelemetrySendSamples(telemetry_stream_t *stream, const uint16_t *samples, uint8_t scans, uint32_t timestamp);
+
+/**
+ * @brief CRC16-CCITT (polynomial 0x1021, initial value 0xFFFF).
+ * 
+ * @param data Data
+ * @param len Number of bytes
+ * @return CRC
+ */
+uint16_t TelemetryCrc16(const uint8_t *data, uint16_t len);
+
+/**
+ * @brief COBS encode (without the 0x00 delimiter).
+ * 
+ * @param src Data to encode
+ * @param len Number of bytes
+ * @param dst Buffer for the encoded data (len + len / 254 + 1 bytes)
+ * @return Encoded length
+ */
+uint16_t TelemetryCobsEncode(const uint8_t *src, uint16_t len, uint8_t *dst);
+
+/**
+ * @brief COBS decode (without the 0x00 delimiter).
+ * 
+ * @param src Encoded data
+ * @param len Number of bytes
+ * @param dst Buffer for the decoded data (len bytes)
+ * @return Decoded length (0 if the frame is malformed)
+ */
+uint16_t TelemetryCobsDecode(const uint8_t *src, uint16_t len, uint8_t *dst);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,274 @@
+/**
+ * @file format.c
+ * @brief Reentrant number to string conversion
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "format.h"
+#include <string.h>
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const char digit_pairs[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+static const uint32_t pow10[FORMAT_MAX_DECIMALS + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Writes value right aligned, ending at end, with at least min_digits digits. Returns the first char */
+static char *PutDecimal(char *end, uint32_t value, uint8_t min_digits){
+	char *p = end;
+
+	/* Division by a constant is compiled as a multiplication */
+	while(value >= 100){
+		uint32_t q = value / 100;
+		uint32_t r = value - q * 100;
+		p -= 2;
+		memcpy(p, &digit_pairs[r * 2], 2);
+		value = q;
+	}
+	if(value >= 10){
+		p -= 2;
+		memcpy(p, &digit_pairs[value * 2], 2);
+	}else{
+		*--p = '0' + value;
+	}
+	while(end - p < min_digits){
+		*--p = '0';
+	}
+	return p;
+}
+
+static uint8_t Emit(char *buf, const char *start, const char *end){
+	uint8_t len = end - start;
+	memmove(buf, start, len);
+	buf[len] = '\0';
+	return len;
+}
+
+static uint8_t FormatSplit(char *buf, uint8_t negative, uint32_t int_part, uint32_t frac_part, uint8_t decimals){
+	char tmp[FORMAT_FLOAT_LEN];
+	char *end = tmp + sizeof(tmp);
+	char *p = end;
+
+	if(decimals > 0){
+		p = PutDecimal(end, frac_part, decimals);
+		*--p = '.';
+	}
+	p = PutDecimal(p, int_part, 1);
+	if(negative){
+		*--p = '-';
+	}
+	return Emit(buf, p, end);
+}
+/*==================[external functions definition]==========================*/
+uint8_t FormatU32(char *buf, uint32_t value){
+	char tmp[FORMAT_U32_LEN];
+	char *end = tmp + sizeof(tmp);
+	return Emit(buf, PutDecimal(end, value, 1), end);
+}
+
+uint8_t FormatI32(char *buf, int32_t value){
+	char tmp[FORMAT_U32_LEN];
+	char *end = tmp + sizeof(tmp);
+	char *p = PutDecimal(end, (value < 0) ? -(uint32_t)value : (uint32_t)value, 1);
+	if(value < 0){
+		*--p = '-';
+	}
+	return Emit(buf, p, end);
+}
+
+uint8_t FormatHex(char *buf, uint32_t value, uint8_t digits){
+	char tmp[FORMAT_U32_LEN];
+	char *end = tmp + sizeof(tmp);
+	char *p = end;
+
+	if(digits > 8){
+		digits = 8;
+	}
+	do{
+		*--p = hex_digits[value & 0x0F];
+		value >>= 4;
+	}while(value != 0);
+	while(end - p < digits){
+		*--p = '0';
+	}
+	return Emit(buf, p, end);
+}
+
+uint8_t FormatFixed(char *buf, int32_t value, uint8_t decimals){
+	uint32_t abs_value = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+	if(decimals > FORMAT_MAX_DECIMALS){
+		decimals = FORMAT_MAX_DECIMALS;
+	}
+	return FormatSplit(buf, value < 0, abs_value / pow10[decimals], abs_value % pow10[decimals], decimals);
+}
+
+uint8_t FormatFloat(char *buf, float value, uint8_t decimals){
+	uint8_t negative = value < 0;
+	uint32_t int_part, frac_part;
+
+	if(decimals > FORMAT_MAX_DECIMALS){
+		decimals = FORMAT_MAX_DECIMALS;
+	}
+	if(negative){
+		value = -value;
+	}
+	if(!(value < 4294967295.0f)){
+		/* Also catches NaN */
+		return Emit(buf, "ovf", "ovf" + 3);
+	}
+	int_part = (uint32_t)value;
+	frac_part = (uint32_t)((value - int_part) * pow10[decimals] + 0.5f);
+	if(frac_part >= pow10[decimals]){
+		frac_part -= pow10[decimals];
+		int_part++;
+	}
+	return FormatSplit(buf, negative && (int_part | frac_part), int_part, frac_part, decimals);
+}
+
+uint16_t FormatVPrint(char *buf, uint16_t size, const char *fmt, va_list args){
+	uint16_t len = 0;
+	char tmp[FORMAT_FLOAT_LEN];
+
+	if(size == 0){
+		return 0;
+	}
+	while(*fmt != '\0'){
+		const char *field = tmp;
+		uint16_t field_len;
+		uint8_t left = 0, zero = 0, width = 0, precision = 6, is_long = 0;
+
+		if(*fmt != '%'){
+			if(len < size - 1){
+				buf[len++] = *fmt;
+			}
+			fmt++;
+			continue;
+		}
+		fmt++;
+		for(; *fmt == '-' || *fmt == '0'; fmt++){
+			if(*fmt == '-'){
+				left = 1;
+			}else{
+				zero = 1;
+			}
+		}
+		for(; *fmt >= '0' && *fmt <= '9'; fmt++){
+			width = width * 10 + (*fmt - '0');
+		}
+		if(*fmt == '.'){
+			precision = 0;
+			for(fmt++; *fmt >= '0' && *fmt <= '9'; fmt++){
+				precision = precision * 10 + (*fmt - '0');
+			}
+		}
+		/* 'l' arguments are read as long (64 bit on a host), then converted to 32 bit */
+		for(; *fmt == 'l' || *fmt == 'h'; fmt++){
+			if(*fmt == 'l'){
+				is_long = 1;
+			}
+		}
+		switch(*fmt){
+			case 'd':
+			case 'i':
+				field_len = FormatI32(tmp, is_long ? (int32_t)va_arg(args, long) : va_arg(args, int32_t));
+			break;
+			case 'u':
+				field_len = FormatU32(tmp, is_long ? (uint32_t)va_arg(args, unsigned long) : va_arg(args, uint32_t));
+			break;
+			case 'x':
+			case 'X':
+				field_len = FormatHex(tmp, is_long ? (uint32_t)va_arg(args, unsigned long) : va_arg(args, uint32_t), 0);
+				if(*fmt == 'x'){
+					for(uint8_t i = 0; i < field_len; i++){
+						if(tmp[i] >= 'A'){
+							tmp[i] += 'a' - 'A';
+						}
+					}
+				}
+			break;
+			case 'f':
+				field_len = FormatFloat(tmp, (float)va_arg(args, double), precision);
+			break;
+			case 'c':
+				tmp[0] = (char)va_arg(args, int);
+				field_len = 1;
+			break;
+			case 's':
+				field = va_arg(args, const char*);
+				if(field == NULL){
+					field = "(null)";
+				}
+				field_len = strlen(field);
+				zero = 0;
+			break;
+			case '\0':
+				continue;
+			default:
+				/* '%%' and unknown conversions are copied */
+				tmp[0] = *fmt;
+				field_len = 1;
+			break;
+		}
+		fmt++;
+		/* Zero padding goes after the sign */
+		if(zero && !left && field_len < width && field[0] == '-'){
+			if(len < size - 1){
+				buf[len++] = '-';
+			}
+			field++;
+			field_len--;
+			width--;
+		}
+		for(; !left && field_len < width; width--){
+			if(len < size - 1){
+				buf[len++] = zero ? '0' : ' ';
+			}
+		}
+		for(uint16_t i = 0; i < field_len; i++){
+			if(len < size - 1){
+				buf[len++] = field[i];
+			}
+		}
+		for(; left && field_len < width; width--){
+			if(len < size - 1){
+				buf[len++] = ' ';
+			}
+		}
+	}
+	buf[len] = '\0';
+	return len;
+}
+
+uint16_t FormatPrint(char *buf, uint16_t size, const char *fmt, ...){
+	va_list args;
+	uint16_t len;
+
+	va_start(args, fmt);
+	len = FormatVPrint(buf, size, fmt, args);
+	va_end(args);
+	return len;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,275 @@
+/**
+ * @file shell.c
+ * @brief Command shell over UART
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "shell.h"
+#include "format.h"
+#include "timer_mcu.h"
+#include "analog_io_mcu.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "esp_heap_caps.h"
+/*==================[macros and definitions]=================================*/
+#define SHELL_HASH_EMPTY	0xFF		/*!< Empty hash table slot */
+#define SHELL_MAX_SEEDS		1024		/*!< Seeds tried to build the perfect hash */
+#define SHELL_PRINT_LEN		128			/*!< Maximum length of each ShellPrint() */
+#define SHELL_MAX_TASKS		16			/*!< Tasks listed by "tasks" */
+/*==================[internal data declaration]==============================*/
+static void CmdHelp(uint8_t argc, char *argv[], void *param);
+static void CmdTasks(uint8_t argc, char *argv[], void *param);
+static void CmdJitter(uint8_t argc, char *argv[], void *param);
+static void CmdAdc(uint8_t argc, char *argv[], void *param);
+static void CmdHeap(uint8_t argc, char *argv[], void *param);
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const shell_cmd_t builtin_cmds[] = {
+	{"help", "help: list commands", CmdHelp, NULL},
+	{"tasks", "tasks: FreeRTOS tasks", CmdTasks, NULL},
+	{"jitter", "jitter: timer jitter and latency", CmdJitter, NULL},
+	{"adc", "adc: ADC continuous mode counters", CmdAdc, NULL},
+	{"heap", "heap: heap usage", CmdHeap, NULL},
+};
+#define SHELL_BUILTINS	(sizeof(builtin_cmds) / sizeof(shell_cmd_t))
+
+static uart_mcu_port_t shell_port;					/*!< Shell UART port */
+static const shell_cmd_t *shell_cmds[SHELL_MAX_CMDS];	/*!< Built-in and user commands */
+static uint8_t shell_num_cmds = 0;					/*!< Number of commands */
+static uint8_t shell_hash[SHELL_HASH_SIZE];			/*!< Perfect hash: slot to command index */
+static uint32_t shell_seed;							/*!< Perfect hash seed */
+static char shell_line[UART_RX_MSG_MAX + 1];		/*!< Copy of the received line */
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* FNV-1a with a seed, folded to the table size */
+static uint32_t ShellHash(const char *str, uint32_t seed){
+	uint32_t hash = 2166136261u ^ seed;
+	while(*str != '\0'){
+		hash ^= (uint8_t)*str++;
+		hash *= 16777619u;
+	}
+	return (hash ^ (hash >> 16)) & (SHELL_HASH_SIZE - 1);
+}
+
+/* With 32 commands in 256 slots about 1 seed in 7 has no collisions, so 
+ * SHELL_MAX_SEEDS tries only fail for duplicated names */
+static bool ShellBuildHash(void){
+	for(shell_seed = 0; shell_seed < SHELL_MAX_SEEDS; shell_seed++){
+		uint8_t i;
+		memset(shell_hash, SHELL_HASH_EMPTY, sizeof(shell_hash));
+		for(i = 0; i < shell_num_cmds; i++){
+			uint32_t slot = ShellHash(shell_cmds[i]->name, shell_seed);
+			if(shell_hash[slot] != SHELL_HASH_EMPTY){
+				break;
+			}
+			shell_hash[slot] = i;
+		}
+		if(i == shell_num_cmds){
+			return true;
+		}
+	}
+	return false;
+}
+
+static uint8_t ShellTokenize(char *line, char *argv[]){
+	uint8_t argc = 0;
+
+	while(*line != '\0' && argc < SHELL_MAX_ARGS){
+		while(*line == ' ' || *line == '\t'){
+			line++;
+		}
+		if(*line == '\0'){
+			break;
+		}
+		if(*line == '"'){
+			/* Quoted argument, spaces included */
+			argv[argc++] = ++line;
+			while(*line != '\0' && *line != '"'){
+				line++;
+			}
+		}else{
+			argv[argc++] = line;
+			while(*line != '\0' && *line != ' ' && *line != '\t'){
+				line++;
+			}
+		}
+		if(*line != '\0'){
+			*line++ = '\0';
+		}
+	}
+	return argc;
+}
+
+static void ShellLine(void *param, const uint8_t *msg, uint16_t len){
+	memcpy(shell_line, msg, len + 1);
+	ShellExecute(shell_line);
+}
+
+static void CmdHelp(uint8_t argc, char *argv[], void *param){
+	for(uint8_t i = 0; i < shell_num_cmds; i++){
+		ShellPrint("%s\r\n", shell_cmds[i]->help);
+	}
+}
+
+static void CmdTasks(uint8_t argc, char *argv[], void *param){
+	ShellPrint("tasks: %u\r\n", (uint32_t)uxTaskGetNumberOfTasks());
+#if configUSE_TRACE_FACILITY
+	static TaskStatus_t tasks[SHELL_MAX_TASKS];
+	UBaseType_t num = uxTaskGetSystemState(tasks, SHELL_MAX_TASKS, NULL);
+	ShellPrint("%-16s state prio stack_free\r\n", "name");
+	for(UBaseType_t i = 0; i < num; i++){
+		ShellPrint("%-16s %5u %4u %10u\r\n", tasks[i].pcTaskName, (uint32_t)tasks[i].eCurrentState, 
+			(uint32_t)tasks[i].uxCurrentPriority, (uint32_t)tasks[i].usStackHighWaterMark);
+	}
+#else
+	/* Per task list requires CONFIG_FREERTOS_USE_TRACE_FACILITY */
+	ShellPrint("%s stack_free: %u\r\n", pcTaskGetName(NULL), (uint32_t)uxTaskGetStackHighWaterMark(NULL));
+#endif
+}
+
+static void CmdJitter(uint8_t argc, char *argv[], void *param){
+	TimerStatsPrint(TIMER_A, shell_port);
+	TimerStatsPrint(TIMER_B, shell_port);
+	TimerStatsPrint(TIMER_C, shell_port);
+}
+
+static void CmdAdc(uint8_t argc, char *argv[], void *param){
+	analog_cont_stats_t stats;
+
+	AnalogContinuousGetStats(&stats);
+	ShellPrint("frames: %u overruns: %u\r\n", stats.frames, stats.overruns);
+}
+
+static void CmdHeap(uint8_t argc, char *argv[], void *param){
+	ShellPrint("free: %u min_free: %u largest_block: %u\r\n", esp_get_free_heap_size(), 
+		esp_get_minimum_free_heap_size(), (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+}
+/*==================[external functions definition]==========================*/
+bool ShellInit(shell_config_t *config){
+	static uart_rx_config_t rx_config = {
+		.mode = UART_RX_LINE,
+		.delimiter = '\n',
+		.func_p = ShellLine,
+		.param_p = NULL,
+	};
+	serial_config_t uart_config = {
+		.port = config->port,
+		.baud_rate = config->baud_rate,
+		.func_p = UART_NO_INT,
+		.param_p = NULL,
+		.rx_p = &rx_config,
+	};
+
+	if(config->num_commands > SHELL_MAX_CMDS - SHELL_BUILTINS){
+		return false;
+	}
+	shell_port = config->port;
+	shell_num_cmds = 0;
+	for(uint8_t i = 0; i < SHELL_BUILTINS; i++){
+		shell_cmds[shell_num_cmds++] = &builtin_cmds[i];
+	}
+	for(uint8_t i = 0; i < config->num_commands; i++){
+		shell_cmds[shell_num_cmds++] = &config->commands[i];
+	}
+	if(!ShellBuildHash()){
+		return false;
+	}
+	UartInit(&uart_config);
+	return true;
+}
+
+void ShellExecute(char *line){
+	char *argv[SHELL_MAX_ARGS];
+	uint8_t argc = ShellTokenize(line, argv);
+	uint8_t cmd;
+
+	if(argc == 0){
+		return;
+	}
+	cmd = shell_hash[ShellHash(argv[0], shell_seed)];
+	if(cmd != SHELL_HASH_EMPTY && strcmp(shell_cmds[cmd]->name, argv[0]) == 0){
+		shell_cmds[cmd]->func_p(argc, argv, shell_cmds[cmd]->param_p);
+	}else{
+		ShellPrint("%s: unknown command (try help)\r\n", argv[0]);
+	}
+}
+
+void ShellPrint(const char *fmt, ...){
+	char buf[SHELL_PRINT_LEN];
+	va_list args;
+
+	va_start(args, fmt);
+	FormatVPrint(buf, sizeof(buf), fmt, args);
+	va_end(args);
+	UartSendString(shell_port, buf);
+}
+
+bool ShellParseInt(const char *arg, int32_t *value){
+	bool negative = false;
+	uint32_t result = 0, limit;
+	uint8_t base = 10;
+
+	if(*arg == '-' || *arg == '+'){
+		negative = (*arg++ == '-');
+	}
+	if(arg[0] == '0' && (arg[1] == 'x' || arg[1] == 'X')){
+		base = 16;
+		arg += 2;
+	}
+	if(*arg == '\0'){
+		return false;
+	}
+	/* Hexadecimal values are 32 bit patterns (0xFFFFFFFF is -1) */
+	limit = (base == 16) ? UINT32_MAX : negative ? (uint32_t)INT32_MAX + 1 : INT32_MAX;
+	for(; *arg != '\0'; arg++){
+		uint8_t digit;
+		if(*arg >= '0' && *arg <= '9'){
+			digit = *arg - '0';
+		}else if(base == 16 && (*arg | 0x20) >= 'a' && (*arg | 0x20) <= 'f'){
+			digit = (*arg | 0x20) - 'a' + 10;
+		}else{
+			return false;
+		}
+		if(result > (limit - digit) / base){
+			return false;
+		}
+		result = result * base + digit;
+	}
+	*value = negative ? (int32_t)(0 - result) : (int32_t)result;
+	return true;
+}
+
+bool ShellParseFloat(const char *arg, float *value){
+	bool negative = false;
+	bool digits = false;
+	float result = 0, scale = 1;
+
+	if(*arg == '-' || *arg == '+'){
+		negative = (*arg++ == '-');
+	}
+	for(; *arg >= '0' && *arg <= '9'; arg++){
+		result = result * 10 + (*arg - '0');
+		digits = true;
+	}
+	if(*arg == '.'){
+		for(arg++; *arg >= '0' && *arg <= '9'; arg++){
+			scale /= 10;
+			result += (*arg - '0') * scale;
+			digits = true;
+		}
+	}
+	if(!digits || *arg != '\0'){
+		return false;
+	}
+	*value = negative ? -result : result;
+	return true;
+}
+
+/*==================[end of file]============================================*/
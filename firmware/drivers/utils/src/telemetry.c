@@ -0,0 +1,133 @@
+/**
+ * @file telemetry.c
+ * @brief Binary framed telemetry over UART
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "telemetry.h"
+/*==================[macros and definitions]=================================*/
+#define CRC16_INIT		0xFFFF		/*!< CRC16-CCITT initial value */
+#define CRC16_POLY		0x1021		/*!< CRC16-CCITT polynomial */
+#define COBS_BLOCK		0xFF		/*!< COBS code of a full block (254 non zero bytes) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint8_t *PutVarint(uint8_t *dst, uint32_t value){
+	while(value >= 0x80){
+		*dst++ = (value & 0x7F) | 0x80;
+		value >>= 7;
+	}
+	*dst++ = value;
+	return dst;
+}
+
+static uint32_t ZigZag(int32_t value){
+	return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+/*==================[external functions definition]==========================*/
+uint16_t TelemetryCrc16(const uint8_t *data, uint16_t len){
+	uint16_t crc = CRC16_INIT;
+
+	while(len--){
+		crc ^= (uint16_t)(*data++) << 8;
+		for(uint8_t i = 0; i < 8; i++){
+			crc = (crc & 0x8000) ? (crc << 1) ^ CRC16_POLY : crc << 1;
+		}
+	}
+	return crc;
+}
+
+uint16_t TelemetryCobsEncode(const uint8_t *src, uint16_t len, uint8_t *dst){
+	uint8_t *code_p = dst;
+	uint8_t *out = dst + 1;
+	uint8_t code = 1;
+
+	for(uint16_t i = 0; i < len; i++){
+		if(src[i] == 0){
+			*code_p = code;
+			code_p = out++;
+			code = 1;
+		}else{
+			*out++ = src[i];
+			if(++code == COBS_BLOCK){
+				*code_p = code;
+				code_p = out++;
+				code = 1;
+			}
+		}
+	}
+	*code_p = code;
+	return out - dst;
+}
+
+uint16_t TelemetryCobsDecode(const uint8_t *src, uint16_t len, uint8_t *dst){
+	uint16_t i = 0;
+	uint16_t out = 0;
+
+	while(i < len){
+		uint8_t code = src[i++];
+		if(code == 0 || i + code - 1 > len){
+			return 0;
+		}
+		for(uint8_t j = 1; j < code; j++){
+			dst[out++] = src[i++];
+		}
+		if(code != COBS_BLOCK && i < len){
+			dst[out++] = 0;
+		}
+	}
+	return out;
+}
+
+uint16_t TelemetryPackSamples(telemetry_stream_t *stream, const uint16_t *samples, uint8_t scans, uint32_t timestamp, uint8_t *frame){
+	uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+	uint8_t *p = payload;
+	uint16_t num_samples = scans * stream->num_channels;
+	uint16_t crc, len;
+
+	if(num_samples > TELEMETRY_MAX_SAMPLES){
+		return 0;
+	}
+	*p++ = TELEMETRY_PKT_SAMPLES;
+	*p++ = stream->seq++;
+	p = PutVarint(p, timestamp);
+	p = PutVarint(p, stream->sample_period);
+	*p++ = stream->num_channels;
+	*p++ = scans;
+	for(uint16_t i = 0; i < num_samples; i++){
+		if(i < stream->num_channels){
+			p = PutVarint(p, samples[i]);
+		}else{
+			p = PutVarint(p, ZigZag((int32_t)samples[i] - samples[i - stream->num_channels]));
+		}
+	}
+	crc = TelemetryCrc16(payload, p - payload);
+	*p++ = crc & 0xFF;
+	*p++ = crc >> 8;
+
+	len = TelemetryCobsEncode(payload, p - payload, frame);
+	frame[len++] = 0;
+	return len;
+}
+
+bool TelemetrySendSamples(telemetry_stream_t *stream, const uint16_t *samples, uint8_t scans, uint32_t timestamp){
+	uint8_t frame[TELEMETRY_MAX_FRAME];
+	uint16_t len = TelemetryPackSamples(stream, samples, scans, timestamp, frame);
+
+	if(len == 0){
+		return false;
+	}
+	UartSendBuffer(stream->port, (const char*)frame, len);
+	return true;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""Compressor for the ILI9341 driver fonts, icons and pictures.
+
+Reads the C sources of the driver (fonts.c, icons.c or a RGB565 picture
+array like esp_edu_pic.c) and writes a C source with the same data run
+length encoded, in the format decoded by the driver while it streams the
+pixels to the LCD:
+
+  1 bit/pixel (fonts, icons): pixels in row order (rows not padded), as
+  lengths of alternating background/foreground runs, starting with
+  background. Each length is a sum of bytes ended by a byte lower than 255.
+
+  RGB565 (pictures): a header byte n followed by n + 1 literal pixels
+  (n < 128), or by one pixel repeated n - 126 times (n >= 128). Pixels are
+  2 bytes, high byte first.
+
+    python3 bitmap_rle.py font ../drivers/devices/src/fonts.c -o fonts_rle.c
+    python3 bitmap_rle.py icon ../drivers/devices/src/icons.c -o icons_rle.c
+    python3 bitmap_rle.py picture ../drivers/devices/src/esp_edu_pic.c -n picture -o pic_rle.c
+
+Every encoded bitmap is decoded back and compared before writing (use
+--bench to also measure the decoding throughput).
+"""
+
+import argparse
+import re
+import sys
+import time
+
+
+def strip_comments(src):
+    src = re.sub(r"/\*.*?\*/", "", src, flags=re.S)
+    return re.sub(r"//[^\n]*", "", src)
+
+
+def c_arrays(src):
+    """Returns {name: [values]} for every initialized array in src."""
+    arrays = {}
+    for name, body in re.findall(r"(\w+)\s*\[\]\s*=\s*\{(.*?)\};", src, flags=re.S):
+        arrays[name] = [int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\d+", body)]
+    return arrays
+
+
+def c_structs(src, type_name):
+    """Returns {name: [fields]} for every type_name initialized variable in src."""
+    return {name: [f.strip() for f in body.split(",") if f.strip()]
+            for name, body in re.findall(type_name + r"\s+(\w+)\s*=\s*\{(.*?)\};", src, flags=re.S)}
+
+
+def bits_to_pixels(data, offset, width, height):
+    row_bytes = (width + 7) // 8
+    pixels = []
+    for row in range(height):
+        line = data[offset + row * row_bytes:offset + (row + 1) * row_bytes]
+        pixels += [(line[j // 8] >> (7 - j % 8)) & 1 for j in range(width)]
+    return pixels
+
+
+def encode_bits(pixels):
+    out = bytearray()
+    color = 0
+    i = 0
+    while i <= len(pixels):
+        run = 0
+        while i < len(pixels) and pixels[i] == color:
+            run += 1
+            i += 1
+        while run >= 255:
+            out.append(255)
+            run -= 255
+        out.append(run)
+        color ^= 1
+        if i == len(pixels):
+            break
+    return bytes(out)
+
+
+def decode_bits(data, count):
+    pixels = []
+    pos = 0
+    color = 0
+    while len(pixels) < count:
+        run = 0
+        while True:
+            byte = data[pos]
+            pos += 1
+            run += byte
+            if byte != 255:
+                break
+        pixels += [color] * run
+        color ^= 1
+    return pixels[:count]
+
+
+def encode_rgb565(pixels):
+    out = bytearray()
+    i = 0
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend((p >> 8, p & 0xFF))
+
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 129 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush()
+            out.append(run + 126)
+            out.extend((pixels[i] >> 8, pixels[i] & 0xFF))
+        else:
+            literal.append(pixels[i])
+        i += run
+    flush()
+    return bytes(out)
+
+
+def decode_rgb565(data, count):
+    pixels = []
+    pos = 0
+    while len(pixels) < count:
+        n = data[pos]
+        pos += 1
+        if n < 128:
+            for _ in range(n + 1):
+                pixels.append((data[pos] << 8) | data[pos + 1])
+                pos += 2
+        else:
+            pixels += [(data[pos] << 8) | data[pos + 1]] * (n - 126)
+            pos += 2
+    return pixels
+
+
+def c_bytes(name, data, comment):
+    lines = ["/**", " * @brief " + comment, " */", "const uint8_t %s[] = {" % name]
+    for i in range(0, len(data), 16):
+        lines.append("\t" + " ".join("0x%02X," % b for b in data[i:i + 16]))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def check(decoded, pixels, what):
+    if decoded != pixels:
+        sys.exit("round trip failed: " + what)
+
+
+def convert_fonts(src, bench):
+    arrays = c_arrays(src)
+    fonts = c_structs(src, "Font_t")
+    info_re = re.compile(r"char_info_t\s+(\w+)\s*\[\]\s*=\s*\{(.*?)\};", re.S)
+    infos = {name: [tuple(int(v) for v in e) for e in re.findall(r"\{\s*(\d+)\s*,\s*(\d+)\s*\}", body)]
+             for name, body in info_re.findall(src)}
+    out, externs, stats = [], [], []
+    for font, (height, info_name, data_name) in fonts.items():
+        height = int(height)
+        data = arrays[data_name]
+        encoded = bytearray()
+        info = []
+        glyphs = []
+        for width, offset in infos[info_name]:
+            pixels = bits_to_pixels(data, offset, width, height)
+            rle = encode_bits(pixels)
+            check(decode_bits(rle, len(pixels)), pixels, "%s width %d offset %d" % (font, width, offset))
+            info.append((width, len(encoded)))
+            glyphs.append((rle, len(pixels)))
+            encoded += rle
+        if len(encoded) >= len(data):
+            print("%s: not compressed (%d -> %d bytes)" % (font, len(data), len(encoded)), file=sys.stderr)
+            continue
+        prefix = data_name.replace("_data", "_rle")
+        out.append(c_bytes(prefix + "_data", encoded, "%d pixels height compressed data array." % height))
+        out.append("/**\n * @brief %d pixels height compressed char info array.\n */\n"
+                   "char_info_t %s_info[] = {\n" % (height, prefix) +
+                   "".join("\t{%d, %d}, \t\t/* %s */\n" % (w, o, chr(32 + i)) for i, (w, o) in enumerate(info)) +
+                   "};\n")
+        out.append("Font_t %s_rle = {\n\t%d,\n\t%s_info,\n\t%s_data,\n\t1\n};\n" % (font, height, prefix, prefix))
+        externs.append("extern Font_t %s_rle;" % font)
+        stats.append((font, len(data), len(encoded), glyphs))
+    return "#include \"fonts.h\"\n", out, externs, stats, bench
+
+
+def convert_icons(src, bench):
+    arrays = c_arrays(src)
+    icons = c_structs(src, "icon_font_t")
+    out, externs, stats = [], [], []
+    for icon, (height, width, stride, data_name) in icons.items():
+        height, width, stride = int(height), int(width), int(stride)
+        data = arrays[data_name]
+        encoded = bytearray()
+        offsets = []
+        glyphs = []
+        for offset in range(0, len(data) - stride + 1, stride):
+            pixels = bits_to_pixels(data, offset, width, height)
+            rle = encode_bits(pixels)
+            check(decode_bits(rle, len(pixels)), pixels, "%s offset %d" % (icon, offset))
+            offsets.append(len(encoded))
+            glyphs.append((rle, len(pixels)))
+            encoded += rle
+        if len(encoded) >= len(data):
+            print("%s: not compressed (%d -> %d bytes)" % (icon, len(data), len(encoded)), file=sys.stderr)
+            continue
+        prefix = data_name.replace("_data", "_rle")
+        out.append(c_bytes(prefix + "_data", encoded, "%dx%d compressed icon data array." % (width, height)))
+        out.append("/**\n * @brief %dx%d compressed icon offsets.\n */\n"
+                   "const uint32_t %s_offset[] = {\n" % (width, height, prefix) +
+                   "".join("\t%s\n" % " ".join("%d," % o for o in offsets[i:i + 8]) for i in range(0, len(offsets), 8)) +
+                   "};\n")
+        out.append("icon_font_t %s_rle = {\n    %d,\n    %d,\n    0,\n    %s_data,\n    %s_offset\n};\n"
+                   % (icon, height, width, prefix, prefix))
+        externs.append("extern icon_font_t %s_rle;" % icon)
+        stats.append((icon, len(data), len(encoded), glyphs))
+    return "#include \"icons.h\"\n", out, externs, stats, bench
+
+
+def convert_picture(src, name, bench):
+    data = c_arrays(src)[name]
+    pixels = [(data[i] << 8) | data[i + 1] for i in range(0, len(data) - 1, 2)]
+    encoded = encode_rgb565(pixels)
+    check(decode_rgb565(encoded, len(pixels)), pixels, name)
+    out = [c_bytes(name + "_rle", encoded, "Compressed RGB565 picture (%d pixels)." % len(pixels))]
+    stats = [(name, len(data), len(encoded), [(encoded, -len(pixels))])]
+    return "#include <stdint.h>\n", out, ["extern const uint8_t %s_rle[];" % name], stats, bench
+
+
+def benchmark(stats):
+    for name, _, _, items in stats:
+        pixels = 0
+        start = time.perf_counter()
+        for rle, count in items:
+            if count < 0:
+                decode_rgb565(rle, -count)
+            else:
+                decode_bits(rle, count)
+            pixels += abs(count)
+        elapsed = time.perf_counter() - start
+        print("%s: %.2f Mpixel/s (python decoder)" % (name, pixels / elapsed / 1e6), file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("kind", choices=("font", "icon", "picture"))
+    parser.add_argument("source", help="C source with the bitmaps")
+    parser.add_argument("-o", "--output", default="-", help="C source to write (default: stdout)")
+    parser.add_argument("-n", "--name", default="picture", help="picture array name")
+    parser.add_argument("--bench", action="store_true", help="measure decoding throughput")
+    args = parser.parse_args()
+
+    with open(args.source, encoding="utf-8", errors="replace") as f:
+        src = strip_comments(f.read())
+    if args.kind == "font":
+        include, out, externs, stats, bench = convert_fonts(src, args.bench)
+    elif args.kind == "icon":
+        include, out, externs, stats, bench = convert_icons(src, args.bench)
+    else:
+        include, out, externs, stats, bench = convert_picture(src, args.name, args.bench)
+
+    output = "stdout" if args.output == "-" else args.output.split("/")[-1]
+    text = ("/**\n * @file %s\n * @brief Compressed data generated by tools/bitmap_rle.py from %s (do not edit)\n"
+            " * @version 0.1\n * @date %s\n */\n\n" % (output, args.source.split("/")[-1], time.strftime("%Y-%m-%d")) +
+            "/*==================[inclusions]=============================================*/\n" + include +
+            "/*==================[external data definition]===============================*/\n" +
+            "\n".join(out) + "\n/*==================[end of file]============================================*/\n")
+    if args.output == "-":
+        sys.stdout.write(text)
+    else:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(text)
+    for name, raw, packed, _ in stats:
+        print("%s: %d -> %d bytes (%.1f%%)" % (name, raw, packed, 100.0 * packed / raw), file=sys.stderr)
+    print("\n".join(externs), file=sys.stderr)
+    if bench:
+        benchmark(stats)
+
+
+if __name__ == "__main__":
+    main()
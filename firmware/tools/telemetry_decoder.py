@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Decoder for the binary telemetry frames sent by the telemetry driver.
+
+Reads COBS framed packets from a serial port (pyserial) or a file ("-" for
+stdin) and prints one CSV line per scan: time_us,ch0,ch1,...
+CRC errors and sequence gaps are reported on stderr.
+
+    python3 telemetry_decoder.py /dev/ttyUSB0 -b 115200
+    python3 telemetry_decoder.py capture.bin
+"""
+
+import argparse
+import sys
+
+PKT_SAMPLES = 0x01
+
+
+def crc16(data):
+    """CRC16-CCITT (polynomial 0x1021, initial value 0xFFFF)."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            raise ValueError("malformed COBS frame")
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def get_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def parse_samples(payload):
+    """Returns (seq, timestamp, sample_period, scans) with scans as a list of tuples."""
+    pos = 2
+    seq = payload[1]
+    timestamp, pos = get_varint(payload, pos)
+    period, pos = get_varint(payload, pos)
+    num_channels = payload[pos]
+    num_scans = payload[pos + 1]
+    pos += 2
+    scans = []
+    prev = None
+    for _ in range(num_scans):
+        scan = []
+        for ch in range(num_channels):
+            value, pos = get_varint(payload, pos)
+            scan.append(value if prev is None else prev[ch] + unzigzag(value))
+        scans.append(tuple(scan))
+        prev = scan
+    if pos != len(payload):
+        raise ValueError("packet length mismatch")
+    return seq, timestamp, period, scans
+
+
+def decode_frame(frame):
+    payload = cobs_decode(frame)
+    if len(payload) < 3:
+        raise ValueError("short packet")
+    body, crc = payload[:-2], payload[-2] | (payload[-1] << 8)
+    if crc16(body) != crc:
+        raise ValueError("CRC error")
+    if body[0] != PKT_SAMPLES:
+        raise ValueError("unknown packet type 0x%02x" % body[0])
+    return parse_samples(body)
+
+
+def frames(stream, live=False):
+    """Yield the COBS frames of stream. A live stream (serial port) returns
+    empty reads on timeout, so it is only over when the process is stopped."""
+    buf = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if live:
+                continue
+            return
+        buf += chunk
+        while True:
+            end = buf.find(b"\x00")
+            if end < 0:
+                break
+            if end > 0:
+                yield bytes(buf[:end])
+            del buf[:end + 1]
+
+
+def open_input(args):
+    """Return the input stream and whether it is live (a serial port)."""
+    if args.input == "-":
+        return sys.stdin.buffer, False
+    if args.input.startswith("/dev/") or args.input.upper().startswith("COM"):
+        import serial
+        # The timeout only bounds how long a partial read waits for more bytes
+        return serial.Serial(args.input, args.baudrate, timeout=1), True
+    return open(args.input, "rb"), False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="serial port, file or - for stdin")
+    parser.add_argument("-b", "--baudrate", type=int, default=115200)
+    args = parser.parse_args()
+
+    expected_seq = None
+    errors = 0
+    stream, live = open_input(args)
+    for frame in frames(stream, live):
+        try:
+            seq, timestamp, period, scans = decode_frame(frame)
+        except (ValueError, IndexError) as err:
+            errors += 1
+            print("# frame dropped: %s (%d errors)" % (err, errors), file=sys.stderr)
+            continue
+        if expected_seq is not None and seq != expected_seq:
+            print("# %d packets lost" % ((seq - expected_seq) & 0xFF), file=sys.stderr)
+        expected_seq = (seq + 1) & 0xFF
+        for i, scan in enumerate(scans):
+            print(",".join(str(v) for v in (timestamp + i * period,) + scan))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()